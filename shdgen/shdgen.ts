@@ -12,10 +12,11 @@ const denoArgs = parseArgs(Deno.args, {
     },
 });
 
-type Item = { header: string, shader: string, prefix: string, progs: string[] };
+// storage: the shader uses storage buffers and needs GLSL 4.3, GLSL ES 3.1 and HLSL 5
+type Item = { header: string, shader: string, prefix: string, progs: string[], storage?: boolean };
 
 const items: Item[] = [
-    { header: '../util/sokol_gl.h', shader: 'sokol_gl.glsl', prefix: '_sgl', progs: ['shd'] },
+    { header: '../util/sokol_gl.h', shader: 'sokol_gl.glsl', prefix: '_sgl', progs: ['shd', 'shd_compact'] },
     { header: '../util/sokol_debugtext.h', shader: 'sokol_debugtext.glsl', prefix: '_sdtx', progs: ['shd'] },
     { header: '../util/sokol_fontstash.h', shader: 'sokol_fontstash.glsl', prefix: '_sfons', progs: ['shd'] },
     { header: '../util/sokol_imgui.h', shader: 'sokol_imgui.glsl', prefix: '_simgui', progs: ['shd'] },
@@ -26,7 +27,8 @@ const items: Item[] = [
         shader: 'sokol_framebuffer.glsl',
         prefix:  '_sfb',
         progs: ['rgba8', 'palette8', 'render'],
-    }
+    },
+    { header: '../util/sokol_sprite.h', shader: 'sokol_sprite.glsl', prefix: '_ssprite', progs: ['shd'], storage: true },
 ];
 
 function dirExists(path: string): boolean {
@@ -67,14 +69,26 @@ async function main(): Promise<void> {
     }
 }
 
+function glcoreSlang(item: Item): string {
+    return item.storage ? 'glsl430' : 'glsl410';
+}
+
+function gles3Slang(item: Item): string {
+    return item.storage ? 'glsl310es' : 'glsl300es';
+}
+
+function hlslSlang(item: Item): string {
+    return item.storage ? 'hlsl5' : 'hlsl4';
+}
+
 async function compile(item: Item): Promise<void> {
     let slangs: string;
     if (denoArgs.hlsl) {
-        slangs = 'hlsl4';
+        slangs = hlslSlang(item);
     } else {
-        slangs = 'glsl410:glsl300es:metal_macos:metal_ios:metal_sim:wgsl:spirv_vk';
+        slangs = `${glcoreSlang(item)}:${gles3Slang(item)}:metal_macos:metal_ios:metal_sim:wgsl:spirv_vk`;
         if (denoArgs.local) {
-            slangs += ':hlsl4';
+            slangs += `:${hlslSlang(item)}`;
         }
     }
     const args = [
@@ -119,18 +133,18 @@ function gatherSlang(item: Item, prog: string, slang: string, ext: string, isBin
 function gatherShader(item: Item, prog: string): string[] {
     const res: string[] = [];
     res.push('#if defined(SOKOL_GLCORE)');
-    res.push(...gatherSlang(item, prog, 'glsl410', '.glsl', false));
+    res.push(...gatherSlang(item, prog, glcoreSlang(item), '.glsl', false));
     res.push('#elif defined(SOKOL_GLES3)');
-    res.push(...gatherSlang(item, prog, 'glsl300es', '.glsl', false));
+    res.push(...gatherSlang(item, prog, gles3Slang(item), '.glsl', false));
     res.push('#elif defined(SOKOL_METAL)');
     res.push(...gatherSlang(item, prog, 'metal_macos', '.metallib', true));
     res.push(...gatherSlang(item, prog, 'metal_ios', '.metallib', true));
     res.push(...gatherSlang(item, prog, 'metal_sim', '.metal', false));
     res.push('#elif defined(SOKOL_D3D11)');
     if (denoArgs.local) {
-        res.push(...gatherSlang(item, prog, 'hlsl4', '.hlsl', false));
+        res.push(...gatherSlang(item, prog, hlslSlang(item), '.hlsl', false));
     } else {
-        res.push(...gatherSlang(item, prog, 'hlsl4', '.fxc', true));
+        res.push(...gatherSlang(item, prog, hlslSlang(item), '.fxc', true));
     }
     res.push('#elif defined(SOKOL_WGPU)');
     res.push(...gatherSlang(item, prog, 'wgsl', '.wgsl', false));
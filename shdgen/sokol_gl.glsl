@@ -19,6 +19,28 @@ void main() {
 }
 @end
 
+// vertex shader for the compact vertex layout (SGL_VERTEXLAYOUT_COMPACT),
+// there's no per-vertex point size, points are always 1 pixel
+@vs vs_compact
+layout(binding=0) uniform vs_params {
+    mat4 mvp;
+    mat4 tm;
+};
+in vec4 position;
+in vec2 texcoord0;
+in vec4 color0;
+out vec4 uv;
+out vec4 color;
+void main() {
+    gl_Position = mvp * position;
+    #ifndef SOKOL_WGSL
+    gl_PointSize = 1.0;
+    #endif
+    uv = tm * vec4(texcoord0, 0.0, 1.0);
+    color = color0;
+}
+@end
+
 @fs fs
 layout(binding=0) uniform texture2D tex;
 layout(binding=0) uniform sampler smp;
@@ -31,3 +53,4 @@ void main() {
 @end
 
 @program shd vs fs
+@program shd_compact vs_compact fs
@@ -0,0 +1,50 @@
+@vs vs
+layout(binding=0) uniform vs_params {
+    mat4 mvp;
+    vec4 right;
+    vec4 up;
+    vec4 misc;
+};
+struct sprite {
+    float x; float y; float z; float rot;
+    float w; float h;
+    uint uv0; uint uv1; uint color;
+};
+layout(binding=1) readonly buffer ssprite_sbuf {
+    sprite sprites[];
+};
+out vec2 uv;
+out vec4 color;
+const vec2 corners[6] = {
+    vec2(-0.5, 0.5), vec2(0.5, 0.5), vec2(0.5, -0.5),
+    vec2(-0.5, 0.5), vec2(0.5, -0.5), vec2(-0.5, -0.5),
+};
+void main() {
+    // misc.x is the index of the first sprite of the draw call
+    int idx = gl_InstanceIndex + int(misc.x);
+    vec2 c = corners[gl_VertexIndex];
+    vec2 ofs = c * vec2(sprites[idx].w, sprites[idx].h);
+    float sn = sin(sprites[idx].rot);
+    float cs = cos(sprites[idx].rot);
+    ofs = vec2(ofs.x * cs - ofs.y * sn, ofs.x * sn + ofs.y * cs);
+    vec3 pos = vec3(sprites[idx].x, sprites[idx].y, sprites[idx].z) + right.xyz * ofs.x + up.xyz * ofs.y;
+    gl_Position = mvp * vec4(pos, 1.0);
+    vec2 uv0 = unpackUnorm2x16(sprites[idx].uv0);
+    vec2 uv1 = unpackUnorm2x16(sprites[idx].uv1);
+    uv = mix(uv0, uv1, vec2(c.x + 0.5, 0.5 - c.y));
+    color = unpackUnorm4x8(sprites[idx].color);
+}
+@end
+
+@fs fs
+layout(binding=0) uniform texture2D tex;
+layout(binding=0) uniform sampler smp;
+in vec2 uv;
+in vec4 color;
+out vec4 frag_color;
+void main() {
+    frag_color = texture(sampler2D(tex, smp), uv) * color;
+}
+@end
+
+@program shd vs fs
@@ -154,6 +154,13 @@
             sg_shader sg_make_shader(const sg_shader_desc*)
             sg_pipeline sg_make_pipeline(const sg_pipeline_desc*)
 
+        ...or reserve the handles for many buffers, images or views at once
+        (e.g. when loading a level), see RESOURCE CREATION AND DESTRUCTION IN DETAIL:
+
+            bool sg_alloc_buffers(int num, sg_buffer* out_bufs)
+            bool sg_alloc_images(int num, sg_image* out_imgs)
+            bool sg_alloc_views(int num, sg_view* out_views)
+
     --- start a render- or compute-pass:
 
             sg_begin_pass(const sg_pass* pass);
@@ -322,6 +329,23 @@
         operation only references the valid (updated) data in the
         buffer or image.
 
+    --- to overwrite a rectangular region of an image, call:
+
+            sg_update_image_region(const sg_write_image_desc* desc)
+
+        The image must have been created with sg_image_desc.usage.region_update.
+        In contrast to sg_update_image(), sg_update_image_region() may be called
+        multiple times per frame, and the content outside the written region
+        is preserved. This is useful for texture atlases where new items
+        are added at runtime. Region-update images are not multi-buffered,
+        on backends without implicit synchronization of CPU writes (Metal)
+        the caller must not overwrite regions which are still sampled by
+        in-flight frames (e.g. delay reusing a region for SG_NUM_INFLIGHT_FRAMES
+        frames). The layout of the source data is described the same way
+        as for sg_write_image_unsealed(), except that a zero-initialized
+        .src.bytes_per_row and .src.bytes_per_slice default to tightly packed
+        data of the written region (not of the entire mip level).
+
     --- to append a chunk of data to a buffer resource, call:
 
             int sg_append_buffer(sg_buffer buf, const sg_range* data)
@@ -377,6 +401,49 @@
         is associated with one draw call, but will be problematic when
         a single indexed draw call spans several appended chunks of indices.
 
+    --- to write new data directly into a stream-update buffer without first
+        building it in application-owned memory, call:
+
+            void* sg_map_buffer(sg_buffer buf, size_t size)
+            void sg_unmap_buffer(sg_buffer buf)
+
+        sg_map_buffer() returns a pointer to 'size' bytes of write-only memory
+        which becomes the new buffer content starting at offset 0 when
+        sg_unmap_buffer() is called:
+
+            float* ptr = (float*) sg_map_buffer(buf, num_bytes);
+            ...write vertices into ptr...
+            sg_unmap_buffer(buf);
+
+        The same rules as for sg_update_buffer() apply, a mapping counts as
+        the one allowed update per buffer and frame, and it cannot be mixed
+        with sg_append_buffer() on the same buffer in the same frame. Additionally:
+
+            - the buffer must have been created with usage.stream_update
+            - the initial content of the mapped memory is undefined, don't
+              read from it
+            - the pointer is only valid until sg_unmap_buffer()
+            - the buffer must be unmapped before it is used in sg_apply_bindings()
+              and before sg_commit() (this is checked by the validation layer)
+
+        On the following backends the returned pointer points directly into
+        buffer memory:
+
+            - desktop GL and GLES3 (but not WebGL2): the next in-flight buffer
+              slot via glMapBufferRange()
+            - D3D11: ID3D11DeviceContext::Map() with D3D11_MAP_WRITE_DISCARD
+            - Metal: the contents of the next in-flight MTLBuffer
+
+        On WebGPU, Vulkan and the dummy backend (or when a direct mapping
+        fails) the pointer points into a staging memory block owned by
+        sokol-gfx which is copied into the buffer in sg_unmap_buffer(),
+        the staging block is allocated on the first sg_map_buffer() call with
+        the size of the buffer and freed when the buffer is destroyed.
+        Destroying a mapped buffer implicitly unmaps it.
+
+        sg_map_buffer() returns a null pointer if the buffer is not valid
+        or a validation check failed.
+
     --- to check at runtime for optional features, limits and pixelformat support,
         call:
 
@@ -1841,6 +1908,349 @@
     listener item was found and removed, and false otherwise.
 
 
+    FRAME BUDGETS
+    =============
+    sokol-gfx can track the amount of work recorded in a frame against a
+    per-frame budget, this is useful for systems like texture streaming or
+    LOD transitions which can spread their work over several frames instead
+    of causing a frame hitch. The following budget items are tracked (see
+    sg_frame_budget for details):
+
+        - num_draws: number of draw- and dispatch-calls
+        - num_passes: number of passes
+        - upload_bytes: number of bytes uploaded into buffers and images
+
+    Budget items are counted in the backend-agnostic part of sokol-gfx
+    independently from the frame statistics, only calls which actually
+    result in work are counted (e.g. skipped draw calls or failed
+    validation checks are not counted).
+
+    A budget is configured in sg_setup(), a zero item means 'unlimited':
+
+        sg_setup(&(sg_desc){
+            .frame_budget = {
+                .num_draws = 2000,
+                .upload_bytes = 8 * 1024 * 1024,
+            },
+            ...
+        });
+
+    ...or changed at any time with:
+
+        sg_set_frame_budget(&(sg_frame_budget){ ... });
+
+    Exceeding a budget doesn't change the behaviour of sokol-gfx (e.g. work
+    isn't dropped), it's only a signal for the application. To check whether
+    additional work would exceed the budget of the current frame:
+
+        if (sg_query_budget_will_exceed(&(sg_frame_budget){ .upload_bytes = tex_size })) {
+            // defer the texture upload to a later frame
+        }
+
+    To get the current budget and usage of the current frame:
+
+        sg_budget_state state = sg_query_budget_state();
+
+    Optionally, a callback can be installed in sg_setup() which is called
+    from inside the sokol-gfx function which exceeded a budget item, at
+    most once per budget item and frame:
+
+        static void budget_exceeded(sg_budget_item item, const sg_budget_state* state, void* user_data) {
+            ...
+        }
+
+        sg_setup(&(sg_desc){
+            .frame_budget = { ... },
+            .budget_callback = {
+                .func = budget_exceeded,
+                .user_data = ...,
+            },
+        });
+
+    The budget usage is reset in sg_commit() (after the commit listeners
+    have been called).
+
+
+    ASYNCHRONOUS READBACK
+    =====================
+    Buffer and image content can be copied back into CPU memory with the
+    functions sg_read_buffer() and sg_read_image(). Both functions don't
+    wait for the GPU, instead the readback operation is recorded, and the
+    data arrives in the provided destination memory a few frames later
+    (usually SG_NUM_INFLIGHT_FRAMES frames, but this depends on the
+    backend and GPU workload).
+
+    Check the sg_features.readback flag whether asynchronous readback is
+    supported by the active backend. Currently this is the case for the GL
+    backends (except WebGL2) and the dummy backend (which simulates the
+    frame latency and writes zeroes into the destination memory).
+
+    For instance to read back a storage buffer after a compute pass:
+
+        static uint8_t data[1024];
+
+        sg_readback rb = sg_read_buffer(&(sg_read_buffer_desc){
+            .src = { .buffer = sbuf, .offset = 0 },
+            .size = sizeof(data),
+            .dst = SG_RANGE(data),
+            .callback = readback_done,
+            .user_data = ...,
+        });
+
+    ...or to read back a render target image:
+
+        sg_readback rb = sg_read_image(&(sg_read_image_desc){
+            .src = { .image = color_img },
+            .dst = { .ptr = pixels, .size = width * height * 4 },
+        });
+
+    In sg_read_image(), the pixel data of a single mip-level and slice is
+    written as tightly packed rows, and a default-zero .size.width and
+    .size.height means 'the rest of the mip-level'.
+
+    Both functions must be called outside of render or compute passes.
+    The readback captures the buffer or image content after all
+    previously recorded passes of the current frame.
+
+    The destination memory must remain valid until the readback has finished.
+    There are two ways to find out when this is the case:
+
+    - poll the readback state with sg_query_readback_state(), which returns
+      SG_READBACKSTATE_PENDING until the data has arrived, and
+      SG_READBACKSTATE_COMPLETED or SG_READBACKSTATE_FAILED afterwards
+    - or provide a callback function which is called from inside sg_commit()
+      with an sg_readback_response struct pointer:
+
+        static void readback_done(const sg_readback_response* response) {
+            if (response->state == SG_READBACKSTATE_COMPLETED) {
+                // response->data.ptr and .size describe the written data
+            }
+        }
+
+    Finished readback operations free their internal slot, a readback handle
+    will report its final state until the slot is reused by another readback
+    operation, at which point SG_READBACKSTATE_INVALID is returned.
+
+    By default 64 readbacks can be in flight at the same time, this can be
+    tweaked in the sg_setup() call:
+
+        sg_setup(&(sg_desc){
+            .max_readbacks = 256,
+        });
+
+    When all readback slots are in use, sg_read_buffer() and sg_read_image()
+    return an invalid handle and log a READBACK_POOL_EXHAUSTED error.
+
+
+    GPU TIMERS
+    ==========
+    The sg_frame_stats struct only counts function calls, to measure how
+    much GPU time a sequence of rendering or compute commands actually takes,
+    wrap the commands in a named timer scope inside a pass:
+
+        sg_begin_pass(&(sg_pass){ ... });
+        sg_begin_timer("shadow");
+        ...
+        sg_end_timer();
+        sg_end_pass();
+
+    Timer results are resolved a few frames later (usually after
+    SG_NUM_INFLIGHT_FRAMES frames) inside sg_commit(). To get the most
+    recently resolved result for a timer label call:
+
+        const sg_timer_result res = sg_query_timer("shadow");
+        if (res.valid) {
+            // res.duration_ns is the GPU time in nanoseconds between
+            // sg_begin_timer() and sg_end_timer(), and res.frame_index
+            // is the frame in which the measurement was recorded
+        }
+
+    Some rules:
+
+    - timer scopes must be started and ended inside the same pass
+    - timer scopes cannot be nested
+    - each timer label can only be used once per frame
+    - labels are compared by their string content, and must be
+      shorter than 32 characters
+
+    Check the sg_features.gpu_timers flag whether GPU timers are supported
+    by the active backend. Currently this is the case for desktop GL 3.3+
+    (via GL_TIMESTAMP queries) and the dummy backend (which uses CPU
+    timestamps so that the plumbing can be tested without a GPU). On
+    other backends, sg_begin_timer() and sg_end_timer() are silent no-ops
+    and sg_query_timer() never returns a valid result.
+
+    The number of distinct timer labels defaults to 32, this can be
+    tweaked in the sg_setup() call:
+
+        sg_setup(&(sg_desc){
+            .max_timers = 64,
+        });
+
+
+    OCCLUSION QUERIES
+    =================
+    Occlusion queries count how many samples of the draw calls recorded
+    between sg_begin_occlusion_query() and sg_end_occlusion_query() passed
+    the depth- and stencil-test. The typical use case is visibility-driven
+    culling, where the results of previous frames decide whether an
+    (expensive) object needs to be rendered in the current frame.
+
+    Occlusion query objects are long-lived and should be created once
+    for each object that needs visibility information:
+
+        sg_occlusion_query query = sg_make_occlusion_query(&(sg_occlusion_query_desc){
+            .type = SG_OCCLUSIONQUERYTYPE_ANY_SAMPLES_PASSED,
+        });
+
+    The .type defaults to SG_OCCLUSIONQUERYTYPE_ANY_SAMPLES_PASSED (only
+    tells whether any samples passed, which is cheaper on some GPUs),
+    use SG_OCCLUSIONQUERYTYPE_SAMPLES_PASSED to get the exact number
+    of passed samples (check sg_features.occlusion_query_samples).
+
+    Inside a render pass, wrap the draw calls to test in a query scope, for
+    instance to render a simple bounding box with color- and depth-writes
+    disabled:
+
+        sg_begin_occlusion_query(query);
+        sg_apply_pipeline(bbox_pip);
+        ...
+        sg_draw(0, 36, 1);
+        sg_end_occlusion_query();
+
+    The results are resolved asynchronously inside sg_commit() a few frames
+    later (usually after SG_NUM_INFLIGHT_FRAMES frames), call
+    sg_query_occlusion_result() to get the most recently resolved result:
+
+        const sg_occlusion_query_result res = sg_query_occlusion_result(query);
+        if (!res.valid || res.visible) {
+            // no result yet or object was visible in frame res.frame_index
+            draw_object();
+        }
+
+    Some rules:
+
+    - occlusion query scopes must be started and ended inside the same
+      render pass
+    - occlusion query scopes cannot be nested
+    - each occlusion query object can only be used once per frame
+
+    Check the sg_features.occlusion_query flag whether occlusion queries
+    are supported by the active backend, currently this is the case for
+    the GL backends (GL 3.3+, GLES3 and WebGL2) and the dummy backend.
+    On other backends, occlusion query objects can be created, but the
+    query scope functions are silent no-ops and sg_query_occlusion_result()
+    never returns a valid result.
+
+    The dummy backend has no rasterizer, instead the sample count which
+    will be reported for an occlusion query can be configured with:
+
+        sg_dummy_set_occlusion_result(query, num_samples);
+
+    ...by default the dummy backend reports a sample count of 1 (e.g.
+    'visible'). Like on real GPUs, the configured result arrives
+    SG_NUM_INFLIGHT_FRAMES frames after recording the query, which allows
+    to test latency-hiding code without a GPU.
+
+    The number of occlusion query objects defaults to 256, this can be
+    tweaked in the sg_setup() call:
+
+        sg_setup(&(sg_desc){
+            .occlusion_query_pool_size = 1024,
+        });
+
+
+    COMMAND LISTS
+    =============
+    All sokol-gfx functions must be called from the same thread. To spread
+    scene traversal, culling and draw call recording over multiple threads,
+    worker threads can record draw commands into command list objects,
+    which are then replayed on the render thread inside a render pass.
+
+    Command list objects are long-lived and must be created and destroyed
+    on the render thread:
+
+        sg_command_list list = sg_make_command_list(&(sg_command_list_desc){
+            .size = 256 * 1024,
+        });
+
+    The .size item is the size of the command list's linear memory buffer
+    in bytes (default: 64 KB), all recorded commands and uniform data
+    must fit into this buffer.
+
+    On a worker thread, record commands between sg_begin_command_list()
+    and sg_end_command_list(). The recording functions mirror the regular
+    render functions, but take the command list as first argument:
+
+        sg_begin_command_list(list);
+        sg_cmd_apply_pipeline(list, pip);
+        sg_cmd_apply_bindings(list, &(sg_bindings){ ... });
+        sg_cmd_apply_uniforms(list, UB_vs_params, &SG_RANGE(vs_params));
+        sg_cmd_draw(list, 0, num_elements, 1);
+        sg_end_command_list(list);
+
+    The recording functions are:
+
+        sg_cmd_apply_viewport(list, x, y, width, height, origin_top_left)
+        sg_cmd_apply_scissor_rect(list, x, y, width, height, origin_top_left)
+        sg_cmd_apply_pipeline(list, pip)
+        sg_cmd_apply_bindings(list, bindings)
+        sg_cmd_apply_uniforms(list, ub_slot, data)
+        sg_cmd_draw(list, base_element, num_elements, num_instances)
+        sg_cmd_draw_ex(list, base_element, num_elements, num_instances, base_vertex, base_instance)
+
+    Uniform data is copied into the command list, so the data pointer
+    doesn't need to remain valid after sg_cmd_apply_uniforms() returns.
+
+    Back on the render thread, replay one or more command lists in order
+    inside a render pass:
+
+        sg_begin_pass(...);
+        sg_execute_command_lists(lists, num_lists);
+        sg_end_pass();
+
+    Replaying a command list is equivalent to calling the regular
+    sg_apply_*() and sg_draw*() functions, this means that frame stats,
+    frame budgets and trace hooks see the replayed calls like any other
+    calls. A recorded command list remains valid until the next
+    sg_begin_command_list() call, so that static command lists can be
+    replayed in multiple passes and frames.
+
+    In debug mode, the commands are validated at record time on the
+    recording thread (for instance that a pipeline is alive and valid,
+    that all required bindings are provided and that the uniform data
+    size matches the shader's uniform block). Invalid commands are
+    logged and skipped together with the following draw calls until the
+    next valid sg_cmd_apply_pipeline(). Checks which depend on the
+    render pass (like matching pixel formats) happen when the command
+    list is replayed.
+
+    Some rules:
+
+    - a command list must only be recorded by one thread at a time, but
+      any number of command lists can be recorded in parallel
+    - each command list must start with an sg_cmd_apply_pipeline() call,
+      render state is not inherited from previously replayed command lists
+    - resource objects used by the recording threads must not be created
+      or destroyed while recording is in progress, and command list objects
+      must not be created or destroyed while any command list is recorded
+    - the logger callback (see sg_desc.logger) must be thread-safe when
+      command lists are recorded on multiple threads
+    - sg_execute_command_lists() must be called inside a render pass, and
+      the command lists must not be recorded at the same time
+    - when a command list runs out of memory, an error is logged and
+      all following commands are dropped until the next
+      sg_begin_command_list(), use sg_query_command_list_info() to
+      check the memory usage of a command list
+
+    The number of command list objects defaults to 64, this can be tweaked
+    in the sg_setup() call:
+
+        sg_setup(&(sg_desc){
+            .command_list_pool_size = 256,
+        });
+
+
     RESOURCE CREATION AND DESTRUCTION IN DETAIL
     ===========================================
     The 'vanilla' way to create resource objects is with the 'make functions':
@@ -1940,6 +2350,29 @@
     an 'alloc function' followed by the matching 'init function' is fully
     equivalent with calling the 'make function' alone.
 
+    Handles for buffers, images and views can also be reserved in batches,
+    for instance when loading a level with thousands of resources:
+
+        bool sg_alloc_buffers(int num, sg_buffer* out_bufs)
+        bool sg_alloc_images(int num, sg_image* out_imgs)
+        bool sg_alloc_views(int num, sg_view* out_views)
+
+    The batch alloc functions write 'num' handles in ALLOC state into the
+    output array. The reservation is atomic: if the pool doesn't have enough
+    free slots for the entire batch, *no* slot is reserved, all output
+    handles will be invalid and the function returns false (with an error
+    logged). This guarantees upfront that a whole level fits into the
+    resource pools, the resources are then initialized one by one with the
+    regular init functions (which still run the defaults, validation and
+    backend creation steps per resource):
+
+        sg_image imgs[NUM_IMAGES];
+        if (sg_alloc_images(NUM_IMAGES, imgs)) {
+            for (int i = 0; i < NUM_IMAGES; i++) {
+                sg_init_image(imgs[i], &img_descs[i]);
+            }
+        }
+
     Destruction can also happen as a two-step process. The 'uninit functions'
     will put a resource object from the VALID or FAILED state back into the
     ALLOC state:
@@ -2401,6 +2834,10 @@ typedef struct sg_features {
     bool dual_source_blending;          // dual-source-blending supported
     bool vertexformat_int10_n2;         // SG_VERTEXFORMAT_INT10_N2 is supported
     bool gl_texture_views;              // supports 'proper' texture views (GL 4.3+)
+    bool readback;                      // asynchronous buffer and image readback with sg_read_buffer() and sg_read_image() supported
+    bool gpu_timers;                    // GPU timer scopes with sg_begin_timer() and sg_end_timer() supported
+    bool occlusion_query;               // occlusion queries with sg_begin_occlusion_query() and sg_end_occlusion_query() supported
+    bool occlusion_query_samples;       // SG_OCCLUSIONQUERYTYPE_SAMPLES_PASSED supported
 } sg_features;
 
 /*
@@ -3476,6 +3913,9 @@ typedef struct sg_buffer_desc {
         the image content is updated infrequently by the CPU via sg_update_image()
     .stream_update (default: false)
         the image content is updated each frame by the CPU via sg_update_image()
+    .region_update (default: false)
+        rectangular regions of the image content are updated by the CPU
+        via sg_update_image_region(), possibly multiple times per frame
     .write_unsealed (default: false)
         when true, creates an immutable image in 'unsealed' resource state,
         unsealed images can be populated with data by one or multiple
@@ -3495,6 +3935,7 @@ typedef struct sg_image_usage {
     bool immutable;
     bool dynamic_update;
     bool stream_update;
+    bool region_update;
     bool write_unsealed;
 } sg_image_usage;
 
@@ -3689,6 +4130,254 @@ typedef struct sg_write_buffer_desc {
     size_t size;
 } sg_write_buffer_desc;
 
+/*
+    sg_readback
+
+    A handle for an asynchronous readback operation started with
+    sg_read_buffer() or sg_read_image(). Use sg_query_readback_state()
+    to poll the current state of the readback operation.
+
+    Readback handles are not resource objects, they don't need to be
+    destroyed, and they become invalid when their internal slot is
+    reused by a later readback operation (the number of internal
+    slots can be configured with sg_desc.max_readbacks).
+*/
+typedef struct sg_readback { uint32_t id; } sg_readback;
+
+/*
+    sg_readback_state
+
+    The state of an asynchronous readback operation, returned
+    by sg_query_readback_state() and passed into the readback
+    callback in sg_readback_response.state:
+
+    SG_READBACKSTATE_INVALID:   the readback handle is invalid, or its
+                                slot has been reused by a later readback
+    SG_READBACKSTATE_PENDING:   the readback has been issued but the data
+                                hasn't arrived in the destination memory yet
+    SG_READBACKSTATE_COMPLETED: the data has been copied into the destination memory
+    SG_READBACKSTATE_FAILED:    the readback has failed (e.g. because the backend
+                                failed to create the required staging resources)
+*/
+typedef enum sg_readback_state {
+    SG_READBACKSTATE_INVALID,
+    SG_READBACKSTATE_PENDING,
+    SG_READBACKSTATE_COMPLETED,
+    SG_READBACKSTATE_FAILED,
+    _SG_READBACKSTATE_FORCE_U32 = 0x7FFFFFFF
+} sg_readback_state;
+
+/*
+    sg_readback_response
+
+    Passed into the optional readback callback function when a readback
+    operation has finished (either successfully or with an error).
+
+    .readback   the readback handle returned by sg_read_buffer() or sg_read_image()
+    .state      either SG_READBACKSTATE_COMPLETED or SG_READBACKSTATE_FAILED
+    .data       .ptr is the destination pointer from the readback desc,
+                .size is the number of bytes that have been written
+    .user_data  the user_data pointer from the readback desc
+*/
+typedef struct sg_readback_response {
+    sg_readback readback;
+    sg_readback_state state;
+    sg_range data;
+    void* user_data;
+} sg_readback_response;
+
+/*
+    sg_read_buffer_desc
+
+    Describes an asynchronous readback of buffer content into CPU memory
+    with sg_read_buffer().
+
+    .src
+        The source buffer and byte offset into the buffer (must be a
+        multiple of 4).
+    .size
+        Number of bytes to read. When this is default-zero, the remaining
+        buffer size after .src.offset will be used.
+    .dst
+        Pointer to and size of the destination memory. The memory must
+        remain valid until the readback has completed or failed.
+    .callback
+        An optional callback function which is called from inside
+        sg_commit() when the readback has completed or failed.
+    .user_data
+        An optional user-data pointer passed into the callback.
+*/
+typedef struct sg_read_buffer_desc {
+    sg_buffer_location src;
+    size_t size;
+    sg_range dst;
+    void (*callback)(const sg_readback_response* response);
+    void* user_data;
+} sg_read_buffer_desc;
+
+/*
+    sg_read_image_desc
+
+    Describes an asynchronous readback of a rectangular region of a single
+    image mip-level and slice into CPU memory with sg_read_image(). The pixel
+    data will be written as tightly packed rows into the destination memory
+    (e.g. the required destination size can be computed with
+    sg_query_surface_pitch(pixel_format, width, height, 1)).
+
+    .src
+        The source image, mip-level, slice and top-left pixel position of
+        the region to read. The image must not be multisampled, and must not
+        have a compressed or depth pixel format.
+    .size
+        The width and height of the region to read, .size.num_slices must
+        be 0 or 1. Default-zero width and height means 'the remaining width and
+        height' of the mip-level taking .src.x and .src.y into account.
+    .dst
+        Pointer to and size of the destination memory. The memory must
+        remain valid until the readback has completed or failed.
+    .callback
+        An optional callback function which is called from inside
+        sg_commit() when the readback has completed or failed.
+    .user_data
+        An optional user-data pointer passed into the callback.
+*/
+typedef struct sg_read_image_desc {
+    sg_image_location src;
+    sg_image_extent size;
+    sg_range dst;
+    void (*callback)(const sg_readback_response* response);
+    void* user_data;
+} sg_read_image_desc;
+
+/*
+    sg_timer_result
+
+    The most recently resolved measurement of a GPU timer scope,
+    returned by sg_query_timer():
+
+    .valid          true if at least one measurement has been resolved
+                    for the timer label
+    .frame_index    the frame index in which the measurement was recorded
+                    (see sg_frame_stats.frame_index)
+    .duration_ns    the GPU time between sg_begin_timer() and sg_end_timer()
+                    in nanoseconds
+*/
+typedef struct sg_timer_result {
+    bool valid;
+    uint32_t frame_index;
+    uint64_t duration_ns;
+} sg_timer_result;
+
+/*
+    sg_occlusion_query
+
+    A handle for an occlusion query object created with
+    sg_make_occlusion_query() and destroyed with sg_destroy_occlusion_query().
+*/
+typedef struct sg_occlusion_query { uint32_t id; } sg_occlusion_query;
+
+/*
+    sg_occlusion_query_type
+
+    The type of an occlusion query object:
+
+    SG_OCCLUSIONQUERYTYPE_ANY_SAMPLES_PASSED (default)
+        The result only tells whether any samples have passed, this is
+        cheaper on some GPUs and can be conservative (e.g. report visibility
+        even though all samples were rejected).
+    SG_OCCLUSIONQUERYTYPE_SAMPLES_PASSED
+        The result is the exact number of samples which have passed,
+        check sg_features.occlusion_query_samples whether this is supported.
+*/
+typedef enum sg_occlusion_query_type {
+    _SG_OCCLUSIONQUERYTYPE_DEFAULT,
+    SG_OCCLUSIONQUERYTYPE_ANY_SAMPLES_PASSED,
+    SG_OCCLUSIONQUERYTYPE_SAMPLES_PASSED,
+    _SG_OCCLUSIONQUERYTYPE_NUM,
+    _SG_OCCLUSIONQUERYTYPE_FORCE_U32 = 0x7FFFFFFF
+} sg_occlusion_query_type;
+
+/*
+    sg_occlusion_query_desc
+
+    Creation parameters for occlusion query objects, used in
+    sg_make_occlusion_query():
+
+    .type       SG_OCCLUSIONQUERYTYPE_ANY_SAMPLES_PASSED (default) or
+                SG_OCCLUSIONQUERYTYPE_SAMPLES_PASSED
+*/
+typedef struct sg_occlusion_query_desc {
+    uint32_t _start_canary;
+    sg_occlusion_query_type type;
+    uint32_t _end_canary;
+} sg_occlusion_query_desc;
+
+/*
+    sg_occlusion_query_result
+
+    The most recently resolved result of an occlusion query object,
+    returned by sg_query_occlusion_result():
+
+    .valid          true if at least one result has been resolved
+    .frame_index    the frame index in which the resolved query was recorded
+                    (see sg_frame_stats.frame_index)
+    .visible        true if any samples have passed
+    .num_samples    the number of samples that have passed, with
+                    SG_OCCLUSIONQUERYTYPE_ANY_SAMPLES_PASSED this is
+                    either 0 or 1
+*/
+typedef struct sg_occlusion_query_result {
+    bool valid;
+    uint32_t frame_index;
+    bool visible;
+    uint64_t num_samples;
+} sg_occlusion_query_result;
+
+/*
+    sg_command_list
+
+    A handle for a command list object created with sg_make_command_list()
+    and destroyed with sg_destroy_command_list(), see the COMMAND LISTS
+    documentation section for details.
+*/
+typedef struct sg_command_list { uint32_t id; } sg_command_list;
+
+/*
+    sg_command_list_desc
+
+    Creation parameters for command list objects, used in
+    sg_make_command_list():
+
+    .size       the size of the command list memory buffer in bytes
+                (default: 64 KB)
+*/
+typedef struct sg_command_list_desc {
+    uint32_t _start_canary;
+    size_t size;
+    uint32_t _end_canary;
+} sg_command_list_desc;
+
+/*
+    sg_command_list_info
+
+    Runtime information about a command list object, returned by
+    sg_query_command_list_info():
+
+    .recording      true between sg_begin_command_list() and sg_end_command_list()
+    .overflow       true if commands were dropped because the command list
+                    ran out of memory since the last sg_begin_command_list()
+    .num_commands   the number of recorded commands
+    .used_bytes     the number of used bytes in the command list buffer
+    .size           the size of the command list buffer in bytes
+*/
+typedef struct sg_command_list_info {
+    bool recording;
+    bool overflow;
+    int num_commands;
+    size_t used_bytes;
+    size_t size;
+} sg_command_list_info;
+
 /*
     sg_image_desc
 
@@ -4348,6 +5037,7 @@ typedef struct sg_trace_hooks {
     void (*destroy_view)(sg_view view, void* user_data);
     void (*update_buffer)(sg_buffer buf, const sg_range* data, void* user_data);
     void (*update_image)(sg_image img, const sg_image_data* data, void* user_data);
+    void (*update_image_region)(const sg_write_image_desc* desc, void* user_data);
     void (*append_buffer)(sg_buffer buf, const sg_range* data, int result, void* user_data);
     void (*write_buffer_unsealed)(const sg_write_buffer_desc* desc, void* user_data);
     void (*write_image_unsealed)(const sg_write_image_desc* desc, void* user_data);
@@ -4435,6 +5125,7 @@ typedef struct sg_buffer_info {
     bool append_overflow;           // is buffer in overflow state (due to sg_append_buffer)
     int num_slots;                  // number of renaming-slots for dynamically updated buffers
     int active_slot;                // currently active write-slot for dynamically updated buffers
+    bool mapped;                    // true between sg_map_buffer() and sg_unmap_buffer()
 } sg_buffer_info;
 
 typedef struct sg_image_info {
@@ -4672,11 +5363,19 @@ typedef struct sg_frame_stats {
     uint32_t num_write_image_unsealed;
     uint32_t num_seal_buffer;
     uint32_t num_seal_image;
+    uint32_t num_read_buffer;
+    uint32_t num_read_image;
 
     uint32_t size_apply_uniforms;
     uint32_t size_update_buffer;
     uint32_t size_append_buffer;
     uint32_t size_update_image;
+    uint32_t size_read_buffer;
+    uint32_t size_read_image;
+
+    uint32_t uniform_buffer_used;   // uniform buffer bytes required by sg_apply_uniforms() in this frame, including alignment padding
+    uint32_t uniform_buffer_peak;   // max uniform_buffer_used of all frames so far
+    uint32_t uniform_buffer_size;   // current uniform buffer size (may have grown via sg_desc.uniform_buffer_auto_grow)
 
     sg_frame_resource_stats buffers;
     sg_frame_resource_stats images;
@@ -4708,6 +5407,9 @@ typedef struct sg_stats {
 #define _SG_LOG_ITEMS \
     _SG_LOGITEM_XMACRO(OK, "Ok") \
     _SG_LOGITEM_XMACRO(MALLOC_FAILED, "memory allocation failed") \
+    _SG_LOGITEM_XMACRO(UNIFORM_BUFFER_OVERFLOW, "uniform buffer has overflown, uniform data dropped (increase sg_desc.uniform_buffer_size or set sg_desc.uniform_buffer_auto_grow)") \
+    _SG_LOGITEM_XMACRO(UNIFORM_BUFFER_WARN_THRESHOLD, "uniform buffer usage in this frame exceeds sg_desc.uniform_buffer_warn_threshold") \
+    _SG_LOGITEM_XMACRO(UNIFORM_BUFFER_GROWN, "uniform buffer has been grown after an overflow (sg_desc.uniform_buffer_auto_grow)") \
     _SG_LOGITEM_XMACRO(GL_TEXTURE_FORMAT_NOT_SUPPORTED, "pixel format not supported for texture (gl)") \
     _SG_LOGITEM_XMACRO(GL_3D_TEXTURES_NOT_SUPPORTED, "3d textures not supported (gl)") \
     _SG_LOGITEM_XMACRO(GL_ARRAY_TEXTURES_NOT_SUPPORTED, "array textures not supported (gl)") \
@@ -4872,6 +5574,24 @@ typedef struct sg_stats {
     _SG_LOGITEM_XMACRO(WRITE_IMAGE_UNSEALED_IMAGE_ALIVE, "sg_write_image_unsealed: image is no longer alive") \
     _SG_LOGITEM_XMACRO(SEAL_BUFFER_ALIVE, "sg_seal_buffer: buffer is no longer alive") \
     _SG_LOGITEM_XMACRO(SEAL_IMAGE_ALIVE, "sg_seal_image: image is no longer alive") \
+    _SG_LOGITEM_XMACRO(READ_BUFFER_BUFFER_ALIVE, "sg_read_buffer: buffer is no longer alive") \
+    _SG_LOGITEM_XMACRO(READ_IMAGE_IMAGE_ALIVE, "sg_read_image: image is no longer alive") \
+    _SG_LOGITEM_XMACRO(READBACK_POOL_EXHAUSTED, "readback pool exhausted (too many pending readbacks, see sg_desc.max_readbacks)") \
+    _SG_LOGITEM_XMACRO(READBACK_NOT_SUPPORTED, "asynchronous readback not supported on this backend (sg_features.readback)") \
+    _SG_LOGITEM_XMACRO(TIMER_POOL_EXHAUSTED, "timer pool exhausted (too many distinct timer labels, see sg_desc.max_timers)") \
+    _SG_LOGITEM_XMACRO(END_PASS_TIMER_NOT_ENDED, "sg_end_pass: timer scope was not ended with sg_end_timer() inside the pass") \
+    _SG_LOGITEM_XMACRO(OCCLUSION_QUERY_POOL_EXHAUSTED, "occlusion query pool exhausted (see sg_desc.occlusion_query_pool_size)") \
+    _SG_LOGITEM_XMACRO(BEGIN_OCCLUSION_QUERY_QUERY_ALIVE, "sg_begin_occlusion_query: occlusion query object is no longer alive") \
+    _SG_LOGITEM_XMACRO(END_PASS_OCCLUSION_QUERY_NOT_ENDED, "sg_end_pass: occlusion query scope was not ended with sg_end_occlusion_query() inside the pass") \
+    _SG_LOGITEM_XMACRO(COMMAND_LIST_POOL_EXHAUSTED, "command list pool exhausted (see sg_desc.command_list_pool_size)") \
+    _SG_LOGITEM_XMACRO(COMMAND_LIST_ALIVE, "command list object is no longer alive") \
+    _SG_LOGITEM_XMACRO(COMMAND_LIST_ALREADY_RECORDING, "sg_begin_command_list: command list is already recording (missing sg_end_command_list()?)") \
+    _SG_LOGITEM_XMACRO(COMMAND_LIST_NOT_RECORDING, "sg_cmd_*: command list is not recording (missing sg_begin_command_list()?)") \
+    _SG_LOGITEM_XMACRO(COMMAND_LIST_OVERFLOW, "command list is out of memory, dropping commands (see sg_command_list_desc.size)") \
+    _SG_LOGITEM_XMACRO(COMMAND_LIST_PIPELINE_VALID, "sg_cmd_apply_pipeline: pipeline object (or its shader) is not alive or not valid, or is a compute pipeline") \
+    _SG_LOGITEM_XMACRO(COMMAND_LIST_NO_PIPELINE, "sg_cmd_*: must be preceded by a successful sg_cmd_apply_pipeline() in the same command list") \
+    _SG_LOGITEM_XMACRO(COMMAND_LIST_BINDINGS_VALID, "sg_cmd_apply_bindings: a required buffer, view or sampler binding is missing, not alive or not valid") \
+    _SG_LOGITEM_XMACRO(COMMAND_LIST_UNIFORMS_SIZE, "sg_cmd_apply_uniforms: no uniform block at slot, or data size doesn't match the uniform block size") \
     _SG_LOGITEM_XMACRO(SHADERDESC_TOO_MANY_VERTEXSTAGE_TEXTURES, "sg_shader_desc: too many texture bindings on vertex shader stage (sg_limits.max_texture_bindings_per_stage)") \
     _SG_LOGITEM_XMACRO(SHADERDESC_TOO_MANY_FRAGMENTSTAGE_TEXTURES, "sg_shader_desc: too many texture bindings on fragment shader stage (sg_limits.max_texture_bindings_per_stage)") \
     _SG_LOGITEM_XMACRO(SHADERDESC_TOO_MANY_COMPUTESTAGE_TEXTURES, "sg_shader_desc: too many texture bindings on compute shader stage (sg_limits.max_texture_bindings_per_stage)") \
@@ -4898,7 +5618,7 @@ typedef struct sg_stats {
     _SG_LOGITEM_XMACRO(VALIDATE_IMAGEDATA_NODATA, "sg_image_data: no data (.ptr and/or .size is zero)") \
     _SG_LOGITEM_XMACRO(VALIDATE_IMAGEDATA_DATA_SIZE, "sg_image_data: data size doesn't match expected surface size") \
     _SG_LOGITEM_XMACRO(VALIDATE_IMAGEDESC_CANARY, "sg_image_desc not initialized") \
-    _SG_LOGITEM_XMACRO(VALIDATE_IMAGEDESC_IMMUTABLE_DYNAMIC_STREAM, "sg_image_desc.usage: only one of .immutable, .dynamic_update, .stream_update can be true") \
+    _SG_LOGITEM_XMACRO(VALIDATE_IMAGEDESC_IMMUTABLE_DYNAMIC_STREAM, "sg_image_desc.usage: only one of .immutable, .dynamic_update, .stream_update, .region_update can be true") \
     _SG_LOGITEM_XMACRO(VALIDATE_IMAGEDESC_UNSEALED_VS_IMMUTABLE, "sg_image_desc.usage: .write_unsealed only allowed for .immutable images") \
     _SG_LOGITEM_XMACRO(VALIDATE_IMAGEDESC_UNSEALED_VS_ATTACHMENT, "sg_image_desc.usage: .write_unsealed not allowed for images with attachment usage") \
     _SG_LOGITEM_XMACRO(VALIDATE_IMAGEDESC_ATTACHMENT_COLOR_DEPTH_STENCIL, "sg_image_desc.usage: only one of .color_attachment and .depth_stencil_attachment can be true") \
@@ -4927,7 +5647,7 @@ typedef struct sg_stats {
     _SG_LOGITEM_XMACRO(VALIDATE_IMAGEDESC_STORAGEIMAGE_EXPECT_NO_MSAA, "storage images cannot be multisampled") \
     _SG_LOGITEM_XMACRO(VALIDATE_IMAGEDESC_INJECTED_NO_DATA, "images with injected textures cannot be initialized with data") \
     _SG_LOGITEM_XMACRO(VALIDATE_IMAGEDESC_UNSEALED_NO_DATA, "images with usage .write_unsealed cannot be initialized with data") \
-    _SG_LOGITEM_XMACRO(VALIDATE_IMAGEDESC_DYNAMIC_NO_DATA, "dynamic/stream-update images cannot be initialized with data") \
+    _SG_LOGITEM_XMACRO(VALIDATE_IMAGEDESC_DYNAMIC_NO_DATA, "dynamic/stream/region-update images cannot be initialized with data") \
     _SG_LOGITEM_XMACRO(VALIDATE_IMAGEDESC_COMPRESSED_IMMUTABLE, "compressed images must be immutable") \
     _SG_LOGITEM_XMACRO(VALIDATE_SAMPLERDESC_CANARY, "sg_sampler_desc not initialized") \
     _SG_LOGITEM_XMACRO(VALIDATE_SAMPLERDESC_ANISTROPIC_REQUIRES_LINEAR_FILTERING, "sg_sampler_desc.max_anisotropy > 1 requires min/mag/mipmap_filter to be SG_FILTER_LINEAR") \
@@ -5133,11 +5853,13 @@ typedef struct sg_stats {
     _SG_LOGITEM_XMACRO(VALIDATE_ABND_VBUF_ALIVE, "sg_apply_bindings: vertex buffer no longer alive") \
     _SG_LOGITEM_XMACRO(VALIDATE_ABND_VBUF_USAGE, "sg_apply_bindings: buffer in vertex buffer bind slot must have usage.vertex_buffer") \
     _SG_LOGITEM_XMACRO(VALIDATE_ABND_VBUF_OVERFLOW, "sg_apply_bindings: buffer in vertex buffer bind slot is overflown") \
+    _SG_LOGITEM_XMACRO(VALIDATE_ABND_VBUF_MAPPED, "sg_apply_bindings: buffer in vertex buffer bind slot is mapped (missing sg_unmap_buffer?)") \
     _SG_LOGITEM_XMACRO(VALIDATE_ABND_EXPECTED_NO_IBUF, "sg_apply_bindings: pipeline object defines non-indexed rendering, but index buffer binding provided") \
     _SG_LOGITEM_XMACRO(VALIDATE_ABND_EXPECTED_IBUF, "sg_apply_bindings: pipeline object defines indexed rendering, but no index buffer binding provided") \
     _SG_LOGITEM_XMACRO(VALIDATE_ABND_IBUF_ALIVE, "sg_apply_bindings: index buffer no longer alive") \
     _SG_LOGITEM_XMACRO(VALIDATE_ABND_IBUF_USAGE, "sg_apply_bindings: buffer in index buffer bind slot must have usage.index_buffer") \
     _SG_LOGITEM_XMACRO(VALIDATE_ABND_IBUF_OVERFLOW, "sg_apply_bindings: buffer in index buffer slot is overflown") \
+    _SG_LOGITEM_XMACRO(VALIDATE_ABND_IBUF_MAPPED, "sg_apply_bindings: buffer in index buffer slot is mapped (missing sg_unmap_buffer?)") \
     _SG_LOGITEM_XMACRO(VALIDATE_ABND_EXPECTED_VIEW_BINDING, "sg_apply_bindings: view binding is missing or the view handle is invalid") \
     _SG_LOGITEM_XMACRO(VALIDATE_ABND_VIEW_ALIVE, "sg_apply_bindings: view no longer alive") \
     _SG_LOGITEM_XMACRO(VALIDATE_ABND_EXPECT_TEXVIEW, "sg_apply_bindings: view type mismatch in bindslot (shader expects a texture view)") \
@@ -5196,7 +5918,15 @@ typedef struct sg_stats {
     _SG_LOGITEM_XMACRO(VALIDATE_APPENDBUF_USAGE, "sg_append_buffer: cannot append to immutable buffer") \
     _SG_LOGITEM_XMACRO(VALIDATE_APPENDBUF_SIZE, "sg_append_buffer: overall appended size is bigger than buffer size") \
     _SG_LOGITEM_XMACRO(VALIDATE_APPENDBUF_UPDATE, "sg_append_buffer: cannot call sg_append_buffer and sg_update_buffer in same frame") \
+    _SG_LOGITEM_XMACRO(VALIDATE_MAPBUF_USAGE, "sg_map_buffer: buffer must have been created with usage.stream_update") \
+    _SG_LOGITEM_XMACRO(VALIDATE_MAPBUF_SIZE, "sg_map_buffer: mapped size must be > 0 and not greater than buffer size") \
+    _SG_LOGITEM_XMACRO(VALIDATE_MAPBUF_MAPPED, "sg_map_buffer: buffer is already mapped") \
+    _SG_LOGITEM_XMACRO(VALIDATE_MAPBUF_ONCE, "sg_map_buffer: only one update (via sg_update_buffer or sg_map_buffer) allowed per buffer and frame") \
+    _SG_LOGITEM_XMACRO(VALIDATE_MAPBUF_APPEND, "sg_map_buffer: cannot call sg_map_buffer and sg_append_buffer in same frame") \
+    _SG_LOGITEM_XMACRO(VALIDATE_UNMAPBUF_NOT_MAPPED, "sg_unmap_buffer: buffer is not mapped") \
+    _SG_LOGITEM_XMACRO(VALIDATE_COMMIT_BUFFER_MAPPED, "sg_commit: a buffer is still mapped (missing sg_unmap_buffer?)") \
     _SG_LOGITEM_XMACRO(VALIDATE_UPDIMG_USAGE, "sg_update_image: cannot update immutable image") \
+    _SG_LOGITEM_XMACRO(VALIDATE_UPDIMG_REGION_UPDATE, "sg_update_image: cannot update region-update image (use sg_update_image_region())") \
     _SG_LOGITEM_XMACRO(VALIDATE_UPDIMG_ONCE, "sg_update_image: only one update allowed per image and frame") \
     _SG_LOGITEM_XMACRO(VALIDATE_WRITEBUFFERUNSEALED_USAGE, "sg_write_buffer_unsealed: buffer usage must be .immutable && .write_unsealed") \
     _SG_LOGITEM_XMACRO(VALIDATE_WRITEBUFFERUNSEALED_RESOURCESTATE, "sg_write_buffer_unsealed: buffer resource state must be SG_RESOURCESTATE_UNSEALED") \
@@ -5222,8 +5952,55 @@ typedef struct sg_stats {
     _SG_LOGITEM_XMACRO(VALIDATE_WRITEIMAGEUNSEALED_WRITE_WIDTH_OVERFLOW, "sg_write_image_unsealed: desc.src.x + desc.size.width must be <= destination mip level width") \
     _SG_LOGITEM_XMACRO(VALIDATE_WRITEIMAGEUNSEALED_WRITE_HEIGHT_OVERFLOW, "sg_write_image_unsealed: desc.src.y + desc.size.height must be <= destination mip level height") \
     _SG_LOGITEM_XMACRO(VALIDATE_WRITEIMAGEUNSEALED_WRITE_NUMSLICES_OVERFLOW, "sg_write_image_unsealed: desc.src.slice + desc.size.num_slices must be <= destination number of slices in mip level") \
+    _SG_LOGITEM_XMACRO(VALIDATE_UPDIMGREGION_USAGE, "sg_update_image_region: image usage must be .region_update") \
+    _SG_LOGITEM_XMACRO(VALIDATE_UPDIMGREGION_SRC_DATA_POINTER, "sg_update_image_region: desc.src.data.ptr must be valid") \
+    _SG_LOGITEM_XMACRO(VALIDATE_UPDIMGREGION_SRC_DATA_SIZE, "sg_update_image_region: desc.src.data.size must be > 0") \
+    _SG_LOGITEM_XMACRO(VALIDATE_UPDIMGREGION_BYTESPERROW, "sg_update_image_region: desc.src.bytes_per_row must be a multiple of the pixel or compression-block size") \
+    _SG_LOGITEM_XMACRO(VALIDATE_UPDIMGREGION_BYTESPERSLICE, "sg_update_image_region: desc.src.bytes_per_slice must be a multiple of desc.src.bytes_per_row") \
+    _SG_LOGITEM_XMACRO(VALIDATE_UPDIMGREGION_MIPLEVEL, "sg_update_image_region: desc.dst.mip_level must be >= 0 and less than the number of mipmaps in the destination image") \
+    _SG_LOGITEM_XMACRO(VALIDATE_UPDIMGREGION_READ_OVERFLOW, "sg_update_image_region: desc.src.offset + size of written data must be <= desc.src.data.size") \
+    _SG_LOGITEM_XMACRO(VALIDATE_UPDIMGREGION_DST_RANGE, "sg_update_image_region: desc.dst.x/y/slice must be >= 0 and inside the destination mip level") \
+    _SG_LOGITEM_XMACRO(VALIDATE_UPDIMGREGION_WRITE_OVERFLOW, "sg_update_image_region: the written region must be inside the destination mip level") \
+    _SG_LOGITEM_XMACRO(UPDATE_IMAGE_REGION_IMAGE_ALIVE, "sg_update_image_region: image is no longer alive") \
     _SG_LOGITEM_XMACRO(VALIDATE_SEALBUFFER_RESOURCESTATE, "sg_seal_buffer: buffer resource state must be SG_RESOURCESTATE_UNSEALED") \
     _SG_LOGITEM_XMACRO(VALIDATE_SEALIMAGE_RESOURCESTATE, "sg_seal_image: image resource state must be SG_RESOURCESTATE_UNSEALED") \
+    _SG_LOGITEM_XMACRO(VALIDATE_READBUFFER_INPASS, "sg_read_buffer: cannot be called inside a render or compute pass") \
+    _SG_LOGITEM_XMACRO(VALIDATE_READBUFFER_RESOURCESTATE, "sg_read_buffer: buffer resource state must be SG_RESOURCESTATE_VALID") \
+    _SG_LOGITEM_XMACRO(VALIDATE_READBUFFER_OFFSET, "sg_read_buffer: desc.src.offset must be a multiple of 4") \
+    _SG_LOGITEM_XMACRO(VALIDATE_READBUFFER_SIZE, "sg_read_buffer: desc.size must be > 0 and a multiple of 4") \
+    _SG_LOGITEM_XMACRO(VALIDATE_READBUFFER_READ_OVERFLOW, "sg_read_buffer: desc.src.offset + desc.size must be <= buffer size") \
+    _SG_LOGITEM_XMACRO(VALIDATE_READBUFFER_DST_DATA_POINTER, "sg_read_buffer: desc.dst.ptr must be valid") \
+    _SG_LOGITEM_XMACRO(VALIDATE_READBUFFER_DST_DATA_SIZE, "sg_read_buffer: desc.dst.size must be >= desc.size") \
+    _SG_LOGITEM_XMACRO(VALIDATE_READIMAGE_INPASS, "sg_read_image: cannot be called inside a render or compute pass") \
+    _SG_LOGITEM_XMACRO(VALIDATE_READIMAGE_RESOURCESTATE, "sg_read_image: image resource state must be SG_RESOURCESTATE_VALID") \
+    _SG_LOGITEM_XMACRO(VALIDATE_READIMAGE_SAMPLECOUNT, "sg_read_image: cannot read from multisampled images") \
+    _SG_LOGITEM_XMACRO(VALIDATE_READIMAGE_PIXELFORMAT, "sg_read_image: cannot read from images with compressed or depth pixel formats") \
+    _SG_LOGITEM_XMACRO(VALIDATE_READIMAGE_MIPLEVEL, "sg_read_image: desc.src.mip_level must be >= 0 and less than the number of mipmaps in the source image") \
+    _SG_LOGITEM_XMACRO(VALIDATE_READIMAGE_SLICE, "sg_read_image: desc.src.slice must be >= 0 and < miplevel depth or array/cubemap slices") \
+    _SG_LOGITEM_XMACRO(VALIDATE_READIMAGE_NUMSLICES, "sg_read_image: desc.size.num_slices must be 0 or 1") \
+    _SG_LOGITEM_XMACRO(VALIDATE_READIMAGE_SRC_X_RANGE, "sg_read_image: desc.src.x must be >= 0 and < miplevel width") \
+    _SG_LOGITEM_XMACRO(VALIDATE_READIMAGE_SRC_Y_RANGE, "sg_read_image: desc.src.y must be >= 0 and < miplevel height") \
+    _SG_LOGITEM_XMACRO(VALIDATE_READIMAGE_READ_WIDTH_OVERFLOW, "sg_read_image: desc.size.width must be > 0 and desc.src.x + desc.size.width must be <= source mip level width") \
+    _SG_LOGITEM_XMACRO(VALIDATE_READIMAGE_READ_HEIGHT_OVERFLOW, "sg_read_image: desc.size.height must be > 0 and desc.src.y + desc.size.height must be <= source mip level height") \
+    _SG_LOGITEM_XMACRO(VALIDATE_READIMAGE_DST_DATA_POINTER, "sg_read_image: desc.dst.ptr must be valid") \
+    _SG_LOGITEM_XMACRO(VALIDATE_READIMAGE_DST_DATA_SIZE, "sg_read_image: desc.dst.size must be big enough for the tightly packed pixel data") \
+    _SG_LOGITEM_XMACRO(VALIDATE_BEGINTIMER_PASS, "sg_begin_timer: must be called inside a render or compute pass") \
+    _SG_LOGITEM_XMACRO(VALIDATE_BEGINTIMER_LABEL, "sg_begin_timer: label must be a non-empty string shorter than 32 characters") \
+    _SG_LOGITEM_XMACRO(VALIDATE_BEGINTIMER_NESTED, "sg_begin_timer: timer scopes cannot be nested") \
+    _SG_LOGITEM_XMACRO(VALIDATE_BEGINTIMER_ONCE_PER_FRAME, "sg_begin_timer: a timer label can only be used once per frame") \
+    _SG_LOGITEM_XMACRO(VALIDATE_ENDTIMER_PASS, "sg_end_timer: must be called inside a render or compute pass") \
+    _SG_LOGITEM_XMACRO(VALIDATE_ENDTIMER_NO_TIMER, "sg_end_timer: no active timer scope (missing sg_begin_timer() in the same pass?)") \
+    _SG_LOGITEM_XMACRO(VALIDATE_OCCLUSIONQUERYDESC_CANARY, "sg_occlusion_query_desc not initialized") \
+    _SG_LOGITEM_XMACRO(VALIDATE_OCCLUSIONQUERYDESC_SAMPLES_NOT_SUPPORTED, "sg_occlusion_query_desc: SG_OCCLUSIONQUERYTYPE_SAMPLES_PASSED not supported on this backend (sg_features.occlusion_query_samples)") \
+    _SG_LOGITEM_XMACRO(VALIDATE_BEGINOCCLUSIONQUERY_RENDERPASS, "sg_begin_occlusion_query: must be called inside a render pass") \
+    _SG_LOGITEM_XMACRO(VALIDATE_BEGINOCCLUSIONQUERY_NESTED, "sg_begin_occlusion_query: occlusion query scopes cannot be nested") \
+    _SG_LOGITEM_XMACRO(VALIDATE_BEGINOCCLUSIONQUERY_ONCE_PER_FRAME, "sg_begin_occlusion_query: an occlusion query object can only be used once per frame") \
+    _SG_LOGITEM_XMACRO(VALIDATE_ENDOCCLUSIONQUERY_RENDERPASS, "sg_end_occlusion_query: must be called inside a render pass") \
+    _SG_LOGITEM_XMACRO(VALIDATE_ENDOCCLUSIONQUERY_NO_QUERY, "sg_end_occlusion_query: no active occlusion query scope (missing sg_begin_occlusion_query() in the same pass?)") \
+    _SG_LOGITEM_XMACRO(VALIDATE_COMMANDLISTDESC_CANARY, "sg_command_list_desc not initialized") \
+    _SG_LOGITEM_XMACRO(VALIDATE_EXECCMDLISTS_RENDERPASS, "sg_execute_command_lists: must be called inside a render pass") \
+    _SG_LOGITEM_XMACRO(VALIDATE_EXECCMDLISTS_LIST_ALIVE, "sg_execute_command_lists: command list object is no longer alive") \
+    _SG_LOGITEM_XMACRO(VALIDATE_EXECCMDLISTS_LIST_RECORDING, "sg_execute_command_lists: command list is still recording (missing sg_end_command_list()?)") \
     _SG_LOGITEM_XMACRO(VALIDATION_FAILED, "validation layer checks failed") \
 
 #define _SG_LOGITEM_XMACRO(item,msg) SG_LOGITEM_##item,
@@ -5247,7 +6024,15 @@ typedef enum sg_log_item {
     .pipeline_pool_size                 64
     .view_pool_size                     256
     .uniform_buffer_size                4 MB (4*1024*1024)
+    .uniform_buffer_warn_threshold      0 (disabled)
+    .uniform_buffer_auto_grow           false
     .max_commit_listeners               1024
+    .max_readbacks                      64
+    .max_timers                         32
+    .occlusion_query_pool_size          256
+    .command_list_pool_size             64
+    .frame_budget                       all zero (unlimited)
+    .budget_callback                    0 (no callback)
     .disable_validation                 false
     .metal.force_managed_storage_mode   false
     .metal.use_command_buffer_with_retained_references  false
@@ -5268,6 +6053,32 @@ typedef enum sg_log_item {
     .environment.defaults.depth_format: SG_PIXELFORMAT_DEPTH_STENCIL
     .environment.defaults.sample_count: 1
 
+    Uniform buffer sizing:
+        The Metal, WebGPU and Vulkan backends copy the data of all sg_apply_uniforms()
+        calls in a frame into a uniform buffer of .uniform_buffer_size bytes, each
+        call occupies at least the backend-specific uniform buffer offset alignment
+        (up to 256 bytes). When the uniform buffer overflows, the uniform data is
+        dropped and the next draw- or dispatch-call will be skipped.
+
+        To size the uniform buffer tightly, check the following sg_frame_stats items
+        (those are tracked on all backends, also those which don't use a uniform
+        buffer, in that case with a worst-case alignment of 256 bytes):
+
+            .uniform_buffer_used    the uniform buffer bytes required by a frame
+            .uniform_buffer_peak    the max .uniform_buffer_used of all frames so far
+            .uniform_buffer_size    the current uniform buffer size
+
+        .uniform_buffer_warn_threshold
+            if not zero, a warning will be logged (at most once per frame) when
+            a frame requires more than this number of uniform buffer bytes
+        .uniform_buffer_auto_grow
+            when true, an uniform buffer overflow will grow the uniform buffer at
+            the next frame boundary to the next power-of-two multiple of
+            .uniform_buffer_size which is big enough to hold the uniform data of
+            the overflowing frame, the uniform data of the overflowing frame itself
+            is still dropped. Growing the uniform buffer waits for the GPU to
+            finish all in-flight frames, so this should be a rare event.
+
     Metal specific:
         (NOTE: All Objective-C object references are transferred through
         a bridged cast (__bridge const void*) to sokol_gfx, which will use an
@@ -5328,8 +6139,10 @@ typedef enum sg_log_item {
             of the staging buffer size
         .vulkan.stream_staging_buffer_size
             Size of the staging buffer in bytes for updating .usage.stream_update
-            resources. The default is 16 MB. The size must be big enough
-            to accomodate all update into .usage.stream_update resources.
+            resources and for sg_update_image_region(). The default is 16 MB.
+            The size must be big enough to accomodate all update into
+            .usage.stream_update resources and all image region updates
+            in a frame.
             Any additional data will cause an error log message and
             incomplete rendering. Note that the actually allocated size
             will be twice as much because the stream-staging-buffer is
@@ -5397,6 +6210,70 @@ typedef struct sg_commit_listener {
     void* user_data;
 } sg_commit_listener;
 
+/*
+    sg_frame_budget
+
+    Per-frame limits for the amount of work recorded between two
+    calls to sg_commit(), used in sg_desc.frame_budget and
+    sg_set_frame_budget(), and to report the current usage in
+    sg_budget_state. A zero value means 'unlimited'.
+
+    .num_draws:     number of sg_draw(), sg_draw_ex() and sg_dispatch() calls
+    .num_passes:    number of sg_begin_pass() calls
+    .upload_bytes:  number of bytes written via sg_update_buffer(),
+                    sg_append_buffer(), sg_map_buffer(), sg_update_image(),
+                    sg_update_image_region(), sg_write_buffer_unsealed()
+                    and sg_write_image_unsealed()
+
+    See the section FRAME BUDGETS for details.
+*/
+typedef struct sg_frame_budget {
+    uint32_t num_draws;
+    uint32_t num_passes;
+    uint32_t upload_bytes;
+} sg_frame_budget;
+
+/*
+    sg_budget_item
+
+    Identifies the budget item which has been exceeded in the
+    sg_budget_callback function.
+*/
+typedef enum sg_budget_item {
+    SG_BUDGETITEM_NUM_DRAWS,
+    SG_BUDGETITEM_NUM_PASSES,
+    SG_BUDGETITEM_UPLOAD_BYTES,
+    _SG_BUDGETITEM_NUM,
+    _SG_BUDGETITEM_FORCE_U32 = 0x7FFFFFFF
+} sg_budget_item;
+
+/*
+    sg_budget_state
+
+    The current frame budget and usage, returned by sg_query_budget_state()
+    and passed into the sg_budget_callback function.
+*/
+typedef struct sg_budget_state {
+    sg_frame_budget budget;     // the current per-frame budget (zero: unlimited)
+    sg_frame_budget used;       // the usage in the current frame
+    bool exceeded;              // true if any budget item is exceeded in the current frame
+    bool num_draws_exceeded;
+    bool num_passes_exceeded;
+    bool upload_bytes_exceeded;
+} sg_budget_state;
+
+/*
+    sg_budget_callback
+
+    Used in sg_desc.budget_callback to install a callback function which
+    is called when a frame budget item is exceeded for the first time in
+    a frame (see the section FRAME BUDGETS for details).
+*/
+typedef struct sg_budget_callback {
+    void (*func)(sg_budget_item item, const sg_budget_state* state, void* user_data);
+    void* user_data;
+} sg_budget_callback;
+
 /*
     sg_allocator
 
@@ -5463,7 +6340,15 @@ typedef struct sg_desc {
     int pipeline_pool_size;
     int view_pool_size;
     int uniform_buffer_size;        // max size of all sg_apply_uniform() calls per frame, with worst-case 256 byte alignment
+    int uniform_buffer_warn_threshold;  // log a warning when a frame requires more uniform buffer bytes (default: 0, disabled)
+    bool uniform_buffer_auto_grow;  // grow the uniform buffer at the next frame boundary instead of failing again after an overflow
     int max_commit_listeners;       // max number of commit listener hook functions
+    int max_readbacks;              // max number of in-flight sg_read_buffer() and sg_read_image() operations
+    int max_timers;                 // max number of distinct sg_begin_timer() labels
+    int occlusion_query_pool_size;  // max number of sg_occlusion_query objects
+    int command_list_pool_size;     // max number of sg_command_list objects
+    sg_frame_budget frame_budget;   // optional per-frame work budget (default: zero, unlimited)
+    sg_budget_callback budget_callback; // optional callback when a frame budget item is exceeded
     bool disable_validation;        // disable validation layer even in debug mode, useful for tests
     bool enforce_portable_limits;   // if true, enforce portable resource binding limits (SG_MAX_PORTABLE_*)
     sg_d3d11_desc d3d11;            // d3d11-specific setup parameters
@@ -5486,6 +6371,7 @@ SOKOL_GFX_API_DECL void sg_push_debug_group(const char* name);
 SOKOL_GFX_API_DECL void sg_pop_debug_group(void);
 SOKOL_GFX_API_DECL bool sg_add_commit_listener(sg_commit_listener listener);
 SOKOL_GFX_API_DECL bool sg_remove_commit_listener(sg_commit_listener listener);
+SOKOL_GFX_API_DECL void sg_set_frame_budget(const sg_frame_budget* budget);
 
 // resource creation and destruction
 SOKOL_GFX_API_DECL sg_buffer sg_make_buffer(const sg_buffer_desc* desc);
@@ -5525,9 +6411,46 @@ SOKOL_GFX_API_DECL void sg_seal_image(sg_image img);
 // update functions (will be deprecated by new resource update functions)
 SOKOL_GFX_API_DECL void sg_update_buffer(sg_buffer buf, const sg_range* data);
 SOKOL_GFX_API_DECL void sg_update_image(sg_image img, const sg_image_data* data);
+SOKOL_GFX_API_DECL void sg_update_image_region(const sg_write_image_desc* desc);
 SOKOL_GFX_API_DECL int sg_append_buffer(sg_buffer buf, const sg_range* data);
+SOKOL_GFX_API_DECL void* sg_map_buffer(sg_buffer buf, size_t size);
+SOKOL_GFX_API_DECL void sg_unmap_buffer(sg_buffer buf);
 SOKOL_GFX_API_DECL bool sg_query_buffer_overflow(sg_buffer buf);
 SOKOL_GFX_API_DECL bool sg_query_buffer_will_overflow(sg_buffer buf, size_t size);
+SOKOL_GFX_API_DECL sg_budget_state sg_query_budget_state(void);
+SOKOL_GFX_API_DECL bool sg_query_budget_will_exceed(const sg_frame_budget* work);
+
+// asynchronous readback functions
+SOKOL_GFX_API_DECL sg_readback sg_read_buffer(const sg_read_buffer_desc* desc);
+SOKOL_GFX_API_DECL sg_readback sg_read_image(const sg_read_image_desc* desc);
+SOKOL_GFX_API_DECL sg_readback_state sg_query_readback_state(sg_readback readback);
+
+// GPU timer functions
+SOKOL_GFX_API_DECL void sg_begin_timer(const char* label);
+SOKOL_GFX_API_DECL void sg_end_timer(void);
+SOKOL_GFX_API_DECL sg_timer_result sg_query_timer(const char* label);
+
+// occlusion query functions
+SOKOL_GFX_API_DECL sg_occlusion_query sg_make_occlusion_query(const sg_occlusion_query_desc* desc);
+SOKOL_GFX_API_DECL void sg_destroy_occlusion_query(sg_occlusion_query query);
+SOKOL_GFX_API_DECL void sg_begin_occlusion_query(sg_occlusion_query query);
+SOKOL_GFX_API_DECL void sg_end_occlusion_query(void);
+SOKOL_GFX_API_DECL sg_occlusion_query_result sg_query_occlusion_result(sg_occlusion_query query);
+
+// command list functions
+SOKOL_GFX_API_DECL sg_command_list sg_make_command_list(const sg_command_list_desc* desc);
+SOKOL_GFX_API_DECL void sg_destroy_command_list(sg_command_list list);
+SOKOL_GFX_API_DECL void sg_begin_command_list(sg_command_list list);
+SOKOL_GFX_API_DECL void sg_end_command_list(sg_command_list list);
+SOKOL_GFX_API_DECL void sg_cmd_apply_viewport(sg_command_list list, int x, int y, int width, int height, bool origin_top_left);
+SOKOL_GFX_API_DECL void sg_cmd_apply_scissor_rect(sg_command_list list, int x, int y, int width, int height, bool origin_top_left);
+SOKOL_GFX_API_DECL void sg_cmd_apply_pipeline(sg_command_list list, sg_pipeline pip);
+SOKOL_GFX_API_DECL void sg_cmd_apply_bindings(sg_command_list list, const sg_bindings* bindings);
+SOKOL_GFX_API_DECL void sg_cmd_apply_uniforms(sg_command_list list, int ub_slot, const sg_range* data);
+SOKOL_GFX_API_DECL void sg_cmd_draw(sg_command_list list, int base_element, int num_elements, int num_instances);
+SOKOL_GFX_API_DECL void sg_cmd_draw_ex(sg_command_list list, int base_element, int num_elements, int num_instances, int base_vertex, int base_instance);
+SOKOL_GFX_API_DECL void sg_execute_command_lists(const sg_command_list* lists, int num_lists);
+SOKOL_GFX_API_DECL sg_command_list_info sg_query_command_list_info(sg_command_list list);
 
 // getting information
 SOKOL_GFX_API_DECL sg_desc sg_query_desc(void);
@@ -5587,6 +6510,9 @@ SOKOL_GFX_API_DECL sg_sampler sg_alloc_sampler(void);
 SOKOL_GFX_API_DECL sg_shader sg_alloc_shader(void);
 SOKOL_GFX_API_DECL sg_pipeline sg_alloc_pipeline(void);
 SOKOL_GFX_API_DECL sg_view sg_alloc_view(void);
+SOKOL_GFX_API_DECL bool sg_alloc_buffers(int num, sg_buffer* out_bufs);
+SOKOL_GFX_API_DECL bool sg_alloc_images(int num, sg_image* out_imgs);
+SOKOL_GFX_API_DECL bool sg_alloc_views(int num, sg_view* out_views);
 SOKOL_GFX_API_DECL void sg_dealloc_buffer(sg_buffer buf);
 SOKOL_GFX_API_DECL void sg_dealloc_image(sg_image img);
 SOKOL_GFX_API_DECL void sg_dealloc_sampler(sg_sampler smp);
@@ -5806,6 +6732,9 @@ SOKOL_GFX_API_DECL sg_gl_shader_info sg_gl_query_shader_info(sg_shader shd);
 // GL: get internal view resource objects
 SOKOL_GFX_API_DECL sg_gl_view_info sg_gl_query_view_info(sg_view view);
 
+// dummy backend: set the sample count which will be reported for an occlusion query
+SOKOL_GFX_API_DECL void sg_dummy_set_occlusion_result(sg_occlusion_query query, uint64_t num_samples);
+
 #ifdef __cplusplus
 } // extern "C"
 
@@ -5840,8 +6769,18 @@ inline void sg_init_view(sg_view view, const sg_view_desc& desc) { return sg_ini
 inline void sg_write_buffer_unsealed(const sg_write_buffer_desc& desc) { return sg_write_buffer_unsealed(&desc); }
 inline void sg_write_image_unsealed(const sg_write_image_desc& desc) { return sg_write_image_unsealed(&desc); }
 inline void sg_update_image(sg_image img, const sg_image_data& data) { return sg_update_image(img, &data); }
+inline void sg_update_image_region(const sg_write_image_desc& desc) { return sg_update_image_region(&desc); }
 inline void sg_update_buffer(sg_buffer buf_id, const sg_range& data) { return sg_update_buffer(buf_id, &data); }
 inline int sg_append_buffer(sg_buffer buf_id, const sg_range& data) { return sg_append_buffer(buf_id, &data); }
+inline void sg_set_frame_budget(const sg_frame_budget& budget) { return sg_set_frame_budget(&budget); }
+inline bool sg_query_budget_will_exceed(const sg_frame_budget& work) { return sg_query_budget_will_exceed(&work); }
+
+inline sg_readback sg_read_buffer(const sg_read_buffer_desc& desc) { return sg_read_buffer(&desc); }
+inline sg_readback sg_read_image(const sg_read_image_desc& desc) { return sg_read_image(&desc); }
+inline sg_occlusion_query sg_make_occlusion_query(const sg_occlusion_query_desc& desc) { return sg_make_occlusion_query(&desc); }
+inline sg_command_list sg_make_command_list(const sg_command_list_desc& desc) { return sg_make_command_list(&desc); }
+inline void sg_cmd_apply_bindings(sg_command_list list, const sg_bindings& bindings) { return sg_cmd_apply_bindings(list, &bindings); }
+inline void sg_cmd_apply_uniforms(sg_command_list list, int ub_slot, const sg_range& data) { return sg_cmd_apply_uniforms(list, ub_slot, &data); }
 #endif
 #endif // SOKOL_GFX_INCLUDED
 
@@ -6055,6 +6994,7 @@ inline int sg_append_buffer(sg_buffer buf_id, const sg_range& data) { return sg_
         #endif
         #if defined(GL_VERSION_3_3) || defined(_SOKOL_USE_WIN32_GL_LOADER)
             #define _SOKOL_GL_HAS_DUALSOURCEBLENDING (1)
+            #define _SOKOL_GL_HAS_TIMERQUERY (1)
         #endif
         #if defined(GL_VERSION_3_2) || defined(_SOKOL_USE_WIN32_GL_LOADER)
             #define _SOKOL_GL_HAS_BASEVERTEX (1)
@@ -6065,6 +7005,7 @@ inline int sg_append_buffer(sg_buffer buf_id, const sg_range& data) { return sg_
                 #define _SOKOL_GL_HAS_COLORMASKI (1)
                 #define _SOKOL_GL_HAS_BASEVERTEX (1)
                 #define _SOKOL_GL_HAS_DUALSOURCEBLENDING (1)
+                #define _SOKOL_GL_HAS_TIMERQUERY (1)
             #else
                 #define _SOKOL_GL_HAS_TEXSTORAGE (1)
             #endif
@@ -6072,6 +7013,7 @@ inline int sg_append_buffer(sg_buffer buf_id, const sg_range& data) { return sg_
             #define _SOKOL_GL_HAS_COLORMASKI (1)
             #define _SOKOL_GL_HAS_BASEVERTEX (1)
             #define _SOKOL_GL_HAS_DUALSOURCEBLENDING (1)
+            #define _SOKOL_GL_HAS_TIMERQUERY (1)
         #endif
     #elif defined(__EMSCRIPTEN__)
         #define _SOKOL_GL_HAS_TEXSTORAGE (1)
@@ -6094,6 +7036,7 @@ inline int sg_append_buffer(sg_buffer buf_id, const sg_range& data) { return sg_
             #endif
             #if defined(GL_VERSION_3_3)
                 #define _SOKOL_GL_HAS_DUALSOURCEBLENDING (1)
+                #define _SOKOL_GL_HAS_TIMERQUERY (1)
             #endif
             #if defined(GL_VERSION_3_2)
                 #define _SOKOL_GL_HAS_BASEVERTEX (1)
@@ -6139,6 +7082,7 @@ inline int sg_append_buffer(sg_buffer buf_id, const sg_range& data) { return sg_
         typedef int64_t  GLint64;
         typedef float  GLfloat;
         typedef int  GLint;
+        typedef struct __GLsync* GLsync;
         #define GL_INT_2_10_10_10_REV 0x8D9F
         #define GL_R32F 0x822E
         #define GL_PROGRAM_POINT_SIZE 0x8642
@@ -6375,6 +7319,27 @@ inline int sg_append_buffer(sg_buffer buf_id, const sg_range& data) { return sg_
         #define GL_DEPTH32F_STENCIL8 0x8CAD
         #define GL_UNPACK_ROW_LENGTH 0x0CF2
         #define GL_UNPACK_IMAGE_HEIGHT 0x806E
+        #define GL_PACK_ALIGNMENT 0x0D05
+        #define GL_PIXEL_PACK_BUFFER 0x88EB
+        #define GL_COPY_READ_BUFFER 0x8F36
+        #define GL_COPY_WRITE_BUFFER 0x8F37
+        #define GL_STREAM_READ 0x88E1
+        #define GL_MAP_READ_BIT 0x0001
+        #define GL_MAP_WRITE_BIT 0x0002
+        #define GL_MAP_INVALIDATE_BUFFER_BIT 0x0008
+        #define GL_SYNC_GPU_COMMANDS_COMPLETE 0x9117
+        #define GL_ALREADY_SIGNALED 0x911A
+        #define GL_TIMEOUT_EXPIRED 0x911B
+        #define GL_CONDITION_SATISFIED 0x911C
+        #define GL_WAIT_FAILED 0x911D
+        #define GL_SYNC_FLUSH_COMMANDS_BIT 0x00000001
+        #define GL_PIXEL_BUFFER_BARRIER_BIT 0x00000080
+        #define GL_BUFFER_UPDATE_BARRIER_BIT 0x00000200
+        #define GL_TIMESTAMP 0x8E28
+        #define GL_QUERY_RESULT 0x8866
+        #define GL_QUERY_RESULT_AVAILABLE 0x8867
+        #define GL_ANY_SAMPLES_PASSED 0x8C2F
+        #define GL_SAMPLES_PASSED 0x8914
     #endif
 
     #ifndef GL_UNSIGNED_INT_2_10_10_10_REV
@@ -6490,6 +7455,26 @@ inline int sg_append_buffer(sg_buffer buf_id, const sg_range& data) { return sg_
     #ifndef GL_SHADER_STORAGE_BUFFER
     #define GL_SHADER_STORAGE_BUFFER 0x90D2
     #endif
+    #ifndef GL_SAMPLES_PASSED
+    #define GL_SAMPLES_PASSED 0x8914
+    #endif
+#elif defined(SOKOL_DUMMY_BACKEND)
+    // the dummy backend uses CPU timestamps for GPU timer scopes
+    #if defined(_WIN32)
+        #ifndef WIN32_LEAN_AND_MEAN
+        #define WIN32_LEAN_AND_MEAN
+        #endif
+        #ifndef NOMINMAX
+        #define NOMINMAX
+        #endif
+        #include <windows.h>
+    #elif defined(__APPLE__) && defined(__MACH__)
+        #include <mach/mach_time.h>
+    #elif defined(__EMSCRIPTEN__)
+        #include <emscripten/emscripten.h>
+    #else
+        #include <time.h>
+    #endif
 #endif
 
 #if defined(SOKOL_GLES3)
@@ -6595,6 +7580,11 @@ enum {
     _SG_DEFAULT_VIEW_POOL_SIZE = 256,
     _SG_DEFAULT_UB_SIZE = 4 * 1024 * 1024,
     _SG_DEFAULT_MAX_COMMIT_LISTENERS = 1024,
+    _SG_DEFAULT_MAX_READBACKS = 64,
+    _SG_DEFAULT_MAX_TIMERS = 32,
+    _SG_DEFAULT_OCCLUSION_QUERY_POOL_SIZE = 256,
+    _SG_DEFAULT_COMMAND_LIST_POOL_SIZE = 64,
+    _SG_DEFAULT_COMMAND_LIST_SIZE = 64 * 1024,
     _SG_DEFAULT_WGPU_BINDGROUP_CACHE_SIZE = 1024,
     _SG_DEFAULT_VK_COPY_STAGING_SIZE = (4 * 1024 * 1024),
     _SG_DEFAULT_VK_STREAM_STAGING_SIZE = (16 * 1024 * 1024),
@@ -6610,21 +7600,48 @@ typedef struct {
     char buf[_SG_STRING_SIZE];
 } _sg_str_t;
 
+/*
+    Buffer, image and view state is split into a hot part which lives in
+    the resource pools and only holds what sg_apply_bindings() and the
+    draw functions touch (slot, active_slot, backend handles), and a cold
+    part in separate arrays parallel to the pools (creation parameters,
+    update/append/map tracking and backend creation info), the cold
+    part is accessed via _sg_buffer_cold(), _sg_image_cold() and _sg_view_cold().
+*/
 typedef struct {
     int size;
+    int num_slots;
+    int active_slot;
+} _sg_buffer_common_t;
+
+typedef struct {
     int append_pos;
     bool append_overflow;
+    bool mapped;
+    bool map_staged;
     uint32_t update_frame_index;
     uint32_t append_frame_index;
-    int num_slots;
-    int active_slot;
     sg_buffer_usage usage;
-} _sg_buffer_common_t;
+    size_t map_size;
+    void* map_staging;
+    #if defined(_SOKOL_ANY_GL)
+    struct {
+        bool injected;  // if true, external buffers were injected with sg_buffer_desc.gl_buffers
+    } gl;
+    #elif defined(SOKOL_VULKAN)
+    struct {
+        VkDeviceMemory mem;
+    } vk;
+    #endif
+} _sg_buffer_cold_t;
 
 typedef struct {
-    uint32_t upd_frame_index;
     int num_slots;
     int active_slot;
+} _sg_image_common_t;
+
+typedef struct {
+    uint32_t upd_frame_index;
     sg_image_type type;
     int width;
     int height;
@@ -6633,7 +7650,20 @@ typedef struct {
     sg_image_usage usage;
     sg_pixel_format pixel_format;
     int sample_count;
-} _sg_image_common_t;
+    #if defined(_SOKOL_ANY_GL)
+    struct {
+        bool injected;  // if true, external textures were injected with sg_image_desc.gl_textures
+    } gl;
+    #elif defined(SOKOL_D3D11)
+    struct {
+        DXGI_FORMAT format;
+    } d3d11;
+    #elif defined(SOKOL_VULKAN)
+    struct {
+        VkDeviceMemory mem;
+    } vk;
+    #endif
+} _sg_image_cold_t;
 
 typedef struct {
     sg_filter min_filter;
@@ -6719,8 +7749,6 @@ typedef struct {
     _sg_image_ref_t ref;
     int mip_level;
     int slice;
-    int mip_level_count;
-    int slice_count;
 } _sg_image_view_common_t;
 
 typedef struct {
@@ -6729,6 +7757,11 @@ typedef struct {
     _sg_image_view_common_t img;
 } _sg_view_common_t;
 
+typedef struct {
+    int mip_level_count;
+    int slice_count;
+} _sg_view_cold_t;
+
 #if defined(SOKOL_DUMMY_BACKEND)
 typedef struct _sg_buffer_s {
     _sg_slot_t slot;
@@ -6785,7 +7818,6 @@ typedef struct _sg_buffer_s {
     struct {
         GLuint buf[SG_NUM_INFLIGHT_FRAMES];
         uint8_t gpu_dirty_flags; // combination of _sg_gl_gpudirty_t flags
-        bool injected;  // if true, external buffers were injected with sg_buffer_desc.gl_buffers
     } gl;
 } _sg_gl_buffer_t;
 typedef _sg_gl_buffer_t _sg_buffer_t;
@@ -6797,7 +7829,6 @@ typedef struct _sg_image_s {
         GLenum target;
         GLuint tex[SG_NUM_INFLIGHT_FRAMES];
         uint8_t gpu_dirty_flags; // combination of _sg_gl_gpudirty_flags
-        bool injected;  // if true, external textures were injected with sg_image_desc.gl_textures
     } gl;
 } _sg_gl_image_t;
 typedef _sg_gl_image_t _sg_image_t;
@@ -6956,7 +7987,6 @@ typedef struct _sg_image_s {
     _sg_slot_t slot;
     _sg_image_common_t cmn;
     struct {
-        DXGI_FORMAT format;
         ID3D11Texture2D* tex2d;
         ID3D11Texture3D* tex3d;
         ID3D11Resource* res;    // either tex2d or tex3d
@@ -7450,7 +8480,6 @@ typedef struct _sg_buffer_s {
     _sg_buffer_common_t cmn;
     struct {
         VkBuffer buf;
-        VkDeviceMemory mem;
         VkDeviceAddress dev_addr;   // only valid for storage buffers
         _sg_vk_access_t cur_access;
     } vk;
@@ -7462,7 +8491,6 @@ typedef struct _sg_image_s {
     _sg_image_common_t cmn;
     struct {
         VkImage img;
-        VkDeviceMemory mem;
         _sg_vk_access_t cur_access;
     } vk;
 } _sg_vk_image_t;
@@ -7632,6 +8660,10 @@ typedef struct _sg_pools_s {
     _sg_shader_t* shaders;
     _sg_pipeline_t* pipelines;
     _sg_view_t* views;
+    // cold state arrays parallel to the buffer, image and view pools
+    _sg_buffer_cold_t* buffers_cold;
+    _sg_image_cold_t* images_cold;
+    _sg_view_cold_t* views_cold;
 } _sg_pools_t;
 
 typedef struct {
@@ -7640,6 +8672,173 @@ typedef struct {
     sg_commit_listener* items;
 } _sg_commit_listeners_t;
 
+// an asynchronous readback operation
+typedef struct {
+    uint32_t id;
+    sg_readback_state state;
+    uint32_t frame_index;   // frame index when the readback was issued
+    bool failed;            // backend failed to issue the readback, reported in next sg_commit()
+    sg_range dst;
+    size_t num_bytes;       // number of bytes written to dst on completion
+    void (*callback)(const sg_readback_response* response);
+    void* user_data;
+    #if defined(_SOKOL_ANY_GL)
+    struct {
+        GLuint buf;         // GL_PIXEL_PACK_BUFFER or GL_COPY_WRITE_BUFFER staging buffer
+        GLsync sync;
+    } gl;
+    #endif
+} _sg_readback_t;
+
+typedef struct {
+    _sg_pool_t pool;
+    int num_pending;
+    _sg_readback_t* items;
+} _sg_readbacks_t;
+
+// one recorded measurement of a GPU timer scope, each timer keeps
+// a small ring of those so that results can be resolved a few frames later
+enum { _SG_NUM_TIMER_FRAMES = SG_NUM_INFLIGHT_FRAMES + 1 };
+typedef struct {
+    bool pending;           // recorded but not yet resolved
+    uint32_t frame_index;   // frame index when the timer scope was recorded
+    #if defined(_SOKOL_ANY_GL)
+    struct {
+        GLuint queries[2];  // GL_TIMESTAMP queries at begin and end of the timer scope
+    } gl;
+    #elif defined(SOKOL_DUMMY_BACKEND)
+    struct {
+        uint64_t begin_ns;
+        uint64_t end_ns;
+    } dummy;
+    #endif
+} _sg_timer_frame_t;
+
+typedef struct {
+    _sg_str_t label;
+    sg_timer_result result;
+    _sg_timer_frame_t frames[_SG_NUM_TIMER_FRAMES];
+} _sg_timer_t;
+
+// backend-agnostic tracking of uniform buffer usage
+typedef struct {
+    uint32_t size;          // current uniform buffer size
+    uint32_t align;         // backend-specific offset alignment of sg_apply_uniforms() data
+    uint32_t offset;        // uniform buffer bytes actually used in the current frame
+    uint32_t required;      // uniform buffer bytes required in the current frame (may be > size)
+    uint32_t peak;          // max 'required' of all frames
+    bool overflown;         // overflow has been logged in the current frame
+    bool warned;            // warn threshold has been logged in the current frame
+} _sg_uniforms_t;
+
+// per-frame work budget tracking
+typedef struct {
+    sg_frame_budget budget;
+    sg_frame_budget used;
+    bool exceeded[_SG_BUDGETITEM_NUM];  // callback has been called in the current frame
+} _sg_budget_t;
+
+typedef struct {
+    int num;                // number of used timer items
+    int num_pending;        // number of recorded but unresolved timer frames
+    bool in_scope;          // true between sg_begin_timer() and sg_end_timer()
+    _sg_timer_t* cur;       // the timer scope currently being measured, or null
+    _sg_timer_t* items;
+} _sg_timers_t;
+
+// one recorded occlusion query scope, each occlusion query object keeps
+// a small ring of those so that results can be resolved a few frames later
+enum { _SG_NUM_OCCLUSION_QUERY_FRAMES = SG_NUM_INFLIGHT_FRAMES + 1 };
+typedef struct {
+    bool pending;           // recorded but not yet resolved
+    uint32_t frame_index;   // frame index when the query scope was recorded
+    #if defined(_SOKOL_ANY_GL)
+    struct {
+        GLuint query;
+    } gl;
+    #elif defined(SOKOL_DUMMY_BACKEND)
+    struct {
+        uint64_t num_samples;
+    } dummy;
+    #endif
+} _sg_occlusion_query_frame_t;
+
+typedef struct {
+    uint32_t id;            // zero if the slot is not in use
+    sg_occlusion_query_type type;
+    sg_occlusion_query_result result;
+    _sg_occlusion_query_frame_t frames[_SG_NUM_OCCLUSION_QUERY_FRAMES];
+    #if defined(SOKOL_DUMMY_BACKEND)
+    struct {
+        uint64_t num_samples;   // configured with sg_dummy_set_occlusion_result()
+    } dummy;
+    #endif
+} _sg_occlusion_query_t;
+
+typedef struct {
+    _sg_pool_t pool;
+    int num_pending;                // number of recorded but unresolved query frames
+    bool in_scope;                  // true between sg_begin_occlusion_query() and sg_end_occlusion_query()
+    _sg_occlusion_query_t* cur;     // the query scope currently being recorded, or null
+    _sg_occlusion_query_t* items;
+} _sg_occlusion_queries_t;
+
+// command list command types, each command in the command list buffer
+// starts with a _sg_cmd_header_t followed by the command's payload
+typedef enum {
+    _SG_CMD_INVALID,
+    _SG_CMD_APPLY_VIEWPORT,
+    _SG_CMD_APPLY_SCISSOR_RECT,
+    _SG_CMD_APPLY_PIPELINE,
+    _SG_CMD_APPLY_BINDINGS,
+    _SG_CMD_APPLY_UNIFORMS,
+    _SG_CMD_DRAW,
+    _SG_CMD_DRAW_EX,
+} _sg_cmd_type_t;
+
+enum { _SG_CMD_ALIGN = 8 };
+
+typedef struct {
+    uint32_t type;          // _sg_cmd_type_t
+    uint32_t size;          // size of header and payload in bytes, multiple of _SG_CMD_ALIGN
+} _sg_cmd_header_t;
+
+typedef struct {
+    int x, y, width, height;
+    bool origin_top_left;
+} _sg_cmd_rect_t;
+
+typedef struct {
+    int ub_slot;
+    uint32_t size;          // followed by the uniform data
+} _sg_cmd_uniforms_t;
+
+typedef struct {
+    int base_element;
+    int num_elements;
+    int num_instances;
+    int base_vertex;
+    int base_instance;
+} _sg_cmd_draw_t;
+
+typedef struct {
+    uint32_t id;            // zero if the slot is not in use
+    uint8_t* buf;
+    size_t size;
+    size_t pos;
+    int num_commands;
+    bool recording;
+    bool overflow;
+    bool has_pip;           // true after the first sg_cmd_apply_pipeline()
+    bool next_draw_valid;   // record-time validation state, see sg_cmd_apply_pipeline()
+    sg_pipeline cur_pip;    // the most recently recorded pipeline
+} _sg_command_list_t;
+
+typedef struct {
+    _sg_pool_t pool;
+    _sg_command_list_t* items;
+} _sg_command_lists_t;
+
 // resolved pass attachments struct
 typedef struct {
     bool empty;
@@ -7675,6 +8874,7 @@ typedef struct {
     bool valid;
     sg_desc desc;       // original desc with default values patched in
     uint32_t frame_index;
+    int num_mapped_buffers;     // number of buffers between sg_map_buffer() and sg_unmap_buffer()
     struct {
         bool valid;
         bool in_pass;
@@ -7720,6 +8920,12 @@ typedef struct {
     sg_trace_hooks hooks;
     #endif
     _sg_commit_listeners_t commit_listeners;
+    _sg_readbacks_t readbacks;
+    _sg_timers_t timers;
+    _sg_occlusion_queries_t occlusion_queries;
+    _sg_command_lists_t command_lists;
+    _sg_uniforms_t uniforms;
+    _sg_budget_t budget;
 } _sg_state_t;
 static _sg_state_t _sg;
 
@@ -7908,6 +9114,11 @@ _SOKOL_PRIVATE int _sg_pool_alloc_index(_sg_pool_t* pool) {
     }
 }
 
+_SOKOL_PRIVATE int _sg_pool_num_free(const _sg_pool_t* pool) {
+    SOKOL_ASSERT(pool);
+    return pool->queue_top;
+}
+
 _SOKOL_PRIVATE void _sg_pool_free_index(_sg_pool_t* pool, int slot_index) {
     SOKOL_ASSERT((slot_index > _SG_INVALID_SLOT_INDEX) && (slot_index < pool->size));
     SOKOL_ASSERT(pool);
@@ -7928,10 +9139,33 @@ _SOKOL_PRIVATE void _sg_slot_reset(_sg_slot_t* slot) {
     _sg_clear(slot, sizeof(_sg_slot_t));
 }
 
+// returns pointer to the cold state of a resource in the parallel cold arrays
+_SOKOL_PRIVATE _sg_buffer_cold_t* _sg_buffer_cold(const _sg_buffer_t* buf) {
+    SOKOL_ASSERT(buf);
+    const ptrdiff_t slot_index = buf - _sg.pools.buffers;
+    SOKOL_ASSERT((slot_index > _SG_INVALID_SLOT_INDEX) && (slot_index < _sg.pools.buffer_pool.size));
+    return &_sg.pools.buffers_cold[slot_index];
+}
+
+_SOKOL_PRIVATE _sg_image_cold_t* _sg_image_cold(const _sg_image_t* img) {
+    SOKOL_ASSERT(img);
+    const ptrdiff_t slot_index = img - _sg.pools.images;
+    SOKOL_ASSERT((slot_index > _SG_INVALID_SLOT_INDEX) && (slot_index < _sg.pools.image_pool.size));
+    return &_sg.pools.images_cold[slot_index];
+}
+
+_SOKOL_PRIVATE _sg_view_cold_t* _sg_view_cold(const _sg_view_t* view) {
+    SOKOL_ASSERT(view);
+    const ptrdiff_t slot_index = view - _sg.pools.views;
+    SOKOL_ASSERT((slot_index > _SG_INVALID_SLOT_INDEX) && (slot_index < _sg.pools.view_pool.size));
+    return &_sg.pools.views_cold[slot_index];
+}
+
 _SOKOL_PRIVATE void _sg_reset_buffer_to_alloc_state(_sg_buffer_t* buf) {
     SOKOL_ASSERT(buf);
     _sg_slot_t slot = buf->slot;
     _sg_clear(buf, sizeof(*buf));
+    _sg_clear(_sg_buffer_cold(buf), sizeof(_sg_buffer_cold_t));
     buf->slot = slot;
     buf->slot.uninit_count += 1;
     buf->slot.state = SG_RESOURCESTATE_ALLOC;
@@ -7941,6 +9175,7 @@ _SOKOL_PRIVATE void _sg_reset_image_to_alloc_state(_sg_image_t* img) {
     SOKOL_ASSERT(img);
     _sg_slot_t slot = img->slot;
     _sg_clear(img, sizeof(*img));
+    _sg_clear(_sg_image_cold(img), sizeof(_sg_image_cold_t));
     img->slot = slot;
     img->slot.uninit_count += 1;
     img->slot.state = SG_RESOURCESTATE_ALLOC;
@@ -7977,6 +9212,7 @@ _SOKOL_PRIVATE void _sg_reset_view_to_alloc_state(_sg_view_t* view) {
     SOKOL_ASSERT(view);
     _sg_slot_t slot = view->slot;
     _sg_clear(view, sizeof(*view));
+    _sg_clear(_sg_view_cold(view), sizeof(_sg_view_cold_t));
     view->slot = slot;
     view->slot.uninit_count += 1;
     view->slot.state = SG_RESOURCESTATE_ALLOC;
@@ -7990,11 +9226,15 @@ _SOKOL_PRIVATE void _sg_setup_pools(_sg_pools_t* p, const sg_desc* desc) {
     _sg_pool_init(&p->buffer_pool, desc->buffer_pool_size);
     size_t buffer_pool_byte_size = sizeof(_sg_buffer_t) * (size_t)p->buffer_pool.size;
     p->buffers = (_sg_buffer_t*) _sg_malloc_clear(buffer_pool_byte_size);
+    size_t buffer_cold_byte_size = sizeof(_sg_buffer_cold_t) * (size_t)p->buffer_pool.size;
+    p->buffers_cold = (_sg_buffer_cold_t*) _sg_malloc_clear(buffer_cold_byte_size);
 
     SOKOL_ASSERT((desc->image_pool_size > 0) && (desc->image_pool_size < _SG_MAX_POOL_SIZE));
     _sg_pool_init(&p->image_pool, desc->image_pool_size);
     size_t image_pool_byte_size = sizeof(_sg_image_t) * (size_t)p->image_pool.size;
     p->images = (_sg_image_t*) _sg_malloc_clear(image_pool_byte_size);
+    size_t image_cold_byte_size = sizeof(_sg_image_cold_t) * (size_t)p->image_pool.size;
+    p->images_cold = (_sg_image_cold_t*) _sg_malloc_clear(image_cold_byte_size);
 
     SOKOL_ASSERT((desc->sampler_pool_size > 0) && (desc->sampler_pool_size < _SG_MAX_POOL_SIZE));
     _sg_pool_init(&p->sampler_pool, desc->sampler_pool_size);
@@ -8015,16 +9255,21 @@ _SOKOL_PRIVATE void _sg_setup_pools(_sg_pools_t* p, const sg_desc* desc) {
     _sg_pool_init(&p->view_pool, desc->view_pool_size);
     size_t view_pool_byte_size = sizeof(_sg_view_t) * (size_t)p->view_pool.size;
     p->views = (_sg_view_t*) _sg_malloc_clear(view_pool_byte_size);
+    size_t view_cold_byte_size = sizeof(_sg_view_cold_t) * (size_t)p->view_pool.size;
+    p->views_cold = (_sg_view_cold_t*) _sg_malloc_clear(view_cold_byte_size);
 }
 
 _SOKOL_PRIVATE void _sg_discard_pools(_sg_pools_t* p) {
     SOKOL_ASSERT(p);
-    _sg_free(p->views);     p->views = 0;
-    _sg_free(p->pipelines); p->pipelines = 0;
-    _sg_free(p->shaders);   p->shaders = 0;
-    _sg_free(p->samplers);  p->samplers = 0;
-    _sg_free(p->images);    p->images = 0;
-    _sg_free(p->buffers);   p->buffers = 0;
+    _sg_free(p->views_cold);    p->views_cold = 0;
+    _sg_free(p->images_cold);   p->images_cold = 0;
+    _sg_free(p->buffers_cold);  p->buffers_cold = 0;
+    _sg_free(p->views);         p->views = 0;
+    _sg_free(p->pipelines);     p->pipelines = 0;
+    _sg_free(p->shaders);       p->shaders = 0;
+    _sg_free(p->samplers);      p->samplers = 0;
+    _sg_free(p->images);        p->images = 0;
+    _sg_free(p->buffers);       p->buffers = 0;
     _sg_pool_discard(&p->view_pool);
     _sg_pool_discard(&p->pipeline_pool);
     _sg_pool_discard(&p->shader_pool);
@@ -8166,6 +9411,19 @@ _SOKOL_PRIVATE _sg_view_t* _sg_lookup_view(uint32_t view_id) {
     return 0;
 }
 
+_SOKOL_PRIVATE _sg_command_list_t* _sg_lookup_command_list(uint32_t list_id) {
+    if (SG_INVALID_ID != list_id) {
+        const int slot_index = _sg_slot_index(list_id);
+        if (slot_index < _sg.command_lists.pool.size) {
+            _sg_command_list_t* list = &_sg.command_lists.items[slot_index];
+            if (list->id == list_id) {
+                return list;
+            }
+        }
+    }
+    return 0;
+}
+
 // ████████ ██████   █████   ██████ ██   ██
 //    ██    ██   ██ ██   ██ ██      ██  ██
 //    ██    ██████  ███████ ██      █████
@@ -8462,10 +9720,10 @@ _SOKOL_PRIVATE bool _sg_image_view_alive(const _sg_view_t* view) {
 _SOKOL_PRIVATE _sg_dimi_t _sg_image_view_dim(const _sg_view_t* view) {
     SOKOL_ASSERT(view);
     const _sg_image_t* img = _sg_image_ref_ptr(&view->cmn.img.ref);
-    SOKOL_ASSERT((img->cmn.width > 0) && (img->cmn.height > 0));
+    SOKOL_ASSERT((_sg_image_cold(img)->width > 0) && (_sg_image_cold(img)->height > 0));
     _SG_STRUCT(_sg_dimi_t, res);
-    res.width = _sg_miplevel_dim(img->cmn.width, view->cmn.img.mip_level);
-    res.height = _sg_miplevel_dim(img->cmn.height, view->cmn.img.mip_level);
+    res.width = _sg_miplevel_dim(_sg_image_cold(img)->width, view->cmn.img.mip_level);
+    res.height = _sg_miplevel_dim(_sg_image_cold(img)->height, view->cmn.img.mip_level);
     return res;
 }
 
@@ -8544,29 +9802,29 @@ _SOKOL_PRIVATE bool _sg_is_dualsource_blendfactor(sg_blend_factor f) {
     }
 }
 
-_SOKOL_PRIVATE void _sg_buffer_common_init(_sg_buffer_common_t* cmn, const sg_buffer_desc* desc) {
+_SOKOL_PRIVATE void _sg_buffer_common_init(_sg_buffer_common_t* cmn, _sg_buffer_cold_t* cold, const sg_buffer_desc* desc) {
     cmn->size = (int)desc->size;
-    cmn->append_pos = 0;
-    cmn->append_overflow = false;
-    cmn->update_frame_index = 0;
-    cmn->append_frame_index = 0;
     cmn->num_slots = desc->usage.immutable ? 1 : SG_NUM_INFLIGHT_FRAMES;
     cmn->active_slot = 0;
-    cmn->usage = desc->usage;
+    cold->append_pos = 0;
+    cold->append_overflow = false;
+    cold->update_frame_index = 0;
+    cold->append_frame_index = 0;
+    cold->usage = desc->usage;
 }
 
-_SOKOL_PRIVATE void _sg_image_common_init(_sg_image_common_t* cmn, const sg_image_desc* desc) {
-    cmn->upd_frame_index = 0;
-    cmn->num_slots = desc->usage.immutable ? 1 : SG_NUM_INFLIGHT_FRAMES;
+_SOKOL_PRIVATE void _sg_image_common_init(_sg_image_common_t* cmn, _sg_image_cold_t* cold, const sg_image_desc* desc) {
+    cmn->num_slots = (desc->usage.immutable || desc->usage.region_update) ? 1 : SG_NUM_INFLIGHT_FRAMES;
     cmn->active_slot = 0;
-    cmn->type = desc->type;
-    cmn->width = desc->width;
-    cmn->height = desc->height;
-    cmn->num_slices = desc->num_slices;
-    cmn->num_mipmaps = desc->num_mipmaps;
-    cmn->usage = desc->usage;
-    cmn->pixel_format = desc->pixel_format;
-    cmn->sample_count = desc->sample_count;
+    cold->upd_frame_index = 0;
+    cold->type = desc->type;
+    cold->width = desc->width;
+    cold->height = desc->height;
+    cold->num_slices = desc->num_slices;
+    cold->num_mipmaps = desc->num_mipmaps;
+    cold->usage = desc->usage;
+    cold->pixel_format = desc->pixel_format;
+    cold->sample_count = desc->sample_count;
 }
 
 _SOKOL_PRIVATE void _sg_sampler_common_init(_sg_sampler_common_t* cmn, const sg_sampler_desc* desc) {
@@ -8696,44 +9954,45 @@ _SOKOL_PRIVATE void _sg_buffer_view_common_init(_sg_buffer_view_common_t* cmn, c
     cmn->offset = desc->offset;
 }
 
-_SOKOL_PRIVATE void _sg_texture_view_common_init(_sg_image_view_common_t* cmn, const sg_texture_view_desc* desc, _sg_image_t* img) {
+_SOKOL_PRIVATE void _sg_texture_view_common_init(_sg_image_view_common_t* cmn, _sg_view_cold_t* cold, const sg_texture_view_desc* desc, _sg_image_t* img) {
     SOKOL_ASSERT(_sg_resource_state_valid_unsealed(img->slot.state));
+    const _sg_image_cold_t* img_cold = _sg_image_cold(img);
     cmn->ref = _sg_image_ref(img);
     cmn->mip_level = desc->mip_levels.base;
-    cmn->mip_level_count = _sg_def(desc->mip_levels.count, img->cmn.num_mipmaps - cmn->mip_level);
     cmn->slice = desc->slices.base;
-    switch (img->cmn.type) {
+    cold->mip_level_count = _sg_def(desc->mip_levels.count, img_cold->num_mipmaps - cmn->mip_level);
+    switch (img_cold->type) {
         case SG_IMAGETYPE_2D:
-            cmn->slice_count = 1;
+            cold->slice_count = 1;
             break;
         case SG_IMAGETYPE_CUBE:
-            cmn->slice_count = 6;
+            cold->slice_count = 6;
             break;
         case SG_IMAGETYPE_3D:
-            cmn->slice_count = 1;
+            cold->slice_count = 1;
             break;
         case SG_IMAGETYPE_ARRAY:
-            cmn->slice_count = _sg_def(desc->slices.count, img->cmn.num_slices - cmn->slice);
+            cold->slice_count = _sg_def(desc->slices.count, img_cold->num_slices - cmn->slice);
             break;
         default:
             SOKOL_UNREACHABLE;
     }
 }
 
-_SOKOL_PRIVATE void _sg_image_view_common_init(_sg_image_view_common_t* cmn, const sg_image_view_desc* desc, _sg_image_t* img) {
+_SOKOL_PRIVATE void _sg_image_view_common_init(_sg_image_view_common_t* cmn, _sg_view_cold_t* cold, const sg_image_view_desc* desc, _sg_image_t* img) {
     SOKOL_ASSERT(SG_RESOURCESTATE_VALID == img->slot.state);
     cmn->ref = _sg_image_ref(img);
     cmn->mip_level = desc->mip_level;
-    cmn->mip_level_count = 1;
     cmn->slice = desc->slice;
-    cmn->slice_count = 1;
+    cold->mip_level_count = 1;
+    cold->slice_count = 1;
 }
 
-_SOKOL_PRIVATE void _sg_view_common_init(_sg_view_common_t* cmn, const sg_view_desc* desc, _sg_buffer_t* buf, _sg_image_t* img) {
+_SOKOL_PRIVATE void _sg_view_common_init(_sg_view_common_t* cmn, _sg_view_cold_t* cold, const sg_view_desc* desc, _sg_buffer_t* buf, _sg_image_t* img) {
     if (desc->texture.image.id != SG_INVALID_ID) {
         SOKOL_ASSERT(img);
         cmn->type = SG_VIEWTYPE_TEXTURE;
-        _sg_texture_view_common_init(&cmn->img, &desc->texture, img);
+        _sg_texture_view_common_init(&cmn->img, cold, &desc->texture, img);
     } else if (desc->storage_buffer.buffer.id != SG_INVALID_ID) {
         SOKOL_ASSERT(buf);
         cmn->type = SG_VIEWTYPE_STORAGEBUFFER;
@@ -8741,19 +10000,19 @@ _SOKOL_PRIVATE void _sg_view_common_init(_sg_view_common_t* cmn, const sg_view_d
     } else if (desc->storage_image.image.id != SG_INVALID_ID) {
         SOKOL_ASSERT(img);
         cmn->type = SG_VIEWTYPE_STORAGEIMAGE;
-        _sg_image_view_common_init(&cmn->img, &desc->storage_image, img);
+        _sg_image_view_common_init(&cmn->img, cold, &desc->storage_image, img);
     } else if (desc->color_attachment.image.id != SG_INVALID_ID) {
         SOKOL_ASSERT(img);
         cmn->type = SG_VIEWTYPE_COLORATTACHMENT;
-        _sg_image_view_common_init(&cmn->img, &desc->color_attachment, img);
+        _sg_image_view_common_init(&cmn->img, cold, &desc->color_attachment, img);
     } else if (desc->resolve_attachment.image.id != SG_INVALID_ID) {
         SOKOL_ASSERT(img);
         cmn->type = SG_VIEWTYPE_RESOLVEATTACHMENT;
-        _sg_image_view_common_init(&cmn->img, &desc->resolve_attachment, img);
+        _sg_image_view_common_init(&cmn->img, cold, &desc->resolve_attachment, img);
     } else if (desc->depth_stencil_attachment.image.id != SG_INVALID_ID) {
         SOKOL_ASSERT(img);
         cmn->type = SG_VIEWTYPE_DEPTHSTENCILATTACHMENT;
-        _sg_image_view_common_init(&cmn->img, &desc->depth_stencil_attachment, img);
+        _sg_image_view_common_init(&cmn->img, cold, &desc->depth_stencil_attachment, img);
     } else {
         SOKOL_UNREACHABLE;
     }
@@ -9318,6 +10577,12 @@ _SOKOL_PRIVATE void _sg_dummy_setup_backend(const sg_desc* desc) {
     _sg.limits.max_texture_bindings_per_stage = SG_MAX_PORTABLE_TEXTURE_BINDINGS_PER_STAGE;
     _sg.limits.max_storage_buffer_bindings_per_stage = SG_MAX_PORTABLE_STORAGEBUFFER_BINDINGS_PER_STAGE;
     _sg.limits.max_storage_image_bindings_per_stage = SG_MAX_PORTABLE_STORAGEIMAGE_BINDINGS_PER_STAGE;
+    _sg.features.readback = true;
+    _sg.features.gpu_timers = true;
+    _sg.features.occlusion_query = true;
+    _sg.features.occlusion_query_samples = true;
+    _sg.features.draw_base_vertex = true;
+    _sg.features.draw_base_instance = true;
 }
 
 _SOKOL_PRIVATE void _sg_dummy_discard_backend(void) {
@@ -9489,6 +10754,12 @@ _SOKOL_PRIVATE void _sg_dummy_update_image(_sg_image_t* img, const sg_image_data
     }
 }
 
+_SOKOL_PRIVATE void _sg_dummy_update_image_region(_sg_image_t* img, const sg_write_image_desc* desc) {
+    SOKOL_ASSERT(img && desc);
+    _SOKOL_UNUSED(img);
+    _SOKOL_UNUSED(desc);
+}
+
 _SOKOL_PRIVATE void _sg_dummy_write_buffer_unsealed(_sg_buffer_t* buf, const sg_write_buffer_desc* desc) {
     SOKOL_ASSERT(buf && desc);
     _SOKOL_UNUSED(buf);
@@ -9511,6 +10782,128 @@ _SOKOL_PRIVATE void _sg_dummy_seal_image(_sg_image_t* img) {
     _SOKOL_UNUSED(img);
 }
 
+_SOKOL_PRIVATE bool _sg_dummy_read_buffer(_sg_readback_t* rb, _sg_buffer_t* buf, const sg_read_buffer_desc* desc) {
+    SOKOL_ASSERT(rb && buf && desc);
+    _SOKOL_UNUSED(rb);
+    _SOKOL_UNUSED(buf);
+    _SOKOL_UNUSED(desc);
+    return true;
+}
+
+_SOKOL_PRIVATE bool _sg_dummy_read_image(_sg_readback_t* rb, _sg_image_t* img, const sg_read_image_desc* desc) {
+    SOKOL_ASSERT(rb && img && desc);
+    _SOKOL_UNUSED(rb);
+    _SOKOL_UNUSED(img);
+    _SOKOL_UNUSED(desc);
+    return true;
+}
+
+_SOKOL_PRIVATE sg_readback_state _sg_dummy_poll_readback(_sg_readback_t* rb) {
+    SOKOL_ASSERT(rb && rb->dst.ptr);
+    // simulate the usual frame latency of a GPU readback, the dummy
+    // backend has no resource content so it writes zeroes instead
+    if ((_sg.frame_index - rb->frame_index) >= SG_NUM_INFLIGHT_FRAMES) {
+        _sg_clear((void*)rb->dst.ptr, rb->num_bytes);
+        return SG_READBACKSTATE_COMPLETED;
+    } else {
+        return SG_READBACKSTATE_PENDING;
+    }
+}
+
+_SOKOL_PRIVATE void _sg_dummy_discard_readback(_sg_readback_t* rb) {
+    SOKOL_ASSERT(rb);
+    _SOKOL_UNUSED(rb);
+}
+
+// computes value * numer / denom without overflowing for large values
+_SOKOL_PRIVATE uint64_t _sg_dummy_muldiv(uint64_t value, uint64_t numer, uint64_t denom) {
+    const uint64_t q = value / denom;
+    const uint64_t r = value % denom;
+    return q * numer + r * numer / denom;
+}
+
+// CPU timestamp in nanoseconds, same approach as in sokol_time.h
+_SOKOL_PRIVATE uint64_t _sg_dummy_now_ns(void) {
+    #if defined(_WIN32)
+        LARGE_INTEGER freq, qpc;
+        QueryPerformanceFrequency(&freq);
+        QueryPerformanceCounter(&qpc);
+        return _sg_dummy_muldiv((uint64_t)qpc.QuadPart, 1000000000, (uint64_t)freq.QuadPart);
+    #elif defined(__APPLE__) && defined(__MACH__)
+        mach_timebase_info_data_t timebase;
+        mach_timebase_info(&timebase);
+        return _sg_dummy_muldiv(mach_absolute_time(), timebase.numer, timebase.denom);
+    #elif defined(__EMSCRIPTEN__)
+        return (uint64_t)(emscripten_get_now() * 1000000.0);
+    #elif defined(CLOCK_MONOTONIC)
+        struct timespec ts;
+        clock_gettime(CLOCK_MONOTONIC, &ts);
+        return (uint64_t)ts.tv_sec * 1000000000 + (uint64_t)ts.tv_nsec;
+    #else
+        // fallback for strict C modes without POSIX extensions
+        return _sg_dummy_muldiv((uint64_t)clock(), 1000000000, (uint64_t)CLOCKS_PER_SEC);
+    #endif
+}
+
+_SOKOL_PRIVATE void _sg_dummy_begin_timer(_sg_timer_frame_t* frame) {
+    SOKOL_ASSERT(frame);
+    frame->dummy.begin_ns = _sg_dummy_now_ns();
+    frame->dummy.end_ns = frame->dummy.begin_ns;
+}
+
+_SOKOL_PRIVATE void _sg_dummy_end_timer(_sg_timer_frame_t* frame) {
+    SOKOL_ASSERT(frame);
+    frame->dummy.end_ns = _sg_dummy_now_ns();
+}
+
+_SOKOL_PRIVATE bool _sg_dummy_poll_timer(_sg_timer_frame_t* frame, uint64_t* out_duration_ns) {
+    SOKOL_ASSERT(frame && out_duration_ns);
+    // simulate the usual frame latency of GPU timestamp queries
+    if ((_sg.frame_index - frame->frame_index) >= SG_NUM_INFLIGHT_FRAMES) {
+        *out_duration_ns = frame->dummy.end_ns - frame->dummy.begin_ns;
+        return true;
+    } else {
+        return false;
+    }
+}
+
+_SOKOL_PRIVATE void _sg_dummy_discard_timer(_sg_timer_frame_t* frame) {
+    SOKOL_ASSERT(frame);
+    _SOKOL_UNUSED(frame);
+}
+
+_SOKOL_PRIVATE void _sg_dummy_begin_occlusion_query(_sg_occlusion_query_t* query, _sg_occlusion_query_frame_t* frame) {
+    SOKOL_ASSERT(query && frame);
+    // the dummy backend doesn't rasterize, instead the configured sample count is reported
+    frame->dummy.num_samples = query->dummy.num_samples;
+}
+
+_SOKOL_PRIVATE void _sg_dummy_end_occlusion_query(_sg_occlusion_query_t* query, _sg_occlusion_query_frame_t* frame) {
+    SOKOL_ASSERT(query && frame);
+    _SOKOL_UNUSED(query);
+    _SOKOL_UNUSED(frame);
+}
+
+_SOKOL_PRIVATE bool _sg_dummy_poll_occlusion_query(_sg_occlusion_query_t* query, _sg_occlusion_query_frame_t* frame, uint64_t* out_num_samples) {
+    SOKOL_ASSERT(query && frame && out_num_samples);
+    // simulate the usual frame latency of GPU occlusion queries
+    if ((_sg.frame_index - frame->frame_index) >= SG_NUM_INFLIGHT_FRAMES) {
+        if (query->type == SG_OCCLUSIONQUERYTYPE_ANY_SAMPLES_PASSED) {
+            *out_num_samples = (frame->dummy.num_samples > 0) ? 1 : 0;
+        } else {
+            *out_num_samples = frame->dummy.num_samples;
+        }
+        return true;
+    } else {
+        return false;
+    }
+}
+
+_SOKOL_PRIVATE void _sg_dummy_discard_occlusion_query(_sg_occlusion_query_frame_t* frame) {
+    SOKOL_ASSERT(frame);
+    _SOKOL_UNUSED(frame);
+}
+
 //  ██████  ██████  ███████ ███    ██  ██████  ██          ██████   █████   ██████ ██   ██ ███████ ███    ██ ██████
 // ██    ██ ██   ██ ██      ████   ██ ██       ██          ██   ██ ██   ██ ██      ██  ██  ██      ████   ██ ██   ██
 // ██    ██ ██████  █████   ██ ██  ██ ██   ███ ██          ██████  ███████ ██      █████   █████   ██ ██  ██ ██   ██
@@ -9651,7 +11044,22 @@ _SOKOL_PRIVATE void _sg_dummy_seal_image(_sg_image_t* img) {
     _SG_XMACRO(glDrawElementsBaseVertex,          void, (GLenum mode, GLsizei count, GLenum type, const void* indices, GLint basevertex)) \
     _SG_XMACRO(glDrawElementsInstancedBaseVertex, void, (GLenum mode, GLsizei count, GLenum type, const void* indices, GLsizei instancecount, GLint basevertex)) \
     _SG_XMACRO(glDrawElementsInstancedBaseVertexBaseInstance, void, (GLenum mode, GLsizei count, GLenum type, const void* indices, GLsizei instancecount, GLint basevertex, GLuint baseinstance)) \
-    _SG_XMACRO(glDrawArraysInstancedBaseInstance, void, (GLenum mode, GLint first, GLsizei count, GLsizei instancecount, GLuint baseinstance))
+    _SG_XMACRO(glDrawArraysInstancedBaseInstance, void, (GLenum mode, GLint first, GLsizei count, GLsizei instancecount, GLuint baseinstance)) \
+    _SG_XMACRO(glCopyBufferSubData,               void, (GLenum readTarget, GLenum writeTarget, GLintptr readOffset, GLintptr writeOffset, GLsizeiptr size)) \
+    _SG_XMACRO(glReadPixels,                      void, (GLint x, GLint y, GLsizei width, GLsizei height, GLenum format, GLenum type, void* data)) \
+    _SG_XMACRO(glMapBufferRange,                  void*, (GLenum target, GLintptr offset, GLsizeiptr length, GLbitfield access)) \
+    _SG_XMACRO(glUnmapBuffer,                     GLboolean, (GLenum target)) \
+    _SG_XMACRO(glFenceSync,                       GLsync, (GLenum condition, GLbitfield flags)) \
+    _SG_XMACRO(glClientWaitSync,                  GLenum, (GLsync sync, GLbitfield flags, GLuint64 timeout)) \
+    _SG_XMACRO(glDeleteSync,                      void, (GLsync sync)) \
+    _SG_XMACRO(glGenQueries,                      void, (GLsizei n, GLuint* ids)) \
+    _SG_XMACRO(glDeleteQueries,                   void, (GLsizei n, const GLuint* ids)) \
+    _SG_XMACRO(glQueryCounter,                    void, (GLuint id, GLenum target)) \
+    _SG_XMACRO(glGetQueryObjectiv,                void, (GLuint id, GLenum pname, GLint* params)) \
+    _SG_XMACRO(glGetQueryObjectui64v,             void, (GLuint id, GLenum pname, GLuint64* params)) \
+    _SG_XMACRO(glGetQueryObjectuiv,               void, (GLuint id, GLenum pname, GLuint* params)) \
+    _SG_XMACRO(glBeginQuery,                      void, (GLenum target, GLuint id)) \
+    _SG_XMACRO(glEndQuery,                        void, (GLenum target))
 
 // generate GL function pointer typedefs
 #define _SG_XMACRO(name, ret, args) typedef ret (GL_APIENTRY* PFN_ ## name) args;
@@ -10458,6 +11866,12 @@ _SOKOL_PRIVATE void _sg_gl_init_caps_glcore(void) {
     #endif
     _sg.features.draw_base_vertex = version >= 320;
     _sg.features.draw_base_instance = version >= 420;
+    _sg.features.readback = version >= 320;
+    #if defined(_SOKOL_GL_HAS_TIMERQUERY)
+    _sg.features.gpu_timers = version >= 330;
+    #endif
+    _sg.features.occlusion_query = version >= 330;
+    _sg.features.occlusion_query_samples = version >= 330;
     _sg.features.dual_source_blending = version >= 330;
     _sg.features.vertexformat_int10_n2 = true;
 
@@ -10586,6 +12000,13 @@ _SOKOL_PRIVATE void _sg_gl_init_caps_gles3(void) {
     #endif
     _sg.features.draw_base_vertex = version >= 320;
     _sg.features.draw_base_instance = false;
+    #if defined(__EMSCRIPTEN__)
+    _sg.features.readback = false;
+    #else
+    _sg.features.readback = true;
+    #endif
+    _sg.features.occlusion_query = true;
+    _sg.features.occlusion_query_samples = false;
     _sg.features.dual_source_blending = false;
     _sg.features.vertexformat_int10_n2 = true;
 
@@ -11099,13 +12520,14 @@ _SOKOL_PRIVATE void _sg_gl_discard_backend(void) {
 //-- GL backend resource creation and destruction ------------------------------
 _SOKOL_PRIVATE sg_resource_state _sg_gl_create_buffer(_sg_buffer_t* buf, const sg_buffer_desc* desc) {
     SOKOL_ASSERT(buf && desc);
+    _sg_buffer_cold_t* cold = _sg_buffer_cold(buf);
     _SG_GL_CHECK_ERROR();
-    buf->gl.injected = (0 != desc->gl_buffers[0]);
-    const GLenum gl_target = _sg_gl_buffer_target(&buf->cmn.usage);
-    const GLenum gl_usage  = _sg_gl_buffer_usage(&buf->cmn.usage);
+    cold->gl.injected = (0 != desc->gl_buffers[0]);
+    const GLenum gl_target = _sg_gl_buffer_target(&cold->usage);
+    const GLenum gl_usage  = _sg_gl_buffer_usage(&cold->usage);
     for (int slot = 0; slot < buf->cmn.num_slots; slot++) {
         GLuint gl_buf = 0;
-        if (buf->gl.injected) {
+        if (cold->gl.injected) {
             SOKOL_ASSERT(desc->gl_buffers[slot]);
             gl_buf = desc->gl_buffers[slot];
         } else {
@@ -11131,7 +12553,7 @@ _SOKOL_PRIVATE void _sg_gl_discard_buffer(_sg_buffer_t* buf) {
     for (int slot = 0; slot < buf->cmn.num_slots; slot++) {
         if (buf->gl.buf[slot]) {
             _sg_gl_cache_invalidate_buffer(buf->gl.buf[slot]);
-            if (!buf->gl.injected) {
+            if (!_sg_buffer_cold(buf)->gl.injected) {
                 glDeleteBuffers(1, &buf->gl.buf[slot]);
             }
         }
@@ -11152,17 +12574,18 @@ _SOKOL_PRIVATE bool _sg_gl_supported_texture_format(sg_pixel_format fmt) {
 }
 
 _SOKOL_PRIVATE void _sg_gl_texstorage(const _sg_image_t* img) {
+    const _sg_image_cold_t* cold = _sg_image_cold(img);
     const GLenum tgt = img->gl.target;
-    const int num_mips = img->cmn.num_mipmaps;
+    const int num_mips = cold->num_mipmaps;
     #if defined(_SOKOL_GL_HAS_TEXSTORAGE)
-        const GLenum ifmt = _sg_gl_teximage_internal_format(img->cmn.pixel_format);
-        const bool msaa = img->cmn.sample_count > 1;
-        const int w = img->cmn.width;
-        const int h = img->cmn.height;
-        if ((SG_IMAGETYPE_2D == img->cmn.type) || (SG_IMAGETYPE_CUBE == img->cmn.type)) {
+        const GLenum ifmt = _sg_gl_teximage_internal_format(cold->pixel_format);
+        const bool msaa = cold->sample_count > 1;
+        const int w = cold->width;
+        const int h = cold->height;
+        if ((SG_IMAGETYPE_2D == cold->type) || (SG_IMAGETYPE_CUBE == cold->type)) {
             #if defined(SOKOL_GLCORE)
                 if (msaa) {
-                    glTexStorage2DMultisample(tgt, img->cmn.sample_count, ifmt, w, h, GL_TRUE);
+                    glTexStorage2DMultisample(tgt, cold->sample_count, ifmt, w, h, GL_TRUE);
                 } else {
                     glTexStorage2D(tgt, num_mips, ifmt, w, h);
                 }
@@ -11170,12 +12593,12 @@ _SOKOL_PRIVATE void _sg_gl_texstorage(const _sg_image_t* img) {
                 SOKOL_ASSERT(!msaa); _SOKOL_UNUSED(msaa);
                 glTexStorage2D(tgt, num_mips, ifmt, w, h);
             #endif
-        } else if ((SG_IMAGETYPE_3D == img->cmn.type) || (SG_IMAGETYPE_ARRAY == img->cmn.type)) {
-            const int depth = img->cmn.num_slices;
+        } else if ((SG_IMAGETYPE_3D == cold->type) || (SG_IMAGETYPE_ARRAY == cold->type)) {
+            const int depth = cold->num_slices;
             #if defined(SOKOL_GLCORE)
                 if (msaa) {
                     // NOTE: MSAA works only for array textures, not 3D textures
-                    glTexStorage3DMultisample(tgt, img->cmn.sample_count, ifmt, w, h, depth, GL_TRUE);
+                    glTexStorage3DMultisample(tgt, cold->sample_count, ifmt, w, h, depth, GL_TRUE);
                 } else {
                     glTexStorage3D(tgt, num_mips, ifmt, w, h, depth);
                 }
@@ -11209,19 +12632,19 @@ _SOKOL_PRIVATE void _sg_gl_write_miplevel_data(const _sg_image_t* img,
     SOKOL_ASSERT(src_size > 0);
     SOKOL_ASSERT(src_bytes_per_row > 0);
     SOKOL_ASSERT(src_bytes_per_slice > 0);
-    SOKOL_ASSERT((mip_level >= 0) && (mip_level < img->cmn.num_mipmaps));
-    SOKOL_ASSERT((x >= 0) && (x < _sg_miplevel_dim(img->cmn.width, mip_level)));
-    SOKOL_ASSERT((y >= 0) && (y < _sg_miplevel_dim(img->cmn.height, mip_level)));
-    SOKOL_ASSERT((slice >= 0) && (slice < img->cmn.num_slices));
-    SOKOL_ASSERT((width > 0) && (x + width <= _sg_miplevel_dim(img->cmn.width, mip_level)));
-    SOKOL_ASSERT((height > 0) && (y + height <= _sg_miplevel_dim(img->cmn.height, mip_level)));
-    SOKOL_ASSERT((num_slices > 0) && (slice + num_slices <= img->cmn.num_slices));
+    SOKOL_ASSERT((mip_level >= 0) && (mip_level < _sg_image_cold(img)->num_mipmaps));
+    SOKOL_ASSERT((x >= 0) && (x < _sg_miplevel_dim(_sg_image_cold(img)->width, mip_level)));
+    SOKOL_ASSERT((y >= 0) && (y < _sg_miplevel_dim(_sg_image_cold(img)->height, mip_level)));
+    SOKOL_ASSERT((slice >= 0) && (slice < _sg_image_cold(img)->num_slices));
+    SOKOL_ASSERT((width > 0) && (x + width <= _sg_miplevel_dim(_sg_image_cold(img)->width, mip_level)));
+    SOKOL_ASSERT((height > 0) && (y + height <= _sg_miplevel_dim(_sg_image_cold(img)->height, mip_level)));
+    SOKOL_ASSERT((num_slices > 0) && (slice + num_slices <= _sg_image_cold(img)->num_slices));
     SOKOL_ASSERT((src_offset + (size_t)src_bytes_per_slice * (size_t)num_slices) <= src_size);
-    SOKOL_ASSERT(_sg_multiple(src_bytes_per_row, _sg_block_bytesize(img->cmn.pixel_format)));
+    SOKOL_ASSERT(_sg_multiple(src_bytes_per_row, _sg_block_bytesize(_sg_image_cold(img)->pixel_format)));
     SOKOL_ASSERT(_sg_multiple(src_bytes_per_slice, src_bytes_per_row));
 
-    const bool compressed = _sg_is_compressed_pixel_format(img->cmn.pixel_format);
-    const sg_pixel_format fmt = img->cmn.pixel_format;
+    const bool compressed = _sg_is_compressed_pixel_format(_sg_image_cold(img)->pixel_format);
+    const sg_pixel_format fmt = _sg_image_cold(img)->pixel_format;
 
     // configure pixel unpack properties, note that GL works in number of pixels/blocks, not in bytes
     const GLint unpack_row_length = src_bytes_per_row / _sg_block_bytesize(fmt);
@@ -11234,16 +12657,16 @@ _SOKOL_PRIVATE void _sg_gl_write_miplevel_data(const _sg_image_t* img,
     const GLenum gl_ifmt = _sg_gl_teximage_internal_format(fmt);
     const GLsizei gl_img_size = (GLsizei)(src_size - src_offset);
     SOKOL_ASSERT(gl_img_size > 0);
-    const GLenum gl_type = _sg_gl_teximage_type(img->cmn.pixel_format);
-    const GLenum gl_fmt = _sg_gl_teximage_format(img->cmn.pixel_format);
-    if (SG_IMAGETYPE_2D == img->cmn.type) {
+    const GLenum gl_type = _sg_gl_teximage_type(_sg_image_cold(img)->pixel_format);
+    const GLenum gl_fmt = _sg_gl_teximage_format(_sg_image_cold(img)->pixel_format);
+    if (SG_IMAGETYPE_2D == _sg_image_cold(img)->type) {
         const void* gl_data = (const void*)(src_ptr + src_offset);
         if (compressed) {
             glCompressedTexSubImage2D(gl_tgt, mip_level, x, y, width, height, gl_ifmt, gl_img_size, gl_data);
         } else {
             glTexSubImage2D(gl_tgt, mip_level, x, y, width, height, gl_fmt, gl_type, gl_data);
         }
-    } else if (SG_IMAGETYPE_CUBE == img->cmn.type) {
+    } else if (SG_IMAGETYPE_CUBE == _sg_image_cold(img)->type) {
         for (int i = 0; i < num_slices; i++) {
             const void* gl_data = (const void*)(src_ptr + src_offset + i * src_bytes_per_slice);
             const int face_index = i + slice;
@@ -11255,7 +12678,7 @@ _SOKOL_PRIVATE void _sg_gl_write_miplevel_data(const _sg_image_t* img,
                 glTexSubImage2D(gl_cubeface_tgt, mip_level, x, y, width, height, gl_fmt, gl_type, gl_data);
             }
         }
-    } else if ((SG_IMAGETYPE_3D == img->cmn.type) || (SG_IMAGETYPE_ARRAY == img->cmn.type)) {
+    } else if ((SG_IMAGETYPE_3D == _sg_image_cold(img)->type) || (SG_IMAGETYPE_ARRAY == _sg_image_cold(img)->type)) {
         const void* gl_data = (const void*)(src_ptr + src_offset);
         if (compressed) {
             glCompressedTexSubImage3D(gl_tgt, mip_level, x, y, slice, width, height, num_slices, gl_ifmt, gl_img_size, gl_data);
@@ -11272,24 +12695,24 @@ _SOKOL_PRIVATE void _sg_gl_write_miplevel_data(const _sg_image_t* img,
 
 _SOKOL_PRIVATE void _sg_gl_texsubimage(const _sg_image_t* img, GLenum tgt, int mip_index, int w, int h, int depth, const GLvoid* data_ptr, GLsizei data_size) {
     SOKOL_ASSERT(data_ptr && (data_size > 0));
-    SOKOL_ASSERT(img->cmn.sample_count == 1);
-    const bool compressed = _sg_is_compressed_pixel_format(img->cmn.pixel_format);
-    if ((SG_IMAGETYPE_2D == img->cmn.type) || (SG_IMAGETYPE_CUBE == img->cmn.type)) {
+    SOKOL_ASSERT(_sg_image_cold(img)->sample_count == 1);
+    const bool compressed = _sg_is_compressed_pixel_format(_sg_image_cold(img)->pixel_format);
+    if ((SG_IMAGETYPE_2D == _sg_image_cold(img)->type) || (SG_IMAGETYPE_CUBE == _sg_image_cold(img)->type)) {
         if (compressed) {
-            const GLenum ifmt = _sg_gl_teximage_internal_format(img->cmn.pixel_format);
+            const GLenum ifmt = _sg_gl_teximage_internal_format(_sg_image_cold(img)->pixel_format);
             glCompressedTexSubImage2D(tgt, mip_index, 0, 0, w, h, ifmt, data_size, data_ptr);
         } else {
-            const GLenum type = _sg_gl_teximage_type(img->cmn.pixel_format);
-            const GLenum fmt = _sg_gl_teximage_format(img->cmn.pixel_format);
+            const GLenum type = _sg_gl_teximage_type(_sg_image_cold(img)->pixel_format);
+            const GLenum fmt = _sg_gl_teximage_format(_sg_image_cold(img)->pixel_format);
             glTexSubImage2D(tgt, mip_index, 0, 0, w, h, fmt, type, data_ptr);
         }
-    } else if ((SG_IMAGETYPE_3D == img->cmn.type) || (SG_IMAGETYPE_ARRAY == img->cmn.type)) {
+    } else if ((SG_IMAGETYPE_3D == _sg_image_cold(img)->type) || (SG_IMAGETYPE_ARRAY == _sg_image_cold(img)->type)) {
         if (compressed) {
-            const GLenum ifmt = _sg_gl_teximage_internal_format(img->cmn.pixel_format);
+            const GLenum ifmt = _sg_gl_teximage_internal_format(_sg_image_cold(img)->pixel_format);
             glCompressedTexSubImage3D(tgt, mip_index, 0, 0, 0, w, h, depth, ifmt, data_size, data_ptr);
         } else {
-            const GLenum type = _sg_gl_teximage_type(img->cmn.pixel_format);
-            const GLenum fmt = _sg_gl_teximage_format(img->cmn.pixel_format);
+            const GLenum type = _sg_gl_teximage_type(_sg_image_cold(img)->pixel_format);
+            const GLenum fmt = _sg_gl_teximage_format(_sg_image_cold(img)->pixel_format);
             glTexSubImage3D(tgt, mip_index, 0, 0, 0, w, h, depth, fmt, type, data_ptr);
         }
     }
@@ -11302,19 +12725,19 @@ _SOKOL_PRIVATE void _sg_gl_teximage(const _sg_image_t* img, GLenum tgt, int mip_
         }
         _sg_gl_texsubimage(img, tgt, mip_index, w, h, depth, data_ptr, data_size);
     #else
-        const bool compressed = _sg_is_compressed_pixel_format(img->cmn.pixel_format);
-        const GLenum ifmt = _sg_gl_teximage_internal_format(img->cmn.pixel_format);
-        const bool msaa = img->cmn.sample_count > 1;
-        if ((SG_IMAGETYPE_2D == img->cmn.type) || (SG_IMAGETYPE_CUBE == img->cmn.type)) {
+        const bool compressed = _sg_is_compressed_pixel_format(_sg_image_cold(img)->pixel_format);
+        const GLenum ifmt = _sg_gl_teximage_internal_format(_sg_image_cold(img)->pixel_format);
+        const bool msaa = _sg_image_cold(img)->sample_count > 1;
+        if ((SG_IMAGETYPE_2D == _sg_image_cold(img)->type) || (SG_IMAGETYPE_CUBE == _sg_image_cold(img)->type)) {
             if (compressed) {
                 SOKOL_ASSERT(!msaa); _SOKOL_UNUSED(msaa);
                 glCompressedTexImage2D(tgt, mip_index, ifmt, w, h, 0, data_size, data_ptr);
             } else {
-                const GLenum type = _sg_gl_teximage_type(img->cmn.pixel_format);
-                const GLenum fmt = _sg_gl_teximage_format(img->cmn.pixel_format);
+                const GLenum type = _sg_gl_teximage_type(_sg_image_cold(img)->pixel_format);
+                const GLenum fmt = _sg_gl_teximage_format(_sg_image_cold(img)->pixel_format);
                 #if defined(SOKOL_GLCORE) && !defined(__APPLE__)
                     if (msaa) {
-                        glTexImage2DMultisample(tgt, img->cmn.sample_count, ifmt, w, h, GL_TRUE);
+                        glTexImage2DMultisample(tgt, _sg_image_cold(img)->sample_count, ifmt, w, h, GL_TRUE);
                     } else {
                         glTexImage2D(tgt, mip_index, (GLint)ifmt, w, h, 0, fmt, type, data_ptr);
                     }
@@ -11323,17 +12746,17 @@ _SOKOL_PRIVATE void _sg_gl_teximage(const _sg_image_t* img, GLenum tgt, int mip_
                     glTexImage2D(tgt, mip_index, (GLint)ifmt, w, h, 0, fmt, type, data_ptr);
                 #endif
             }
-        } else if ((SG_IMAGETYPE_3D == img->cmn.type) || (SG_IMAGETYPE_ARRAY == img->cmn.type)) {
+        } else if ((SG_IMAGETYPE_3D == _sg_image_cold(img)->type) || (SG_IMAGETYPE_ARRAY == _sg_image_cold(img)->type)) {
             if (compressed) {
                 SOKOL_ASSERT(!msaa); _SOKOL_UNUSED(msaa);
                 glCompressedTexImage3D(tgt, mip_index, ifmt, w, h, depth, 0, data_size, data_ptr);
             } else {
-                const GLenum type = _sg_gl_teximage_type(img->cmn.pixel_format);
-                const GLenum fmt = _sg_gl_teximage_format(img->cmn.pixel_format);
+                const GLenum type = _sg_gl_teximage_type(_sg_image_cold(img)->pixel_format);
+                const GLenum fmt = _sg_gl_teximage_format(_sg_image_cold(img)->pixel_format);
                 #if defined(SOKOL_GLCORE) && !defined(__APPLE__)
                     if (msaa) {
                         // NOTE: MSAA works only for array textures, not 3D textures
-                        glTexImage3DMultisample(tgt, img->cmn.sample_count, ifmt, w, h, depth, GL_TRUE);
+                        glTexImage3DMultisample(tgt, _sg_image_cold(img)->sample_count, ifmt, w, h, depth, GL_TRUE);
                     } else {
                         glTexImage3D(tgt, mip_index, (GLint)ifmt, w, h, depth, 0, fmt, type, data_ptr);
                     }
@@ -11349,17 +12772,18 @@ _SOKOL_PRIVATE void _sg_gl_teximage(const _sg_image_t* img, GLenum tgt, int mip_
 
 _SOKOL_PRIVATE sg_resource_state _sg_gl_create_image(_sg_image_t* img, const sg_image_desc* desc) {
     SOKOL_ASSERT(img && desc);
+    _sg_image_cold_t* cold = _sg_image_cold(img);
     _SG_GL_CHECK_ERROR();
-    img->gl.injected = (0 != desc->gl_textures[0]);
+    cold->gl.injected = (0 != desc->gl_textures[0]);
 
     // check if texture format is support
-    if (!_sg_gl_supported_texture_format(img->cmn.pixel_format)) {
+    if (!_sg_gl_supported_texture_format(cold->pixel_format)) {
         _SG_ERROR(GL_TEXTURE_FORMAT_NOT_SUPPORTED);
         return SG_RESOURCESTATE_FAILED;
     }
 
-    if (img->gl.injected) {
-        img->gl.target = _sg_gl_texture_target(img->cmn.type, img->cmn.sample_count);
+    if (cold->gl.injected) {
+        img->gl.target = _sg_gl_texture_target(cold->type, cold->sample_count);
         // inject externally GL textures
         for (int slot = 0; slot < img->cmn.num_slots; slot++) {
             SOKOL_ASSERT(desc->gl_textures[slot]);
@@ -11371,29 +12795,29 @@ _SOKOL_PRIVATE sg_resource_state _sg_gl_create_image(_sg_image_t* img, const sg_
     } else {
         // on platforms that don't support MSAA texture bindings, no actual GL
         // texture object is created, instead only attachment view object can be built
-        const bool msaa = img->cmn.sample_count > 1;
+        const bool msaa = cold->sample_count > 1;
         if (msaa && !_sg.features.msaa_texture_bindings) {
-            if (img->cmn.usage.color_attachment || img->cmn.usage.depth_stencil_attachment) {
+            if (cold->usage.color_attachment || cold->usage.depth_stencil_attachment) {
                 return SG_RESOURCESTATE_VALID;
             } else {
                 return SG_RESOURCESTATE_FAILED;
             }
         }
-        img->gl.target = _sg_gl_texture_target(img->cmn.type, img->cmn.sample_count);
+        img->gl.target = _sg_gl_texture_target(cold->type, cold->sample_count);
         for (int slot = 0; slot < img->cmn.num_slots; slot++) {
             glGenTextures(1, &img->gl.tex[slot]);
             SOKOL_ASSERT(img->gl.tex[slot]);
             _sg_gl_cache_store_texture_sampler_binding(0);
             _sg_gl_cache_bind_texture_sampler(0, img->gl.target, img->gl.tex[slot], 0);
             _sg_gl_texstorage(img);
-            for (int mip_index = 0; mip_index < img->cmn.num_mipmaps; mip_index++) {
+            for (int mip_index = 0; mip_index < cold->num_mipmaps; mip_index++) {
                 const GLvoid* data_ptr = desc->data.mip_levels[mip_index].ptr;
                 const GLsizei data_size = (GLsizei)desc->data.mip_levels[mip_index].size;
-                const int mip_width = _sg_miplevel_dim(img->cmn.width, mip_index);
-                const int mip_height = _sg_miplevel_dim(img->cmn.height, mip_index);
-                const int mip_depth = (SG_IMAGETYPE_3D == img->cmn.type) ? _sg_miplevel_dim(img->cmn.num_slices, mip_index) : img->cmn.num_slices;
-                if (SG_IMAGETYPE_CUBE == img->cmn.type) {
-                    const int surf_pitch = _sg_surface_pitch(img->cmn.pixel_format, mip_width, mip_height, 1);
+                const int mip_width = _sg_miplevel_dim(cold->width, mip_index);
+                const int mip_height = _sg_miplevel_dim(cold->height, mip_index);
+                const int mip_depth = (SG_IMAGETYPE_3D == cold->type) ? _sg_miplevel_dim(cold->num_slices, mip_index) : cold->num_slices;
+                if (SG_IMAGETYPE_CUBE == cold->type) {
+                    const int surf_pitch = _sg_surface_pitch(cold->pixel_format, mip_width, mip_height, 1);
                     // NOTE: surf_ptr is allowed to be null here
                     const uint8_t* surf_ptr = (const uint8_t*) data_ptr;
                     for (int i = 0; i < 6; i++) {
@@ -11421,7 +12845,7 @@ _SOKOL_PRIVATE void _sg_gl_discard_image(_sg_image_t* img) {
     for (int slot = 0; slot < img->cmn.num_slots; slot++) {
         if (img->gl.tex[slot]) {
             _sg_gl_cache_invalidate_texture_sampler(img->gl.tex[slot], 0);
-            if (!img->gl.injected) {
+            if (!_sg_image_cold(img)->gl.injected) {
                 glDeleteTextures(1, &img->gl.tex[slot]);
             }
         }
@@ -11792,7 +13216,7 @@ _SOKOL_PRIVATE void _sg_gl_fb_attach_texture(const _sg_view_t* view, GLenum gl_a
     SOKOL_ASSERT(gl_target);
     const int mip_level = view->cmn.img.mip_level;
     const int slice = view->cmn.img.slice;
-    switch (img->cmn.type) {
+    switch (_sg_image_cold(img)->type) {
         case SG_IMAGETYPE_2D:
             glFramebufferTexture2D(GL_FRAMEBUFFER, gl_att_type, gl_target, gl_tex, mip_level);
             break;
@@ -11806,7 +13230,7 @@ _SOKOL_PRIVATE void _sg_gl_fb_attach_texture(const _sg_view_t* view, GLenum gl_a
 }
 
 _SOKOL_PRIVATE GLenum _sg_gl_depth_stencil_attachment_type(const _sg_image_t* ds_img) {
-    if (_sg_is_depth_stencil_format(ds_img->cmn.pixel_format)) {
+    if (_sg_is_depth_stencil_format(_sg_image_cold(ds_img)->pixel_format)) {
         return GL_DEPTH_STENCIL_ATTACHMENT;
     } else {
         return GL_DEPTH_ATTACHMENT;
@@ -11852,10 +13276,10 @@ _SOKOL_PRIVATE sg_resource_state _sg_gl_create_view(_sg_view_t* view, const sg_v
             for (int slot = 0; slot < img->cmn.num_slots; slot++) {
                 SOKOL_ASSERT(img->gl.tex[slot] != 0);
                 const GLuint min_level = (GLuint)view->cmn.img.mip_level;
-                const GLuint num_levels = (GLuint)view->cmn.img.mip_level_count;
+                const GLuint num_levels = (GLuint)_sg_view_cold(view)->mip_level_count;
                 const GLuint min_layer = (GLuint)view->cmn.img.slice;
-                const GLuint num_layers = (GLuint)view->cmn.img.slice_count;
-                const GLenum ifmt = _sg_gl_teximage_internal_format(img->cmn.pixel_format);
+                const GLuint num_layers = (GLuint)_sg_view_cold(view)->slice_count;
+                const GLenum ifmt = _sg_gl_teximage_internal_format(_sg_image_cold(img)->pixel_format);
                 glGenTextures(1, &view->gl.tex_view[slot]);
                 glTextureView(view->gl.tex_view[slot], img->gl.target, img->gl.tex[slot], ifmt, min_level, num_levels, min_layer, num_layers);
             }
@@ -11864,12 +13288,12 @@ _SOKOL_PRIVATE sg_resource_state _sg_gl_create_view(_sg_view_t* view, const sg_v
     } else if ((view->cmn.type == SG_VIEWTYPE_COLORATTACHMENT) || (view->cmn.type == SG_VIEWTYPE_DEPTHSTENCILATTACHMENT)) {
         // create MSAA render buffer if MSAA textures are not supported
         const _sg_image_t* img = _sg_image_ref_ptr(&view->cmn.img.ref);
-        const bool msaa = img->cmn.sample_count > 1;
+        const bool msaa = _sg_image_cold(img)->sample_count > 1;
         if (msaa && !_sg.features.msaa_texture_bindings) {
-            const GLenum gl_internal_format = _sg_gl_teximage_internal_format(img->cmn.pixel_format);
+            const GLenum gl_internal_format = _sg_gl_teximage_internal_format(_sg_image_cold(img)->pixel_format);
             glGenRenderbuffers(1, &view->gl.msaa_render_buffer);
             glBindRenderbuffer(GL_RENDERBUFFER, view->gl.msaa_render_buffer);
-            glRenderbufferStorageMultisample(GL_RENDERBUFFER, img->cmn.sample_count, gl_internal_format, img->cmn.width, img->cmn.height);
+            glRenderbufferStorageMultisample(GL_RENDERBUFFER, _sg_image_cold(img)->sample_count, gl_internal_format, _sg_image_cold(img)->width, _sg_image_cold(img)->height);
         }
     } else if (view->cmn.type == SG_VIEWTYPE_RESOLVEATTACHMENT) {
         // store current framebuffer binding (restored at end of block)
@@ -12200,8 +13624,8 @@ _SOKOL_PRIVATE void _sg_gl_end_render_pass(const _sg_attachments_ptrs_t* atts) {
                     fb_read_bound = true;
                 }
                 const _sg_image_t* rsv_img = _sg_image_ref_ptr(&rsv_view->cmn.img.ref);
-                const int w = rsv_img->cmn.width;
-                const int h = rsv_img->cmn.height;
+                const int w = _sg_image_cold(rsv_img)->width;
+                const int h = _sg_image_cold(rsv_img)->height;
                 glBindFramebuffer(GL_DRAW_FRAMEBUFFER, rsv_view->gl.msaa_resolve_frame_buffer);
                 glReadBuffer((GLenum)(GL_COLOR_ATTACHMENT0 + i));
                 glBlitFramebuffer(0, 0, w, h, 0, 0, w, h, GL_COLOR_BUFFER_BIT, GL_NEAREST);
@@ -12753,7 +14177,7 @@ _SOKOL_PRIVATE void _sg_gl_update_buffer(_sg_buffer_t* buf, const sg_range* data
     if (++buf->cmn.active_slot >= buf->cmn.num_slots) {
         buf->cmn.active_slot = 0;
     }
-    GLenum gl_tgt = _sg_gl_buffer_target(&buf->cmn.usage);
+    GLenum gl_tgt = _sg_gl_buffer_target(&_sg_buffer_cold(buf)->usage);
     SOKOL_ASSERT(buf->cmn.active_slot < SG_NUM_INFLIGHT_FRAMES);
     GLuint gl_buf = buf->gl.buf[buf->cmn.active_slot];
     SOKOL_ASSERT(gl_buf);
@@ -12772,20 +14196,70 @@ _SOKOL_PRIVATE void _sg_gl_append_buffer(_sg_buffer_t* buf, const sg_range* data
             buf->cmn.active_slot = 0;
         }
     }
-    GLenum gl_tgt = _sg_gl_buffer_target(&buf->cmn.usage);
+    GLenum gl_tgt = _sg_gl_buffer_target(&_sg_buffer_cold(buf)->usage);
     SOKOL_ASSERT(buf->cmn.active_slot < SG_NUM_INFLIGHT_FRAMES);
     GLuint gl_buf = buf->gl.buf[buf->cmn.active_slot];
     SOKOL_ASSERT(gl_buf);
     _SG_GL_CHECK_ERROR();
     _sg_gl_cache_store_buffer_binding(gl_tgt);
     _sg_gl_cache_bind_buffer(gl_tgt, gl_buf);
-    glBufferSubData(gl_tgt, buf->cmn.append_pos, (GLsizeiptr)data->size, data->ptr);
+    glBufferSubData(gl_tgt, _sg_buffer_cold(buf)->append_pos, (GLsizeiptr)data->size, data->ptr);
     _sg_gl_cache_restore_buffer_binding(gl_tgt);
     _SG_GL_CHECK_ERROR();
 }
 
+// returns a null pointer if no direct mapping is possible, the caller then falls back to staging memory
+_SOKOL_PRIVATE void* _sg_gl_map_buffer(_sg_buffer_t* buf, size_t size) {
+    SOKOL_ASSERT(buf && (size > 0));
+    #if defined(__EMSCRIPTEN__)
+        // WebGL2 has no glMapBufferRange()
+        _SOKOL_UNUSED(buf);
+        _SOKOL_UNUSED(size);
+        return 0;
+    #else
+        // a mapping counts as the one update per buffer per frame
+        int slot = buf->cmn.active_slot + 1;
+        if (slot >= buf->cmn.num_slots) {
+            slot = 0;
+        }
+        GLenum gl_tgt = _sg_gl_buffer_target(&_sg_buffer_cold(buf)->usage);
+        SOKOL_ASSERT(slot < SG_NUM_INFLIGHT_FRAMES);
+        GLuint gl_buf = buf->gl.buf[slot];
+        SOKOL_ASSERT(gl_buf);
+        _SG_GL_CHECK_ERROR();
+        _sg_gl_cache_store_buffer_binding(gl_tgt);
+        _sg_gl_cache_bind_buffer(gl_tgt, gl_buf);
+        void* ptr = glMapBufferRange(gl_tgt, 0, (GLsizeiptr)size, GL_MAP_WRITE_BIT | GL_MAP_INVALIDATE_BUFFER_BIT);
+        _sg_gl_cache_restore_buffer_binding(gl_tgt);
+        _SG_GL_CHECK_ERROR();
+        if (ptr) {
+            buf->cmn.active_slot = slot;
+        }
+        return ptr;
+    #endif
+}
+
+_SOKOL_PRIVATE void _sg_gl_unmap_buffer(_sg_buffer_t* buf, size_t size) {
+    SOKOL_ASSERT(buf);
+    _SOKOL_UNUSED(size);
+    #if defined(__EMSCRIPTEN__)
+        _SOKOL_UNUSED(buf);
+    #else
+        GLenum gl_tgt = _sg_gl_buffer_target(&_sg_buffer_cold(buf)->usage);
+        GLuint gl_buf = buf->gl.buf[buf->cmn.active_slot];
+        SOKOL_ASSERT(gl_buf);
+        _SG_GL_CHECK_ERROR();
+        _sg_gl_cache_store_buffer_binding(gl_tgt);
+        _sg_gl_cache_bind_buffer(gl_tgt, gl_buf);
+        glUnmapBuffer(gl_tgt);
+        _sg_gl_cache_restore_buffer_binding(gl_tgt);
+        _SG_GL_CHECK_ERROR();
+    #endif
+}
+
 _SOKOL_PRIVATE void _sg_gl_update_image(_sg_image_t* img, const sg_image_data* data) {
     SOKOL_ASSERT(img && data);
+    const _sg_image_cold_t* cold = _sg_image_cold(img);
     // only one update per image per frame allowed
     if (++img->cmn.active_slot >= img->cmn.num_slots) {
         img->cmn.active_slot = 0;
@@ -12794,19 +14268,19 @@ _SOKOL_PRIVATE void _sg_gl_update_image(_sg_image_t* img, const sg_image_data* d
     SOKOL_ASSERT(0 != img->gl.tex[img->cmn.active_slot]);
     _sg_gl_cache_store_texture_sampler_binding(0);
     _sg_gl_cache_bind_texture_sampler(0, img->gl.target, img->gl.tex[img->cmn.active_slot], 0);
-    const int num_mips = img->cmn.num_mipmaps;
+    const int num_mips = cold->num_mipmaps;
     for (int mip_index = 0; mip_index < num_mips; mip_index++) {
         const uint8_t* data_ptr = (const uint8_t*)data->mip_levels[mip_index].ptr;
         const size_t data_size = (size_t)data->mip_levels[mip_index].size;
-        const int mip_width = _sg_miplevel_dim(img->cmn.width, mip_index);
-        const int mip_height = _sg_miplevel_dim(img->cmn.height, mip_index);
-        const int mip_depth_or_num_slices = (SG_IMAGETYPE_3D == img->cmn.type) ? _sg_miplevel_dim(img->cmn.num_slices, mip_index) : img->cmn.num_slices;
+        const int mip_width = _sg_miplevel_dim(cold->width, mip_index);
+        const int mip_height = _sg_miplevel_dim(cold->height, mip_index);
+        const int mip_depth_or_num_slices = (SG_IMAGETYPE_3D == cold->type) ? _sg_miplevel_dim(cold->num_slices, mip_index) : cold->num_slices;
         _sg_gl_write_miplevel_data(img,
             data_ptr,
             data_size,
             0,  // src_offset
-            _sg_row_pitch(img->cmn.pixel_format, mip_width, 1),
-            _sg_surface_pitch(img->cmn.pixel_format, mip_width, mip_height, 1),
+            _sg_row_pitch(cold->pixel_format, mip_width, 1),
+            _sg_surface_pitch(cold->pixel_format, mip_width, mip_height, 1),
             mip_index,
             0, 0, 0,    // x, y, slice
             mip_width,
@@ -12816,6 +14290,30 @@ _SOKOL_PRIVATE void _sg_gl_update_image(_sg_image_t* img, const sg_image_data* d
     _sg_gl_cache_restore_texture_sampler_binding(0);
 }
 
+_SOKOL_PRIVATE void _sg_gl_update_image_region(_sg_image_t* img, const sg_write_image_desc* desc) {
+    SOKOL_ASSERT(img && desc);
+    SOKOL_ASSERT(_sg_image_cold(img)->usage.region_update);
+    SOKOL_ASSERT(0 == img->cmn.active_slot);
+    SOKOL_ASSERT(0 != img->gl.tex[0]);
+    // GL takes care of synchronizing with in-flight draws that sample the texture
+    _sg_gl_cache_store_texture_sampler_binding(0);
+    _sg_gl_cache_bind_texture_sampler(0, img->gl.target, img->gl.tex[0], 0);
+    _sg_gl_write_miplevel_data(img,
+        (const uint8_t*)desc->src.data.ptr,
+        desc->src.data.size,
+        desc->src.offset,
+        desc->src.bytes_per_row,
+        desc->src.bytes_per_slice,
+        desc->dst.mip_level,
+        desc->dst.x,
+        desc->dst.y,
+        desc->dst.slice,
+        desc->size.width,
+        desc->size.height,
+        desc->size.num_slices);
+    _sg_gl_cache_restore_texture_sampler_binding(0);
+}
+
 _SOKOL_PRIVATE void _sg_gl_write_buffer_unsealed(_sg_buffer_t* buf, const sg_write_buffer_desc* desc) {
     SOKOL_ASSERT(buf && desc);
     SOKOL_ASSERT(SG_RESOURCESTATE_UNSEALED == buf->slot.state);
@@ -12823,7 +14321,7 @@ _SOKOL_PRIVATE void _sg_gl_write_buffer_unsealed(_sg_buffer_t* buf, const sg_wri
     SOKOL_ASSERT((desc->dst.offset + desc->size) <= (size_t)buf->cmn.size);
     SOKOL_ASSERT((desc->src.offset + desc->size) <= desc->src.data.size);
 
-    const GLenum gl_tgt = _sg_gl_buffer_target(&buf->cmn.usage);
+    const GLenum gl_tgt = _sg_gl_buffer_target(&_sg_buffer_cold(buf)->usage);
     SOKOL_ASSERT(buf->cmn.active_slot == 0);
     const GLuint gl_buf = buf->gl.buf[0];
     SOKOL_ASSERT(gl_buf);
@@ -12859,33 +14357,296 @@ _SOKOL_PRIVATE void _sg_gl_write_image_unsealed(_sg_image_t* img, const sg_write
     _sg_gl_cache_restore_texture_sampler_binding(0);
 }
 
-// ██████  ██████  ██████   ██  ██     ██████   █████   ██████ ██   ██ ███████ ███    ██ ██████
-// ██   ██      ██ ██   ██ ███ ███     ██   ██ ██   ██ ██      ██  ██  ██      ████   ██ ██   ██
-// ██   ██  █████  ██   ██  ██  ██     ██████  ███████ ██      █████   █████   ██ ██  ██ ██   ██
-// ██   ██      ██ ██   ██  ██  ██     ██   ██ ██   ██ ██      ██  ██  ██      ██  ██ ██ ██   ██
-// ██████  ██████  ██████   ██  ██     ██████  ██   ██  ██████ ██   ██ ███████ ██   ████ ██████
-//
-// >>d3d11 backend
-#elif defined(SOKOL_D3D11)
-
-#if defined(__cplusplus)
-#define _sg_d3d11_AddRef(self) (self)->AddRef()
-#else
-#define _sg_d3d11_AddRef(self) (self)->lpVtbl->AddRef(self)
-#endif
+_SOKOL_PRIVATE bool _sg_gl_read_buffer(_sg_readback_t* rb, _sg_buffer_t* buf, const sg_read_buffer_desc* desc) {
+    SOKOL_ASSERT(rb && buf && desc);
+    #if defined(__EMSCRIPTEN__)
+        _SOKOL_UNUSED(rb);
+        _SOKOL_UNUSED(buf);
+        _SOKOL_UNUSED(desc);
+        return false;
+    #else
+        SOKOL_ASSERT(0 == rb->gl.buf);
+        const GLuint gl_src_buf = buf->gl.buf[buf->cmn.active_slot];
+        SOKOL_ASSERT(gl_src_buf);
+        _SG_GL_CHECK_ERROR();
+        #if defined(_SOKOL_GL_HAS_COMPUTE)
+        if (_sg.features.compute && (0 != buf->gl.gpu_dirty_flags)) {
+            glMemoryBarrier(GL_BUFFER_UPDATE_BARRIER_BIT);
+            _sg_stats_inc(gl.num_memory_barriers);
+        }
+        #endif
+        // copy into a staging buffer, the data will be mapped and
+        // copied into the destination memory once the fence has signalled
+        glGenBuffers(1, &rb->gl.buf);
+        glBindBuffer(GL_COPY_READ_BUFFER, gl_src_buf);
+        glBindBuffer(GL_COPY_WRITE_BUFFER, rb->gl.buf);
+        glBufferData(GL_COPY_WRITE_BUFFER, (GLsizeiptr)desc->size, 0, GL_STREAM_READ);
+        glCopyBufferSubData(GL_COPY_READ_BUFFER, GL_COPY_WRITE_BUFFER, (GLintptr)desc->src.offset, 0, (GLsizeiptr)desc->size);
+        glBindBuffer(GL_COPY_WRITE_BUFFER, 0);
+        glBindBuffer(GL_COPY_READ_BUFFER, 0);
+        rb->gl.sync = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+        _SG_GL_CHECK_ERROR();
+        return 0 != rb->gl.sync;
+    #endif
+}
 
-#if defined(__cplusplus)
-#define _sg_d3d11_Release(self) (self)->Release()
-#else
-#define _sg_d3d11_Release(self) (self)->lpVtbl->Release(self)
-#endif
+_SOKOL_PRIVATE bool _sg_gl_read_image(_sg_readback_t* rb, _sg_image_t* img, const sg_read_image_desc* desc) {
+    SOKOL_ASSERT(rb && img && desc);
+    const _sg_image_cold_t* cold = _sg_image_cold(img);
+    #if defined(__EMSCRIPTEN__)
+        _SOKOL_UNUSED(rb);
+        _SOKOL_UNUSED(img);
+        _SOKOL_UNUSED(desc);
+        return false;
+    #else
+        SOKOL_ASSERT(0 == rb->gl.buf);
+        const GLuint gl_tex = img->gl.tex[img->cmn.active_slot];
+        SOKOL_ASSERT(gl_tex);
+        _SG_GL_CHECK_ERROR();
+        #if defined(_SOKOL_GL_HAS_COMPUTE)
+        if (_sg.features.compute && (0 != img->gl.gpu_dirty_flags)) {
+            glMemoryBarrier(GL_PIXEL_BUFFER_BARRIER_BIT | GL_FRAMEBUFFER_BARRIER_BIT);
+            _sg_stats_inc(gl.num_memory_barriers);
+        }
+        #endif
+        // store current framebuffer binding (restored at end of function)
+        GLuint gl_orig_fb;
+        glGetIntegerv(GL_FRAMEBUFFER_BINDING, (GLint*)&gl_orig_fb);
 
-// NOTE: This needs to be a macro since we can't use the polymorphism in C. It's called on many kinds of resources.
-// NOTE: Based on microsoft docs, it's fine to call this with pData=NULL if DataSize is also zero.
-#if defined(__cplusplus)
-#define _sg_d3d11_SetPrivateData(self, guid, DataSize, pData) (self)->SetPrivateData(guid, DataSize, pData)
-#else
-#define _sg_d3d11_SetPrivateData(self, guid, DataSize, pData) (self)->lpVtbl->SetPrivateData(self, guid, DataSize, pData)
+        // read through a temporary framebuffer object instead of
+        // mutating the global offscreen framebuffer
+        GLuint gl_fb = 0;
+        glGenFramebuffers(1, &gl_fb);
+        glBindFramebuffer(GL_FRAMEBUFFER, gl_fb);
+        switch (cold->type) {
+            case SG_IMAGETYPE_2D:
+                glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, img->gl.target, gl_tex, desc->src.mip_level);
+                break;
+            case SG_IMAGETYPE_CUBE:
+                glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, _sg_gl_cubeface_target(desc->src.slice), gl_tex, desc->src.mip_level);
+                break;
+            default:
+                glFramebufferTextureLayer(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, gl_tex, desc->src.mip_level, desc->src.slice);
+                break;
+        }
+        bool result = _sg_gl_check_framebuffer_status();
+        if (result) {
+            // NOTE: GLES3 only guarantees glReadPixels() to work for
+            // a small set of pixel formats (for instance RGBA8)
+            glReadBuffer(GL_COLOR_ATTACHMENT0);
+            glGenBuffers(1, &rb->gl.buf);
+            glBindBuffer(GL_PIXEL_PACK_BUFFER, rb->gl.buf);
+            glBufferData(GL_PIXEL_PACK_BUFFER, (GLsizeiptr)rb->num_bytes, 0, GL_STREAM_READ);
+            glPixelStorei(GL_PACK_ALIGNMENT, 1);
+            glReadPixels(desc->src.x, desc->src.y,
+                desc->size.width, desc->size.height,
+                _sg_gl_teximage_format(cold->pixel_format),
+                _sg_gl_teximage_type(cold->pixel_format),
+                0);
+            glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+            rb->gl.sync = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+            result = 0 != rb->gl.sync;
+        }
+        glBindFramebuffer(GL_FRAMEBUFFER, gl_orig_fb);
+        glDeleteFramebuffers(1, &gl_fb);
+        _SG_GL_CHECK_ERROR();
+        return result;
+    #endif
+}
+
+_SOKOL_PRIVATE sg_readback_state _sg_gl_poll_readback(_sg_readback_t* rb) {
+    SOKOL_ASSERT(rb && rb->dst.ptr);
+    #if defined(__EMSCRIPTEN__)
+        _SOKOL_UNUSED(rb);
+        return SG_READBACKSTATE_FAILED;
+    #else
+        SOKOL_ASSERT(rb->gl.buf && rb->gl.sync);
+        const GLenum wait_res = glClientWaitSync(rb->gl.sync, GL_SYNC_FLUSH_COMMANDS_BIT, 0);
+        if (wait_res == GL_TIMEOUT_EXPIRED) {
+            return SG_READBACKSTATE_PENDING;
+        } else if (wait_res == GL_WAIT_FAILED) {
+            return SG_READBACKSTATE_FAILED;
+        }
+        _SG_GL_CHECK_ERROR();
+        sg_readback_state state = SG_READBACKSTATE_FAILED;
+        glBindBuffer(GL_COPY_WRITE_BUFFER, rb->gl.buf);
+        const void* src_ptr = glMapBufferRange(GL_COPY_WRITE_BUFFER, 0, (GLsizeiptr)rb->num_bytes, GL_MAP_READ_BIT);
+        if (src_ptr) {
+            memcpy((void*)rb->dst.ptr, src_ptr, rb->num_bytes);
+            glUnmapBuffer(GL_COPY_WRITE_BUFFER);
+            state = SG_READBACKSTATE_COMPLETED;
+        }
+        glBindBuffer(GL_COPY_WRITE_BUFFER, 0);
+        _SG_GL_CHECK_ERROR();
+        return state;
+    #endif
+}
+
+_SOKOL_PRIVATE void _sg_gl_discard_readback(_sg_readback_t* rb) {
+    SOKOL_ASSERT(rb);
+    #if defined(__EMSCRIPTEN__)
+        _SOKOL_UNUSED(rb);
+    #else
+        _SG_GL_CHECK_ERROR();
+        if (rb->gl.sync) {
+            glDeleteSync(rb->gl.sync);
+            rb->gl.sync = 0;
+        }
+        if (rb->gl.buf) {
+            glDeleteBuffers(1, &rb->gl.buf);
+            rb->gl.buf = 0;
+        }
+        _SG_GL_CHECK_ERROR();
+    #endif
+}
+
+_SOKOL_PRIVATE void _sg_gl_begin_timer(_sg_timer_frame_t* frame) {
+    SOKOL_ASSERT(frame);
+    #if defined(_SOKOL_GL_HAS_TIMERQUERY)
+        _SG_GL_CHECK_ERROR();
+        // query objects are created on first use and reused in later frames
+        if (0 == frame->gl.queries[0]) {
+            glGenQueries(2, frame->gl.queries);
+        }
+        glQueryCounter(frame->gl.queries[0], GL_TIMESTAMP);
+        _SG_GL_CHECK_ERROR();
+    #else
+        _SOKOL_UNUSED(frame);
+    #endif
+}
+
+_SOKOL_PRIVATE void _sg_gl_end_timer(_sg_timer_frame_t* frame) {
+    SOKOL_ASSERT(frame);
+    #if defined(_SOKOL_GL_HAS_TIMERQUERY)
+        SOKOL_ASSERT(frame->gl.queries[1]);
+        _SG_GL_CHECK_ERROR();
+        glQueryCounter(frame->gl.queries[1], GL_TIMESTAMP);
+        _SG_GL_CHECK_ERROR();
+    #else
+        _SOKOL_UNUSED(frame);
+    #endif
+}
+
+_SOKOL_PRIVATE bool _sg_gl_poll_timer(_sg_timer_frame_t* frame, uint64_t* out_duration_ns) {
+    SOKOL_ASSERT(frame && out_duration_ns);
+    #if defined(_SOKOL_GL_HAS_TIMERQUERY)
+        _SG_GL_CHECK_ERROR();
+        // timestamps are written in order, so the end query being available
+        // means that the begin query is available too
+        GLint available = 0;
+        glGetQueryObjectiv(frame->gl.queries[1], GL_QUERY_RESULT_AVAILABLE, &available);
+        if (!available) {
+            return false;
+        }
+        GLuint64 begin_ns = 0;
+        GLuint64 end_ns = 0;
+        glGetQueryObjectui64v(frame->gl.queries[0], GL_QUERY_RESULT, &begin_ns);
+        glGetQueryObjectui64v(frame->gl.queries[1], GL_QUERY_RESULT, &end_ns);
+        _SG_GL_CHECK_ERROR();
+        *out_duration_ns = (end_ns > begin_ns) ? (uint64_t)(end_ns - begin_ns) : 0;
+        return true;
+    #else
+        _SOKOL_UNUSED(frame);
+        _SOKOL_UNUSED(out_duration_ns);
+        return false;
+    #endif
+}
+
+_SOKOL_PRIVATE GLenum _sg_gl_occlusion_query_target(sg_occlusion_query_type t) {
+    if (t == SG_OCCLUSIONQUERYTYPE_SAMPLES_PASSED) {
+        return GL_SAMPLES_PASSED;
+    } else {
+        return GL_ANY_SAMPLES_PASSED;
+    }
+}
+
+_SOKOL_PRIVATE void _sg_gl_begin_occlusion_query(_sg_occlusion_query_t* query, _sg_occlusion_query_frame_t* frame) {
+    SOKOL_ASSERT(query && frame);
+    _SG_GL_CHECK_ERROR();
+    // query objects are created on first use and reused in later frames
+    if (0 == frame->gl.query) {
+        glGenQueries(1, &frame->gl.query);
+    }
+    glBeginQuery(_sg_gl_occlusion_query_target(query->type), frame->gl.query);
+    _SG_GL_CHECK_ERROR();
+}
+
+_SOKOL_PRIVATE void _sg_gl_end_occlusion_query(_sg_occlusion_query_t* query, _sg_occlusion_query_frame_t* frame) {
+    SOKOL_ASSERT(query && frame);
+    _SOKOL_UNUSED(frame);
+    _SG_GL_CHECK_ERROR();
+    glEndQuery(_sg_gl_occlusion_query_target(query->type));
+    _SG_GL_CHECK_ERROR();
+}
+
+_SOKOL_PRIVATE bool _sg_gl_poll_occlusion_query(_sg_occlusion_query_t* query, _sg_occlusion_query_frame_t* frame, uint64_t* out_num_samples) {
+    SOKOL_ASSERT(query && frame && frame->gl.query && out_num_samples);
+    _SOKOL_UNUSED(query);
+    _SG_GL_CHECK_ERROR();
+    GLuint available = 0;
+    glGetQueryObjectuiv(frame->gl.query, GL_QUERY_RESULT_AVAILABLE, &available);
+    if (!available) {
+        return false;
+    }
+    GLuint num_samples = 0;
+    glGetQueryObjectuiv(frame->gl.query, GL_QUERY_RESULT, &num_samples);
+    _SG_GL_CHECK_ERROR();
+    *out_num_samples = num_samples;
+    return true;
+}
+
+_SOKOL_PRIVATE void _sg_gl_discard_occlusion_query(_sg_occlusion_query_frame_t* frame) {
+    SOKOL_ASSERT(frame);
+    if (frame->gl.query) {
+        _SG_GL_CHECK_ERROR();
+        glDeleteQueries(1, &frame->gl.query);
+        _SG_GL_CHECK_ERROR();
+        frame->gl.query = 0;
+    }
+}
+
+_SOKOL_PRIVATE void _sg_gl_discard_timer(_sg_timer_frame_t* frame) {
+    SOKOL_ASSERT(frame);
+    #if defined(_SOKOL_GL_HAS_TIMERQUERY)
+        if (frame->gl.queries[0]) {
+            _SG_GL_CHECK_ERROR();
+            glDeleteQueries(2, frame->gl.queries);
+            _SG_GL_CHECK_ERROR();
+            frame->gl.queries[0] = 0;
+            frame->gl.queries[1] = 0;
+        }
+    #else
+        _SOKOL_UNUSED(frame);
+    #endif
+}
+
+// ██████  ██████  ██████   ██  ██     ██████   █████   ██████ ██   ██ ███████ ███    ██ ██████
+// ██   ██      ██ ██   ██ ███ ███     ██   ██ ██   ██ ██      ██  ██  ██      ████   ██ ██   ██
+// ██   ██  █████  ██   ██  ██  ██     ██████  ███████ ██      █████   █████   ██ ██  ██ ██   ██
+// ██   ██      ██ ██   ██  ██  ██     ██   ██ ██   ██ ██      ██  ██  ██      ██  ██ ██ ██   ██
+// ██████  ██████  ██████   ██  ██     ██████  ██   ██  ██████ ██   ██ ███████ ██   ████ ██████
+//
+// >>d3d11 backend
+#elif defined(SOKOL_D3D11)
+
+#if defined(__cplusplus)
+#define _sg_d3d11_AddRef(self) (self)->AddRef()
+#else
+#define _sg_d3d11_AddRef(self) (self)->lpVtbl->AddRef(self)
+#endif
+
+#if defined(__cplusplus)
+#define _sg_d3d11_Release(self) (self)->Release()
+#else
+#define _sg_d3d11_Release(self) (self)->lpVtbl->Release(self)
+#endif
+
+// NOTE: This needs to be a macro since we can't use the polymorphism in C. It's called on many kinds of resources.
+// NOTE: Based on microsoft docs, it's fine to call this with pData=NULL if DataSize is also zero.
+#if defined(__cplusplus)
+#define _sg_d3d11_SetPrivateData(self, guid, DataSize, pData) (self)->SetPrivateData(guid, DataSize, pData)
+#else
+#define _sg_d3d11_SetPrivateData(self, guid, DataSize, pData) (self)->lpVtbl->SetPrivateData(self, guid, DataSize, pData)
 #endif
 
 #if defined(__cplusplus)
@@ -13357,6 +15118,9 @@ _SOKOL_PRIVATE D3D11_USAGE _sg_d3d11_image_usage(const sg_image_usage* usg) {
         } else {
             return D3D11_USAGE_IMMUTABLE;
         }
+    } else if (usg->region_update) {
+        // region updates go through UpdateSubresource()
+        return D3D11_USAGE_DEFAULT;
     } else {
         return D3D11_USAGE_DYNAMIC;
     }
@@ -13381,7 +15145,8 @@ _SOKOL_PRIVATE UINT _sg_d3d11_image_cpu_access_flags(const sg_image_usage* usg)
         usg->resolve_attachment ||
         usg->depth_stencil_attachment ||
         usg->storage_image ||
-        usg->immutable)
+        usg->immutable ||
+        usg->region_update)
     {
         return 0;
     } else {
@@ -13828,10 +15593,10 @@ _SOKOL_PRIVATE sg_resource_state _sg_d3d11_create_buffer(_sg_buffer_t* buf, cons
     } else {
         _SG_STRUCT(D3D11_BUFFER_DESC, d3d11_buf_desc);
         d3d11_buf_desc.ByteWidth = (UINT)buf->cmn.size;
-        d3d11_buf_desc.Usage = _sg_d3d11_buffer_usage(&buf->cmn.usage);
-        d3d11_buf_desc.BindFlags = _sg_d3d11_buffer_bind_flags(&buf->cmn.usage);
-        d3d11_buf_desc.CPUAccessFlags = _sg_d3d11_buffer_cpu_access_flags(&buf->cmn.usage);
-        d3d11_buf_desc.MiscFlags = _sg_d3d11_buffer_misc_flags(&buf->cmn.usage);
+        d3d11_buf_desc.Usage = _sg_d3d11_buffer_usage(&_sg_buffer_cold(buf)->usage);
+        d3d11_buf_desc.BindFlags = _sg_d3d11_buffer_bind_flags(&_sg_buffer_cold(buf)->usage);
+        d3d11_buf_desc.CPUAccessFlags = _sg_d3d11_buffer_cpu_access_flags(&_sg_buffer_cold(buf)->usage);
+        d3d11_buf_desc.MiscFlags = _sg_d3d11_buffer_misc_flags(&_sg_buffer_cold(buf)->usage);
         D3D11_SUBRESOURCE_DATA* init_data_ptr = 0;
         _SG_STRUCT(D3D11_SUBRESOURCE_DATA, init_data);
         if (desc->data.ptr) {
@@ -13862,22 +15627,23 @@ _SOKOL_PRIVATE void _sg_d3d11_seal_buffer(_sg_buffer_t* buf) {
 }
 
 _SOKOL_PRIVATE void _sg_d3d11_fill_subres_data(const _sg_image_t* img, const sg_image_data* data) {
-    const int num_slices = (img->cmn.type == SG_IMAGETYPE_3D) ? 1 : img->cmn.num_slices;
+    const _sg_image_cold_t* cold = _sg_image_cold(img);
+    const int num_slices = (cold->type == SG_IMAGETYPE_3D) ? 1 : cold->num_slices;
     int subres_index = 0;
     for (int slice_index = 0; slice_index < num_slices; slice_index++) {
-        for (int mip_index = 0; mip_index < img->cmn.num_mipmaps; mip_index++, subres_index++) {
+        for (int mip_index = 0; mip_index < cold->num_mipmaps; mip_index++, subres_index++) {
             SOKOL_ASSERT(subres_index < _SG_D3D11_MAX_TEXTURE_SUBRESOURCES);
             D3D11_SUBRESOURCE_DATA* subres_data = &_sg.d3d11.subres_data[subres_index];
-            const int mip_width = _sg_miplevel_dim(img->cmn.width, mip_index);
-            const int mip_height = _sg_miplevel_dim(img->cmn.height, mip_index);
+            const int mip_width = _sg_miplevel_dim(cold->width, mip_index);
+            const int mip_height = _sg_miplevel_dim(cold->height, mip_index);
             const sg_range* miplevel_data = &(data->mip_levels[mip_index]);
             const size_t slice_size = miplevel_data->size / (size_t)num_slices;
             const size_t slice_offset = slice_size * (size_t)slice_index;
             const uint8_t* ptr = (const uint8_t*) miplevel_data->ptr;
             subres_data->pSysMem = ptr + slice_offset;
-            subres_data->SysMemPitch = (UINT)_sg_row_pitch(img->cmn.pixel_format, mip_width, 1);
-            if (img->cmn.type == SG_IMAGETYPE_3D) {
-                subres_data->SysMemSlicePitch = (UINT)_sg_surface_pitch(img->cmn.pixel_format, mip_width, mip_height, 1);
+            subres_data->SysMemPitch = (UINT)_sg_row_pitch(cold->pixel_format, mip_width, 1);
+            if (cold->type == SG_IMAGETYPE_3D) {
+                subres_data->SysMemSlicePitch = (UINT)_sg_surface_pitch(cold->pixel_format, mip_width, mip_height, 1);
             } else {
                 subres_data->SysMemSlicePitch = 0;
             }
@@ -13888,13 +15654,14 @@ _SOKOL_PRIVATE void _sg_d3d11_fill_subres_data(const _sg_image_t* img, const sg_
 _SOKOL_PRIVATE sg_resource_state _sg_d3d11_create_image(_sg_image_t* img, const sg_image_desc* desc) {
     SOKOL_ASSERT(img && desc);
     SOKOL_ASSERT((0 == img->d3d11.tex2d) && (0 == img->d3d11.tex3d) && (0 == img->d3d11.res));
+    _sg_image_cold_t* cold = _sg_image_cold(img);
     HRESULT hr;
 
     const bool injected = (0 != desc->d3d11_texture);
-    const bool msaa = (img->cmn.sample_count > 1);
-    SOKOL_ASSERT(!(msaa && (img->cmn.type == SG_IMAGETYPE_CUBE)));
-    img->d3d11.format = _sg_d3d11_texture_pixel_format(img->cmn.pixel_format);
-    if (img->d3d11.format == DXGI_FORMAT_UNKNOWN) {
+    const bool msaa = (cold->sample_count > 1);
+    SOKOL_ASSERT(!(msaa && (cold->type == SG_IMAGETYPE_CUBE)));
+    cold->d3d11.format = _sg_d3d11_texture_pixel_format(cold->pixel_format);
+    if (cold->d3d11.format == DXGI_FORMAT_UNKNOWN) {
         _SG_ERROR(D3D11_CREATE_2D_TEXTURE_UNSUPPORTED_PIXEL_FORMAT);
         return SG_RESOURCESTATE_FAILED;
     }
@@ -13905,7 +15672,7 @@ _SOKOL_PRIVATE sg_resource_state _sg_d3d11_create_image(_sg_image_t* img, const
         _sg_d3d11_fill_subres_data(img, &desc->data);
         init_data = _sg.d3d11.subres_data;
     }
-    if (img->cmn.type != SG_IMAGETYPE_3D) {
+    if (cold->type != SG_IMAGETYPE_3D) {
         // 2D-, cube- or array-texture
         // first check for injected texture and/or resource view
         if (injected) {
@@ -13914,17 +15681,17 @@ _SOKOL_PRIVATE sg_resource_state _sg_d3d11_create_image(_sg_image_t* img, const
         } else {
             // if not injected, create 2D texture
             _SG_STRUCT(D3D11_TEXTURE2D_DESC, d3d11_tex_desc);
-            d3d11_tex_desc.Width = (UINT)img->cmn.width;
-            d3d11_tex_desc.Height = (UINT)img->cmn.height;
-            d3d11_tex_desc.MipLevels = (UINT)img->cmn.num_mipmaps;
-            d3d11_tex_desc.ArraySize = (UINT)img->cmn.num_slices;
-            d3d11_tex_desc.Format = img->d3d11.format;
-            d3d11_tex_desc.BindFlags = _sg_d3d11_image_bind_flags(&img->cmn.usage);
-            d3d11_tex_desc.Usage = _sg_d3d11_image_usage(&img->cmn.usage);
-            d3d11_tex_desc.CPUAccessFlags = _sg_d3d11_image_cpu_access_flags(&img->cmn.usage);
-            d3d11_tex_desc.SampleDesc.Count = (UINT)img->cmn.sample_count;
+            d3d11_tex_desc.Width = (UINT)cold->width;
+            d3d11_tex_desc.Height = (UINT)cold->height;
+            d3d11_tex_desc.MipLevels = (UINT)cold->num_mipmaps;
+            d3d11_tex_desc.ArraySize = (UINT)cold->num_slices;
+            d3d11_tex_desc.Format = cold->d3d11.format;
+            d3d11_tex_desc.BindFlags = _sg_d3d11_image_bind_flags(&cold->usage);
+            d3d11_tex_desc.Usage = _sg_d3d11_image_usage(&cold->usage);
+            d3d11_tex_desc.CPUAccessFlags = _sg_d3d11_image_cpu_access_flags(&cold->usage);
+            d3d11_tex_desc.SampleDesc.Count = (UINT)cold->sample_count;
             d3d11_tex_desc.SampleDesc.Quality = (UINT) (msaa ? D3D11_STANDARD_MULTISAMPLE_PATTERN : 0);
-            d3d11_tex_desc.MiscFlags = (img->cmn.type == SG_IMAGETYPE_CUBE) ? D3D11_RESOURCE_MISC_TEXTURECUBE : 0;
+            d3d11_tex_desc.MiscFlags = (cold->type == SG_IMAGETYPE_CUBE) ? D3D11_RESOURCE_MISC_TEXTURECUBE : 0;
             hr = _sg_d3d11_CreateTexture2D(_sg.d3d11.dev, &d3d11_tex_desc, init_data, &img->d3d11.tex2d);
             if (!(SUCCEEDED(hr) && img->d3d11.tex2d)) {
                 _SG_ERROR(D3D11_CREATE_2D_TEXTURE_FAILED);
@@ -13943,15 +15710,15 @@ _SOKOL_PRIVATE sg_resource_state _sg_d3d11_create_image(_sg_image_t* img, const
         } else {
             // not injected, create 3d texture
             _SG_STRUCT(D3D11_TEXTURE3D_DESC, d3d11_tex_desc);
-            d3d11_tex_desc.Width = (UINT)img->cmn.width;
-            d3d11_tex_desc.Height = (UINT)img->cmn.height;
-            d3d11_tex_desc.Depth = (UINT)img->cmn.num_slices;
-            d3d11_tex_desc.MipLevels = (UINT)img->cmn.num_mipmaps;
-            d3d11_tex_desc.Format = img->d3d11.format;
-            d3d11_tex_desc.BindFlags = _sg_d3d11_image_bind_flags(&img->cmn.usage);
-            d3d11_tex_desc.Usage = _sg_d3d11_image_usage(&img->cmn.usage);
-            d3d11_tex_desc.CPUAccessFlags = _sg_d3d11_image_cpu_access_flags(&img->cmn.usage);
-            if (img->d3d11.format == DXGI_FORMAT_UNKNOWN) {
+            d3d11_tex_desc.Width = (UINT)cold->width;
+            d3d11_tex_desc.Height = (UINT)cold->height;
+            d3d11_tex_desc.Depth = (UINT)cold->num_slices;
+            d3d11_tex_desc.MipLevels = (UINT)cold->num_mipmaps;
+            d3d11_tex_desc.Format = cold->d3d11.format;
+            d3d11_tex_desc.BindFlags = _sg_d3d11_image_bind_flags(&cold->usage);
+            d3d11_tex_desc.Usage = _sg_d3d11_image_usage(&cold->usage);
+            d3d11_tex_desc.CPUAccessFlags = _sg_d3d11_image_cpu_access_flags(&cold->usage);
+            if (cold->d3d11.format == DXGI_FORMAT_UNKNOWN) {
                 _SG_ERROR(D3D11_CREATE_3D_TEXTURE_UNSUPPORTED_PIXEL_FORMAT);
                 return SG_RESOURCESTATE_FAILED;
             }
@@ -14497,6 +16264,7 @@ _SOKOL_PRIVATE void _sg_d3d11_discard_pipeline(_sg_pipeline_t* pip) {
 _SOKOL_PRIVATE sg_resource_state _sg_d3d11_create_view(_sg_view_t* view, const sg_view_desc* desc) {
     SOKOL_ASSERT(view && desc);
     _SOKOL_UNUSED(desc);
+    const _sg_view_cold_t* cold = _sg_view_cold(view);
     HRESULT hr;
     if (view->cmn.type == SG_VIEWTYPE_STORAGEBUFFER) {
         const _sg_buffer_t* buf = _sg_buffer_ref_ptr(&view->cmn.buf.ref);
@@ -14521,7 +16289,7 @@ _SOKOL_PRIVATE sg_resource_state _sg_d3d11_create_view(_sg_view_t* view, const s
             return SG_RESOURCESTATE_FAILED;
         }
         _sg_d3d11_setlabel(view->d3d11.srv, desc->label);
-        if (buf->cmn.usage.immutable) {
+        if (_sg_buffer_cold(buf)->usage.immutable) {
             _SG_STRUCT(D3D11_UNORDERED_ACCESS_VIEW_DESC, d3d11_uav_desc);
             d3d11_uav_desc.Format = DXGI_FORMAT_R32_TYPELESS;
             d3d11_uav_desc.ViewDimension = D3D11_UAV_DIMENSION_BUFFER;
@@ -14540,19 +16308,19 @@ _SOKOL_PRIVATE sg_resource_state _sg_d3d11_create_view(_sg_view_t* view, const s
         // it's an image view
         const _sg_image_t* img = _sg_image_ref_ptr(&view->cmn.img.ref);
         SOKOL_ASSERT(img->d3d11.res);
-        const bool msaa = img->cmn.sample_count > 1;
-        SOKOL_ASSERT(view->cmn.img.mip_level_count >= 1);
-        SOKOL_ASSERT(view->cmn.img.slice_count >= 1);
+        const bool msaa = _sg_image_cold(img)->sample_count > 1;
+        SOKOL_ASSERT(cold->mip_level_count >= 1);
+        SOKOL_ASSERT(cold->slice_count >= 1);
         const UINT mip_level = (UINT)view->cmn.img.mip_level;
-        const UINT mip_count = (UINT)view->cmn.img.mip_level_count;
+        const UINT mip_count = (UINT)cold->mip_level_count;
         const UINT slice = (UINT)view->cmn.img.slice;
-        const UINT slice_count = (UINT)view->cmn.img.slice_count;
+        const UINT slice_count = (UINT)cold->slice_count;
 
         if (view->cmn.type == SG_VIEWTYPE_STORAGEIMAGE) {
             SOKOL_ASSERT(!msaa);
             _SG_STRUCT(D3D11_UNORDERED_ACCESS_VIEW_DESC, d3d11_uav_desc);
-            d3d11_uav_desc.Format = _sg_d3d11_rtv_uav_pixel_format(img->cmn.pixel_format);
-            switch (img->cmn.type) {
+            d3d11_uav_desc.Format = _sg_d3d11_rtv_uav_pixel_format(_sg_image_cold(img)->pixel_format);
+            switch (_sg_image_cold(img)->type) {
                 case SG_IMAGETYPE_2D:
                     d3d11_uav_desc.ViewDimension = D3D11_UAV_DIMENSION_TEXTURE2D;
                     d3d11_uav_desc.Texture2D.MipSlice = mip_level;
@@ -14582,8 +16350,8 @@ _SOKOL_PRIVATE sg_resource_state _sg_d3d11_create_view(_sg_view_t* view, const s
         } else if (view->cmn.type == SG_VIEWTYPE_TEXTURE) {
 
             _SG_STRUCT(D3D11_SHADER_RESOURCE_VIEW_DESC, d3d11_srv_desc);
-            d3d11_srv_desc.Format = _sg_d3d11_srv_pixel_format(img->cmn.pixel_format);
-            switch (img->cmn.type) {
+            d3d11_srv_desc.Format = _sg_d3d11_srv_pixel_format(_sg_image_cold(img)->pixel_format);
+            switch (_sg_image_cold(img)->type) {
                 case SG_IMAGETYPE_2D:
                     if (msaa) {
                         d3d11_srv_desc.ViewDimension = D3D11_SRV_DIMENSION_TEXTURE2DMS;
@@ -14632,8 +16400,8 @@ _SOKOL_PRIVATE sg_resource_state _sg_d3d11_create_view(_sg_view_t* view, const s
         } else if (view->cmn.type == SG_VIEWTYPE_COLORATTACHMENT) {
 
             _SG_STRUCT(D3D11_RENDER_TARGET_VIEW_DESC, d3d11_rtv_desc);
-            d3d11_rtv_desc.Format = _sg_d3d11_rtv_uav_pixel_format(img->cmn.pixel_format);
-            switch (img->cmn.type) {
+            d3d11_rtv_desc.Format = _sg_d3d11_rtv_uav_pixel_format(_sg_image_cold(img)->pixel_format);
+            switch (_sg_image_cold(img)->type) {
                 case SG_IMAGETYPE_2D:
                     if (msaa) {
                         d3d11_rtv_desc.ViewDimension = D3D11_RTV_DIMENSION_TEXTURE2DMS;
@@ -14673,10 +16441,10 @@ _SOKOL_PRIVATE sg_resource_state _sg_d3d11_create_view(_sg_view_t* view, const s
 
         } else if (view->cmn.type == SG_VIEWTYPE_DEPTHSTENCILATTACHMENT) {
 
-            SOKOL_ASSERT(img->cmn.type != SG_IMAGETYPE_3D);
+            SOKOL_ASSERT(_sg_image_cold(img)->type != SG_IMAGETYPE_3D);
             _SG_STRUCT(D3D11_DEPTH_STENCIL_VIEW_DESC, d3d11_dsv_desc);
-            d3d11_dsv_desc.Format = _sg_d3d11_dsv_pixel_format(img->cmn.pixel_format);
-            switch (img->cmn.type) {
+            d3d11_dsv_desc.Format = _sg_d3d11_dsv_pixel_format(_sg_image_cold(img)->pixel_format);
+            switch (_sg_image_cold(img)->type) {
                 case SG_IMAGETYPE_2D:
                     if (msaa) {
                         d3d11_dsv_desc.ViewDimension = D3D11_DSV_DIMENSION_TEXTURE2DMS;
@@ -14817,22 +16585,22 @@ _SOKOL_PRIVATE void _sg_d3d11_end_pass(const _sg_attachments_ptrs_t* atts) {
                     const _sg_view_t* color_view = atts->color_views[i];
                     SOKOL_ASSERT(color_view);
                     const _sg_image_t* color_img = _sg_image_ref_ptr(&color_view->cmn.img.ref);
-                    SOKOL_ASSERT(color_img->cmn.sample_count > 1);
-                    SOKOL_ASSERT(resolve_img->cmn.sample_count == 1);
+                    SOKOL_ASSERT(_sg_image_cold(color_img)->sample_count > 1);
+                    SOKOL_ASSERT(_sg_image_cold(resolve_img)->sample_count == 1);
                     const UINT src_subres = _sg_d3d11_calcsubresource(
                         (UINT)color_view->cmn.img.mip_level,
                         (UINT)color_view->cmn.img.slice,
-                        (UINT)color_img->cmn.num_mipmaps);
+                        (UINT)_sg_image_cold(color_img)->num_mipmaps);
                     const UINT dst_subres = _sg_d3d11_calcsubresource(
                         (UINT)resolve_view->cmn.img.mip_level,
                         (UINT)resolve_view->cmn.img.slice,
-                        (UINT)resolve_img->cmn.num_mipmaps);
+                        (UINT)_sg_image_cold(resolve_img)->num_mipmaps);
                     _sg_d3d11_ResolveSubresource(_sg.d3d11.ctx,
                         resolve_img->d3d11.res,
                         dst_subres,
                         color_img->d3d11.res,
                         src_subres,
-                        _sg_d3d11_rtv_uav_pixel_format(color_img->cmn.pixel_format));
+                        _sg_d3d11_rtv_uav_pixel_format(_sg_image_cold(color_img)->pixel_format));
                     _sg_stats_inc(d3d11.pass.num_resolve_subresource);
                 }
             }
@@ -15124,6 +16892,32 @@ _SOKOL_PRIVATE void _sg_d3d11_update_buffer(_sg_buffer_t* buf, const sg_range* d
     }
 }
 
+// returns a null pointer if mapping failed, the caller then falls back to staging memory
+_SOKOL_PRIVATE void* _sg_d3d11_map_buffer(_sg_buffer_t* buf, size_t size) {
+    SOKOL_ASSERT(buf && (size > 0));
+    SOKOL_ASSERT(_sg.d3d11.ctx);
+    SOKOL_ASSERT(buf->d3d11.buf);
+    _SOKOL_UNUSED(size);
+    D3D11_MAPPED_SUBRESOURCE d3d11_msr;
+    HRESULT hr = _sg_d3d11_Map(_sg.d3d11.ctx, (ID3D11Resource*)buf->d3d11.buf, 0, D3D11_MAP_WRITE_DISCARD, 0, &d3d11_msr);
+    _sg_stats_inc(d3d11.num_map);
+    if (SUCCEEDED(hr)) {
+        return d3d11_msr.pData;
+    } else {
+        _SG_ERROR(D3D11_MAP_FOR_UPDATE_BUFFER_FAILED);
+        return 0;
+    }
+}
+
+_SOKOL_PRIVATE void _sg_d3d11_unmap_buffer(_sg_buffer_t* buf, size_t size) {
+    SOKOL_ASSERT(buf);
+    SOKOL_ASSERT(_sg.d3d11.ctx);
+    SOKOL_ASSERT(buf->d3d11.buf);
+    _SOKOL_UNUSED(size);
+    _sg_d3d11_Unmap(_sg.d3d11.ctx, (ID3D11Resource*)buf->d3d11.buf, 0);
+    _sg_stats_inc(d3d11.num_unmap);
+}
+
 _SOKOL_PRIVATE void _sg_d3d11_append_buffer(_sg_buffer_t* buf, const sg_range* data, bool new_frame) {
     SOKOL_ASSERT(buf && data && data->ptr && (data->size > 0));
     SOKOL_ASSERT(_sg.d3d11.ctx);
@@ -15133,7 +16927,7 @@ _SOKOL_PRIVATE void _sg_d3d11_append_buffer(_sg_buffer_t* buf, const sg_range* d
     HRESULT hr = _sg_d3d11_Map(_sg.d3d11.ctx, (ID3D11Resource*)buf->d3d11.buf, 0, map_type, 0, &d3d11_msr);
     _sg_stats_inc(d3d11.num_map);
     if (SUCCEEDED(hr)) {
-        uint8_t* dst_ptr = (uint8_t*)d3d11_msr.pData + buf->cmn.append_pos;
+        uint8_t* dst_ptr = (uint8_t*)d3d11_msr.pData + _sg_buffer_cold(buf)->append_pos;
         memcpy(dst_ptr, data->ptr, data->size);
         _sg_d3d11_Unmap(_sg.d3d11.ctx, (ID3D11Resource*)buf->d3d11.buf, 0);
         _sg_stats_inc(d3d11.num_unmap);
@@ -15148,18 +16942,19 @@ _SOKOL_PRIVATE void _sg_d3d11_update_image(_sg_image_t* img, const sg_image_data
     SOKOL_ASSERT(img && data);
     SOKOL_ASSERT(_sg.d3d11.ctx);
     SOKOL_ASSERT(img->d3d11.res);
-    const int num_slices = (img->cmn.type == SG_IMAGETYPE_3D) ? 1 : img->cmn.num_slices;
-    const int num_depth_slices = (img->cmn.type == SG_IMAGETYPE_3D) ? img->cmn.num_slices : 1;
+    const _sg_image_cold_t* cold = _sg_image_cold(img);
+    const int num_slices = (cold->type == SG_IMAGETYPE_3D) ? 1 : cold->num_slices;
+    const int num_depth_slices = (cold->type == SG_IMAGETYPE_3D) ? cold->num_slices : 1;
     UINT subres_index = 0;
     HRESULT hr;
     D3D11_MAPPED_SUBRESOURCE d3d11_msr;
     for (int slice_index = 0; slice_index < num_slices; slice_index++) {
-        for (int mip_index = 0; mip_index < img->cmn.num_mipmaps; mip_index++, subres_index++) {
+        for (int mip_index = 0; mip_index < cold->num_mipmaps; mip_index++, subres_index++) {
             SOKOL_ASSERT(subres_index < _SG_D3D11_MAX_TEXTURE_SUBRESOURCES);
-            const int mip_width = _sg_miplevel_dim(img->cmn.width, mip_index);
-            const int mip_height = _sg_miplevel_dim(img->cmn.height, mip_index);
-            const int src_row_pitch = _sg_row_pitch(img->cmn.pixel_format, mip_width, 1);
-            const int src_depth_pitch = _sg_surface_pitch(img->cmn.pixel_format, mip_width, mip_height, 1);
+            const int mip_width = _sg_miplevel_dim(cold->width, mip_index);
+            const int mip_height = _sg_miplevel_dim(cold->height, mip_index);
+            const int src_row_pitch = _sg_row_pitch(cold->pixel_format, mip_width, 1);
+            const int src_depth_pitch = _sg_surface_pitch(cold->pixel_format, mip_width, mip_height, 1);
             const sg_range* miplevel_data = &(data->mip_levels[mip_index]);
             const size_t slice_size = miplevel_data->size / (size_t)num_slices;
             SOKOL_ASSERT(slice_size == (size_t)(src_depth_pitch * num_depth_slices));
@@ -15218,15 +17013,15 @@ _SOKOL_PRIVATE void _sg_d3d11_write_miplevel_data(const _sg_image_t* img,
     SOKOL_ASSERT(src_size > 0);
     SOKOL_ASSERT(src_bytes_per_row > 0);
     SOKOL_ASSERT(src_bytes_per_slice > 0);
-    SOKOL_ASSERT((mip_level >= 0) && (mip_level < img->cmn.num_mipmaps));
-    SOKOL_ASSERT((x >= 0) && (x < _sg_miplevel_dim(img->cmn.width, mip_level)));
-    SOKOL_ASSERT((y >= 0) && (y < _sg_miplevel_dim(img->cmn.height, mip_level)));
-    SOKOL_ASSERT((slice >= 0) && (slice < img->cmn.num_slices));
-    SOKOL_ASSERT((width > 0) && (x + width <= _sg_miplevel_dim(img->cmn.width, mip_level)));
-    SOKOL_ASSERT((height > 0) && (y + height <= _sg_miplevel_dim(img->cmn.height, mip_level)));
-    SOKOL_ASSERT((num_slices > 0) && (slice + num_slices <= img->cmn.num_slices));
+    SOKOL_ASSERT((mip_level >= 0) && (mip_level < _sg_image_cold(img)->num_mipmaps));
+    SOKOL_ASSERT((x >= 0) && (x < _sg_miplevel_dim(_sg_image_cold(img)->width, mip_level)));
+    SOKOL_ASSERT((y >= 0) && (y < _sg_miplevel_dim(_sg_image_cold(img)->height, mip_level)));
+    SOKOL_ASSERT((slice >= 0) && (slice < _sg_image_cold(img)->num_slices));
+    SOKOL_ASSERT((width > 0) && (x + width <= _sg_miplevel_dim(_sg_image_cold(img)->width, mip_level)));
+    SOKOL_ASSERT((height > 0) && (y + height <= _sg_miplevel_dim(_sg_image_cold(img)->height, mip_level)));
+    SOKOL_ASSERT((num_slices > 0) && (slice + num_slices <= _sg_image_cold(img)->num_slices));
     SOKOL_ASSERT((src_offset + src_bytes_per_slice * (size_t)num_slices) <= src_size);
-    SOKOL_ASSERT(_sg_multiple(src_bytes_per_row, _sg_block_bytesize(img->cmn.pixel_format)));
+    SOKOL_ASSERT(_sg_multiple(src_bytes_per_row, _sg_block_bytesize(_sg_image_cold(img)->pixel_format)));
     SOKOL_ASSERT(_sg_multiple(src_bytes_per_slice, src_bytes_per_row));
     _SOKOL_UNUSED(src_size);
 
@@ -15239,7 +17034,7 @@ _SOKOL_PRIVATE void _sg_d3d11_write_miplevel_data(const _sg_image_t* img,
     d3d11_dst_box.right = (UINT)(x + width);
     d3d11_dst_box.top = (UINT)y;
     d3d11_dst_box.bottom = (UINT)(y + height);
-    if (img->cmn.type == SG_IMAGETYPE_3D) {
+    if (_sg_image_cold(img)->type == SG_IMAGETYPE_3D) {
         d3d11_slice = 0;
         d3d11_num_slices = 1;
         d3d11_dst_box.front = (UINT)slice;
@@ -15254,7 +17049,7 @@ _SOKOL_PRIVATE void _sg_d3d11_write_miplevel_data(const _sg_image_t* img,
     }
     for (int i = 0; i < d3d11_num_slices; i++) {
         const void* d3d11_src_ptr = (void*)(src_ptr + src_offset + i * src_bytes_per_slice);
-        const UINT d3d11_subres = _sg_d3d11_calcsubresource((UINT)mip_level, (UINT)(d3d11_slice + i), (UINT)img->cmn.num_mipmaps);
+        const UINT d3d11_subres = _sg_d3d11_calcsubresource((UINT)mip_level, (UINT)(d3d11_slice + i), (UINT)_sg_image_cold(img)->num_mipmaps);
         _sg_d3d11_UpdateSubresource(_sg.d3d11.ctx,
             d3d11_res,
             d3d11_subres,
@@ -15265,6 +17060,25 @@ _SOKOL_PRIVATE void _sg_d3d11_write_miplevel_data(const _sg_image_t* img,
     }
 }
 
+_SOKOL_PRIVATE void _sg_d3d11_update_image_region(_sg_image_t* img, const sg_write_image_desc* desc) {
+    SOKOL_ASSERT(img && desc);
+    SOKOL_ASSERT(_sg_image_cold(img)->usage.region_update);
+    // region-update images are D3D11_USAGE_DEFAULT, UpdateSubresource() is synchronized by the driver
+    _sg_d3d11_write_miplevel_data(img, img->d3d11.res,
+        (const uint8_t*)desc->src.data.ptr,
+        desc->src.data.size,
+        desc->src.offset,
+        desc->src.bytes_per_row,
+        desc->src.bytes_per_slice,
+        desc->dst.mip_level,
+        desc->dst.x,
+        desc->dst.y,
+        desc->dst.slice,
+        desc->size.width,
+        desc->size.height,
+        desc->size.num_slices);
+}
+
 _SOKOL_PRIVATE void _sg_d3d11_write_buffer_unsealed(_sg_buffer_t* buf, const sg_write_buffer_desc* desc) {
     SOKOL_ASSERT(_sg.d3d11.ctx);
     SOKOL_ASSERT(buf && desc);
@@ -16023,6 +17837,19 @@ _SOKOL_PRIVATE void _sg_mtl_init_caps(void) {
 }
 
 //-- main Metal backend state and functions ------------------------------------
+_SOKOL_PRIVATE void _sg_mtl_create_uniform_buffers(void) {
+    for (int i = 0; i < SG_NUM_INFLIGHT_FRAMES; i++) {
+        SOKOL_ASSERT(nil == _sg.mtl.uniform_buffers[i]);
+        _sg.mtl.uniform_buffers[i] = [_sg.mtl.device
+            newBufferWithLength:(NSUInteger)_sg.mtl.ub_size
+            options:MTLResourceCPUCacheModeWriteCombined|MTLResourceStorageModeShared
+        ];
+        #if defined(SOKOL_DEBUG)
+            _sg.mtl.uniform_buffers[i].label = [NSString stringWithFormat:@"sg-uniform-buffer.%d", i];
+        #endif
+    }
+}
+
 _SOKOL_PRIVATE void _sg_mtl_setup_backend(const sg_desc* desc) {
     // assume already zero-initialized
     SOKOL_ASSERT(desc);
@@ -16035,16 +17862,7 @@ _SOKOL_PRIVATE void _sg_mtl_setup_backend(const sg_desc* desc) {
     _sg.mtl.sem = dispatch_semaphore_create(SG_NUM_INFLIGHT_FRAMES);
     _sg.mtl.device = (__bridge id<MTLDevice>) desc->environment.metal.device;
     _sg.mtl.cmd_queue = [_sg.mtl.device newCommandQueue];
-
-    for (int i = 0; i < SG_NUM_INFLIGHT_FRAMES; i++) {
-        _sg.mtl.uniform_buffers[i] = [_sg.mtl.device
-            newBufferWithLength:(NSUInteger)_sg.mtl.ub_size
-            options:MTLResourceCPUCacheModeWriteCombined|MTLResourceStorageModeShared
-        ];
-        #if defined(SOKOL_DEBUG)
-            _sg.mtl.uniform_buffers[i].label = [NSString stringWithFormat:@"sg-uniform-buffer.%d", i];
-        #endif
-    }
+    _sg_mtl_create_uniform_buffers();
 
     if (desc->metal.force_managed_storage_mode) {
         _sg.mtl.use_shared_storage_mode = false;
@@ -16093,6 +17911,23 @@ _SOKOL_PRIVATE void _sg_mtl_discard_backend(void) {
     _sg.mtl.compute_cmd_encoder = nil;
 }
 
+// called from sg_commit() after the frame's command buffer has been committed
+_SOKOL_PRIVATE void _sg_mtl_grow_uniform_buffer(uint32_t size) {
+    SOKOL_ASSERT(nil == _sg.mtl.cmd_buffer);
+    // wait until the GPU no longer reads from any of the uniform buffers
+    for (int i = 0; i < SG_NUM_INFLIGHT_FRAMES; i++) {
+        dispatch_semaphore_wait(_sg.mtl.sem, DISPATCH_TIME_FOREVER);
+    }
+    for (int i = 0; i < SG_NUM_INFLIGHT_FRAMES; i++) {
+        dispatch_semaphore_signal(_sg.mtl.sem);
+    }
+    for (int i = 0; i < SG_NUM_INFLIGHT_FRAMES; i++) {
+        _SG_OBJC_RELEASE(_sg.mtl.uniform_buffers[i]);
+    }
+    _sg.mtl.ub_size = (int)size;
+    _sg_mtl_create_uniform_buffers();
+}
+
 _SOKOL_PRIVATE void _sg_mtl_reset_state_cache(void) {
     _sg_mtl_clear_state_cache();
 }
@@ -16101,7 +17936,7 @@ _SOKOL_PRIVATE sg_resource_state _sg_mtl_create_buffer(_sg_buffer_t* buf, const
     SOKOL_ASSERT(buf && desc);
     SOKOL_ASSERT(buf->cmn.size > 0);
     const bool injected = (0 != desc->mtl_buffers[0]);
-    MTLResourceOptions mtl_options = _sg_mtl_buffer_resource_options(&buf->cmn.usage);
+    MTLResourceOptions mtl_options = _sg_mtl_buffer_resource_options(&_sg_buffer_cold(buf)->usage);
     for (int slot = 0; slot < buf->cmn.num_slots; slot++) {
         id<MTLBuffer> mtl_buf;
         if (injected) {
@@ -16171,15 +18006,15 @@ _SOKOL_PRIVATE void _sg_mtl_write_miplevel_data(const _sg_image_t* img,
     SOKOL_ASSERT(src_size > 0);
     SOKOL_ASSERT(src_bytes_per_row > 0);
     SOKOL_ASSERT(src_bytes_per_slice > 0);
-    SOKOL_ASSERT((mip_level >= 0) && (mip_level < img->cmn.num_mipmaps));
-    SOKOL_ASSERT((x >= 0) && (x < _sg_miplevel_dim(img->cmn.width, mip_level)));
-    SOKOL_ASSERT((y >= 0) && (y < _sg_miplevel_dim(img->cmn.height, mip_level)));
-    SOKOL_ASSERT((slice >= 0) && (slice < img->cmn.num_slices));
-    SOKOL_ASSERT((width > 0) && (x + width <= _sg_miplevel_dim(img->cmn.width, mip_level)));
-    SOKOL_ASSERT((height > 0) && (y + height <= _sg_miplevel_dim(img->cmn.height, mip_level)));
-    SOKOL_ASSERT((num_slices > 0) && (slice + num_slices <= img->cmn.num_slices));
+    SOKOL_ASSERT((mip_level >= 0) && (mip_level < _sg_image_cold(img)->num_mipmaps));
+    SOKOL_ASSERT((x >= 0) && (x < _sg_miplevel_dim(_sg_image_cold(img)->width, mip_level)));
+    SOKOL_ASSERT((y >= 0) && (y < _sg_miplevel_dim(_sg_image_cold(img)->height, mip_level)));
+    SOKOL_ASSERT((slice >= 0) && (slice < _sg_image_cold(img)->num_slices));
+    SOKOL_ASSERT((width > 0) && (x + width <= _sg_miplevel_dim(_sg_image_cold(img)->width, mip_level)));
+    SOKOL_ASSERT((height > 0) && (y + height <= _sg_miplevel_dim(_sg_image_cold(img)->height, mip_level)));
+    SOKOL_ASSERT((num_slices > 0) && (slice + num_slices <= _sg_image_cold(img)->num_slices));
     SOKOL_ASSERT((src_offset + (size_t)src_bytes_per_slice * (size_t)num_slices) <= src_size);
-    SOKOL_ASSERT(_sg_multiple(src_bytes_per_row, _sg_block_bytesize(img->cmn.pixel_format)));
+    SOKOL_ASSERT(_sg_multiple(src_bytes_per_row, _sg_block_bytesize(_sg_image_cold(img)->pixel_format)));
     SOKOL_ASSERT(_sg_multiple(src_bytes_per_slice, src_bytes_per_row));
     _SOKOL_UNUSED(src_size);
 
@@ -16189,15 +18024,15 @@ _SOKOL_PRIVATE void _sg_mtl_write_miplevel_data(const _sg_image_t* img,
     */
     MTLRegion mtl_region;
     int mtl_bytes_per_image;
-    if (img->cmn.type == SG_IMAGETYPE_3D) {
+    if (_sg_image_cold(img)->type == SG_IMAGETYPE_3D) {
         mtl_region = MTLRegionMake3D((NSUInteger)x, (NSUInteger)y, (NSUInteger)slice, (NSUInteger)width, (NSUInteger)height, (NSUInteger)num_slices);
         mtl_bytes_per_image = src_bytes_per_slice;
     } else {
         mtl_region = MTLRegionMake2D((NSUInteger)x, (NSUInteger)y, (NSUInteger)width, (NSUInteger)height);
         mtl_bytes_per_image = 0;
     }
-    const int mtl_slice_index = (img->cmn.type == SG_IMAGETYPE_3D) ? 0 : slice;
-    const int mtl_num_slices = (img->cmn.type == SG_IMAGETYPE_3D) ? 1 : num_slices;
+    const int mtl_slice_index = (_sg_image_cold(img)->type == SG_IMAGETYPE_3D) ? 0 : slice;
+    const int mtl_num_slices = (_sg_image_cold(img)->type == SG_IMAGETYPE_3D) ? 1 : num_slices;
     for (int i = 0; i < mtl_num_slices; i++) {
         const size_t offset = src_offset + (size_t)(i * src_bytes_per_slice);
         SOKOL_ASSERT((offset + (size_t)src_bytes_per_slice) <= src_size);
@@ -16211,14 +18046,15 @@ _SOKOL_PRIVATE void _sg_mtl_write_miplevel_data(const _sg_image_t* img,
 }
 
 _SOKOL_PRIVATE void _sg_mtl_copy_image_data(const _sg_image_t* img, __unsafe_unretained id<MTLTexture> mtl_tex, const sg_image_data* data) {
-    for (int mip_level = 0; mip_level < img->cmn.num_mipmaps; mip_level++) {
+    const _sg_image_cold_t* cold = _sg_image_cold(img);
+    for (int mip_level = 0; mip_level < cold->num_mipmaps; mip_level++) {
         SOKOL_ASSERT(data->mip_levels[mip_level].ptr);
         SOKOL_ASSERT(data->mip_levels[mip_level].size > 0);
-        const int mip_width = _sg_miplevel_dim(img->cmn.width, mip_level);
-        const int mip_height = _sg_miplevel_dim(img->cmn.height, mip_level);
-        const int mip_depth_or_slices = (SG_IMAGETYPE_3D == img->cmn.type) ? _sg_miplevel_dim(img->cmn.num_slices, mip_level) : img->cmn.num_slices;
-        const int bytes_per_row = _sg_row_pitch(img->cmn.pixel_format, mip_width, 1);
-        const int bytes_per_slice = _sg_surface_pitch(img->cmn.pixel_format, mip_width, mip_height, 1);
+        const int mip_width = _sg_miplevel_dim(cold->width, mip_level);
+        const int mip_height = _sg_miplevel_dim(cold->height, mip_level);
+        const int mip_depth_or_slices = (SG_IMAGETYPE_3D == cold->type) ? _sg_miplevel_dim(cold->num_slices, mip_level) : cold->num_slices;
+        const int bytes_per_row = _sg_row_pitch(cold->pixel_format, mip_width, 1);
+        const int bytes_per_slice = _sg_surface_pitch(cold->pixel_format, mip_width, mip_height, 1);
         _sg_mtl_write_miplevel_data(img, mtl_tex,
             (const uint8_t*)data->mip_levels[mip_level].ptr,
             data->mip_levels[mip_level].size,
@@ -16236,44 +18072,45 @@ _SOKOL_PRIVATE void _sg_mtl_copy_image_data(const _sg_image_t* img, __unsafe_unr
 }
 
 _SOKOL_PRIVATE bool _sg_mtl_init_texdesc(MTLTextureDescriptor* mtl_desc, _sg_image_t* img) {
-    mtl_desc.textureType = _sg_mtl_texture_type(img->cmn.type, img->cmn.sample_count > 1);
-    mtl_desc.pixelFormat = _sg_mtl_pixel_format(img->cmn.pixel_format);
+    const _sg_image_cold_t* cold = _sg_image_cold(img);
+    mtl_desc.textureType = _sg_mtl_texture_type(cold->type, cold->sample_count > 1);
+    mtl_desc.pixelFormat = _sg_mtl_pixel_format(cold->pixel_format);
     if (MTLPixelFormatInvalid == mtl_desc.pixelFormat) {
         _SG_ERROR(METAL_TEXTURE_FORMAT_NOT_SUPPORTED);
         return false;
     }
-    mtl_desc.width = (NSUInteger)img->cmn.width;
-    mtl_desc.height = (NSUInteger)img->cmn.height;
-    if (SG_IMAGETYPE_3D == img->cmn.type) {
-        mtl_desc.depth = (NSUInteger)img->cmn.num_slices;
+    mtl_desc.width = (NSUInteger)cold->width;
+    mtl_desc.height = (NSUInteger)cold->height;
+    if (SG_IMAGETYPE_3D == cold->type) {
+        mtl_desc.depth = (NSUInteger)cold->num_slices;
     } else {
         mtl_desc.depth = 1;
     }
-    mtl_desc.mipmapLevelCount = (NSUInteger)img->cmn.num_mipmaps;
-    if (SG_IMAGETYPE_ARRAY == img->cmn.type) {
-        mtl_desc.arrayLength = (NSUInteger)img->cmn.num_slices;
+    mtl_desc.mipmapLevelCount = (NSUInteger)cold->num_mipmaps;
+    if (SG_IMAGETYPE_ARRAY == cold->type) {
+        mtl_desc.arrayLength = (NSUInteger)cold->num_slices;
     } else {
         mtl_desc.arrayLength = 1;
     }
-    mtl_desc.sampleCount = (NSUInteger)img->cmn.sample_count;
+    mtl_desc.sampleCount = (NSUInteger)cold->sample_count;
 
-    const sg_image_usage* usg = &img->cmn.usage;
+    const sg_image_usage* usg = &cold->usage;
     const bool any_attachment = usg->color_attachment || usg->resolve_attachment || usg->depth_stencil_attachment;
     MTLTextureUsage mtl_tex_usage = MTLTextureUsageShaderRead;
     if (any_attachment) {
         mtl_tex_usage |= MTLTextureUsageRenderTarget;
     }
-    if (img->cmn.usage.storage_image) {
+    if (cold->usage.storage_image) {
         mtl_tex_usage |= MTLTextureUsageShaderWrite;
     }
     mtl_desc.usage = mtl_tex_usage;
 
     MTLResourceOptions mtl_res_options = 0;
-    if (any_attachment || img->cmn.usage.storage_image) {
+    if (any_attachment || cold->usage.storage_image) {
         mtl_res_options |= MTLResourceStorageModePrivate;
     } else {
         mtl_res_options |= _sg_mtl_resource_options_storage_mode_managed_or_shared();
-        if (!img->cmn.usage.immutable) {
+        if (!cold->usage.immutable) {
             mtl_res_options |= MTLResourceCPUCacheModeWriteCombined;
         }
     }
@@ -16762,16 +18599,17 @@ _SOKOL_PRIVATE sg_resource_state _sg_mtl_create_view(_sg_view_t* view, const sg_
     _SOKOL_UNUSED(desc);
     if ((SG_VIEWTYPE_TEXTURE == view->cmn.type) || (SG_VIEWTYPE_STORAGEIMAGE == view->cmn.type)) {
         const _sg_image_view_common_t* cmn = &view->cmn.img;
+        const _sg_view_cold_t* cold = _sg_view_cold(view);
         const _sg_image_t* img = _sg_image_ref_ptr(&cmn->ref);
-        SOKOL_ASSERT(cmn->mip_level_count >= 1);
-        SOKOL_ASSERT(cmn->slice_count >= 1);
+        SOKOL_ASSERT(cold->mip_level_count >= 1);
+        SOKOL_ASSERT(cold->slice_count >= 1);
         for (int slot = 0; slot < img->cmn.num_slots; slot++) {
             SOKOL_ASSERT(img->mtl.tex[slot] != _SG_MTL_INVALID_SLOT_INDEX);
             id<MTLTexture> mtl_tex_view = [_sg_mtl_id(img->mtl.tex[slot])
-                newTextureViewWithPixelFormat: _sg_mtl_pixel_format(img->cmn.pixel_format)
-                textureType: _sg_mtl_texture_type(img->cmn.type, img->cmn.sample_count > 1)
-                levels: NSMakeRange((NSUInteger)cmn->mip_level, (NSUInteger)cmn->mip_level_count)
-                slices: NSMakeRange((NSUInteger)cmn->slice, (NSUInteger)cmn->slice_count)];
+                newTextureViewWithPixelFormat: _sg_mtl_pixel_format(_sg_image_cold(img)->pixel_format)
+                textureType: _sg_mtl_texture_type(_sg_image_cold(img)->type, _sg_image_cold(img)->sample_count > 1)
+                levels: NSMakeRange((NSUInteger)cmn->mip_level, (NSUInteger)cold->mip_level_count)
+                slices: NSMakeRange((NSUInteger)cmn->slice, (NSUInteger)cold->slice_count)];
             #if defined(SOKOL_DEBUG)
                 if (desc->label) {
                     mtl_tex_view.label = [NSString stringWithFormat:@"%s.%d", desc->label, slot];
@@ -16865,7 +18703,7 @@ _SOKOL_PRIVATE void _sg_mtl_begin_render_pass(const sg_pass* pass, const _sg_att
             pass_desc.colorAttachments[i].clearColor = MTLClearColorMake(c.r, c.g, c.b, c.a);
             pass_desc.colorAttachments[i].texture = _sg_mtl_id(color_img->mtl.tex[0]);
             pass_desc.colorAttachments[i].level = (NSUInteger)color_view->cmn.img.mip_level;
-            switch (color_img->cmn.type) {
+            switch (_sg_image_cold(color_img)->type) {
                 case SG_IMAGETYPE_CUBE:
                 case SG_IMAGETYPE_ARRAY:
                     pass_desc.colorAttachments[i].slice = (NSUInteger)color_view->cmn.img.slice;
@@ -16882,7 +18720,7 @@ _SOKOL_PRIVATE void _sg_mtl_begin_render_pass(const sg_pass* pass, const _sg_att
                 SOKOL_ASSERT(resolve_img->mtl.tex[0] != _SG_MTL_INVALID_SLOT_INDEX);
                 pass_desc.colorAttachments[i].resolveTexture = _sg_mtl_id(resolve_img->mtl.tex[0]);
                 pass_desc.colorAttachments[i].resolveLevel = (NSUInteger)resolve_view->cmn.img.mip_level;
-                switch (resolve_img->cmn.type) {
+                switch (_sg_image_cold(resolve_img)->type) {
                     case SG_IMAGETYPE_CUBE:
                     case SG_IMAGETYPE_ARRAY:
                         pass_desc.colorAttachments[i].resolveSlice = (NSUInteger)resolve_view->cmn.img.slice;
@@ -16904,7 +18742,7 @@ _SOKOL_PRIVATE void _sg_mtl_begin_render_pass(const sg_pass* pass, const _sg_att
             pass_desc.depthAttachment.loadAction = _sg_mtl_load_action(action->depth.load_action);
             pass_desc.depthAttachment.storeAction = _sg_mtl_store_action(action->depth.store_action, false);
             pass_desc.depthAttachment.clearDepth = action->depth.clear_value;
-            switch (ds_img->cmn.type) {
+            switch (_sg_image_cold(ds_img)->type) {
                 case SG_IMAGETYPE_CUBE:
                 case SG_IMAGETYPE_ARRAY:
                     pass_desc.depthAttachment.slice = (NSUInteger)ds_view->cmn.img.slice;
@@ -16914,12 +18752,12 @@ _SOKOL_PRIVATE void _sg_mtl_begin_render_pass(const sg_pass* pass, const _sg_att
                     break;
                 default: break;
             }
-            if (_sg_is_depth_stencil_format(ds_img->cmn.pixel_format)) {
+            if (_sg_is_depth_stencil_format(_sg_image_cold(ds_img)->pixel_format)) {
                 pass_desc.stencilAttachment.texture = _sg_mtl_id(ds_img->mtl.tex[0]);
                 pass_desc.stencilAttachment.loadAction = _sg_mtl_load_action(action->stencil.load_action);
                 pass_desc.stencilAttachment.storeAction = _sg_mtl_store_action(action->depth.store_action, false);
                 pass_desc.stencilAttachment.clearStencil = action->stencil.clear_value;
-                switch (ds_img->cmn.type) {
+                switch (_sg_image_cold(ds_img)->type) {
                     case SG_IMAGETYPE_CUBE:
                     case SG_IMAGETYPE_ARRAY:
                         pass_desc.stencilAttachment.slice = (NSUInteger)ds_view->cmn.img.slice;
@@ -17469,6 +19307,30 @@ _SOKOL_PRIVATE void _sg_mtl_update_buffer(_sg_buffer_t* buf, const sg_range* dat
     #endif
 }
 
+_SOKOL_PRIVATE void* _sg_mtl_map_buffer(_sg_buffer_t* buf, size_t size) {
+    SOKOL_ASSERT(buf && (size > 0));
+    _SOKOL_UNUSED(size);
+    // a mapping counts as the one update per buffer and frame
+    if (++buf->cmn.active_slot >= buf->cmn.num_slots) {
+        buf->cmn.active_slot = 0;
+    }
+    __unsafe_unretained id<MTLBuffer> mtl_buf = _sg_mtl_id(buf->mtl.buf[buf->cmn.active_slot]);
+    return [mtl_buf contents];
+}
+
+_SOKOL_PRIVATE void _sg_mtl_unmap_buffer(_sg_buffer_t* buf, size_t size) {
+    SOKOL_ASSERT(buf && (size > 0));
+    #if defined(_SG_TARGET_MACOS)
+    if (_sg_mtl_resource_options_storage_mode_managed_or_shared() == MTLResourceStorageModeManaged) {
+        __unsafe_unretained id<MTLBuffer> mtl_buf = _sg_mtl_id(buf->mtl.buf[buf->cmn.active_slot]);
+        [mtl_buf didModifyRange:NSMakeRange(0, size)];
+    }
+    #else
+    _SOKOL_UNUSED(buf);
+    _SOKOL_UNUSED(size);
+    #endif
+}
+
 _SOKOL_PRIVATE void _sg_mtl_append_buffer(_sg_buffer_t* buf, const sg_range* data, bool new_frame) {
     SOKOL_ASSERT(buf && data && data->ptr && (data->size > 0));
     if (new_frame) {
@@ -17478,11 +19340,11 @@ _SOKOL_PRIVATE void _sg_mtl_append_buffer(_sg_buffer_t* buf, const sg_range* dat
     }
     __unsafe_unretained id<MTLBuffer> mtl_buf = _sg_mtl_id(buf->mtl.buf[buf->cmn.active_slot]);
     uint8_t* dst_ptr = (uint8_t*) [mtl_buf contents];
-    dst_ptr += buf->cmn.append_pos;
+    dst_ptr += _sg_buffer_cold(buf)->append_pos;
     memcpy(dst_ptr, data->ptr, data->size);
     #if defined(_SG_TARGET_MACOS)
     if (_sg_mtl_resource_options_storage_mode_managed_or_shared() == MTLResourceStorageModeManaged) {
-        [mtl_buf didModifyRange:NSMakeRange((NSUInteger)buf->cmn.append_pos, (NSUInteger)data->size)];
+        [mtl_buf didModifyRange:NSMakeRange((NSUInteger)_sg_buffer_cold(buf)->append_pos, (NSUInteger)data->size)];
     }
     #endif
 }
@@ -17496,6 +19358,28 @@ _SOKOL_PRIVATE void _sg_mtl_update_image(_sg_image_t* img, const sg_image_data*
     _sg_mtl_copy_image_data(img, mtl_tex, data);
 }
 
+_SOKOL_PRIVATE void _sg_mtl_update_image_region(_sg_image_t* img, const sg_write_image_desc* desc) {
+    SOKOL_ASSERT(img && desc);
+    SOKOL_ASSERT(_sg_image_cold(img)->usage.region_update);
+    SOKOL_ASSERT(0 == img->cmn.active_slot);
+    // NOTE: this is a CPU-side write which isn't synchronized with in-flight
+    // frames, the caller must only overwrite regions which are not in use
+    __unsafe_unretained id<MTLTexture> mtl_tex = _sg_mtl_id(img->mtl.tex[0]);
+    _sg_mtl_write_miplevel_data(img, mtl_tex,
+        (const uint8_t*)desc->src.data.ptr,
+        desc->src.data.size,
+        desc->src.offset,
+        desc->src.bytes_per_row,
+        desc->src.bytes_per_slice,
+        desc->dst.mip_level,
+        desc->dst.x,
+        desc->dst.y,
+        desc->dst.slice,
+        desc->size.width,
+        desc->size.height,
+        desc->size.num_slices);
+}
+
 _SOKOL_PRIVATE void _sg_mtl_write_buffer_unsealed(_sg_buffer_t* buf, const sg_write_buffer_desc* desc) {
     SOKOL_ASSERT(buf && desc);
     SOKOL_ASSERT(SG_RESOURCESTATE_UNSEALED == buf->slot.state);
@@ -18118,7 +20002,7 @@ _SOKOL_PRIVATE void _sg_wgpu_init_caps(void) {
     }
 }
 
-_SOKOL_PRIVATE void _sg_wgpu_uniform_system_init(const sg_desc* desc) {
+_SOKOL_PRIVATE void _sg_wgpu_uniform_system_init(uint32_t size) {
     SOKOL_ASSERT(0 == _sg.wgpu.uniform.staging);
     SOKOL_ASSERT(0 == _sg.wgpu.uniform.buf);
 
@@ -18128,7 +20012,7 @@ _SOKOL_PRIVATE void _sg_wgpu_uniform_system_init(const sg_desc* desc) {
     // max uniform update size on NVIDIA
     //
     // FIXME: is this still needed?
-    _sg.wgpu.uniform.num_bytes = (uint32_t)(desc->uniform_buffer_size + _SG_WGPU_MAX_UNIFORM_UPDATE_SIZE);
+    _sg.wgpu.uniform.num_bytes = size + _SG_WGPU_MAX_UNIFORM_UPDATE_SIZE;
     _sg.wgpu.uniform.staging = (uint8_t*)_sg_malloc(_sg.wgpu.uniform.num_bytes);
 
     _SG_STRUCT(WGPUBufferDescriptor, ub_desc);
@@ -18716,12 +20600,45 @@ _SOKOL_PRIVATE void _sg_wgpu_setup_backend(const sg_desc* desc) {
     SOKOL_ASSERT(_sg.wgpu.queue);
 
     _sg_wgpu_init_caps();
-    _sg_wgpu_uniform_system_init(desc);
+    _sg_wgpu_uniform_system_init((uint32_t)desc->uniform_buffer_size);
     _sg_wgpu_bindgroups_pool_init(desc);
     _sg_wgpu_bindgroups_cache_init(desc);
     _sg_wgpu_bindings_cache_clear();
 }
 
+// called from sg_commit() after the frame's uniform data has been written
+_SOKOL_PRIVATE void _sg_wgpu_grow_uniform_buffer(uint32_t size) {
+    // NOTE: WebGPU keeps the old buffer alive until in-flight frames have completed
+    _sg_wgpu_uniform_system_discard();
+    _sg_wgpu_uniform_system_init(size);
+    // all uniform bindgroups reference the old uniform buffer and must be recreated
+    for (int i = 1; i < _sg.pools.shader_pool.size; i++) {
+        _sg_shader_t* shd = &_sg.pools.shaders[i];
+        if (shd->slot.state != SG_RESOURCESTATE_VALID) {
+            continue;
+        }
+        SOKOL_ASSERT(shd->wgpu.bgl_ub && shd->wgpu.bg_ub);
+        _SG_STRUCT(WGPUBindGroupEntry, bg_entries[SG_MAX_UNIFORMBLOCK_BINDSLOTS]);
+        _SG_STRUCT(WGPUBindGroupDescriptor, bg_desc);
+        size_t bg_index = 0;
+        for (size_t ub_index = 0; ub_index < SG_MAX_UNIFORMBLOCK_BINDSLOTS; ub_index++) {
+            if (shd->cmn.uniform_blocks[ub_index].stage == SG_SHADERSTAGE_NONE) {
+                continue;
+            }
+            WGPUBindGroupEntry* bg_entry = &bg_entries[bg_index++];
+            bg_entry->binding = shd->wgpu.ub_grp0_bnd_n[ub_index];
+            bg_entry->buffer = _sg.wgpu.uniform.buf;
+            bg_entry->size = _SG_WGPU_MAX_UNIFORM_UPDATE_SIZE;
+        }
+        bg_desc.layout = shd->wgpu.bgl_ub;
+        bg_desc.entryCount = bg_index;
+        bg_desc.entries = bg_entries;
+        wgpuBindGroupRelease(shd->wgpu.bg_ub);
+        shd->wgpu.bg_ub = wgpuDeviceCreateBindGroup(_sg.wgpu.dev, &bg_desc);
+        SOKOL_ASSERT(shd->wgpu.bg_ub);
+    }
+}
+
 _SOKOL_PRIVATE void _sg_wgpu_discard_backend(void) {
     SOKOL_ASSERT(_sg.wgpu.valid);
     _sg.wgpu.valid = false;
@@ -18751,10 +20668,10 @@ _SOKOL_PRIVATE sg_resource_state _sg_wgpu_create_buffer(_sg_buffer_t* buf, const
         // buffer mapping size must be multiple of 4, so round up buffer size (only a problem
         // with index buffers containing odd number of indices)
         const uint64_t wgpu_buf_size = _sg_roundup_pow2_u64((uint64_t)buf->cmn.size, 4);
-        const bool map_at_creation = buf->cmn.usage.immutable && (desc->data.ptr || buf->cmn.usage.write_unsealed);
+        const bool map_at_creation = _sg_buffer_cold(buf)->usage.immutable && (desc->data.ptr || _sg_buffer_cold(buf)->usage.write_unsealed);
 
         _SG_STRUCT(WGPUBufferDescriptor, wgpu_buf_desc);
-        wgpu_buf_desc.usage = _sg_wgpu_buffer_usage(&buf->cmn.usage);
+        wgpu_buf_desc.usage = _sg_wgpu_buffer_usage(&_sg_buffer_cold(buf)->usage);
         wgpu_buf_desc.size = wgpu_buf_size;
         wgpu_buf_desc.mappedAtCreation = map_at_creation;
         wgpu_buf_desc.label = _sg_wgpu_stringview(desc->label);
@@ -18836,18 +20753,18 @@ _SOKOL_PRIVATE void _sg_wgpu_write_miplevel_data(const _sg_image_t* img,
     SOKOL_ASSERT(src_size > 0);
     SOKOL_ASSERT(src_bytes_per_row > 0);
     SOKOL_ASSERT(src_bytes_per_slice > 0);
-    SOKOL_ASSERT((mip_level >= 0) && (mip_level < img->cmn.num_mipmaps));
-    SOKOL_ASSERT((x >= 0) && (x < _sg_miplevel_dim(img->cmn.width, mip_level)));
-    SOKOL_ASSERT((y >= 0) && (y < _sg_miplevel_dim(img->cmn.height, mip_level)));
-    SOKOL_ASSERT((slice >= 0) && (slice < img->cmn.num_slices));
-    SOKOL_ASSERT((width > 0) && (x + width <= _sg_miplevel_dim(img->cmn.width, mip_level)));
-    SOKOL_ASSERT((height > 0) && (y + height <= _sg_miplevel_dim(img->cmn.height, mip_level)));
-    SOKOL_ASSERT((num_slices > 0) && (slice + num_slices <= img->cmn.num_slices));
+    SOKOL_ASSERT((mip_level >= 0) && (mip_level < _sg_image_cold(img)->num_mipmaps));
+    SOKOL_ASSERT((x >= 0) && (x < _sg_miplevel_dim(_sg_image_cold(img)->width, mip_level)));
+    SOKOL_ASSERT((y >= 0) && (y < _sg_miplevel_dim(_sg_image_cold(img)->height, mip_level)));
+    SOKOL_ASSERT((slice >= 0) && (slice < _sg_image_cold(img)->num_slices));
+    SOKOL_ASSERT((width > 0) && (x + width <= _sg_miplevel_dim(_sg_image_cold(img)->width, mip_level)));
+    SOKOL_ASSERT((height > 0) && (y + height <= _sg_miplevel_dim(_sg_image_cold(img)->height, mip_level)));
+    SOKOL_ASSERT((num_slices > 0) && (slice + num_slices <= _sg_image_cold(img)->num_slices));
     SOKOL_ASSERT((src_offset + (size_t)src_bytes_per_slice * (size_t)num_slices) <= src_size);
-    SOKOL_ASSERT(_sg_multiple(src_bytes_per_row, _sg_block_bytesize(img->cmn.pixel_format)));
+    SOKOL_ASSERT(_sg_multiple(src_bytes_per_row, _sg_block_bytesize(_sg_image_cold(img)->pixel_format)));
     SOKOL_ASSERT(_sg_multiple(src_bytes_per_slice, src_bytes_per_row));
 
-    const int block_dim = _sg_block_dim(img->cmn.pixel_format);
+    const int block_dim = _sg_block_dim(_sg_image_cold(img)->pixel_format);
     _SG_STRUCT(WGPUTexelCopyBufferLayout, wgpu_layout);
     _SG_STRUCT(WGPUTexelCopyTextureInfo, wgpu_copy_tex);
     _SG_STRUCT(WGPUExtent3D, wgpu_extent);
@@ -18867,12 +20784,13 @@ _SOKOL_PRIVATE void _sg_wgpu_write_miplevel_data(const _sg_image_t* img,
 }
 
 _SOKOL_PRIVATE void _sg_wgpu_copy_image_data(const _sg_image_t* img, const sg_image_data* data) {
-    for (int mip_level = 0; mip_level < img->cmn.num_mipmaps; mip_level++) {
-        const int mip_width = _sg_miplevel_dim(img->cmn.width, mip_level);
-        const int mip_height = _sg_miplevel_dim(img->cmn.height, mip_level);
-        const int mip_depth_or_slices = (img->cmn.type == SG_IMAGETYPE_3D) ? _sg_miplevel_dim(img->cmn.num_slices, mip_level) : img->cmn.num_slices;
-        const int bytes_per_row = _sg_row_pitch(img->cmn.pixel_format, mip_width, 1);
-        const int bytes_per_slice = _sg_surface_pitch(img->cmn.pixel_format, mip_width, mip_height, 1);
+    const _sg_image_cold_t* cold = _sg_image_cold(img);
+    for (int mip_level = 0; mip_level < cold->num_mipmaps; mip_level++) {
+        const int mip_width = _sg_miplevel_dim(cold->width, mip_level);
+        const int mip_height = _sg_miplevel_dim(cold->height, mip_level);
+        const int mip_depth_or_slices = (cold->type == SG_IMAGETYPE_3D) ? _sg_miplevel_dim(cold->num_slices, mip_level) : cold->num_slices;
+        const int bytes_per_row = _sg_row_pitch(cold->pixel_format, mip_width, 1);
+        const int bytes_per_slice = _sg_surface_pitch(cold->pixel_format, mip_width, mip_height, 1);
         _sg_wgpu_write_miplevel_data(img,
             (const uint8_t*)data->mip_levels[mip_level].ptr,
             data->mip_levels[mip_level].size,
@@ -18891,6 +20809,7 @@ _SOKOL_PRIVATE void _sg_wgpu_copy_image_data(const _sg_image_t* img, const sg_im
 
 _SOKOL_PRIVATE sg_resource_state _sg_wgpu_create_image(_sg_image_t* img, const sg_image_desc* desc) {
     SOKOL_ASSERT(img && desc);
+    const _sg_image_cold_t* cold = _sg_image_cold(img);
     const bool injected = (0 != desc->wgpu_texture);
     if (injected) {
         img->wgpu.tex = (WGPUTexture)desc->wgpu_texture;
@@ -18905,13 +20824,13 @@ _SOKOL_PRIVATE sg_resource_state _sg_wgpu_create_image(_sg_image_t* img, const s
         if (desc->usage.storage_image) {
             wgpu_tex_desc.usage |= WGPUTextureUsage_StorageBinding;
         }
-        wgpu_tex_desc.dimension = _sg_wgpu_texture_dimension(img->cmn.type);
-        wgpu_tex_desc.size.width = (uint32_t) img->cmn.width;
-        wgpu_tex_desc.size.height = (uint32_t) img->cmn.height;
-        wgpu_tex_desc.size.depthOrArrayLayers = (uint32_t) img->cmn.num_slices;
-        wgpu_tex_desc.format = _sg_wgpu_textureformat(img->cmn.pixel_format);
-        wgpu_tex_desc.mipLevelCount = (uint32_t) img->cmn.num_mipmaps;
-        wgpu_tex_desc.sampleCount = (uint32_t) img->cmn.sample_count;
+        wgpu_tex_desc.dimension = _sg_wgpu_texture_dimension(cold->type);
+        wgpu_tex_desc.size.width = (uint32_t) cold->width;
+        wgpu_tex_desc.size.height = (uint32_t) cold->height;
+        wgpu_tex_desc.size.depthOrArrayLayers = (uint32_t) cold->num_slices;
+        wgpu_tex_desc.format = _sg_wgpu_textureformat(cold->pixel_format);
+        wgpu_tex_desc.mipLevelCount = (uint32_t) cold->num_mipmaps;
+        wgpu_tex_desc.sampleCount = (uint32_t) cold->sample_count;
         img->wgpu.tex = wgpuDeviceCreateTexture(_sg.wgpu.dev, &wgpu_tex_desc);
         if (0 == img->wgpu.tex) {
             _SG_ERROR(WGPU_CREATE_TEXTURE_FAILED);
@@ -19384,22 +21303,22 @@ _SOKOL_PRIVATE sg_resource_state _sg_wgpu_create_view(_sg_view_t* view, const sg
     if (view->cmn.type != SG_VIEWTYPE_STORAGEBUFFER) {
         const _sg_image_t* img = _sg_image_ref_ptr(&view->cmn.img.ref);
         SOKOL_ASSERT(img->wgpu.tex);
-        SOKOL_ASSERT(view->cmn.img.mip_level_count >= 1);
-        SOKOL_ASSERT(view->cmn.img.slice_count >= 1);
+        SOKOL_ASSERT(_sg_view_cold(view)->mip_level_count >= 1);
+        SOKOL_ASSERT(_sg_view_cold(view)->slice_count >= 1);
         _SG_STRUCT(WGPUTextureViewDescriptor, wgpu_texview_desc);
         wgpu_texview_desc.label = _sg_wgpu_stringview(desc->label);
         wgpu_texview_desc.baseMipLevel = (uint32_t)view->cmn.img.mip_level;
-        wgpu_texview_desc.mipLevelCount = (uint32_t)view->cmn.img.mip_level_count;
+        wgpu_texview_desc.mipLevelCount = (uint32_t)_sg_view_cold(view)->mip_level_count;
         wgpu_texview_desc.baseArrayLayer = (uint32_t)view->cmn.img.slice;
-        wgpu_texview_desc.arrayLayerCount = (uint32_t)view->cmn.img.slice_count;
+        wgpu_texview_desc.arrayLayerCount = (uint32_t)_sg_view_cold(view)->slice_count;
         if (view->cmn.type == SG_VIEWTYPE_TEXTURE) {
-            wgpu_texview_desc.dimension = _sg_wgpu_texture_view_dimension(img->cmn.type);
+            wgpu_texview_desc.dimension = _sg_wgpu_texture_view_dimension(_sg_image_cold(img)->type);
         } else {
-            wgpu_texview_desc.dimension = _sg_wgpu_attachment_view_dimension(img->cmn.type);
+            wgpu_texview_desc.dimension = _sg_wgpu_attachment_view_dimension(_sg_image_cold(img)->type);
         }
         if (view->cmn.type == SG_VIEWTYPE_DEPTHSTENCILATTACHMENT) {
             wgpu_texview_desc.aspect = WGPUTextureAspect_All;
-        } else if (_sg_is_depth_or_depth_stencil_format(img->cmn.pixel_format)) {
+        } else if (_sg_is_depth_or_depth_stencil_format(_sg_image_cold(img)->pixel_format)) {
                 wgpu_texview_desc.aspect = WGPUTextureAspect_DepthOnly;
         } else {
             wgpu_texview_desc.aspect = WGPUTextureAspect_All;
@@ -19487,7 +21406,7 @@ _SOKOL_PRIVATE void _sg_wgpu_begin_render_pass(const sg_pass* pass, const _sg_at
             const _sg_image_t* img = _sg_image_ref_ptr(&atts->ds_view->cmn.img.ref);
             WGPUTextureView wgpu_ds_view = atts->ds_view->wgpu.view;
             SOKOL_ASSERT(wgpu_ds_view);
-            _sg_wgpu_init_ds_att(&wgpu_ds_att, action, img->cmn.pixel_format, wgpu_ds_view);
+            _sg_wgpu_init_ds_att(&wgpu_ds_att, action, _sg_image_cold(img)->pixel_format, wgpu_ds_view);
             wgpu_pass_desc.depthStencilAttachment = &wgpu_ds_att;
         }
     } else {
@@ -19664,7 +21583,7 @@ _SOKOL_PRIVATE void _sg_wgpu_update_buffer(_sg_buffer_t* buf, const sg_range* da
 _SOKOL_PRIVATE void _sg_wgpu_append_buffer(_sg_buffer_t* buf, const sg_range* data, bool new_frame) {
     SOKOL_ASSERT(buf && data && data->ptr && (data->size > 0));
     _SOKOL_UNUSED(new_frame);
-    _sg_wgpu_copy_buffer_data(buf, (uint64_t)buf->cmn.append_pos, data);
+    _sg_wgpu_copy_buffer_data(buf, (uint64_t)_sg_buffer_cold(buf)->append_pos, data);
 }
 
 _SOKOL_PRIVATE void _sg_wgpu_update_image(_sg_image_t* img, const sg_image_data* data) {
@@ -19672,6 +21591,24 @@ _SOKOL_PRIVATE void _sg_wgpu_update_image(_sg_image_t* img, const sg_image_data*
     _sg_wgpu_copy_image_data(img, data);
 }
 
+_SOKOL_PRIVATE void _sg_wgpu_update_image_region(_sg_image_t* img, const sg_write_image_desc* desc) {
+    SOKOL_ASSERT(img && desc);
+    SOKOL_ASSERT(_sg_image_cold(img)->usage.region_update);
+    _sg_wgpu_write_miplevel_data(img,
+        (const uint8_t*)desc->src.data.ptr,
+        desc->src.data.size,
+        desc->src.offset,
+        desc->src.bytes_per_row,
+        desc->src.bytes_per_slice,
+        desc->dst.mip_level,
+        desc->dst.x,
+        desc->dst.y,
+        desc->dst.slice,
+        desc->size.width,
+        desc->size.height,
+        desc->size.num_slices);
+}
+
 _SOKOL_PRIVATE void _sg_wgpu_write_buffer_unsealed(_sg_buffer_t* buf, const sg_write_buffer_desc* desc) {
     SOKOL_ASSERT(buf && desc);
     SOKOL_ASSERT(SG_RESOURCESTATE_UNSEALED == buf->slot.state);
@@ -19967,9 +21904,9 @@ _SOKOL_PRIVATE void _sg_vk_image_barrier(VkCommandBuffer cmd_buf, _sg_image_t* i
     barrier.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
     barrier.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
     barrier.image = img->vk.img;
-    if (_sg_is_depth_or_depth_stencil_format(img->cmn.pixel_format)) {
+    if (_sg_is_depth_or_depth_stencil_format(_sg_image_cold(img)->pixel_format)) {
         barrier.subresourceRange.aspectMask |= VK_IMAGE_ASPECT_DEPTH_BIT;
-        if (_sg_is_depth_stencil_format(img->cmn.pixel_format)) {
+        if (_sg_is_depth_stencil_format(_sg_image_cold(img)->pixel_format)) {
             barrier.subresourceRange.aspectMask |= VK_IMAGE_ASPECT_STENCIL_BIT;
         }
     } else {
@@ -20056,7 +21993,7 @@ _SOKOL_PRIVATE void _sg_vk_barrier_on_begin_pass(VkCommandBuffer cmd_buf, const
             }
             if (atts->ds_view) {
                 _sg_image_t* ds_image = _sg_image_ref_ptr(&atts->ds_view->cmn.img.ref);
-                const bool has_stencil = _sg_is_depth_stencil_format(ds_image->cmn.pixel_format);
+                const bool has_stencil = _sg_is_depth_stencil_format(_sg_image_cold(ds_image)->pixel_format);
                 if ((pass->action.depth.load_action != SG_LOADACTION_LOAD) &&
                     (pass->action.stencil.load_action != SG_LOADACTION_LOAD))
                 {
@@ -20270,14 +22207,14 @@ _SOKOL_PRIVATE bool _sg_vk_mem_alloc_buffer_device_memory(_sg_buffer_t* buf) {
     SOKOL_ASSERT(_sg.vk.dev);
     SOKOL_ASSERT(buf);
     SOKOL_ASSERT(buf->vk.buf);
-    SOKOL_ASSERT(0 == buf->vk.mem);
+    SOKOL_ASSERT(0 == _sg_buffer_cold(buf)->vk.mem);
     _SG_STRUCT(VkMemoryRequirements, mem_reqs);
     vkGetBufferMemoryRequirements(_sg.vk.dev, buf->vk.buf, &mem_reqs);
-    _sg_vk_memtype_t mem_type = buf->cmn.usage.storage_buffer
+    _sg_vk_memtype_t mem_type = _sg_buffer_cold(buf)->usage.storage_buffer
         ? _SG_VK_MEMTYPE_STORAGE_BUFFER
         : _SG_VK_MEMTYPE_GENERIC_BUFFER;
-    buf->vk.mem = _sg_vk_mem_alloc_device_memory(mem_type, &mem_reqs);
-    if (0 == buf->vk.mem) {
+    _sg_buffer_cold(buf)->vk.mem = _sg_vk_mem_alloc_device_memory(mem_type, &mem_reqs);
+    if (0 == _sg_buffer_cold(buf)->vk.mem) {
         _SG_ERROR(VULKAN_ALLOC_BUFFER_DEVICE_MEMORY_FAILED);
         return false;
     }
@@ -20288,11 +22225,11 @@ _SOKOL_PRIVATE bool _sg_vk_mem_alloc_image_device_memory(_sg_image_t* img) {
     SOKOL_ASSERT(_sg.vk.dev);
     SOKOL_ASSERT(img);
     SOKOL_ASSERT(img->vk.img);
-    SOKOL_ASSERT(0 == img->vk.mem);
+    SOKOL_ASSERT(0 == _sg_image_cold(img)->vk.mem);
     _SG_STRUCT(VkMemoryRequirements, mem_reqs);
     vkGetImageMemoryRequirements(_sg.vk.dev, img->vk.img, &mem_reqs);
-    img->vk.mem = _sg_vk_mem_alloc_device_memory(_SG_VK_MEMTYPE_IMAGE, &mem_reqs);
-    if (0 == img->vk.mem) {
+    _sg_image_cold(img)->vk.mem = _sg_vk_mem_alloc_device_memory(_SG_VK_MEMTYPE_IMAGE, &mem_reqs);
+    if (0 == _sg_image_cold(img)->vk.mem) {
         _SG_ERROR(VULKAN_ALLOC_IMAGE_DEVICE_MEMORY_FAILED);
         return false;
     }
@@ -20678,9 +22615,9 @@ _SOKOL_PRIVATE void _sg_vk_init_vk_image_staging_structs(const _sg_image_t* img,
     SOKOL_ASSERT(img && region && copy_info);
 
     region->sType = VK_STRUCTURE_TYPE_BUFFER_IMAGE_COPY_2;
-    if (_sg_is_depth_or_depth_stencil_format(img->cmn.pixel_format)) {
+    if (_sg_is_depth_or_depth_stencil_format(_sg_image_cold(img)->pixel_format)) {
         region->imageSubresource.aspectMask = VK_IMAGE_ASPECT_DEPTH_BIT;
-        if (_sg_is_depth_stencil_format(img->cmn.pixel_format)) {
+        if (_sg_is_depth_stencil_format(_sg_image_cold(img)->pixel_format)) {
             region->imageSubresource.aspectMask = VK_IMAGE_ASPECT_STENCIL_BIT;
         }
     } else {
@@ -20721,15 +22658,15 @@ _SOKOL_PRIVATE void _sg_vk_staging_copy_miplevel_data(_sg_image_t* img,
     SOKOL_ASSERT(src_size > 0);
     SOKOL_ASSERT(src_bytes_per_row > 0);
     SOKOL_ASSERT(src_bytes_per_slice > 0);
-    SOKOL_ASSERT((mip_level >= 0) && (mip_level < img->cmn.num_mipmaps));
-    SOKOL_ASSERT((x >= 0) && (x < _sg_miplevel_dim(img->cmn.width, mip_level)));
-    SOKOL_ASSERT((y >= 0) && (y < _sg_miplevel_dim(img->cmn.height, mip_level)));
-    SOKOL_ASSERT((slice >= 0) && (slice < img->cmn.num_slices));
-    SOKOL_ASSERT((width > 0) && (x + width <= _sg_miplevel_dim(img->cmn.width, mip_level)));
-    SOKOL_ASSERT((height > 0) && (y + height <= _sg_miplevel_dim(img->cmn.height, mip_level)));
-    SOKOL_ASSERT((num_slices > 0) && (slice + num_slices <= img->cmn.num_slices));
+    SOKOL_ASSERT((mip_level >= 0) && (mip_level < _sg_image_cold(img)->num_mipmaps));
+    SOKOL_ASSERT((x >= 0) && (x < _sg_miplevel_dim(_sg_image_cold(img)->width, mip_level)));
+    SOKOL_ASSERT((y >= 0) && (y < _sg_miplevel_dim(_sg_image_cold(img)->height, mip_level)));
+    SOKOL_ASSERT((slice >= 0) && (slice < _sg_image_cold(img)->num_slices));
+    SOKOL_ASSERT((width > 0) && (x + width <= _sg_miplevel_dim(_sg_image_cold(img)->width, mip_level)));
+    SOKOL_ASSERT((height > 0) && (y + height <= _sg_miplevel_dim(_sg_image_cold(img)->height, mip_level)));
+    SOKOL_ASSERT((num_slices > 0) && (slice + num_slices <= _sg_image_cold(img)->num_slices));
     SOKOL_ASSERT((src_offset + (size_t)src_bytes_per_slice * (size_t)num_slices) <= src_size);
-    SOKOL_ASSERT(_sg_multiple(src_bytes_per_row, _sg_block_bytesize(img->cmn.pixel_format)));
+    SOKOL_ASSERT(_sg_multiple(src_bytes_per_row, _sg_block_bytesize(_sg_image_cold(img)->pixel_format)));
     SOKOL_ASSERT(_sg_multiple(src_bytes_per_slice, src_bytes_per_row));
     _SOKOL_UNUSED(src_size);
 
@@ -20741,8 +22678,8 @@ _SOKOL_PRIVATE void _sg_vk_staging_copy_miplevel_data(_sg_image_t* img,
     _SG_STRUCT(VkBufferImageCopy2, region);
     _SG_STRUCT(VkCopyBufferToImageInfo2, copy_info);
     _sg_vk_init_vk_image_staging_structs(img, _sg.vk.stage.copy.buf, &region, &copy_info);
-    const int block_dim = _sg_block_dim(img->cmn.pixel_format);
-    const int block_bytesize = _sg_block_bytesize(img->cmn.pixel_format);
+    const int block_dim = _sg_block_dim(_sg_image_cold(img)->pixel_format);
+    const int block_bytesize = _sg_block_bytesize(_sg_image_cold(img)->pixel_format);
     region.bufferRowLength = (uint32_t)((src_bytes_per_row / block_bytesize) * block_dim);
     region.bufferImageHeight = (uint32_t)((src_bytes_per_slice / src_bytes_per_row) * block_dim);
     region.imageSubresource.mipLevel = (uint32_t)mip_level;
@@ -20759,12 +22696,12 @@ _SOKOL_PRIVATE void _sg_vk_staging_copy_miplevel_data(_sg_image_t* img,
     }
     // actual number of slice-rows to copy (cannot use src_bytes_per_slice for
     // computation, since the source data may have gaps between slices)
-    const int num_rows = _sg_num_rows(img->cmn.pixel_format, height);
+    const int num_rows = _sg_num_rows(_sg_image_cold(img)->pixel_format, height);
     SOKOL_ASSERT(src_bytes_per_slice >= (num_rows * src_bytes_per_row));
     for (int i = 0; i < num_slices; i++) {
         const uint8_t* cur_ptr = src_ptr + src_offset + (size_t)i * (size_t)src_bytes_per_slice;
         int cur_slice = i + slice;
-        if (img->cmn.type == SG_IMAGETYPE_3D) {
+        if (_sg_image_cold(img)->type == SG_IMAGETYPE_3D) {
             region.imageOffset.z = cur_slice;
         } else {
             region.imageSubresource.baseArrayLayer = (uint32_t)cur_slice;
@@ -20799,13 +22736,14 @@ _SOKOL_PRIVATE void _sg_vk_staging_copy_miplevel_data(_sg_image_t* img,
 
 _SOKOL_PRIVATE void _sg_vk_staging_copy_image_data(_sg_image_t* img, const sg_image_data* src_data, bool initial_wait) {
     SOKOL_ASSERT(img);
-    const sg_pixel_format fmt = img->cmn.pixel_format;
-    for (int mip_level = 0; mip_level < img->cmn.num_mipmaps; mip_level++) {
+    const _sg_image_cold_t* cold = _sg_image_cold(img);
+    const sg_pixel_format fmt = cold->pixel_format;
+    for (int mip_level = 0; mip_level < cold->num_mipmaps; mip_level++) {
         SOKOL_ASSERT(src_data->mip_levels[mip_level].ptr);
         SOKOL_ASSERT(src_data->mip_levels[mip_level].size > 0);
-        const int mip_width = _sg_miplevel_dim(img->cmn.width, mip_level);
-        const int mip_height = _sg_miplevel_dim(img->cmn.height, mip_level);
-        const int mip_depth_or_slices = (img->cmn.type == SG_IMAGETYPE_3D) ? _sg_miplevel_dim(img->cmn.num_slices, mip_level) : img->cmn.num_slices;
+        const int mip_width = _sg_miplevel_dim(cold->width, mip_level);
+        const int mip_height = _sg_miplevel_dim(cold->height, mip_level);
+        const int mip_depth_or_slices = (cold->type == SG_IMAGETYPE_3D) ? _sg_miplevel_dim(cold->num_slices, mip_level) : cold->num_slices;
         const int bytes_per_row = _sg_row_pitch(fmt, mip_width, 1);
         const int bytes_per_slice = _sg_surface_pitch(fmt, mip_width, mip_height, 1);
         _sg_vk_staging_copy_miplevel_data(img,
@@ -20883,12 +22821,13 @@ _SOKOL_PRIVATE void _sg_vk_staging_stream_image_data(_sg_image_t* img, const sg_
     SOKOL_ASSERT(_sg.vk.frame.stream_cmd_buf);
     SOKOL_ASSERT(img && img->vk.img);
     SOKOL_ASSERT(src_data);
+    const _sg_image_cold_t* cold = _sg_image_cold(img);
     VkCommandBuffer cmd_buf = _sg.vk.frame.stream_cmd_buf;
     _sg_vk_image_barrier(cmd_buf, img, _SG_VK_ACCESS_STAGING);
     _SG_STRUCT(VkBufferImageCopy2, region);
     _SG_STRUCT(VkCopyBufferToImageInfo2, copy_info);
     _sg_vk_init_vk_image_staging_structs(img, _sg.vk.stage.stream.cur_buf, &region, &copy_info);
-    for (int mip_index = 0; mip_index < img->cmn.num_mipmaps; mip_index++) {
+    for (int mip_index = 0; mip_index < cold->num_mipmaps; mip_index++) {
         const sg_range* src_mip = &src_data->mip_levels[mip_index];
         SOKOL_ASSERT(src_mip->ptr);
         SOKOL_ASSERT(src_mip->size > 0);
@@ -20899,13 +22838,13 @@ _SOKOL_PRIVATE void _sg_vk_staging_stream_image_data(_sg_image_t* img, const sg_
             return;
         }
         region.bufferOffset = src_offset;
-        int mip_width = _sg_miplevel_dim(img->cmn.width, mip_index);
-        int mip_height = _sg_miplevel_dim(img->cmn.height, mip_index);
-        int mip_slices = (img->cmn.type == SG_IMAGETYPE_3D) ? _sg_miplevel_dim(img->cmn.num_slices, mip_index) : img->cmn.num_slices;
+        int mip_width = _sg_miplevel_dim(cold->width, mip_index);
+        int mip_height = _sg_miplevel_dim(cold->height, mip_index);
+        int mip_slices = (cold->type == SG_IMAGETYPE_3D) ? _sg_miplevel_dim(cold->num_slices, mip_index) : cold->num_slices;
         region.imageExtent.width = (uint32_t)mip_width;
         region.imageExtent.height = (uint32_t)mip_height;
         region.imageSubresource.mipLevel = (uint32_t)mip_index;
-        if (img->cmn.type == SG_IMAGETYPE_3D) {
+        if (cold->type == SG_IMAGETYPE_3D) {
             region.imageExtent.depth = (uint32_t)mip_slices;
             region.imageSubresource.layerCount = 1;
         } else {
@@ -20918,6 +22857,52 @@ _SOKOL_PRIVATE void _sg_vk_staging_stream_image_data(_sg_image_t* img, const sg_
     _sg_vk_image_barrier(cmd_buf, img, _SG_VK_ACCESS_TEXTURE);
 }
 
+// record a region update into the per-frame stream command buffer, the source
+// data is copied into the stream staging buffer with its original row- and
+// slice-pitch, so that all slices are copied with a single copy command
+_SOKOL_PRIVATE void _sg_vk_staging_stream_image_region(_sg_image_t* img, const sg_write_image_desc* desc) {
+    SOKOL_ASSERT(_sg.vk.dev);
+    SOKOL_ASSERT(_sg.vk.frame.stream_cmd_buf);
+    SOKOL_ASSERT(img && img->vk.img);
+    SOKOL_ASSERT(desc && desc->src.data.ptr);
+    SOKOL_ASSERT((desc->src.bytes_per_row > 0) && (desc->src.bytes_per_slice > 0));
+    SOKOL_ASSERT(_sg_multiple(desc->src.bytes_per_slice, desc->src.bytes_per_row));
+    const _sg_image_cold_t* cold = _sg_image_cold(img);
+    const size_t copy_size = (size_t)desc->src.bytes_per_slice * (size_t)desc->size.num_slices;
+    SOKOL_ASSERT((desc->src.offset + copy_size) <= desc->src.data.size);
+    const uint8_t* src_ptr = (const uint8_t*)desc->src.data.ptr + desc->src.offset;
+    const uint32_t src_offset = (uint32_t)_sg_vk_shared_buffer_memcpy(&_sg.vk.stage.stream, src_ptr, (uint32_t)copy_size);
+    if (src_offset == _SG_VK_SHARED_BUFFER_OVERFLOW_RESULT) {
+        _SG_ERROR(VULKAN_STAGING_STREAM_BUFFER_OVERFLOW);
+        return;
+    }
+    VkCommandBuffer cmd_buf = _sg.vk.frame.stream_cmd_buf;
+    _SG_STRUCT(VkBufferImageCopy2, region);
+    _SG_STRUCT(VkCopyBufferToImageInfo2, copy_info);
+    _sg_vk_init_vk_image_staging_structs(img, _sg.vk.stage.stream.cur_buf, &region, &copy_info);
+    const int block_dim = _sg_block_dim(cold->pixel_format);
+    const int block_bytesize = _sg_block_bytesize(cold->pixel_format);
+    region.bufferOffset = src_offset;
+    region.bufferRowLength = (uint32_t)((desc->src.bytes_per_row / block_bytesize) * block_dim);
+    region.bufferImageHeight = (uint32_t)((desc->src.bytes_per_slice / desc->src.bytes_per_row) * block_dim);
+    region.imageSubresource.mipLevel = (uint32_t)desc->dst.mip_level;
+    region.imageOffset.x = desc->dst.x;
+    region.imageOffset.y = desc->dst.y;
+    region.imageExtent.width = (uint32_t)desc->size.width;
+    region.imageExtent.height = (uint32_t)desc->size.height;
+    if (cold->type == SG_IMAGETYPE_3D) {
+        region.imageOffset.z = desc->dst.slice;
+        region.imageExtent.depth = (uint32_t)desc->size.num_slices;
+    } else {
+        region.imageSubresource.baseArrayLayer = (uint32_t)desc->dst.slice;
+        region.imageSubresource.layerCount = (uint32_t)desc->size.num_slices;
+    }
+    _sg_vk_image_barrier(cmd_buf, img, _SG_VK_ACCESS_STAGING);
+    vkCmdCopyBufferToImage2(cmd_buf, &copy_info);
+    _sg_stats_inc(vk.num_cmd_copy_buffer_to_image);
+    _sg_vk_image_barrier(cmd_buf, img, _SG_VK_ACCESS_TEXTURE);
+}
+
 // uniform data system
 _SOKOL_PRIVATE void _sg_vk_uniform_init(void) {
     SOKOL_ASSERT(_sg.desc.uniform_buffer_size > 0);
@@ -20949,13 +22934,26 @@ _SOKOL_PRIVATE void _sg_vk_uniform_discard(void) {
     _sg_vk_shared_buffer_discard(&_sg.vk.uniforms.dbuf);
 }
 
-// called from _sg_vk_acquire_frame_command_buffer()
-_SOKOL_PRIVATE void _sg_vk_uniform_after_acquire(void) {
-    _sg_vk_shared_buffer_after_acquire(&_sg.vk.uniforms.dbuf);
-    // reset uniform tracking data
-    for (size_t i = 0; i < SG_MAX_UNIFORMBLOCK_BINDSLOTS; i++) {
-        _sg.vk.uniforms.addr_info[i].address = 0;
-        _sg.vk.uniforms.addr_info[i].range = 0;
+// called from sg_commit() after the frame's command buffer has been submitted
+_SOKOL_PRIVATE void _sg_vk_uniform_grow(uint32_t size) {
+    SOKOL_ASSERT(0 == _sg.vk.uniforms.dbuf.cur_buf);
+    // wait until the GPU no longer reads from any of the uniform buffers
+    vkDeviceWaitIdle(_sg.vk.dev);
+    _sg_vk_shared_buffer_discard(&_sg.vk.uniforms.dbuf);
+    _sg_vk_shared_buffer_init(&_sg.vk.uniforms.dbuf,
+        size,
+        (uint32_t)_sg.vk.dev_props.properties.limits.minUniformBufferOffsetAlignment,
+        _SG_VK_MEMTYPE_UNIFORMS,
+        "shared-uniform-buffer");
+}
+
+// called from _sg_vk_acquire_frame_command_buffer()
+_SOKOL_PRIVATE void _sg_vk_uniform_after_acquire(void) {
+    _sg_vk_shared_buffer_after_acquire(&_sg.vk.uniforms.dbuf);
+    // reset uniform tracking data
+    for (size_t i = 0; i < SG_MAX_UNIFORMBLOCK_BINDSLOTS; i++) {
+        _sg.vk.uniforms.addr_info[i].address = 0;
+        _sg.vk.uniforms.addr_info[i].range = 0;
     }
 }
 
@@ -21822,7 +23820,7 @@ _SOKOL_PRIVATE sg_resource_state _sg_vk_create_buffer(_sg_buffer_t* buf, const s
     SOKOL_ASSERT(buf && desc);
     SOKOL_ASSERT(buf->cmn.size > 0);
     SOKOL_ASSERT(0 == buf->vk.buf);
-    SOKOL_ASSERT(0 == buf->vk.mem);
+    SOKOL_ASSERT(0 == _sg_buffer_cold(buf)->vk.mem);
     SOKOL_ASSERT(0 == buf->vk.dev_addr);
     VkResult res;
     // FIXME: inject external buffer
@@ -21832,7 +23830,7 @@ _SOKOL_PRIVATE sg_resource_state _sg_vk_create_buffer(_sg_buffer_t* buf, const s
     _SG_STRUCT(VkBufferCreateInfo, create_info);
     create_info.sType = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO;
     create_info.size = (VkDeviceSize)buf->cmn.size;
-    create_info.usage = _sg_vk_buffer_usage(&buf->cmn.usage);
+    create_info.usage = _sg_vk_buffer_usage(&_sg_buffer_cold(buf)->usage);
     create_info.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
     res = vkCreateBuffer(_sg.vk.dev, &create_info, 0, &buf->vk.buf);
     if (res != VK_SUCCESS) {
@@ -21845,20 +23843,20 @@ _SOKOL_PRIVATE sg_resource_state _sg_vk_create_buffer(_sg_buffer_t* buf, const s
     if (!_sg_vk_mem_alloc_buffer_device_memory(buf)) {
         return SG_RESOURCESTATE_FAILED;
     }
-    SOKOL_ASSERT(buf->vk.mem);
-    res = vkBindBufferMemory(_sg.vk.dev, buf->vk.buf, buf->vk.mem, 0);
+    SOKOL_ASSERT(_sg_buffer_cold(buf)->vk.mem);
+    res = vkBindBufferMemory(_sg.vk.dev, buf->vk.buf, _sg_buffer_cold(buf)->vk.mem, 0);
     if (res != VK_SUCCESS) {
         _SG_ERROR(VULKAN_BIND_BUFFER_MEMORY_FAILED);
         return SG_RESOURCESTATE_FAILED;
     }
-    if (buf->cmn.usage.storage_buffer) {
+    if (_sg_buffer_cold(buf)->usage.storage_buffer) {
         _SG_STRUCT(VkBufferDeviceAddressInfo, addr_info);
         addr_info.sType = VK_STRUCTURE_TYPE_BUFFER_DEVICE_ADDRESS_INFO;
         addr_info.buffer = buf->vk.buf;
         buf->vk.dev_addr = vkGetBufferDeviceAddress(_sg.vk.dev, &addr_info);
         SOKOL_ASSERT(buf->vk.dev_addr);
     }
-    if (buf->cmn.usage.immutable && desc->data.ptr) {
+    if (_sg_buffer_cold(buf)->usage.immutable && desc->data.ptr) {
         _sg_vk_staging_copy_buffer_data(buf, &desc->data, 0, 0, desc->data.size, false);
     }
     return SG_RESOURCESTATE_VALID;
@@ -21871,9 +23869,9 @@ _SOKOL_PRIVATE void _sg_vk_discard_buffer(_sg_buffer_t* buf) {
         _sg_vk_delete_queue_add(_sg_vk_buffer_destructor, (void*)buf->vk.buf);
         buf->vk.buf = 0;
     }
-    if (buf->vk.mem) {
-        _sg_vk_delete_queue_add(_sg_vk_memory_destructor, (void*)buf->vk.mem);
-        buf->vk.mem = 0;
+    if (_sg_buffer_cold(buf)->vk.mem) {
+        _sg_vk_delete_queue_add(_sg_vk_memory_destructor, (void*)_sg_buffer_cold(buf)->vk.mem);
+        _sg_buffer_cold(buf)->vk.mem = 0;
     }
 }
 
@@ -21885,6 +23883,7 @@ _SOKOL_PRIVATE void _sg_vk_seal_buffer(_sg_buffer_t* buf) {
 
 _SOKOL_PRIVATE sg_resource_state _sg_vk_create_image(_sg_image_t* img, const sg_image_desc* desc) {
     SOKOL_ASSERT(img && desc);
+    _sg_image_cold_t* cold = _sg_image_cold(img);
     VkResult res;
     // FIXME: injected images
 
@@ -21892,22 +23891,22 @@ _SOKOL_PRIVATE sg_resource_state _sg_vk_create_image(_sg_image_t* img, const sg_
 
     _SG_STRUCT(VkImageCreateInfo, create_info);
     create_info.sType = VK_STRUCTURE_TYPE_IMAGE_CREATE_INFO;
-    create_info.flags = _sg_vk_image_create_flags(img->cmn.type);
-    create_info.imageType = _sg_vk_image_type(img->cmn.type);
+    create_info.flags = _sg_vk_image_create_flags(cold->type);
+    create_info.imageType = _sg_vk_image_type(cold->type);
     create_info.format = _sg_vk_format(desc->pixel_format);
-    create_info.extent.width = (uint32_t)img->cmn.width;
-    create_info.extent.height = (uint32_t)img->cmn.height;
+    create_info.extent.width = (uint32_t)cold->width;
+    create_info.extent.height = (uint32_t)cold->height;
     if (desc->type == SG_IMAGETYPE_3D) {
-        create_info.extent.depth = (uint32_t)img->cmn.num_slices;
+        create_info.extent.depth = (uint32_t)cold->num_slices;
         create_info.arrayLayers = 1;
     } else {
         create_info.extent.depth = 1;
-        create_info.arrayLayers = (uint32_t)img->cmn.num_slices;
+        create_info.arrayLayers = (uint32_t)cold->num_slices;
     }
-    create_info.mipLevels = (uint32_t)img->cmn.num_mipmaps;
+    create_info.mipLevels = (uint32_t)cold->num_mipmaps;
     create_info.samples = (VkSampleCountFlagBits)desc->sample_count;
     create_info.tiling = VK_IMAGE_TILING_OPTIMAL;
-    create_info.usage = _sg_vk_image_usage(&img->cmn.usage);
+    create_info.usage = _sg_vk_image_usage(&cold->usage);
     create_info.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
     create_info.initialLayout = VK_IMAGE_LAYOUT_UNDEFINED;
     res = vkCreateImage(_sg.vk.dev, &create_info, 0, &img->vk.img);
@@ -21921,13 +23920,13 @@ _SOKOL_PRIVATE sg_resource_state _sg_vk_create_image(_sg_image_t* img, const sg_
     if (!_sg_vk_mem_alloc_image_device_memory(img)) {
         return SG_RESOURCESTATE_FAILED;
     }
-    SOKOL_ASSERT(img->vk.mem);
-    res = vkBindImageMemory(_sg.vk.dev, img->vk.img, img->vk.mem, 0);
+    SOKOL_ASSERT(cold->vk.mem);
+    res = vkBindImageMemory(_sg.vk.dev, img->vk.img, cold->vk.mem, 0);
     if (res != VK_SUCCESS) {
         _SG_ERROR(VULKAN_BIND_IMAGE_MEMORY_FAILED);
         return SG_RESOURCESTATE_FAILED;
     }
-    if (img->cmn.usage.immutable && desc->data.mip_levels[0].ptr) {
+    if (cold->usage.immutable && desc->data.mip_levels[0].ptr) {
         _sg_vk_staging_copy_image_data(img, &desc->data, false);
     }
     return SG_RESOURCESTATE_VALID;
@@ -21940,9 +23939,9 @@ _SOKOL_PRIVATE void _sg_vk_discard_image(_sg_image_t* img) {
         _sg_vk_delete_queue_add(_sg_vk_image_destructor, (void*)img->vk.img);
         img->vk.img = 0;
     }
-    if (img->vk.mem) {
-        _sg_vk_delete_queue_add(_sg_vk_memory_destructor, (void*)img->vk.mem);
-        img->vk.mem = 0;
+    if (_sg_image_cold(img)->vk.mem) {
+        _sg_vk_delete_queue_add(_sg_vk_memory_destructor, (void*)_sg_image_cold(img)->vk.mem);
+        _sg_image_cold(img)->vk.mem = 0;
     }
 }
 
@@ -22480,6 +24479,7 @@ _SOKOL_PRIVATE sg_resource_state _sg_vk_create_view(_sg_view_t* view, const sg_v
     SOKOL_ASSERT(view && desc);
     SOKOL_ASSERT(_sg.vk.dev);
     SOKOL_ASSERT(0 == view->vk.img_view);
+    const _sg_view_cold_t* cold = _sg_view_cold(view);
     VkResult res;
     _SG_STRUCT(VkDescriptorGetInfoEXT, get_info);
     get_info.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_GET_INFO_EXT;
@@ -22503,31 +24503,31 @@ _SOKOL_PRIVATE sg_resource_state _sg_vk_create_view(_sg_view_t* view, const sg_v
         // create image view object
         const _sg_image_t* img = _sg_image_ref_ptr(&view->cmn.img.ref);
         SOKOL_ASSERT(img->vk.img);
-        SOKOL_ASSERT(view->cmn.img.mip_level_count >= 1);
-        SOKOL_ASSERT(view->cmn.img.slice_count >= 1);
+        SOKOL_ASSERT(cold->mip_level_count >= 1);
+        SOKOL_ASSERT(cold->slice_count >= 1);
         _SG_STRUCT(VkImageViewCreateInfo, create_info);
         create_info.sType = VK_STRUCTURE_TYPE_IMAGE_VIEW_CREATE_INFO;
         create_info.image = img->vk.img;
         if (view->cmn.type == SG_VIEWTYPE_TEXTURE) {
-            create_info.viewType = _sg_vk_texture_image_view_type(img->cmn.type);
+            create_info.viewType = _sg_vk_texture_image_view_type(_sg_image_cold(img)->type);
         } else {
-            create_info.viewType = _sg_vk_attachment_image_view_type(img->cmn.type);
+            create_info.viewType = _sg_vk_attachment_image_view_type(_sg_image_cold(img)->type);
         }
-        create_info.format = _sg_vk_format(img->cmn.pixel_format);
+        create_info.format = _sg_vk_format(_sg_image_cold(img)->pixel_format);
         if (view->cmn.type == SG_VIEWTYPE_DEPTHSTENCILATTACHMENT) {
             create_info.subresourceRange.aspectMask = VK_IMAGE_ASPECT_DEPTH_BIT;
-            if (_sg_is_depth_stencil_format(img->cmn.pixel_format)) {
+            if (_sg_is_depth_stencil_format(_sg_image_cold(img)->pixel_format)) {
                 create_info.subresourceRange.aspectMask |= VK_IMAGE_ASPECT_STENCIL_BIT;
             }
-        } else if (_sg_is_depth_or_depth_stencil_format(img->cmn.pixel_format)) {
+        } else if (_sg_is_depth_or_depth_stencil_format(_sg_image_cold(img)->pixel_format)) {
             create_info.subresourceRange.aspectMask = VK_IMAGE_ASPECT_DEPTH_BIT;
         } else {
             create_info.subresourceRange.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
         }
         create_info.subresourceRange.baseMipLevel = (uint32_t)view->cmn.img.mip_level;
-        create_info.subresourceRange.levelCount = (uint32_t)view->cmn.img.mip_level_count;
+        create_info.subresourceRange.levelCount = (uint32_t)cold->mip_level_count;
         create_info.subresourceRange.baseArrayLayer = (uint32_t)view->cmn.img.slice;
-        create_info.subresourceRange.layerCount = (uint32_t)view->cmn.img.slice_count;
+        create_info.subresourceRange.layerCount = (uint32_t)cold->slice_count;
         res = vkCreateImageView(_sg.vk.dev, &create_info, 0, &view->vk.img_view);
         if (res != VK_SUCCESS) {
             _SG_ERROR(VULKAN_CREATE_IMAGE_VIEW_FAILED);
@@ -22705,7 +24705,7 @@ _SOKOL_PRIVATE void _sg_vk_begin_render_pass(VkCommandBuffer cmd_buf, const sg_p
         if (atts->ds_view) {
             const _sg_view_t* ds_view = atts->ds_view;
             const _sg_image_t* ds_image = _sg_image_ref_ptr(&ds_view->cmn.img.ref);
-            const bool has_stencil = _sg_is_depth_stencil_format(ds_image->cmn.pixel_format);
+            const bool has_stencil = _sg_is_depth_stencil_format(_sg_image_cold(ds_image)->pixel_format);
             VkImageView vk_ds_view = ds_view->vk.img_view;
             _sg_vk_init_depth_attachment_info(&depth_att_info, &action->depth, vk_ds_view);
             render_info.pDepthAttachment = &depth_att_info;
@@ -22876,7 +24876,7 @@ _SOKOL_PRIVATE void _sg_vk_dispatch(int num_groups_x, int num_groups_y, int num_
 
 _SOKOL_PRIVATE void _sg_vk_update_buffer(_sg_buffer_t* buf, const sg_range* data) {
     SOKOL_ASSERT(buf && data && data->ptr && (data->size > 0));
-    if (buf->cmn.usage.stream_update) {
+    if (_sg_buffer_cold(buf)->usage.stream_update) {
         _sg_vk_acquire_frame_command_buffers();
         _sg_vk_staging_stream_buffer_data(buf, data, 0, 0, data->size);
     } else {
@@ -22887,17 +24887,18 @@ _SOKOL_PRIVATE void _sg_vk_update_buffer(_sg_buffer_t* buf, const sg_range* data
 _SOKOL_PRIVATE void _sg_vk_append_buffer(_sg_buffer_t* buf, const sg_range* data, bool new_frame) {
     SOKOL_ASSERT(buf && data && data->ptr && (data->size > 0));
     _SOKOL_UNUSED(new_frame);
-    if (buf->cmn.usage.stream_update) {
+    const _sg_buffer_cold_t* cold = _sg_buffer_cold(buf);
+    if (cold->usage.stream_update) {
         _sg_vk_acquire_frame_command_buffers();
-        _sg_vk_staging_stream_buffer_data(buf, data, 0, (size_t)buf->cmn.append_pos, data->size);
+        _sg_vk_staging_stream_buffer_data(buf, data, 0, (size_t)cold->append_pos, data->size);
     } else {
-        _sg_vk_staging_copy_buffer_data(buf, data, 0, (size_t)buf->cmn.append_pos, data->size, true);
+        _sg_vk_staging_copy_buffer_data(buf, data, 0, (size_t)cold->append_pos, data->size, true);
     }
 }
 
 _SOKOL_PRIVATE void _sg_vk_update_image(_sg_image_t* img, const sg_image_data* data) {
     SOKOL_ASSERT(img && data);
-    if (img->cmn.usage.stream_update) {
+    if (_sg_image_cold(img)->usage.stream_update) {
         _sg_vk_acquire_frame_command_buffers();
         _sg_vk_staging_stream_image_data(img, data);
     } else {
@@ -22905,6 +24906,16 @@ _SOKOL_PRIVATE void _sg_vk_update_image(_sg_image_t* img, const sg_image_data* d
     }
 }
 
+_SOKOL_PRIVATE void _sg_vk_update_image_region(_sg_image_t* img, const sg_write_image_desc* desc) {
+    SOKOL_ASSERT(img && desc);
+    SOKOL_ASSERT(_sg_image_cold(img)->usage.region_update);
+    // NOTE: region updates may happen many times per frame (e.g. once per
+    // dirty atlas rectangle), so they go through the non-blocking stream
+    // staging buffer instead of the blocking copy staging buffer
+    _sg_vk_acquire_frame_command_buffers();
+    _sg_vk_staging_stream_image_region(img, desc);
+}
+
 _SOKOL_PRIVATE void _sg_vk_write_buffer_unsealed(_sg_buffer_t* buf, const sg_write_buffer_desc* desc) {
     SOKOL_ASSERT(buf && desc);
     SOKOL_ASSERT(SG_RESOURCESTATE_UNSEALED == buf->slot.state);
@@ -23392,6 +25403,18 @@ static inline void _sg_commit(void) {
     #endif
 }
 
+static inline void _sg_grow_uniform_buffer(uint32_t size) {
+    #if defined(SOKOL_METAL)
+    _sg_mtl_grow_uniform_buffer(size);
+    #elif defined(SOKOL_WGPU)
+    _sg_wgpu_grow_uniform_buffer(size);
+    #elif defined(SOKOL_VULKAN)
+    _sg_vk_uniform_grow(size);
+    #else
+    _SOKOL_UNUSED(size);
+    #endif
+}
+
 static inline void _sg_update_buffer(_sg_buffer_t* buf, const sg_range* data) {
     #if defined(_SOKOL_ANY_GL)
     _sg_gl_update_buffer(buf, data);
@@ -23428,6 +25451,34 @@ static inline void _sg_append_buffer(_sg_buffer_t* buf, const sg_range* data, bo
     #endif
 }
 
+// returns a null pointer if the backend can't map the buffer directly
+static inline void* _sg_map_buffer(_sg_buffer_t* buf, size_t size) {
+    #if defined(_SOKOL_ANY_GL)
+    return _sg_gl_map_buffer(buf, size);
+    #elif defined(SOKOL_METAL)
+    return _sg_mtl_map_buffer(buf, size);
+    #elif defined(SOKOL_D3D11)
+    return _sg_d3d11_map_buffer(buf, size);
+    #else
+    _SOKOL_UNUSED(buf);
+    _SOKOL_UNUSED(size);
+    return 0;
+    #endif
+}
+
+static inline void _sg_unmap_buffer(_sg_buffer_t* buf, size_t size) {
+    #if defined(_SOKOL_ANY_GL)
+    _sg_gl_unmap_buffer(buf, size);
+    #elif defined(SOKOL_METAL)
+    _sg_mtl_unmap_buffer(buf, size);
+    #elif defined(SOKOL_D3D11)
+    _sg_d3d11_unmap_buffer(buf, size);
+    #else
+    _SOKOL_UNUSED(buf);
+    _SOKOL_UNUSED(size);
+    #endif
+}
+
 static inline void _sg_update_image(_sg_image_t* img, const sg_image_data* data) {
     #if defined(_SOKOL_ANY_GL)
     _sg_gl_update_image(img, data);
@@ -23464,6 +25515,24 @@ static inline void _sg_write_buffer_unsealed(_sg_buffer_t* buf, const sg_write_b
     #endif
 }
 
+static inline void _sg_update_image_region(_sg_image_t* img, const sg_write_image_desc* desc) {
+    #if defined(_SOKOL_ANY_GL)
+    _sg_gl_update_image_region(img, desc);
+    #elif defined(SOKOL_METAL)
+    _sg_mtl_update_image_region(img, desc);
+    #elif defined(SOKOL_D3D11)
+    _sg_d3d11_update_image_region(img, desc);
+    #elif defined(SOKOL_WGPU)
+    _sg_wgpu_update_image_region(img, desc);
+    #elif defined(SOKOL_VULKAN)
+    _sg_vk_update_image_region(img, desc);
+    #elif defined(SOKOL_DUMMY_BACKEND)
+    _sg_dummy_update_image_region(img, desc);
+    #else
+    #error("INVALID BACKEND");
+    #endif
+}
+
 static inline void _sg_write_image_unsealed(_sg_image_t* img, const sg_write_image_desc* desc) {
     #if defined(_SOKOL_ANY_GL)
     _sg_gl_write_image_unsealed(img, desc);
@@ -23532,6 +25601,140 @@ static inline void _sg_pop_debug_group(void) {
     #endif
 }
 
+static inline bool _sg_read_buffer(_sg_readback_t* rb, _sg_buffer_t* buf, const sg_read_buffer_desc* desc) {
+    #if defined(_SOKOL_ANY_GL)
+    return _sg_gl_read_buffer(rb, buf, desc);
+    #elif defined(SOKOL_DUMMY_BACKEND)
+    return _sg_dummy_read_buffer(rb, buf, desc);
+    #else
+    _SOKOL_UNUSED(rb);
+    _SOKOL_UNUSED(buf);
+    _SOKOL_UNUSED(desc);
+    return false;
+    #endif
+}
+
+static inline bool _sg_read_image(_sg_readback_t* rb, _sg_image_t* img, const sg_read_image_desc* desc) {
+    #if defined(_SOKOL_ANY_GL)
+    return _sg_gl_read_image(rb, img, desc);
+    #elif defined(SOKOL_DUMMY_BACKEND)
+    return _sg_dummy_read_image(rb, img, desc);
+    #else
+    _SOKOL_UNUSED(rb);
+    _SOKOL_UNUSED(img);
+    _SOKOL_UNUSED(desc);
+    return false;
+    #endif
+}
+
+static inline sg_readback_state _sg_poll_readback(_sg_readback_t* rb) {
+    #if defined(_SOKOL_ANY_GL)
+    return _sg_gl_poll_readback(rb);
+    #elif defined(SOKOL_DUMMY_BACKEND)
+    return _sg_dummy_poll_readback(rb);
+    #else
+    _SOKOL_UNUSED(rb);
+    return SG_READBACKSTATE_FAILED;
+    #endif
+}
+
+static inline void _sg_discard_readback(_sg_readback_t* rb) {
+    #if defined(_SOKOL_ANY_GL)
+    _sg_gl_discard_readback(rb);
+    #elif defined(SOKOL_DUMMY_BACKEND)
+    _sg_dummy_discard_readback(rb);
+    #else
+    _SOKOL_UNUSED(rb);
+    #endif
+}
+
+static inline void _sg_begin_timer(_sg_timer_frame_t* frame) {
+    #if defined(_SOKOL_ANY_GL)
+    _sg_gl_begin_timer(frame);
+    #elif defined(SOKOL_DUMMY_BACKEND)
+    _sg_dummy_begin_timer(frame);
+    #else
+    _SOKOL_UNUSED(frame);
+    #endif
+}
+
+static inline void _sg_end_timer(_sg_timer_frame_t* frame) {
+    #if defined(_SOKOL_ANY_GL)
+    _sg_gl_end_timer(frame);
+    #elif defined(SOKOL_DUMMY_BACKEND)
+    _sg_dummy_end_timer(frame);
+    #else
+    _SOKOL_UNUSED(frame);
+    #endif
+}
+
+static inline bool _sg_poll_timer(_sg_timer_frame_t* frame, uint64_t* out_duration_ns) {
+    #if defined(_SOKOL_ANY_GL)
+    return _sg_gl_poll_timer(frame, out_duration_ns);
+    #elif defined(SOKOL_DUMMY_BACKEND)
+    return _sg_dummy_poll_timer(frame, out_duration_ns);
+    #else
+    _SOKOL_UNUSED(frame);
+    _SOKOL_UNUSED(out_duration_ns);
+    return false;
+    #endif
+}
+
+static inline void _sg_discard_timer(_sg_timer_frame_t* frame) {
+    #if defined(_SOKOL_ANY_GL)
+    _sg_gl_discard_timer(frame);
+    #elif defined(SOKOL_DUMMY_BACKEND)
+    _sg_dummy_discard_timer(frame);
+    #else
+    _SOKOL_UNUSED(frame);
+    #endif
+}
+
+static inline void _sg_begin_occlusion_query(_sg_occlusion_query_t* query, _sg_occlusion_query_frame_t* frame) {
+    #if defined(_SOKOL_ANY_GL)
+    _sg_gl_begin_occlusion_query(query, frame);
+    #elif defined(SOKOL_DUMMY_BACKEND)
+    _sg_dummy_begin_occlusion_query(query, frame);
+    #else
+    _SOKOL_UNUSED(query);
+    _SOKOL_UNUSED(frame);
+    #endif
+}
+
+static inline void _sg_end_occlusion_query(_sg_occlusion_query_t* query, _sg_occlusion_query_frame_t* frame) {
+    #if defined(_SOKOL_ANY_GL)
+    _sg_gl_end_occlusion_query(query, frame);
+    #elif defined(SOKOL_DUMMY_BACKEND)
+    _sg_dummy_end_occlusion_query(query, frame);
+    #else
+    _SOKOL_UNUSED(query);
+    _SOKOL_UNUSED(frame);
+    #endif
+}
+
+static inline bool _sg_poll_occlusion_query(_sg_occlusion_query_t* query, _sg_occlusion_query_frame_t* frame, uint64_t* out_num_samples) {
+    #if defined(_SOKOL_ANY_GL)
+    return _sg_gl_poll_occlusion_query(query, frame, out_num_samples);
+    #elif defined(SOKOL_DUMMY_BACKEND)
+    return _sg_dummy_poll_occlusion_query(query, frame, out_num_samples);
+    #else
+    _SOKOL_UNUSED(query);
+    _SOKOL_UNUSED(frame);
+    _SOKOL_UNUSED(out_num_samples);
+    return false;
+    #endif
+}
+
+static inline void _sg_discard_occlusion_query(_sg_occlusion_query_frame_t* frame) {
+    #if defined(_SOKOL_ANY_GL)
+    _sg_gl_discard_occlusion_query(frame);
+    #elif defined(SOKOL_DUMMY_BACKEND)
+    _sg_dummy_discard_occlusion_query(frame);
+    #else
+    _SOKOL_UNUSED(frame);
+    #endif
+}
+
 // ██    ██  █████  ██      ██ ██████   █████  ████████ ██  ██████  ███    ██
 // ██    ██ ██   ██ ██      ██ ██   ██ ██   ██    ██    ██ ██    ██ ████   ██
 // ██    ██ ███████ ██      ██ ██   ██ ███████    ██    ██ ██    ██ ██ ██  ██
@@ -23562,6 +25765,10 @@ _SOKOL_PRIVATE bool _sg_one(bool b0, bool b1, bool b2) {
     return (b0 && !b1 && !b2) || (!b0 && b1 && !b2) || (!b0 && !b1 && b2);
 }
 
+_SOKOL_PRIVATE bool _sg_one4(bool b0, bool b1, bool b2, bool b3) {
+    return (b0 && !b1 && !b2 && !b3) || (!b0 && _sg_one(b1, b2, b3));
+}
+
 _SOKOL_PRIVATE bool _sg_validate_buffer_desc(const sg_buffer_desc* desc) {
     #if !defined(SOKOL_DEBUG)
         _SOKOL_UNUSED(desc);
@@ -23641,7 +25848,7 @@ _SOKOL_PRIVATE bool _sg_validate_image_desc(const sg_image_desc* desc) {
         _sg_validate_begin();
         _SG_VALIDATE(desc->_start_canary == 0, VALIDATE_IMAGEDESC_CANARY);
         _SG_VALIDATE(desc->_end_canary == 0, VALIDATE_IMAGEDESC_CANARY);
-        _SG_VALIDATE(_sg_one(usg->immutable, usg->dynamic_update, usg->stream_update), VALIDATE_IMAGEDESC_IMMUTABLE_DYNAMIC_STREAM);
+        _SG_VALIDATE(_sg_one4(usg->immutable, usg->dynamic_update, usg->stream_update, usg->region_update), VALIDATE_IMAGEDESC_IMMUTABLE_DYNAMIC_STREAM);
         _SG_VALIDATE(!(usg->color_attachment && usg->depth_stencil_attachment), VALIDATE_IMAGEDESC_ATTACHMENT_COLOR_DEPTH_STENCIL);
         switch (desc->type) {
             case SG_IMAGETYPE_2D:
@@ -24268,32 +26475,32 @@ _SOKOL_PRIVATE bool _sg_validate_view_desc(const sg_view_desc* desc) {
             switch (view_type) {
                 case SG_VIEWTYPE_STORAGEBUFFER:
                     SOKOL_ASSERT(buf);
-                    _SG_VALIDATE(buf->cmn.usage.storage_buffer, VALIDATE_VIEWDESC_STORAGEBUFFER_USAGE);
+                    _SG_VALIDATE(_sg_buffer_cold(buf)->usage.storage_buffer, VALIDATE_VIEWDESC_STORAGEBUFFER_USAGE);
                     break;
                 case SG_VIEWTYPE_STORAGEIMAGE:
                     SOKOL_ASSERT(img);
-                    _SG_VALIDATE(img->cmn.usage.storage_image, VALIDATE_VIEWDESC_STORAGEIMAGE_USAGE);
-                    _SG_VALIDATE(_sg_is_valid_storage_image_format(img->cmn.pixel_format), VALIDATE_VIEWDESC_STORAGEIMAGE_PIXELFORMAT);
+                    _SG_VALIDATE(_sg_image_cold(img)->usage.storage_image, VALIDATE_VIEWDESC_STORAGEIMAGE_USAGE);
+                    _SG_VALIDATE(_sg_is_valid_storage_image_format(_sg_image_cold(img)->pixel_format), VALIDATE_VIEWDESC_STORAGEIMAGE_PIXELFORMAT);
                     break;
                 case SG_VIEWTYPE_TEXTURE:
                     if (!_sg.features.msaa_texture_bindings) {
-                        _SG_VALIDATE(img->cmn.sample_count == 1, VALIDATE_VIEWDESC_TEXTURE_EXPECT_NO_MSAA);
+                        _SG_VALIDATE(_sg_image_cold(img)->sample_count == 1, VALIDATE_VIEWDESC_TEXTURE_EXPECT_NO_MSAA);
                     }
                     break;
                 case SG_VIEWTYPE_COLORATTACHMENT:
                     SOKOL_ASSERT(img);
-                    _SG_VALIDATE(img->cmn.usage.color_attachment, VALIDATE_VIEWDESC_COLORATTACHMENT_USAGE);
-                    _SG_VALIDATE(_sg_is_valid_attachment_color_format(img->cmn.pixel_format), VALIDATE_VIEWDESC_COLORATTACHMENT_PIXELFORMAT);
+                    _SG_VALIDATE(_sg_image_cold(img)->usage.color_attachment, VALIDATE_VIEWDESC_COLORATTACHMENT_USAGE);
+                    _SG_VALIDATE(_sg_is_valid_attachment_color_format(_sg_image_cold(img)->pixel_format), VALIDATE_VIEWDESC_COLORATTACHMENT_PIXELFORMAT);
                     break;
                 case SG_VIEWTYPE_RESOLVEATTACHMENT:
                     SOKOL_ASSERT(img);
-                    _SG_VALIDATE(img->cmn.usage.resolve_attachment, VALIDATE_VIEWDESC_RESOLVEATTACHMENT_USAGE);
-                    _SG_VALIDATE(img->cmn.sample_count == 1, VALIDATE_VIEWDESC_RESOLVEATTACHMENT_SAMPLECOUNT);
+                    _SG_VALIDATE(_sg_image_cold(img)->usage.resolve_attachment, VALIDATE_VIEWDESC_RESOLVEATTACHMENT_USAGE);
+                    _SG_VALIDATE(_sg_image_cold(img)->sample_count == 1, VALIDATE_VIEWDESC_RESOLVEATTACHMENT_SAMPLECOUNT);
                     break;
                 case SG_VIEWTYPE_DEPTHSTENCILATTACHMENT:
                     SOKOL_ASSERT(img);
-                    _SG_VALIDATE(img->cmn.usage.depth_stencil_attachment, VALIDATE_VIEWDESC_DEPTHSTENCILATTACHMENT_USAGE);
-                    _SG_VALIDATE(_sg_is_valid_attachment_depth_format(img->cmn.pixel_format), VALIDATE_VIEWDESC_DEPTHSTENCILATTACHMENT_PIXELFORMAT);
+                    _SG_VALIDATE(_sg_image_cold(img)->usage.depth_stencil_attachment, VALIDATE_VIEWDESC_DEPTHSTENCILATTACHMENT_USAGE);
+                    _SG_VALIDATE(_sg_is_valid_attachment_depth_format(_sg_image_cold(img)->pixel_format), VALIDATE_VIEWDESC_DEPTHSTENCILATTACHMENT_PIXELFORMAT);
                     break;
                 default:
                     SOKOL_UNREACHABLE;
@@ -24305,14 +26512,14 @@ _SOKOL_PRIVATE bool _sg_validate_view_desc(const sg_view_desc* desc) {
                 _SG_VALIDATE(_sg_multiple_u64((uint64_t)buf_desc->offset, 256), VALIDATE_VIEWDESC_STORAGEBUFFER_OFFSET_MULTIPLE_256);
             } else if (img_desc) {
                 SOKOL_ASSERT(img);
-                _SG_VALIDATE((img_desc->mip_level >= 0) && (img_desc->mip_level < img->cmn.num_mipmaps), VALIDATE_VIEWDESC_IMAGE_MIPLEVEL);
-                if (img->cmn.type == SG_IMAGETYPE_2D) {
+                _SG_VALIDATE((img_desc->mip_level >= 0) && (img_desc->mip_level < _sg_image_cold(img)->num_mipmaps), VALIDATE_VIEWDESC_IMAGE_MIPLEVEL);
+                if (_sg_image_cold(img)->type == SG_IMAGETYPE_2D) {
                     _SG_VALIDATE(img_desc->slice == 0, VALIDATE_VIEWDESC_IMAGE_2D_SLICE);
-                } else if (img->cmn.type == SG_IMAGETYPE_CUBE) {
+                } else if (_sg_image_cold(img)->type == SG_IMAGETYPE_CUBE) {
                     _SG_VALIDATE((img_desc->slice >= 0) && (img_desc->slice < 6), VALIDATE_VIEWDESC_IMAGE_CUBEMAP_SLICE);
-                } else if (img->cmn.type == SG_IMAGETYPE_ARRAY) {
-                    _SG_VALIDATE((img_desc->slice >= 0) && (img_desc->slice < img->cmn.num_slices), VALIDATE_VIEWDESC_IMAGE_ARRAY_SLICE);
-                } else if (img->cmn.type == SG_IMAGETYPE_3D) {
+                } else if (_sg_image_cold(img)->type == SG_IMAGETYPE_ARRAY) {
+                    _SG_VALIDATE((img_desc->slice >= 0) && (img_desc->slice < _sg_image_cold(img)->num_slices), VALIDATE_VIEWDESC_IMAGE_ARRAY_SLICE);
+                } else if (_sg_image_cold(img)->type == SG_IMAGETYPE_3D) {
                     _SG_VALIDATE(img_desc->slice == 0, VALIDATE_VIEWDESC_IMAGE_3D_SLICE);
                 }
             } else if (tex_desc) {
@@ -24320,14 +26527,14 @@ _SOKOL_PRIVATE bool _sg_validate_view_desc(const sg_view_desc* desc) {
                 // NOTE: it doesn't matter here if the mip/slice count is default-zero!
                 int max_mip_level = tex_desc->mip_levels.base + tex_desc->mip_levels.count;
                 int max_slice = tex_desc->slices.base + tex_desc->slices.count;
-                _SG_VALIDATE((tex_desc->mip_levels.base >= 0) && (max_mip_level <= img->cmn.num_mipmaps), VALIDATE_VIEWDESC_TEXTURE_MIPLEVELS);
-                if (img->cmn.type == SG_IMAGETYPE_2D) {
+                _SG_VALIDATE((tex_desc->mip_levels.base >= 0) && (max_mip_level <= _sg_image_cold(img)->num_mipmaps), VALIDATE_VIEWDESC_TEXTURE_MIPLEVELS);
+                if (_sg_image_cold(img)->type == SG_IMAGETYPE_2D) {
                     _SG_VALIDATE((tex_desc->slices.base == 0) && (max_slice <= 1), VALIDATE_VIEWDESC_TEXTURE_2D_SLICES);
-                } else if (img->cmn.type == SG_IMAGETYPE_CUBE) {
+                } else if (_sg_image_cold(img)->type == SG_IMAGETYPE_CUBE) {
                     _SG_VALIDATE((tex_desc->slices.base == 0) && (max_slice <= 1), VALIDATE_VIEWDESC_TEXTURE_CUBEMAP_SLICES);
-                } else if (img->cmn.type == SG_IMAGETYPE_ARRAY) {
-                    _SG_VALIDATE((tex_desc->slices.base >= 0) && (max_slice <= img->cmn.num_slices), VALIDATE_VIEWDESC_TEXTURE_ARRAY_SLICES);
-                } else if (img->cmn.type == SG_IMAGETYPE_3D) {
+                } else if (_sg_image_cold(img)->type == SG_IMAGETYPE_ARRAY) {
+                    _SG_VALIDATE((tex_desc->slices.base >= 0) && (max_slice <= _sg_image_cold(img)->num_slices), VALIDATE_VIEWDESC_TEXTURE_ARRAY_SLICES);
+                } else if (_sg_image_cold(img)->type == SG_IMAGETYPE_3D) {
                     _SG_VALIDATE((tex_desc->slices.base == 0) && (max_slice <= 1), VALIDATE_VIEWDESC_TEXTURE_3D_SLICES);
                 }
             }
@@ -24449,11 +26656,11 @@ _SOKOL_PRIVATE bool _sg_validate_begin_pass(const sg_pass* pass) {
                                 if (color_width == -1) {
                                     color_width = _sg_image_view_dim(view).width;
                                     color_height = _sg_image_view_dim(view).height;
-                                    color_sample_count = img->cmn.sample_count;
+                                    color_sample_count = _sg_image_cold(img)->sample_count;
                                 } else {
                                     _SG_VALIDATE(color_width == _sg_image_view_dim(view).width, VALIDATE_BEGINPASS_COLORATTACHMENTVIEW_SIZES);
                                     _SG_VALIDATE(color_height == _sg_image_view_dim(view).height, VALIDATE_BEGINPASS_COLORATTACHMENTVIEW_SIZES);
-                                    _SG_VALIDATE(color_sample_count == img->cmn.sample_count, VALIDATE_BEGINPASS_COLORATTACHMENTVIEW_SAMPLECOUNTS_EQUAL);
+                                    _SG_VALIDATE(color_sample_count == _sg_image_cold(img)->sample_count, VALIDATE_BEGINPASS_COLORATTACHMENTVIEW_SAMPLECOUNTS_EQUAL);
                                 }
                             }
                         }
@@ -24512,7 +26719,7 @@ _SOKOL_PRIVATE bool _sg_validate_begin_pass(const sg_pass* pass) {
                                 if (color_width != -1) {
                                     _SG_VALIDATE(color_width == _sg_image_view_dim(view).width, VALIDATE_BEGINPASS_DEPTHSTENCILATTACHMENTVIEW_SIZES);
                                     _SG_VALIDATE(color_height == _sg_image_view_dim(view).height, VALIDATE_BEGINPASS_DEPTHSTENCILATTACHMENTVIEW_SIZES);
-                                    _SG_VALIDATE(color_sample_count == img->cmn.sample_count, VALIDATE_BEGINPASS_DEPTHSTENCILATTACHMENTVIEW_SAMPLECOUNT);
+                                    _SG_VALIDATE(color_sample_count == _sg_image_cold(img)->sample_count, VALIDATE_BEGINPASS_DEPTHSTENCILATTACHMENTVIEW_SAMPLECOUNT);
                                 }
                             }
                         }
@@ -24646,8 +26853,8 @@ _SOKOL_PRIVATE bool _sg_validate_apply_pipeline(sg_pipeline pip_id) {
                         const _sg_image_t* clr_img = _sg_image_ref_ptr(&clr_view->cmn.img.ref);
                         SOKOL_ASSERT(clr_img);
                         _SG_VALIDATE(clr_img->slot.state == SG_RESOURCESTATE_VALID, VALIDATE_APIP_COLORATTACHMENTS_IMAGE_VALID);
-                        _SG_VALIDATE(pip->cmn.colors[i].pixel_format == clr_img->cmn.pixel_format, VALIDATE_APIP_COLORATTACHMENTS_FORMAT);
-                        _SG_VALIDATE(pip->cmn.sample_count == clr_img->cmn.sample_count, VALIDATE_APIP_ATTACHMENT_SAMPLE_COUNT);
+                        _SG_VALIDATE(pip->cmn.colors[i].pixel_format == _sg_image_cold(clr_img)->pixel_format, VALIDATE_APIP_COLORATTACHMENTS_FORMAT);
+                        _SG_VALIDATE(pip->cmn.sample_count == _sg_image_cold(clr_img)->sample_count, VALIDATE_APIP_ATTACHMENT_SAMPLE_COUNT);
                     }
                     const _sg_view_t* ds_view = atts_ptrs.ds_view;
                     if (ds_view) {
@@ -24655,8 +26862,8 @@ _SOKOL_PRIVATE bool _sg_validate_apply_pipeline(sg_pipeline pip_id) {
                         const _sg_image_t* ds_img = _sg_image_ref_ptr(&ds_view->cmn.img.ref);
                         SOKOL_ASSERT(ds_img);
                         _SG_VALIDATE(ds_img->slot.state == SG_RESOURCESTATE_VALID, VALIDATE_APIP_DEPTHSTENCILATTACHMENT_IMAGE_VALID);
-                        _SG_VALIDATE(pip->cmn.depth.pixel_format == ds_img->cmn.pixel_format, VALIDATE_APIP_DEPTHSTENCILATTACHMENT_FORMAT);
-                        _SG_VALIDATE(pip->cmn.sample_count == ds_img->cmn.sample_count, VALIDATE_APIP_ATTACHMENT_SAMPLE_COUNT);
+                        _SG_VALIDATE(pip->cmn.depth.pixel_format == _sg_image_cold(ds_img)->pixel_format, VALIDATE_APIP_DEPTHSTENCILATTACHMENT_FORMAT);
+                        _SG_VALIDATE(pip->cmn.sample_count == _sg_image_cold(ds_img)->sample_count, VALIDATE_APIP_ATTACHMENT_SAMPLE_COUNT);
                     } else {
                         _SG_VALIDATE(pip->cmn.depth.pixel_format == SG_PIXELFORMAT_NONE, VALIDATE_APIP_DEPTHSTENCILATTACHMENT_FORMAT);
                     }
@@ -24725,8 +26932,9 @@ _SOKOL_PRIVATE bool _sg_validate_apply_bindings(const sg_bindings* bindings) {
                         _SG_VALIDATE(buf != 0, VALIDATE_ABND_VBUF_ALIVE);
                         // NOTE: state != VALID is legal and skips rendering!
                         if (buf && buf->slot.state == SG_RESOURCESTATE_VALID) {
-                            _SG_VALIDATE(buf->cmn.usage.vertex_buffer, VALIDATE_ABND_VBUF_USAGE);
-                            _SG_VALIDATE(!buf->cmn.append_overflow, VALIDATE_ABND_VBUF_OVERFLOW);
+                            _SG_VALIDATE(_sg_buffer_cold(buf)->usage.vertex_buffer, VALIDATE_ABND_VBUF_USAGE);
+                            _SG_VALIDATE(!_sg_buffer_cold(buf)->append_overflow, VALIDATE_ABND_VBUF_OVERFLOW);
+                            _SG_VALIDATE(!_sg_buffer_cold(buf)->mapped, VALIDATE_ABND_VBUF_MAPPED);
                         }
                     }
                 }
@@ -24750,8 +26958,9 @@ _SOKOL_PRIVATE bool _sg_validate_apply_bindings(const sg_bindings* bindings) {
                 _SG_VALIDATE(buf != 0, VALIDATE_ABND_IBUF_ALIVE);
                 // NOTE: state != VALID is legal and skips rendering!
                 if (buf && buf->slot.state == SG_RESOURCESTATE_VALID) {
-                    _SG_VALIDATE(buf->cmn.usage.index_buffer, VALIDATE_ABND_IBUF_USAGE);
-                    _SG_VALIDATE(!buf->cmn.append_overflow, VALIDATE_ABND_IBUF_OVERFLOW);
+                    _SG_VALIDATE(_sg_buffer_cold(buf)->usage.index_buffer, VALIDATE_ABND_IBUF_USAGE);
+                    _SG_VALIDATE(!_sg_buffer_cold(buf)->append_overflow, VALIDATE_ABND_IBUF_OVERFLOW);
+                    _SG_VALIDATE(!_sg_buffer_cold(buf)->mapped, VALIDATE_ABND_IBUF_MAPPED);
                 }
             }
         }
@@ -24773,13 +26982,13 @@ _SOKOL_PRIVATE bool _sg_validate_apply_bindings(const sg_bindings* bindings) {
                                 // NOTE: an invalid image ref is allowed and skips rendering
                                 if (_sg_image_ref_valid(&view->cmn.img.ref)) {
                                     const _sg_image_t* img = _sg_image_ref_ptr(&view->cmn.img.ref);
-                                    _SG_VALIDATE(img->cmn.type == shd->cmn.views[i].image_type, VALIDATE_ABND_TEXVIEW_IMAGETYPE_MISMATCH);
+                                    _SG_VALIDATE(_sg_image_cold(img)->type == shd->cmn.views[i].image_type, VALIDATE_ABND_TEXVIEW_IMAGETYPE_MISMATCH);
                                     if (shd->cmn.views[i].multisampled) {
-                                        _SG_VALIDATE(img->cmn.sample_count > 1, VALIDATE_ABND_TEXVIEW_EXPECTED_MULTISAMPLED_IMAGE);
+                                        _SG_VALIDATE(_sg_image_cold(img)->sample_count > 1, VALIDATE_ABND_TEXVIEW_EXPECTED_MULTISAMPLED_IMAGE);
                                     } else {
-                                        _SG_VALIDATE(img->cmn.sample_count == 1, VALIDATE_ABND_TEXVIEW_EXPECTED_NON_MULTISAMPLED_IMAGE);
+                                        _SG_VALIDATE(_sg_image_cold(img)->sample_count == 1, VALIDATE_ABND_TEXVIEW_EXPECTED_NON_MULTISAMPLED_IMAGE);
                                     }
-                                    const _sg_pixelformat_info_t* info = &_sg.formats[img->cmn.pixel_format];
+                                    const _sg_pixelformat_info_t* info = &_sg.formats[_sg_image_cold(img)->pixel_format];
                                     switch (shd->cmn.views[i].sample_type) {
                                         case SG_IMAGESAMPLETYPE_FLOAT:
                                             _SG_VALIDATE(info->filter, VALIDATE_ABND_TEXVIEW_EXPECTED_FILTERABLE_IMAGE);
@@ -24798,7 +27007,7 @@ _SOKOL_PRIVATE bool _sg_validate_apply_bindings(const sg_bindings* bindings) {
                                 if (_sg_buffer_ref_valid(&view->cmn.buf.ref)) {
                                     const _sg_buffer_t* buf = _sg_buffer_ref_ptr(&view->cmn.buf.ref);
                                     if (!shd->cmn.views[i].sbuf_readonly) {
-                                        _SG_VALIDATE(buf->cmn.usage.immutable, VALIDATE_ABND_SBVIEW_READWRITE_IMMUTABLE);
+                                        _SG_VALIDATE(_sg_buffer_cold(buf)->usage.immutable, VALIDATE_ABND_SBVIEW_READWRITE_IMMUTABLE);
                                     }
                                 }
                             } else if (shd->cmn.views[i].view_type == SG_VIEWTYPE_STORAGEIMAGE) {
@@ -24809,8 +27018,8 @@ _SOKOL_PRIVATE bool _sg_validate_apply_bindings(const sg_bindings* bindings) {
                                 // NOTE: an invalid image ref is allowed and skips rendering
                                 if (_sg_image_ref_valid(&view->cmn.img.ref)) {
                                     const _sg_image_t* img = _sg_image_ref_ptr(&view->cmn.img.ref);
-                                    _SG_VALIDATE(img->cmn.type == shd->cmn.views[i].image_type, VALIDATE_ABND_SIMGVIEW_IMAGETYPE_MISMATCH);
-                                    _SG_VALIDATE(img->cmn.pixel_format == shd->cmn.views[i].access_format, VALIDATE_ABND_SIMGVIEW_ACCESSFORMAT);
+                                    _SG_VALIDATE(_sg_image_cold(img)->type == shd->cmn.views[i].image_type, VALIDATE_ABND_SIMGVIEW_IMAGETYPE_MISMATCH);
+                                    _SG_VALIDATE(_sg_image_cold(img)->pixel_format == shd->cmn.views[i].access_format, VALIDATE_ABND_SIMGVIEW_ACCESSFORMAT);
                                 }
                             }
                         }
@@ -25010,10 +27219,11 @@ _SOKOL_PRIVATE bool _sg_validate_update_buffer(const _sg_buffer_t* buf, const sg
         }
         SOKOL_ASSERT(buf && data && data->ptr);
         _sg_validate_begin();
-        _SG_VALIDATE(!buf->cmn.usage.immutable, VALIDATE_UPDATEBUF_USAGE);
+        const _sg_buffer_cold_t* cold = _sg_buffer_cold(buf);
+        _SG_VALIDATE(!cold->usage.immutable, VALIDATE_UPDATEBUF_USAGE);
         _SG_VALIDATE(buf->cmn.size >= (int)data->size, VALIDATE_UPDATEBUF_SIZE);
-        _SG_VALIDATE(buf->cmn.update_frame_index != _sg.frame_index, VALIDATE_UPDATEBUF_ONCE);
-        _SG_VALIDATE(buf->cmn.append_frame_index != _sg.frame_index, VALIDATE_UPDATEBUF_APPEND);
+        _SG_VALIDATE(cold->update_frame_index != _sg.frame_index, VALIDATE_UPDATEBUF_ONCE);
+        _SG_VALIDATE(cold->append_frame_index != _sg.frame_index, VALIDATE_UPDATEBUF_APPEND);
         return _sg_validate_end();
     #endif
 }
@@ -25029,9 +27239,59 @@ _SOKOL_PRIVATE bool _sg_validate_append_buffer(const _sg_buffer_t* buf, const sg
         }
         SOKOL_ASSERT(buf && data && data->ptr);
         _sg_validate_begin();
-        _SG_VALIDATE(!buf->cmn.usage.immutable, VALIDATE_APPENDBUF_USAGE);
-        _SG_VALIDATE(buf->cmn.size >= (buf->cmn.append_pos + (int)data->size), VALIDATE_APPENDBUF_SIZE);
-        _SG_VALIDATE(buf->cmn.update_frame_index != _sg.frame_index, VALIDATE_APPENDBUF_UPDATE);
+        const _sg_buffer_cold_t* cold = _sg_buffer_cold(buf);
+        _SG_VALIDATE(!cold->usage.immutable, VALIDATE_APPENDBUF_USAGE);
+        _SG_VALIDATE(buf->cmn.size >= (cold->append_pos + (int)data->size), VALIDATE_APPENDBUF_SIZE);
+        _SG_VALIDATE(cold->update_frame_index != _sg.frame_index, VALIDATE_APPENDBUF_UPDATE);
+        return _sg_validate_end();
+    #endif
+}
+
+_SOKOL_PRIVATE bool _sg_validate_map_buffer(const _sg_buffer_t* buf, size_t size) {
+    #if !defined(SOKOL_DEBUG)
+        _SOKOL_UNUSED(buf);
+        _SOKOL_UNUSED(size);
+        return true;
+    #else
+        if (_sg.desc.disable_validation) {
+            return true;
+        }
+        SOKOL_ASSERT(buf);
+        _sg_validate_begin();
+        const _sg_buffer_cold_t* cold = _sg_buffer_cold(buf);
+        _SG_VALIDATE(cold->usage.stream_update, VALIDATE_MAPBUF_USAGE);
+        _SG_VALIDATE((size > 0) && (size <= (size_t)buf->cmn.size), VALIDATE_MAPBUF_SIZE);
+        _SG_VALIDATE(!cold->mapped, VALIDATE_MAPBUF_MAPPED);
+        _SG_VALIDATE(cold->update_frame_index != _sg.frame_index, VALIDATE_MAPBUF_ONCE);
+        _SG_VALIDATE(cold->append_frame_index != _sg.frame_index, VALIDATE_MAPBUF_APPEND);
+        return _sg_validate_end();
+    #endif
+}
+
+_SOKOL_PRIVATE bool _sg_validate_unmap_buffer(const _sg_buffer_t* buf) {
+    #if !defined(SOKOL_DEBUG)
+        _SOKOL_UNUSED(buf);
+        return true;
+    #else
+        if (_sg.desc.disable_validation) {
+            return true;
+        }
+        SOKOL_ASSERT(buf);
+        _sg_validate_begin();
+        _SG_VALIDATE(_sg_buffer_cold(buf)->mapped, VALIDATE_UNMAPBUF_NOT_MAPPED);
+        return _sg_validate_end();
+    #endif
+}
+
+_SOKOL_PRIVATE bool _sg_validate_commit(void) {
+    #if !defined(SOKOL_DEBUG)
+        return true;
+    #else
+        if (_sg.desc.disable_validation) {
+            return true;
+        }
+        _sg_validate_begin();
+        _SG_VALIDATE(0 == _sg.num_mapped_buffers, VALIDATE_COMMIT_BUFFER_MAPPED);
         return _sg_validate_end();
     #endif
 }
@@ -25047,14 +27307,16 @@ _SOKOL_PRIVATE bool _sg_validate_update_image(const _sg_image_t* img, const sg_i
         }
         SOKOL_ASSERT(img && data);
         _sg_validate_begin();
-        _SG_VALIDATE(!img->cmn.usage.immutable, VALIDATE_UPDIMG_USAGE);
-        _SG_VALIDATE(img->cmn.upd_frame_index != _sg.frame_index, VALIDATE_UPDIMG_ONCE);
+        const _sg_image_cold_t* cold = _sg_image_cold(img);
+        _SG_VALIDATE(!cold->usage.immutable, VALIDATE_UPDIMG_USAGE);
+        _SG_VALIDATE(!cold->usage.region_update, VALIDATE_UPDIMG_REGION_UPDATE);
+        _SG_VALIDATE(cold->upd_frame_index != _sg.frame_index, VALIDATE_UPDIMG_ONCE);
         _sg_validate_image_data(data,
-            img->cmn.pixel_format,
-            img->cmn.width,
-            img->cmn.height,
-            img->cmn.num_mipmaps,
-            img->cmn.num_slices);
+            cold->pixel_format,
+            cold->width,
+            cold->height,
+            cold->num_mipmaps,
+            cold->num_slices);
         return _sg_validate_end();
     #endif
 }
@@ -25070,7 +27332,7 @@ _SOKOL_PRIVATE bool _sg_validate_write_buffer_unsealed(const _sg_buffer_t* buf,
         }
         SOKOL_ASSERT(buf && desc);
         _sg_validate_begin();
-        _SG_VALIDATE(buf->cmn.usage.immutable && buf->cmn.usage.write_unsealed, VALIDATE_WRITEBUFFERUNSEALED_USAGE);
+        _SG_VALIDATE(_sg_buffer_cold(buf)->usage.immutable && _sg_buffer_cold(buf)->usage.write_unsealed, VALIDATE_WRITEBUFFERUNSEALED_USAGE);
         _SG_VALIDATE(buf->slot.state == SG_RESOURCESTATE_UNSEALED, VALIDATE_WRITEBUFFERUNSEALED_RESOURCESTATE);
         _SG_VALIDATE(desc->src.data.ptr, VALIDATE_WRITEBUFFERUNSEALED_SRC_DATA_POINTER);
         _SG_VALIDATE(desc->src.data.size > 0, VALIDATE_WRITEBUFFERUNSEALED_SRC_DATA_SIZE);
@@ -25092,18 +27354,18 @@ _SOKOL_PRIVATE bool _sg_validate_write_image_unsealed(const _sg_image_t* img, co
         }
         SOKOL_ASSERT(img && desc);
         const size_t write_size = (size_t)desc->src.bytes_per_slice * (size_t)desc->size.num_slices;
-        const int mip_width = _sg_miplevel_dim(img->cmn.width, desc->dst.mip_level);
-        const int mip_height = _sg_miplevel_dim(img->cmn.height, desc->dst.mip_level);
-        const int mip_depth_or_slices = (SG_IMAGETYPE_3D == img->cmn.type) ? _sg_miplevel_dim(img->cmn.num_slices, desc->dst.mip_level) : img->cmn.num_slices;
-        const int bsize = _sg_block_bytesize(img->cmn.pixel_format);
+        const int mip_width = _sg_miplevel_dim(_sg_image_cold(img)->width, desc->dst.mip_level);
+        const int mip_height = _sg_miplevel_dim(_sg_image_cold(img)->height, desc->dst.mip_level);
+        const int mip_depth_or_slices = (SG_IMAGETYPE_3D == _sg_image_cold(img)->type) ? _sg_miplevel_dim(_sg_image_cold(img)->num_slices, desc->dst.mip_level) : _sg_image_cold(img)->num_slices;
+        const int bsize = _sg_block_bytesize(_sg_image_cold(img)->pixel_format);
         _sg_validate_begin();
-        _SG_VALIDATE(img->cmn.usage.immutable && img->cmn.usage.write_unsealed, VALIDATE_WRITEIMAGEUNSEALED_USAGE);
+        _SG_VALIDATE(_sg_image_cold(img)->usage.immutable && _sg_image_cold(img)->usage.write_unsealed, VALIDATE_WRITEIMAGEUNSEALED_USAGE);
         _SG_VALIDATE(img->slot.state == SG_RESOURCESTATE_UNSEALED, VALIDATE_WRITEIMAGEUNSEALED_RESOURCESTATE);
         _SG_VALIDATE(desc->src.data.ptr, VALIDATE_WRITEIMAGEUNSEALED_SRC_DATA_POINTER);
         _SG_VALIDATE(desc->src.data.size, VALIDATE_WRITEIMAGEUNSEALED_SRC_DATA_SIZE);
         _SG_VALIDATE((desc->src.bytes_per_row > 0) && _sg_multiple(desc->src.bytes_per_row, bsize), VALIDATE_WRITEIMAGEUNSEALED_BYTESPERROW);
         _SG_VALIDATE((desc->src.bytes_per_slice > 0) && _sg_multiple(desc->src.bytes_per_slice, desc->src.bytes_per_row), VALIDATE_WRITEIMAGEUNSEALED_BYTESPERSLICE);
-        _SG_VALIDATE((desc->dst.mip_level >= 0) && (desc->dst.mip_level < img->cmn.num_mipmaps), VALIDATE_WRITEIMAGEUNSEALED_MIPLEVEL);
+        _SG_VALIDATE((desc->dst.mip_level >= 0) && (desc->dst.mip_level < _sg_image_cold(img)->num_mipmaps), VALIDATE_WRITEIMAGEUNSEALED_MIPLEVEL);
         _SG_VALIDATE((desc->size.width >= 0) && (desc->size.width <= mip_width), VALIDATE_WRITEIMAGEUNSEALED_WIDTH);
         _SG_VALIDATE((desc->size.height >= 0) && (desc->size.height <= mip_height), VALIDATE_WRITEIMAGEUNSEALED_HEIGHT);
         _SG_VALIDATE((desc->size.num_slices >= 0) && (desc->size.num_slices <= mip_depth_or_slices), VALIDATE_WRITEIMAGEUNSEALED_NUMSLICES);
@@ -25118,6 +27380,41 @@ _SOKOL_PRIVATE bool _sg_validate_write_image_unsealed(const _sg_image_t* img, co
     #endif
 }
 
+_SOKOL_PRIVATE bool _sg_validate_update_image_region(const _sg_image_t* img, const sg_write_image_desc* desc) {
+    #if !defined(SOKOL_DEBUG)
+        _SOKOL_UNUSED(img);
+        _SOKOL_UNUSED(desc);
+        return true;
+    #else
+        if (_sg.desc.disable_validation) {
+            return true;
+        }
+        SOKOL_ASSERT(img && desc);
+        const size_t write_size = (size_t)desc->src.bytes_per_slice * (size_t)desc->size.num_slices;
+        const int mip_width = _sg_miplevel_dim(_sg_image_cold(img)->width, desc->dst.mip_level);
+        const int mip_height = _sg_miplevel_dim(_sg_image_cold(img)->height, desc->dst.mip_level);
+        const int mip_depth_or_slices = (SG_IMAGETYPE_3D == _sg_image_cold(img)->type) ? _sg_miplevel_dim(_sg_image_cold(img)->num_slices, desc->dst.mip_level) : _sg_image_cold(img)->num_slices;
+        const int bsize = _sg_block_bytesize(_sg_image_cold(img)->pixel_format);
+        _sg_validate_begin();
+        _SG_VALIDATE(_sg_image_cold(img)->usage.region_update, VALIDATE_UPDIMGREGION_USAGE);
+        _SG_VALIDATE(desc->src.data.ptr, VALIDATE_UPDIMGREGION_SRC_DATA_POINTER);
+        _SG_VALIDATE(desc->src.data.size, VALIDATE_UPDIMGREGION_SRC_DATA_SIZE);
+        _SG_VALIDATE((desc->src.bytes_per_row > 0) && _sg_multiple(desc->src.bytes_per_row, bsize), VALIDATE_UPDIMGREGION_BYTESPERROW);
+        _SG_VALIDATE((desc->src.bytes_per_slice > 0) && _sg_multiple(desc->src.bytes_per_slice, desc->src.bytes_per_row), VALIDATE_UPDIMGREGION_BYTESPERSLICE);
+        _SG_VALIDATE((desc->dst.mip_level >= 0) && (desc->dst.mip_level < _sg_image_cold(img)->num_mipmaps), VALIDATE_UPDIMGREGION_MIPLEVEL);
+        _SG_VALIDATE((desc->src.offset + write_size) <= desc->src.data.size, VALIDATE_UPDIMGREGION_READ_OVERFLOW);
+        _SG_VALIDATE((desc->dst.x >= 0) && (desc->dst.x < mip_width)
+                  && (desc->dst.y >= 0) && (desc->dst.y < mip_height)
+                  && (desc->dst.slice >= 0) && (desc->dst.slice < mip_depth_or_slices),
+                  VALIDATE_UPDIMGREGION_DST_RANGE);
+        _SG_VALIDATE((desc->size.width > 0) && ((desc->dst.x + desc->size.width) <= mip_width)
+                  && (desc->size.height > 0) && ((desc->dst.y + desc->size.height) <= mip_height)
+                  && (desc->size.num_slices > 0) && ((desc->dst.slice + desc->size.num_slices) <= mip_depth_or_slices),
+                  VALIDATE_UPDIMGREGION_WRITE_OVERFLOW);
+        return _sg_validate_end();
+    #endif
+}
+
 _SOKOL_PRIVATE bool _sg_validate_seal_buffer(const _sg_buffer_t* buf) {
     #if !defined(SOKOL_DEBUG)
         _SOKOL_UNUSED(buf);
@@ -25148,46 +27445,229 @@ _SOKOL_PRIVATE bool _sg_validate_seal_image(const _sg_image_t* img) {
     #endif
 }
 
-_SOKOL_PRIVATE bool _sg_validate_shader_binding_limits(const sg_shader_desc* desc) {
-    SOKOL_ASSERT(desc);
+_SOKOL_PRIVATE bool _sg_validate_read_buffer(const _sg_buffer_t* buf, const sg_read_buffer_desc* desc) {
+    #if !defined(SOKOL_DEBUG)
+        _SOKOL_UNUSED(buf);
+        _SOKOL_UNUSED(desc);
+        return true;
+    #else
+        if (_sg.desc.disable_validation) {
+            return true;
+        }
+        SOKOL_ASSERT(buf && desc);
+        _sg_validate_begin();
+        _SG_VALIDATE(!_sg.cur_pass.in_pass, VALIDATE_READBUFFER_INPASS);
+        _SG_VALIDATE(buf->slot.state == SG_RESOURCESTATE_VALID, VALIDATE_READBUFFER_RESOURCESTATE);
+        _SG_VALIDATE(_sg_multiple_u64((uint64_t)desc->src.offset, 4), VALIDATE_READBUFFER_OFFSET);
+        _SG_VALIDATE((desc->size > 0) && _sg_multiple_u64((uint64_t)desc->size, 4), VALIDATE_READBUFFER_SIZE);
+        _SG_VALIDATE((desc->src.offset + desc->size) <= (size_t)buf->cmn.size, VALIDATE_READBUFFER_READ_OVERFLOW);
+        _SG_VALIDATE(desc->dst.ptr, VALIDATE_READBUFFER_DST_DATA_POINTER);
+        _SG_VALIDATE(desc->dst.size >= desc->size, VALIDATE_READBUFFER_DST_DATA_SIZE);
+        return _sg_validate_end();
+    #endif
+}
 
-    // NOTE: this validation check is also active in release mode, if a shader uses
-    // more bindings than allowed, shader creation will fail
-    int vs_num_tex = 0;
-    int fs_num_tex = 0;
-    int cs_num_tex = 0;
-    int vs_num_sbuf = 0;
-    int fs_num_sbuf = 0;
-    int cs_num_sbuf = 0;
-    int vs_num_simg = 0;
-    int fs_num_simg = 0;
-    int cs_num_simg = 0;
-    int vs_num_texsmp = 0;
-    int fs_num_texsmp = 0;
-    int cs_num_texsmp = 0;
-    for (size_t i = 0; i < SG_MAX_VIEW_BINDSLOTS; i++) {
-        switch (desc->views[i].texture.stage) {
-            case SG_SHADERSTAGE_VERTEX:   vs_num_tex++; break;
-            case SG_SHADERSTAGE_FRAGMENT: fs_num_tex++; break;
-            case SG_SHADERSTAGE_COMPUTE:  cs_num_tex++; break;
-            default: break;
+_SOKOL_PRIVATE bool _sg_validate_read_image(const _sg_image_t* img, const sg_read_image_desc* desc) {
+    #if !defined(SOKOL_DEBUG)
+        _SOKOL_UNUSED(img);
+        _SOKOL_UNUSED(desc);
+        return true;
+    #else
+        if (_sg.desc.disable_validation) {
+            return true;
         }
-        switch (desc->views[i].storage_buffer.stage) {
-            case SG_SHADERSTAGE_VERTEX:   vs_num_sbuf++; break;
-            case SG_SHADERSTAGE_FRAGMENT: fs_num_sbuf++; break;
-            case SG_SHADERSTAGE_COMPUTE:  cs_num_sbuf++; break;
-            default: break;
+        SOKOL_ASSERT(img && desc);
+        const sg_pixel_format fmt = _sg_image_cold(img)->pixel_format;
+        const int mip_width = _sg_miplevel_dim(_sg_image_cold(img)->width, desc->src.mip_level);
+        const int mip_height = _sg_miplevel_dim(_sg_image_cold(img)->height, desc->src.mip_level);
+        const int mip_depth_or_slices = (SG_IMAGETYPE_3D == _sg_image_cold(img)->type) ? _sg_miplevel_dim(_sg_image_cold(img)->num_slices, desc->src.mip_level) : _sg_image_cold(img)->num_slices;
+        _sg_validate_begin();
+        _SG_VALIDATE(!_sg.cur_pass.in_pass, VALIDATE_READIMAGE_INPASS);
+        _SG_VALIDATE(img->slot.state == SG_RESOURCESTATE_VALID, VALIDATE_READIMAGE_RESOURCESTATE);
+        _SG_VALIDATE(_sg_image_cold(img)->sample_count == 1, VALIDATE_READIMAGE_SAMPLECOUNT);
+        _SG_VALIDATE(!_sg_is_compressed_pixel_format(fmt) && !_sg_is_depth_or_depth_stencil_format(fmt), VALIDATE_READIMAGE_PIXELFORMAT);
+        _SG_VALIDATE((desc->src.mip_level >= 0) && (desc->src.mip_level < _sg_image_cold(img)->num_mipmaps), VALIDATE_READIMAGE_MIPLEVEL);
+        _SG_VALIDATE((desc->src.slice >= 0) && (desc->src.slice < mip_depth_or_slices), VALIDATE_READIMAGE_SLICE);
+        _SG_VALIDATE(desc->size.num_slices == 1, VALIDATE_READIMAGE_NUMSLICES);
+        _SG_VALIDATE((desc->src.x >= 0) && (desc->src.x < mip_width), VALIDATE_READIMAGE_SRC_X_RANGE);
+        _SG_VALIDATE((desc->src.y >= 0) && (desc->src.y < mip_height), VALIDATE_READIMAGE_SRC_Y_RANGE);
+        _SG_VALIDATE((desc->size.width > 0) && ((desc->src.x + desc->size.width) <= mip_width), VALIDATE_READIMAGE_READ_WIDTH_OVERFLOW);
+        _SG_VALIDATE((desc->size.height > 0) && ((desc->src.y + desc->size.height) <= mip_height), VALIDATE_READIMAGE_READ_HEIGHT_OVERFLOW);
+        _SG_VALIDATE(desc->dst.ptr, VALIDATE_READIMAGE_DST_DATA_POINTER);
+        if ((desc->size.width > 0) && (desc->size.height > 0)) {
+            const size_t num_bytes = (size_t)_sg_surface_pitch(fmt, desc->size.width, desc->size.height, 1);
+            _SG_VALIDATE(desc->dst.size >= num_bytes, VALIDATE_READIMAGE_DST_DATA_SIZE);
         }
-        switch (desc->views[i].storage_image.stage) {
-            case SG_SHADERSTAGE_VERTEX:   vs_num_simg++; break;
-            case SG_SHADERSTAGE_FRAGMENT: fs_num_simg++; break;
-            case SG_SHADERSTAGE_COMPUTE:  cs_num_simg++; break;
-            default: break;
+        return _sg_validate_end();
+    #endif
+}
+
+_SOKOL_PRIVATE bool _sg_validate_begin_timer(const char* label, const _sg_timer_t* timer) {
+    #if !defined(SOKOL_DEBUG)
+        _SOKOL_UNUSED(label);
+        _SOKOL_UNUSED(timer);
+        return true;
+    #else
+        if (_sg.desc.disable_validation) {
+            return true;
         }
-    }
-    for (size_t i = 0; i < SG_MAX_TEXTURE_SAMPLER_PAIRS; i++) {
-        switch (desc->texture_sampler_pairs[i].stage) {
-            case SG_SHADERSTAGE_VERTEX:   vs_num_texsmp++; break;
+        SOKOL_ASSERT(label);
+        _sg_validate_begin();
+        _SG_VALIDATE(_sg.cur_pass.in_pass, VALIDATE_BEGINTIMER_PASS);
+        const size_t len = strlen(label);
+        _SG_VALIDATE((len > 0) && (len < _SG_STRING_SIZE), VALIDATE_BEGINTIMER_LABEL);
+        _SG_VALIDATE(!_sg.timers.in_scope, VALIDATE_BEGINTIMER_NESTED);
+        if (timer) {
+            const _sg_timer_frame_t* frame = &timer->frames[_sg.frame_index % _SG_NUM_TIMER_FRAMES];
+            _SG_VALIDATE(frame->frame_index != _sg.frame_index, VALIDATE_BEGINTIMER_ONCE_PER_FRAME);
+        }
+        return _sg_validate_end();
+    #endif
+}
+
+_SOKOL_PRIVATE bool _sg_validate_end_timer(void) {
+    #if !defined(SOKOL_DEBUG)
+        return true;
+    #else
+        if (_sg.desc.disable_validation) {
+            return true;
+        }
+        _sg_validate_begin();
+        _SG_VALIDATE(_sg.cur_pass.in_pass, VALIDATE_ENDTIMER_PASS);
+        _SG_VALIDATE(_sg.timers.in_scope, VALIDATE_ENDTIMER_NO_TIMER);
+        return _sg_validate_end();
+    #endif
+}
+
+_SOKOL_PRIVATE bool _sg_validate_occlusion_query_desc(const sg_occlusion_query_desc* desc) {
+    #if !defined(SOKOL_DEBUG)
+        _SOKOL_UNUSED(desc);
+        return true;
+    #else
+        if (_sg.desc.disable_validation) {
+            return true;
+        }
+        SOKOL_ASSERT(desc);
+        _sg_validate_begin();
+        _SG_VALIDATE(desc->_start_canary == 0, VALIDATE_OCCLUSIONQUERYDESC_CANARY);
+        _SG_VALIDATE(desc->_end_canary == 0, VALIDATE_OCCLUSIONQUERYDESC_CANARY);
+        if (desc->type == SG_OCCLUSIONQUERYTYPE_SAMPLES_PASSED) {
+            _SG_VALIDATE(_sg.features.occlusion_query_samples || !_sg.features.occlusion_query, VALIDATE_OCCLUSIONQUERYDESC_SAMPLES_NOT_SUPPORTED);
+        }
+        return _sg_validate_end();
+    #endif
+}
+
+_SOKOL_PRIVATE bool _sg_validate_begin_occlusion_query(const _sg_occlusion_query_t* query) {
+    #if !defined(SOKOL_DEBUG)
+        _SOKOL_UNUSED(query);
+        return true;
+    #else
+        if (_sg.desc.disable_validation) {
+            return true;
+        }
+        SOKOL_ASSERT(query);
+        _sg_validate_begin();
+        _SG_VALIDATE(_sg.cur_pass.in_pass && !_sg.cur_pass.is_compute, VALIDATE_BEGINOCCLUSIONQUERY_RENDERPASS);
+        _SG_VALIDATE(!_sg.occlusion_queries.in_scope, VALIDATE_BEGINOCCLUSIONQUERY_NESTED);
+        const _sg_occlusion_query_frame_t* frame = &query->frames[_sg.frame_index % _SG_NUM_OCCLUSION_QUERY_FRAMES];
+        _SG_VALIDATE(frame->frame_index != _sg.frame_index, VALIDATE_BEGINOCCLUSIONQUERY_ONCE_PER_FRAME);
+        return _sg_validate_end();
+    #endif
+}
+
+_SOKOL_PRIVATE bool _sg_validate_end_occlusion_query(void) {
+    #if !defined(SOKOL_DEBUG)
+        return true;
+    #else
+        if (_sg.desc.disable_validation) {
+            return true;
+        }
+        _sg_validate_begin();
+        _SG_VALIDATE(_sg.cur_pass.in_pass && !_sg.cur_pass.is_compute, VALIDATE_ENDOCCLUSIONQUERY_RENDERPASS);
+        _SG_VALIDATE(_sg.occlusion_queries.in_scope, VALIDATE_ENDOCCLUSIONQUERY_NO_QUERY);
+        return _sg_validate_end();
+    #endif
+}
+
+_SOKOL_PRIVATE bool _sg_validate_command_list_desc(const sg_command_list_desc* desc) {
+    #if !defined(SOKOL_DEBUG)
+        _SOKOL_UNUSED(desc);
+        return true;
+    #else
+        if (_sg.desc.disable_validation) {
+            return true;
+        }
+        SOKOL_ASSERT(desc);
+        _sg_validate_begin();
+        _SG_VALIDATE(desc->_start_canary == 0, VALIDATE_COMMANDLISTDESC_CANARY);
+        _SG_VALIDATE(desc->_end_canary == 0, VALIDATE_COMMANDLISTDESC_CANARY);
+        return _sg_validate_end();
+    #endif
+}
+
+_SOKOL_PRIVATE bool _sg_validate_execute_command_lists(const sg_command_list* lists, int num_lists) {
+    #if !defined(SOKOL_DEBUG)
+        _SOKOL_UNUSED(lists);
+        _SOKOL_UNUSED(num_lists);
+        return true;
+    #else
+        if (_sg.desc.disable_validation) {
+            return true;
+        }
+        _sg_validate_begin();
+        _SG_VALIDATE(_sg.cur_pass.in_pass && !_sg.cur_pass.is_compute, VALIDATE_EXECCMDLISTS_RENDERPASS);
+        for (int i = 0; i < num_lists; i++) {
+            const _sg_command_list_t* list = _sg_lookup_command_list(lists[i].id);
+            _SG_VALIDATE(list != 0, VALIDATE_EXECCMDLISTS_LIST_ALIVE);
+            if (list) {
+                _SG_VALIDATE(!list->recording, VALIDATE_EXECCMDLISTS_LIST_RECORDING);
+            }
+        }
+        return _sg_validate_end();
+    #endif
+}
+
+_SOKOL_PRIVATE bool _sg_validate_shader_binding_limits(const sg_shader_desc* desc) {
+    SOKOL_ASSERT(desc);
+
+    // NOTE: this validation check is also active in release mode, if a shader uses
+    // more bindings than allowed, shader creation will fail
+    int vs_num_tex = 0;
+    int fs_num_tex = 0;
+    int cs_num_tex = 0;
+    int vs_num_sbuf = 0;
+    int fs_num_sbuf = 0;
+    int cs_num_sbuf = 0;
+    int vs_num_simg = 0;
+    int fs_num_simg = 0;
+    int cs_num_simg = 0;
+    int vs_num_texsmp = 0;
+    int fs_num_texsmp = 0;
+    int cs_num_texsmp = 0;
+    for (size_t i = 0; i < SG_MAX_VIEW_BINDSLOTS; i++) {
+        switch (desc->views[i].texture.stage) {
+            case SG_SHADERSTAGE_VERTEX:   vs_num_tex++; break;
+            case SG_SHADERSTAGE_FRAGMENT: fs_num_tex++; break;
+            case SG_SHADERSTAGE_COMPUTE:  cs_num_tex++; break;
+            default: break;
+        }
+        switch (desc->views[i].storage_buffer.stage) {
+            case SG_SHADERSTAGE_VERTEX:   vs_num_sbuf++; break;
+            case SG_SHADERSTAGE_FRAGMENT: fs_num_sbuf++; break;
+            case SG_SHADERSTAGE_COMPUTE:  cs_num_sbuf++; break;
+            default: break;
+        }
+        switch (desc->views[i].storage_image.stage) {
+            case SG_SHADERSTAGE_VERTEX:   vs_num_simg++; break;
+            case SG_SHADERSTAGE_FRAGMENT: fs_num_simg++; break;
+            case SG_SHADERSTAGE_COMPUTE:  cs_num_simg++; break;
+            default: break;
+        }
+    }
+    for (size_t i = 0; i < SG_MAX_TEXTURE_SAMPLER_PAIRS; i++) {
+        switch (desc->texture_sampler_pairs[i].stage) {
+            case SG_SHADERSTAGE_VERTEX:   vs_num_texsmp++; break;
             case SG_SHADERSTAGE_FRAGMENT: fs_num_texsmp++; break;
             case SG_SHADERSTAGE_COMPUTE:  cs_num_texsmp++; break;
             default: break;
@@ -25304,7 +27784,7 @@ _SOKOL_PRIVATE sg_buffer_desc _sg_buffer_desc_defaults(const sg_buffer_desc* des
 
 _SOKOL_PRIVATE sg_image_usage _sg_image_usage_defaults(const sg_image_usage *usg) {
     sg_image_usage def = *usg;
-    if (!(def.immutable || def.stream_update || def.dynamic_update)) {
+    if (!(def.immutable || def.stream_update || def.dynamic_update || def.region_update)) {
         def.immutable = true;
     }
     return def;
@@ -25630,7 +28110,7 @@ _SOKOL_PRIVATE void _sg_init_buffer(_sg_buffer_t* buf, const sg_buffer_desc* des
     SOKOL_ASSERT(buf && (buf->slot.state == SG_RESOURCESTATE_ALLOC));
     SOKOL_ASSERT(desc);
     if (_sg_validate_buffer_desc(desc)) {
-        _sg_buffer_common_init(&buf->cmn, desc);
+        _sg_buffer_common_init(&buf->cmn, _sg_buffer_cold(buf), desc);
         sg_resource_state res_state = _sg_create_buffer(buf, desc);
         if (desc->usage.write_unsealed && (res_state == SG_RESOURCESTATE_VALID)) {
             res_state = SG_RESOURCESTATE_UNSEALED;
@@ -25647,7 +28127,7 @@ _SOKOL_PRIVATE void _sg_init_image(_sg_image_t* img, const sg_image_desc* desc)
     SOKOL_ASSERT(img && (img->slot.state == SG_RESOURCESTATE_ALLOC));
     SOKOL_ASSERT(desc);
     if (_sg_validate_image_desc(desc)) {
-        _sg_image_common_init(&img->cmn, desc);
+        _sg_image_common_init(&img->cmn, _sg_image_cold(img), desc);
         sg_resource_state res_state = _sg_create_image(img, desc);
         if (desc->usage.write_unsealed && (res_state == SG_RESOURCESTATE_VALID)) {
             res_state = SG_RESOURCESTATE_UNSEALED;
@@ -25729,7 +28209,7 @@ _SOKOL_PRIVATE void _sg_init_view(_sg_view_t* view, const sg_view_desc* desc) {
             res_state = img->slot.state;
         }
         if (_sg_resource_state_valid_unsealed(res_state)) {
-            _sg_view_common_init(&view->cmn, desc, buf, img);
+            _sg_view_common_init(&view->cmn, _sg_view_cold(view), desc, buf, img);
             view->slot.state = _sg_create_view(view, desc);
         } else {
             view->slot.state = SG_RESOURCESTATE_FAILED;
@@ -25741,8 +28221,28 @@ _SOKOL_PRIVATE void _sg_init_view(_sg_view_t* view, const sg_view_desc* desc) {
     _sg_resource_stats_inc(views.inited);
 }
 
+_SOKOL_PRIVATE void _sg_discard_buffer_map_staging(_sg_buffer_t* buf) {
+    SOKOL_ASSERT(buf);
+    _sg_buffer_cold_t* cold = _sg_buffer_cold(buf);
+    if (cold->map_staging) {
+        _sg_free(cold->map_staging);
+        cold->map_staging = 0;
+    }
+}
+
 _SOKOL_PRIVATE void _sg_uninit_buffer(_sg_buffer_t* buf) {
     SOKOL_ASSERT(buf && _sg_resource_state_valid_failed_unsealed(buf->slot.state));
+    _sg_buffer_cold_t* cold = _sg_buffer_cold(buf);
+    if (cold->mapped) {
+        // destroying a mapped buffer implicitly unmaps it
+        if (!cold->map_staged) {
+            _sg_unmap_buffer(buf, cold->map_size);
+        }
+        cold->mapped = false;
+        SOKOL_ASSERT(_sg.num_mapped_buffers > 0);
+        _sg.num_mapped_buffers--;
+    }
+    _sg_discard_buffer_map_staging(buf);
     _sg_discard_buffer(buf);
     _sg_reset_buffer_to_alloc_state(buf);
     _sg_resource_stats_inc(buffers.uninited);
@@ -25859,6 +28359,574 @@ _SOKOL_PRIVATE bool _sg_remove_commit_listener(const sg_commit_listener* listene
     return false;
 }
 
+_SOKOL_PRIVATE void _sg_setup_readbacks(const sg_desc* desc) {
+    SOKOL_ASSERT((desc->max_readbacks > 0) && (desc->max_readbacks < _SG_MAX_POOL_SIZE));
+    SOKOL_ASSERT(0 == _sg.readbacks.items);
+    _sg_pool_init(&_sg.readbacks.pool, desc->max_readbacks);
+    const size_t size = sizeof(_sg_readback_t) * (size_t)_sg.readbacks.pool.size;
+    _sg.readbacks.items = (_sg_readback_t*)_sg_malloc_clear(size);
+}
+
+_SOKOL_PRIVATE void _sg_discard_readbacks(void) {
+    SOKOL_ASSERT(0 != _sg.readbacks.items);
+    // NOTE: pending readbacks are dropped without invoking their callbacks
+    for (int i = 1; i < _sg.readbacks.pool.size; i++) {
+        _sg_readback_t* rb = &_sg.readbacks.items[i];
+        if (rb->state == SG_READBACKSTATE_PENDING) {
+            _sg_discard_readback(rb);
+        }
+    }
+    _sg_free(_sg.readbacks.items);
+    _sg.readbacks.items = 0;
+    _sg_pool_discard(&_sg.readbacks.pool);
+}
+
+_SOKOL_PRIVATE _sg_readback_t* _sg_alloc_readback(const sg_range* dst, size_t num_bytes, void (*callback)(const sg_readback_response*), void* user_data) {
+    SOKOL_ASSERT(dst && dst->ptr && (num_bytes <= dst->size));
+    const int slot_index = _sg_pool_alloc_index(&_sg.readbacks.pool);
+    if (_SG_INVALID_SLOT_INDEX == slot_index) {
+        _SG_ERROR(READBACK_POOL_EXHAUSTED);
+        return 0;
+    }
+    _sg_readback_t* rb = &_sg.readbacks.items[slot_index];
+    _sg_clear(rb, sizeof(_sg_readback_t));
+    const uint32_t ctr = ++_sg.readbacks.pool.gen_ctrs[slot_index];
+    rb->id = (ctr<<_SG_SLOT_SHIFT)|(slot_index & _SG_SLOT_MASK);
+    rb->state = SG_READBACKSTATE_PENDING;
+    rb->frame_index = _sg.frame_index;
+    rb->dst = *dst;
+    rb->num_bytes = num_bytes;
+    rb->callback = callback;
+    rb->user_data = user_data;
+    _sg.readbacks.num_pending += 1;
+    return rb;
+}
+
+_SOKOL_PRIVATE _sg_readback_t* _sg_lookup_readback(uint32_t rb_id) {
+    if (SG_INVALID_ID != rb_id) {
+        const int slot_index = _sg_slot_index(rb_id);
+        if (slot_index < _sg.readbacks.pool.size) {
+            _sg_readback_t* rb = &_sg.readbacks.items[slot_index];
+            if (rb->id == rb_id) {
+                return rb;
+            }
+        }
+    }
+    return 0;
+}
+
+// NOTE: a finished readback frees its pool slot, but keeps its id and
+// state around so that it can be queried until the slot is reused
+_SOKOL_PRIVATE void _sg_finish_readback(_sg_readback_t* rb, sg_readback_state state) {
+    SOKOL_ASSERT(rb && (rb->state == SG_READBACKSTATE_PENDING));
+    SOKOL_ASSERT((state == SG_READBACKSTATE_COMPLETED) || (state == SG_READBACKSTATE_FAILED));
+    SOKOL_ASSERT(_sg.readbacks.num_pending > 0);
+    _sg_discard_readback(rb);
+    rb->state = state;
+    _sg.readbacks.num_pending -= 1;
+    _sg_pool_free_index(&_sg.readbacks.pool, _sg_slot_index(rb->id));
+    if (rb->callback) {
+        sg_readback_response response;
+        _sg_clear(&response, sizeof(response));
+        response.readback.id = rb->id;
+        response.state = state;
+        response.data.ptr = rb->dst.ptr;
+        response.data.size = (state == SG_READBACKSTATE_COMPLETED) ? rb->num_bytes : 0;
+        response.user_data = rb->user_data;
+        rb->callback(&response);
+    }
+}
+
+// called from sg_commit() to finish readbacks which have arrived in the meantime
+_SOKOL_PRIVATE void _sg_update_readbacks(void) {
+    if (0 == _sg.readbacks.num_pending) {
+        return;
+    }
+    for (int i = 1; i < _sg.readbacks.pool.size; i++) {
+        _sg_readback_t* rb = &_sg.readbacks.items[i];
+        if (rb->state == SG_READBACKSTATE_PENDING) {
+            const sg_readback_state state = rb->failed ? SG_READBACKSTATE_FAILED : _sg_poll_readback(rb);
+            if (state != SG_READBACKSTATE_PENDING) {
+                _sg_finish_readback(rb, state);
+            }
+        }
+    }
+}
+
+_SOKOL_PRIVATE void _sg_setup_timers(const sg_desc* desc) {
+    SOKOL_ASSERT(desc->max_timers > 0);
+    SOKOL_ASSERT(0 == _sg.timers.items);
+    const size_t size = sizeof(_sg_timer_t) * (size_t)desc->max_timers;
+    _sg.timers.items = (_sg_timer_t*)_sg_malloc_clear(size);
+}
+
+_SOKOL_PRIVATE void _sg_discard_timers(void) {
+    SOKOL_ASSERT(0 != _sg.timers.items);
+    for (int i = 0; i < _sg.timers.num; i++) {
+        for (int fi = 0; fi < _SG_NUM_TIMER_FRAMES; fi++) {
+            _sg_discard_timer(&_sg.timers.items[i].frames[fi]);
+        }
+    }
+    _sg_free(_sg.timers.items);
+    _sg.timers.items = 0;
+}
+
+// NOTE: timer labels are compared by content, but only up to the label length
+// which fits into an _sg_str_t (longer labels are caught by the validation layer)
+_SOKOL_PRIVATE _sg_timer_t* _sg_lookup_timer(const char* label) {
+    SOKOL_ASSERT(label);
+    for (int i = 0; i < _sg.timers.num; i++) {
+        _sg_timer_t* timer = &_sg.timers.items[i];
+        if (0 == strncmp(_sg_strptr(&timer->label), label, _SG_STRING_SIZE - 1)) {
+            return timer;
+        }
+    }
+    return 0;
+}
+
+_SOKOL_PRIVATE _sg_timer_t* _sg_alloc_timer(const char* label) {
+    SOKOL_ASSERT(label);
+    if (_sg.timers.num >= _sg.desc.max_timers) {
+        _SG_ERROR(TIMER_POOL_EXHAUSTED);
+        return 0;
+    }
+    _sg_timer_t* timer = &_sg.timers.items[_sg.timers.num++];
+    _sg_strcpy(&timer->label, label);
+    return timer;
+}
+
+_SOKOL_PRIVATE void _sg_end_active_timer(void) {
+    _sg_timer_t* timer = _sg.timers.cur;
+    SOKOL_ASSERT(timer);
+    _sg_timer_frame_t* frame = &timer->frames[_sg.frame_index % _SG_NUM_TIMER_FRAMES];
+    SOKOL_ASSERT(!frame->pending && (frame->frame_index == _sg.frame_index));
+    _sg_end_timer(frame);
+    frame->pending = true;
+    _sg.timers.num_pending += 1;
+    _sg.timers.cur = 0;
+}
+
+// called from sg_commit() to resolve timer measurements which have arrived in the meantime
+_SOKOL_PRIVATE void _sg_update_timers(void) {
+    if (0 == _sg.timers.num_pending) {
+        return;
+    }
+    for (int i = 0; i < _sg.timers.num; i++) {
+        _sg_timer_t* timer = &_sg.timers.items[i];
+        for (int fi = 0; fi < _SG_NUM_TIMER_FRAMES; fi++) {
+            _sg_timer_frame_t* frame = &timer->frames[fi];
+            uint64_t duration_ns = 0;
+            if (frame->pending && _sg_poll_timer(frame, &duration_ns)) {
+                frame->pending = false;
+                _sg.timers.num_pending -= 1;
+                // measurements may be resolved out of order, only keep the most recent one
+                if (!timer->result.valid || ((int32_t)(frame->frame_index - timer->result.frame_index) > 0)) {
+                    timer->result.valid = true;
+                    timer->result.frame_index = frame->frame_index;
+                    timer->result.duration_ns = duration_ns;
+                }
+            }
+        }
+    }
+}
+
+_SOKOL_PRIVATE void _sg_setup_occlusion_queries(const sg_desc* desc) {
+    SOKOL_ASSERT((desc->occlusion_query_pool_size > 0) && (desc->occlusion_query_pool_size < _SG_MAX_POOL_SIZE));
+    SOKOL_ASSERT(0 == _sg.occlusion_queries.items);
+    _sg_pool_init(&_sg.occlusion_queries.pool, desc->occlusion_query_pool_size);
+    const size_t size = sizeof(_sg_occlusion_query_t) * (size_t)_sg.occlusion_queries.pool.size;
+    _sg.occlusion_queries.items = (_sg_occlusion_query_t*)_sg_malloc_clear(size);
+}
+
+_SOKOL_PRIVATE void _sg_discard_occlusion_queries(void) {
+    SOKOL_ASSERT(0 != _sg.occlusion_queries.items);
+    for (int i = 1; i < _sg.occlusion_queries.pool.size; i++) {
+        _sg_occlusion_query_t* query = &_sg.occlusion_queries.items[i];
+        if (query->id != SG_INVALID_ID) {
+            for (int fi = 0; fi < _SG_NUM_OCCLUSION_QUERY_FRAMES; fi++) {
+                _sg_discard_occlusion_query(&query->frames[fi]);
+            }
+        }
+    }
+    _sg_free(_sg.occlusion_queries.items);
+    _sg.occlusion_queries.items = 0;
+    _sg_pool_discard(&_sg.occlusion_queries.pool);
+}
+
+_SOKOL_PRIVATE _sg_occlusion_query_t* _sg_lookup_occlusion_query(uint32_t query_id) {
+    if (SG_INVALID_ID != query_id) {
+        const int slot_index = _sg_slot_index(query_id);
+        if (slot_index < _sg.occlusion_queries.pool.size) {
+            _sg_occlusion_query_t* query = &_sg.occlusion_queries.items[slot_index];
+            if (query->id == query_id) {
+                return query;
+            }
+        }
+    }
+    return 0;
+}
+
+_SOKOL_PRIVATE void _sg_end_active_occlusion_query(void) {
+    _sg_occlusion_query_t* query = _sg.occlusion_queries.cur;
+    SOKOL_ASSERT(query);
+    _sg_occlusion_query_frame_t* frame = &query->frames[_sg.frame_index % _SG_NUM_OCCLUSION_QUERY_FRAMES];
+    SOKOL_ASSERT(!frame->pending && (frame->frame_index == _sg.frame_index));
+    _sg_end_occlusion_query(query, frame);
+    frame->pending = true;
+    _sg.occlusion_queries.num_pending += 1;
+    _sg.occlusion_queries.cur = 0;
+}
+
+// called from sg_commit() to resolve occlusion query results which have arrived in the meantime
+_SOKOL_PRIVATE void _sg_update_occlusion_queries(void) {
+    if (0 == _sg.occlusion_queries.num_pending) {
+        return;
+    }
+    for (int i = 1; i < _sg.occlusion_queries.pool.size; i++) {
+        _sg_occlusion_query_t* query = &_sg.occlusion_queries.items[i];
+        if (query->id == SG_INVALID_ID) {
+            continue;
+        }
+        for (int fi = 0; fi < _SG_NUM_OCCLUSION_QUERY_FRAMES; fi++) {
+            _sg_occlusion_query_frame_t* frame = &query->frames[fi];
+            uint64_t num_samples = 0;
+            if (frame->pending && _sg_poll_occlusion_query(query, frame, &num_samples)) {
+                frame->pending = false;
+                _sg.occlusion_queries.num_pending -= 1;
+                // results may be resolved out of order, only keep the most recent one
+                if (!query->result.valid || ((int32_t)(frame->frame_index - query->result.frame_index) > 0)) {
+                    query->result.valid = true;
+                    query->result.frame_index = frame->frame_index;
+                    query->result.visible = num_samples > 0;
+                    query->result.num_samples = num_samples;
+                }
+            }
+        }
+    }
+}
+
+_SOKOL_PRIVATE void _sg_setup_command_lists(const sg_desc* desc) {
+    SOKOL_ASSERT((desc->command_list_pool_size > 0) && (desc->command_list_pool_size < _SG_MAX_POOL_SIZE));
+    SOKOL_ASSERT(0 == _sg.command_lists.items);
+    _sg_pool_init(&_sg.command_lists.pool, desc->command_list_pool_size);
+    const size_t size = sizeof(_sg_command_list_t) * (size_t)_sg.command_lists.pool.size;
+    _sg.command_lists.items = (_sg_command_list_t*)_sg_malloc_clear(size);
+}
+
+_SOKOL_PRIVATE void _sg_discard_command_lists(void) {
+    SOKOL_ASSERT(0 != _sg.command_lists.items);
+    for (int i = 1; i < _sg.command_lists.pool.size; i++) {
+        _sg_command_list_t* list = &_sg.command_lists.items[i];
+        if (list->buf) {
+            _sg_free(list->buf);
+        }
+    }
+    _sg_free(_sg.command_lists.items);
+    _sg.command_lists.items = 0;
+    _sg_pool_discard(&_sg.command_lists.pool);
+}
+
+// NOTE: the command list recording functions may be called from any thread,
+// they must not modify global state, which means that record-time validation
+// can't use the regular validation layer and instead logs errors directly
+
+// common checks for all sg_cmd_*() functions, returns null if the command must be dropped
+_SOKOL_PRIVATE _sg_command_list_t* _sg_cmdlist_recording(uint32_t list_id) {
+    _sg_command_list_t* list = _sg_lookup_command_list(list_id);
+    if (0 == list) {
+        _SG_ERROR(COMMAND_LIST_ALIVE);
+        return 0;
+    }
+    if (!list->recording) {
+        _SG_ERROR(COMMAND_LIST_NOT_RECORDING);
+        return 0;
+    }
+    if (list->overflow) {
+        return 0;
+    }
+    return list;
+}
+
+// checks whether draw state commands can be recorded into a command list
+_SOKOL_PRIVATE bool _sg_cmdlist_draw_state_valid(const _sg_command_list_t* list) {
+    if (!list->has_pip) {
+        _SG_ERROR(COMMAND_LIST_NO_PIPELINE);
+        return false;
+    }
+    return list->next_draw_valid;
+}
+
+// allocate a command in the command list buffer, returns a pointer to the payload
+_SOKOL_PRIVATE void* _sg_cmdlist_alloc(_sg_command_list_t* list, _sg_cmd_type_t type, size_t payload_size) {
+    const size_t size = (sizeof(_sg_cmd_header_t) + payload_size + (_SG_CMD_ALIGN - 1)) & ~(size_t)(_SG_CMD_ALIGN - 1);
+    if ((list->pos + size) > list->size) {
+        list->overflow = true;
+        _SG_ERROR(COMMAND_LIST_OVERFLOW);
+        return 0;
+    }
+    _sg_cmd_header_t* hdr = (_sg_cmd_header_t*)(list->buf + list->pos);
+    hdr->type = (uint32_t)type;
+    hdr->size = (uint32_t)size;
+    list->pos += size;
+    list->num_commands += 1;
+    return hdr + 1;
+}
+
+_SOKOL_PRIVATE bool _sg_cmdlist_validate_pipeline(sg_pipeline pip_id) {
+    #if !defined(SOKOL_DEBUG)
+        _SOKOL_UNUSED(pip_id);
+        return true;
+    #else
+        if (_sg.desc.disable_validation) {
+            return true;
+        }
+        const _sg_pipeline_t* pip = _sg_lookup_pipeline(pip_id.id);
+        bool valid = pip && (pip->slot.state == SG_RESOURCESTATE_VALID) && !pip->cmn.is_compute;
+        if (valid) {
+            const _sg_shader_ref_t* shd_ref = &pip->cmn.shader;
+            valid = _sg_shader_ref_alive(shd_ref) && (_sg_shader_ref_ptr(shd_ref)->slot.state == SG_RESOURCESTATE_VALID);
+        }
+        if (!valid) {
+            _SG_ERROR(COMMAND_LIST_PIPELINE_VALID);
+        }
+        return valid;
+    #endif
+}
+
+_SOKOL_PRIVATE bool _sg_cmdlist_validate_bindings(const _sg_command_list_t* list, const sg_bindings* bindings) {
+    #if !defined(SOKOL_DEBUG)
+        _SOKOL_UNUSED(list);
+        _SOKOL_UNUSED(bindings);
+        return true;
+    #else
+        if (_sg.desc.disable_validation) {
+            return true;
+        }
+        const _sg_pipeline_t* pip = _sg_lookup_pipeline(list->cur_pip.id);
+        if (!pip || !_sg_shader_ref_alive(&pip->cmn.shader)) {
+            _SG_ERROR(COMMAND_LIST_PIPELINE_VALID);
+            return false;
+        }
+        const _sg_shader_t* shd = _sg_shader_ref_ptr(&pip->cmn.shader);
+        bool valid = true;
+        for (size_t i = 0; i < SG_MAX_VERTEXBUFFER_BINDSLOTS; i++) {
+            if (pip->cmn.vertex_buffer_layout_active[i]) {
+                const _sg_buffer_t* buf = _sg_lookup_buffer(bindings->vertex_buffers[i].id);
+                valid &= buf && (buf->slot.state == SG_RESOURCESTATE_VALID);
+            }
+        }
+        if (pip->cmn.index_type != SG_INDEXTYPE_NONE) {
+            const _sg_buffer_t* buf = _sg_lookup_buffer(bindings->index_buffer.id);
+            valid &= buf && (buf->slot.state == SG_RESOURCESTATE_VALID);
+        }
+        for (size_t i = 0; i < SG_MAX_VIEW_BINDSLOTS; i++) {
+            if (shd->cmn.views[i].view_type != SG_VIEWTYPE_INVALID) {
+                const _sg_view_t* view = _sg_lookup_view(bindings->views[i].id);
+                valid &= view && (view->slot.state == SG_RESOURCESTATE_VALID);
+            }
+        }
+        for (size_t i = 0; i < SG_MAX_SAMPLER_BINDSLOTS; i++) {
+            if (shd->cmn.samplers[i].stage != SG_SHADERSTAGE_NONE) {
+                const _sg_sampler_t* smp = _sg_lookup_sampler(bindings->samplers[i].id);
+                valid &= smp && (smp->slot.state == SG_RESOURCESTATE_VALID);
+            }
+        }
+        if (!valid) {
+            _SG_ERROR(COMMAND_LIST_BINDINGS_VALID);
+        }
+        return valid;
+    #endif
+}
+
+_SOKOL_PRIVATE bool _sg_cmdlist_validate_uniforms(const _sg_command_list_t* list, int ub_slot, const sg_range* data) {
+    #if !defined(SOKOL_DEBUG)
+        _SOKOL_UNUSED(list);
+        _SOKOL_UNUSED(ub_slot);
+        _SOKOL_UNUSED(data);
+        return true;
+    #else
+        if (_sg.desc.disable_validation) {
+            return true;
+        }
+        const _sg_pipeline_t* pip = _sg_lookup_pipeline(list->cur_pip.id);
+        if (!pip || !_sg_shader_ref_alive(&pip->cmn.shader)) {
+            _SG_ERROR(COMMAND_LIST_PIPELINE_VALID);
+            return false;
+        }
+        const _sg_shader_t* shd = _sg_shader_ref_ptr(&pip->cmn.shader);
+        const bool valid = (shd->cmn.uniform_blocks[ub_slot].stage != SG_SHADERSTAGE_NONE)
+            && (data->size == shd->cmn.uniform_blocks[ub_slot].size);
+        if (!valid) {
+            _SG_ERROR(COMMAND_LIST_UNIFORMS_SIZE);
+        }
+        return valid;
+    #endif
+}
+
+// replay a command list through the regular public API functions
+_SOKOL_PRIVATE void _sg_execute_command_list(const _sg_command_list_t* list) {
+    size_t pos = 0;
+    while (pos < list->pos) {
+        const _sg_cmd_header_t* hdr = (const _sg_cmd_header_t*)(list->buf + pos);
+        const void* payload = hdr + 1;
+        switch (hdr->type) {
+            case _SG_CMD_APPLY_VIEWPORT: {
+                const _sg_cmd_rect_t* cmd = (const _sg_cmd_rect_t*)payload;
+                sg_apply_viewport(cmd->x, cmd->y, cmd->width, cmd->height, cmd->origin_top_left);
+            } break;
+            case _SG_CMD_APPLY_SCISSOR_RECT: {
+                const _sg_cmd_rect_t* cmd = (const _sg_cmd_rect_t*)payload;
+                sg_apply_scissor_rect(cmd->x, cmd->y, cmd->width, cmd->height, cmd->origin_top_left);
+            } break;
+            case _SG_CMD_APPLY_PIPELINE:
+                sg_apply_pipeline(*(const sg_pipeline*)payload);
+                break;
+            case _SG_CMD_APPLY_BINDINGS:
+                sg_apply_bindings((const sg_bindings*)payload);
+                break;
+            case _SG_CMD_APPLY_UNIFORMS: {
+                const _sg_cmd_uniforms_t* cmd = (const _sg_cmd_uniforms_t*)payload;
+                _SG_STRUCT(sg_range, data);
+                data.ptr = cmd + 1;
+                data.size = cmd->size;
+                sg_apply_uniforms(cmd->ub_slot, &data);
+            } break;
+            case _SG_CMD_DRAW: {
+                const _sg_cmd_draw_t* cmd = (const _sg_cmd_draw_t*)payload;
+                sg_draw(cmd->base_element, cmd->num_elements, cmd->num_instances);
+            } break;
+            case _SG_CMD_DRAW_EX: {
+                const _sg_cmd_draw_t* cmd = (const _sg_cmd_draw_t*)payload;
+                sg_draw_ex(cmd->base_element, cmd->num_elements, cmd->num_instances, cmd->base_vertex, cmd->base_instance);
+            } break;
+            default:
+                SOKOL_UNREACHABLE;
+                break;
+        }
+        SOKOL_ASSERT(hdr->size > 0);
+        pos += hdr->size;
+    }
+}
+
+// backend-agnostic uniform buffer usage tracking, the allocation math
+// mirrors the uniform buffer handling in the Metal, WebGPU and Vulkan backends
+_SOKOL_PRIVATE void _sg_setup_uniforms(const sg_desc* desc) {
+    SOKOL_ASSERT(desc->uniform_buffer_size > 0);
+    _sg.uniforms.size = (uint32_t)desc->uniform_buffer_size;
+    #if defined(SOKOL_METAL)
+    _sg.uniforms.align = _SG_MTL_UB_ALIGN;
+    #elif defined(SOKOL_WGPU)
+    _sg.uniforms.align = _sg.wgpu.limits.minUniformBufferOffsetAlignment;
+    #elif defined(SOKOL_VULKAN)
+    _sg.uniforms.align = (uint32_t)_sg.vk.dev_props.properties.limits.minUniformBufferOffsetAlignment;
+    #else
+    _sg.uniforms.align = 256;
+    #endif
+    SOKOL_ASSERT((_sg.uniforms.align > 0) && ((_sg.uniforms.align & (_sg.uniforms.align - 1)) == 0));
+}
+
+// returns false if the uniform data doesn't fit into the uniform buffer, the
+// required size is also tracked for skipped draws to get a useful high-water-mark
+_SOKOL_PRIVATE bool _sg_alloc_uniforms(size_t num_bytes) {
+    SOKOL_ASSERT(num_bytes > 0);
+    const uint32_t align = _sg.uniforms.align;
+    _sg.uniforms.required = _sg_roundup_pow2_u32(_sg.uniforms.required + (uint32_t)num_bytes, align);
+    if ((0 != _sg.desc.uniform_buffer_warn_threshold) && !_sg.uniforms.warned) {
+        if (_sg.uniforms.required > (uint32_t)_sg.desc.uniform_buffer_warn_threshold) {
+            _sg.uniforms.warned = true;
+            _SG_WARN(UNIFORM_BUFFER_WARN_THRESHOLD);
+        }
+    }
+    if (!_sg.next_draw_valid) {
+        return true;
+    }
+    // GL and D3D11 don't use a uniform buffer and are only tracked for sizing
+    #if defined(SOKOL_METAL) || defined(SOKOL_WGPU) || defined(SOKOL_VULKAN) || defined(SOKOL_DUMMY_BACKEND)
+    if (_sg.uniforms.overflown || ((_sg.uniforms.offset + num_bytes) > _sg.uniforms.size)) {
+        if (!_sg.uniforms.overflown) {
+            _sg.uniforms.overflown = true;
+            _SG_ERROR(UNIFORM_BUFFER_OVERFLOW);
+        }
+        return false;
+    }
+    #endif
+    _sg.uniforms.offset = _sg_roundup_pow2_u32(_sg.uniforms.offset + (uint32_t)num_bytes, align);
+    return true;
+}
+
+// called from sg_commit()
+_SOKOL_PRIVATE void _sg_update_uniforms(void) {
+    if (_sg.uniforms.required > _sg.uniforms.peak) {
+        _sg.uniforms.peak = _sg.uniforms.required;
+    }
+    _sg_stats_add(uniform_buffer_used, _sg.uniforms.required);
+    if (_sg.desc.uniform_buffer_auto_grow && _sg.uniforms.overflown) {
+        uint32_t new_size = _sg.uniforms.size;
+        while (new_size < _sg.uniforms.required) {
+            new_size *= 2;
+        }
+        _sg_grow_uniform_buffer(new_size);
+        _sg.uniforms.size = new_size;
+        _SG_INFO(UNIFORM_BUFFER_GROWN);
+    }
+    if (_sg.stats_enabled) {
+        _sg.stats.cur_frame.uniform_buffer_peak = _sg.uniforms.peak;
+        _sg.stats.cur_frame.uniform_buffer_size = _sg.uniforms.size;
+    }
+    _sg.uniforms.offset = 0;
+    _sg.uniforms.required = 0;
+    _sg.uniforms.overflown = false;
+    _sg.uniforms.warned = false;
+}
+
+// per-frame budget tracking, the budget callback is called when a budget
+// item is exceeded for the first time in a frame
+_SOKOL_PRIVATE sg_budget_state _sg_budget_state(void) {
+    _SG_STRUCT(sg_budget_state, state);
+    state.budget = _sg.budget.budget;
+    state.used = _sg.budget.used;
+    state.num_draws_exceeded = (0 != state.budget.num_draws) && (state.used.num_draws > state.budget.num_draws);
+    state.num_passes_exceeded = (0 != state.budget.num_passes) && (state.used.num_passes > state.budget.num_passes);
+    state.upload_bytes_exceeded = (0 != state.budget.upload_bytes) && (state.used.upload_bytes > state.budget.upload_bytes);
+    state.exceeded = state.num_draws_exceeded || state.num_passes_exceeded || state.upload_bytes_exceeded;
+    return state;
+}
+
+_SOKOL_PRIVATE void _sg_budget_add(sg_budget_item item, size_t val) {
+    uint32_t budget = 0;
+    uint32_t used = 0;
+    switch (item) {
+        case SG_BUDGETITEM_NUM_DRAWS:
+            budget = _sg.budget.budget.num_draws;
+            used = _sg.budget.used.num_draws += (uint32_t)val;
+            break;
+        case SG_BUDGETITEM_NUM_PASSES:
+            budget = _sg.budget.budget.num_passes;
+            used = _sg.budget.used.num_passes += (uint32_t)val;
+            break;
+        case SG_BUDGETITEM_UPLOAD_BYTES:
+            budget = _sg.budget.budget.upload_bytes;
+            used = _sg.budget.used.upload_bytes += (uint32_t)val;
+            break;
+        default:
+            SOKOL_UNREACHABLE;
+            break;
+    }
+    if ((0 != budget) && (used > budget) && !_sg.budget.exceeded[item]) {
+        _sg.budget.exceeded[item] = true;
+        if (_sg.desc.budget_callback.func) {
+            const sg_budget_state state = _sg_budget_state();
+            _sg.desc.budget_callback.func(item, &state, _sg.desc.budget_callback.user_data);
+        }
+    }
+}
+
+// called from sg_commit()
+_SOKOL_PRIVATE void _sg_update_budget(void) {
+    _sg_clear(&_sg.budget.used, sizeof(_sg.budget.used));
+    _sg_clear(_sg.budget.exceeded, sizeof(_sg.budget.exceeded));
+}
+
 _SOKOL_PRIVATE sg_desc _sg_desc_defaults(const sg_desc* desc) {
     /*
         NOTE: on WebGPU, the default color pixel format MUST be provided,
@@ -25882,6 +28950,10 @@ _SOKOL_PRIVATE sg_desc _sg_desc_defaults(const sg_desc* desc) {
     res.view_pool_size = _sg_def(res.view_pool_size, _SG_DEFAULT_VIEW_POOL_SIZE);
     res.uniform_buffer_size = _sg_def(res.uniform_buffer_size, _SG_DEFAULT_UB_SIZE);
     res.max_commit_listeners = _sg_def(res.max_commit_listeners, _SG_DEFAULT_MAX_COMMIT_LISTENERS);
+    res.max_readbacks = _sg_def(res.max_readbacks, _SG_DEFAULT_MAX_READBACKS);
+    res.max_timers = _sg_def(res.max_timers, _SG_DEFAULT_MAX_TIMERS);
+    res.occlusion_query_pool_size = _sg_def(res.occlusion_query_pool_size, _SG_DEFAULT_OCCLUSION_QUERY_POOL_SIZE);
+    res.command_list_pool_size = _sg_def(res.command_list_pool_size, _SG_DEFAULT_COMMAND_LIST_POOL_SIZE);
     res.wgpu.bindgroups_cache_size = _sg_def(res.wgpu.bindgroups_cache_size, _SG_DEFAULT_WGPU_BINDGROUP_CACHE_SIZE);
     res.vulkan.copy_staging_buffer_size = _sg_def(res.vulkan.copy_staging_buffer_size, _SG_DEFAULT_VK_COPY_STAGING_SIZE);
     res.vulkan.stream_staging_buffer_size = _sg_def(res.vulkan.stream_staging_buffer_size, _SG_DEFAULT_VK_STREAM_STAGING_SIZE);
@@ -25909,17 +28981,55 @@ _SOKOL_PRIVATE sg_write_buffer_desc _sg_write_buffer_desc_defaults(const sg_writ
     return res;
 }
 
-_SOKOL_PRIVATE sg_write_image_desc _sg_write_image_desc_defaults(const _sg_image_t* img, const sg_write_image_desc* desc) {
+_SOKOL_PRIVATE sg_read_buffer_desc _sg_read_buffer_desc_defaults(const _sg_buffer_t* buf, const sg_read_buffer_desc* desc) {
+    sg_read_buffer_desc res = *desc;
+    const size_t buf_size = (size_t)buf->cmn.size;
+    res.size = _sg_def(res.size, (desc->src.offset < buf_size) ? (buf_size - desc->src.offset) : 0);
+    return res;
+}
+
+_SOKOL_PRIVATE sg_read_image_desc _sg_read_image_desc_defaults(const _sg_image_t* img, const sg_read_image_desc* desc) {
+    sg_read_image_desc res = *desc;
+    const int mip_width = _sg_miplevel_dim(_sg_image_cold(img)->width, desc->src.mip_level);
+    const int mip_height = _sg_miplevel_dim(_sg_image_cold(img)->height, desc->src.mip_level);
+    res.size.width = _sg_def(res.size.width, mip_width - desc->src.x);
+    res.size.height = _sg_def(res.size.height, mip_height - desc->src.y);
+    res.size.num_slices = _sg_def(res.size.num_slices, 1);
+    return res;
+}
+
+_SOKOL_PRIVATE sg_write_image_desc _sg_write_image_desc_defaults(const _sg_image_t* img, const sg_write_image_desc* desc) {
+    const _sg_image_cold_t* cold = _sg_image_cold(img);
+    sg_write_image_desc res = *desc;
+    const sg_pixel_format fmt = cold->pixel_format;
+    const int mip_width = _sg_miplevel_dim(cold->width, desc->dst.mip_level);
+    const int mip_height = _sg_miplevel_dim(cold->height, desc->dst.mip_level);
+    const int mip_depth_or_slices = (SG_IMAGETYPE_3D == cold->type) ? _sg_miplevel_dim(cold->num_slices, desc->dst.mip_level) : cold->num_slices;
+    res.src.bytes_per_row = _sg_def(res.src.bytes_per_row, _sg_row_pitch(fmt, mip_width, 1));
+    res.src.bytes_per_slice = _sg_def(res.src.bytes_per_slice, _sg_surface_pitch(fmt, mip_width, mip_height, 1));
+    res.size.width = _sg_def(res.size.width, mip_width - desc->dst.x);
+    res.size.height = _sg_def(res.size.height, mip_height - desc->dst.y);
+    res.size.num_slices = _sg_def(res.size.num_slices, mip_depth_or_slices - desc->dst.slice);
+    return res;
+}
+
+// same as _sg_write_image_desc_defaults(), but the source data defaults
+// to a tightly packed region instead of a complete mip level
+// NOTE: this runs before validation, so the mip level is clamped for
+// computing the default sizes (validation still catches a bad mip level)
+_SOKOL_PRIVATE sg_write_image_desc _sg_update_image_region_desc_defaults(const _sg_image_t* img, const sg_write_image_desc* desc) {
+    const _sg_image_cold_t* cold = _sg_image_cold(img);
     sg_write_image_desc res = *desc;
-    const sg_pixel_format fmt = img->cmn.pixel_format;
-    const int mip_width = _sg_miplevel_dim(img->cmn.width, desc->dst.mip_level);
-    const int mip_height = _sg_miplevel_dim(img->cmn.height, desc->dst.mip_level);
-    const int mip_depth_or_slices = (SG_IMAGETYPE_3D == img->cmn.type) ? _sg_miplevel_dim(img->cmn.num_slices, desc->dst.mip_level) : img->cmn.num_slices;
-    res.src.bytes_per_row = _sg_def(res.src.bytes_per_row, _sg_row_pitch(fmt, mip_width, 1));
-    res.src.bytes_per_slice = _sg_def(res.src.bytes_per_slice, _sg_surface_pitch(fmt, mip_width, mip_height, 1));
+    const sg_pixel_format fmt = cold->pixel_format;
+    const int mip_level = _sg_clamp(desc->dst.mip_level, 0, cold->num_mipmaps - 1);
+    const int mip_width = _sg_miplevel_dim(cold->width, mip_level);
+    const int mip_height = _sg_miplevel_dim(cold->height, mip_level);
+    const int mip_depth_or_slices = (SG_IMAGETYPE_3D == cold->type) ? _sg_miplevel_dim(cold->num_slices, mip_level) : cold->num_slices;
     res.size.width = _sg_def(res.size.width, mip_width - desc->dst.x);
     res.size.height = _sg_def(res.size.height, mip_height - desc->dst.y);
     res.size.num_slices = _sg_def(res.size.num_slices, mip_depth_or_slices - desc->dst.slice);
+    res.src.bytes_per_row = _sg_def(res.src.bytes_per_row, _sg_row_pitch(fmt, res.size.width, 1));
+    res.src.bytes_per_slice = _sg_def(res.src.bytes_per_slice, _sg_surface_pitch(fmt, res.size.width, res.size.height, 1));
     return res;
 }
 
@@ -25934,6 +29044,7 @@ _SOKOL_PRIVATE void _sg_discard_all_resources(void) {
     for (int i = 1; i < _sg.pools.buffer_pool.size; i++) {
         sg_resource_state state = _sg.pools.buffers[i].slot.state;
         if (_sg_resource_state_valid_failed_unsealed(state)) {
+            _sg_discard_buffer_map_staging(&_sg.pools.buffers[i]);
             _sg_discard_buffer(&_sg.pools.buffers[i]);
         }
     }
@@ -25996,15 +29107,25 @@ SOKOL_API_IMPL void sg_setup(const sg_desc* desc) {
     _sg.desc = _sg_desc_defaults(desc);
     _sg_setup_pools(&_sg.pools, &_sg.desc);
     _sg_setup_commit_listeners(&_sg.desc);
+    _sg_setup_readbacks(&_sg.desc);
+    _sg_setup_timers(&_sg.desc);
+    _sg_setup_occlusion_queries(&_sg.desc);
+    _sg_setup_command_lists(&_sg.desc);
     _sg.frame_index = 1;
     _sg.stats_enabled = true;
     _sg_setup_backend(&_sg.desc);
+    _sg_setup_uniforms(&_sg.desc);
+    _sg.budget.budget = _sg.desc.frame_budget;
     _sg_override_portable_limits();
     _sg.valid = true;
 }
 
 SOKOL_API_IMPL void sg_shutdown(void) {
     SOKOL_ASSERT(_sg.valid);
+    _sg_discard_readbacks();
+    _sg_discard_timers();
+    _sg_discard_occlusion_queries();
+    _sg_discard_command_lists();
     _sg_discard_all_resources();
     _sg_discard_backend();
     _sg_discard_commit_listeners();
@@ -26140,6 +29261,55 @@ SOKOL_API_IMPL sg_view sg_alloc_view(void) {
     return res;
 }
 
+// the batch alloc functions reserve all pool slots or none at all
+SOKOL_API_IMPL bool sg_alloc_buffers(int num, sg_buffer* out_bufs) {
+    SOKOL_ASSERT(_sg.valid);
+    SOKOL_ASSERT(out_bufs && (num >= 0));
+    if (_sg_pool_num_free(&_sg.pools.buffer_pool) < num) {
+        _SG_ERROR(BUFFER_POOL_EXHAUSTED);
+        _sg_clear(out_bufs, sizeof(sg_buffer) * (size_t)num);
+        return false;
+    }
+    for (int i = 0; i < num; i++) {
+        out_bufs[i] = _sg_alloc_buffer();
+        SOKOL_ASSERT(out_bufs[i].id != SG_INVALID_ID);
+        _SG_TRACE_ARGS(alloc_buffer, out_bufs[i]);
+    }
+    return true;
+}
+
+SOKOL_API_IMPL bool sg_alloc_images(int num, sg_image* out_imgs) {
+    SOKOL_ASSERT(_sg.valid);
+    SOKOL_ASSERT(out_imgs && (num >= 0));
+    if (_sg_pool_num_free(&_sg.pools.image_pool) < num) {
+        _SG_ERROR(IMAGE_POOL_EXHAUSTED);
+        _sg_clear(out_imgs, sizeof(sg_image) * (size_t)num);
+        return false;
+    }
+    for (int i = 0; i < num; i++) {
+        out_imgs[i] = _sg_alloc_image();
+        SOKOL_ASSERT(out_imgs[i].id != SG_INVALID_ID);
+        _SG_TRACE_ARGS(alloc_image, out_imgs[i]);
+    }
+    return true;
+}
+
+SOKOL_API_IMPL bool sg_alloc_views(int num, sg_view* out_views) {
+    SOKOL_ASSERT(_sg.valid);
+    SOKOL_ASSERT(out_views && (num >= 0));
+    if (_sg_pool_num_free(&_sg.pools.view_pool) < num) {
+        _SG_ERROR(VIEW_POOL_EXHAUSTED);
+        _sg_clear(out_views, sizeof(sg_view) * (size_t)num);
+        return false;
+    }
+    for (int i = 0; i < num; i++) {
+        out_views[i] = _sg_alloc_view();
+        SOKOL_ASSERT(out_views[i].id != SG_INVALID_ID);
+        _SG_TRACE_ARGS(alloc_view, out_views[i]);
+    }
+    return true;
+}
+
 SOKOL_API_IMPL void sg_dealloc_buffer(sg_buffer buf_id) {
     SOKOL_ASSERT(_sg.valid);
     _sg_buffer_t* buf = _sg_lookup_buffer(buf_id.id);
@@ -26745,6 +29915,7 @@ SOKOL_API_IMPL void sg_begin_pass(const sg_pass* pass) {
         _sg.cur_pass.valid = false;
         return;
     }
+    _sg_budget_add(SG_BUDGETITEM_NUM_PASSES, 1);
     _sg_begin_pass(&pass_def, &atts_ptrs);
 }
 
@@ -26899,6 +30070,10 @@ SOKOL_API_IMPL void sg_apply_uniforms(int ub_slot, const sg_range* data) {
         _sg.next_draw_valid = false;
         return;
     }
+    if (!_sg_alloc_uniforms(data->size)) {
+        _sg.next_draw_valid = false;
+        return;
+    }
     if (!_sg.next_draw_valid) {
         return;
     }
@@ -26931,6 +30106,7 @@ SOKOL_API_IMPL void sg_draw(int base_element, int num_elements, int num_instance
         return;
     }
     #endif
+    _sg_budget_add(SG_BUDGETITEM_NUM_DRAWS, 1);
     _sg_draw(base_element, num_elements, num_instances, 0, 0);
 }
 
@@ -26946,6 +30122,7 @@ SOKOL_API_IMPL void sg_draw_ex(int base_element, int num_elements, int num_insta
         return;
     }
     #endif
+    _sg_budget_add(SG_BUDGETITEM_NUM_DRAWS, 1);
     _sg_draw(base_element, num_elements, num_instances, base_vertex, base_instance);
 }
 
@@ -26968,6 +30145,7 @@ SOKOL_API_IMPL void sg_dispatch(int num_groups_x, int num_groups_y, int num_grou
         return;
     }
     #endif
+    _sg_budget_add(SG_BUDGETITEM_NUM_DRAWS, 1);
     _sg_dispatch(num_groups_x, num_groups_y, num_groups_z);
 }
 
@@ -26976,6 +30154,20 @@ SOKOL_API_IMPL void sg_end_pass(void) {
     SOKOL_ASSERT(_sg.cur_pass.in_pass);
     _sg_stats_inc(num_passes);
     _SG_TRACE_NOARGS(end_pass);
+    if (_sg.timers.in_scope) {
+        _SG_WARN(END_PASS_TIMER_NOT_ENDED);
+        _sg.timers.in_scope = false;
+        if (_sg.timers.cur) {
+            _sg_end_active_timer();
+        }
+    }
+    if (_sg.occlusion_queries.in_scope) {
+        _SG_WARN(END_PASS_OCCLUSION_QUERY_NOT_ENDED);
+        _sg.occlusion_queries.in_scope = false;
+        if (_sg.occlusion_queries.cur) {
+            _sg_end_active_occlusion_query();
+        }
+    }
     // NOTE: don't exit early if !_sg.cur_pass.valid
     if (!_sg.cur_pass.swapchain.invalid) {
         const _sg_attachments_ptrs_t atts_ptrs = _sg_attachments_ptrs(&_sg.cur_pass.atts);
@@ -26989,9 +30181,16 @@ SOKOL_API_IMPL void sg_commit(void) {
     SOKOL_ASSERT(_sg.valid);
     SOKOL_ASSERT(!_sg.cur_pass.valid);
     SOKOL_ASSERT(!_sg.cur_pass.in_pass);
+    // a buffer left mapped is only reported, the frame is committed anyway
+    _sg_validate_commit();
     _sg_commit();
+    _sg_update_readbacks();
+    _sg_update_timers();
+    _sg_update_occlusion_queries();
+    _sg_update_uniforms();
     _sg_update_stats();
     _sg_notify_commit_listeners();
+    _sg_update_budget();
     _SG_TRACE_NOARGS(commit);
     _sg.frame_index++;
 }
@@ -27012,11 +30211,12 @@ SOKOL_API_IMPL void sg_update_buffer(sg_buffer buf_id, const sg_range* data) {
         if (_sg_validate_update_buffer(buf, data)) {
             SOKOL_ASSERT(data->size <= (size_t)buf->cmn.size);
             // only one update allowed per buffer and frame
-            SOKOL_ASSERT(buf->cmn.update_frame_index != _sg.frame_index);
+            SOKOL_ASSERT(_sg_buffer_cold(buf)->update_frame_index != _sg.frame_index);
             // update and append on same buffer in same frame not allowed
-            SOKOL_ASSERT(buf->cmn.append_frame_index != _sg.frame_index);
+            SOKOL_ASSERT(_sg_buffer_cold(buf)->append_frame_index != _sg.frame_index);
             _sg_update_buffer(buf, data);
-            buf->cmn.update_frame_index = _sg.frame_index;
+            _sg_buffer_cold(buf)->update_frame_index = _sg.frame_index;
+            _sg_budget_add(SG_BUDGETITEM_UPLOAD_BYTES, data->size);
         }
     }
     _SG_TRACE_ARGS(update_buffer, buf_id, data);
@@ -27031,25 +30231,26 @@ SOKOL_API_IMPL int sg_append_buffer(sg_buffer buf_id, const sg_range* data) {
     int result;
     if (buf) {
         // rewind append cursor in a new frame
-        if (buf->cmn.append_frame_index != _sg.frame_index) {
-            buf->cmn.append_pos = 0;
-            buf->cmn.append_overflow = false;
+        if (_sg_buffer_cold(buf)->append_frame_index != _sg.frame_index) {
+            _sg_buffer_cold(buf)->append_pos = 0;
+            _sg_buffer_cold(buf)->append_overflow = false;
         }
-        if (((size_t)buf->cmn.append_pos + data->size) > (size_t)buf->cmn.size) {
-            buf->cmn.append_overflow = true;
+        if (((size_t)_sg_buffer_cold(buf)->append_pos + data->size) > (size_t)buf->cmn.size) {
+            _sg_buffer_cold(buf)->append_overflow = true;
         }
-        const int start_pos = buf->cmn.append_pos;
+        const int start_pos = _sg_buffer_cold(buf)->append_pos;
         // NOTE: the multiple-of-4 requirement for the buffer offset is coming
         // from WebGPU, but we want identical behaviour between backends
         SOKOL_ASSERT(_sg_multiple_u64((uint64_t)start_pos, 4));
         if (buf->slot.state == SG_RESOURCESTATE_VALID) {
             if (_sg_validate_append_buffer(buf, data)) {
-                if (!buf->cmn.append_overflow && (data->size > 0)) {
+                if (!_sg_buffer_cold(buf)->append_overflow && (data->size > 0)) {
                     // update and append on same buffer in same frame not allowed
-                    SOKOL_ASSERT(buf->cmn.update_frame_index != _sg.frame_index);
-                    _sg_append_buffer(buf, data, buf->cmn.append_frame_index != _sg.frame_index);
-                    buf->cmn.append_pos += (int) _sg_roundup_pow2_u64(data->size, 4);
-                    buf->cmn.append_frame_index = _sg.frame_index;
+                    SOKOL_ASSERT(_sg_buffer_cold(buf)->update_frame_index != _sg.frame_index);
+                    _sg_append_buffer(buf, data, _sg_buffer_cold(buf)->append_frame_index != _sg.frame_index);
+                    _sg_buffer_cold(buf)->append_pos += (int) _sg_roundup_pow2_u64(data->size, 4);
+                    _sg_buffer_cold(buf)->append_frame_index = _sg.frame_index;
+                    _sg_budget_add(SG_BUDGETITEM_UPLOAD_BYTES, data->size);
                 }
             }
         }
@@ -27062,10 +30263,67 @@ SOKOL_API_IMPL int sg_append_buffer(sg_buffer buf_id, const sg_range* data) {
     return result;
 }
 
+SOKOL_API_IMPL void* sg_map_buffer(sg_buffer buf_id, size_t size) {
+    SOKOL_ASSERT(_sg.valid);
+    _sg_stats_inc(num_update_buffer);
+    _sg_stats_add(size_update_buffer, (uint32_t)size);
+    void* ptr = 0;
+    _sg_buffer_t* buf = _sg_lookup_buffer(buf_id.id);
+    if (buf && (buf->slot.state == SG_RESOURCESTATE_VALID)) {
+        if (_sg_validate_map_buffer(buf, size)) {
+            _sg_buffer_cold_t* cold = _sg_buffer_cold(buf);
+            if ((size > 0) && (size <= (size_t)buf->cmn.size) && !cold->mapped) {
+                // only one update allowed per buffer and frame
+                SOKOL_ASSERT(cold->update_frame_index != _sg.frame_index);
+                // update and append on same buffer in same frame not allowed
+                SOKOL_ASSERT(cold->append_frame_index != _sg.frame_index);
+                ptr = _sg_map_buffer(buf, size);
+                cold->map_staged = (0 == ptr);
+                if (cold->map_staged) {
+                    // no direct mapping on this backend, write into staging memory
+                    // which is copied into the buffer in sg_unmap_buffer()
+                    if (0 == cold->map_staging) {
+                        cold->map_staging = _sg_malloc((size_t)buf->cmn.size);
+                    }
+                    ptr = cold->map_staging;
+                }
+                cold->mapped = true;
+                _sg.num_mapped_buffers++;
+                cold->map_size = size;
+                cold->update_frame_index = _sg.frame_index;
+                _sg_budget_add(SG_BUDGETITEM_UPLOAD_BYTES, size);
+            }
+        }
+    }
+    return ptr;
+}
+
+SOKOL_API_IMPL void sg_unmap_buffer(sg_buffer buf_id) {
+    SOKOL_ASSERT(_sg.valid);
+    _sg_buffer_t* buf = _sg_lookup_buffer(buf_id.id);
+    if (buf && (buf->slot.state == SG_RESOURCESTATE_VALID)) {
+        _sg_buffer_cold_t* cold = _sg_buffer_cold(buf);
+        if (_sg_validate_unmap_buffer(buf) && cold->mapped) {
+            if (cold->map_staged) {
+                SOKOL_ASSERT(cold->map_staging);
+                const sg_range data = { cold->map_staging, cold->map_size };
+                _sg_update_buffer(buf, &data);
+            } else {
+                _sg_unmap_buffer(buf, cold->map_size);
+            }
+            cold->mapped = false;
+            SOKOL_ASSERT(_sg.num_mapped_buffers > 0);
+            _sg.num_mapped_buffers--;
+            cold->map_staged = false;
+            cold->map_size = 0;
+        }
+    }
+}
+
 SOKOL_API_IMPL bool sg_query_buffer_overflow(sg_buffer buf_id) {
     SOKOL_ASSERT(_sg.valid);
     _sg_buffer_t* buf = _sg_lookup_buffer(buf_id.id);
-    bool result = buf ? buf->cmn.append_overflow : false;
+    bool result = buf ? _sg_buffer_cold(buf)->append_overflow : false;
     return result;
 }
 
@@ -27074,9 +30332,9 @@ SOKOL_API_IMPL bool sg_query_buffer_will_overflow(sg_buffer buf_id, size_t size)
     _sg_buffer_t* buf = _sg_lookup_buffer(buf_id.id);
     bool result = false;
     if (buf) {
-        int append_pos = buf->cmn.append_pos;
+        int append_pos = _sg_buffer_cold(buf)->append_pos;
         // rewind append cursor in a new frame
-        if (buf->cmn.append_frame_index != _sg.frame_index) {
+        if (_sg_buffer_cold(buf)->append_frame_index != _sg.frame_index) {
             append_pos = 0;
         }
         if ((append_pos + _sg_roundup_pow2((int)size, 4)) > buf->cmn.size) {
@@ -27086,6 +30344,438 @@ SOKOL_API_IMPL bool sg_query_buffer_will_overflow(sg_buffer buf_id, size_t size)
     return result;
 }
 
+SOKOL_API_IMPL sg_budget_state sg_query_budget_state(void) {
+    SOKOL_ASSERT(_sg.valid);
+    return _sg_budget_state();
+}
+
+SOKOL_API_IMPL bool sg_query_budget_will_exceed(const sg_frame_budget* work) {
+    SOKOL_ASSERT(_sg.valid);
+    SOKOL_ASSERT(work);
+    const sg_frame_budget* budget = &_sg.budget.budget;
+    const sg_frame_budget* used = &_sg.budget.used;
+    return ((0 != budget->num_draws) && (((uint64_t)used->num_draws + work->num_draws) > budget->num_draws))
+        || ((0 != budget->num_passes) && (((uint64_t)used->num_passes + work->num_passes) > budget->num_passes))
+        || ((0 != budget->upload_bytes) && (((uint64_t)used->upload_bytes + work->upload_bytes) > budget->upload_bytes));
+}
+
+SOKOL_API_IMPL sg_readback sg_read_buffer(const sg_read_buffer_desc* desc) {
+    SOKOL_ASSERT(_sg.valid);
+    SOKOL_ASSERT(desc);
+    _sg_stats_inc(num_read_buffer);
+    sg_readback res = { SG_INVALID_ID };
+    if (!_sg.features.readback) {
+        _SG_ERROR(READBACK_NOT_SUPPORTED);
+        return res;
+    }
+    _sg_buffer_t* buf = _sg_lookup_buffer(desc->src.buffer.id);
+    if (buf) {
+        const sg_read_buffer_desc desc_def = _sg_read_buffer_desc_defaults(buf, desc);
+        if (_sg_validate_read_buffer(buf, &desc_def) && (buf->slot.state == SG_RESOURCESTATE_VALID)) {
+            _sg_readback_t* rb = _sg_alloc_readback(&desc_def.dst, desc_def.size, desc_def.callback, desc_def.user_data);
+            if (rb) {
+                _sg_stats_add(size_read_buffer, (uint32_t)desc_def.size);
+                rb->failed = !_sg_read_buffer(rb, buf, &desc_def);
+                res.id = rb->id;
+            }
+        }
+    } else {
+        _SG_ERROR(READ_BUFFER_BUFFER_ALIVE);
+    }
+    return res;
+}
+
+SOKOL_API_IMPL sg_readback sg_read_image(const sg_read_image_desc* desc) {
+    SOKOL_ASSERT(_sg.valid);
+    SOKOL_ASSERT(desc);
+    _sg_stats_inc(num_read_image);
+    sg_readback res = { SG_INVALID_ID };
+    if (!_sg.features.readback) {
+        _SG_ERROR(READBACK_NOT_SUPPORTED);
+        return res;
+    }
+    _sg_image_t* img = _sg_lookup_image(desc->src.image.id);
+    if (img) {
+        const sg_read_image_desc desc_def = _sg_read_image_desc_defaults(img, desc);
+        if (_sg_validate_read_image(img, &desc_def) && (img->slot.state == SG_RESOURCESTATE_VALID)) {
+            const size_t num_bytes = (size_t)_sg_surface_pitch(_sg_image_cold(img)->pixel_format, desc_def.size.width, desc_def.size.height, 1);
+            _sg_readback_t* rb = _sg_alloc_readback(&desc_def.dst, num_bytes, desc_def.callback, desc_def.user_data);
+            if (rb) {
+                _sg_stats_add(size_read_image, (uint32_t)num_bytes);
+                rb->failed = !_sg_read_image(rb, img, &desc_def);
+                res.id = rb->id;
+            }
+        }
+    } else {
+        _SG_ERROR(READ_IMAGE_IMAGE_ALIVE);
+    }
+    return res;
+}
+
+SOKOL_API_IMPL sg_readback_state sg_query_readback_state(sg_readback readback) {
+    SOKOL_ASSERT(_sg.valid);
+    const _sg_readback_t* rb = _sg_lookup_readback(readback.id);
+    return rb ? rb->state : SG_READBACKSTATE_INVALID;
+}
+
+SOKOL_API_IMPL void sg_begin_timer(const char* label) {
+    SOKOL_ASSERT(_sg.valid);
+    SOKOL_ASSERT(label);
+    _sg_timer_t* timer = _sg_lookup_timer(label);
+    if (!_sg_validate_begin_timer(label, timer)) {
+        return;
+    }
+    _sg.timers.in_scope = true;
+    // NOTE: on backends without GPU timer support (or inside an invalid
+    // pass) the timer scope is tracked, but nothing is measured
+    if (!_sg.features.gpu_timers || !_sg.cur_pass.valid) {
+        return;
+    }
+    if (0 == timer) {
+        timer = _sg_alloc_timer(label);
+        if (0 == timer) {
+            return;
+        }
+    }
+    _sg_timer_frame_t* frame = &timer->frames[_sg.frame_index % _SG_NUM_TIMER_FRAMES];
+    if (frame->pending) {
+        // the measurement previously recorded into this ring slot was never resolved, drop it
+        frame->pending = false;
+        _sg.timers.num_pending -= 1;
+    }
+    frame->frame_index = _sg.frame_index;
+    _sg_begin_timer(frame);
+    _sg.timers.cur = timer;
+}
+
+SOKOL_API_IMPL void sg_end_timer(void) {
+    SOKOL_ASSERT(_sg.valid);
+    if (!_sg_validate_end_timer()) {
+        return;
+    }
+    _sg.timers.in_scope = false;
+    if (_sg.timers.cur) {
+        _sg_end_active_timer();
+    }
+}
+
+SOKOL_API_IMPL sg_timer_result sg_query_timer(const char* label) {
+    SOKOL_ASSERT(_sg.valid);
+    SOKOL_ASSERT(label);
+    sg_timer_result res;
+    _sg_clear(&res, sizeof(res));
+    const _sg_timer_t* timer = _sg_lookup_timer(label);
+    if (timer) {
+        res = timer->result;
+    }
+    return res;
+}
+
+SOKOL_API_IMPL sg_occlusion_query sg_make_occlusion_query(const sg_occlusion_query_desc* desc) {
+    SOKOL_ASSERT(_sg.valid);
+    SOKOL_ASSERT(desc);
+    _SG_STRUCT(sg_occlusion_query, res);
+    if (!_sg_validate_occlusion_query_desc(desc)) {
+        return res;
+    }
+    const int slot_index = _sg_pool_alloc_index(&_sg.occlusion_queries.pool);
+    if (_SG_INVALID_SLOT_INDEX == slot_index) {
+        _SG_ERROR(OCCLUSION_QUERY_POOL_EXHAUSTED);
+        return res;
+    }
+    _sg_occlusion_query_t* query = &_sg.occlusion_queries.items[slot_index];
+    _sg_clear(query, sizeof(_sg_occlusion_query_t));
+    const uint32_t ctr = ++_sg.occlusion_queries.pool.gen_ctrs[slot_index];
+    query->id = (ctr<<_SG_SLOT_SHIFT)|(slot_index & _SG_SLOT_MASK);
+    query->type = _sg_def(desc->type, SG_OCCLUSIONQUERYTYPE_ANY_SAMPLES_PASSED);
+    #if defined(SOKOL_DUMMY_BACKEND)
+    query->dummy.num_samples = 1;
+    #endif
+    res.id = query->id;
+    return res;
+}
+
+SOKOL_API_IMPL void sg_destroy_occlusion_query(sg_occlusion_query query_id) {
+    SOKOL_ASSERT(_sg.valid);
+    _sg_occlusion_query_t* query = _sg_lookup_occlusion_query(query_id.id);
+    if (0 == query) {
+        return;
+    }
+    if (_sg.occlusion_queries.cur == query) {
+        _sg_end_active_occlusion_query();
+    }
+    for (int fi = 0; fi < _SG_NUM_OCCLUSION_QUERY_FRAMES; fi++) {
+        _sg_occlusion_query_frame_t* frame = &query->frames[fi];
+        if (frame->pending) {
+            _sg.occlusion_queries.num_pending -= 1;
+        }
+        _sg_discard_occlusion_query(frame);
+    }
+    _sg_pool_free_index(&_sg.occlusion_queries.pool, _sg_slot_index(query->id));
+    _sg_clear(query, sizeof(_sg_occlusion_query_t));
+}
+
+SOKOL_API_IMPL void sg_begin_occlusion_query(sg_occlusion_query query_id) {
+    SOKOL_ASSERT(_sg.valid);
+    _sg_occlusion_query_t* query = _sg_lookup_occlusion_query(query_id.id);
+    if (0 == query) {
+        // NOTE: still open the query scope so that the matching
+        // sg_end_occlusion_query() doesn't produce a followup error
+        _SG_ERROR(BEGIN_OCCLUSION_QUERY_QUERY_ALIVE);
+        _sg.occlusion_queries.in_scope = true;
+        return;
+    }
+    if (!_sg_validate_begin_occlusion_query(query)) {
+        return;
+    }
+    _sg.occlusion_queries.in_scope = true;
+    // NOTE: on backends without occlusion query support (or inside an
+    // invalid pass) the query scope is tracked, but nothing is recorded
+    if (!_sg.features.occlusion_query || !_sg.cur_pass.valid) {
+        return;
+    }
+    _sg_occlusion_query_frame_t* frame = &query->frames[_sg.frame_index % _SG_NUM_OCCLUSION_QUERY_FRAMES];
+    if (frame->pending) {
+        // the result previously recorded into this ring slot was never resolved, drop it
+        frame->pending = false;
+        _sg.occlusion_queries.num_pending -= 1;
+    }
+    frame->frame_index = _sg.frame_index;
+    _sg_begin_occlusion_query(query, frame);
+    _sg.occlusion_queries.cur = query;
+}
+
+SOKOL_API_IMPL void sg_end_occlusion_query(void) {
+    SOKOL_ASSERT(_sg.valid);
+    if (!_sg_validate_end_occlusion_query()) {
+        return;
+    }
+    _sg.occlusion_queries.in_scope = false;
+    if (_sg.occlusion_queries.cur) {
+        _sg_end_active_occlusion_query();
+    }
+}
+
+SOKOL_API_IMPL sg_occlusion_query_result sg_query_occlusion_result(sg_occlusion_query query_id) {
+    SOKOL_ASSERT(_sg.valid);
+    _SG_STRUCT(sg_occlusion_query_result, res);
+    const _sg_occlusion_query_t* query = _sg_lookup_occlusion_query(query_id.id);
+    if (query) {
+        res = query->result;
+    }
+    return res;
+}
+
+SOKOL_API_IMPL sg_command_list sg_make_command_list(const sg_command_list_desc* desc) {
+    SOKOL_ASSERT(_sg.valid);
+    SOKOL_ASSERT(desc);
+    _SG_STRUCT(sg_command_list, res);
+    if (!_sg_validate_command_list_desc(desc)) {
+        return res;
+    }
+    const int slot_index = _sg_pool_alloc_index(&_sg.command_lists.pool);
+    if (_SG_INVALID_SLOT_INDEX == slot_index) {
+        _SG_ERROR(COMMAND_LIST_POOL_EXHAUSTED);
+        return res;
+    }
+    _sg_command_list_t* list = &_sg.command_lists.items[slot_index];
+    _sg_clear(list, sizeof(_sg_command_list_t));
+    const uint32_t ctr = ++_sg.command_lists.pool.gen_ctrs[slot_index];
+    list->id = (ctr<<_SG_SLOT_SHIFT)|(slot_index & _SG_SLOT_MASK);
+    list->size = _sg_def(desc->size, (size_t)_SG_DEFAULT_COMMAND_LIST_SIZE);
+    list->buf = (uint8_t*)_sg_malloc(list->size);
+    res.id = list->id;
+    return res;
+}
+
+SOKOL_API_IMPL void sg_destroy_command_list(sg_command_list list_id) {
+    SOKOL_ASSERT(_sg.valid);
+    _sg_command_list_t* list = _sg_lookup_command_list(list_id.id);
+    if (0 == list) {
+        return;
+    }
+    _sg_free(list->buf);
+    _sg_pool_free_index(&_sg.command_lists.pool, _sg_slot_index(list->id));
+    _sg_clear(list, sizeof(_sg_command_list_t));
+}
+
+SOKOL_API_IMPL void sg_begin_command_list(sg_command_list list_id) {
+    SOKOL_ASSERT(_sg.valid);
+    _sg_command_list_t* list = _sg_lookup_command_list(list_id.id);
+    if (0 == list) {
+        _SG_ERROR(COMMAND_LIST_ALIVE);
+        return;
+    }
+    if (list->recording) {
+        _SG_ERROR(COMMAND_LIST_ALREADY_RECORDING);
+    }
+    list->pos = 0;
+    list->num_commands = 0;
+    list->recording = true;
+    list->overflow = false;
+    list->has_pip = false;
+    list->next_draw_valid = false;
+    list->cur_pip.id = SG_INVALID_ID;
+}
+
+SOKOL_API_IMPL void sg_end_command_list(sg_command_list list_id) {
+    SOKOL_ASSERT(_sg.valid);
+    _sg_command_list_t* list = _sg_lookup_command_list(list_id.id);
+    if (0 == list) {
+        _SG_ERROR(COMMAND_LIST_ALIVE);
+        return;
+    }
+    if (!list->recording) {
+        _SG_ERROR(COMMAND_LIST_NOT_RECORDING);
+        return;
+    }
+    list->recording = false;
+}
+
+_SOKOL_PRIVATE void _sg_cmd_rect(sg_command_list list_id, _sg_cmd_type_t type, int x, int y, int width, int height, bool origin_top_left) {
+    _sg_command_list_t* list = _sg_cmdlist_recording(list_id.id);
+    if (0 == list) {
+        return;
+    }
+    _sg_cmd_rect_t* cmd = (_sg_cmd_rect_t*)_sg_cmdlist_alloc(list, type, sizeof(_sg_cmd_rect_t));
+    if (cmd) {
+        cmd->x = x;
+        cmd->y = y;
+        cmd->width = width;
+        cmd->height = height;
+        cmd->origin_top_left = origin_top_left;
+    }
+}
+
+SOKOL_API_IMPL void sg_cmd_apply_viewport(sg_command_list list_id, int x, int y, int width, int height, bool origin_top_left) {
+    SOKOL_ASSERT(_sg.valid);
+    _sg_cmd_rect(list_id, _SG_CMD_APPLY_VIEWPORT, x, y, width, height, origin_top_left);
+}
+
+SOKOL_API_IMPL void sg_cmd_apply_scissor_rect(sg_command_list list_id, int x, int y, int width, int height, bool origin_top_left) {
+    SOKOL_ASSERT(_sg.valid);
+    _sg_cmd_rect(list_id, _SG_CMD_APPLY_SCISSOR_RECT, x, y, width, height, origin_top_left);
+}
+
+SOKOL_API_IMPL void sg_cmd_apply_pipeline(sg_command_list list_id, sg_pipeline pip_id) {
+    SOKOL_ASSERT(_sg.valid);
+    _sg_command_list_t* list = _sg_cmdlist_recording(list_id.id);
+    if (0 == list) {
+        return;
+    }
+    // NOTE: an invalid pipeline still counts as recorded pipeline, so that
+    // the following commands are dropped without logging more errors
+    list->has_pip = true;
+    list->cur_pip = pip_id;
+    list->next_draw_valid = _sg_cmdlist_validate_pipeline(pip_id);
+    if (!list->next_draw_valid) {
+        return;
+    }
+    sg_pipeline* cmd = (sg_pipeline*)_sg_cmdlist_alloc(list, _SG_CMD_APPLY_PIPELINE, sizeof(sg_pipeline));
+    if (cmd) {
+        *cmd = pip_id;
+    }
+}
+
+SOKOL_API_IMPL void sg_cmd_apply_bindings(sg_command_list list_id, const sg_bindings* bindings) {
+    SOKOL_ASSERT(_sg.valid);
+    SOKOL_ASSERT(bindings);
+    SOKOL_ASSERT((bindings->_start_canary == 0) && (bindings->_end_canary == 0));
+    _sg_command_list_t* list = _sg_cmdlist_recording(list_id.id);
+    if ((0 == list) || !_sg_cmdlist_draw_state_valid(list)) {
+        return;
+    }
+    if (!_sg_cmdlist_validate_bindings(list, bindings)) {
+        list->next_draw_valid = false;
+        return;
+    }
+    sg_bindings* cmd = (sg_bindings*)_sg_cmdlist_alloc(list, _SG_CMD_APPLY_BINDINGS, sizeof(sg_bindings));
+    if (cmd) {
+        *cmd = *bindings;
+    }
+}
+
+SOKOL_API_IMPL void sg_cmd_apply_uniforms(sg_command_list list_id, int ub_slot, const sg_range* data) {
+    SOKOL_ASSERT(_sg.valid);
+    SOKOL_ASSERT((ub_slot >= 0) && (ub_slot < SG_MAX_UNIFORMBLOCK_BINDSLOTS));
+    SOKOL_ASSERT(data && data->ptr && (data->size > 0));
+    _sg_command_list_t* list = _sg_cmdlist_recording(list_id.id);
+    if ((0 == list) || !_sg_cmdlist_draw_state_valid(list)) {
+        return;
+    }
+    if (!_sg_cmdlist_validate_uniforms(list, ub_slot, data)) {
+        list->next_draw_valid = false;
+        return;
+    }
+    _sg_cmd_uniforms_t* cmd = (_sg_cmd_uniforms_t*)_sg_cmdlist_alloc(list, _SG_CMD_APPLY_UNIFORMS, sizeof(_sg_cmd_uniforms_t) + data->size);
+    if (cmd) {
+        cmd->ub_slot = ub_slot;
+        cmd->size = (uint32_t)data->size;
+        memcpy(cmd + 1, data->ptr, data->size);
+    }
+}
+
+_SOKOL_PRIVATE void _sg_cmd_draw(sg_command_list list_id, _sg_cmd_type_t type, int base_element, int num_elements, int num_instances, int base_vertex, int base_instance) {
+    _sg_command_list_t* list = _sg_cmdlist_recording(list_id.id);
+    if ((0 == list) || !_sg_cmdlist_draw_state_valid(list)) {
+        return;
+    }
+    // skip no-op draws
+    if ((0 == num_elements) || (0 == num_instances)) {
+        return;
+    }
+    _sg_cmd_draw_t* cmd = (_sg_cmd_draw_t*)_sg_cmdlist_alloc(list, type, sizeof(_sg_cmd_draw_t));
+    if (cmd) {
+        cmd->base_element = base_element;
+        cmd->num_elements = num_elements;
+        cmd->num_instances = num_instances;
+        cmd->base_vertex = base_vertex;
+        cmd->base_instance = base_instance;
+    }
+}
+
+SOKOL_API_IMPL void sg_cmd_draw(sg_command_list list_id, int base_element, int num_elements, int num_instances) {
+    SOKOL_ASSERT(_sg.valid);
+    _sg_cmd_draw(list_id, _SG_CMD_DRAW, base_element, num_elements, num_instances, 0, 0);
+}
+
+SOKOL_API_IMPL void sg_cmd_draw_ex(sg_command_list list_id, int base_element, int num_elements, int num_instances, int base_vertex, int base_instance) {
+    SOKOL_ASSERT(_sg.valid);
+    _sg_cmd_draw(list_id, _SG_CMD_DRAW_EX, base_element, num_elements, num_instances, base_vertex, base_instance);
+}
+
+SOKOL_API_IMPL void sg_execute_command_lists(const sg_command_list* lists, int num_lists) {
+    SOKOL_ASSERT(_sg.valid);
+    SOKOL_ASSERT((lists != 0) || (0 == num_lists));
+    SOKOL_ASSERT(num_lists >= 0);
+    if (!_sg_validate_execute_command_lists(lists, num_lists)) {
+        return;
+    }
+    if (!_sg.cur_pass.valid) {
+        return;
+    }
+    for (int i = 0; i < num_lists; i++) {
+        const _sg_command_list_t* list = _sg_lookup_command_list(lists[i].id);
+        if (list && !list->recording) {
+            _sg_execute_command_list(list);
+        }
+    }
+}
+
+SOKOL_API_IMPL sg_command_list_info sg_query_command_list_info(sg_command_list list_id) {
+    SOKOL_ASSERT(_sg.valid);
+    _SG_STRUCT(sg_command_list_info, res);
+    const _sg_command_list_t* list = _sg_lookup_command_list(list_id.id);
+    if (list) {
+        res.recording = list->recording;
+        res.overflow = list->overflow;
+        res.num_commands = list->num_commands;
+        res.used_bytes = list->pos;
+        res.size = list->size;
+    }
+    return res;
+}
+
 SOKOL_API_IMPL void sg_update_image(sg_image img_id, const sg_image_data* data) {
     SOKOL_ASSERT(_sg.valid);
     _sg_stats_inc(num_update_image);
@@ -27098,14 +30788,40 @@ SOKOL_API_IMPL void sg_update_image(sg_image img_id, const sg_image_data* data)
     _sg_image_t* img = _sg_lookup_image(img_id.id);
     if (img && img->slot.state == SG_RESOURCESTATE_VALID) {
         if (_sg_validate_update_image(img, data)) {
-            SOKOL_ASSERT(img->cmn.upd_frame_index != _sg.frame_index);
+            SOKOL_ASSERT(_sg_image_cold(img)->upd_frame_index != _sg.frame_index);
             _sg_update_image(img, data);
-            img->cmn.upd_frame_index = _sg.frame_index;
+            _sg_image_cold(img)->upd_frame_index = _sg.frame_index;
+            size_t num_bytes = 0;
+            for (int mip_index = 0; mip_index < SG_MAX_MIPMAPS; mip_index++) {
+                num_bytes += data->mip_levels[mip_index].size;
+            }
+            _sg_budget_add(SG_BUDGETITEM_UPLOAD_BYTES, num_bytes);
         }
     }
     _SG_TRACE_ARGS(update_image, img_id, data);
 }
 
+SOKOL_API_IMPL void sg_update_image_region(const sg_write_image_desc* desc) {
+    SOKOL_ASSERT(_sg.valid);
+    SOKOL_ASSERT(desc);
+    _sg_stats_inc(num_update_image);
+    _sg_image_t* img = _sg_lookup_image(desc->dst.image.id);
+    if (img) {
+        if (img->slot.state == SG_RESOURCESTATE_VALID) {
+            sg_write_image_desc desc_def = _sg_update_image_region_desc_defaults(img, desc);
+            if (_sg_validate_update_image_region(img, &desc_def)) {
+                const int num_bytes = desc_def.size.num_slices * _sg_surface_pitch(_sg_image_cold(img)->pixel_format, desc_def.size.width, desc_def.size.height, 1);
+                _sg_stats_add(size_update_image, (uint32_t)num_bytes);
+                _sg_update_image_region(img, &desc_def);
+                _sg_budget_add(SG_BUDGETITEM_UPLOAD_BYTES, (size_t)num_bytes);
+            }
+        }
+    } else {
+        _SG_ERROR(UPDATE_IMAGE_REGION_IMAGE_ALIVE);
+    }
+    _SG_TRACE_ARGS(update_image_region, desc);
+}
+
 SOKOL_API_IMPL void sg_write_buffer_unsealed(const sg_write_buffer_desc* desc) {
     SOKOL_ASSERT(_sg.valid);
     SOKOL_ASSERT(desc);
@@ -27115,6 +30831,7 @@ SOKOL_API_IMPL void sg_write_buffer_unsealed(const sg_write_buffer_desc* desc) {
         sg_write_buffer_desc desc_def = _sg_write_buffer_desc_defaults(desc);
         if (_sg_validate_write_buffer_unsealed(buf, &desc_def)) {
             _sg_write_buffer_unsealed(buf, &desc_def);
+            _sg_budget_add(SG_BUDGETITEM_UPLOAD_BYTES, desc_def.size);
         }
     } else {
         _SG_ERROR(WRITE_BUFFER_UNSEALED_BUFFER_ALIVE);
@@ -27131,6 +30848,8 @@ SOKOL_API_IMPL void sg_write_image_unsealed(const sg_write_image_desc* desc) {
         sg_write_image_desc desc_def = _sg_write_image_desc_defaults(img, desc);
         if (_sg_validate_write_image_unsealed(img, &desc_def)) {
             _sg_write_image_unsealed(img, &desc_def);
+            const int num_bytes = desc_def.size.num_slices * _sg_surface_pitch(_sg_image_cold(img)->pixel_format, desc_def.size.width, desc_def.size.height, 1);
+            _sg_budget_add(SG_BUDGETITEM_UPLOAD_BYTES, (size_t)num_bytes);
         }
     } else {
         _SG_ERROR(WRITE_IMAGE_UNSEALED_IMAGE_ALIVE);
@@ -27191,6 +30910,12 @@ SOKOL_API_IMPL bool sg_remove_commit_listener(sg_commit_listener listener) {
     return _sg_remove_commit_listener(&listener);
 }
 
+SOKOL_API_IMPL void sg_set_frame_budget(const sg_frame_budget* budget) {
+    SOKOL_ASSERT(_sg.valid);
+    SOKOL_ASSERT(budget);
+    _sg.budget.budget = *budget;
+}
+
 SOKOL_API_IMPL void sg_enable_stats(void) {
     SOKOL_ASSERT(_sg.valid);
     _sg.stats_enabled = true;
@@ -27213,10 +30938,11 @@ SOKOL_API_IMPL sg_buffer_info sg_query_buffer_info(sg_buffer buf_id) {
         info.slot.state = buf->slot.state;
         info.slot.res_id = buf->slot.id;
         info.slot.uninit_count = buf->slot.uninit_count;
-        info.update_frame_index = buf->cmn.update_frame_index;
-        info.append_frame_index = buf->cmn.append_frame_index;
-        info.append_pos = buf->cmn.append_pos;
-        info.append_overflow = buf->cmn.append_overflow;
+        info.update_frame_index = _sg_buffer_cold(buf)->update_frame_index;
+        info.append_frame_index = _sg_buffer_cold(buf)->append_frame_index;
+        info.append_pos = _sg_buffer_cold(buf)->append_pos;
+        info.append_overflow = _sg_buffer_cold(buf)->append_overflow;
+        info.mapped = _sg_buffer_cold(buf)->mapped;
         #if defined(SOKOL_D3D11)
         info.num_slots = 1;
         info.active_slot = 0;
@@ -27236,7 +30962,7 @@ SOKOL_API_IMPL sg_image_info sg_query_image_info(sg_image img_id) {
         info.slot.state = img->slot.state;
         info.slot.res_id = img->slot.id;
         info.slot.uninit_count = img->slot.uninit_count;
-        info.upd_frame_index = img->cmn.upd_frame_index;
+        info.upd_frame_index = _sg_image_cold(img)->upd_frame_index;
         #if defined(SOKOL_D3D11)
         info.num_slots = 1;
         info.active_slot = 0;
@@ -27302,7 +31028,7 @@ SOKOL_API_IMPL sg_buffer_desc sg_query_buffer_desc(sg_buffer buf_id) {
     const _sg_buffer_t* buf = _sg_lookup_buffer(buf_id.id);
     if (buf) {
         desc.size = (size_t)buf->cmn.size;
-        desc.usage = buf->cmn.usage;
+        desc.usage = _sg_buffer_cold(buf)->usage;
     }
     return desc;
 }
@@ -27321,7 +31047,7 @@ SOKOL_API_IMPL sg_buffer_usage sg_query_buffer_usage(sg_buffer buf_id) {
     _SG_STRUCT(sg_buffer_usage, usg);
     const _sg_buffer_t* buf = _sg_lookup_buffer(buf_id.id);
     if (buf) {
-        usg = buf->cmn.usage;
+        usg = _sg_buffer_cold(buf)->usage;
     }
     return usg;
 }
@@ -27331,14 +31057,14 @@ SOKOL_API_IMPL sg_image_desc sg_query_image_desc(sg_image img_id) {
     _SG_STRUCT(sg_image_desc, desc);
     const _sg_image_t* img = _sg_lookup_image(img_id.id);
     if (img) {
-        desc.type = img->cmn.type;
-        desc.width = img->cmn.width;
-        desc.height = img->cmn.height;
-        desc.num_slices = img->cmn.num_slices;
-        desc.num_mipmaps = img->cmn.num_mipmaps;
-        desc.usage = img->cmn.usage;
-        desc.pixel_format = img->cmn.pixel_format;
-        desc.sample_count = img->cmn.sample_count;
+        desc.type = _sg_image_cold(img)->type;
+        desc.width = _sg_image_cold(img)->width;
+        desc.height = _sg_image_cold(img)->height;
+        desc.num_slices = _sg_image_cold(img)->num_slices;
+        desc.num_mipmaps = _sg_image_cold(img)->num_mipmaps;
+        desc.usage = _sg_image_cold(img)->usage;
+        desc.pixel_format = _sg_image_cold(img)->pixel_format;
+        desc.sample_count = _sg_image_cold(img)->sample_count;
     }
     return desc;
 }
@@ -27347,7 +31073,7 @@ SOKOL_API_IMPL sg_image_type sg_query_image_type(sg_image img_id) {
     SOKOL_ASSERT(_sg.valid);
     const _sg_image_t* img = _sg_lookup_image(img_id.id);
     if (img) {
-        return img->cmn.type;
+        return _sg_image_cold(img)->type;
     }
     return _SG_IMAGETYPE_DEFAULT;
 }
@@ -27356,7 +31082,7 @@ SOKOL_API_IMPL int sg_query_image_width(sg_image img_id) {
     SOKOL_ASSERT(_sg.valid);
     const _sg_image_t* img = _sg_lookup_image(img_id.id);
     if (img) {
-        return img->cmn.width;
+        return _sg_image_cold(img)->width;
     }
     return 0;
 }
@@ -27365,7 +31091,7 @@ SOKOL_API_IMPL int sg_query_image_height(sg_image img_id) {
     SOKOL_ASSERT(_sg.valid);
     const _sg_image_t* img = _sg_lookup_image(img_id.id);
     if (img) {
-        return img->cmn.height;
+        return _sg_image_cold(img)->height;
     }
     return 0;
 }
@@ -27374,7 +31100,7 @@ SOKOL_API_IMPL int sg_query_image_num_slices(sg_image img_id) {
     SOKOL_ASSERT(_sg.valid);
     const _sg_image_t* img = _sg_lookup_image(img_id.id);
     if (img) {
-        return img->cmn.num_slices;
+        return _sg_image_cold(img)->num_slices;
     }
     return 0;
 }
@@ -27383,7 +31109,7 @@ SOKOL_API_IMPL int sg_query_image_num_mipmaps(sg_image img_id) {
     SOKOL_ASSERT(_sg.valid);
     const _sg_image_t* img = _sg_lookup_image(img_id.id);
     if (img) {
-        return img->cmn.num_mipmaps;
+        return _sg_image_cold(img)->num_mipmaps;
     }
     return 0;
 }
@@ -27392,7 +31118,7 @@ SOKOL_API_IMPL sg_pixel_format sg_query_image_pixelformat(sg_image img_id) {
     SOKOL_ASSERT(_sg.valid);
     const _sg_image_t* img = _sg_lookup_image(img_id.id);
     if (img) {
-        return img->cmn.pixel_format;
+        return _sg_image_cold(img)->pixel_format;
     }
     return _SG_PIXELFORMAT_DEFAULT;
 }
@@ -27402,7 +31128,7 @@ SOKOL_API_IMPL sg_image_usage sg_query_image_usage(sg_image img_id) {
     _SG_STRUCT(sg_image_usage, usg);
     const _sg_image_t* img = _sg_lookup_image(img_id.id);
     if (img) {
-        usg = img->cmn.usage;
+        usg = _sg_image_cold(img)->usage;
     }
     return usg;
 }
@@ -27411,7 +31137,7 @@ SOKOL_API_IMPL int sg_query_image_sample_count(sg_image img_id) {
     SOKOL_ASSERT(_sg.valid);
     const _sg_image_t* img = _sg_lookup_image(img_id.id);
     if (img) {
-        return img->cmn.sample_count;
+        return _sg_image_cold(img)->sample_count;
     }
     return 0;
 }
@@ -27559,9 +31285,9 @@ SOKOL_API_IMPL sg_view_desc sg_query_view_desc(sg_view view_id) {
             case SG_VIEWTYPE_TEXTURE:
                 desc.texture.image.id = view->cmn.img.ref.sref.id;
                 desc.texture.mip_levels.base = view->cmn.img.mip_level;
-                desc.texture.mip_levels.count = view->cmn.img.mip_level_count;
+                desc.texture.mip_levels.count = _sg_view_cold(view)->mip_level_count;
                 desc.texture.slices.base = view->cmn.img.slice;
-                desc.texture.slices.count = view->cmn.img.slice_count;
+                desc.texture.slices.count = _sg_view_cold(view)->slice_count;
                 break;
             case SG_VIEWTYPE_COLORATTACHMENT:
                 desc.color_attachment.image.id = view->cmn.img.ref.sref.id;
@@ -28083,6 +31809,19 @@ SOKOL_API_IMPL sg_gl_view_info sg_gl_query_view_info(sg_view view_id) {
     return res;
 }
 
+SOKOL_API_IMPL void sg_dummy_set_occlusion_result(sg_occlusion_query query_id, uint64_t num_samples) {
+    SOKOL_ASSERT(_sg.valid);
+    #if defined(SOKOL_DUMMY_BACKEND)
+        _sg_occlusion_query_t* query = _sg_lookup_occlusion_query(query_id.id);
+        if (query) {
+            query->dummy.num_samples = num_samples;
+        }
+    #else
+        _SOKOL_UNUSED(query_id);
+        _SOKOL_UNUSED(num_samples);
+    #endif
+}
+
 #ifdef _MSC_VER
 #pragma warning(pop)
 #endif
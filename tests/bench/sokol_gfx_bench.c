@@ -0,0 +1,194 @@
+//------------------------------------------------------------------------------
+//  sokol-gfx-bench.c
+//
+//  Measures the resource lookup overhead in sg_apply_bindings() with
+//  many bindings per frame on the dummy backend. Build in release mode
+//  for meaningful numbers.
+//
+//  Before/after comparison of the hot/cold pool split: the resource
+//  lookups done by sg_apply_bindings() are replayed once over the
+//  compact hot pools, and once over a copy of the pools with the cold
+//  state embedded into each pool entry (the layout before the split).
+//------------------------------------------------------------------------------
+#include "../functional/force_dummy_backend.h"
+#define SOKOL_IMPL
+#include "sokol_gfx.h"
+#include "sokol_time.h"
+#include <stdio.h>
+#include <stdlib.h> // calloc, free
+
+#define NUM_BINDINGS (16 * 1024)
+#define NUM_FRAMES (64)
+
+static sg_buffer vbufs[NUM_BINDINGS];
+static sg_image imgs[NUM_BINDINGS];
+static sg_view views[NUM_BINDINGS];
+
+// pool entries with embedded cold state, emulates the layout before the hot/cold split
+typedef struct { _sg_buffer_t hot; _sg_buffer_cold_t cold; } embedded_buffer_t;
+typedef struct { _sg_image_t hot; _sg_image_cold_t cold; } embedded_image_t;
+typedef struct { _sg_view_t hot; _sg_view_cold_t cold; } embedded_view_t;
+
+typedef struct {
+    const uint8_t* buffers;
+    size_t buffer_stride;
+    const uint8_t* images;
+    size_t image_stride;
+    const uint8_t* views;
+    size_t view_stride;
+} layout_t;
+
+static const void* lookup(const uint8_t* base, size_t stride, uint32_t id) {
+    return base + stride * (size_t)(id & _SG_SLOT_MASK);
+}
+
+// replays the pool lookups sg_apply_bindings() does for a vertex buffer and a texture view,
+// returns the number of resolved resources
+static uint32_t replay_lookups(const layout_t* l) {
+    uint32_t sum = 0;
+    for (int i = 0; i < NUM_BINDINGS; i++) {
+        const int idx = (i * 7919) & (NUM_BINDINGS - 1);
+        const _sg_buffer_t* buf = (const _sg_buffer_t*) lookup(l->buffers, l->buffer_stride, vbufs[idx].id);
+        if ((buf->slot.id == vbufs[idx].id) && (buf->slot.state == SG_RESOURCESTATE_VALID)) {
+            sum += 1 + (uint32_t)buf->cmn.active_slot;
+        }
+        const _sg_view_t* view = (const _sg_view_t*) lookup(l->views, l->view_stride, views[idx].id);
+        if ((view->slot.id == views[idx].id) && (view->slot.state == SG_RESOURCESTATE_VALID)) {
+            const uint32_t img_id = view->cmn.img.ref.sref.id;
+            const _sg_image_t* img = (const _sg_image_t*) lookup(l->images, l->image_stride, img_id);
+            if ((img->slot.id == img_id) && (img->slot.state == SG_RESOURCESTATE_VALID)) {
+                sum += 1 + (uint32_t)img->cmn.active_slot + (uint32_t)view->cmn.img.mip_level;
+            }
+        }
+    }
+    return sum;
+}
+
+static double best_replay_ms(const layout_t* l) {
+    double best_ms = 1.0e9;
+    for (int frame = 0; frame < NUM_FRAMES; frame++) {
+        const uint64_t start = stm_now();
+        if (replay_lookups(l) != (2 * NUM_BINDINGS)) {
+            fprintf(stderr, "lookup replay failed to resolve all resources\n");
+        }
+        const double ms = stm_ms(stm_since(start));
+        if (ms < best_ms) {
+            best_ms = ms;
+        }
+    }
+    return best_ms;
+}
+
+static void compare_layouts(void) {
+    const int num_bufs = _sg.pools.buffer_pool.size;
+    const int num_imgs = _sg.pools.image_pool.size;
+    const int num_views = _sg.pools.view_pool.size;
+    embedded_buffer_t* emb_bufs = (embedded_buffer_t*) calloc((size_t)num_bufs, sizeof(embedded_buffer_t));
+    embedded_image_t* emb_imgs = (embedded_image_t*) calloc((size_t)num_imgs, sizeof(embedded_image_t));
+    embedded_view_t* emb_views = (embedded_view_t*) calloc((size_t)num_views, sizeof(embedded_view_t));
+    for (int i = 0; i < num_bufs; i++) {
+        emb_bufs[i].hot = _sg.pools.buffers[i];
+        emb_bufs[i].cold = _sg.pools.buffers_cold[i];
+    }
+    for (int i = 0; i < num_imgs; i++) {
+        emb_imgs[i].hot = _sg.pools.images[i];
+        emb_imgs[i].cold = _sg.pools.images_cold[i];
+    }
+    for (int i = 0; i < num_views; i++) {
+        emb_views[i].hot = _sg.pools.views[i];
+        emb_views[i].cold = _sg.pools.views_cold[i];
+    }
+    const layout_t split = {
+        .buffers = (const uint8_t*) _sg.pools.buffers,
+        .buffer_stride = sizeof(_sg_buffer_t),
+        .images = (const uint8_t*) _sg.pools.images,
+        .image_stride = sizeof(_sg_image_t),
+        .views = (const uint8_t*) _sg.pools.views,
+        .view_stride = sizeof(_sg_view_t),
+    };
+    const layout_t embedded = {
+        .buffers = (const uint8_t*) emb_bufs,
+        .buffer_stride = sizeof(embedded_buffer_t),
+        .images = (const uint8_t*) emb_imgs,
+        .image_stride = sizeof(embedded_image_t),
+        .views = (const uint8_t*) emb_views,
+        .view_stride = sizeof(embedded_view_t),
+    };
+    const double embedded_ms = best_replay_ms(&embedded);
+    const double split_ms = best_replay_ms(&split);
+    printf("pool entry size, embedded -> split: buffer %d -> %d, image %d -> %d, view %d -> %d bytes\n",
+        (int)sizeof(embedded_buffer_t), (int)sizeof(_sg_buffer_t),
+        (int)sizeof(embedded_image_t), (int)sizeof(_sg_image_t),
+        (int)sizeof(embedded_view_t), (int)sizeof(_sg_view_t));
+    printf("pool lookups x %d per frame, embedded -> split: best %.3f ms -> %.3f ms (%.2fx)\n",
+        NUM_BINDINGS, embedded_ms, split_ms, embedded_ms / split_ms);
+    free(emb_views);
+    free(emb_imgs);
+    free(emb_bufs);
+}
+
+int main(void) {
+    stm_setup();
+    sg_setup(&(sg_desc){
+        .buffer_pool_size = NUM_BINDINGS,
+        .image_pool_size = NUM_BINDINGS,
+        .view_pool_size = NUM_BINDINGS,
+    });
+    static const float data[16] = { 0 };
+    for (int i = 0; i < NUM_BINDINGS; i++) {
+        vbufs[i] = sg_make_buffer(&(sg_buffer_desc){ .data = SG_RANGE(data) });
+        imgs[i] = sg_make_image(&(sg_image_desc){ .width = 4, .height = 4, .data.mip_levels[0] = SG_RANGE(data) });
+        views[i] = sg_make_view(&(sg_view_desc){ .texture.image = imgs[i] });
+        if (sg_query_view_state(views[i]) != SG_RESOURCESTATE_VALID) {
+            fprintf(stderr, "failed to create buffers, images or views\n");
+            return 10;
+        }
+    }
+    sg_pipeline pip = sg_make_pipeline(&(sg_pipeline_desc){
+        .layout.attrs[0].format = SG_VERTEXFORMAT_FLOAT3,
+        .shader = sg_make_shader(&(sg_shader_desc){
+            .views[0].texture = { .stage = SG_SHADERSTAGE_FRAGMENT },
+            .samplers[0] = { .stage = SG_SHADERSTAGE_FRAGMENT },
+            .texture_sampler_pairs[0] = { .stage = SG_SHADERSTAGE_FRAGMENT, .view_slot = 0, .sampler_slot = 0 },
+        }),
+    });
+    sg_sampler smp = sg_make_sampler(&(sg_sampler_desc){0});
+    compare_layouts();
+
+    double best_ms = 1.0e9;
+    double total_ms = 0.0;
+    for (int frame = 0; frame < NUM_FRAMES; frame++) {
+        const uint64_t start = stm_now();
+        sg_begin_pass(&(sg_pass){
+            .swapchain = {
+                .width = 256,
+                .height = 128,
+                .sample_count = 1,
+                .color_format = SG_PIXELFORMAT_RGBA8,
+                .depth_format = SG_PIXELFORMAT_DEPTH_STENCIL,
+            },
+        });
+        sg_apply_pipeline(pip);
+        for (int i = 0; i < NUM_BINDINGS; i++) {
+            // stride through the resource pools in a cache-unfriendly order
+            const int idx = (i * 7919) & (NUM_BINDINGS - 1);
+            sg_apply_bindings(&(sg_bindings){
+                .vertex_buffers[0] = vbufs[idx],
+                .views[0] = views[idx],
+                .samplers[0] = smp,
+            });
+            sg_draw(0, 3, 1);
+        }
+        sg_end_pass();
+        sg_commit();
+        const double ms = stm_ms(stm_since(start));
+        total_ms += ms;
+        if (ms < best_ms) {
+            best_ms = ms;
+        }
+    }
+    printf("sg_apply_bindings() x %d per frame, %d frames: best %.3f ms, avg %.3f ms\n",
+        NUM_BINDINGS, NUM_FRAMES, best_ms, total_ms / NUM_FRAMES);
+    sg_shutdown();
+    return 0;
+}
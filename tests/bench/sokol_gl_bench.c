@@ -0,0 +1,188 @@
+//------------------------------------------------------------------------------
+//  sokol-gl-bench.c
+//
+//  Measures vertex recording throughput in sokol_gl.h, per-vertex via
+//  sgl_v3f_t2f_c1i() and in bulk via sgl_vertices() with tightly packed
+//  and with interleaved (strided) vertex streams, with and without
+//  CPU-side transform. Wide smooth line strip tessellation is compared
+//  against writing the same number of triangle vertices directly. The
+//  sokol-gl-bench-scalar target builds the same code with SOKOL_GL_NO_SIMD
+//  to compare against the scalar fallback.
+//  Build in release mode for meaningful numbers.
+//------------------------------------------------------------------------------
+#include "../functional/force_dummy_backend.h"
+#define SOKOL_IMPL
+#include "sokol_gfx.h"
+#include "sokol_time.h"
+#include "sokol_gl.h"
+#include <stdio.h>
+
+#define NUM_VERTICES (48 * 1024)
+#define NUM_FRAMES (64)
+
+typedef enum {
+    MODE_PER_VERTEX,
+    MODE_BULK_PACKED,
+    MODE_BULK_STRIDED,
+    NUM_MODES,
+} submit_mode_t;
+
+static const char* mode_names[NUM_MODES] = {
+    "sgl_v3f_t2f_c1i()",
+    "sgl_vertices() packed",
+    "sgl_vertices() strided",
+};
+
+typedef struct {
+    float x, y, z, u, v;
+    uint32_t rgba;
+} vertex_t;
+
+static float positions[NUM_VERTICES][3];
+static float uvs[NUM_VERTICES][2];
+static uint32_t colors[NUM_VERTICES];
+static vertex_t vertices[NUM_VERTICES];
+
+typedef struct {
+    double best_ms;
+    double total_ms;
+} timing_t;
+
+static void record(sgl_context ctx, timing_t* t, submit_mode_t mode) {
+    sgl_set_context(ctx);
+    sgl_defaults();
+    sgl_matrix_mode_modelview();
+    sgl_translate(1.0f, 2.0f, 3.0f);
+    sgl_rotate(0.5f, 0.0f, 1.0f, 0.0f);
+    sgl_scale(2.0f, 2.0f, 2.0f);
+    const uint64_t start = stm_now();
+    sgl_begin_triangles();
+    switch (mode) {
+        case MODE_PER_VERTEX:
+            for (int i = 0; i < NUM_VERTICES; i++) {
+                sgl_v3f_t2f_c1i(positions[i][0], positions[i][1], positions[i][2], uvs[i][0], uvs[i][1], colors[i]);
+            }
+            break;
+        case MODE_BULK_PACKED:
+            sgl_vertices(&(sgl_vertex_desc_t){
+                .pos.ptr = positions,
+                .uv.ptr = uvs,
+                .color.ptr = colors,
+            }, NUM_VERTICES);
+            break;
+        default:
+            sgl_vertices(&(sgl_vertex_desc_t){
+                .pos = { .ptr = &vertices[0].x, .stride = sizeof(vertex_t) },
+                .uv = { .ptr = &vertices[0].u, .stride = sizeof(vertex_t) },
+                .color = { .ptr = &vertices[0].rgba, .stride = sizeof(vertex_t) },
+            }, NUM_VERTICES);
+            break;
+    }
+    sgl_end();
+    const double ms = stm_ms(stm_since(start));
+    t->total_ms += ms;
+    if (ms < t->best_ms) {
+        t->best_ms = ms;
+    }
+}
+
+#define NUM_LINE_POINTS (2 * 1024)
+
+// returns the number of vertices written
+static int record_line_strip(timing_t* t) {
+    sgl_defaults();
+    sgl_line_width(4.0f);
+    sgl_enable_line_smooth();
+    const uint64_t start = stm_now();
+    sgl_begin_line_strip();
+    for (int i = 0; i < NUM_LINE_POINTS; i++) {
+        sgl_v2f((float)i * 3.0f, (float)((i * 37) % 11) * 5.0f);
+    }
+    sgl_end();
+    const double ms = stm_ms(stm_since(start));
+    t->total_ms += ms;
+    if (ms < t->best_ms) {
+        t->best_ms = ms;
+    }
+    return sgl_num_vertices();
+}
+
+static void record_triangles(timing_t* t, int num_vertices) {
+    sgl_defaults();
+    const uint64_t start = stm_now();
+    sgl_begin_triangles();
+    for (int i = 0; i < num_vertices; i++) {
+        sgl_v2f(positions[i][0], positions[i][1]);
+    }
+    sgl_end();
+    const double ms = stm_ms(stm_since(start));
+    t->total_ms += ms;
+    if (ms < t->best_ms) {
+        t->best_ms = ms;
+    }
+}
+
+int main(void) {
+    stm_setup();
+    sg_setup(&(sg_desc){0});
+    sgl_setup(&(sgl_desc_t){ .max_vertices = NUM_VERTICES });
+    sgl_context contexts[2] = {
+        sgl_default_context(),
+        sgl_make_context(&(sgl_context_desc_t){ .max_vertices = NUM_VERTICES, .cpu_transform = true }),
+    };
+    for (int i = 0; i < NUM_VERTICES; i++) {
+        positions[i][0] = (float)(i & 255);
+        positions[i][1] = (float)(i >> 8);
+        positions[i][2] = (float)(i & 15) * 0.25f;
+        uvs[i][0] = positions[i][0] / 256.0f;
+        uvs[i][1] = positions[i][1] / 256.0f;
+        colors[i] = 0xFF000000 | (uint32_t)i;
+        vertices[i] = (vertex_t){ positions[i][0], positions[i][1], positions[i][2], uvs[i][0], uvs[i][1], colors[i] };
+    }
+    timing_t timings[2][NUM_MODES];
+    for (int c = 0; c < 2; c++) {
+        for (int m = 0; m < NUM_MODES; m++) {
+            timings[c][m] = (timing_t){ 1.0e9, 0.0 };
+        }
+    }
+    for (int frame = 0; frame < NUM_FRAMES; frame++) {
+        for (int c = 0; c < 2; c++) {
+            for (int m = 0; m < NUM_MODES; m++) {
+                record(contexts[c], &timings[c][m], (submit_mode_t)m);
+                // rewinds the sokol-gl contexts
+                sg_commit();
+            }
+        }
+    }
+    #if defined(SOKOL_GL_NO_SIMD)
+    printf("SOKOL_GL_NO_SIMD, %d vertices, %d frames:\n", NUM_VERTICES, NUM_FRAMES);
+    #else
+    printf("SIMD (if supported by target), %d vertices, %d frames:\n", NUM_VERTICES, NUM_FRAMES);
+    #endif
+    for (int c = 0; c < 2; c++) {
+        for (int m = 0; m < NUM_MODES; m++) {
+            printf("  %-24s %-16s best %.3f ms, avg %.3f ms\n",
+                mode_names[m], (c == 0) ? "" : "cpu_transform", timings[c][m].best_ms, timings[c][m].total_ms / NUM_FRAMES);
+        }
+    }
+    timing_t line_strip = { 1.0e9, 0.0 };
+    timing_t triangles = { 1.0e9, 0.0 };
+    int num_line_vertices = 0;
+    sgl_set_context(contexts[0]);
+    for (int frame = 0; frame < NUM_FRAMES; frame++) {
+        num_line_vertices = record_line_strip(&line_strip);
+        sg_commit();
+        record_triangles(&triangles, num_line_vertices);
+        sg_commit();
+    }
+    printf("  %-41s best %.3f ms, avg %.3f ms\n", "smooth line strip", line_strip.best_ms, line_strip.total_ms / NUM_FRAMES);
+    printf("  %-41s best %.3f ms, avg %.3f ms\n", "sgl_v2f() same number of vertices", triangles.best_ms, triangles.total_ms / NUM_FRAMES);
+    printf("  (%d line points, %d vertices)\n", NUM_LINE_POINTS, num_line_vertices);
+    if (sgl_error().any || sgl_context_error(contexts[1]).any) {
+        fprintf(stderr, "sokol-gl error during recording\n");
+        return 10;
+    }
+    sgl_shutdown();
+    sg_shutdown();
+    return 0;
+}
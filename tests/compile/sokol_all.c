@@ -8,12 +8,18 @@
 #include "sokol_time.h"
 #include "sokol_glue.h"
 // util
+#include "sokol_atlas.h"
 #include "sokol_color.h"
 #include "sokol_debugtext.h"
 #include "sokol_gl.h"
+#include "sokol_instancing.h"
 #include "sokol_letterbox.h"
 #include "sokol_memtrack.h"
+#include "sokol_occlusion.h"
+#include "sokol_rendergraph.h"
 #include "sokol_shape.h"
+#include "sokol_sprite.h"
+#include "sokol_vertexpack.h"
 
 #if defined(_MSC_VER )
 #pragma warning(disable:4201) // nonstandard extension used: nameless struct/union
@@ -0,0 +1,7 @@
+#include "sokol_gfx.h"
+#define SOKOL_IMPL
+#include "sokol_atlas.h"
+
+void use_atlas_impl(void) {
+    satlas_setup(&(satlas_desc){0});
+}
@@ -0,0 +1,7 @@
+#include "sokol_gfx.h"
+#define SOKOL_IMPL
+#include "sokol_instancing.h"
+
+void use_instancing_impl(void) {
+    sinst_setup(&(sinst_desc){0});
+}
@@ -0,0 +1,7 @@
+#include "sokol_gfx.h"
+#define SOKOL_IMPL
+#include "sokol_occlusion.h"
+
+void use_occlusion_impl() {
+    socc_setup({});
+}
@@ -0,0 +1,7 @@
+#include "sokol_gfx.h"
+#define SOKOL_IMPL
+#include "sokol_sprite.h"
+
+void use_sprite_impl(void) {
+    ssprite_setup(&(ssprite_desc){0});
+}
@@ -0,0 +1,7 @@
+#include "sokol_gfx.h"
+#define SOKOL_IMPL
+#include "sokol_vertexpack.h"
+
+void use_vertexpack_impl(void) {
+    svpack_pack(&(svpack_desc){0});
+}
@@ -0,0 +1,373 @@
+//------------------------------------------------------------------------------
+//  sokol-atlas-test.c
+//------------------------------------------------------------------------------
+#include "sokol_gfx.h"
+#define SOKOL_ATLAS_IMPL
+#include "sokol_atlas.h"
+#include "utest.h"
+
+#define T(b) EXPECT_TRUE(b)
+
+#define MAX_LOG_ITEMS (8)
+static int num_log_called;
+static satlas_log_item log_items[MAX_LOG_ITEMS];
+
+static void test_logger(const char* tag, uint32_t log_level, uint32_t log_item_id, const char* message_or_null, uint32_t line_nr, const char* filename_or_null, void* user_data) {
+    (void)tag; (void)log_level; (void)message_or_null; (void)line_nr; (void)filename_or_null; (void)user_data;
+    if (num_log_called < MAX_LOG_ITEMS) {
+        log_items[num_log_called] = (satlas_log_item)log_item_id;
+    }
+    num_log_called++;
+}
+
+static void reset_log_items(void) {
+    num_log_called = 0;
+    for (int i = 0; i < MAX_LOG_ITEMS; i++) {
+        log_items[i] = SATLAS_LOGITEM_OK;
+    }
+}
+
+static void init_with_desc(const satlas_desc* desc) {
+    reset_log_items();
+    sg_setup(&(sg_desc){0});
+    satlas_desc d = *desc;
+    d.logger.func = test_logger;
+    satlas_setup(&d);
+}
+
+static void init(void) {
+    init_with_desc(&(satlas_desc){0});
+}
+
+static void shutdown(void) {
+    satlas_shutdown();
+    sg_shutdown();
+}
+
+static void frame(void) {
+    satlas_flush();
+    sg_commit();
+}
+
+static bool overlaps(satlas_region_info a, satlas_region_info b) {
+    return (a.slice == b.slice)
+        && (a.x < (b.x + b.width)) && (b.x < (a.x + a.width))
+        && (a.y < (b.y + b.height)) && (b.y < (a.y + a.height));
+}
+
+UTEST(sokol_atlas, default_init_shutdown) {
+    init();
+    T(_satlas.init_tag == _SATLAS_INIT_TAG);
+    T(_satlas.desc.max_atlases == 8);
+    T(_satlas.desc.max_regions == 4096);
+    T(_satlas.atlas_pool.size == 9);
+    T(_satlas.region_pool.size == 4097);
+    shutdown();
+    T(_satlas.init_tag == 0);
+}
+
+UTEST(sokol_atlas, make_atlas) {
+    init();
+    satlas_atlas atlas = satlas_make_atlas(&(satlas_atlas_desc){0});
+    T(atlas.id != SATLAS_INVALID_ID);
+    const sg_image img = satlas_query_image(atlas);
+    T(sg_query_image_state(img) == SG_RESOURCESTATE_VALID);
+    T(sg_query_image_type(img) == SG_IMAGETYPE_2D);
+    T(sg_query_image_width(img) == 1024);
+    T(sg_query_image_height(img) == 1024);
+    T(sg_query_image_pixelformat(img) == SG_PIXELFORMAT_RGBA8);
+    T(sg_query_image_usage(img).region_update);
+    T(sg_query_view_state(satlas_query_view(atlas)) == SG_RESOURCESTATE_VALID);
+    const satlas_atlas_info info = satlas_query_atlas_info(atlas);
+    T(info.valid);
+    T(info.num_regions == 0);
+    T(info.num_shelves == 0);
+    satlas_destroy_atlas(atlas);
+    T(sg_query_image_state(img) == SG_RESOURCESTATE_INVALID);
+    T(!satlas_query_atlas_info(atlas).valid);
+    T(num_log_called == 0);
+    shutdown();
+}
+
+UTEST(sokol_atlas, make_array_atlas) {
+    init();
+    satlas_atlas atlas = satlas_make_atlas(&(satlas_atlas_desc){ .width = 64, .height = 64, .num_slices = 2 });
+    const sg_image img = satlas_query_image(atlas);
+    T(sg_query_image_type(img) == SG_IMAGETYPE_ARRAY);
+    T(sg_query_image_num_slices(img) == 2);
+    // a full-size region per slice
+    satlas_region r0 = satlas_alloc(atlas, 64, 64);
+    satlas_region r1 = satlas_alloc(atlas, 64, 64);
+    T(satlas_query_region_info(r0).slice == 0);
+    T(satlas_query_region_info(r1).slice == 1);
+    reset_log_items();
+    T(satlas_alloc(atlas, 1, 1).id == SATLAS_INVALID_ID);
+    T(log_items[0] == SATLAS_LOGITEM_ATLAS_FULL);
+    shutdown();
+}
+
+UTEST(sokol_atlas, invalid_pixel_format) {
+    init();
+    satlas_atlas atlas = satlas_make_atlas(&(satlas_atlas_desc){ .pixel_format = SG_PIXELFORMAT_DEPTH });
+    T(atlas.id == SATLAS_INVALID_ID);
+    T(log_items[0] == SATLAS_LOGITEM_INVALID_PIXEL_FORMAT);
+    shutdown();
+}
+
+UTEST(sokol_atlas, atlas_pool_exhausted) {
+    init_with_desc(&(satlas_desc){ .max_atlases = 1 });
+    T(satlas_make_atlas(&(satlas_atlas_desc){ .width = 16, .height = 16 }).id != SATLAS_INVALID_ID);
+    T(satlas_make_atlas(&(satlas_atlas_desc){ .width = 16, .height = 16 }).id == SATLAS_INVALID_ID);
+    T(log_items[0] == SATLAS_LOGITEM_ATLAS_POOL_EXHAUSTED);
+    shutdown();
+}
+
+UTEST(sokol_atlas, alloc_shelves) {
+    init();
+    satlas_atlas atlas = satlas_make_atlas(&(satlas_atlas_desc){ .width = 64, .height = 64 });
+    satlas_region r0 = satlas_alloc(atlas, 16, 16);
+    satlas_region r1 = satlas_alloc(atlas, 16, 16);
+    satlas_region r2 = satlas_alloc(atlas, 16, 8);
+    satlas_region r3 = satlas_alloc(atlas, 16, 32);
+    const satlas_region_info i0 = satlas_query_region_info(r0);
+    const satlas_region_info i1 = satlas_query_region_info(r1);
+    const satlas_region_info i2 = satlas_query_region_info(r2);
+    const satlas_region_info i3 = satlas_query_region_info(r3);
+    T(i0.valid && (i0.x == 0) && (i0.y == 0) && (i0.width == 16) && (i0.height == 16));
+    T(i1.valid && (i1.x == 16) && (i1.y == 0));
+    // half the shelf height is still a good enough fit
+    T(i2.valid && (i2.x == 32) && (i2.y == 0));
+    // doesn't fit on the first shelf, opens a new shelf
+    T(i3.valid && (i3.x == 0) && (i3.y == 16));
+    T(i0.u0 == 0.0f && i0.v0 == 0.0f && i0.u1 == 0.25f && i0.v1 == 0.25f);
+    T(i0.image.id == satlas_query_image(atlas).id);
+    T(i0.view.id == satlas_query_view(atlas).id);
+    const satlas_atlas_info info = satlas_query_atlas_info(atlas);
+    T(info.num_regions == 4);
+    T(info.num_shelves == 2);
+    T(info.num_used_pixels == (3 * 16 * 16 + 16 * 32));
+    T(num_log_called == 0);
+    shutdown();
+}
+
+UTEST(sokol_atlas, small_region_opens_new_shelf) {
+    init();
+    satlas_atlas atlas = satlas_make_atlas(&(satlas_atlas_desc){ .width = 64, .height = 64 });
+    satlas_alloc(atlas, 8, 32);
+    // much smaller than the existing shelf, and there's room for a new one
+    satlas_region r = satlas_alloc(atlas, 8, 8);
+    T(satlas_query_region_info(r).y == 32);
+    T(satlas_query_atlas_info(atlas).num_shelves == 2);
+    shutdown();
+}
+
+UTEST(sokol_atlas, padding) {
+    init();
+    satlas_atlas atlas = satlas_make_atlas(&(satlas_atlas_desc){ .width = 32, .height = 32, .padding = 2 });
+    satlas_region r0 = satlas_alloc(atlas, 8, 8);
+    satlas_region r1 = satlas_alloc(atlas, 8, 8);
+    satlas_region r2 = satlas_alloc(atlas, 8, 8);
+    // padding isn't needed at the right border
+    satlas_region r3 = satlas_alloc(atlas, 2, 8);
+    T(satlas_query_region_info(r0).x == 0);
+    T(satlas_query_region_info(r1).x == 10);
+    T(satlas_query_region_info(r2).x == 20);
+    T(satlas_query_region_info(r3).x == 30);
+    T(satlas_query_region_info(r3).y == 0);
+    satlas_region r4 = satlas_alloc(atlas, 8, 8);
+    T(satlas_query_region_info(r4).y == 10);
+    shutdown();
+}
+
+UTEST(sokol_atlas, regions_dont_overlap) {
+    init();
+    satlas_atlas atlas = satlas_make_atlas(&(satlas_atlas_desc){ .width = 128, .height = 128, .padding = 1 });
+    satlas_region regs[64];
+    int num_regs = 0;
+    for (int i = 0; i < 64; i++) {
+        satlas_region r = satlas_alloc(atlas, 3 + (i * 7) % 13, 2 + (i * 5) % 11);
+        if (r.id != SATLAS_INVALID_ID) {
+            regs[num_regs++] = r;
+        }
+    }
+    T(num_regs == 64);
+    for (int i = 0; i < num_regs; i++) {
+        const satlas_region_info a = satlas_query_region_info(regs[i]);
+        T((a.x + a.width) <= 128);
+        T((a.y + a.height) <= 128);
+        for (int j = i + 1; j < num_regs; j++) {
+            T(!overlaps(a, satlas_query_region_info(regs[j])));
+        }
+    }
+    shutdown();
+}
+
+UTEST(sokol_atlas, alloc_validate) {
+    init();
+    satlas_atlas atlas = satlas_make_atlas(&(satlas_atlas_desc){ .width = 32, .height = 32 });
+    T(satlas_alloc(atlas, 0, 8).id == SATLAS_INVALID_ID);
+    T(log_items[0] == SATLAS_LOGITEM_ALLOC_INVALID_SIZE);
+    reset_log_items();
+    T(satlas_alloc(atlas, 8, 33).id == SATLAS_INVALID_ID);
+    T(log_items[0] == SATLAS_LOGITEM_ALLOC_INVALID_SIZE);
+    reset_log_items();
+    T(satlas_alloc((satlas_atlas){ 0x12345 }, 8, 8).id == SATLAS_INVALID_ID);
+    T(log_items[0] == SATLAS_LOGITEM_ALLOC_INVALID_ATLAS);
+    shutdown();
+}
+
+UTEST(sokol_atlas, region_pool_exhausted) {
+    init_with_desc(&(satlas_desc){ .max_regions = 2 });
+    satlas_atlas atlas = satlas_make_atlas(&(satlas_atlas_desc){ .width = 32, .height = 32 });
+    satlas_alloc(atlas, 8, 8);
+    satlas_alloc(atlas, 8, 8);
+    T(satlas_alloc(atlas, 8, 16).id == SATLAS_INVALID_ID);
+    T(log_items[0] == SATLAS_LOGITEM_REGION_POOL_EXHAUSTED);
+    // the shelf opened for the failed allocation has been released
+    T(satlas_query_atlas_info(atlas).num_shelves == 1);
+    shutdown();
+}
+
+UTEST(sokol_atlas, free_is_deferred) {
+    init();
+    satlas_atlas atlas = satlas_make_atlas(&(satlas_atlas_desc){ .width = 32, .height = 32 });
+    satlas_region r0 = satlas_alloc(atlas, 32, 32);
+    satlas_free(r0);
+    T(!satlas_query_region_info(r0).valid);
+    // the space must not be reused while in-flight frames may still sample it
+    for (int i = 0; i < SG_NUM_INFLIGHT_FRAMES; i++) {
+        frame();
+        T(satlas_query_atlas_info(atlas).num_regions == 1);
+        T(satlas_query_stats().num_retired == 0);
+    }
+    frame();
+    T(satlas_query_stats().num_retired == 1);
+    const satlas_atlas_info info = satlas_query_atlas_info(atlas);
+    T(info.num_regions == 0);
+    T(info.num_shelves == 0);
+    T(info.num_used_pixels == 0);
+    satlas_region r1 = satlas_alloc(atlas, 32, 32);
+    T(satlas_query_region_info(r1).valid);
+    // a stale handle doesn't resolve to the new region
+    T(!satlas_query_region_info(r0).valid);
+    T(_satlas.num_retired == 0);
+    shutdown();
+}
+
+UTEST(sokol_atlas, freed_space_reused_on_shelf) {
+    init();
+    satlas_atlas atlas = satlas_make_atlas(&(satlas_atlas_desc){ .width = 32, .height = 32 });
+    satlas_region r0 = satlas_alloc(atlas, 16, 16);
+    satlas_alloc(atlas, 16, 16);
+    satlas_alloc(atlas, 32, 16);
+    satlas_free(r0);
+    for (int i = 0; i <= SG_NUM_INFLIGHT_FRAMES; i++) {
+        frame();
+    }
+    satlas_region r3 = satlas_alloc(atlas, 12, 12);
+    const satlas_region_info info = satlas_query_region_info(r3);
+    T(info.valid && (info.x == 0) && (info.y == 0));
+    T(satlas_query_atlas_info(atlas).num_shelves == 2);
+    shutdown();
+}
+
+UTEST(sokol_atlas, empty_top_shelves_released) {
+    init();
+    satlas_atlas atlas = satlas_make_atlas(&(satlas_atlas_desc){ .width = 32, .height = 32 });
+    satlas_alloc(atlas, 32, 8);
+    satlas_region r1 = satlas_alloc(atlas, 32, 8);
+    satlas_region r2 = satlas_alloc(atlas, 32, 16);
+    T(satlas_query_atlas_info(atlas).num_shelves == 3);
+    satlas_free(r1);
+    satlas_free(r2);
+    for (int i = 0; i <= SG_NUM_INFLIGHT_FRAMES; i++) {
+        frame();
+    }
+    T(satlas_query_atlas_info(atlas).num_shelves == 1);
+    // the released space can be used for a shelf with different height
+    satlas_region r3 = satlas_alloc(atlas, 32, 24);
+    T(satlas_query_region_info(r3).y == 8);
+    shutdown();
+}
+
+UTEST(sokol_atlas, write_and_flush) {
+    init();
+    satlas_atlas atlas = satlas_make_atlas(&(satlas_atlas_desc){ .width = 64, .height = 64, .padding = 1 });
+    satlas_region r0 = satlas_alloc(atlas, 4, 4);
+    satlas_region r1 = satlas_alloc(atlas, 4, 4);
+    uint32_t pixels[4 * 4];
+    for (int i = 0; i < 16; i++) {
+        pixels[i] = 0xFF000000 | (uint32_t)i;
+    }
+    satlas_write(r0, &SG_RANGE(pixels));
+    satlas_write(r1, &SG_RANGE(pixels));
+    // the two neighbouring writes are merged into a single upload
+    T(satlas_query_atlas_info(atlas).num_dirty_rects == 1);
+    const uint32_t* shadow = (const uint32_t*)_satlas.atlases[_satlas_slot_index(atlas.id)].pixels;
+    T(shadow[0] == 0xFF000000);
+    T(shadow[3] == 0xFF000003);
+    T(shadow[4] == 0);
+    T(shadow[5] == 0xFF000000);
+    T(shadow[64 + 1] == 0xFF000005);
+    frame();
+    const satlas_stats stats = satlas_query_stats();
+    T(stats.num_uploads == 1);
+    T(stats.num_upload_bytes == (10 * 5 * 4));
+    T(sg_query_stats().prev_frame.num_update_image == 1);
+    T(satlas_query_atlas_info(atlas).num_dirty_rects == 0);
+    // nothing to upload in the next frame
+    frame();
+    T(satlas_query_stats().num_uploads == 0);
+    T(num_log_called == 0);
+    shutdown();
+}
+
+UTEST(sokol_atlas, write_separate_rects) {
+    init();
+    satlas_atlas atlas = satlas_make_atlas(&(satlas_atlas_desc){ .width = 64, .height = 64, .num_slices = 2 });
+    satlas_region r0 = satlas_alloc(atlas, 64, 64);
+    satlas_region r1 = satlas_alloc(atlas, 4, 4);
+    const uint32_t small[4 * 4] = { 0 };
+    static uint32_t big[64 * 64];
+    satlas_write(r0, &SG_RANGE(big));
+    satlas_write(r1, &SG_RANGE(small));
+    T(satlas_query_atlas_info(atlas).num_dirty_rects == 2);
+    frame();
+    T(satlas_query_stats().num_uploads == 2);
+    T(satlas_query_stats().num_upload_bytes == ((64 * 64 + 4 * 4) * 4));
+    T(num_log_called == 0);
+    shutdown();
+}
+
+UTEST(sokol_atlas, write_validate) {
+    init();
+    satlas_atlas atlas = satlas_make_atlas(&(satlas_atlas_desc){ .width = 32, .height = 32 });
+    satlas_region r = satlas_alloc(atlas, 4, 4);
+    const uint32_t pixels[4 * 3] = { 0 };
+    satlas_write(r, &SG_RANGE(pixels));
+    T(log_items[0] == SATLAS_LOGITEM_WRITE_INVALID_DATA_SIZE);
+    reset_log_items();
+    satlas_free(r);
+    satlas_write(r, &SG_RANGE(pixels));
+    T(log_items[0] == SATLAS_LOGITEM_WRITE_INVALID_REGION);
+    T(satlas_query_atlas_info(atlas).num_dirty_rects == 0);
+    shutdown();
+}
+
+UTEST(sokol_atlas, destroy_atlas_frees_regions) {
+    init_with_desc(&(satlas_desc){ .max_regions = 4 });
+    satlas_atlas atlas0 = satlas_make_atlas(&(satlas_atlas_desc){ .width = 32, .height = 32 });
+    satlas_region r0 = satlas_alloc(atlas0, 8, 8);
+    satlas_region r1 = satlas_alloc(atlas0, 8, 8);
+    satlas_free(r1);
+    satlas_destroy_atlas(atlas0);
+    T(!satlas_query_region_info(r0).valid);
+    T(_satlas.num_retired == 0);
+    T(_satlas.region_pool.queue_top == 4);
+    satlas_atlas atlas1 = satlas_make_atlas(&(satlas_atlas_desc){ .width = 32, .height = 32 });
+    for (int i = 0; i < 4; i++) {
+        T(satlas_alloc(atlas1, 8, 8).id != SATLAS_INVALID_ID);
+    }
+    T(num_log_called == 0);
+    shutdown();
+}
@@ -337,13 +337,14 @@ UTEST(sokol_gfx, make_destroy_buffers) {
         T(bufptr);
         T(bufptr->slot.id == buf[i].id);
         T(bufptr->slot.state == SG_RESOURCESTATE_VALID);
+        const _sg_buffer_cold_t* bufcold = _sg_buffer_cold(bufptr);
         T(bufptr->cmn.size == sizeof(data));
-        T(bufptr->cmn.append_pos == 0);
-        T(!bufptr->cmn.append_overflow);
-        T(bufptr->cmn.usage.vertex_buffer);
-        T(bufptr->cmn.usage.immutable);
-        T(bufptr->cmn.update_frame_index == 0);
-        T(bufptr->cmn.append_frame_index == 0);
+        T(bufcold->append_pos == 0);
+        T(!bufcold->append_overflow);
+        T(bufcold->usage.vertex_buffer);
+        T(bufcold->usage.immutable);
+        T(bufcold->update_frame_index == 0);
+        T(bufcold->append_frame_index == 0);
         T(bufptr->cmn.num_slots == 1);
         T(bufptr->cmn.active_slot == 0);
     }
@@ -381,16 +382,17 @@ UTEST(sokol_gfx, make_destroy_images) {
         T(imgptr);
         T(imgptr->slot.id == img[i].id);
         T(imgptr->slot.state == SG_RESOURCESTATE_VALID);
-        T(imgptr->cmn.type == SG_IMAGETYPE_2D);
-        T(!imgptr->cmn.usage.color_attachment);
-        T(imgptr->cmn.width == 8);
-        T(imgptr->cmn.height == 8);
-        T(imgptr->cmn.num_slices == 1);
-        T(imgptr->cmn.num_mipmaps == 1);
-        T(imgptr->cmn.usage.immutable);
-        T(imgptr->cmn.pixel_format == SG_PIXELFORMAT_RGBA8);
-        T(imgptr->cmn.sample_count == 1);
-        T(imgptr->cmn.upd_frame_index == 0);
+        const _sg_image_cold_t* imgcold = _sg_image_cold(imgptr);
+        T(imgcold->type == SG_IMAGETYPE_2D);
+        T(!imgcold->usage.color_attachment);
+        T(imgcold->width == 8);
+        T(imgcold->height == 8);
+        T(imgcold->num_slices == 1);
+        T(imgcold->num_mipmaps == 1);
+        T(imgcold->usage.immutable);
+        T(imgcold->pixel_format == SG_PIXELFORMAT_RGBA8);
+        T(imgcold->sample_count == 1);
+        T(imgcold->upd_frame_index == 0);
         T(imgptr->cmn.num_slots == 1);
         T(imgptr->cmn.active_slot == 0);
     }
@@ -561,6 +563,122 @@ UTEST(sokol_gfx, make_destroy_views) {
     sg_shutdown();
 }
 
+UTEST(sokol_gfx, alloc_buffers_batch) {
+    setup(&(sg_desc){
+        .buffer_pool_size = 4
+    });
+    sg_buffer bufs[3] = { {0} };
+    T(sg_alloc_buffers(3, bufs));
+    T(_sg.pools.buffer_pool.queue_top == 1);
+    for (int i = 0; i < 3; i++) {
+        T(sg_query_buffer_state(bufs[i]) == SG_RESOURCESTATE_ALLOC);
+    }
+    float data[] = { 1.0f, 2.0f, 3.0f, 4.0f };
+    sg_init_buffer(bufs[0], &(sg_buffer_desc){ .data = SG_RANGE(data) });
+    sg_init_buffer(bufs[1], &(sg_buffer_desc){ .size = 64, .usage.stream_update = true });
+    sg_init_buffer(bufs[2], &(sg_buffer_desc){ .size = 0 });  // invalid
+    T(sg_query_buffer_state(bufs[0]) == SG_RESOURCESTATE_VALID);
+    T(sg_query_buffer_state(bufs[1]) == SG_RESOURCESTATE_VALID);
+    T(sg_query_buffer_state(bufs[2]) == SG_RESOURCESTATE_FAILED);
+    T(sg_query_buffer_size(bufs[0]) == sizeof(data));
+    // not enough free pool slots for the entire batch, nothing is reserved
+    reset_log_items();
+    sg_buffer more_bufs[2] = { {0} };
+    T(!sg_alloc_buffers(2, more_bufs));
+    T(log_items[0] == SG_LOGITEM_BUFFER_POOL_EXHAUSTED);
+    T(more_bufs[0].id == SG_INVALID_ID);
+    T(more_bufs[1].id == SG_INVALID_ID);
+    T(_sg.pools.buffer_pool.queue_top == 1);
+    sg_shutdown();
+}
+
+UTEST(sokol_gfx, alloc_images_views_batch) {
+    setup(&(sg_desc){
+        .image_pool_size = 2,
+        .view_pool_size = 4,
+    });
+    sg_image imgs[2] = { {0} };
+    T(sg_alloc_images(2, imgs));
+    T(_sg.pools.image_pool.queue_top == 0);
+    sg_init_image(imgs[0], &(sg_image_desc){ .usage.color_attachment = true, .width = 64, .height = 64 });
+    sg_init_image(imgs[1], &(sg_image_desc){ .usage.depth_stencil_attachment = true, .width = 64, .height = 64, .pixel_format = SG_PIXELFORMAT_DEPTH });
+    T(sg_query_image_pixelformat(imgs[1]) == SG_PIXELFORMAT_DEPTH);
+    sg_view views[3] = { {0} };
+    T(sg_alloc_views(3, views));
+    sg_init_view(views[0], &(sg_view_desc){ .color_attachment.image = imgs[0] });
+    sg_init_view(views[1], &(sg_view_desc){ .texture.image = imgs[0] });
+    sg_init_view(views[2], &(sg_view_desc){ .depth_stencil_attachment.image = imgs[1] });
+    T(sg_query_view_type(views[0]) == SG_VIEWTYPE_COLORATTACHMENT);
+    T(sg_query_view_type(views[1]) == SG_VIEWTYPE_TEXTURE);
+    T(sg_query_view_type(views[2]) == SG_VIEWTYPE_DEPTHSTENCILATTACHMENT);
+    sg_image more_imgs[1] = { {0} };
+    T(!sg_alloc_images(1, more_imgs));
+    T(log_items[0] == SG_LOGITEM_IMAGE_POOL_EXHAUSTED);
+    sg_view more_views[2] = { {0} };
+    T(!sg_alloc_views(2, more_views));
+    T(log_items[1] == SG_LOGITEM_VIEW_POOL_EXHAUSTED);
+    T(more_views[0].id == SG_INVALID_ID);
+    T(_sg.pools.view_pool.queue_top == 1);
+    // empty batches are allowed
+    T(sg_alloc_views(0, more_views));
+    sg_shutdown();
+}
+
+UTEST(sokol_gfx, apply_bindings_many) {
+    #define NUM_BINDINGS (8)
+    setup(&(sg_desc){
+        .buffer_pool_size = NUM_BINDINGS,
+        .image_pool_size = NUM_BINDINGS,
+        .view_pool_size = NUM_BINDINGS,
+    });
+    sg_buffer vbufs[NUM_BINDINGS];
+    sg_image imgs[NUM_BINDINGS];
+    sg_view views[NUM_BINDINGS];
+    static const float data[16] = { 0 };
+    for (int i = 0; i < NUM_BINDINGS; i++) {
+        vbufs[i] = sg_make_buffer(&(sg_buffer_desc){ .data = SG_RANGE(data) });
+        imgs[i] = sg_make_image(&(sg_image_desc){ .width = 4, .height = 4, .data.mip_levels[0] = SG_RANGE(data) });
+        views[i] = sg_make_view(&(sg_view_desc){ .texture.image = imgs[i] });
+        T(sg_query_view_state(views[i]) == SG_RESOURCESTATE_VALID);
+    }
+    sg_pipeline pip = sg_make_pipeline(&(sg_pipeline_desc){
+        .layout.attrs[0].format = SG_VERTEXFORMAT_FLOAT3,
+        .shader = sg_make_shader(&(sg_shader_desc){
+            .views[0].texture = { .stage = SG_SHADERSTAGE_FRAGMENT },
+            .samplers[0] = { .stage = SG_SHADERSTAGE_FRAGMENT },
+            .texture_sampler_pairs[0] = { .stage = SG_SHADERSTAGE_FRAGMENT, .view_slot = 0, .sampler_slot = 0 },
+        }),
+    });
+    sg_sampler smp = sg_make_sampler(&(sg_sampler_desc){0});
+    sg_begin_pass(&(sg_pass){
+        .swapchain = {
+            .width = 256,
+            .height = 128,
+            .sample_count = 1,
+            .color_format = SG_PIXELFORMAT_RGBA8,
+            .depth_format = SG_PIXELFORMAT_DEPTH_STENCIL,
+        },
+    });
+    sg_apply_pipeline(pip);
+    for (int i = 0; i < NUM_BINDINGS; i++) {
+        // bind the resources out of pool order
+        const int idx = (i * 3) & (NUM_BINDINGS - 1);
+        sg_apply_bindings(&(sg_bindings){
+            .vertex_buffers[0] = vbufs[idx],
+            .views[0] = views[idx],
+            .samplers[0] = smp,
+        });
+        T(_sg.next_draw_valid);
+        sg_draw(0, 3, 1);
+    }
+    sg_end_pass();
+    sg_commit();
+    T(sg_query_stats().prev_frame.num_apply_bindings == NUM_BINDINGS);
+    T(num_log_called == 0);
+    sg_shutdown();
+    #undef NUM_BINDINGS
+}
+
 UTEST(sokol_gfx, generation_counter) {
     setup(&(sg_desc){
         .buffer_pool_size = 1,
@@ -1410,6 +1528,135 @@ UTEST(sokol_gfx, query_buffer_will_overflow) {
     sg_shutdown();
 }
 
+UTEST(sokol_gfx, map_buffer) {
+    setup(&(sg_desc){0});
+    sg_buffer buf = sg_make_buffer(&(sg_buffer_desc){
+        .size = 64,
+        .usage.stream_update = true,
+    });
+    T(sg_query_buffer_info(buf).active_slot == 0);
+    uint8_t* ptr = (uint8_t*) sg_map_buffer(buf, 32);
+    T(ptr != 0);
+    T(sg_query_buffer_info(buf).mapped);
+    memset(ptr, 0xFF, 32);
+    sg_unmap_buffer(buf);
+    const sg_buffer_info info = sg_query_buffer_info(buf);
+    T(!info.mapped);
+    T(info.active_slot == 1);
+    T(info.update_frame_index == _sg.frame_index);
+    T(_sg.stats.cur_frame.num_update_buffer == 1);
+    T(_sg.stats.cur_frame.size_update_buffer == 32);
+    sg_commit();
+    // the staging memory is reused across frames
+    T(sg_map_buffer(buf, 64) == ptr);
+    sg_unmap_buffer(buf);
+    T(num_log_called == 0);
+    // the staging memory is freed when the buffer is destroyed
+    const int slot_index = _sg_slot_index(buf.id);
+    T(_sg.pools.buffers_cold[slot_index].map_staging == ptr);
+    sg_destroy_buffer(buf);
+    T(_sg.pools.buffers_cold[slot_index].map_staging == 0);
+    sg_shutdown();
+}
+
+UTEST(sokol_gfx, map_buffer_validate_usage) {
+    setup(&(sg_desc){0});
+    sg_buffer buf = sg_make_buffer(&(sg_buffer_desc){
+        .size = 64,
+        .usage.dynamic_update = true,
+    });
+    T(sg_map_buffer(buf, 32) == 0);
+    T(log_items[0] == SG_LOGITEM_VALIDATE_MAPBUF_USAGE);
+    T(log_items[1] == SG_LOGITEM_VALIDATION_FAILED);
+    T(!sg_query_buffer_info(buf).mapped);
+    sg_shutdown();
+}
+
+UTEST(sokol_gfx, map_buffer_validate_size) {
+    setup(&(sg_desc){0});
+    sg_buffer buf = sg_make_buffer(&(sg_buffer_desc){
+        .size = 64,
+        .usage.stream_update = true,
+    });
+    T(sg_map_buffer(buf, 65) == 0);
+    T(log_items[0] == SG_LOGITEM_VALIDATE_MAPBUF_SIZE);
+    T(log_items[1] == SG_LOGITEM_VALIDATION_FAILED);
+    sg_shutdown();
+}
+
+UTEST(sokol_gfx, map_buffer_validate_once) {
+    setup(&(sg_desc){0});
+    sg_buffer buf = sg_make_buffer(&(sg_buffer_desc){
+        .size = 64,
+        .usage.stream_update = true,
+    });
+    T(sg_map_buffer(buf, 32) != 0);
+    T(sg_map_buffer(buf, 32) == 0);
+    T(log_items[0] == SG_LOGITEM_VALIDATE_MAPBUF_MAPPED);
+    T(log_items[1] == SG_LOGITEM_VALIDATE_MAPBUF_ONCE);
+    T(log_items[2] == SG_LOGITEM_VALIDATION_FAILED);
+    sg_unmap_buffer(buf);
+    reset_log_items();
+    T(sg_map_buffer(buf, 32) == 0);
+    T(log_items[0] == SG_LOGITEM_VALIDATE_MAPBUF_ONCE);
+    T(log_items[1] == SG_LOGITEM_VALIDATION_FAILED);
+    sg_shutdown();
+}
+
+UTEST(sokol_gfx, map_buffer_validate_append) {
+    setup(&(sg_desc){0});
+    sg_buffer buf = sg_make_buffer(&(sg_buffer_desc){
+        .size = 64,
+        .usage.stream_update = true,
+    });
+    static const uint8_t data[16] = {0};
+    sg_append_buffer(buf, &SG_RANGE(data));
+    T(sg_map_buffer(buf, 32) == 0);
+    T(log_items[0] == SG_LOGITEM_VALIDATE_MAPBUF_APPEND);
+    T(log_items[1] == SG_LOGITEM_VALIDATION_FAILED);
+    sg_shutdown();
+}
+
+UTEST(sokol_gfx, map_buffer_validate_commit) {
+    setup(&(sg_desc){0});
+    sg_buffer buf = sg_make_buffer(&(sg_buffer_desc){
+        .size = 64,
+        .usage.stream_update = true,
+    });
+    T(sg_map_buffer(buf, 32) != 0);
+    T(_sg.num_mapped_buffers == 1);
+    sg_commit();
+    T(log_items[0] == SG_LOGITEM_VALIDATE_COMMIT_BUFFER_MAPPED);
+    T(log_items[1] == SG_LOGITEM_VALIDATION_FAILED);
+    // the frame was committed anyway
+    T(_sg.frame_index == 2);
+    sg_unmap_buffer(buf);
+    T(_sg.num_mapped_buffers == 0);
+    reset_log_items();
+    sg_commit();
+    T(num_log_called == 0);
+    // destroying a mapped buffer implicitly unmaps it
+    T(sg_map_buffer(buf, 32) != 0);
+    sg_destroy_buffer(buf);
+    T(_sg.num_mapped_buffers == 0);
+    sg_commit();
+    T(num_log_called == 0);
+    sg_shutdown();
+}
+
+UTEST(sokol_gfx, unmap_buffer_validate_not_mapped) {
+    setup(&(sg_desc){0});
+    sg_buffer buf = sg_make_buffer(&(sg_buffer_desc){
+        .size = 64,
+        .usage.stream_update = true,
+    });
+    sg_unmap_buffer(buf);
+    T(log_items[0] == SG_LOGITEM_VALIDATE_UNMAPBUF_NOT_MAPPED);
+    T(log_items[1] == SG_LOGITEM_VALIDATION_FAILED);
+    T(sg_query_buffer_info(buf).active_slot == 0);
+    sg_shutdown();
+}
+
 static struct {
     uintptr_t userdata;
     int num_called;
@@ -2733,3 +2980,1138 @@ UTEST(sokol_gfx, max_pass_attachments) {
     sg_commit();
     sg_shutdown();
 }
+
+static struct {
+    int num_called;
+    sg_readback_response response;
+} readback_cb;
+static void reset_readback_cb(void) {
+    memset(&readback_cb, 0, sizeof(readback_cb));
+}
+static void readback_cb_func(const sg_readback_response* response) {
+    readback_cb.num_called++;
+    readback_cb.response = *response;
+}
+
+UTEST(sokol_gfx, read_buffer_poll) {
+    setup(&(sg_desc){0});
+    T(sg_query_features().readback);
+    sg_buffer buf = create_buffer();
+    uint8_t dst[16];
+    memset(dst, 0xFF, sizeof(dst));
+    sg_readback rb = sg_read_buffer(&(sg_read_buffer_desc){
+        .src.buffer = buf,
+        .dst = SG_RANGE(dst),
+    });
+    T(rb.id != SG_INVALID_ID);
+    T(sg_query_readback_state(rb) == SG_READBACKSTATE_PENDING);
+    T(_sg.readbacks.num_pending == 1);
+    int num_frames = 0;
+    while (sg_query_readback_state(rb) == SG_READBACKSTATE_PENDING) {
+        T(dst[0] == 0xFF);
+        sg_commit();
+        num_frames++;
+    }
+    T(num_frames == SG_NUM_INFLIGHT_FRAMES + 1);
+    T(sg_query_readback_state(rb) == SG_READBACKSTATE_COMPLETED);
+    T(_sg.readbacks.num_pending == 0);
+    for (size_t i = 0; i < sizeof(dst); i++) {
+        T(dst[i] == 0);
+    }
+    T(_sg.stats.prev_frame.num_read_buffer == 0);
+    sg_shutdown();
+}
+
+UTEST(sokol_gfx, read_buffer_callback) {
+    reset_readback_cb();
+    setup(&(sg_desc){0});
+    sg_buffer buf = create_buffer();
+    uint8_t dst[16] = {0};
+    sg_readback rb = sg_read_buffer(&(sg_read_buffer_desc){
+        .src = { .buffer = buf, .offset = 4 },
+        .dst = SG_RANGE(dst),
+        .callback = readback_cb_func,
+        .user_data = (void*)23,
+    });
+    T(_sg.stats.cur_frame.num_read_buffer == 1);
+    T(_sg.stats.cur_frame.size_read_buffer == 12);
+    for (int i = 0; i < SG_NUM_INFLIGHT_FRAMES; i++) {
+        sg_commit();
+        T(readback_cb.num_called == 0);
+    }
+    sg_commit();
+    T(readback_cb.num_called == 1);
+    T(readback_cb.response.readback.id == rb.id);
+    T(readback_cb.response.state == SG_READBACKSTATE_COMPLETED);
+    T(readback_cb.response.data.ptr == dst);
+    T(readback_cb.response.data.size == 12);
+    T(readback_cb.response.user_data == (void*)23);
+    sg_commit();
+    T(readback_cb.num_called == 1);
+    sg_shutdown();
+}
+
+UTEST(sokol_gfx, read_image_default_size) {
+    reset_readback_cb();
+    setup(&(sg_desc){0});
+    sg_image img = create_image();
+    static uint8_t dst[256 * 128 * 4];
+    sg_read_image(&(sg_read_image_desc){
+        .src.image = img,
+        .dst = SG_RANGE(dst),
+        .callback = readback_cb_func,
+    });
+    T(_sg.stats.cur_frame.num_read_image == 1);
+    T(_sg.stats.cur_frame.size_read_image == sizeof(dst));
+    for (int i = 0; i <= SG_NUM_INFLIGHT_FRAMES; i++) {
+        sg_commit();
+    }
+    T(readback_cb.num_called == 1);
+    T(readback_cb.response.state == SG_READBACKSTATE_COMPLETED);
+    T(readback_cb.response.data.size == sizeof(dst));
+    sg_shutdown();
+}
+
+UTEST(sokol_gfx, read_image_region) {
+    reset_readback_cb();
+    setup(&(sg_desc){0});
+    sg_image img = create_image();
+    uint8_t dst[16 * 8 * 4];
+    sg_read_image(&(sg_read_image_desc){
+        .src = { .image = img, .mip_level = 0, .x = 240, .y = 120 },
+        .dst = SG_RANGE(dst),
+        .callback = readback_cb_func,
+    });
+    T(num_log_called == 0);
+    for (int i = 0; i <= SG_NUM_INFLIGHT_FRAMES; i++) {
+        sg_commit();
+    }
+    T(readback_cb.num_called == 1);
+    T(readback_cb.response.data.size == sizeof(dst));
+    sg_shutdown();
+}
+
+UTEST(sokol_gfx, readback_pool_exhausted) {
+    setup(&(sg_desc){ .max_readbacks = 2 });
+    sg_buffer buf = create_buffer();
+    uint8_t dst[16];
+    const sg_read_buffer_desc desc = { .src.buffer = buf, .dst = SG_RANGE(dst) };
+    sg_readback rb0 = sg_read_buffer(&desc);
+    sg_readback rb1 = sg_read_buffer(&desc);
+    sg_readback rb2 = sg_read_buffer(&desc);
+    T(sg_query_readback_state(rb0) == SG_READBACKSTATE_PENDING);
+    T(sg_query_readback_state(rb1) == SG_READBACKSTATE_PENDING);
+    T(rb2.id == SG_INVALID_ID);
+    T(sg_query_readback_state(rb2) == SG_READBACKSTATE_INVALID);
+    T(log_items[0] == SG_LOGITEM_READBACK_POOL_EXHAUSTED);
+    sg_shutdown();
+}
+
+UTEST(sokol_gfx, readback_slot_reuse) {
+    setup(&(sg_desc){ .max_readbacks = 1 });
+    sg_buffer buf = create_buffer();
+    uint8_t dst[16];
+    const sg_read_buffer_desc desc = { .src.buffer = buf, .dst = SG_RANGE(dst) };
+    sg_readback rb0 = sg_read_buffer(&desc);
+    for (int i = 0; i <= SG_NUM_INFLIGHT_FRAMES; i++) {
+        sg_commit();
+    }
+    T(sg_query_readback_state(rb0) == SG_READBACKSTATE_COMPLETED);
+    sg_readback rb1 = sg_read_buffer(&desc);
+    T(rb1.id != SG_INVALID_ID);
+    T(rb1.id != rb0.id);
+    T(sg_query_readback_state(rb0) == SG_READBACKSTATE_INVALID);
+    T(sg_query_readback_state(rb1) == SG_READBACKSTATE_PENDING);
+    sg_shutdown();
+}
+
+UTEST(sokol_gfx, readback_pending_on_shutdown) {
+    reset_readback_cb();
+    setup(&(sg_desc){0});
+    sg_buffer buf = create_buffer();
+    uint8_t dst[16];
+    sg_read_buffer(&(sg_read_buffer_desc){
+        .src.buffer = buf,
+        .dst = SG_RANGE(dst),
+        .callback = readback_cb_func,
+    });
+    sg_shutdown();
+    T(readback_cb.num_called == 0);
+}
+
+UTEST(sokol_gfx, read_buffer_buffer_alive) {
+    setup(&(sg_desc){0});
+    sg_buffer buf = create_buffer();
+    sg_destroy_buffer(buf);
+    uint8_t dst[16];
+    sg_readback rb = sg_read_buffer(&(sg_read_buffer_desc){
+        .src.buffer = buf,
+        .dst = SG_RANGE(dst),
+    });
+    T(rb.id == SG_INVALID_ID);
+    T(log_items[0] == SG_LOGITEM_READ_BUFFER_BUFFER_ALIVE);
+    sg_shutdown();
+}
+
+UTEST(sokol_gfx, read_buffer_validate_inpass) {
+    setup(&(sg_desc){0});
+    sg_buffer buf = create_buffer();
+    uint8_t dst[16];
+    sg_begin_pass(&(sg_pass){ .compute = true });
+    sg_readback rb = sg_read_buffer(&(sg_read_buffer_desc){
+        .src.buffer = buf,
+        .dst = SG_RANGE(dst),
+    });
+    sg_end_pass();
+    T(rb.id == SG_INVALID_ID);
+    T(log_items[0] == SG_LOGITEM_VALIDATE_READBUFFER_INPASS);
+    T(log_items[1] == SG_LOGITEM_VALIDATION_FAILED);
+    sg_shutdown();
+}
+
+UTEST(sokol_gfx, read_buffer_validate_overflow) {
+    setup(&(sg_desc){0});
+    sg_buffer buf = create_buffer();
+    uint8_t dst[32];
+    sg_readback rb = sg_read_buffer(&(sg_read_buffer_desc){
+        .src = { .buffer = buf, .offset = 8 },
+        .size = 16,
+        .dst = SG_RANGE(dst),
+    });
+    T(rb.id == SG_INVALID_ID);
+    T(log_items[0] == SG_LOGITEM_VALIDATE_READBUFFER_READ_OVERFLOW);
+    T(log_items[1] == SG_LOGITEM_VALIDATION_FAILED);
+    sg_shutdown();
+}
+
+UTEST(sokol_gfx, read_buffer_validate_dst_size) {
+    setup(&(sg_desc){0});
+    sg_buffer buf = create_buffer();
+    uint8_t dst[8];
+    sg_readback rb = sg_read_buffer(&(sg_read_buffer_desc){
+        .src.buffer = buf,
+        .dst = SG_RANGE(dst),
+    });
+    T(rb.id == SG_INVALID_ID);
+    T(log_items[0] == SG_LOGITEM_VALIDATE_READBUFFER_DST_DATA_SIZE);
+    T(log_items[1] == SG_LOGITEM_VALIDATION_FAILED);
+    sg_shutdown();
+}
+
+UTEST(sokol_gfx, read_image_validate_samplecount) {
+    setup(&(sg_desc){0});
+    sg_image img = sg_make_image(&(sg_image_desc){
+        .usage.color_attachment = true,
+        .width = 64,
+        .height = 64,
+        .sample_count = 4,
+    });
+    static uint8_t dst[64 * 64 * 4];
+    sg_readback rb = sg_read_image(&(sg_read_image_desc){
+        .src.image = img,
+        .dst = SG_RANGE(dst),
+    });
+    T(rb.id == SG_INVALID_ID);
+    T(log_items[0] == SG_LOGITEM_VALIDATE_READIMAGE_SAMPLECOUNT);
+    T(log_items[1] == SG_LOGITEM_VALIDATION_FAILED);
+    sg_shutdown();
+}
+
+UTEST(sokol_gfx, read_image_validate_dst_size) {
+    setup(&(sg_desc){0});
+    sg_image img = create_image();
+    uint8_t dst[1000];
+    sg_readback rb = sg_read_image(&(sg_read_image_desc){
+        .src = { .image = img, .x = 128, .y = 64 },
+        .size = { .width = 16, .height = 16 },
+        .dst = SG_RANGE(dst),
+    });
+    T(rb.id == SG_INVALID_ID);
+    T(log_items[0] == SG_LOGITEM_VALIDATE_READIMAGE_DST_DATA_SIZE);
+    T(log_items[1] == SG_LOGITEM_VALIDATION_FAILED);
+    sg_shutdown();
+}
+
+static void record_timer(const char* label) {
+    sg_begin_pass(&(sg_pass){ .compute = true });
+    sg_begin_timer(label);
+    sg_end_timer();
+    sg_end_pass();
+}
+
+UTEST(sokol_gfx, timer_query_defaults) {
+    setup(&(sg_desc){0});
+    T(sg_query_desc().max_timers == _SG_DEFAULT_MAX_TIMERS);
+    T(sg_query_features().gpu_timers);
+    const sg_timer_result res = sg_query_timer("bla");
+    T(!res.valid);
+    T(res.frame_index == 0);
+    T(res.duration_ns == 0);
+    sg_shutdown();
+}
+
+UTEST(sokol_gfx, timer_resolve) {
+    setup(&(sg_desc){0});
+    const uint32_t frame_index = _sg.frame_index;
+    record_timer("bla");
+    T(_sg.timers.num == 1);
+    T(_sg.timers.num_pending == 1);
+    int num_frames = 0;
+    while (!sg_query_timer("bla").valid) {
+        sg_commit();
+        num_frames++;
+    }
+    T(num_frames == SG_NUM_INFLIGHT_FRAMES + 1);
+    T(_sg.timers.num_pending == 0);
+    const sg_timer_result res = sg_query_timer("bla");
+    T(res.frame_index == frame_index);
+    T(!sg_query_timer("blub").valid);
+    sg_shutdown();
+}
+
+UTEST(sokol_gfx, timer_most_recent_result) {
+    setup(&(sg_desc){0});
+    for (int i = 0; i < 8; i++) {
+        record_timer("bla");
+        sg_commit();
+    }
+    T(_sg.timers.num == 1);
+    T(_sg.timers.num_pending == SG_NUM_INFLIGHT_FRAMES);
+    const sg_timer_result res = sg_query_timer("bla");
+    T(res.valid);
+    T(res.frame_index == (_sg.frame_index - 1 - SG_NUM_INFLIGHT_FRAMES));
+    sg_shutdown();
+}
+
+UTEST(sokol_gfx, timer_labels_compared_by_content) {
+    setup(&(sg_desc){0});
+    char label[8] = "bla";
+    record_timer(label);
+    sg_commit();
+    strcpy(label, "bla");
+    record_timer(label);
+    T(_sg.timers.num == 1);
+    record_timer("blub");
+    T(_sg.timers.num == 2);
+    sg_shutdown();
+}
+
+UTEST(sokol_gfx, timer_pool_exhausted) {
+    setup(&(sg_desc){ .max_timers = 1 });
+    record_timer("bla");
+    T(num_log_called == 0);
+    record_timer("blub");
+    T(log_items[0] == SG_LOGITEM_TIMER_POOL_EXHAUSTED);
+    T(_sg.timers.num == 1);
+    for (int i = 0; i <= SG_NUM_INFLIGHT_FRAMES; i++) {
+        sg_commit();
+    }
+    T(sg_query_timer("bla").valid);
+    T(!sg_query_timer("blub").valid);
+    sg_shutdown();
+}
+
+UTEST(sokol_gfx, timer_end_pass_with_active_timer) {
+    setup(&(sg_desc){0});
+    sg_begin_pass(&(sg_pass){ .compute = true });
+    sg_begin_timer("bla");
+    sg_end_pass();
+    T(log_items[0] == SG_LOGITEM_END_PASS_TIMER_NOT_ENDED);
+    T(!_sg.timers.in_scope);
+    T(_sg.timers.num_pending == 1);
+    sg_shutdown();
+}
+
+UTEST(sokol_gfx, timer_validate_begin_outside_pass) {
+    setup(&(sg_desc){0});
+    sg_begin_timer("bla");
+    T(log_items[0] == SG_LOGITEM_VALIDATE_BEGINTIMER_PASS);
+    T(log_items[1] == SG_LOGITEM_VALIDATION_FAILED);
+    sg_shutdown();
+}
+
+UTEST(sokol_gfx, timer_validate_label) {
+    setup(&(sg_desc){0});
+    sg_begin_pass(&(sg_pass){ .compute = true });
+    sg_begin_timer("");
+    sg_end_pass();
+    T(log_items[0] == SG_LOGITEM_VALIDATE_BEGINTIMER_LABEL);
+    T(log_items[1] == SG_LOGITEM_VALIDATION_FAILED);
+    sg_shutdown();
+}
+
+UTEST(sokol_gfx, timer_validate_nested) {
+    setup(&(sg_desc){0});
+    sg_begin_pass(&(sg_pass){ .compute = true });
+    sg_begin_timer("bla");
+    sg_begin_timer("blub");
+    sg_end_timer();
+    sg_end_pass();
+    T(log_items[0] == SG_LOGITEM_VALIDATE_BEGINTIMER_NESTED);
+    T(log_items[1] == SG_LOGITEM_VALIDATION_FAILED);
+    T(num_log_called == 2);
+    sg_shutdown();
+}
+
+UTEST(sokol_gfx, timer_validate_once_per_frame) {
+    setup(&(sg_desc){0});
+    record_timer("bla");
+    T(num_log_called == 0);
+    sg_begin_pass(&(sg_pass){ .compute = true });
+    sg_begin_timer("bla");
+    T(log_items[0] == SG_LOGITEM_VALIDATE_BEGINTIMER_ONCE_PER_FRAME);
+    T(log_items[1] == SG_LOGITEM_VALIDATION_FAILED);
+    sg_end_pass();
+    sg_commit();
+    reset_log_items();
+    record_timer("bla");
+    T(num_log_called == 0);
+    sg_shutdown();
+}
+
+UTEST(sokol_gfx, timer_validate_end_without_begin) {
+    setup(&(sg_desc){0});
+    sg_begin_pass(&(sg_pass){ .compute = true });
+    sg_end_timer();
+    sg_end_pass();
+    T(log_items[0] == SG_LOGITEM_VALIDATE_ENDTIMER_NO_TIMER);
+    T(log_items[1] == SG_LOGITEM_VALIDATION_FAILED);
+    sg_shutdown();
+}
+
+static sg_view create_color_attachment_view(void) {
+    return sg_make_view(&(sg_view_desc){ .color_attachment.image = create_image() });
+}
+
+static void record_occlusion_query(sg_view att_view, sg_occlusion_query query) {
+    sg_begin_pass(&(sg_pass){ .attachments.colors[0] = att_view });
+    sg_begin_occlusion_query(query);
+    sg_end_occlusion_query();
+    sg_end_pass();
+}
+
+UTEST(sokol_gfx, occlusion_query_make_destroy) {
+    setup(&(sg_desc){0});
+    T(sg_query_desc().occlusion_query_pool_size == _SG_DEFAULT_OCCLUSION_QUERY_POOL_SIZE);
+    T(sg_query_features().occlusion_query);
+    T(sg_query_features().occlusion_query_samples);
+    sg_occlusion_query query = sg_make_occlusion_query(&(sg_occlusion_query_desc){0});
+    T(query.id != SG_INVALID_ID);
+    const _sg_occlusion_query_t* q = _sg_lookup_occlusion_query(query.id);
+    T(q);
+    T(q->type == SG_OCCLUSIONQUERYTYPE_ANY_SAMPLES_PASSED);
+    T(!sg_query_occlusion_result(query).valid);
+    sg_destroy_occlusion_query(query);
+    T(0 == _sg_lookup_occlusion_query(query.id));
+    T(!sg_query_occlusion_result(query).valid);
+    sg_shutdown();
+}
+
+UTEST(sokol_gfx, occlusion_query_pool_exhausted) {
+    setup(&(sg_desc){ .occlusion_query_pool_size = 1 });
+    sg_occlusion_query q0 = sg_make_occlusion_query(&(sg_occlusion_query_desc){0});
+    T(q0.id != SG_INVALID_ID);
+    sg_occlusion_query q1 = sg_make_occlusion_query(&(sg_occlusion_query_desc){0});
+    T(q1.id == SG_INVALID_ID);
+    T(log_items[0] == SG_LOGITEM_OCCLUSION_QUERY_POOL_EXHAUSTED);
+    sg_destroy_occlusion_query(q0);
+    sg_occlusion_query q2 = sg_make_occlusion_query(&(sg_occlusion_query_desc){0});
+    T(q2.id != SG_INVALID_ID);
+    T(q2.id != q0.id);
+    sg_shutdown();
+}
+
+UTEST(sokol_gfx, occlusion_query_resolve) {
+    setup(&(sg_desc){0});
+    sg_view att_view = create_color_attachment_view();
+    sg_occlusion_query query = sg_make_occlusion_query(&(sg_occlusion_query_desc){0});
+    const uint32_t frame_index = _sg.frame_index;
+    record_occlusion_query(att_view, query);
+    T(num_log_called == 0);
+    T(_sg.occlusion_queries.num_pending == 1);
+    int num_frames = 0;
+    while (!sg_query_occlusion_result(query).valid) {
+        sg_commit();
+        num_frames++;
+    }
+    T(num_frames == SG_NUM_INFLIGHT_FRAMES + 1);
+    T(_sg.occlusion_queries.num_pending == 0);
+    const sg_occlusion_query_result res = sg_query_occlusion_result(query);
+    T(res.frame_index == frame_index);
+    T(res.visible);
+    T(res.num_samples == 1);
+    sg_shutdown();
+}
+
+UTEST(sokol_gfx, occlusion_query_dummy_result_latency) {
+    setup(&(sg_desc){0});
+    sg_view att_view = create_color_attachment_view();
+    sg_occlusion_query query = sg_make_occlusion_query(&(sg_occlusion_query_desc){
+        .type = SG_OCCLUSIONQUERYTYPE_SAMPLES_PASSED,
+    });
+    // the configured result is captured when the query is recorded
+    sg_dummy_set_occlusion_result(query, 100);
+    record_occlusion_query(att_view, query);
+    sg_commit();
+    sg_dummy_set_occlusion_result(query, 0);
+    record_occlusion_query(att_view, query);
+    sg_commit();
+    T(!sg_query_occlusion_result(query).valid);
+    record_occlusion_query(att_view, query);
+    sg_commit();
+    sg_occlusion_query_result res = sg_query_occlusion_result(query);
+    T(res.valid);
+    T(res.visible);
+    T(res.num_samples == 100);
+    record_occlusion_query(att_view, query);
+    sg_commit();
+    res = sg_query_occlusion_result(query);
+    T(res.valid);
+    T(!res.visible);
+    T(res.num_samples == 0);
+    sg_shutdown();
+}
+
+UTEST(sokol_gfx, occlusion_query_any_samples_passed) {
+    setup(&(sg_desc){0});
+    sg_view att_view = create_color_attachment_view();
+    sg_occlusion_query query = sg_make_occlusion_query(&(sg_occlusion_query_desc){0});
+    sg_dummy_set_occlusion_result(query, 100);
+    record_occlusion_query(att_view, query);
+    for (int i = 0; i <= SG_NUM_INFLIGHT_FRAMES; i++) {
+        sg_commit();
+    }
+    const sg_occlusion_query_result res = sg_query_occlusion_result(query);
+    T(res.valid);
+    T(res.visible);
+    T(res.num_samples == 1);
+    sg_shutdown();
+}
+
+UTEST(sokol_gfx, occlusion_query_destroy_pending) {
+    setup(&(sg_desc){0});
+    sg_view att_view = create_color_attachment_view();
+    sg_occlusion_query query = sg_make_occlusion_query(&(sg_occlusion_query_desc){0});
+    record_occlusion_query(att_view, query);
+    T(_sg.occlusion_queries.num_pending == 1);
+    sg_destroy_occlusion_query(query);
+    T(_sg.occlusion_queries.num_pending == 0);
+    sg_commit();
+    sg_shutdown();
+}
+
+UTEST(sokol_gfx, occlusion_query_end_pass_with_active_query) {
+    setup(&(sg_desc){0});
+    sg_view att_view = create_color_attachment_view();
+    sg_occlusion_query query = sg_make_occlusion_query(&(sg_occlusion_query_desc){0});
+    sg_begin_pass(&(sg_pass){ .attachments.colors[0] = att_view });
+    sg_begin_occlusion_query(query);
+    sg_end_pass();
+    T(log_items[0] == SG_LOGITEM_END_PASS_OCCLUSION_QUERY_NOT_ENDED);
+    T(!_sg.occlusion_queries.in_scope);
+    T(_sg.occlusion_queries.num_pending == 1);
+    sg_shutdown();
+}
+
+UTEST(sokol_gfx, occlusion_query_begin_destroyed_query) {
+    setup(&(sg_desc){0});
+    sg_view att_view = create_color_attachment_view();
+    sg_occlusion_query query = sg_make_occlusion_query(&(sg_occlusion_query_desc){0});
+    sg_destroy_occlusion_query(query);
+    record_occlusion_query(att_view, query);
+    T(log_items[0] == SG_LOGITEM_BEGIN_OCCLUSION_QUERY_QUERY_ALIVE);
+    T(num_log_called == 1);
+    sg_shutdown();
+}
+
+UTEST(sokol_gfx, occlusion_query_validate_compute_pass) {
+    setup(&(sg_desc){0});
+    sg_occlusion_query query = sg_make_occlusion_query(&(sg_occlusion_query_desc){0});
+    sg_begin_pass(&(sg_pass){ .compute = true });
+    sg_begin_occlusion_query(query);
+    sg_end_pass();
+    T(log_items[0] == SG_LOGITEM_VALIDATE_BEGINOCCLUSIONQUERY_RENDERPASS);
+    T(log_items[1] == SG_LOGITEM_VALIDATION_FAILED);
+    sg_shutdown();
+}
+
+UTEST(sokol_gfx, occlusion_query_validate_nested) {
+    setup(&(sg_desc){0});
+    sg_view att_view = create_color_attachment_view();
+    sg_occlusion_query q0 = sg_make_occlusion_query(&(sg_occlusion_query_desc){0});
+    sg_occlusion_query q1 = sg_make_occlusion_query(&(sg_occlusion_query_desc){0});
+    sg_begin_pass(&(sg_pass){ .attachments.colors[0] = att_view });
+    sg_begin_occlusion_query(q0);
+    sg_begin_occlusion_query(q1);
+    sg_end_occlusion_query();
+    sg_end_pass();
+    T(log_items[0] == SG_LOGITEM_VALIDATE_BEGINOCCLUSIONQUERY_NESTED);
+    T(log_items[1] == SG_LOGITEM_VALIDATION_FAILED);
+    T(num_log_called == 2);
+    sg_shutdown();
+}
+
+UTEST(sokol_gfx, occlusion_query_validate_once_per_frame) {
+    setup(&(sg_desc){0});
+    sg_view att_view = create_color_attachment_view();
+    sg_occlusion_query query = sg_make_occlusion_query(&(sg_occlusion_query_desc){0});
+    record_occlusion_query(att_view, query);
+    T(num_log_called == 0);
+    sg_begin_pass(&(sg_pass){ .attachments.colors[0] = att_view });
+    sg_begin_occlusion_query(query);
+    T(log_items[0] == SG_LOGITEM_VALIDATE_BEGINOCCLUSIONQUERY_ONCE_PER_FRAME);
+    T(log_items[1] == SG_LOGITEM_VALIDATION_FAILED);
+    sg_end_pass();
+    sg_shutdown();
+}
+
+UTEST(sokol_gfx, occlusion_query_validate_end_without_begin) {
+    setup(&(sg_desc){0});
+    sg_view att_view = create_color_attachment_view();
+    sg_begin_pass(&(sg_pass){ .attachments.colors[0] = att_view });
+    sg_end_occlusion_query();
+    sg_end_pass();
+    T(log_items[0] == SG_LOGITEM_VALIDATE_ENDOCCLUSIONQUERY_NO_QUERY);
+    T(log_items[1] == SG_LOGITEM_VALIDATION_FAILED);
+    sg_shutdown();
+}
+
+UTEST(sokol_gfx, occlusion_query_validate_desc_canary) {
+    setup(&(sg_desc){0});
+    sg_occlusion_query query = sg_make_occlusion_query(&(sg_occlusion_query_desc){ ._start_canary = 1 });
+    T(query.id == SG_INVALID_ID);
+    T(log_items[0] == SG_LOGITEM_VALIDATE_OCCLUSIONQUERYDESC_CANARY);
+    T(log_items[1] == SG_LOGITEM_VALIDATION_FAILED);
+    sg_shutdown();
+}
+
+static sg_pipeline create_uniforms_pipeline(void) {
+    return sg_make_pipeline(&(sg_pipeline_desc){
+        .layout.attrs[0].format = SG_VERTEXFORMAT_FLOAT3,
+        .shader = sg_make_shader(&(sg_shader_desc){
+            .uniform_blocks[0] = { .stage = SG_SHADERSTAGE_VERTEX, .size = 16 },
+        }),
+    });
+}
+
+// returns the number of draw calls that were not skipped
+static int draw_with_uniforms(sg_pipeline pip, sg_buffer vbuf, int num_draws) {
+    static const float uniforms[4] = { 0 };
+    int num_valid_draws = 0;
+    sg_begin_pass(&(sg_pass){
+        .swapchain = {
+            .width = 256,
+            .height = 128,
+            .sample_count = 1,
+            .color_format = SG_PIXELFORMAT_RGBA8,
+            .depth_format = SG_PIXELFORMAT_DEPTH_STENCIL,
+        },
+    });
+    sg_apply_pipeline(pip);
+    for (int i = 0; i < num_draws; i++) {
+        sg_apply_bindings(&(sg_bindings){ .vertex_buffers[0] = vbuf });
+        sg_apply_uniforms(0, &SG_RANGE(uniforms));
+        if (_sg.next_draw_valid) {
+            num_valid_draws++;
+        }
+        sg_draw(0, 3, 1);
+    }
+    sg_end_pass();
+    sg_commit();
+    return num_valid_draws;
+}
+
+UTEST(sokol_gfx, uniform_buffer_stats) {
+    setup(&(sg_desc){ .uniform_buffer_size = 64 * 1024 });
+    sg_pipeline pip = create_uniforms_pipeline();
+    static const float data[16] = { 0 };
+    sg_buffer vbuf = sg_make_buffer(&(sg_buffer_desc){ .data = SG_RANGE(data) });
+    // the dummy backend uses the worst-case uniform buffer alignment of 256 bytes
+    T(draw_with_uniforms(pip, vbuf, 10) == 10);
+    sg_frame_stats stats = sg_query_stats().prev_frame;
+    T(stats.uniform_buffer_used == 10 * 256);
+    T(stats.uniform_buffer_peak == 10 * 256);
+    T(stats.uniform_buffer_size == 64 * 1024);
+    T(draw_with_uniforms(pip, vbuf, 4) == 4);
+    stats = sg_query_stats().prev_frame;
+    T(stats.uniform_buffer_used == 4 * 256);
+    T(stats.uniform_buffer_peak == 10 * 256);
+    T(num_log_called == 0);
+    sg_shutdown();
+}
+
+UTEST(sokol_gfx, uniform_buffer_warn_threshold) {
+    setup(&(sg_desc){ .uniform_buffer_warn_threshold = 4 * 256 });
+    sg_pipeline pip = create_uniforms_pipeline();
+    static const float data[16] = { 0 };
+    sg_buffer vbuf = sg_make_buffer(&(sg_buffer_desc){ .data = SG_RANGE(data) });
+    T(draw_with_uniforms(pip, vbuf, 4) == 4);
+    T(num_log_called == 0);
+    // the warning is only logged once per frame, and doesn't skip draw calls
+    T(draw_with_uniforms(pip, vbuf, 8) == 8);
+    T(num_log_called == 1);
+    T(log_items[0] == SG_LOGITEM_UNIFORM_BUFFER_WARN_THRESHOLD);
+    T(draw_with_uniforms(pip, vbuf, 8) == 8);
+    T(num_log_called == 2);
+    sg_shutdown();
+}
+
+UTEST(sokol_gfx, uniform_buffer_overflow) {
+    setup(&(sg_desc){ .uniform_buffer_size = 4 * 256 });
+    sg_pipeline pip = create_uniforms_pipeline();
+    static const float data[16] = { 0 };
+    sg_buffer vbuf = sg_make_buffer(&(sg_buffer_desc){ .data = SG_RANGE(data) });
+    T(draw_with_uniforms(pip, vbuf, 6) == 4);
+    T(num_log_called == 1);
+    T(log_items[0] == SG_LOGITEM_UNIFORM_BUFFER_OVERFLOW);
+    sg_frame_stats stats = sg_query_stats().prev_frame;
+    T(stats.uniform_buffer_used == 6 * 256);
+    T(stats.uniform_buffer_size == 4 * 256);
+    // without auto-grow the next frame overflows again
+    T(draw_with_uniforms(pip, vbuf, 6) == 4);
+    T(num_log_called == 2);
+    T(draw_with_uniforms(pip, vbuf, 4) == 4);
+    T(num_log_called == 2);
+    sg_shutdown();
+}
+
+UTEST(sokol_gfx, uniform_buffer_auto_grow) {
+    setup(&(sg_desc){ .uniform_buffer_size = 4 * 256, .uniform_buffer_auto_grow = true });
+    sg_pipeline pip = create_uniforms_pipeline();
+    static const float data[16] = { 0 };
+    sg_buffer vbuf = sg_make_buffer(&(sg_buffer_desc){ .data = SG_RANGE(data) });
+    T(draw_with_uniforms(pip, vbuf, 9) == 4);
+    T(num_log_called == 2);
+    T(log_items[0] == SG_LOGITEM_UNIFORM_BUFFER_OVERFLOW);
+    T(log_items[1] == SG_LOGITEM_UNIFORM_BUFFER_GROWN);
+    T(sg_query_stats().prev_frame.uniform_buffer_size == 16 * 256);
+    T(draw_with_uniforms(pip, vbuf, 16) == 16);
+    T(num_log_called == 2);
+    T(sg_query_stats().prev_frame.uniform_buffer_size == 16 * 256);
+    sg_shutdown();
+}
+
+UTEST(sokol_gfx, update_image_region) {
+    setup(&(sg_desc){0});
+    sg_image img = sg_make_image(&(sg_image_desc){
+        .usage.region_update = true,
+        .width = 64,
+        .height = 32,
+    });
+    T(sg_query_image_state(img) == SG_RESOURCESTATE_VALID);
+    T(sg_query_image_usage(img).region_update);
+    T(!sg_query_image_usage(img).immutable);
+    T(sg_query_image_info(img).num_slots == 1);
+    static uint32_t pixels[8 * 4];
+    // multiple region updates per frame are allowed
+    for (int i = 0; i < 4; i++) {
+        sg_update_image_region(&(sg_write_image_desc){
+            .src.data = SG_RANGE(pixels),
+            .dst = { .image = img, .x = i * 8, .y = 4 },
+            .size = { .width = 8, .height = 4 },
+        });
+    }
+    T(num_log_called == 0);
+    T(sg_query_stats().cur_frame.num_update_image == 4);
+    T(sg_query_stats().cur_frame.size_update_image == 4 * sizeof(pixels));
+    sg_shutdown();
+}
+
+UTEST(sokol_gfx, update_image_region_validate) {
+    setup(&(sg_desc){0});
+    static uint32_t pixels[8 * 4];
+    sg_image dyn_img = sg_make_image(&(sg_image_desc){ .usage.dynamic_update = true, .width = 64, .height = 32 });
+    sg_update_image_region(&(sg_write_image_desc){
+        .src.data = SG_RANGE(pixels),
+        .dst.image = dyn_img,
+        .size = { .width = 8, .height = 4 },
+    });
+    T(log_items[0] == SG_LOGITEM_VALIDATE_UPDIMGREGION_USAGE);
+    reset_log_items();
+    sg_image img = sg_make_image(&(sg_image_desc){ .usage.region_update = true, .width = 64, .height = 32 });
+    sg_update_image_region(&(sg_write_image_desc){
+        .src.data = SG_RANGE(pixels),
+        .dst = { .image = img, .x = 60 },
+        .size = { .width = 8, .height = 4 },
+    });
+    T(log_items[0] == SG_LOGITEM_VALIDATE_UPDIMGREGION_WRITE_OVERFLOW);
+    reset_log_items();
+    sg_update_image_region(&(sg_write_image_desc){
+        .src.data = SG_RANGE(pixels),
+        .dst.image = img,
+        .size = { .width = 8, .height = 8 },
+    });
+    T(log_items[0] == SG_LOGITEM_VALIDATE_UPDIMGREGION_READ_OVERFLOW);
+    reset_log_items();
+    // an out-of-range mip level is caught by validation, also when the
+    // region size is defaulted from the mip level dimensions
+    sg_update_image_region(&(sg_write_image_desc){
+        .src.data = SG_RANGE(pixels),
+        .dst = { .image = img, .mip_level = 40 },
+    });
+    T(log_items[0] == SG_LOGITEM_VALIDATE_UPDIMGREGION_MIPLEVEL);
+    reset_log_items();
+    sg_update_image_region(&(sg_write_image_desc){
+        .src.data = SG_RANGE(pixels),
+        .dst = { .image = img, .mip_level = -1 },
+    });
+    T(log_items[0] == SG_LOGITEM_VALIDATE_UPDIMGREGION_MIPLEVEL);
+    reset_log_items();
+    static uint32_t all_pixels[64 * 32];
+    sg_update_image(img, &(sg_image_data){ .mip_levels[0] = SG_RANGE(all_pixels) });
+    T(log_items[0] == SG_LOGITEM_VALIDATE_UPDIMG_REGION_UPDATE);
+    reset_log_items();
+    sg_image bad_img = sg_make_image(&(sg_image_desc){ .usage = { .region_update = true, .dynamic_update = true }, .width = 64, .height = 32 });
+    T(sg_query_image_state(bad_img) == SG_RESOURCESTATE_FAILED);
+    T(log_items[0] == SG_LOGITEM_VALIDATE_IMAGEDESC_IMMUTABLE_DYNAMIC_STREAM);
+    sg_shutdown();
+}
+
+static struct {
+    int num_called;
+    sg_budget_item item;
+    sg_budget_state state;
+    void* user_data;
+} budget_cb;
+
+static void budget_callback(sg_budget_item item, const sg_budget_state* state, void* user_data) {
+    budget_cb.num_called++;
+    budget_cb.item = item;
+    budget_cb.state = *state;
+    budget_cb.user_data = user_data;
+}
+
+static void setup_with_budget(const sg_frame_budget* budget) {
+    memset(&budget_cb, 0, sizeof(budget_cb));
+    setup(&(sg_desc){
+        .frame_budget = *budget,
+        .budget_callback = { .func = budget_callback, .user_data = (void*)0xABCD },
+    });
+}
+
+UTEST(sokol_gfx, budget_default_unlimited) {
+    setup(&(sg_desc){0});
+    sg_pipeline pip = create_uniforms_pipeline();
+    sg_buffer vbuf = create_buffer();
+    sg_begin_pass(&(sg_pass){ .swapchain = { .width = 256, .height = 128, .sample_count = 1 } });
+    sg_apply_pipeline(pip);
+    sg_apply_bindings(&(sg_bindings){ .vertex_buffers[0] = vbuf });
+    static const float uniforms[4] = { 0 };
+    sg_apply_uniforms(0, &SG_RANGE(uniforms));
+    sg_draw(0, 3, 1);
+    sg_draw(0, 3, 1);
+    // no-op draws are not counted
+    sg_draw(0, 0, 1);
+    sg_end_pass();
+    sg_budget_state state = sg_query_budget_state();
+    T(state.budget.num_draws == 0);
+    T(state.budget.num_passes == 0);
+    T(state.budget.upload_bytes == 0);
+    T(state.used.num_draws == 2);
+    T(state.used.num_passes == 1);
+    T(state.used.upload_bytes == 0);
+    T(!state.exceeded);
+    T(!sg_query_budget_will_exceed(&(sg_frame_budget){ .num_draws = 1000000, .upload_bytes = 0xFFFFFFFF }));
+    sg_commit();
+    state = sg_query_budget_state();
+    T(state.used.num_draws == 0);
+    T(state.used.num_passes == 0);
+    sg_shutdown();
+}
+
+UTEST(sokol_gfx, budget_draws_exceeded) {
+    setup_with_budget(&(sg_frame_budget){ .num_draws = 4 });
+    sg_pipeline pip = create_uniforms_pipeline();
+    sg_buffer vbuf = create_buffer();
+    // exceeding the budget doesn't skip draw calls
+    T(draw_with_uniforms(pip, vbuf, 8) == 8);
+    T(budget_cb.num_called == 1);
+    T(budget_cb.item == SG_BUDGETITEM_NUM_DRAWS);
+    T(budget_cb.user_data == (void*)0xABCD);
+    T(budget_cb.state.exceeded);
+    T(budget_cb.state.num_draws_exceeded);
+    T(!budget_cb.state.num_passes_exceeded);
+    T(!budget_cb.state.upload_bytes_exceeded);
+    T(budget_cb.state.used.num_draws == 5);
+    T(budget_cb.state.budget.num_draws == 4);
+    // the callback is called again in the next frame
+    T(draw_with_uniforms(pip, vbuf, 4) == 4);
+    T(budget_cb.num_called == 1);
+    T(draw_with_uniforms(pip, vbuf, 5) == 5);
+    T(budget_cb.num_called == 2);
+    sg_shutdown();
+}
+
+UTEST(sokol_gfx, budget_passes_exceeded) {
+    setup_with_budget(&(sg_frame_budget){ .num_passes = 1 });
+    for (int i = 0; i < 3; i++) {
+        sg_begin_pass(&(sg_pass){ .swapchain = { .width = 256, .height = 128, .sample_count = 1 } });
+        sg_end_pass();
+    }
+    T(budget_cb.num_called == 1);
+    T(budget_cb.item == SG_BUDGETITEM_NUM_PASSES);
+    T(budget_cb.state.used.num_passes == 2);
+    const sg_budget_state state = sg_query_budget_state();
+    T(state.exceeded);
+    T(state.num_passes_exceeded);
+    T(state.used.num_passes == 3);
+    sg_commit();
+    T(!sg_query_budget_state().exceeded);
+    // a pass which fails validation isn't counted
+    sg_begin_pass(&(sg_pass){ .swapchain = { .width = 0, .height = 128, .sample_count = 1 } });
+    sg_end_pass();
+    T(log_items[0] == SG_LOGITEM_VALIDATE_BEGINPASS_SWAPCHAIN_EXPECT_WIDTH);
+    T(sg_query_budget_state().used.num_passes == 0);
+    sg_shutdown();
+}
+
+UTEST(sokol_gfx, budget_upload_bytes) {
+    setup_with_budget(&(sg_frame_budget){ .upload_bytes = 1024 });
+    static uint8_t data[512];
+    sg_buffer dyn_buf = sg_make_buffer(&(sg_buffer_desc){ .usage.dynamic_update = true, .size = sizeof(data) });
+    sg_buffer stream_buf = sg_make_buffer(&(sg_buffer_desc){ .usage.stream_update = true, .size = 4 * sizeof(data) });
+    sg_image img = sg_make_image(&(sg_image_desc){ .usage.region_update = true, .width = 64, .height = 32 });
+    sg_update_buffer(dyn_buf, &SG_RANGE(data));
+    T(sg_query_budget_state().used.upload_bytes == 512);
+    T(!sg_query_budget_will_exceed(&(sg_frame_budget){ .upload_bytes = 512 }));
+    T(sg_query_budget_will_exceed(&(sg_frame_budget){ .upload_bytes = 513 }));
+    sg_append_buffer(stream_buf, &SG_RANGE(data));
+    T(sg_query_budget_state().used.upload_bytes == 1024);
+    T(budget_cb.num_called == 0);
+    static uint32_t pixels[8 * 4];
+    sg_update_image_region(&(sg_write_image_desc){
+        .src.data = SG_RANGE(pixels),
+        .dst.image = img,
+        .size = { .width = 8, .height = 4 },
+    });
+    T(budget_cb.num_called == 1);
+    T(budget_cb.item == SG_BUDGETITEM_UPLOAD_BYTES);
+    T(budget_cb.state.used.upload_bytes == 1024 + sizeof(pixels));
+    T(budget_cb.state.upload_bytes_exceeded);
+    sg_commit();
+    T(sg_query_budget_state().used.upload_bytes == 0);
+    // a failed update isn't counted
+    sg_update_image_region(&(sg_write_image_desc){
+        .src.data = SG_RANGE(pixels),
+        .dst = { .image = img, .x = 60 },
+        .size = { .width = 8, .height = 4 },
+    });
+    T(sg_query_budget_state().used.upload_bytes == 0);
+    sg_shutdown();
+}
+
+UTEST(sokol_gfx, set_frame_budget) {
+    setup_with_budget(&(sg_frame_budget){0});
+    sg_pipeline pip = create_uniforms_pipeline();
+    sg_buffer vbuf = create_buffer();
+    T(draw_with_uniforms(pip, vbuf, 8) == 8);
+    T(budget_cb.num_called == 0);
+    sg_set_frame_budget(&(sg_frame_budget){ .num_draws = 4 });
+    T(sg_query_budget_state().budget.num_draws == 4);
+    T(sg_query_budget_will_exceed(&(sg_frame_budget){ .num_draws = 5 }));
+    T(draw_with_uniforms(pip, vbuf, 8) == 8);
+    T(budget_cb.num_called == 1);
+    sg_shutdown();
+}
+
+static void begin_swapchain_pass(void) {
+    sg_begin_pass(&(sg_pass){
+        .swapchain = {
+            .width = 256,
+            .height = 128,
+            .sample_count = 1,
+            .color_format = SG_PIXELFORMAT_RGBA8,
+            .depth_format = SG_PIXELFORMAT_DEPTH_STENCIL,
+        },
+    });
+}
+
+static void record_command_list(sg_command_list list, sg_pipeline pip, sg_buffer vbuf, int num_draws) {
+    static const float uniforms[4] = { 0 };
+    sg_begin_command_list(list);
+    sg_cmd_apply_viewport(list, 0, 0, 256, 128, true);
+    sg_cmd_apply_pipeline(list, pip);
+    sg_cmd_apply_bindings(list, &(sg_bindings){ .vertex_buffers[0] = vbuf });
+    sg_cmd_apply_uniforms(list, 0, &SG_RANGE(uniforms));
+    for (int i = 0; i < num_draws; i++) {
+        sg_cmd_draw(list, 0, 3, 1);
+    }
+    sg_end_command_list(list);
+}
+
+UTEST(sokol_gfx, command_list_make_destroy) {
+    setup(&(sg_desc){0});
+    T(sg_query_desc().command_list_pool_size == _SG_DEFAULT_COMMAND_LIST_POOL_SIZE);
+    sg_command_list list = sg_make_command_list(&(sg_command_list_desc){0});
+    T(list.id != SG_INVALID_ID);
+    sg_command_list_info info = sg_query_command_list_info(list);
+    T(info.size == _SG_DEFAULT_COMMAND_LIST_SIZE);
+    T(info.used_bytes == 0);
+    T(info.num_commands == 0);
+    T(!info.recording);
+    T(!info.overflow);
+    sg_destroy_command_list(list);
+    T(0 == _sg_lookup_command_list(list.id));
+    info = sg_query_command_list_info(list);
+    T(info.size == 0);
+    sg_shutdown();
+}
+
+UTEST(sokol_gfx, command_list_pool_exhausted) {
+    setup(&(sg_desc){ .command_list_pool_size = 1 });
+    sg_command_list l0 = sg_make_command_list(&(sg_command_list_desc){ .size = 1024 });
+    T(l0.id != SG_INVALID_ID);
+    T(sg_query_command_list_info(l0).size == 1024);
+    sg_command_list l1 = sg_make_command_list(&(sg_command_list_desc){0});
+    T(l1.id == SG_INVALID_ID);
+    T(log_items[0] == SG_LOGITEM_COMMAND_LIST_POOL_EXHAUSTED);
+    sg_destroy_command_list(l0);
+    sg_command_list l2 = sg_make_command_list(&(sg_command_list_desc){0});
+    T(l2.id != SG_INVALID_ID);
+    T(l2.id != l0.id);
+    sg_shutdown();
+}
+
+UTEST(sokol_gfx, command_list_record_execute) {
+    setup(&(sg_desc){0});
+    sg_pipeline pip = create_uniforms_pipeline();
+    sg_buffer vbuf = create_buffer();
+    sg_command_list lists[2] = {
+        sg_make_command_list(&(sg_command_list_desc){0}),
+        sg_make_command_list(&(sg_command_list_desc){0}),
+    };
+    record_command_list(lists[0], pip, vbuf, 3);
+    record_command_list(lists[1], pip, vbuf, 2);
+    // no-op draws are not recorded
+    sg_begin_command_list(lists[1]);
+    sg_cmd_apply_pipeline(lists[1], pip);
+    sg_cmd_draw(lists[1], 0, 0, 1);
+    sg_end_command_list(lists[1]);
+    T(sg_query_command_list_info(lists[1]).num_commands == 1);
+    record_command_list(lists[1], pip, vbuf, 2);
+    const sg_command_list_info info = sg_query_command_list_info(lists[0]);
+    T(info.num_commands == 7);
+    T(info.used_bytes > 0);
+    T((info.used_bytes % 8) == 0);
+    T(!info.recording);
+    T(num_log_called == 0);
+    // replayed commands are counted like regular calls
+    begin_swapchain_pass();
+    sg_execute_command_lists(lists, 2);
+    T(_sg.next_draw_valid);
+    T(sg_query_budget_state().used.num_draws == 5);
+    // a recorded command list can be replayed multiple times
+    sg_execute_command_lists(lists, 1);
+    T(sg_query_budget_state().used.num_draws == 8);
+    sg_end_pass();
+    T(_sg.stats.cur_frame.num_draw == 8);
+    T(_sg.stats.cur_frame.num_apply_pipeline == 3);
+    T(_sg.stats.cur_frame.num_apply_uniforms == 3);
+    T(_sg.stats.cur_frame.size_apply_uniforms == 3 * 16);
+    sg_commit();
+    T(num_log_called == 0);
+    sg_shutdown();
+}
+
+UTEST(sokol_gfx, command_list_record_time_validation) {
+    setup(&(sg_desc){0});
+    sg_pipeline pip = create_uniforms_pipeline();
+    sg_buffer vbuf = create_buffer();
+    sg_command_list list = sg_make_command_list(&(sg_command_list_desc){0});
+    static const float uniforms[8] = { 0 };
+    sg_begin_command_list(list);
+    // draw state commands require a pipeline
+    sg_cmd_apply_bindings(list, &(sg_bindings){ .vertex_buffers[0] = vbuf });
+    T(log_items[0] == SG_LOGITEM_COMMAND_LIST_NO_PIPELINE);
+    // an invalid pipeline drops the following commands without logging more errors
+    sg_cmd_apply_pipeline(list, (sg_pipeline){ SG_INVALID_ID });
+    T(log_items[1] == SG_LOGITEM_COMMAND_LIST_PIPELINE_VALID);
+    sg_cmd_apply_bindings(list, &(sg_bindings){ .vertex_buffers[0] = vbuf });
+    sg_cmd_draw(list, 0, 3, 1);
+    T(num_log_called == 2);
+    // missing vertex buffer
+    sg_cmd_apply_pipeline(list, pip);
+    sg_cmd_apply_bindings(list, &(sg_bindings){0});
+    T(log_items[2] == SG_LOGITEM_COMMAND_LIST_BINDINGS_VALID);
+    sg_cmd_draw(list, 0, 3, 1);
+    T(num_log_called == 3);
+    // uniform data size mismatch
+    sg_cmd_apply_pipeline(list, pip);
+    sg_cmd_apply_bindings(list, &(sg_bindings){ .vertex_buffers[0] = vbuf });
+    sg_cmd_apply_uniforms(list, 0, &SG_RANGE(uniforms));
+    T(log_items[3] == SG_LOGITEM_COMMAND_LIST_UNIFORMS_SIZE);
+    sg_cmd_apply_uniforms(list, 1, &(sg_range){ uniforms, 16 });
+    sg_cmd_draw(list, 0, 3, 1);
+    T(num_log_called == 4);
+    sg_end_command_list(list);
+    // only the valid pipeline and bindings commands were recorded
+    T(sg_query_command_list_info(list).num_commands == 3);
+    sg_shutdown();
+}
+
+UTEST(sokol_gfx, command_list_recording_state) {
+    setup(&(sg_desc){0});
+    sg_pipeline pip = create_uniforms_pipeline();
+    sg_command_list list = sg_make_command_list(&(sg_command_list_desc){0});
+    sg_cmd_apply_pipeline(list, pip);
+    T(log_items[0] == SG_LOGITEM_COMMAND_LIST_NOT_RECORDING);
+    sg_end_command_list(list);
+    T(log_items[1] == SG_LOGITEM_COMMAND_LIST_NOT_RECORDING);
+    sg_begin_command_list(list);
+    sg_begin_command_list(list);
+    T(log_items[2] == SG_LOGITEM_COMMAND_LIST_ALREADY_RECORDING);
+    T(sg_query_command_list_info(list).recording);
+    reset_log_items();
+    // a command list can't be executed while recording
+    begin_swapchain_pass();
+    sg_execute_command_lists(&list, 1);
+    T(log_items[0] == SG_LOGITEM_VALIDATE_EXECCMDLISTS_LIST_RECORDING);
+    T(log_items[1] == SG_LOGITEM_VALIDATION_FAILED);
+    sg_end_pass();
+    // ...and only inside a render pass
+    sg_end_command_list(list);
+    reset_log_items();
+    sg_execute_command_lists(&list, 1);
+    T(log_items[0] == SG_LOGITEM_VALIDATE_EXECCMDLISTS_RENDERPASS);
+    sg_destroy_command_list(list);
+    reset_log_items();
+    sg_begin_command_list(list);
+    T(log_items[0] == SG_LOGITEM_COMMAND_LIST_ALIVE);
+    sg_shutdown();
+}
+
+UTEST(sokol_gfx, command_list_overflow) {
+    setup(&(sg_desc){0});
+    sg_pipeline pip = create_pipeline();
+    sg_buffer vbuf = create_buffer();
+    // room for the pipeline, bindings and a single draw command
+    const size_t size = 16 + ((8 + sizeof(sg_bindings) + 7) & ~(size_t)7) + 32 + 16;
+    sg_command_list list = sg_make_command_list(&(sg_command_list_desc){ .size = size });
+    sg_begin_command_list(list);
+    sg_cmd_apply_pipeline(list, pip);
+    sg_cmd_apply_bindings(list, &(sg_bindings){ .vertex_buffers[0] = vbuf });
+    for (int i = 0; i < 8; i++) {
+        sg_cmd_draw(list, 0, 3, 1);
+    }
+    sg_end_command_list(list);
+    // only a single error is logged
+    T(num_log_called == 1);
+    T(log_items[0] == SG_LOGITEM_COMMAND_LIST_OVERFLOW);
+    sg_command_list_info info = sg_query_command_list_info(list);
+    T(info.overflow);
+    T(info.num_commands == 3);
+    T(info.used_bytes == size - 16);
+    // the recorded commands can still be executed
+    reset_log_items();
+    begin_swapchain_pass();
+    sg_execute_command_lists(&list, 1);
+    sg_end_pass();
+    T(num_log_called == 0);
+    T(sg_query_budget_state().used.num_draws == 1);
+    // sg_begin_command_list() resets the overflow state
+    sg_begin_command_list(list);
+    info = sg_query_command_list_info(list);
+    T(!info.overflow);
+    T(info.num_commands == 0);
+    sg_shutdown();
+}
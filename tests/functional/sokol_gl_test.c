@@ -336,3 +336,1019 @@ UTEST(sokol_gl, default_context) {
     T(sgl_default_context().id == SGL_DEFAULT_CONTEXT.id);
     shutdown();
 }
+
+UTEST(sokol_gl, cpu_transform) {
+    sg_setup(&(sg_desc){0});
+    sgl_setup(&(sgl_desc_t){ .cpu_transform = true });
+    T(_sgl.cur_ctx->cpu_transform);
+    sgl_matrix_mode_projection();
+    sgl_ortho(0.0f, 2.0f, 0.0f, 2.0f, -1.0f, 1.0f);
+    sgl_matrix_mode_modelview();
+    for (int i = 0; i < 4; i++) {
+        sgl_push_matrix();
+        sgl_translate((float)i, 10.0f, 0.0f);
+        sgl_scale(2.0f, 2.0f, 1.0f);
+        sgl_begin_triangles();
+        sgl_v2f(0.0f, 0.0f);
+        sgl_v2f(1.0f, 0.0f);
+        sgl_v2f(1.0f, 1.0f);
+        sgl_end();
+        sgl_pop_matrix();
+    }
+    // modelview changes don't break batching
+    T(sgl_num_commands() == 1);
+    T(_sgl.cur_ctx->uniforms.next == 1);
+    T(_sgl.cur_ctx->commands.ptr[0].args.draw.num_vertices == 12);
+    const _sgl_vertex_t* vtx = _sgl.cur_ctx->vertices.ptr;
+    TFLT(vtx[3].pos[0], 1.0f, FLT_MIN);
+    TFLT(vtx[3].pos[1], 10.0f, FLT_MIN);
+    TFLT(vtx[11].pos[0], 5.0f, FLT_MIN);
+    TFLT(vtx[11].pos[1], 12.0f, FLT_MIN);
+    TFLT(vtx[11].pos[2], 0.0f, FLT_MIN);
+    // the uniform block only contains the projection matrix
+    const _sgl_matrix_t* mvp = &_sgl.cur_ctx->uniforms.ptr[0].mvp;
+    TFLT(mvp->v[0][0], 1.0f, FLT_MIN);
+    TFLT(mvp->v[3][0], -1.0f, FLT_MIN);
+    TFLT(mvp->v[3][1], -1.0f, FLT_MIN);
+    // ...but projection matrix changes still do
+    sgl_matrix_mode_projection();
+    sgl_load_identity();
+    sgl_begin_triangles();
+    sgl_v2f(0.0f, 0.0f);
+    sgl_v2f(1.0f, 0.0f);
+    sgl_v2f(1.0f, 1.0f);
+    sgl_end();
+    T(sgl_num_commands() == 2);
+    T(_sgl.cur_ctx->uniforms.next == 2);
+    // contexts without CPU-side transform are not affected
+    sgl_context ctx = sgl_make_context(&(sgl_context_desc_t){0});
+    sgl_set_context(ctx);
+    T(!_sgl.cur_ctx->cpu_transform);
+    for (int i = 0; i < 2; i++) {
+        sgl_translate(1.0f, 0.0f, 0.0f);
+        sgl_begin_triangles();
+        sgl_v2f(0.0f, 0.0f);
+        sgl_v2f(1.0f, 0.0f);
+        sgl_v2f(1.0f, 1.0f);
+        sgl_end();
+    }
+    T(sgl_num_commands() == 2);
+    TFLT(_sgl.cur_ctx->vertices.ptr[3].pos[0], 0.0f, FLT_MIN);
+    shutdown();
+}
+
+static int num_sg_errors;
+static void sg_error_logger(const char* tag, uint32_t log_level, uint32_t log_item_id, const char* message_or_null, uint32_t line_nr, const char* filename_or_null, void* user_data) {
+    (void)tag; (void)log_item_id; (void)message_or_null; (void)line_nr; (void)filename_or_null; (void)user_data;
+    if (log_level <= 1) {
+        num_sg_errors++;
+    }
+}
+
+UTEST(sokol_gl, indexed_quads) {
+    num_sg_errors = 0;
+    sg_setup(&(sg_desc){ .logger.func = sg_error_logger });
+    sgl_setup(&(sgl_desc_t){0});
+    T(_sgl.quad_ibuf.id != SG_INVALID_ID);
+    T(sg_query_buffer_size(_sgl.quad_ibuf) == _SGL_MAX_QUADS_PER_DRAW * 6 * sizeof(uint16_t));
+    // quads are recorded as 4 vertices and consecutive quads are merged
+    for (int i = 0; i < 3; i++) {
+        sgl_begin_quads();
+        sgl_v2f(0.0f, 0.0f);
+        sgl_v2f(1.0f, 0.0f);
+        sgl_v2f(1.0f, 1.0f);
+        sgl_v2f(0.0f, 1.0f);
+        sgl_end();
+    }
+    T(sgl_num_vertices() == 12);
+    T(sgl_num_commands() == 1);
+    T(_sgl.cur_ctx->commands.ptr[0].args.draw.quads);
+    T(_sgl.cur_ctx->commands.ptr[0].args.draw.num_vertices == 12);
+    TFLT(_sgl.cur_ctx->vertices.ptr[7].pos[1], 1.0f, FLT_MIN);
+    // an incomplete trailing quad is dropped
+    sgl_begin_quads();
+    sgl_v2f(0.0f, 0.0f);
+    sgl_v2f(1.0f, 0.0f);
+    sgl_v2f(1.0f, 1.0f);
+    sgl_v2f(0.0f, 1.0f);
+    sgl_v2f(2.0f, 2.0f);
+    sgl_end();
+    T(sgl_num_vertices() == 16);
+    T(_sgl.cur_ctx->commands.ptr[0].args.draw.num_vertices == 16);
+    // quads and triangles use different pipelines and aren't merged
+    sgl_begin_triangles();
+    sgl_v2f(0.0f, 0.0f);
+    sgl_v2f(1.0f, 0.0f);
+    sgl_v2f(1.0f, 1.0f);
+    sgl_end();
+    T(sgl_num_commands() == 2);
+    T(!_sgl.cur_ctx->commands.ptr[1].args.draw.quads);
+    sgl_begin_quads();
+    sgl_v2f(0.0f, 0.0f);
+    sgl_v2f(1.0f, 0.0f);
+    sgl_v2f(1.0f, 1.0f);
+    sgl_v2f(0.0f, 1.0f);
+    sgl_end();
+    T(sgl_num_commands() == 3);
+    T(_sgl.cur_ctx->commands.ptr[2].args.draw.base_vertex == 19);
+    // rendering switches between indexed and non-indexed bindings without errors
+    sg_begin_pass(&(sg_pass){ .swapchain = { .width = 256, .height = 128, .sample_count = 1 } });
+    sgl_draw();
+    sg_end_pass();
+    sg_commit();
+    T(num_sg_errors == 0);
+    const sg_frame_stats stats = sg_query_stats().prev_frame;
+    T(stats.num_draw == 1);
+    T(stats.num_draw_ex == 2);
+    T(stats.num_apply_bindings == 3);
+    T(stats.size_update_buffer == 23 * sizeof(_sgl_vertex_t));
+    shutdown();
+}
+
+UTEST(sokol_gl, indexed_quads_base_vertex) {
+    num_sg_errors = 0;
+    sg_setup(&(sg_desc){ .logger.func = sg_error_logger });
+    sgl_setup(&(sgl_desc_t){0});
+    T(sg_query_features().draw_base_vertex);
+    // quad commands which can't be merged because of matrix changes
+    for (int i = 0; i < 4; i++) {
+        sgl_translate(1.0f, 0.0f, 0.0f);
+        sgl_begin_quads();
+        sgl_v2f(0.0f, 0.0f);
+        sgl_v2f(1.0f, 0.0f);
+        sgl_v2f(1.0f, 1.0f);
+        sgl_v2f(0.0f, 1.0f);
+        sgl_end();
+    }
+    T(sgl_num_commands() == 4);
+    T(_sgl.cur_ctx->commands.ptr[3].args.draw.base_vertex == 12);
+    sg_begin_pass(&(sg_pass){ .swapchain = { .width = 256, .height = 128, .sample_count = 1 } });
+    sgl_draw();
+    sg_end_pass();
+    sg_commit();
+    T(num_sg_errors == 0);
+    // the bindings are applied once, the quads are selected via base vertex
+    const sg_frame_stats stats = sg_query_stats().prev_frame;
+    T(stats.num_draw_ex == 4);
+    T(stats.num_apply_bindings == 1);
+    T(_sgl.cur_ctx->bind.vertex_buffer_offsets[0] == 0);
+    shutdown();
+}
+
+static void draw_tri(void) {
+    sgl_begin_triangles();
+    sgl_v2f(0.0f, 0.0f);
+    sgl_v2f(1.0f, 0.0f);
+    sgl_v2f(1.0f, 1.0f);
+    sgl_end();
+}
+
+static void draw_line(void) {
+    sgl_begin_lines();
+    sgl_v2f(0.0f, 0.0f);
+    sgl_v2f(1.0f, 1.0f);
+    sgl_end();
+}
+
+UTEST(sokol_gl, layer_bucketing) {
+    num_sg_errors = 0;
+    sg_setup(&(sg_desc){ .logger.func = sg_error_logger });
+    sgl_setup(&(sgl_desc_t){0});
+    // commands recorded in ascending layer order don't need sorting
+    draw_tri();
+    sgl_layer(1);
+    draw_tri();
+    T(_sgl.cur_ctx->layers.in_order);
+    // going back to a lower layer requires sorting
+    sgl_layer(0);
+    draw_line();
+    sgl_layer(1);
+    draw_line();
+    T(!_sgl.cur_ctx->layers.in_order);
+    T(sgl_num_commands() == 4);
+    sg_begin_pass(&(sg_pass){ .swapchain = { .width = 256, .height = 128, .sample_count = 1 } });
+    sgl_draw_layer(0);
+    T(_sgl.cur_ctx->layers.valid);
+    T(_sgl.cur_ctx->layers.items[0].layer_id == 0);
+    T(_sgl.cur_ctx->layers.items[0].cmd_index == 0);
+    T(_sgl.cur_ctx->layers.items[1].layer_id == 0);
+    T(_sgl.cur_ctx->layers.items[1].cmd_index == 2);
+    T(_sgl.cur_ctx->layers.items[2].layer_id == 1);
+    T(_sgl.cur_ctx->layers.items[2].cmd_index == 1);
+    T(_sgl.cur_ctx->layers.items[3].layer_id == 1);
+    T(_sgl.cur_ctx->layers.items[3].cmd_index == 3);
+    sgl_draw_layer(1);
+    // an empty layer renders nothing
+    sgl_draw_layer(2);
+    sg_end_pass();
+    sg_commit();
+    T(num_sg_errors == 0);
+    const sg_frame_stats stats = sg_query_stats().prev_frame;
+    T(stats.num_draw == 4);
+    T(stats.num_apply_pipeline == 4);
+    shutdown();
+}
+
+UTEST(sokol_gl, layer_state_sorting) {
+    num_sg_errors = 0;
+    sg_setup(&(sg_desc){ .logger.func = sg_error_logger });
+    sgl_setup(&(sgl_desc_t){0});
+    draw_tri();
+    draw_line();
+    draw_tri();
+    draw_line();
+    // draw commands are never moved across viewport or scissor rect changes
+    sgl_viewport(0, 0, 64, 64, true);
+    draw_line();
+    draw_tri();
+    T(sgl_num_commands() == 7);
+    sg_begin_pass(&(sg_pass){ .swapchain = { .width = 256, .height = 128, .sample_count = 1 } });
+    sgl_draw_layer_sorted(0);
+    sg_end_pass();
+    sg_commit();
+    T(num_sg_errors == 0);
+    const _sgl_sort_item_t* items = _sgl.cur_ctx->layers.scratch;
+    const uint32_t pip_tris = _sgl.cur_ctx->commands.ptr[0].args.draw.pip.id;
+    const uint32_t pip_lines = _sgl.cur_ctx->commands.ptr[1].args.draw.pip.id;
+    T(pip_tris != pip_lines);
+    const int first_tri = (pip_tris < pip_lines) ? 0 : 1;
+    const int first_line = 1 - first_tri;
+    T(items[first_tri * 2 + 0].cmd_index == 0);
+    T(items[first_tri * 2 + 1].cmd_index == 2);
+    T(items[first_line * 2 + 0].cmd_index == 1);
+    T(items[first_line * 2 + 1].cmd_index == 3);
+    T(items[4].cmd_index == 4);
+    T(items[5].cmd_index == (first_tri == 0 ? 6 : 5));
+    T(items[6].cmd_index == (first_tri == 0 ? 5 : 6));
+    const sg_frame_stats stats = sg_query_stats().prev_frame;
+    T(stats.num_draw == 6);
+    T(stats.num_apply_pipeline == 4);
+    shutdown();
+}
+
+UTEST(sokol_gl, merge_window) {
+    num_sg_errors = 0;
+    sg_setup(&(sg_desc){ .logger.func = sg_error_logger });
+    sgl_setup(&(sgl_desc_t){ .merge_window = 4 });
+    T(_sgl.cur_ctx->merge.cap == _sgl.cur_ctx->commands.cap);
+    // interleaved triangles and lines are merged into two draw commands
+    for (int i = 0; i < 3; i++) {
+        sgl_begin_triangles();
+        sgl_v2f((float)i, 0.0f);
+        sgl_v2f((float)i, 1.0f);
+        sgl_v2f((float)i, 2.0f);
+        sgl_end();
+        draw_line();
+    }
+    T(sgl_num_vertices() == 15);
+    T(sgl_num_commands() == 2);
+    T(_sgl.cur_ctx->commands.ptr[0].args.draw.num_vertices == 9);
+    T(_sgl.cur_ctx->commands.ptr[1].args.draw.num_vertices == 6);
+    T(_sgl.cur_ctx->merge.next == 6);
+    // a viewport change stops the look-back
+    sgl_viewport(0, 0, 64, 64, true);
+    draw_tri();
+    T(sgl_num_commands() == 4);
+    // ...but the new draw command is merged with directly following vertices
+    draw_tri();
+    T(sgl_num_commands() == 4);
+    T(_sgl.cur_ctx->commands.ptr[3].args.draw.first_range == -1);
+    T(_sgl.cur_ctx->commands.ptr[3].args.draw.num_vertices == 6);
+    sg_begin_pass(&(sg_pass){ .swapchain = { .width = 256, .height = 128, .sample_count = 1 } });
+    sgl_draw();
+    sg_end_pass();
+    // vertices have been gathered into contiguous per-command ranges
+    const _sgl_command_t* cmds = _sgl.cur_ctx->commands.ptr;
+    T(cmds[0].args.draw.base_vertex == 0);
+    T(cmds[0].args.draw.first_range == -1);
+    T(cmds[1].args.draw.base_vertex == 9);
+    T(cmds[3].args.draw.base_vertex == 15);
+    const _sgl_vertex_t* v = _sgl.cur_ctx->merge.vertices;
+    for (int i = 0; i < 3; i++) {
+        TFLT(v[i * 3 + 0].pos[0], (float)i, FLT_MIN);
+        TFLT(v[i * 3 + 2].pos[1], 2.0f, FLT_MIN);
+    }
+    TFLT(v[10].pos[1], 1.0f, FLT_MIN);
+    T(_sgl.cur_ctx->merge.next == 0);
+    sg_commit();
+    T(num_sg_errors == 0);
+    const sg_frame_stats stats = sg_query_stats().prev_frame;
+    T(stats.num_draw == 3);
+    T(stats.size_update_buffer == 21 * sizeof(_sgl_vertex_t));
+    shutdown();
+}
+
+UTEST(sokol_gl, no_merge_window) {
+    sg_setup(&(sg_desc){0});
+    sgl_setup(&(sgl_desc_t){0});
+    T(_sgl.cur_ctx->merge.cap == 0);
+    T(_sgl.cur_ctx->merge.ranges == 0);
+    draw_tri();
+    draw_line();
+    draw_tri();
+    T(sgl_num_commands() == 3);
+    shutdown();
+}
+
+UTEST(sokol_gl, bulk_vertices) {
+    init();
+    // non-interleaved 2D positions, texcoords and colors
+    const float pos[3][2] = { { 1.0f, 2.0f }, { 3.0f, 4.0f }, { 5.0f, 6.0f } };
+    const float uv[3][2] = { { 0.0f, 0.5f }, { 1.0f, 0.5f }, { 0.5f, 1.0f } };
+    const uint32_t colors[3] = { 0xFF0000FF, 0xFF00FF00, 0xFFFF0000 };
+    sgl_point_size(2.0f);
+    sgl_begin_triangles();
+    sgl_vertices(&(sgl_vertex_desc_t){
+        .pos = { .ptr = pos },
+        .pos_components = 2,
+        .uv = { .ptr = uv },
+        .color = { .ptr = colors },
+    }, 3);
+    sgl_end();
+    T(sgl_num_vertices() == 3);
+    T(sgl_num_commands() == 1);
+    const _sgl_vertex_t* v = _sgl.cur_ctx->vertices.ptr;
+    TFLT(v[1].pos[0], 3.0f, FLT_MIN);
+    TFLT(v[1].pos[1], 4.0f, FLT_MIN);
+    TFLT(v[1].pos[2], 0.0f, FLT_MIN);
+    TFLT(v[2].uv[0], 0.5f, FLT_MIN);
+    TFLT(v[2].uv[1], 1.0f, FLT_MIN);
+    T(v[2].rgba == 0xFFFF0000);
+    TFLT(v[0].psize, 2.0f, FLT_MIN);
+    // interleaved 3D positions with missing texcoords and colors
+    typedef struct { float x, y, z; uint32_t rgba; } vertex_t;
+    const vertex_t verts[2] = { { 1.0f, 2.0f, 3.0f, 0x12345678 }, { 4.0f, 5.0f, 6.0f, 0x12345678 } };
+    sgl_t2f(0.25f, 0.75f);
+    sgl_c1i(0xAABBCCDD);
+    sgl_begin_lines();
+    sgl_vertices(&(sgl_vertex_desc_t){ .pos = { .ptr = verts, .stride = sizeof(vertex_t) } }, 2);
+    sgl_end();
+    T(sgl_num_vertices() == 5);
+    TFLT(v[4].pos[0], 4.0f, FLT_MIN);
+    TFLT(v[4].pos[2], 6.0f, FLT_MIN);
+    TFLT(v[4].uv[0], 0.25f, FLT_MIN);
+    TFLT(v[4].uv[1], 0.75f, FLT_MIN);
+    T(v[4].rgba == 0xAABBCCDD);
+    // zero vertices is a no-op
+    sgl_begin_lines();
+    sgl_vertices(&(sgl_vertex_desc_t){ .pos = { .ptr = verts } }, 0);
+    sgl_end();
+    T(sgl_num_vertices() == 5);
+    T(!sgl_error().any);
+    shutdown();
+}
+
+UTEST(sokol_gl, bulk_vertices_packed_matches_strided) {
+    init();
+    // tightly packed streams take the single-pass fast path, interleaved
+    // streams the per-component path, both must record the same vertices
+    typedef struct { float x, y, z, u, v; uint32_t rgba; } vertex_t;
+    vertex_t verts[5];
+    float pos[5][3];
+    float uv[5][2];
+    uint32_t colors[5];
+    for (int i = 0; i < 5; i++) {
+        const float f = (float)i;
+        verts[i] = (vertex_t){ f, f + 0.5f, -f, f * 0.25f, 1.0f - f * 0.25f, 0xFF000000 | (uint32_t)i };
+        pos[i][0] = verts[i].x; pos[i][1] = verts[i].y; pos[i][2] = verts[i].z;
+        uv[i][0] = verts[i].u; uv[i][1] = verts[i].v;
+        colors[i] = verts[i].rgba;
+    }
+    sgl_point_size(3.0f);
+    sgl_begin_triangles();
+    sgl_vertices(&(sgl_vertex_desc_t){ .pos.ptr = pos, .uv.ptr = uv, .color.ptr = colors }, 5);
+    sgl_vertices(&(sgl_vertex_desc_t){
+        .pos = { .ptr = &verts[0].x, .stride = sizeof(vertex_t) },
+        .uv = { .ptr = &verts[0].u, .stride = sizeof(vertex_t) },
+        .color = { .ptr = &verts[0].rgba, .stride = sizeof(vertex_t) },
+    }, 5);
+    sgl_end();
+    // missing texcoords and colors, and a single vertex
+    sgl_t2f(0.25f, 0.75f);
+    sgl_c1i(0xAABBCCDD);
+    sgl_begin_points();
+    sgl_vertices(&(sgl_vertex_desc_t){ .pos.ptr = pos }, 1);
+    sgl_vertices(&(sgl_vertex_desc_t){ .pos = { .ptr = &verts[0].x, .stride = sizeof(vertex_t) } }, 1);
+    sgl_end();
+    T(sgl_num_vertices() == 12);
+    const _sgl_vertex_t* v = _sgl.cur_ctx->vertices.ptr;
+    T(0 == memcmp(&v[0], &v[5], 5 * sizeof(_sgl_vertex_t)));
+    T(0 == memcmp(&v[10], &v[11], sizeof(_sgl_vertex_t)));
+    TFLT(v[4].pos[2], -4.0f, FLT_MIN);
+    TFLT(v[4].uv[1], 0.0f, FLT_MIN);
+    T(v[4].rgba == 0xFF000004);
+    TFLT(v[4].psize, 3.0f, FLT_MIN);
+    TFLT(v[10].uv[0], 0.25f, FLT_MIN);
+    T(v[10].rgba == 0xAABBCCDD);
+    T(!sgl_error().any);
+    shutdown();
+}
+
+UTEST(sokol_gl, bulk_vertices_cpu_transform) {
+    sg_setup(&(sg_desc){0});
+    sgl_setup(&(sgl_desc_t){ .cpu_transform = true });
+    const float pos[2][3] = { { 1.0f, 2.0f, 3.0f }, { 4.0f, 5.0f, 6.0f } };
+    sgl_translate(10.0f, 20.0f, 30.0f);
+    sgl_begin_lines();
+    sgl_vertices(&(sgl_vertex_desc_t){ .pos = { .ptr = pos } }, 2);
+    sgl_end();
+    const _sgl_vertex_t* v = _sgl.cur_ctx->vertices.ptr;
+    TFLT(v[0].pos[0], 11.0f, FLT_MIN);
+    TFLT(v[1].pos[1], 25.0f, FLT_MIN);
+    TFLT(v[1].pos[2], 36.0f, FLT_MIN);
+    shutdown();
+}
+
+UTEST(sokol_gl, bulk_vertices_full) {
+    sg_setup(&(sg_desc){0});
+    sgl_setup(&(sgl_desc_t){ .max_vertices = 4 });
+    const float pos[6][2] = { {0} };
+    sgl_begin_triangles();
+    sgl_vertices(&(sgl_vertex_desc_t){ .pos = { .ptr = pos }, .pos_components = 2 }, 6);
+    sgl_end();
+    // vertices are written completely or not at all
+    T(sgl_num_vertices() == 0);
+    T(sgl_num_commands() == 0);
+    T(sgl_error().vertices_full);
+    T(sgl_error().any);
+    shutdown();
+}
+
+UTEST(sokol_gl, query_stats) {
+    init();
+    sgl_stats_t stats = sgl_query_stats();
+    T(stats.max_vertices == _SGL_DEFAULT_MAX_VERTICES);
+    T(stats.max_uniforms == _SGL_DEFAULT_MAX_COMMANDS);
+    T(stats.max_commands == _SGL_DEFAULT_MAX_COMMANDS);
+    T(stats.peak_vertices == 0);
+    T(stats.peak_commands == 0);
+    T(stats.num_grows == 0);
+    draw_tri();
+    draw_line();
+    stats = sgl_query_stats();
+    T(stats.peak_vertices == 5);
+    T(stats.peak_uniforms == 1);
+    T(stats.peak_commands == 2);
+    // high-water marks survive the frame boundary
+    sg_commit();
+    T(sgl_num_vertices() == 0);
+    draw_tri();
+    stats = sgl_context_query_stats(SGL_DEFAULT_CONTEXT);
+    T(stats.peak_vertices == 5);
+    T(stats.peak_commands == 2);
+    shutdown();
+}
+
+UTEST(sokol_gl, auto_grow) {
+    num_sg_errors = 0;
+    sg_setup(&(sg_desc){ .logger.func = sg_error_logger });
+    sgl_setup(&(sgl_desc_t){ .max_vertices = 4, .max_commands = 2, .merge_window = 2, .auto_grow = true });
+    const sg_buffer vbuf = _sgl.cur_ctx->vbuf;
+    for (int i = 0; i < 3; i++) {
+        draw_tri();
+        sgl_translate(1.0f, 0.0f, 0.0f);
+        draw_line();
+    }
+    const float pos[20][2] = { {0} };
+    sgl_begin_lines();
+    sgl_vertices(&(sgl_vertex_desc_t){ .pos = { .ptr = pos }, .pos_components = 2 }, 20);
+    sgl_end();
+    T(!sgl_error().any);
+    T(sgl_num_vertices() == 35);
+    T(sgl_num_commands() == 6);
+    sgl_stats_t stats = sgl_query_stats();
+    T(stats.max_vertices == 64);
+    T(stats.max_uniforms == 4);
+    T(stats.max_commands == 8);
+    T(stats.peak_vertices == 35);
+    T(stats.num_grows == 6);
+    T(_sgl.cur_ctx->merge.cap == 8);
+    T(_sgl.cur_ctx->vbuf_cap == 4);
+    // the vertex buffer is recreated with the new capacity in sgl_draw()
+    sg_begin_pass(&(sg_pass){ .swapchain = { .width = 256, .height = 128, .sample_count = 1 } });
+    sgl_draw();
+    sg_end_pass();
+    sg_commit();
+    T(num_sg_errors == 0);
+    T(_sgl.cur_ctx->vbuf.id != vbuf.id);
+    T(_sgl.cur_ctx->vbuf_cap == 64);
+    T(sg_query_buffer_state(vbuf) == SG_RESOURCESTATE_INVALID);
+    T(sg_query_buffer_size(_sgl.cur_ctx->vbuf) == 64 * sizeof(_sgl_vertex_t));
+    T(sg_query_stats().prev_frame.size_update_buffer == 35 * sizeof(_sgl_vertex_t));
+    // without auto_grow, geometry is dropped
+    sgl_shutdown();
+    sgl_setup(&(sgl_desc_t){ .max_vertices = 4 });
+    draw_tri();
+    draw_tri();
+    T(sgl_error().vertices_full);
+    T(sgl_query_stats().num_grows == 0);
+    shutdown();
+}
+
+UTEST(sokol_gl, display_list) {
+    num_sg_errors = 0;
+    sg_setup(&(sg_desc){ .logger.func = sg_error_logger });
+    sgl_setup(&(sgl_desc_t){0});
+    draw_line();
+    sgl_begin_display_list();
+    draw_tri();
+    sgl_begin_quads();
+    sgl_v2f(0.0f, 0.0f);
+    sgl_v2f(1.0f, 0.0f);
+    sgl_v2f(1.0f, 1.0f);
+    sgl_v2f(0.0f, 1.0f);
+    sgl_end();
+    const sgl_display_list list = sgl_end_display_list();
+    T(list.id != SG_INVALID_ID);
+    // the display list content isn't rendered in the current frame
+    T(sgl_num_vertices() == 2);
+    T(sgl_num_commands() == 1);
+    const _sgl_display_list_t* dl = _sgl_lookup_display_list(list.id);
+    T(dl);
+    T(dl->ctx_id == SGL_DEFAULT_CONTEXT.id);
+    T(dl->num_vertices == 7);
+    T(dl->num_commands == 2);
+    T(dl->commands[1].args.draw.base_vertex == 3);
+    T(sg_query_buffer_state(dl->vbuf) == SG_RESOURCESTATE_VALID);
+    T(sg_query_buffer_usage(dl->vbuf).immutable);
+    // calling a display list records a single command
+    sgl_call_display_list(list);
+    draw_line();
+    T(sgl_num_vertices() == 4);
+    T(sgl_num_commands() == 3);
+    T(_sgl.cur_ctx->commands.ptr[1].cmd == SGL_COMMAND_DISPLAY_LIST);
+    sg_begin_pass(&(sg_pass){ .swapchain = { .width = 256, .height = 128, .sample_count = 1 } });
+    sgl_draw();
+    sg_end_pass();
+    sg_commit();
+    T(num_sg_errors == 0);
+    sg_frame_stats stats = sg_query_stats().prev_frame;
+    T(stats.num_draw == 3);
+    T(stats.num_draw_ex == 1);
+    T(stats.num_apply_bindings == 4);
+    T(stats.size_update_buffer == 4 * sizeof(_sgl_vertex_t));
+    // a frame which only calls a display list doesn't upload any vertices
+    sgl_translate(1.0f, 0.0f, 0.0f);
+    sgl_call_display_list(list);
+    T(sgl_num_vertices() == 0);
+    TFLT(_sgl.cur_ctx->uniforms.ptr[0].mvp.v[3][0], 1.0f, FLT_MIN);
+    sg_begin_pass(&(sg_pass){ .swapchain = { .width = 256, .height = 128, .sample_count = 1 } });
+    sgl_draw();
+    sg_end_pass();
+    sg_commit();
+    T(num_sg_errors == 0);
+    stats = sg_query_stats().prev_frame;
+    T(stats.num_draw == 1);
+    T(stats.num_draw_ex == 1);
+    T(stats.num_update_buffer == 0);
+    // destroyed display lists are skipped
+    sgl_call_display_list(list);
+    sgl_destroy_display_list(list);
+    T(sg_query_buffer_state(dl->vbuf) == SG_RESOURCESTATE_INVALID);
+    T(_sgl_lookup_display_list(list.id) == 0);
+    sg_begin_pass(&(sg_pass){ .swapchain = { .width = 256, .height = 128, .sample_count = 1 } });
+    sgl_draw();
+    sg_end_pass();
+    sg_commit();
+    T(sg_query_stats().prev_frame.num_draw == 0);
+    shutdown();
+}
+
+UTEST(sokol_gl, display_list_cpu_transform) {
+    sg_setup(&(sg_desc){0});
+    sgl_setup(&(sgl_desc_t){ .cpu_transform = true });
+    sgl_translate(10.0f, 0.0f, 0.0f);
+    sgl_begin_display_list();
+    draw_tri();
+    const sgl_display_list list = sgl_end_display_list();
+    T(_sgl.cur_ctx->cpu_transform);
+    // vertices in display lists are not transformed on the CPU...
+    sg_buffer vbuf = _sgl_lookup_display_list(list.id)->vbuf;
+    T(sg_query_buffer_size(vbuf) == 3 * sizeof(_sgl_vertex_t));
+    // ...instead the display list gets its own uniform block with the modelview matrix
+    draw_tri();
+    sgl_call_display_list(list);
+    draw_tri();
+    T(sgl_num_commands() == 3);
+    T(_sgl.cur_ctx->uniforms.next == 3);
+    TFLT(_sgl.cur_ctx->uniforms.ptr[0].mvp.v[3][0], 0.0f, FLT_MIN);
+    TFLT(_sgl.cur_ctx->uniforms.ptr[1].mvp.v[3][0], 10.0f, FLT_MIN);
+    TFLT(_sgl.cur_ctx->uniforms.ptr[2].mvp.v[3][0], 0.0f, FLT_MIN);
+    TFLT(_sgl.cur_ctx->vertices.ptr[0].pos[0], 10.0f, FLT_MIN);
+    shutdown();
+}
+
+UTEST(sokol_gl, display_list_context) {
+    sg_setup(&(sg_desc){0});
+    sgl_setup(&(sgl_desc_t){ .display_list_pool_size = 2 });
+    sgl_context ctx = sgl_make_context(&(sgl_context_desc_t){0});
+    sgl_set_context(ctx);
+    sgl_begin_display_list();
+    draw_tri();
+    const sgl_display_list list0 = sgl_end_display_list();
+    // an empty display list is valid
+    sgl_begin_display_list();
+    const sgl_display_list list1 = sgl_end_display_list();
+    T(list1.id != SG_INVALID_ID);
+    T(_sgl_lookup_display_list(list1.id)->vbuf.id == SG_INVALID_ID);
+    // display list pool exhausted
+    sgl_begin_display_list();
+    T(sgl_end_display_list().id == SG_INVALID_ID);
+    // display lists can only be called in their own context
+    sgl_set_context(SGL_DEFAULT_CONTEXT);
+    sgl_call_display_list(list0);
+    T(sgl_num_commands() == 0);
+    // destroying a context destroys its display lists
+    sgl_destroy_context(ctx);
+    T(_sgl_lookup_display_list(list0.id) == 0);
+    T(_sgl_lookup_display_list(list1.id) == 0);
+    shutdown();
+}
+
+UTEST(sokol_gl, display_list_no_merge_into_frame) {
+    sg_setup(&(sg_desc){0});
+    sgl_setup(&(sgl_desc_t){ .merge_window = 4 });
+    draw_tri();
+    draw_line();
+    sgl_begin_display_list();
+    // identical state as the frame's draw commands, but must not be merged
+    draw_line();
+    draw_tri();
+    draw_line();
+    const sgl_display_list list = sgl_end_display_list();
+    T(sgl_num_vertices() == 5);
+    T(_sgl.cur_ctx->commands.ptr[0].args.draw.num_vertices == 3);
+    T(_sgl.cur_ctx->commands.ptr[1].args.draw.num_vertices == 2);
+    T(_sgl.cur_ctx->merge.next == 0);
+    const _sgl_display_list_t* dl = _sgl_lookup_display_list(list.id);
+    T(dl->num_commands == 2);
+    T(dl->num_vertices == 7);
+    T(dl->commands[0].args.draw.num_vertices == 4);
+    T(dl->commands[0].args.draw.first_range == -1);
+    T(dl->commands[1].args.draw.base_vertex == 4);
+    shutdown();
+}
+
+UTEST(sokol_gl, compact_vertex_layout) {
+    num_sg_errors = 0;
+    sg_setup(&(sg_desc){ .logger.func = sg_error_logger });
+    sgl_setup(&(sgl_desc_t){ .max_vertices = 64, .vertex_layout = SGL_VERTEXLAYOUT_COMPACT_2D });
+    T(sizeof(_sgl_compact_vertex_t) == 16);
+    T(_sgl.cur_ctx->desc.vertex_layout == SGL_VERTEXLAYOUT_COMPACT_2D);
+    T(_sgl.cur_ctx->vertex_size == 16);
+    T(_sgl.cur_ctx->compact_vertices != 0);
+    T(sg_query_buffer_size(_sgl.cur_ctx->vbuf) == 64 * 16);
+    T(_sgl.cur_ctx->bind.vertex_buffers[1].id == SG_INVALID_ID);
+    const _sgl_pipeline_t* pip = _sgl_lookup_pipeline(_sgl.cur_ctx->def_pip.id);
+    T(sg_query_pipeline_desc(pip->pip[SGL_PRIMITIVETYPE_TRIANGLES]).shader.id == _sgl.shd_compact.id);
+    draw_tri();
+    sgl_begin_quads();
+    sgl_v2f_t2f(0.0f, 0.0f, -1.0f, 0.0f);
+    sgl_v2f_t2f(1.0f, 0.0f, 0.5f, 0.0f);
+    sgl_v2f_t2f(1.0f, 1.0f, 1.0f, 2.0f);
+    sgl_v2f_t2f(0.0f, 1.0f, 0.0f, 1.0f);
+    sgl_end();
+    sg_begin_pass(&(sg_pass){ .swapchain = { .width = 256, .height = 128, .sample_count = 1 } });
+    sgl_draw();
+    sg_end_pass();
+    sg_commit();
+    T(num_sg_errors == 0);
+    const sg_frame_stats stats = sg_query_stats().prev_frame;
+    T(stats.num_draw == 1);
+    T(stats.num_draw_ex == 1);
+    T(stats.size_update_buffer == 7 * 16);
+    // uv coordinates are clamped to 0..1 and packed to 16-bit normalized
+    const _sgl_compact_vertex_t* v = &_sgl.cur_ctx->compact_vertices[3];
+    T(v[0].uv[0] == 0);
+    T(v[1].uv[0] == 0x8000);
+    T(v[2].uv[0] == 0xFFFF);
+    T(v[2].uv[1] == 0xFFFF);
+    TFLT(v[2].pos[0], 1.0f, FLT_MIN);
+    TFLT(v[2].pos[1], 1.0f, FLT_MIN);
+    T(v[2].rgba == 0xFFFFFFFF);
+    shutdown();
+}
+
+UTEST(sokol_gl, compact_vertex_layout_context) {
+    num_sg_errors = 0;
+    sg_setup(&(sg_desc){ .logger.func = sg_error_logger });
+    sgl_setup(&(sgl_desc_t){0});
+    T(_sgl.cur_ctx->desc.vertex_layout == SGL_VERTEXLAYOUT_STANDARD);
+    T(_sgl.cur_ctx->vertex_size == (int)sizeof(_sgl_vertex_t));
+    T(_sgl.cur_ctx->compact_vertices == 0);
+    const sgl_context ctx = sgl_make_context(&(sgl_context_desc_t){
+        .max_vertices = 32,
+        .vertex_layout = SGL_VERTEXLAYOUT_COMPACT_2D,
+        .auto_grow = true,
+    });
+    sgl_set_context(ctx);
+    sgl_begin_display_list();
+    draw_tri();
+    const sgl_display_list list = sgl_end_display_list();
+    const _sgl_display_list_t* dl = _sgl_lookup_display_list(list.id);
+    T(sg_query_buffer_size(dl->vbuf) == 3 * 16);
+    // growing the vertex buffer also grows the compact conversion space
+    for (int i = 0; i < 20; i++) {
+        draw_line();
+    }
+    T(_sgl.cur_ctx->vertices.cap >= 40);
+    sgl_call_display_list(list);
+    sg_begin_pass(&(sg_pass){ .swapchain = { .width = 256, .height = 128, .sample_count = 1 } });
+    sgl_context_draw(ctx);
+    sg_end_pass();
+    sg_commit();
+    T(num_sg_errors == 0);
+    T(sg_query_buffer_size(_sgl.cur_ctx->vbuf) == (size_t)_sgl.cur_ctx->vertices.cap * 16);
+    T(sg_query_stats().prev_frame.size_update_buffer == 40 * 16);
+    shutdown();
+}
+
+UTEST(sokol_gl, compact_vertex_layout_bindings) {
+    num_sg_errors = 0;
+    sg_setup(&(sg_desc){ .logger.func = sg_error_logger });
+    sgl_setup(&(sgl_desc_t){ .max_vertices = 64, .vertex_layout = SGL_VERTEXLAYOUT_COMPACT_2D });
+    // a display list with quads and triangles
+    sgl_begin_display_list();
+    sgl_begin_quads();
+    sgl_v2f(0.0f, 0.0f); sgl_v2f(1.0f, 0.0f); sgl_v2f(1.0f, 1.0f); sgl_v2f(0.0f, 1.0f);
+    sgl_end();
+    draw_tri();
+    const sgl_display_list list = sgl_end_display_list();
+    // quads and triangles in the context's vertex buffer around the display list call
+    sgl_begin_quads();
+    sgl_v2f(0.0f, 0.0f); sgl_v2f(1.0f, 0.0f); sgl_v2f(1.0f, 1.0f); sgl_v2f(0.0f, 1.0f);
+    sgl_end();
+    sgl_call_display_list(list);
+    draw_tri();
+    sgl_begin_quads();
+    sgl_v2f(0.0f, 0.0f); sgl_v2f(1.0f, 0.0f); sgl_v2f(1.0f, 1.0f); sgl_v2f(0.0f, 1.0f);
+    sgl_end();
+    sg_begin_pass(&(sg_pass){ .swapchain = { .width = 256, .height = 128, .sample_count = 1 } });
+    sgl_draw();
+    sg_end_pass();
+    sg_commit();
+    // the compact shader has no point size input, so switching between
+    // the context and display list vertex buffers only binds slot 0
+    T(num_sg_errors == 0);
+    T(_sgl.cur_ctx->bind.vertex_buffers[1].id == SG_INVALID_ID);
+    const sg_frame_stats stats = sg_query_stats().prev_frame;
+    T(stats.num_draw == 2);
+    T(stats.num_draw_ex == 3);
+    T(stats.num_apply_bindings == 5);
+    shutdown();
+}
+
+UTEST(sokol_gl, context_recording) {
+    num_sg_errors = 0;
+    sg_setup(&(sg_desc){ .logger.func = sg_error_logger });
+    sgl_setup(&(sgl_desc_t){0});
+    const sgl_context ctx = sgl_make_context(&(sgl_context_desc_t){0});
+    // recording into an explicit context doesn't touch the current context
+    sgl_context_defaults(ctx);
+    sgl_context_layer(ctx, 1);
+    sgl_context_viewport(ctx, 1, 2, 3, 4, true);
+    sgl_context_matrix_mode_projection(ctx);
+    sgl_context_ortho(ctx, -1.0f, 1.0f, -1.0f, 1.0f, -1.0f, 1.0f);
+    sgl_context_matrix_mode_modelview(ctx);
+    sgl_context_push_matrix(ctx);
+    sgl_context_translate(ctx, 1.0f, 2.0f, 3.0f);
+    sgl_context_c3b(ctx, 255, 0, 0);
+    sgl_context_begin_triangles(ctx);
+    sgl_context_v2f(ctx, 0.0f, 0.0f);
+    sgl_context_v2f_t2f(ctx, 1.0f, 0.0f, 1.0f, 0.0f);
+    sgl_context_v3f_c1i(ctx, 1.0f, 1.0f, 0.0f, 0xFF00FF00);
+    sgl_context_end(ctx);
+    sgl_context_pop_matrix(ctx);
+    T(_sgl.cur_ctx_id.id == SGL_DEFAULT_CONTEXT.id);
+    T(sgl_num_vertices() == 0);
+    T(sgl_num_commands() == 0);
+    T(_sgl.cur_ctx->layer_id == 0);
+    T(_sgl.cur_ctx->cur_matrix_mode == SGL_MATRIXMODE_MODELVIEW);
+    _sgl_context_t* c = _sgl_lookup_context(ctx.id);
+    T(c->vertices.next == 3);
+    T(c->commands.next == 2);
+    T(c->commands.ptr[0].cmd == SGL_COMMAND_VIEWPORT);
+    T(c->commands.ptr[0].layer_id == 1);
+    T(c->commands.ptr[1].cmd == SGL_COMMAND_DRAW);
+    T(c->vertices.ptr[0].rgba == 0xFF0000FF);
+    T(c->vertices.ptr[2].rgba == 0xFF00FF00);
+    TFLT(c->vertices.ptr[1].uv[0], 1.0f, FLT_MIN);
+    TFLT(c->uniforms.ptr[0].mvp.v[3][0], 1.0f, FLT_MIN);
+    T(c->matrix_tos[SGL_MATRIXMODE_MODELVIEW] == 0);
+    T(!sgl_context_error(ctx).any);
+    sg_begin_pass(&(sg_pass){ .swapchain = { .width = 256, .height = 128, .sample_count = 1 } });
+    sgl_context_draw_layer(ctx, 1);
+    sg_end_pass();
+    sg_commit();
+    T(num_sg_errors == 0);
+    T(sg_query_stats().prev_frame.num_draw == 1);
+    T(c->vertices.next == 0);
+    shutdown();
+}
+
+UTEST(sokol_gl, context_recording_matches_current_context) {
+    init();
+    const sgl_context ctx = sgl_make_context(&(sgl_context_desc_t){0});
+    const float verts[] = { 0.0f, 0.0f, 1.0f, 0.0f, 1.0f, 1.0f };
+    sgl_push_pipeline();
+    sgl_begin_quads();
+    sgl_v2f_c4f(0.0f, 0.0f, 1.0f, 0.5f, 0.0f, 1.0f);
+    sgl_v2f(1.0f, 0.0f);
+    sgl_v2f(1.0f, 1.0f);
+    sgl_v2f(0.0f, 1.0f);
+    sgl_end();
+    sgl_begin_triangles();
+    sgl_vertices(&(sgl_vertex_desc_t){ .pos = { .ptr = verts } }, 3);
+    sgl_end();
+    sgl_pop_pipeline();
+    sgl_context_push_pipeline(ctx);
+    sgl_context_begin_quads(ctx);
+    sgl_context_v2f_c4f(ctx, 0.0f, 0.0f, 1.0f, 0.5f, 0.0f, 1.0f);
+    sgl_context_v2f(ctx, 1.0f, 0.0f);
+    sgl_context_v2f(ctx, 1.0f, 1.0f);
+    sgl_context_v2f(ctx, 0.0f, 1.0f);
+    sgl_context_end(ctx);
+    sgl_context_begin_triangles(ctx);
+    sgl_context_vertices(ctx, &(sgl_vertex_desc_t){ .pos = { .ptr = verts } }, 3);
+    sgl_context_end(ctx);
+    sgl_context_pop_pipeline(ctx);
+    const _sgl_context_t* c0 = _sgl.cur_ctx;
+    const _sgl_context_t* c1 = _sgl_lookup_context(ctx.id);
+    T(c0->vertices.next == 7);
+    T(c1->vertices.next == 7);
+    T(0 == memcmp(c0->vertices.ptr, c1->vertices.ptr, 7 * sizeof(_sgl_vertex_t)));
+    T(c0->commands.next == c1->commands.next);
+    T(c0->pip_tos == 0);
+    T(c1->pip_tos == 0);
+    // an invalid context handle is silently ignored
+    sgl_destroy_context(ctx);
+    sgl_context_begin_lines(ctx);
+    sgl_context_v2f(ctx, 0.0f, 0.0f);
+    sgl_context_end(ctx);
+    T(sgl_num_vertices() == 7);
+    shutdown();
+}
+
+UTEST(sokol_gl, wide_lines) {
+    num_sg_errors = 0;
+    sg_setup(&(sg_desc){ .logger.func = sg_error_logger });
+    sgl_setup(&(sgl_desc_t){0});
+    // native lines by default
+    draw_line();
+    T(sgl_num_vertices() == 2);
+    T(_sgl.cur_ctx->commands.ptr[0].args.draw.pip.id == _sgl_get_pipeline(_sgl.cur_ctx->def_pip, SGL_PRIMITIVETYPE_LINES).id);
+    sgl_defaults();
+    sgl_line_width(4.0f);
+    T(_sgl.cur_ctx->line_width == 4.0f);
+    draw_tri();
+    sgl_begin_lines();
+    sgl_v2f(0.0f, 0.0f);
+    sgl_v2f(10.0f, 0.0f);
+    sgl_v2f(0.0f, 5.0f);
+    sgl_v2f(0.0f, 5.0f);    // zero-length lines are skipped
+    sgl_v2f(0.0f, 5.0f);
+    sgl_v2f(0.0f, 10.0f);
+    sgl_v2f(1.0f, 1.0f);    // incomplete trailing line
+    sgl_end();
+    T(!_sgl.cur_ctx->line.active);
+    draw_tri();
+    // wide lines are merged with the triangles
+    T(sgl_num_commands() == 2);
+    T(sgl_num_vertices() == 2 + 3 + 12 + 3);
+    const _sgl_command_t* cmd = &_sgl.cur_ctx->commands.ptr[1];
+    T(cmd->args.draw.pip.id == _sgl_get_pipeline(_sgl.cur_ctx->def_pip, SGL_PRIMITIVETYPE_TRIANGLES).id);
+    T(cmd->args.draw.num_vertices == 18);
+    const _sgl_vertex_t* v = &_sgl.cur_ctx->vertices.ptr[5];
+    TFLT(v[0].pos[0], 0.0f, FLT_MIN);   TFLT(v[0].pos[1], 2.0f, FLT_MIN);
+    TFLT(v[1].pos[0], 0.0f, FLT_MIN);   TFLT(v[1].pos[1], -2.0f, FLT_MIN);
+    TFLT(v[2].pos[0], 10.0f, FLT_MIN);  TFLT(v[2].pos[1], -2.0f, FLT_MIN);
+    TFLT(v[5].pos[0], 10.0f, FLT_MIN);  TFLT(v[5].pos[1], 2.0f, FLT_MIN);
+    TFLT(v[6].pos[0], -2.0f, FLT_MIN);  TFLT(v[6].pos[1], 5.0f, FLT_MIN);
+    TFLT(v[8].pos[0], 2.0f, FLT_MIN);   TFLT(v[8].pos[1], 10.0f, FLT_MIN);
+    T(v[0].rgba == 0xFFFFFFFF);
+    sg_begin_pass(&(sg_pass){ .swapchain = { .width = 256, .height = 128, .sample_count = 1 } });
+    sgl_draw();
+    sg_end_pass();
+    sg_commit();
+    T(num_sg_errors == 0);
+    T(sg_query_stats().prev_frame.num_draw == 2);
+    // sgl_defaults() resets the line width
+    sgl_defaults();
+    T(_sgl.cur_ctx->line_width == 1.0f);
+    shutdown();
+}
+
+UTEST(sokol_gl, wide_line_strip) {
+    init();
+    sgl_line_width(2.0f);
+    sgl_begin_line_strip();
+    sgl_v2f(0.0f, 0.0f);
+    sgl_v2f(10.0f, 0.0f);
+    sgl_v2f(10.0f, 10.0f);
+    sgl_end();
+    T(sgl_num_vertices() == 12);
+    const _sgl_vertex_t* v = _sgl.cur_ctx->vertices.ptr;
+    // the mitered join at (10,0)
+    TFLT(v[2].pos[0], 11.0f, 0.0001f);  TFLT(v[2].pos[1], -1.0f, 0.0001f);
+    TFLT(v[5].pos[0], 9.0f, 0.0001f);   TFLT(v[5].pos[1], 1.0f, 0.0001f);
+    TFLT(v[6].pos[0], 9.0f, 0.0001f);   TFLT(v[6].pos[1], 1.0f, 0.0001f);
+    TFLT(v[7].pos[0], 11.0f, 0.0001f);  TFLT(v[7].pos[1], -1.0f, 0.0001f);
+    // the end of the strip
+    TFLT(v[8].pos[0], 11.0f, 0.0001f);  TFLT(v[8].pos[1], 10.0f, 0.0001f);
+    TFLT(v[11].pos[0], 9.0f, 0.0001f);  TFLT(v[11].pos[1], 10.0f, 0.0001f);
+    // tessellated line strips can be merged too
+    sgl_begin_line_strip();
+    const float points[] = { 0.0f, 0.0f, 0.0f, 5.0f, 5.0f, 5.0f };
+    sgl_vertices(&(sgl_vertex_desc_t){ .pos = { .ptr = points }, .pos_components = 2 }, 3);
+    sgl_end();
+    T(sgl_num_vertices() == 24);
+    T(sgl_num_commands() == 1);
+    // a strip with a single point doesn't emit anything
+    sgl_begin_line_strip();
+    sgl_v2f(0.0f, 0.0f);
+    sgl_end();
+    T(sgl_num_vertices() == 24);
+    shutdown();
+}
+
+static int num_line_z_warnings;
+static void sgl_line_z_logger(const char* tag, uint32_t log_level, uint32_t log_item_id, const char* message_or_null, uint32_t line_nr, const char* filename_or_null, void* user_data) {
+    (void)tag; (void)log_level; (void)message_or_null; (void)line_nr; (void)filename_or_null; (void)user_data;
+    if (log_item_id == SGL_LOGITEM_LINE_VARYING_Z) {
+        num_line_z_warnings++;
+    }
+}
+
+UTEST(sokol_gl, wide_line_varying_z) {
+    num_line_z_warnings = 0;
+    sg_setup(&(sg_desc){0});
+    sgl_setup(&(sgl_desc_t){ .logger.func = sgl_line_z_logger });
+    sgl_line_width(2.0f);
+    // constant z doesn't warn
+    sgl_begin_line_strip();
+    sgl_v3f(0.0f, 0.0f, 0.5f);
+    sgl_v3f(10.0f, 0.0f, 0.5f);
+    sgl_end();
+    T(sgl_num_vertices() == 6);
+    T(num_line_z_warnings == 0);
+    // a segment along z has no xy extent and is dropped, with a single warning
+    // per sgl_begin/end pair
+    sgl_begin_lines();
+    sgl_v3f(0.0f, 0.0f, 0.0f);
+    sgl_v3f(0.0f, 0.0f, 1.0f);
+    sgl_v3f(0.0f, 0.0f, 0.0f);
+    sgl_v3f(5.0f, 0.0f, 1.0f);
+    sgl_end();
+    T(sgl_num_vertices() == 12);
+    T(num_line_z_warnings == 1);
+    sgl_begin_lines();
+    sgl_v3f(0.0f, 0.0f, 0.0f);
+    sgl_v3f(5.0f, 0.0f, 1.0f);
+    sgl_end();
+    T(num_line_z_warnings == 2);
+    // native lines don't warn
+    sgl_line_width(1.0f);
+    sgl_begin_lines();
+    sgl_v3f(0.0f, 0.0f, 0.0f);
+    sgl_v3f(0.0f, 0.0f, 1.0f);
+    sgl_end();
+    T(sgl_num_vertices() == 20);
+    T(num_line_z_warnings == 2);
+    shutdown();
+}
+
+UTEST(sokol_gl, smooth_lines) {
+    init();
+    sgl_enable_line_smooth();
+    T(_sgl.cur_ctx->line_smooth);
+    sgl_c1i(0xFF0000FF);
+    sgl_begin_lines();
+    sgl_v2f(0.0f, 0.0f);
+    sgl_v2f(10.0f, 0.0f);
+    sgl_end();
+    // start cap, line and end cap, with 3 quads between 4 rails each
+    T(sgl_num_vertices() == 3 * 3 * 6);
+    const _sgl_vertex_t* v = _sgl.cur_ctx->vertices.ptr;
+    // the start cap fades out over half a unit
+    T(v[6].rgba == 0x000000FF);
+    T(v[7].rgba == 0x000000FF);
+    T(v[8].rgba == 0xFF0000FF);
+    TFLT(v[0].pos[0], -0.5f, FLT_MIN);  TFLT(v[0].pos[1], 1.0f, FLT_MIN);
+    TFLT(v[8].pos[0], 0.0f, FLT_MIN);   TFLT(v[8].pos[1], 0.0f, FLT_MIN);
+    // outer rails are transparent, inner rails are opaque
+    T(v[18].rgba == 0x000000FF);
+    T(v[19].rgba == 0xFF0000FF);
+    TFLT(v[18].pos[1], 1.0f, FLT_MIN);
+    TFLT(v[19].pos[1], 0.0f, FLT_MIN);
+    // thin smooth lines fade out instead of getting thinner
+    sgl_disable_line_smooth();
+    T(!_sgl.cur_ctx->line_smooth);
+    sgl_enable_line_smooth();
+    sgl_line_width(0.5f);
+    sgl_begin_lines();
+    sgl_v2f(0.0f, 0.0f);
+    sgl_v2f(10.0f, 0.0f);
+    sgl_end();
+    T(v[54 + 19].rgba == 0x800000FF);
+    shutdown();
+}
@@ -0,0 +1,292 @@
+//------------------------------------------------------------------------------
+//  sokol-instancing-test.c
+//------------------------------------------------------------------------------
+#include "sokol_gfx.h"
+#define SOKOL_INSTANCING_IMPL
+#include "sokol_instancing.h"
+#include "utest.h"
+
+#define T(b) EXPECT_TRUE(b)
+
+#define MAX_LOG_ITEMS (8)
+static int num_log_called;
+static sinst_log_item log_items[MAX_LOG_ITEMS];
+
+static void test_logger(const char* tag, uint32_t log_level, uint32_t log_item_id, const char* message_or_null, uint32_t line_nr, const char* filename_or_null, void* user_data) {
+    (void)tag; (void)log_level; (void)message_or_null; (void)line_nr; (void)filename_or_null; (void)user_data;
+    if (num_log_called < MAX_LOG_ITEMS) {
+        log_items[num_log_called] = (sinst_log_item)log_item_id;
+    }
+    num_log_called++;
+}
+
+static void reset_log_items(void) {
+    num_log_called = 0;
+    for (int i = 0; i < MAX_LOG_ITEMS; i++) {
+        log_items[i] = SINST_LOGITEM_OK;
+    }
+}
+
+static void init_with_desc(const sinst_desc* desc) {
+    reset_log_items();
+    sg_setup(&(sg_desc){0});
+    sinst_desc d = *desc;
+    d.logger.func = test_logger;
+    sinst_setup(&d);
+}
+
+static void init(void) {
+    init_with_desc(&(sinst_desc){0});
+}
+
+static void shutdown(void) {
+    sinst_shutdown();
+    sg_shutdown();
+}
+
+static sg_pipeline create_pipeline(void) {
+    return sg_make_pipeline(&(sg_pipeline_desc){
+        .layout = {
+            .buffers[1].step_func = SG_VERTEXSTEP_PER_INSTANCE,
+            .attrs = {
+                [0] = { .format = SG_VERTEXFORMAT_FLOAT3, .buffer_index = 0 },
+                [1] = { .format = SG_VERTEXFORMAT_FLOAT4, .buffer_index = 1 },
+            },
+        },
+        .shader = sg_make_shader(&(sg_shader_desc){0}),
+    });
+}
+
+static sg_buffer create_mesh(void) {
+    return sg_make_buffer(&(sg_buffer_desc){ .size = 3 * 3 * sizeof(float), .usage.stream_update = true });
+}
+
+static void begin_pass(void) {
+    sg_begin_pass(&(sg_pass){
+        .swapchain = {
+            .width = 256,
+            .height = 128,
+            .sample_count = 1,
+            .color_format = SG_PIXELFORMAT_RGBA8,
+            .depth_format = SG_PIXELFORMAT_DEPTH_STENCIL,
+        },
+    });
+}
+
+static void draw(sg_pipeline pip, sg_buffer mesh, float val) {
+    const float inst[4] = { val, val, val, val };
+    sinst_draw(&(sinst_draw_desc){
+        .pipeline = pip,
+        .bindings.vertex_buffers[0] = mesh,
+        .instance_slot = 1,
+        .num_elements = 3,
+        .data = SG_RANGE(inst),
+    });
+}
+
+static int num_apply_uniforms;
+static void apply_uniforms(sg_pipeline pip, void* user_data) {
+    (void)pip;
+    (*(int*)user_data)++;
+}
+
+UTEST(sokol_instancing, default_init_shutdown) {
+    init();
+    T(_sinst.init_tag == _SINST_INIT_TAG);
+    T(_sinst.desc.max_instances == 16384);
+    T(_sinst.desc.max_batches == 256);
+    T(_sinst.desc.buffer_size == 1024 * 1024);
+    T(_sinst.hash_mask == 511);
+    T(sg_query_buffer_state(_sinst.buf) == SG_RESOURCESTATE_VALID);
+    T(sg_query_buffer_usage(_sinst.buf).stream_update);
+    shutdown();
+    T(_sinst.init_tag == 0);
+}
+
+UTEST(sokol_instancing, merge_identical_draws) {
+    init();
+    sg_pipeline pip0 = create_pipeline();
+    sg_pipeline pip1 = create_pipeline();
+    sg_buffer mesh0 = create_mesh();
+    sg_buffer mesh1 = create_mesh();
+    for (int i = 0; i < 100; i++) {
+        draw((i & 1) ? pip1 : pip0, (i & 2) ? mesh1 : mesh0, (float)i);
+    }
+    T(_sinst.num_instances == 100);
+    T(_sinst.num_batches == 4);
+    T(_sinst.batches[0].num_instances == 25);
+    begin_pass();
+    sinst_flush();
+    sg_end_pass();
+    sg_commit();
+    const sinst_stats stats = sinst_query_stats();
+    T(stats.num_instances == 100);
+    T(stats.num_batches == 4);
+    T(stats.num_pipelines == 2);
+    T(stats.num_bytes == 100 * 16);
+    T(_sinst.num_instances == 0);
+    T(_sinst.num_batches == 0);
+    T(num_log_called == 0);
+    shutdown();
+}
+
+UTEST(sokol_instancing, instance_data_sorted_by_batch) {
+    init();
+    sg_pipeline pip0 = create_pipeline();
+    sg_pipeline pip1 = create_pipeline();
+    sg_buffer mesh = create_mesh();
+    draw(pip1, mesh, 0.0f);
+    draw(pip0, mesh, 1.0f);
+    draw(pip1, mesh, 2.0f);
+    draw(pip0, mesh, 3.0f);
+    begin_pass();
+    sinst_flush();
+    sg_end_pass();
+    sg_commit();
+    // batches are sorted by pipeline, instances keep their submission order within a batch
+    const float* sorted = (const float*)_sinst.sorted;
+    T(sorted[0] == 1.0f);
+    T(sorted[4] == 3.0f);
+    T(sorted[8] == 0.0f);
+    T(sorted[12] == 2.0f);
+    T(sinst_query_stats().num_batches == 2);
+    shutdown();
+}
+
+UTEST(sokol_instancing, different_element_ranges_not_merged) {
+    init();
+    sg_pipeline pip = create_pipeline();
+    sg_buffer mesh = create_mesh();
+    const float inst[4] = { 0 };
+    sinst_draw(&(sinst_draw_desc){ .pipeline = pip, .bindings.vertex_buffers[0] = mesh, .instance_slot = 1, .num_elements = 3, .data = SG_RANGE(inst) });
+    sinst_draw(&(sinst_draw_desc){ .pipeline = pip, .bindings.vertex_buffers[0] = mesh, .instance_slot = 1, .num_elements = 3, .data = SG_RANGE(inst) });
+    sinst_draw(&(sinst_draw_desc){ .pipeline = pip, .bindings.vertex_buffers[0] = mesh, .instance_slot = 1, .base_element = 3, .num_elements = 3, .data = SG_RANGE(inst) });
+    T(_sinst.num_batches == 2);
+    begin_pass();
+    sinst_flush();
+    sg_end_pass();
+    sg_commit();
+    shutdown();
+}
+
+UTEST(sokol_instancing, flush_apply_uniforms_callback) {
+    init();
+    sg_pipeline pip0 = create_pipeline();
+    sg_pipeline pip1 = create_pipeline();
+    sg_buffer mesh0 = create_mesh();
+    sg_buffer mesh1 = create_mesh();
+    draw(pip0, mesh0, 0.0f);
+    draw(pip1, mesh0, 0.0f);
+    draw(pip0, mesh1, 0.0f);
+    num_apply_uniforms = 0;
+    begin_pass();
+    sinst_flush_ex(&(sinst_flush_desc){ .apply_uniforms = apply_uniforms, .user_data = &num_apply_uniforms });
+    sg_end_pass();
+    sg_commit();
+    T(num_apply_uniforms == 2);
+    shutdown();
+}
+
+UTEST(sokol_instancing, multiple_flushes_per_frame) {
+    init();
+    sg_pipeline pip = create_pipeline();
+    sg_buffer mesh = create_mesh();
+    begin_pass();
+    draw(pip, mesh, 0.0f);
+    sinst_flush();
+    draw(pip, mesh, 1.0f);
+    draw(pip, mesh, 2.0f);
+    sinst_flush();
+    sg_end_pass();
+    sg_commit();
+    T(sinst_query_stats().num_instances == 2);
+    T(num_log_called == 0);
+    shutdown();
+}
+
+UTEST(sokol_instancing, empty_flush) {
+    init();
+    begin_pass();
+    sinst_flush();
+    sg_end_pass();
+    sg_commit();
+    T(sinst_query_stats().num_batches == 0);
+    T(num_log_called == 0);
+    shutdown();
+}
+
+UTEST(sokol_instancing, draw_validate) {
+    init();
+    sg_pipeline pip = create_pipeline();
+    sg_buffer mesh = create_mesh();
+    const float inst[4] = { 0 };
+    const uint8_t odd[3] = { 0 };
+    sinst_draw(&(sinst_draw_desc){ .pipeline = pip, .bindings.vertex_buffers[0] = mesh, .instance_slot = -1, .data = SG_RANGE(inst) });
+    T(log_items[0] == SINST_LOGITEM_DRAW_INVALID_INSTANCE_SLOT);
+    reset_log_items();
+    sinst_draw(&(sinst_draw_desc){ .pipeline = pip, .bindings.vertex_buffers[0] = mesh, .instance_slot = 0, .data = SG_RANGE(inst) });
+    T(log_items[0] == SINST_LOGITEM_DRAW_INSTANCE_SLOT_OCCUPIED);
+    reset_log_items();
+    sinst_draw(&(sinst_draw_desc){ .pipeline = pip, .bindings.vertex_buffers[0] = mesh, .instance_slot = 1 });
+    T(log_items[0] == SINST_LOGITEM_DRAW_INVALID_DATA_SIZE);
+    reset_log_items();
+    sinst_draw(&(sinst_draw_desc){ .pipeline = pip, .bindings.vertex_buffers[0] = mesh, .instance_slot = 1, .data = SG_RANGE(odd) });
+    T(log_items[0] == SINST_LOGITEM_DRAW_INVALID_DATA_SIZE);
+    T(_sinst.num_instances == 0);
+    shutdown();
+}
+
+UTEST(sokol_instancing, instance_pool_exhausted) {
+    init_with_desc(&(sinst_desc){ .max_instances = 4 });
+    sg_pipeline pip = create_pipeline();
+    sg_buffer mesh = create_mesh();
+    for (int i = 0; i < 5; i++) {
+        draw(pip, mesh, 0.0f);
+    }
+    T(log_items[0] == SINST_LOGITEM_INSTANCE_POOL_EXHAUSTED);
+    T(_sinst.num_instances == 4);
+    shutdown();
+}
+
+UTEST(sokol_instancing, batch_pool_exhausted) {
+    init_with_desc(&(sinst_desc){ .max_batches = 2 });
+    sg_pipeline pip = create_pipeline();
+    for (int i = 0; i < 3; i++) {
+        draw(pip, create_mesh(), 0.0f);
+    }
+    T(log_items[0] == SINST_LOGITEM_BATCH_POOL_EXHAUSTED);
+    T(_sinst.num_batches == 2);
+    T(_sinst.num_instances == 2);
+    shutdown();
+}
+
+UTEST(sokol_instancing, staging_buffer_full) {
+    init_with_desc(&(sinst_desc){ .buffer_size = 32 });
+    sg_pipeline pip = create_pipeline();
+    sg_buffer mesh = create_mesh();
+    for (int i = 0; i < 3; i++) {
+        draw(pip, mesh, 0.0f);
+    }
+    T(log_items[0] == SINST_LOGITEM_STAGING_BUFFER_FULL);
+    T(_sinst.num_instances == 2);
+    shutdown();
+}
+
+UTEST(sokol_instancing, stream_buffer_full) {
+    init_with_desc(&(sinst_desc){ .buffer_size = 32 });
+    sg_pipeline pip = create_pipeline();
+    sg_buffer mesh = create_mesh();
+    begin_pass();
+    draw(pip, mesh, 0.0f);
+    draw(pip, mesh, 0.0f);
+    sinst_flush();
+    T(num_log_called == 0);
+    draw(pip, mesh, 0.0f);
+    sinst_flush();
+    T(log_items[0] == SINST_LOGITEM_STREAM_BUFFER_FULL);
+    T(sinst_query_stats().num_instances == 0);
+    T(_sinst.num_instances == 0);
+    sg_end_pass();
+    sg_commit();
+    shutdown();
+}
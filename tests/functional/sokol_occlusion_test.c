@@ -0,0 +1,366 @@
+//------------------------------------------------------------------------------
+//  sokol-occlusion-test.c
+//------------------------------------------------------------------------------
+#include "sokol_gfx.h"
+#define SOKOL_OCCLUSION_IMPL
+#include "sokol_occlusion.h"
+#include "utest.h"
+#include <math.h>
+
+#define T(b) EXPECT_TRUE(b)
+
+#define MAX_LOG_ITEMS (8)
+static int num_log_called;
+static socc_log_item log_items[MAX_LOG_ITEMS];
+
+static void test_logger(const char* tag, uint32_t log_level, uint32_t log_item_id, const char* message_or_null, uint32_t line_nr, const char* filename_or_null, void* user_data) {
+    (void)tag; (void)log_level; (void)message_or_null; (void)line_nr; (void)filename_or_null; (void)user_data;
+    if (num_log_called < MAX_LOG_ITEMS) {
+        log_items[num_log_called] = (socc_log_item)log_item_id;
+    }
+    num_log_called++;
+}
+
+static void reset_log_items(void) {
+    num_log_called = 0;
+    for (int i = 0; i < MAX_LOG_ITEMS; i++) {
+        log_items[i] = SOCC_LOGITEM_OK;
+    }
+}
+
+static void init_with_desc(const socc_desc* desc) {
+    reset_log_items();
+    sg_setup(&(sg_desc){0});
+    socc_desc d = *desc;
+    d.logger.func = test_logger;
+    socc_setup(&d);
+}
+
+static void init(void) {
+    init_with_desc(&(socc_desc){0});
+}
+
+static void shutdown(void) {
+    socc_shutdown();
+    sg_shutdown();
+}
+
+static const float identity[16] = {
+    1.0f, 0.0f, 0.0f, 0.0f,
+    0.0f, 1.0f, 0.0f, 0.0f,
+    0.0f, 0.0f, 1.0f, 0.0f,
+    0.0f, 0.0f, 0.0f, 1.0f,
+};
+
+// a GL-style perspective projection looking down -z
+static socc_mat4_t perspective(float fov_y, float aspect, float near_z, float far_z) {
+    const float f = 1.0f / tanf(fov_y * 0.5f);
+    socc_mat4_t m = {0};
+    m.m[0][0] = f / aspect;
+    m.m[1][1] = f;
+    m.m[2][2] = (far_z + near_z) / (near_z - far_z);
+    m.m[2][3] = -1.0f;
+    m.m[3][2] = (2.0f * far_z * near_z) / (near_z - far_z);
+    return m;
+}
+
+// a quad in the xy plane at depth z, as indexed triangle list
+static float quad_vertices[4][3];
+static const uint16_t quad_indices[6] = { 0, 1, 2, 0, 2, 3 };
+static void add_quad(float x0, float y0, float x1, float y1, float z) {
+    const float v[4][3] = { { x0, y0, z }, { x1, y0, z }, { x1, y1, z }, { x0, y1, z } };
+    memcpy(quad_vertices, v, sizeof(v));
+    socc_add_occluder(&(socc_occluder_desc){
+        .vertices = SG_RANGE(quad_vertices),
+        .indices = SG_RANGE(quad_indices),
+    });
+}
+
+static bool test_box(float x0, float y0, float z0, float x1, float y1, float z1) {
+    const float box_min[3] = { x0, y0, z0 };
+    const float box_max[3] = { x1, y1, z1 };
+    return socc_test_box(box_min, box_max);
+}
+
+UTEST(sokol_occlusion, default_init_shutdown) {
+    init();
+    T(_socc.init_tag == _SOCC_INIT_TAG);
+    T(_socc.desc.width == 256);
+    T(_socc.desc.height == 128);
+    T(_socc.desc.max_triangles == 16384);
+    T(_socc.num_tiles_x == 32);
+    T(_socc.num_tiles_y == 16);
+    T(socc_num_bands() == 4);
+    T(socc_query_debug_image().id == SG_INVALID_ID);
+    shutdown();
+    T(_socc.init_tag == 0);
+}
+
+UTEST(sokol_occlusion, empty_frame) {
+    init();
+    socc_begin(&(socc_begin_desc){ .view_proj = socc_mat4(identity) });
+    socc_end();
+    T(socc_query_depth(0, 0) == 1.0f);
+    T(socc_query_depth(128, 64) == 1.0f);
+    T(test_box(-0.1f, -0.1f, 0.5f, 0.1f, 0.1f, 0.6f));
+    const socc_stats stats = socc_query_stats();
+    T(stats.num_occluders == 0);
+    T(stats.num_triangles == 0);
+    T(stats.num_tests == 1);
+    T(num_log_called == 0);
+    shutdown();
+}
+
+UTEST(sokol_occlusion, rasterize_quad) {
+    init();
+    socc_begin(&(socc_begin_desc){ .view_proj = socc_mat4(identity) });
+    add_quad(-0.5f, -0.5f, 0.5f, 0.5f, 0.25f);
+    socc_end();
+    // the quad covers the center half of the depth buffer
+    T(socc_query_depth(128, 64) == 0.25f);
+    T(socc_query_depth(64, 32) == 0.25f);
+    T(socc_query_depth(191, 95) == 0.25f);
+    T(socc_query_depth(63, 31) == 1.0f);
+    T(socc_query_depth(192, 96) == 1.0f);
+    T(socc_query_depth(0, 0) == 1.0f);
+    const socc_stats stats = socc_query_stats();
+    T(stats.num_occluders == 1);
+    T(stats.num_triangles == 2);
+    T(num_log_called == 0);
+    shutdown();
+}
+
+UTEST(sokol_occlusion, depth_interpolation) {
+    init();
+    socc_begin(&(socc_begin_desc){ .view_proj = socc_mat4(identity) });
+    // a quad whose depth goes from 0.0 at the left to 0.5 at the right border
+    const float v[4][3] = { { -1.0f, -1.0f, 0.0f }, { 1.0f, -1.0f, 0.5f }, { 1.0f, 1.0f, 0.5f }, { -1.0f, 1.0f, 0.0f } };
+    socc_add_occluder(&(socc_occluder_desc){ .vertices = SG_RANGE(v), .indices = SG_RANGE(quad_indices) });
+    socc_end();
+    T(fabsf(socc_query_depth(0, 64) - (0.5f / 256.0f) * 0.5f) < 0.001f);
+    T(fabsf(socc_query_depth(128, 64) - (128.5f / 256.0f) * 0.5f) < 0.001f);
+    T(fabsf(socc_query_depth(255, 10) - (255.5f / 256.0f) * 0.5f) < 0.001f);
+    shutdown();
+}
+
+UTEST(sokol_occlusion, nearest_depth_wins) {
+    init();
+    socc_begin(&(socc_begin_desc){ .view_proj = socc_mat4(identity) });
+    add_quad(-0.5f, -0.5f, 0.5f, 0.5f, 0.5f);
+    add_quad(-0.25f, -0.25f, 0.25f, 0.25f, 0.75f);
+    add_quad(-1.0f, -1.0f, 0.0f, 0.0f, 0.25f);
+    socc_end();
+    T(socc_query_depth(160, 40) == 0.5f);
+    T(socc_query_depth(100, 100) == 0.25f);
+    T(socc_query_depth(130, 60) == 0.5f);
+    shutdown();
+}
+
+UTEST(sokol_occlusion, test_box_ortho) {
+    init();
+    socc_begin(&(socc_begin_desc){ .view_proj = socc_mat4(identity) });
+    add_quad(-0.5f, -0.5f, 0.5f, 0.5f, 0.0f);
+    socc_end();
+    // entirely behind the occluder
+    T(!test_box(-0.2f, -0.2f, 0.5f, 0.2f, 0.2f, 0.6f));
+    // in front of the occluder
+    T(test_box(-0.2f, -0.2f, -0.5f, 0.2f, 0.2f, -0.4f));
+    // intersects the occluder
+    T(test_box(-0.2f, -0.2f, -0.1f, 0.2f, 0.2f, 0.1f));
+    // behind, but partially outside the occluder
+    T(test_box(0.3f, 0.3f, 0.5f, 0.7f, 0.7f, 0.6f));
+    // outside the view frustum
+    T(!test_box(2.0f, -0.2f, 0.5f, 3.0f, 0.2f, 0.6f));
+    T(!test_box(-0.2f, -3.0f, 0.5f, 0.2f, -2.0f, 0.6f));
+    T(!test_box(-0.2f, -0.2f, 1.5f, 0.2f, 0.2f, 1.6f));
+    const socc_stats stats = socc_query_stats();
+    T(stats.num_tests == 7);
+    T(stats.num_occlusion_culled == 1);
+    T(stats.num_frustum_culled == 3);
+    shutdown();
+}
+
+UTEST(sokol_occlusion, test_box_perspective) {
+    init();
+    const socc_mat4_t proj = perspective(1.0f, 2.0f, 0.1f, 100.0f);
+    socc_begin(&(socc_begin_desc){ .view_proj = proj });
+    add_quad(-2.0f, -2.0f, 2.0f, 2.0f, -5.0f);
+    socc_end();
+    T(socc_query_depth(128, 64) < 1.0f);
+    // a small box far behind the wall
+    T(!test_box(-0.5f, -0.5f, -20.0f, 0.5f, 0.5f, -19.0f));
+    // a box in front of the wall
+    T(test_box(-0.5f, -0.5f, -3.0f, 0.5f, 0.5f, -2.0f));
+    // a box behind the wall which is visible next to it
+    T(test_box(15.0f, -0.5f, -20.0f, 16.0f, 0.5f, -19.0f));
+    // a box which crosses the near plane is always visible
+    T(test_box(-0.5f, -0.5f, -20.0f, 0.5f, 0.5f, 1.0f));
+    // a box entirely behind the camera is culled
+    T(!test_box(-0.5f, -0.5f, 1.0f, 0.5f, 0.5f, 2.0f));
+    shutdown();
+}
+
+UTEST(sokol_occlusion, near_plane_clipping) {
+    init();
+    const socc_mat4_t proj = perspective(1.0f, 2.0f, 0.1f, 100.0f);
+    socc_begin(&(socc_begin_desc){ .view_proj = proj });
+    // a floor quad which extends behind the camera
+    const float v[4][3] = { { -10.0f, -1.0f, 10.0f }, { 10.0f, -1.0f, 10.0f }, { 10.0f, -1.0f, -10.0f }, { -10.0f, -1.0f, -10.0f } };
+    socc_add_occluder(&(socc_occluder_desc){ .vertices = SG_RANGE(v), .indices = SG_RANGE(quad_indices) });
+    socc_end();
+    // the floor is rendered in the lower half of the depth buffer only
+    T(socc_query_depth(128, 127) < 1.0f);
+    T(socc_query_depth(128, 10) == 1.0f);
+    T(socc_query_stats().num_triangles >= 2);
+    // a box below the floor is hidden
+    T(!test_box(-1.0f, -3.0f, -6.0f, 1.0f, -2.0f, -5.0f));
+    T(test_box(-1.0f, 0.0f, -6.0f, 1.0f, 1.0f, -5.0f));
+    T(num_log_called == 0);
+    shutdown();
+}
+
+UTEST(sokol_occlusion, guard_band_clipping) {
+    init();
+    socc_begin(&(socc_begin_desc){ .view_proj = socc_mat4(identity) });
+    // a long thin triangle with one vertex far outside the screen, this must
+    // be clipped instead of clamped, otherwise its upper edge would become
+    // much steeper and cover pixels the triangle doesn't actually cover
+    const float v[3][3] = { { -0.5f, -0.5f, 0.5f }, { 0.5f, -0.5f, 0.5f }, { 10.0f, 0.5f, 0.5f } };
+    socc_add_occluder(&(socc_occluder_desc){ .vertices = SG_RANGE(v) });
+    socc_end();
+    T(socc_query_stats().num_triangles >= 2);
+    // inside the actual triangle
+    T(socc_query_depth(249, 89) == 0.5f);
+    // above the actual triangle, but inside a clamped triangle
+    T(socc_query_depth(128, 89) == 1.0f);
+    T(num_log_called == 0);
+    shutdown();
+}
+
+UTEST(sokol_occlusion, model_matrix_and_stride) {
+    init();
+    socc_begin(&(socc_begin_desc){ .view_proj = socc_mat4(identity) });
+    typedef struct { float pos[3]; uint32_t color; } vertex_t;
+    const vertex_t v[3] = {
+        { { -0.5f, -0.5f, 0.0f }, 0 },
+        { {  0.5f, -0.5f, 0.0f }, 0 },
+        { {  0.0f,  0.5f, 0.0f }, 0 },
+    };
+    // translate by z=0.5 (non-indexed)
+    const float model[16] = {
+        1.0f, 0.0f, 0.0f, 0.0f,
+        0.0f, 1.0f, 0.0f, 0.0f,
+        0.0f, 0.0f, 1.0f, 0.0f,
+        0.0f, 0.0f, 0.5f, 1.0f,
+    };
+    socc_add_occluder(&(socc_occluder_desc){
+        .vertices = SG_RANGE(v),
+        .vertex_stride = sizeof(vertex_t),
+        .model = socc_mat4(model),
+    });
+    socc_end();
+    T(socc_query_depth(128, 64) == 0.5f);
+    T(socc_query_stats().num_triangles == 1);
+    T(num_log_called == 0);
+    shutdown();
+}
+
+UTEST(sokol_occlusion, uint32_indices) {
+    init();
+    socc_begin(&(socc_begin_desc){ .view_proj = socc_mat4(identity) });
+    const float v[4][3] = { { -1.0f, -1.0f, 0.5f }, { 1.0f, -1.0f, 0.5f }, { 1.0f, 1.0f, 0.5f }, { -1.0f, 1.0f, 0.5f } };
+    const uint32_t indices[6] = { 0, 1, 2, 0, 2, 3 };
+    socc_add_occluder(&(socc_occluder_desc){
+        .vertices = SG_RANGE(v),
+        .indices = SG_RANGE(indices),
+        .index_type = SG_INDEXTYPE_UINT32,
+    });
+    socc_end();
+    T(socc_query_depth(0, 0) == 0.5f);
+    T(socc_query_depth(255, 127) == 0.5f);
+    T(num_log_called == 0);
+    shutdown();
+}
+
+UTEST(sokol_occlusion, rasterize_bands) {
+    init();
+    socc_begin(&(socc_begin_desc){ .view_proj = socc_mat4(identity) });
+    add_quad(-1.0f, -1.0f, 1.0f, 1.0f, 0.5f);
+    for (int i = socc_num_bands() - 1; i >= 0; i -= 2) {
+        socc_rasterize_band(i);
+    }
+    T(_socc.band_done[3] && !_socc.band_done[2]);
+    T(socc_query_depth(10, 127) == 0.5f);
+    socc_end();
+    for (int i = 0; i < socc_num_bands(); i++) {
+        T(_socc.band_done[i]);
+    }
+    T(socc_query_depth(10, 0) == 0.5f);
+    // all tiles are 0.5 now
+    T(!test_box(-0.9f, -0.9f, 0.6f, 0.9f, 0.9f, 0.7f));
+    // the next frame starts with an empty depth buffer
+    socc_begin(&(socc_begin_desc){ .view_proj = socc_mat4(identity) });
+    socc_end();
+    T(socc_query_depth(10, 0) == 1.0f);
+    T(test_box(-0.9f, -0.9f, 0.6f, 0.9f, 0.9f, 0.7f));
+    shutdown();
+}
+
+UTEST(sokol_occlusion, debug_image) {
+    init_with_desc(&(socc_desc){ .width = 64, .height = 32, .debug_image = true });
+    const sg_image img = socc_query_debug_image();
+    T(sg_query_image_state(img) == SG_RESOURCESTATE_VALID);
+    T(sg_query_image_width(img) == 64);
+    T(sg_query_image_height(img) == 32);
+    T(sg_query_image_pixelformat(img) == SG_PIXELFORMAT_R32F);
+    T(sg_query_view_state(socc_query_debug_view()) == SG_RESOURCESTATE_VALID);
+    socc_begin(&(socc_begin_desc){ .view_proj = socc_mat4(identity) });
+    socc_end();
+    sg_commit();
+    T(sg_query_stats().prev_frame.num_update_image == 1);
+    T(num_log_called == 0);
+    shutdown();
+}
+
+UTEST(sokol_occlusion, validate) {
+    init();
+    const float v[3][3] = { { 0.0f, 0.0f, 0.0f }, { 1.0f, 0.0f, 0.0f }, { 0.0f, 1.0f, 0.0f } };
+    socc_add_occluder(&(socc_occluder_desc){ .vertices = SG_RANGE(v) });
+    T(log_items[0] == SOCC_LOGITEM_ADD_OCCLUDER_OUTSIDE_BEGIN_END);
+    reset_log_items();
+    T(socc_test_box(v[0], v[1]));
+    T(log_items[0] == SOCC_LOGITEM_TEST_BOX_BEFORE_END);
+    reset_log_items();
+    socc_begin(&(socc_begin_desc){ .view_proj = socc_mat4(identity) });
+    socc_add_occluder(&(socc_occluder_desc){ .vertices = { .ptr = v, .size = 20 } });
+    T(log_items[0] == SOCC_LOGITEM_ADD_OCCLUDER_INVALID_VERTICES);
+    reset_log_items();
+    const uint16_t bad_indices[3] = { 0, 1, 3 };
+    socc_add_occluder(&(socc_occluder_desc){ .vertices = SG_RANGE(v), .indices = SG_RANGE(bad_indices) });
+    T(log_items[0] == SOCC_LOGITEM_ADD_OCCLUDER_INDEX_OUT_OF_RANGE);
+    reset_log_items();
+    socc_add_occluder(&(socc_occluder_desc){ .vertices = SG_RANGE(v), .indices = { .ptr = bad_indices, .size = 3 } });
+    T(log_items[0] == SOCC_LOGITEM_ADD_OCCLUDER_INVALID_INDICES);
+    socc_end();
+    T(socc_query_stats().num_triangles == 0);
+    shutdown();
+}
+
+UTEST(sokol_occlusion, triangle_buffer_full) {
+    init_with_desc(&(socc_desc){ .max_triangles = 1 });
+    socc_begin(&(socc_begin_desc){ .view_proj = socc_mat4(identity) });
+    add_quad(-0.5f, -0.5f, 0.5f, 0.5f, 0.5f);
+    T(log_items[0] == SOCC_LOGITEM_TRIANGLE_BUFFER_FULL);
+    socc_end();
+    T(socc_query_stats().num_triangles == 1);
+    shutdown();
+}
+
+UTEST(sokol_occlusion, mat4_transpose) {
+    const float m[16] = { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15 };
+    const socc_mat4_t r = socc_mat4(m);
+    const socc_mat4_t t = socc_mat4_transpose(m);
+    T(r.m[1][2] == 6.0f);
+    T(t.m[2][1] == 6.0f);
+    T(t.m[3][0] == 3.0f);
+}
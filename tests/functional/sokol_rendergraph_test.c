@@ -0,0 +1,420 @@
+//------------------------------------------------------------------------------
+//  sokol-rendergraph-test.c
+//------------------------------------------------------------------------------
+#include "sokol_gfx.h"
+#define SOKOL_RENDERGRAPH_IMPL
+#include "sokol_rendergraph.h"
+#include "utest.h"
+
+#define T(b) EXPECT_TRUE(b)
+
+#define MAX_LOG_ITEMS (8)
+static int num_log_called;
+static srg_log_item log_items[MAX_LOG_ITEMS];
+
+static void test_logger(const char* tag, uint32_t log_level, uint32_t log_item_id, const char* message_or_null, uint32_t line_nr, const char* filename_or_null, void* user_data) {
+    (void)tag; (void)log_level; (void)message_or_null; (void)line_nr; (void)filename_or_null; (void)user_data;
+    if (num_log_called < MAX_LOG_ITEMS) {
+        log_items[num_log_called] = (srg_log_item)log_item_id;
+    }
+    num_log_called++;
+}
+
+static void reset_log_items(void) {
+    num_log_called = 0;
+    for (int i = 0; i < MAX_LOG_ITEMS; i++) {
+        log_items[i] = SRG_LOGITEM_OK;
+    }
+}
+
+static void init_with_desc(const srg_desc* desc) {
+    reset_log_items();
+    sg_setup(&(sg_desc){0});
+    srg_desc d = *desc;
+    d.logger.func = test_logger;
+    srg_setup(&d);
+}
+
+static void init(void) {
+    init_with_desc(&(srg_desc){0});
+}
+
+static void shutdown(void) {
+    srg_shutdown();
+    sg_shutdown();
+}
+
+static sg_swapchain swapchain(void) {
+    return (sg_swapchain){
+        .width = 256,
+        .height = 128,
+        .sample_count = 1,
+        .color_format = SG_PIXELFORMAT_RGBA8,
+        .depth_format = SG_PIXELFORMAT_DEPTH_STENCIL,
+    };
+}
+
+static void count_pass(void* user_data) {
+    (*(int*)user_data)++;
+}
+
+UTEST(sokol_rendergraph, default_init_shutdown) {
+    init();
+    T(_srg.init_tag == _SRG_INIT_TAG);
+    T(_srg.desc.max_passes == 64);
+    T(_srg.desc.max_attachments == 64);
+    T(_srg.desc.max_images == 64);
+    T(_srg.desc.max_idle_frames == 8);
+    T(_srg.passes);
+    T(_srg.attachments);
+    T(_srg.images);
+    shutdown();
+    T(_srg.init_tag == 0);
+}
+
+UTEST(sokol_rendergraph, create_attachment_defaults) {
+    init();
+    srg_begin(256, 128);
+    srg_attachment a0 = srg_create_attachment(&(srg_attachment_desc){0});
+    srg_attachment a1 = srg_create_attachment(&(srg_attachment_desc){ .scale = 0.5f, .pixel_format = SG_PIXELFORMAT_RGBA16F });
+    srg_attachment a2 = srg_create_attachment(&(srg_attachment_desc){ .width = 32, .height = 16, .pixel_format = SG_PIXELFORMAT_DEPTH, .sample_count = 4 });
+    T(a0.id != SRG_INVALID_ID);
+    T(a1.id != SRG_INVALID_ID);
+    T(a2.id != SRG_INVALID_ID);
+    T(_srg.attachments[0].width == 256);
+    T(_srg.attachments[0].height == 128);
+    T(_srg.attachments[0].pixel_format == sg_query_desc().environment.defaults.color_format);
+    T(_srg.attachments[0].sample_count == 1);
+    T(!_srg.attachments[0].is_depth);
+    T(_srg.attachments[1].width == 128);
+    T(_srg.attachments[1].height == 64);
+    T(_srg.attachments[1].pixel_format == SG_PIXELFORMAT_RGBA16F);
+    T(_srg.attachments[2].width == 32);
+    T(_srg.attachments[2].height == 16);
+    T(_srg.attachments[2].sample_count == 4);
+    T(_srg.attachments[2].is_depth);
+    srg_execute();
+    T(num_log_called == 0);
+    shutdown();
+}
+
+UTEST(sokol_rendergraph, cull_unused_passes) {
+    init();
+    int num_a = 0, num_b = 0, num_c = 0;
+    srg_begin(256, 128);
+    srg_attachment a = srg_create_attachment(&(srg_attachment_desc){0});
+    srg_attachment b = srg_create_attachment(&(srg_attachment_desc){0});
+    srg_add_pass(&(srg_pass_desc){ .colors[0] = a, .func = count_pass, .user_data = &num_a });
+    srg_add_pass(&(srg_pass_desc){ .colors[0] = b, .func = count_pass, .user_data = &num_b });
+    srg_add_pass(&(srg_pass_desc){ .to_swapchain = true, .swapchain = swapchain(), .reads[0] = a, .func = count_pass, .user_data = &num_c });
+    srg_execute();
+    T(num_a == 1);
+    T(num_b == 0);
+    T(num_c == 1);
+    const srg_stats stats = srg_query_stats();
+    T(stats.num_passes == 3);
+    T(stats.num_culled_passes == 1);
+    T(stats.num_attachments == 2);
+    T(stats.num_used_attachments == 1);
+    T(stats.num_images == 1);
+    T(srg_image(a).id != SG_INVALID_ID);
+    T(srg_texture_view(a).id != SG_INVALID_ID);
+    T(srg_image(b).id == SG_INVALID_ID);
+    T(srg_texture_view(b).id == SG_INVALID_ID);
+    T(num_log_called == 0);
+    shutdown();
+}
+
+UTEST(sokol_rendergraph, keep_pass) {
+    init();
+    int num_a = 0;
+    srg_begin(256, 128);
+    srg_attachment a = srg_create_attachment(&(srg_attachment_desc){0});
+    srg_add_pass(&(srg_pass_desc){ .colors[0] = a, .keep = true, .func = count_pass, .user_data = &num_a });
+    srg_execute();
+    T(num_a == 1);
+    T(srg_query_stats().num_culled_passes == 0);
+    shutdown();
+}
+
+UTEST(sokol_rendergraph, cull_overwritten_pass) {
+    init();
+    int num_a = 0, num_b = 0;
+    srg_begin(256, 128);
+    srg_attachment a = srg_create_attachment(&(srg_attachment_desc){0});
+    srg_add_pass(&(srg_pass_desc){ .colors[0] = a, .func = count_pass, .user_data = &num_a });
+    // the second pass clears the attachment, so the first pass is not needed
+    srg_add_pass(&(srg_pass_desc){ .colors[0] = a, .keep = true, .func = count_pass, .user_data = &num_b });
+    srg_execute();
+    T(num_a == 0);
+    T(num_b == 1);
+    shutdown();
+}
+
+UTEST(sokol_rendergraph, load_action_keeps_previous_writer) {
+    init();
+    int num_a = 0, num_b = 0;
+    srg_begin(256, 128);
+    srg_attachment a = srg_create_attachment(&(srg_attachment_desc){0});
+    srg_add_pass(&(srg_pass_desc){ .colors[0] = a, .func = count_pass, .user_data = &num_a });
+    srg_add_pass(&(srg_pass_desc){
+        .action.colors[0].load_action = SG_LOADACTION_LOAD,
+        .colors[0] = a,
+        .keep = true,
+        .func = count_pass,
+        .user_data = &num_b,
+    });
+    srg_execute();
+    T(num_a == 1);
+    T(num_b == 1);
+    shutdown();
+}
+
+UTEST(sokol_rendergraph, reads_depend_on_most_recent_writer) {
+    init();
+    int num_a = 0, num_b = 0, num_c = 0, num_d = 0;
+    srg_begin(256, 128);
+    srg_attachment a = srg_create_attachment(&(srg_attachment_desc){0});
+    srg_attachment b = srg_create_attachment(&(srg_attachment_desc){0});
+    srg_add_pass(&(srg_pass_desc){ .colors[0] = a, .func = count_pass, .user_data = &num_a });
+    srg_add_pass(&(srg_pass_desc){ .colors[0] = b, .reads[0] = a, .func = count_pass, .user_data = &num_b });
+    srg_add_pass(&(srg_pass_desc){ .colors[0] = a, .func = count_pass, .user_data = &num_c });
+    srg_add_pass(&(srg_pass_desc){ .to_swapchain = true, .swapchain = swapchain(), .reads[0] = a, .func = count_pass, .user_data = &num_d });
+    srg_execute();
+    T(num_a == 0);
+    T(num_b == 0);
+    T(num_c == 1);
+    T(num_d == 1);
+    T(srg_query_stats().num_culled_passes == 2);
+    shutdown();
+}
+
+UTEST(sokol_rendergraph, alias_non_overlapping_attachments) {
+    init();
+    srg_begin(256, 128);
+    srg_attachment a = srg_create_attachment(&(srg_attachment_desc){0});
+    srg_attachment b = srg_create_attachment(&(srg_attachment_desc){0});
+    srg_attachment c = srg_create_attachment(&(srg_attachment_desc){0});
+    srg_attachment d = srg_create_attachment(&(srg_attachment_desc){0});
+    srg_add_pass(&(srg_pass_desc){ .colors[0] = a });
+    srg_add_pass(&(srg_pass_desc){ .colors[0] = b, .reads[0] = a });
+    srg_add_pass(&(srg_pass_desc){ .colors[0] = c, .reads[0] = b });
+    srg_add_pass(&(srg_pass_desc){ .colors[0] = d, .reads[0] = c });
+    srg_add_pass(&(srg_pass_desc){ .to_swapchain = true, .swapchain = swapchain(), .reads[0] = d });
+    srg_execute();
+    T(srg_image(a).id == srg_image(c).id);
+    T(srg_image(b).id == srg_image(d).id);
+    T(srg_image(a).id != srg_image(b).id);
+    T(srg_texture_view(a).id == srg_texture_view(c).id);
+    const srg_stats stats = srg_query_stats();
+    T(stats.num_used_attachments == 4);
+    T(stats.num_images == 2);
+    T(stats.num_cached_images == 2);
+    shutdown();
+}
+
+UTEST(sokol_rendergraph, no_alias_overlapping_attachments) {
+    init();
+    srg_begin(256, 128);
+    srg_attachment a = srg_create_attachment(&(srg_attachment_desc){0});
+    srg_attachment b = srg_create_attachment(&(srg_attachment_desc){0});
+    srg_attachment c = srg_create_attachment(&(srg_attachment_desc){0});
+    srg_add_pass(&(srg_pass_desc){ .colors[0] = a });
+    srg_add_pass(&(srg_pass_desc){ .colors[0] = b, .reads[0] = a });
+    // 'a' is still alive here
+    srg_add_pass(&(srg_pass_desc){ .colors[0] = c, .reads = { a, b } });
+    srg_add_pass(&(srg_pass_desc){ .to_swapchain = true, .swapchain = swapchain(), .reads[0] = c });
+    srg_execute();
+    T(srg_image(a).id != srg_image(b).id);
+    T(srg_image(a).id != srg_image(c).id);
+    T(srg_image(b).id != srg_image(c).id);
+    T(srg_query_stats().num_images == 3);
+    shutdown();
+}
+
+UTEST(sokol_rendergraph, no_alias_incompatible_attachments) {
+    init();
+    srg_begin(256, 128);
+    srg_attachment a = srg_create_attachment(&(srg_attachment_desc){0});
+    srg_attachment b = srg_create_attachment(&(srg_attachment_desc){0});
+    srg_attachment c = srg_create_attachment(&(srg_attachment_desc){ .scale = 0.5f });
+    srg_attachment d = srg_create_attachment(&(srg_attachment_desc){ .pixel_format = SG_PIXELFORMAT_RGBA16F });
+    srg_add_pass(&(srg_pass_desc){ .colors[0] = a });
+    srg_add_pass(&(srg_pass_desc){ .colors[0] = b, .reads[0] = a });
+    srg_add_pass(&(srg_pass_desc){ .colors[0] = c, .reads[0] = b });
+    srg_add_pass(&(srg_pass_desc){ .colors[0] = d, .reads[0] = c });
+    srg_add_pass(&(srg_pass_desc){ .to_swapchain = true, .swapchain = swapchain(), .reads[0] = d });
+    srg_execute();
+    T(srg_image(c).id != srg_image(a).id);
+    T(srg_image(d).id != srg_image(a).id);
+    T(srg_image(d).id != srg_image(b).id);
+    T(srg_query_stats().num_images == 4);
+    shutdown();
+}
+
+UTEST(sokol_rendergraph, depth_and_resolve_attachments) {
+    init();
+    srg_begin(256, 128);
+    srg_attachment msaa = srg_create_attachment(&(srg_attachment_desc){ .sample_count = 4 });
+    srg_attachment resolve = srg_create_attachment(&(srg_attachment_desc){0});
+    srg_attachment depth = srg_create_attachment(&(srg_attachment_desc){ .pixel_format = SG_PIXELFORMAT_DEPTH_STENCIL, .sample_count = 4 });
+    srg_add_pass(&(srg_pass_desc){ .colors[0] = msaa, .resolves[0] = resolve, .depth_stencil = depth });
+    srg_add_pass(&(srg_pass_desc){ .to_swapchain = true, .swapchain = swapchain(), .reads[0] = resolve });
+    srg_execute();
+    T(srg_image(msaa).id != SG_INVALID_ID);
+    T(srg_image(resolve).id != SG_INVALID_ID);
+    T(srg_image(depth).id != SG_INVALID_ID);
+    T(sg_query_image_state(srg_image(msaa)) == SG_RESOURCESTATE_VALID);
+    T(sg_query_image_state(srg_image(resolve)) == SG_RESOURCESTATE_VALID);
+    T(sg_query_image_state(srg_image(depth)) == SG_RESOURCESTATE_VALID);
+    T(srg_query_stats().num_images == 3);
+    T(num_log_called == 0);
+    shutdown();
+}
+
+UTEST(sokol_rendergraph, images_cached_across_frames) {
+    init_with_desc(&(srg_desc){ .max_idle_frames = 2 });
+    srg_begin(256, 128);
+    srg_attachment a = srg_create_attachment(&(srg_attachment_desc){0});
+    srg_add_pass(&(srg_pass_desc){ .colors[0] = a, .keep = true });
+    srg_execute();
+    const sg_image img0 = srg_image(a);
+    srg_begin(256, 128);
+    a = srg_create_attachment(&(srg_attachment_desc){0});
+    srg_add_pass(&(srg_pass_desc){ .colors[0] = a, .keep = true });
+    srg_execute();
+    T(srg_image(a).id == img0.id);
+    T(srg_query_stats().num_cached_images == 1);
+    // a resized attachment needs a new image, the old image stays alive for max_idle_frames
+    srg_begin(512, 256);
+    a = srg_create_attachment(&(srg_attachment_desc){0});
+    srg_add_pass(&(srg_pass_desc){ .colors[0] = a, .keep = true });
+    srg_execute();
+    T(srg_image(a).id != img0.id);
+    T(srg_query_stats().num_images == 1);
+    T(srg_query_stats().num_cached_images == 2);
+    T(sg_query_image_state(img0) == SG_RESOURCESTATE_VALID);
+    for (int i = 0; i < 2; i++) {
+        srg_begin(512, 256);
+        srg_execute();
+    }
+    T(srg_query_stats().num_cached_images == 0);
+    T(sg_query_image_state(img0) == SG_RESOURCESTATE_INVALID);
+    shutdown();
+}
+
+UTEST(sokol_rendergraph, outdated_attachment_handle) {
+    init();
+    srg_begin(256, 128);
+    srg_attachment a = srg_create_attachment(&(srg_attachment_desc){0});
+    srg_execute();
+    srg_begin(256, 128);
+    reset_log_items();
+    srg_add_pass(&(srg_pass_desc){ .colors[0] = a, .keep = true });
+    T(log_items[0] == SRG_LOGITEM_PASS_INVALID_ATTACHMENT);
+    T(_srg.num_passes == 0);
+    srg_execute();
+    T(srg_image(a).id == SG_INVALID_ID);
+    shutdown();
+}
+
+UTEST(sokol_rendergraph, read_write_same_attachment) {
+    init();
+    srg_begin(256, 128);
+    srg_attachment a = srg_create_attachment(&(srg_attachment_desc){0});
+    srg_add_pass(&(srg_pass_desc){ .colors[0] = a, .reads[0] = a, .keep = true });
+    T(log_items[0] == SRG_LOGITEM_PASS_READ_WRITE_SAME_ATTACHMENT);
+    T(_srg.num_passes == 0);
+    srg_execute();
+    shutdown();
+}
+
+UTEST(sokol_rendergraph, invalid_pass_attachments) {
+    init();
+    srg_begin(256, 128);
+    srg_attachment color = srg_create_attachment(&(srg_attachment_desc){0});
+    srg_attachment msaa = srg_create_attachment(&(srg_attachment_desc){ .sample_count = 4 });
+    srg_attachment depth = srg_create_attachment(&(srg_attachment_desc){ .pixel_format = SG_PIXELFORMAT_DEPTH });
+    srg_add_pass(&(srg_pass_desc){ .colors[0] = depth });
+    T(log_items[0] == SRG_LOGITEM_PASS_COLOR_IS_DEPTH);
+    reset_log_items();
+    srg_add_pass(&(srg_pass_desc){ .colors[0] = color, .depth_stencil = color });
+    T(log_items[0] == SRG_LOGITEM_PASS_DEPTH_IS_COLOR);
+    reset_log_items();
+    srg_add_pass(&(srg_pass_desc){ .colors[0] = msaa, .resolves[0] = msaa });
+    T(log_items[0] == SRG_LOGITEM_PASS_RESOLVE_IS_MSAA);
+    reset_log_items();
+    srg_add_pass(&(srg_pass_desc){ .to_swapchain = true, .swapchain = swapchain(), .colors[0] = color });
+    T(log_items[0] == SRG_LOGITEM_PASS_SWAPCHAIN_ATTACHMENTS);
+    reset_log_items();
+    srg_add_pass(&(srg_pass_desc){ .reads[0] = color });
+    T(log_items[0] == SRG_LOGITEM_PASS_NO_ATTACHMENTS);
+    T(_srg.num_passes == 0);
+    srg_execute();
+    shutdown();
+}
+
+UTEST(sokol_rendergraph, read_unwritten_attachment) {
+    init();
+    srg_begin(256, 128);
+    srg_attachment a = srg_create_attachment(&(srg_attachment_desc){0});
+    srg_add_pass(&(srg_pass_desc){ .to_swapchain = true, .swapchain = swapchain(), .reads[0] = a });
+    srg_execute();
+    T(log_items[0] == SRG_LOGITEM_PASS_READ_UNWRITTEN_ATTACHMENT);
+    shutdown();
+}
+
+UTEST(sokol_rendergraph, pass_pool_exhausted) {
+    init_with_desc(&(srg_desc){ .max_passes = 2 });
+    srg_begin(256, 128);
+    srg_attachment a = srg_create_attachment(&(srg_attachment_desc){0});
+    srg_add_pass(&(srg_pass_desc){ .colors[0] = a, .keep = true });
+    srg_add_pass(&(srg_pass_desc){ .colors[0] = a, .keep = true });
+    T(num_log_called == 0);
+    srg_add_pass(&(srg_pass_desc){ .colors[0] = a, .keep = true });
+    T(log_items[0] == SRG_LOGITEM_PASS_POOL_EXHAUSTED);
+    T(_srg.num_passes == 2);
+    srg_execute();
+    shutdown();
+}
+
+UTEST(sokol_rendergraph, attachment_pool_exhausted) {
+    init_with_desc(&(srg_desc){ .max_attachments = 1 });
+    srg_begin(256, 128);
+    srg_attachment a = srg_create_attachment(&(srg_attachment_desc){0});
+    T(a.id != SRG_INVALID_ID);
+    srg_attachment b = srg_create_attachment(&(srg_attachment_desc){0});
+    T(b.id == SRG_INVALID_ID);
+    T(log_items[0] == SRG_LOGITEM_ATTACHMENT_POOL_EXHAUSTED);
+    srg_execute();
+    shutdown();
+}
+
+UTEST(sokol_rendergraph, image_pool_exhausted) {
+    init_with_desc(&(srg_desc){ .max_images = 1 });
+    int num_a = 0, num_b = 0;
+    srg_begin(256, 128);
+    srg_attachment a = srg_create_attachment(&(srg_attachment_desc){0});
+    srg_attachment b = srg_create_attachment(&(srg_attachment_desc){0});
+    srg_add_pass(&(srg_pass_desc){ .colors[0] = a, .func = count_pass, .user_data = &num_a });
+    srg_add_pass(&(srg_pass_desc){ .colors[0] = b, .reads[0] = a, .keep = true, .func = count_pass, .user_data = &num_b });
+    srg_execute();
+    T(log_items[0] == SRG_LOGITEM_IMAGE_POOL_EXHAUSTED);
+    T(num_a == 1);
+    T(num_b == 0);
+    T(srg_image(b).id == SG_INVALID_ID);
+    shutdown();
+}
+
+UTEST(sokol_rendergraph, begin_not_called) {
+    init();
+    srg_attachment a = srg_create_attachment(&(srg_attachment_desc){0});
+    T(a.id == SRG_INVALID_ID);
+    T(log_items[0] == SRG_LOGITEM_BEGIN_NOT_CALLED);
+    reset_log_items();
+    srg_begin(256, 128);
+    srg_begin(256, 128);
+    T(log_items[0] == SRG_LOGITEM_EXECUTE_NOT_CALLED);
+    srg_execute();
+    shutdown();
+}
@@ -0,0 +1,245 @@
+//------------------------------------------------------------------------------
+//  sokol-sprite-test.c
+//  NOTE: the dummy backend doesn't support storage buffers, so these tests
+//  only cover CPU-side recording and batching
+//------------------------------------------------------------------------------
+#include "sokol_gfx.h"
+#define SOKOL_SPRITE_IMPL
+#include "sokol_sprite.h"
+#include "utest.h"
+
+#define T(b) EXPECT_TRUE(b)
+
+#define MAX_LOG_ITEMS (8)
+static int num_log_called;
+static ssprite_log_item log_items[MAX_LOG_ITEMS];
+
+static void test_logger(const char* tag, uint32_t log_level, uint32_t log_item_id, const char* message_or_null, uint32_t line_nr, const char* filename_or_null, void* user_data) {
+    (void)tag; (void)log_level; (void)message_or_null; (void)line_nr; (void)filename_or_null; (void)user_data;
+    if (num_log_called < MAX_LOG_ITEMS) {
+        log_items[num_log_called] = (ssprite_log_item)log_item_id;
+    }
+    num_log_called++;
+}
+
+static void reset_log_items(void) {
+    num_log_called = 0;
+    for (int i = 0; i < MAX_LOG_ITEMS; i++) {
+        log_items[i] = SSPRITE_LOGITEM_OK;
+    }
+}
+
+static void init_with_desc(const ssprite_desc* desc) {
+    sg_setup(&(sg_desc){0});
+    reset_log_items();
+    ssprite_desc d = *desc;
+    d.logger.func = test_logger;
+    ssprite_setup(&d);
+}
+
+static void init(void) {
+    init_with_desc(&(ssprite_desc){0});
+}
+
+static void shutdown(void) {
+    ssprite_shutdown();
+    sg_shutdown();
+}
+
+static ssprite_sprite sprite_at(float x, float y) {
+    return (ssprite_sprite){ .x = x, .y = y, .width = 1.0f, .height = 1.0f };
+}
+
+UTEST(sokol_sprite, default_init_shutdown) {
+    init();
+    T(_ssprite.init_tag == _SSPRITE_INIT_TAG);
+    T(_ssprite.desc.max_sprites == 65536);
+    T(_ssprite.desc.max_batches == 256);
+    T(_ssprite.desc.max_gpu_sprites == 0);
+    T(_ssprite.sprites);
+    T(_ssprite.batches);
+    // the dummy backend doesn't support storage buffers
+    T(!_ssprite.valid);
+    T(num_log_called == 1);
+    T(log_items[0] == SSPRITE_LOGITEM_STORAGE_BUFFERS_NOT_SUPPORTED);
+    T(ssprite_query_gpu_buffer().id == SG_INVALID_ID);
+    shutdown();
+    T(_ssprite.init_tag == 0);
+}
+
+UTEST(sokol_sprite, embedded_shader) {
+    init();
+    // the shader is only created with storage buffer support, so create it
+    // directly to check that the embedded shader desc passes validation
+    _ssprite_init_shader();
+    T(_ssprite.own_shd);
+    T(sg_query_shader_state(_ssprite.shd) == SG_RESOURCESTATE_VALID);
+    T(num_log_called == 1);
+    sg_destroy_shader(_ssprite.shd);
+    _ssprite.own_shd = false;
+    shutdown();
+}
+
+UTEST(sokol_sprite, init_with_params) {
+    init_with_desc(&(ssprite_desc){
+        .max_sprites = 128,
+        .max_batches = 4,
+        .max_gpu_sprites = 1024,
+    });
+    T(_ssprite.desc.max_sprites == 128);
+    T(_ssprite.desc.max_batches == 4);
+    T(_ssprite.desc.max_gpu_sprites == 1024);
+    shutdown();
+}
+
+UTEST(sokol_sprite, sprite_size) {
+    T(sizeof(ssprite_sprite) == 36);
+}
+
+UTEST(sokol_sprite, pack_uv) {
+    T(ssprite_pack_uv(0.0f, 0.0f) == 0);
+    T(ssprite_pack_uv(1.0f, 0.0f) == 0x0000FFFF);
+    T(ssprite_pack_uv(0.0f, 1.0f) == 0xFFFF0000);
+    T(ssprite_pack_uv(1.0f, 1.0f) == 0xFFFFFFFF);
+    T(ssprite_pack_uv(0.5f, 0.5f) == 0x80008000);
+    T(ssprite_pack_uv(-1.0f, 2.0f) == 0xFFFF0000);
+}
+
+UTEST(sokol_sprite, pack_color) {
+    T(ssprite_pack_color(1.0f, 0.0f, 0.0f, 1.0f) == 0xFF0000FF);
+    T(ssprite_pack_color(0.0f, 1.0f, 0.0f, 0.0f) == 0x0000FF00);
+    T(ssprite_pack_color(0.0f, 0.0f, 1.0f, 0.5f) == 0x80FF0000);
+    T(ssprite_pack_color(2.0f, -1.0f, 1.0f, 1.0f) == 0xFFFF00FF);
+}
+
+UTEST(sokol_sprite, mat4) {
+    const float m[16] = { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15 };
+    const ssprite_mat4_t m0 = ssprite_mat4(m);
+    T(m0.m[0][1] == 1.0f);
+    T(m0.m[3][0] == 12.0f);
+    const ssprite_mat4_t m1 = ssprite_mat4_transpose(m);
+    T(m1.m[0][1] == 4.0f);
+    T(m1.m[3][0] == 3.0f);
+}
+
+UTEST(sokol_sprite, implicit_default_batch) {
+    init();
+    const ssprite_sprite s = sprite_at(1.0f, 2.0f);
+    ssprite_add(&s);
+    T(_ssprite.num_batches == 1);
+    T(_ssprite.num_sprites == 1);
+    T(_ssprite.batches[0].first == 0);
+    T(_ssprite.batches[0].num == 1);
+    T(_ssprite.batches[0].desc.blend_mode == SSPRITE_BLENDMODE_ALPHA);
+    T(_ssprite.batches[0].desc.mvp.m[0][0] == 1.0f);
+    T(_ssprite.batches[0].desc.mvp.m[3][3] == 1.0f);
+    T(_ssprite.batches[0].desc.right[0] == 1.0f);
+    T(_ssprite.batches[0].desc.up[1] == 1.0f);
+    T(_ssprite.sprites[0].x == 1.0f);
+    T(_ssprite.sprites[0].y == 2.0f);
+    shutdown();
+}
+
+UTEST(sokol_sprite, batch_merging) {
+    init();
+    const ssprite_sprite s = sprite_at(0.0f, 0.0f);
+    ssprite_batch(&(ssprite_batch_desc){0});
+    ssprite_add(&s);
+    // an identical batch continues the current batch
+    ssprite_batch(&(ssprite_batch_desc){0});
+    ssprite_add(&s);
+    T(_ssprite.num_batches == 1);
+    T(_ssprite.batches[0].num == 2);
+    // a different batch starts a new batch
+    ssprite_batch(&(ssprite_batch_desc){ .blend_mode = SSPRITE_BLENDMODE_ADDITIVE });
+    ssprite_add(&s);
+    T(_ssprite.num_batches == 2);
+    T(_ssprite.batches[1].first == 2);
+    T(_ssprite.batches[1].num == 1);
+    T(_ssprite.batches[1].desc.blend_mode == SSPRITE_BLENDMODE_ADDITIVE);
+    // an empty batch is replaced
+    ssprite_batch(&(ssprite_batch_desc){ .blend_mode = SSPRITE_BLENDMODE_NONE });
+    ssprite_batch(&(ssprite_batch_desc){ .up = { 0.0f, 0.0f, 1.0f } });
+    T(_ssprite.num_batches == 3);
+    T(_ssprite.batches[2].desc.blend_mode == SSPRITE_BLENDMODE_ALPHA);
+    T(_ssprite.batches[2].desc.up[1] == 0.0f);
+    T(_ssprite.batches[2].desc.up[2] == 1.0f);
+    T(num_log_called == 1);
+    shutdown();
+}
+
+UTEST(sokol_sprite, add_many) {
+    init();
+    ssprite_sprite sprites[16];
+    for (int i = 0; i < 16; i++) {
+        sprites[i] = sprite_at((float)i, 0.0f);
+    }
+    ssprite_add_many(sprites, 16);
+    ssprite_add_many(sprites, 0);
+    T(_ssprite.num_sprites == 16);
+    T(_ssprite.batches[0].num == 16);
+    T(_ssprite.sprites[15].x == 15.0f);
+    shutdown();
+}
+
+UTEST(sokol_sprite, sprite_buffer_full) {
+    init_with_desc(&(ssprite_desc){ .max_sprites = 8 });
+    ssprite_sprite sprites[6];
+    for (int i = 0; i < 6; i++) {
+        sprites[i] = sprite_at((float)i, 0.0f);
+    }
+    ssprite_add_many(sprites, 6);
+    reset_log_items();
+    ssprite_add_many(sprites, 6);
+    T(num_log_called == 1);
+    T(log_items[0] == SSPRITE_LOGITEM_SPRITE_BUFFER_FULL);
+    T(_ssprite.num_sprites == 8);
+    T(_ssprite.batches[0].num == 8);
+    T(_ssprite.sprites[7].x == 1.0f);
+    shutdown();
+}
+
+UTEST(sokol_sprite, batch_pool_exhausted) {
+    init_with_desc(&(ssprite_desc){ .max_batches = 2 });
+    const ssprite_sprite s = sprite_at(0.0f, 0.0f);
+    ssprite_batch(&(ssprite_batch_desc){ .blend_mode = SSPRITE_BLENDMODE_ALPHA });
+    ssprite_add(&s);
+    ssprite_batch(&(ssprite_batch_desc){ .blend_mode = SSPRITE_BLENDMODE_ADDITIVE });
+    ssprite_add(&s);
+    reset_log_items();
+    ssprite_batch(&(ssprite_batch_desc){ .blend_mode = SSPRITE_BLENDMODE_NONE });
+    T(num_log_called == 1);
+    T(log_items[0] == SSPRITE_LOGITEM_BATCH_POOL_EXHAUSTED);
+    // sprites are added to the last valid batch
+    ssprite_add(&s);
+    T(_ssprite.num_batches == 2);
+    T(_ssprite.batches[1].num == 2);
+    shutdown();
+}
+
+UTEST(sokol_sprite, draw_resets_state) {
+    init();
+    const ssprite_sprite s = sprite_at(0.0f, 0.0f);
+    ssprite_add(&s);
+    ssprite_batch(&(ssprite_batch_desc){ .blend_mode = SSPRITE_BLENDMODE_ADDITIVE });
+    ssprite_add(&s);
+    ssprite_draw();
+    T(_ssprite.num_sprites == 0);
+    T(_ssprite.num_batches == 0);
+    // nothing is rendered without storage buffer support
+    const ssprite_stats stats = ssprite_query_stats();
+    T(stats.num_sprites == 0);
+    T(stats.num_batches == 0);
+    T(stats.num_bytes == 0);
+    shutdown();
+}
+
+UTEST(sokol_sprite, gpu_functions_without_support) {
+    init_with_desc(&(ssprite_desc){ .max_gpu_sprites = 256 });
+    reset_log_items();
+    ssprite_simulate(&(ssprite_simulate_desc){0});
+    ssprite_draw_gpu(&(ssprite_gpu_draw_desc){0});
+    T(num_log_called == 0);
+    T(ssprite_query_gpu_buffer().id == SG_INVALID_ID);
+    shutdown();
+}
@@ -0,0 +1,375 @@
+//------------------------------------------------------------------------------
+//  sokol-vertexpack-test.c
+//------------------------------------------------------------------------------
+#include "sokol_gfx.h"
+#define SOKOL_VERTEXPACK_IMPL
+#include "sokol_vertexpack.h"
+#include "utest.h"
+#include <math.h>
+
+#define T(b) EXPECT_TRUE(b)
+
+static bool feq(float a, float b, float eps) {
+    return fabsf(a - b) <= eps;
+}
+
+static const float positions[4][3] = {
+    { -2.0f, 0.0f, 1.0f },
+    {  2.0f, 1.0f, 1.0f },
+    {  0.0f, 4.0f, 3.0f },
+    {  1.0f, 2.0f, 2.0f },
+};
+static const float normals[4][3] = {
+    { 0.0f, 0.0f, 1.0f },
+    { 0.0f, 0.0f, -1.0f },
+    { 0.57735f, -0.57735f, 0.57735f },
+    { -0.6f, 0.0f, -0.8f },
+};
+static const float texcoords[4][2] = {
+    { 0.0f, 0.0f },
+    { 1.0f, 0.5f },
+    { 0.25f, 0.75f },
+    { -1.5f, 2.0f },
+};
+static const float colors[4][4] = {
+    { 1.0f, 0.0f, 0.0f, 1.0f },
+    { 0.0f, 1.0f, 0.0f, 1.0f },
+    { 0.0f, 0.0f, 1.0f, 0.5f },
+    { 1.0f, 1.0f, 1.0f, 0.0f },
+};
+
+UTEST(sokol_vertexpack, stride_and_size) {
+    svpack_desc desc = {
+        .num_vertices = 4,
+        .positions = { .data = SG_RANGE(positions) },
+    };
+    T(svpack_vertex_stride(&desc) == 8);
+    desc.normals.data = SG_RANGE(normals);
+    desc.texcoords.data = SG_RANGE(texcoords);
+    T(svpack_vertex_stride(&desc) == 16);
+    T(svpack_buffer_size(&desc) == 64);
+    desc.colors.data = SG_RANGE(colors);
+    T(svpack_vertex_stride(&desc) == 20);
+    desc.formats = (svpack_formats){
+        .position = SVPACK_POSITION_FLOAT3,
+        .normal = SVPACK_NORMAL_FLOAT3,
+        .texcoord = SVPACK_TEXCOORD_FLOAT2,
+        .color = SVPACK_COLOR_FLOAT4,
+    };
+    T(svpack_vertex_stride(&desc) == 48);
+    T(svpack_buffer_size(&desc) == 192);
+}
+
+UTEST(sokol_vertexpack, default_layout) {
+    uint8_t buf[4 * 20];
+    const svpack_result res = svpack_pack(&(svpack_desc){
+        .num_vertices = 4,
+        .positions = { .data = SG_RANGE(positions) },
+        .normals = { .data = SG_RANGE(normals) },
+        .texcoords = { .data = SG_RANGE(texcoords) },
+        .colors = { .data = SG_RANGE(colors) },
+        .buffer = SG_RANGE(buf),
+    });
+    T(res.valid);
+    T(res.num_vertices == 4);
+    T(res.stride == 20);
+    T(res.size == sizeof(buf));
+    T(res.formats.position == SVPACK_POSITION_SHORT4N);
+    T(res.formats.normal == SVPACK_NORMAL_OCT_SHORT2N);
+    T(res.formats.texcoord == SVPACK_TEXCOORD_HALF2);
+    T(res.formats.color == SVPACK_COLOR_UBYTE4N);
+    T(res.layout.buffers[0].stride == 20);
+    T(res.layout.attrs[0].format == SG_VERTEXFORMAT_SHORT4N);
+    T(res.layout.attrs[0].offset == 0);
+    T(res.layout.attrs[1].format == SG_VERTEXFORMAT_SHORT2N);
+    T(res.layout.attrs[1].offset == 8);
+    T(res.layout.attrs[2].format == SG_VERTEXFORMAT_HALF2);
+    T(res.layout.attrs[2].offset == 12);
+    T(res.layout.attrs[3].format == SG_VERTEXFORMAT_UBYTE4N);
+    T(res.layout.attrs[3].offset == 16);
+    T(res.layout.attrs[4].format == SG_VERTEXFORMAT_INVALID);
+    T(res.position.format == SG_VERTEXFORMAT_SHORT4N);
+    T(res.color.offset == 16);
+}
+
+UTEST(sokol_vertexpack, layout_without_optional_components) {
+    uint8_t buf[4 * 12];
+    const svpack_result res = svpack_pack(&(svpack_desc){
+        .num_vertices = 4,
+        .positions = { .data = SG_RANGE(positions) },
+        .texcoords = { .data = SG_RANGE(texcoords) },
+        .buffer_index = 2,
+        .buffer = SG_RANGE(buf),
+    });
+    T(res.valid);
+    T(res.stride == 12);
+    T(res.layout.buffers[0].stride == 0);
+    T(res.layout.buffers[2].stride == 12);
+    T(res.layout.attrs[0].buffer_index == 2);
+    T(res.layout.attrs[1].buffer_index == 2);
+    T(res.layout.attrs[1].format == SG_VERTEXFORMAT_HALF2);
+    T(res.layout.attrs[1].offset == 8);
+    T(res.normal.format == SG_VERTEXFORMAT_INVALID);
+    T(res.color.format == SG_VERTEXFORMAT_INVALID);
+}
+
+UTEST(sokol_vertexpack, position_quantization) {
+    int16_t buf[4][4];
+    const svpack_result res = svpack_pack(&(svpack_desc){
+        .num_vertices = 4,
+        .positions = { .data = SG_RANGE(positions) },
+        .buffer = SG_RANGE(buf),
+    });
+    T(res.valid);
+    // bounding box is (-2,0,1)..(2,4,3)
+    T(res.dequant.scale[0] == 2.0f);
+    T(res.dequant.scale[1] == 2.0f);
+    T(res.dequant.scale[2] == 1.0f);
+    T(res.dequant.offset[0] == 0.0f);
+    T(res.dequant.offset[1] == 2.0f);
+    T(res.dequant.offset[2] == 2.0f);
+    T(res.dequant.matrix[0] == 2.0f);
+    T(res.dequant.matrix[10] == 1.0f);
+    T(res.dequant.matrix[13] == 2.0f);
+    T(res.dequant.matrix[15] == 1.0f);
+    T(buf[0][0] == -32767);
+    T(buf[1][0] == 32767);
+    T(buf[2][1] == 32767);
+    T(buf[0][3] == 32767);
+    for (int vi = 0; vi < 4; vi++) {
+        for (int i = 0; i < 3; i++) {
+            const float p = ((float)buf[vi][i] / 32767.0f) * res.dequant.scale[i] + res.dequant.offset[i];
+            T(feq(p, positions[vi][i], 1.0e-4f));
+        }
+    }
+}
+
+UTEST(sokol_vertexpack, explicit_bbox) {
+    int16_t buf[4][4];
+    const svpack_result res = svpack_pack(&(svpack_desc){
+        .num_vertices = 4,
+        .positions = { .data = SG_RANGE(positions) },
+        .bbox_min = { -4.0f, -4.0f, -4.0f },
+        .bbox_max = { 4.0f, 4.0f, 4.0f },
+        .buffer = SG_RANGE(buf),
+    });
+    T(res.valid);
+    T(res.dequant.scale[0] == 4.0f);
+    T(res.dequant.offset[0] == 0.0f);
+    T(buf[2][1] == 32767);
+    T(buf[0][0] == -16384);
+}
+
+UTEST(sokol_vertexpack, flat_bbox) {
+    const float flat[2][3] = { { 0.0f, 1.0f, 5.0f }, { 2.0f, 3.0f, 5.0f } };
+    int16_t buf[2][4];
+    const svpack_result res = svpack_pack(&(svpack_desc){
+        .num_vertices = 2,
+        .positions = { .data = SG_RANGE(flat) },
+        .buffer = SG_RANGE(buf),
+    });
+    T(res.valid);
+    T(res.dequant.scale[2] == 0.0f);
+    T(res.dequant.offset[2] == 5.0f);
+    T(buf[0][2] == 0);
+    T(buf[1][2] == 0);
+}
+
+UTEST(sokol_vertexpack, unquantized_positions) {
+    float buf[4][3];
+    const svpack_result res = svpack_pack(&(svpack_desc){
+        .num_vertices = 4,
+        .positions = { .data = SG_RANGE(positions) },
+        .formats.position = SVPACK_POSITION_FLOAT3,
+        .buffer = SG_RANGE(buf),
+    });
+    T(res.valid);
+    T(res.layout.attrs[0].format == SG_VERTEXFORMAT_FLOAT3);
+    T(res.dequant.scale[0] == 1.0f);
+    T(res.dequant.offset[0] == 0.0f);
+    T(res.dequant.matrix[0] == 1.0f);
+    T(res.dequant.matrix[12] == 0.0f);
+    T(0 == memcmp(buf, positions, sizeof(buf)));
+}
+
+UTEST(sokol_vertexpack, interleaved_input) {
+    typedef struct { float pos[3]; float uv[2]; } vertex_t;
+    const vertex_t vertices[2] = {
+        { { 0.0f, 0.0f, 0.0f }, { 0.5f, 0.25f } },
+        { { 1.0f, 1.0f, 1.0f }, { 0.75f, 1.0f } },
+    };
+    struct { int16_t pos[4]; uint16_t uv[2]; } buf[2];
+    const svpack_result res = svpack_pack(&(svpack_desc){
+        .num_vertices = 2,
+        .positions = { .data = SG_RANGE(vertices), .stride = sizeof(vertex_t) },
+        .texcoords = { .data = { &vertices[0].uv, sizeof(vertices) - offsetof(vertex_t, uv) }, .stride = sizeof(vertex_t) },
+        .buffer = SG_RANGE(buf),
+    });
+    T(res.valid);
+    T(buf[0].pos[0] == -32767);
+    T(buf[1].pos[2] == 32767);
+    T(svpack_half_to_float(buf[0].uv[0]) == 0.5f);
+    T(svpack_half_to_float(buf[0].uv[1]) == 0.25f);
+    T(svpack_half_to_float(buf[1].uv[0]) == 0.75f);
+    T(svpack_half_to_float(buf[1].uv[1]) == 1.0f);
+}
+
+UTEST(sokol_vertexpack, oct_normals) {
+    struct { int16_t pos[4]; int16_t nrm[2]; } buf[4];
+    const svpack_result res = svpack_pack(&(svpack_desc){
+        .num_vertices = 4,
+        .positions = { .data = SG_RANGE(positions) },
+        .normals = { .data = SG_RANGE(normals) },
+        .buffer = SG_RANGE(buf),
+    });
+    T(res.valid);
+    for (int vi = 0; vi < 4; vi++) {
+        const float e[2] = { (float)buf[vi].nrm[0] / 32767.0f, (float)buf[vi].nrm[1] / 32767.0f };
+        float n[3];
+        svpack_oct_decode(e, n);
+        for (int i = 0; i < 3; i++) {
+            T(feq(n[i], normals[vi][i], 1.0e-3f));
+        }
+    }
+}
+
+UTEST(sokol_vertexpack, uint10_normals) {
+    struct { int16_t pos[4]; uint32_t nrm; } buf[4];
+    const svpack_result res = svpack_pack(&(svpack_desc){
+        .num_vertices = 4,
+        .positions = { .data = SG_RANGE(positions) },
+        .normals = { .data = SG_RANGE(normals) },
+        .formats.normal = SVPACK_NORMAL_UINT10_N2,
+        .buffer = SG_RANGE(buf),
+    });
+    T(res.valid);
+    T(res.normal.format == SG_VERTEXFORMAT_UINT10_N2);
+    for (int vi = 0; vi < 4; vi++) {
+        for (int i = 0; i < 3; i++) {
+            const float n = ((float)((buf[vi].nrm >> (i * 10)) & 0x3FF) / 1023.0f) * 2.0f - 1.0f;
+            T(feq(n, normals[vi][i], 2.0e-3f));
+        }
+    }
+}
+
+UTEST(sokol_vertexpack, byte4n_normals) {
+    struct { int16_t pos[4]; int8_t nrm[4]; } buf[4];
+    const svpack_result res = svpack_pack(&(svpack_desc){
+        .num_vertices = 4,
+        .positions = { .data = SG_RANGE(positions) },
+        .normals = { .data = SG_RANGE(normals) },
+        .formats.normal = SVPACK_NORMAL_BYTE4N,
+        .buffer = SG_RANGE(buf),
+    });
+    T(res.valid);
+    T(res.normal.format == SG_VERTEXFORMAT_BYTE4N);
+    T(buf[0].nrm[2] == 127);
+    T(buf[1].nrm[2] == -127);
+    T(buf[0].nrm[3] == 0);
+}
+
+UTEST(sokol_vertexpack, ushort2n_texcoords_and_colors) {
+    struct { int16_t pos[4]; uint16_t uv[2]; uint8_t color[4]; } buf[4];
+    const svpack_result res = svpack_pack(&(svpack_desc){
+        .num_vertices = 4,
+        .positions = { .data = SG_RANGE(positions) },
+        .texcoords = { .data = SG_RANGE(texcoords) },
+        .colors = { .data = SG_RANGE(colors) },
+        .formats.texcoord = SVPACK_TEXCOORD_USHORT2N,
+        .buffer = SG_RANGE(buf),
+    });
+    T(res.valid);
+    T(res.texcoord.format == SG_VERTEXFORMAT_USHORT2N);
+    T(buf[1].uv[0] == 65535);
+    T(buf[1].uv[1] == 32768);
+    // out of range texcoords are clamped
+    T(buf[3].uv[0] == 0);
+    T(buf[3].uv[1] == 65535);
+    T(buf[0].color[0] == 255);
+    T(buf[0].color[1] == 0);
+    T(buf[2].color[3] == 128);
+    T(buf[3].color[3] == 0);
+}
+
+UTEST(sokol_vertexpack, invalid_input) {
+    uint8_t buf[4 * 16];
+    // no positions
+    T(!svpack_pack(&(svpack_desc){ .num_vertices = 4, .buffer = SG_RANGE(buf) }).valid);
+    // no vertices
+    T(!svpack_pack(&(svpack_desc){ .positions = { .data = SG_RANGE(positions) }, .buffer = SG_RANGE(buf) }).valid);
+    // no output buffer
+    T(!svpack_pack(&(svpack_desc){ .num_vertices = 4, .positions = { .data = SG_RANGE(positions) } }).valid);
+    // output buffer too small
+    T(!svpack_pack(&(svpack_desc){
+        .num_vertices = 4,
+        .positions = { .data = SG_RANGE(positions) },
+        .normals = { .data = SG_RANGE(normals) },
+        .texcoords = { .data = SG_RANGE(texcoords) },
+        .colors = { .data = SG_RANGE(colors) },
+        .buffer = SG_RANGE(buf),
+    }).valid);
+    // input stream too small
+    T(!svpack_pack(&(svpack_desc){
+        .num_vertices = 5,
+        .positions = { .data = SG_RANGE(positions) },
+        .buffer = SG_RANGE(buf),
+    }).valid);
+    T(!svpack_pack(&(svpack_desc){
+        .num_vertices = 4,
+        .positions = { .data = SG_RANGE(positions) },
+        .normals = { .data = { normals, sizeof(normals) - 4 } },
+        .buffer = SG_RANGE(buf),
+    }).valid);
+}
+
+UTEST(sokol_vertexpack, half_float_conversion) {
+    T(svpack_float_to_half(0.0f) == 0x0000);
+    T(svpack_float_to_half(-0.0f) == 0x8000);
+    T(svpack_float_to_half(1.0f) == 0x3C00);
+    T(svpack_float_to_half(-2.0f) == 0xC000);
+    T(svpack_float_to_half(0.5f) == 0x3800);
+    T(svpack_float_to_half(65504.0f) == 0x7BFF);
+    T(svpack_float_to_half(65520.0f) == 0x7C00);
+    T(svpack_float_to_half(1.0e10f) == 0x7C00);
+    T(svpack_float_to_half(-INFINITY) == 0xFC00);
+    T((svpack_float_to_half(NAN) & 0x7FFF) > 0x7C00);
+    // smallest denormal and smallest normal
+    T(svpack_float_to_half(5.9604645e-8f) == 0x0001);
+    T(svpack_float_to_half(6.1035156e-5f) == 0x0400);
+    // round to nearest even: 1 + 2^-11 is halfway between 1.0 and the next half
+    T(svpack_float_to_half(1.00048828125f) == 0x3C00);
+    T(svpack_float_to_half(1.00146484375f) == 0x3C02);
+    T(svpack_half_to_float(0x3C00) == 1.0f);
+    T(svpack_half_to_float(0xC000) == -2.0f);
+    T(svpack_half_to_float(0x7BFF) == 65504.0f);
+    T(svpack_half_to_float(0x0001) == 5.9604645e-8f);
+    T(isinf(svpack_half_to_float(0x7C00)));
+    T(isnan(svpack_half_to_float(0x7E00)));
+    // all finite halfs survive a roundtrip
+    for (uint32_t h = 0; h < 0x10000; h++) {
+        if ((h & 0x7C00) != 0x7C00) {
+            T(svpack_float_to_half(svpack_half_to_float((uint16_t)h)) == h);
+        }
+    }
+}
+
+UTEST(sokol_vertexpack, oct_encode_decode) {
+    const float dirs[6][3] = {
+        { 1.0f, 0.0f, 0.0f }, { -1.0f, 0.0f, 0.0f },
+        { 0.0f, 1.0f, 0.0f }, { 0.0f, -1.0f, 0.0f },
+        { 0.0f, 0.0f, 1.0f }, { 0.0f, 0.0f, -1.0f },
+    };
+    for (int di = 0; di < 6; di++) {
+        float e[2], n[3];
+        svpack_oct_encode(dirs[di], e);
+        T((fabsf(e[0]) <= 1.0f) && (fabsf(e[1]) <= 1.0f));
+        svpack_oct_decode(e, n);
+        for (int i = 0; i < 3; i++) {
+            T(feq(n[i], dirs[di][i], 1.0e-6f));
+        }
+    }
+    const float zero[3] = { 0.0f, 0.0f, 0.0f };
+    float e[2];
+    svpack_oct_encode(zero, e);
+    T((e[0] == 0.0f) && (e[1] == 0.0f));
+}
@@ -0,0 +1,1120 @@
+#if defined(SOKOL_IMPL) && !defined(SOKOL_ATLAS_IMPL)
+#define SOKOL_ATLAS_IMPL
+#endif
+#ifndef SOKOL_ATLAS_INCLUDED
+/*
+    sokol_atlas.h -- dynamic texture atlases with incremental uploads
+
+    Project URL: https://github.com/floooh/sokol
+
+    Do this:
+        #define SOKOL_IMPL or
+        #define SOKOL_ATLAS_IMPL
+    before you include this file in *one* C or C++ file to create the
+    implementation.
+
+    Optionally provide the following defines with your own implementations:
+
+    SOKOL_ASSERT(c)     - your own assert macro (default: assert(c))
+    SOKOL_ATLAS_API_DECL - public function declaration prefix (default: extern)
+    SOKOL_API_DECL      - same as SOKOL_ATLAS_API_DECL
+    SOKOL_API_IMPL      - public function implementation prefix (default: -)
+
+    If sokol_atlas.h is compiled as a DLL, define the following before
+    including the declaration or implementation:
+
+    SOKOL_DLL
+
+    Include the following headers before including sokol_atlas.h:
+
+        sokol_gfx.h
+
+    WHAT
+    ====
+    sokol_atlas.h manages large sokol-gfx images (2D or array textures)
+    as texture atlases for many small images like UI icons, font glyphs
+    or sprites. Instead of one image and texture view per small image,
+    all small images live in a few atlas images, so that draws which
+    use different small images can share the same bindings and can be
+    merged into the same draw call.
+
+    Regions are packed into the atlas with a shelf packer: each atlas
+    slice is divided into horizontal shelves, and each shelf is filled with
+    regions from left to right. Regions can be allocated and freed at runtime,
+    freed space on a shelf is reused for new regions, and empty shelves at
+    the top of a slice are released for shelves of a different height.
+
+    Each atlas keeps a CPU-side copy of its pixel data. New region content
+    is written into this copy, and satlas_flush() uploads only the rectangles
+    which have been written since the last flush via sg_update_image_region().
+
+    HOW
+    ===
+    First initialize sokol_atlas.h after sokol_gfx.h:
+
+        satlas_setup(&(satlas_desc){
+            .logger.func = slog_func,
+        });
+
+    The default limits are 8 atlases and 4096 regions (across all atlases),
+    those can be tweaked in satlas_desc:
+
+        satlas_setup(&(satlas_desc){
+            .max_atlases = 16,
+            .max_regions = 16384,
+            .logger.func = slog_func,
+        });
+
+    Create an atlas (defaults are 1024x1024 pixels, 1 slice, RGBA8):
+
+        satlas_atlas atlas = satlas_make_atlas(&(satlas_atlas_desc){
+            .width = 2048,
+            .height = 2048,
+            .num_slices = 4,        // > 1 creates an array texture
+            .pixel_format = SG_PIXELFORMAT_RGBA8,
+            .padding = 1,           // empty pixels between regions (default: 0)
+            .label = "ui-atlas",
+        });
+
+    When sampling the atlas with linear filtering, set .padding to at least
+    1 to prevent neighbouring regions from bleeding into each other.
+
+    Allocate a region and write its pixels (tightly packed, in the pixel
+    format of the atlas):
+
+        satlas_region icon = satlas_alloc(atlas, 32, 32);
+        satlas_write(icon, &SG_RANGE(icon_pixels));
+
+    satlas_alloc() returns an invalid handle (with id SATLAS_INVALID_ID)
+    when the region doesn't fit into the atlas.
+
+    To render a region, query its texture coordinates and the atlas texture
+    view:
+
+        const satlas_region_info info = satlas_query_region_info(icon);
+        // info.u0, info.v0, info.u1, info.v1: the region's UV rectangle
+        // info.slice: the array slice index
+        // info.view: the texture view of the entire atlas
+
+    Call satlas_flush() once per frame before rendering to upload the pixel
+    data written since the last flush, typically after the frame's new
+    regions have been allocated and written (it doesn't need to be called
+    inside a render pass):
+
+        satlas_flush();
+
+    Regions which are no longer needed are freed with:
+
+        satlas_free(icon);
+
+    A freed region's space is only reused after SG_NUM_INFLIGHT_FRAMES+1
+    calls to satlas_flush(), this makes sure that in-flight frames which
+    still sample the old content don't see new pixel data.
+
+    To get statistics about the last flush:
+
+        satlas_stats stats = satlas_query_stats();
+
+    At the end of the program call:
+
+        satlas_shutdown();
+
+    ...before sg_shutdown().
+
+
+    LICENSE
+    =======
+
+    zlib/libpng license
+
+    Copyright (c) 2026 Andre Weissflog
+
+    This software is provided 'as-is', without any express or implied warranty.
+    In no event will the authors be held liable for any damages arising from the
+    use of this software.
+
+    Permission is granted to anyone to use this software for any purpose,
+    including commercial applications, and to alter it and redistribute it
+    freely, subject to the following restrictions:
+
+        1. The origin of this software must not be misrepresented; you must not
+        claim that you wrote the original software. If you use this software in a
+        product, an acknowledgment in the product documentation would be
+        appreciated but is not required.
+
+        2. Altered source versions must be plainly marked as such, and must not
+        be misrepresented as being the original software.
+
+        3. This notice may not be removed or altered from any source
+        distribution.
+*/
+#define SOKOL_ATLAS_INCLUDED (1)
+#include <stddef.h>
+#include <stdint.h>
+#include <stdbool.h>
+
+#if !defined(SOKOL_GFX_INCLUDED)
+#error "Please include sokol_gfx.h before sokol_atlas.h"
+#endif
+
+#if defined(SOKOL_API_DECL) && !defined(SOKOL_ATLAS_API_DECL)
+#define SOKOL_ATLAS_API_DECL SOKOL_API_DECL
+#endif
+#ifndef SOKOL_ATLAS_API_DECL
+#if defined(_WIN32) && defined(SOKOL_DLL) && defined(SOKOL_ATLAS_IMPL)
+#define SOKOL_ATLAS_API_DECL __declspec(dllexport)
+#elif defined(_WIN32) && defined(SOKOL_DLL)
+#define SOKOL_ATLAS_API_DECL __declspec(dllimport)
+#else
+#define SOKOL_ATLAS_API_DECL extern
+#endif
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+    satlas_log_item
+
+    Log items are defined via X-Macros and expanded to an enum
+    'satlas_log_item', and in debug mode to corresponding
+    human readable error messages.
+*/
+#define _SATLAS_LOG_ITEMS \
+    _SATLAS_LOGITEM_XMACRO(OK, "Ok") \
+    _SATLAS_LOGITEM_XMACRO(MALLOC_FAILED, "memory allocation failed") \
+    _SATLAS_LOGITEM_XMACRO(ATLAS_POOL_EXHAUSTED, "too many atlases (satlas_desc.max_atlases)") \
+    _SATLAS_LOGITEM_XMACRO(REGION_POOL_EXHAUSTED, "too many regions (satlas_desc.max_regions)") \
+    _SATLAS_LOGITEM_XMACRO(INVALID_PIXEL_FORMAT, "satlas_atlas_desc.pixel_format must be an uncompressed, sampleable pixel format") \
+    _SATLAS_LOGITEM_XMACRO(MAKE_IMAGE_FAILED, "sg_make_image() failed") \
+    _SATLAS_LOGITEM_XMACRO(MAKE_VIEW_FAILED, "sg_make_view() failed") \
+    _SATLAS_LOGITEM_XMACRO(ALLOC_INVALID_ATLAS, "satlas_alloc: atlas handle is invalid") \
+    _SATLAS_LOGITEM_XMACRO(ALLOC_INVALID_SIZE, "satlas_alloc: region width and height must be > 0 and fit into the atlas") \
+    _SATLAS_LOGITEM_XMACRO(ATLAS_FULL, "satlas_alloc: no space left in atlas") \
+    _SATLAS_LOGITEM_XMACRO(WRITE_INVALID_REGION, "satlas_write: region handle is invalid") \
+    _SATLAS_LOGITEM_XMACRO(WRITE_INVALID_DATA_SIZE, "satlas_write: data size must be region width * height * bytes per pixel") \
+
+#define _SATLAS_LOGITEM_XMACRO(item,msg) SATLAS_LOGITEM_##item,
+typedef enum satlas_log_item {
+    _SATLAS_LOG_ITEMS
+} satlas_log_item;
+#undef _SATLAS_LOGITEM_XMACRO
+
+enum {
+    SATLAS_INVALID_ID = 0,
+};
+
+/*
+    satlas_atlas, satlas_region
+
+    Opaque handles for atlases and regions inside an atlas.
+*/
+typedef struct satlas_atlas { uint32_t id; } satlas_atlas;
+typedef struct satlas_region { uint32_t id; } satlas_region;
+
+/*
+    satlas_atlas_desc
+
+    Creation parameters for satlas_make_atlas(). A .num_slices > 1
+    creates an array texture, otherwise a 2D texture.
+*/
+typedef struct satlas_atlas_desc {
+    int width;              // default: 1024
+    int height;             // default: 1024
+    int num_slices;         // default: 1
+    sg_pixel_format pixel_format;   // default: SG_PIXELFORMAT_RGBA8
+    int padding;            // empty pixels to the right of and below each region, default: 0
+    int max_shelves;        // max number of shelves across all slices, default: 256
+    const char* label;
+} satlas_atlas_desc;
+
+/*
+    satlas_region_info
+
+    Position, size and texture coordinates of a region, returned
+    by satlas_query_region_info().
+*/
+typedef struct satlas_region_info {
+    bool valid;
+    int x, y;               // top-left corner in pixels
+    int width, height;      // size in pixels (without padding)
+    int slice;              // array slice index
+    float u0, v0;           // top-left texture coordinate
+    float u1, v1;           // bottom-right texture coordinate
+    sg_image image;         // the atlas image
+    sg_view view;           // texture view of the atlas image
+} satlas_region_info;
+
+/*
+    satlas_atlas_info
+
+    Runtime information about an atlas, returned by satlas_query_atlas_info().
+*/
+typedef struct satlas_atlas_info {
+    bool valid;
+    int num_regions;        // number of allocated regions
+    int num_shelves;        // number of shelves
+    int num_used_pixels;    // area of all allocated regions including padding
+    int num_dirty_rects;    // number of rectangles which will be uploaded in the next flush
+} satlas_atlas_info;
+
+/*
+    satlas_stats
+
+    Statistics about the last flush, returned by satlas_query_stats().
+*/
+typedef struct satlas_stats {
+    int num_uploads;        // number of sg_update_image_region() calls
+    int num_upload_bytes;   // number of uploaded bytes
+    int num_retired;        // number of freed regions whose space became reusable
+} satlas_stats;
+
+/*
+    satlas_allocator
+
+    Used in satlas_desc to provide custom memory-alloc and -free functions
+    to sokol_atlas.h. If memory management should be overridden, both
+    the alloc and free function must be provided (e.g. it's not valid to
+    override one function but not the other).
+*/
+typedef struct satlas_allocator {
+    void* (*alloc_fn)(size_t size, void* user_data);
+    void (*free_fn)(void* ptr, void* user_data);
+    void* user_data;
+} satlas_allocator;
+
+/*
+    satlas_logger
+
+    Used in satlas_desc to provide a custom logging and error reporting
+    callback to sokol_atlas.h.
+*/
+typedef struct satlas_logger {
+    void (*func)(
+        const char* tag,                // always "satlas"
+        uint32_t log_level,             // 0=panic, 1=error, 2=warning, 3=info
+        uint32_t log_item_id,           // SATLAS_LOGITEM_*
+        const char* message_or_null,    // a message string, may be nullptr in release mode
+        uint32_t line_nr,               // line number in sokol_atlas.h
+        const char* filename_or_null,   // source filename, may be nullptr in release mode
+        void* user_data);
+    void* user_data;
+} satlas_logger;
+
+/*
+    Initialization parameters passed into satlas_setup(). You should at least
+    provide a logging function, otherwise you won't see any error logging.
+*/
+typedef struct satlas_desc {
+    int max_atlases;        // default: 8
+    int max_regions;        // max number of regions across all atlases, default: 4096
+    satlas_allocator allocator;
+    satlas_logger logger;
+} satlas_desc;
+
+// setup sokol-atlas (call after sg_setup())
+SOKOL_ATLAS_API_DECL void satlas_setup(const satlas_desc* desc);
+// shutdown sokol-atlas (call before sg_shutdown())
+SOKOL_ATLAS_API_DECL void satlas_shutdown(void);
+// create an atlas
+SOKOL_ATLAS_API_DECL satlas_atlas satlas_make_atlas(const satlas_atlas_desc* desc);
+// destroy an atlas and all its regions
+SOKOL_ATLAS_API_DECL void satlas_destroy_atlas(satlas_atlas atlas);
+// allocate a region in an atlas
+SOKOL_ATLAS_API_DECL satlas_region satlas_alloc(satlas_atlas atlas, int width, int height);
+// free a region (the space is reused after SG_NUM_INFLIGHT_FRAMES+1 flushes)
+SOKOL_ATLAS_API_DECL void satlas_free(satlas_region region);
+// write the pixel data of a region (tightly packed), uploaded in the next flush
+SOKOL_ATLAS_API_DECL void satlas_write(satlas_region region, const sg_range* data);
+// upload written pixel data of all atlases, call once per frame
+SOKOL_ATLAS_API_DECL void satlas_flush(void);
+// get position, size and UV rectangle of a region
+SOKOL_ATLAS_API_DECL satlas_region_info satlas_query_region_info(satlas_region region);
+// get runtime information about an atlas
+SOKOL_ATLAS_API_DECL satlas_atlas_info satlas_query_atlas_info(satlas_atlas atlas);
+// get the sokol-gfx image of an atlas
+SOKOL_ATLAS_API_DECL sg_image satlas_query_image(satlas_atlas atlas);
+// get the texture view of an atlas
+SOKOL_ATLAS_API_DECL sg_view satlas_query_view(satlas_atlas atlas);
+// get statistics about the last flush
+SOKOL_ATLAS_API_DECL satlas_stats satlas_query_stats(void);
+
+#ifdef __cplusplus
+} // extern "C"
+inline void satlas_setup(const satlas_desc& desc) { return satlas_setup(&desc); }
+inline satlas_atlas satlas_make_atlas(const satlas_atlas_desc& desc) { return satlas_make_atlas(&desc); }
+inline void satlas_write(satlas_region region, const sg_range& data) { return satlas_write(region, &data); }
+#endif
+#endif // SOKOL_ATLAS_INCLUDED
+
+/*=== IMPLEMENTATION =========================================================*/
+#ifdef SOKOL_ATLAS_IMPL
+#define SOKOL_ATLAS_IMPL_INCLUDED (1)
+
+#include <stdlib.h> // malloc, free, abort
+#include <string.h> // memset, memcpy
+
+#ifndef SOKOL_API_IMPL
+    #define SOKOL_API_IMPL
+#endif
+#ifndef SOKOL_DEBUG
+    #ifndef NDEBUG
+        #define SOKOL_DEBUG
+    #endif
+#endif
+#ifndef SOKOL_ASSERT
+    #include <assert.h>
+    #define SOKOL_ASSERT(c) assert(c)
+#endif
+
+#define _satlas_def(val, def) (((val) == 0) ? (def) : (val))
+#define _SATLAS_INIT_TAG (0xABCDABCD)
+
+// >>structs
+enum {
+    _SATLAS_DEFAULT_MAX_ATLASES = 8,
+    _SATLAS_DEFAULT_MAX_REGIONS = 4096,
+    _SATLAS_DEFAULT_SIZE = 1024,
+    _SATLAS_DEFAULT_MAX_SHELVES = 256,
+    _SATLAS_MAX_DIRTY_RECTS = 64,
+    _SATLAS_INVALID_SLOT_INDEX = 0,
+    _SATLAS_SLOT_SHIFT = 16,
+    _SATLAS_MAX_POOL_SIZE = (1<<_SATLAS_SLOT_SHIFT),
+    _SATLAS_SLOT_MASK = (_SATLAS_MAX_POOL_SIZE-1),
+};
+
+typedef struct {
+    uint32_t id;
+    sg_resource_state state;
+} _satlas_slot_t;
+
+typedef struct {
+    int size;
+    int queue_top;
+    uint32_t* gen_ctrs;
+    int* free_queue;
+} _satlas_pool_t;
+
+typedef struct {
+    int x, y, width, height, slice;
+} _satlas_rect_t;
+
+typedef struct {
+    int slice;
+    int y;
+    int height;             // including padding
+    int first_region;       // region slot index of leftmost region, 0 if shelf is empty
+} _satlas_shelf_t;
+
+typedef struct {
+    _satlas_slot_t slot;
+    int atlas_index;        // slot index of the owning atlas
+    int shelf_index;
+    int next_region;        // region slot index of right neighbour on shelf, or 0
+    int x;
+    int width, height;      // without padding
+    int alloc_width;        // with padding
+    bool retired;           // freed, but space not yet reusable
+    uint32_t retire_frame;  // flush counter at which the space becomes reusable
+} _satlas_region_t;
+
+typedef struct {
+    _satlas_slot_t slot;
+    satlas_atlas_desc desc;
+    sg_image img;
+    sg_view view;
+    int bytes_per_pixel;
+    int row_pitch;
+    size_t slice_pitch;
+    uint8_t* pixels;        // CPU-side copy of all slices
+    size_t pixels_size;     // includes one extra row (see _satlas_upload_rect)
+    _satlas_shelf_t* shelves;
+    int num_shelves;
+    int* slice_tops;        // top of the topmost shelf per slice
+    int num_regions;
+    int num_used_pixels;
+    int num_dirty_rects;
+    _satlas_rect_t dirty_rects[_SATLAS_MAX_DIRTY_RECTS];
+} _satlas_atlas_t;
+
+typedef struct {
+    uint32_t init_tag;
+    satlas_desc desc;
+    uint32_t frame_count;   // incremented in satlas_flush()
+    int num_retired;        // number of regions waiting to be retired
+    _satlas_pool_t atlas_pool;
+    _satlas_atlas_t* atlases;
+    _satlas_pool_t region_pool;
+    _satlas_region_t* regions;
+    satlas_stats stats;
+} _satlas_state_t;
+static _satlas_state_t _satlas;
+
+// >>logging
+#if defined(SOKOL_DEBUG)
+#define _SATLAS_LOGITEM_XMACRO(item,msg) #item ": " msg,
+static const char* _satlas_log_messages[] = {
+    _SATLAS_LOG_ITEMS
+};
+#undef _SATLAS_LOGITEM_XMACRO
+#endif // SOKOL_DEBUG
+
+#define _SATLAS_PANIC(code) _satlas_log(SATLAS_LOGITEM_ ##code, 0, __LINE__)
+#define _SATLAS_ERROR(code) _satlas_log(SATLAS_LOGITEM_ ##code, 1, __LINE__)
+#define _SATLAS_WARN(code) _satlas_log(SATLAS_LOGITEM_ ##code, 2, __LINE__)
+#define _SATLAS_INFO(code) _satlas_log(SATLAS_LOGITEM_ ##code, 3, __LINE__)
+
+static void _satlas_log(satlas_log_item log_item, uint32_t log_level, uint32_t line_nr) {
+    if (_satlas.desc.logger.func) {
+        const char* filename = 0;
+        const char* msg = 0;
+        #if defined(SOKOL_DEBUG)
+            filename = __FILE__;
+            msg = _satlas_log_messages[log_item];
+        #endif
+        _satlas.desc.logger.func("satlas", log_level, (uint32_t)log_item, msg, line_nr, filename, _satlas.desc.logger.user_data);
+    } else {
+        // for log level PANIC it would be 'undefined behaviour' to continue
+        if (log_level == 0) {
+            abort();
+        }
+    }
+}
+
+// >>memory
+static void _satlas_clear(void* ptr, size_t size) {
+    SOKOL_ASSERT(ptr && (size > 0));
+    memset(ptr, 0, size);
+}
+
+static void* _satlas_malloc(size_t size) {
+    SOKOL_ASSERT(size > 0);
+    void* ptr;
+    if (_satlas.desc.allocator.alloc_fn) {
+        ptr = _satlas.desc.allocator.alloc_fn(size, _satlas.desc.allocator.user_data);
+    } else {
+        ptr = malloc(size);
+    }
+    if (0 == ptr) {
+        _SATLAS_PANIC(MALLOC_FAILED);
+    }
+    return ptr;
+}
+
+static void* _satlas_malloc_clear(size_t size) {
+    void* ptr = _satlas_malloc(size);
+    _satlas_clear(ptr, size);
+    return ptr;
+}
+
+static void _satlas_free(void* ptr) {
+    if (_satlas.desc.allocator.free_fn) {
+        _satlas.desc.allocator.free_fn(ptr, _satlas.desc.allocator.user_data);
+    } else {
+        free(ptr);
+    }
+}
+
+// >>pool
+static void _satlas_init_pool(_satlas_pool_t* pool, int num) {
+    SOKOL_ASSERT(pool && (num >= 1) && (num < _SATLAS_MAX_POOL_SIZE));
+    // slot 0 is reserved for the 'invalid id', so bump the pool size by 1
+    pool->size = num + 1;
+    pool->queue_top = 0;
+    pool->gen_ctrs = (uint32_t*) _satlas_malloc_clear(sizeof(uint32_t) * (size_t)pool->size);
+    pool->free_queue = (int*) _satlas_malloc_clear(sizeof(int) * (size_t)num);
+    for (int i = pool->size-1; i >= 1; i--) {
+        pool->free_queue[pool->queue_top++] = i;
+    }
+}
+
+static void _satlas_discard_pool(_satlas_pool_t* pool) {
+    SOKOL_ASSERT(pool && pool->free_queue && pool->gen_ctrs);
+    _satlas_free(pool->free_queue);
+    pool->free_queue = 0;
+    _satlas_free(pool->gen_ctrs);
+    pool->gen_ctrs = 0;
+    pool->size = 0;
+    pool->queue_top = 0;
+}
+
+static int _satlas_pool_alloc_index(_satlas_pool_t* pool) {
+    SOKOL_ASSERT(pool && pool->free_queue);
+    if (pool->queue_top > 0) {
+        int slot_index = pool->free_queue[--pool->queue_top];
+        SOKOL_ASSERT((slot_index > 0) && (slot_index < pool->size));
+        return slot_index;
+    } else {
+        // pool exhausted
+        return _SATLAS_INVALID_SLOT_INDEX;
+    }
+}
+
+static void _satlas_pool_free_index(_satlas_pool_t* pool, int slot_index) {
+    SOKOL_ASSERT((slot_index > _SATLAS_INVALID_SLOT_INDEX) && (slot_index < pool->size));
+    SOKOL_ASSERT(pool && pool->free_queue);
+    SOKOL_ASSERT(pool->queue_top < pool->size);
+    pool->free_queue[pool->queue_top++] = slot_index;
+}
+
+static uint32_t _satlas_slot_alloc(_satlas_pool_t* pool, _satlas_slot_t* slot, int slot_index) {
+    SOKOL_ASSERT(pool && pool->gen_ctrs);
+    SOKOL_ASSERT((slot_index > _SATLAS_INVALID_SLOT_INDEX) && (slot_index < pool->size));
+    SOKOL_ASSERT((slot->state == SG_RESOURCESTATE_INITIAL) && (slot->id == SATLAS_INVALID_ID));
+    uint32_t ctr = ++pool->gen_ctrs[slot_index];
+    slot->id = (ctr<<_SATLAS_SLOT_SHIFT)|((uint32_t)slot_index & _SATLAS_SLOT_MASK);
+    slot->state = SG_RESOURCESTATE_ALLOC;
+    return slot->id;
+}
+
+static int _satlas_slot_index(uint32_t id) {
+    return (int)(id & _SATLAS_SLOT_MASK);
+}
+
+static _satlas_atlas_t* _satlas_lookup_atlas(uint32_t id) {
+    const int slot_index = _satlas_slot_index(id);
+    if ((SATLAS_INVALID_ID != id) && (slot_index < _satlas.atlas_pool.size)) {
+        _satlas_atlas_t* atlas = &_satlas.atlases[slot_index];
+        if ((atlas->slot.id == id) && (atlas->slot.state == SG_RESOURCESTATE_VALID)) {
+            return atlas;
+        }
+    }
+    return 0;
+}
+
+// NOTE: freed regions which are waiting to be retired are not found
+static _satlas_region_t* _satlas_lookup_region(uint32_t id) {
+    const int slot_index = _satlas_slot_index(id);
+    if ((SATLAS_INVALID_ID != id) && (slot_index < _satlas.region_pool.size)) {
+        _satlas_region_t* reg = &_satlas.regions[slot_index];
+        if ((reg->slot.id == id) && (reg->slot.state == SG_RESOURCESTATE_VALID) && !reg->retired) {
+            return reg;
+        }
+    }
+    return 0;
+}
+
+// >>misc
+static satlas_desc _satlas_desc_defaults(const satlas_desc* desc) {
+    SOKOL_ASSERT(desc);
+    satlas_desc res = *desc;
+    res.max_atlases = _satlas_def(res.max_atlases, _SATLAS_DEFAULT_MAX_ATLASES);
+    res.max_regions = _satlas_def(res.max_regions, _SATLAS_DEFAULT_MAX_REGIONS);
+    return res;
+}
+
+static satlas_atlas_desc _satlas_atlas_desc_defaults(const satlas_atlas_desc* desc) {
+    SOKOL_ASSERT(desc);
+    satlas_atlas_desc res = *desc;
+    res.width = _satlas_def(res.width, _SATLAS_DEFAULT_SIZE);
+    res.height = _satlas_def(res.height, _SATLAS_DEFAULT_SIZE);
+    res.num_slices = _satlas_def(res.num_slices, 1);
+    res.pixel_format = _satlas_def(res.pixel_format, SG_PIXELFORMAT_RGBA8);
+    res.max_shelves = _satlas_def(res.max_shelves, _SATLAS_DEFAULT_MAX_SHELVES);
+    return res;
+}
+
+static int _satlas_min(int a, int b) {
+    return (a < b) ? a : b;
+}
+
+static int _satlas_max(int a, int b) {
+    return (a > b) ? a : b;
+}
+
+// >>upload
+static void _satlas_upload_rect(_satlas_atlas_t* atlas, const _satlas_rect_t* rect) {
+    // NOTE: the source data range covers 'height' complete atlas rows starting
+    // at the rect's top-left pixel, this is why the CPU-side pixel buffer
+    // has one extra row at the end
+    const size_t offset = (size_t)rect->slice * atlas->slice_pitch
+                        + (size_t)rect->y * (size_t)atlas->row_pitch
+                        + (size_t)rect->x * (size_t)atlas->bytes_per_pixel;
+    sg_write_image_desc desc;
+    _satlas_clear(&desc, sizeof(desc));
+    desc.src.data.ptr = atlas->pixels;
+    desc.src.data.size = atlas->pixels_size;
+    desc.src.offset = offset;
+    desc.src.bytes_per_row = atlas->row_pitch;
+    desc.src.bytes_per_slice = atlas->row_pitch * rect->height;
+    desc.dst.image = atlas->img;
+    desc.dst.x = rect->x;
+    desc.dst.y = rect->y;
+    desc.dst.slice = rect->slice;
+    desc.size.width = rect->width;
+    desc.size.height = rect->height;
+    desc.size.num_slices = 1;
+    sg_update_image_region(&desc);
+    _satlas.stats.num_uploads += 1;
+    _satlas.stats.num_upload_bytes += rect->width * rect->height * atlas->bytes_per_pixel;
+}
+
+static void _satlas_upload_dirty_rects(_satlas_atlas_t* atlas) {
+    for (int i = 0; i < atlas->num_dirty_rects; i++) {
+        _satlas_upload_rect(atlas, &atlas->dirty_rects[i]);
+    }
+    atlas->num_dirty_rects = 0;
+}
+
+static void _satlas_add_dirty_rect(_satlas_atlas_t* atlas, const _satlas_rect_t* rect) {
+    // merge with the previous dirty rect when the union doesn't waste too
+    // much area (the typical case are regions written next to each other
+    // on the same shelf)
+    if (atlas->num_dirty_rects > 0) {
+        _satlas_rect_t* prev = &atlas->dirty_rects[atlas->num_dirty_rects - 1];
+        if (prev->slice == rect->slice) {
+            const int x0 = _satlas_min(prev->x, rect->x);
+            const int y0 = _satlas_min(prev->y, rect->y);
+            const int x1 = _satlas_max(prev->x + prev->width, rect->x + rect->width);
+            const int y1 = _satlas_max(prev->y + prev->height, rect->y + rect->height);
+            const int union_area = (x1 - x0) * (y1 - y0);
+            const int sum_area = prev->width * prev->height + rect->width * rect->height;
+            if ((union_area * 4) <= (sum_area * 5)) {
+                prev->x = x0;
+                prev->y = y0;
+                prev->width = x1 - x0;
+                prev->height = y1 - y0;
+                return;
+            }
+        }
+    }
+    if (atlas->num_dirty_rects == _SATLAS_MAX_DIRTY_RECTS) {
+        _satlas_upload_dirty_rects(atlas);
+    }
+    atlas->dirty_rects[atlas->num_dirty_rects++] = *rect;
+}
+
+// >>packer
+// find the leftmost gap on a shelf which fits 'alloc_width', returns x or -1
+static int _satlas_shelf_find_gap(const _satlas_atlas_t* atlas, const _satlas_shelf_t* shelf, int width, int alloc_width) {
+    int cursor = 0;
+    for (int ri = shelf->first_region; ri != 0; ri = _satlas.regions[ri].next_region) {
+        const _satlas_region_t* reg = &_satlas.regions[ri];
+        if ((reg->x - cursor) >= alloc_width) {
+            return cursor;
+        }
+        cursor = reg->x + reg->alloc_width;
+    }
+    // the padding may extend beyond the right atlas border
+    if ((cursor + width) <= atlas->desc.width) {
+        return cursor;
+    }
+    return -1;
+}
+
+static void _satlas_shelf_insert(_satlas_shelf_t* shelf, int region_index) {
+    _satlas_region_t* reg = &_satlas.regions[region_index];
+    int* link = &shelf->first_region;
+    while ((*link != 0) && (_satlas.regions[*link].x < reg->x)) {
+        link = &_satlas.regions[*link].next_region;
+    }
+    reg->next_region = *link;
+    *link = region_index;
+}
+
+static void _satlas_shelf_remove(_satlas_shelf_t* shelf, int region_index) {
+    int* link = &shelf->first_region;
+    while (*link != region_index) {
+        SOKOL_ASSERT(*link != 0);
+        link = &_satlas.regions[*link].next_region;
+    }
+    *link = _satlas.regions[region_index].next_region;
+    _satlas.regions[region_index].next_region = 0;
+}
+
+// release empty shelves at the top of a slice so that the space can be used
+// for shelves of a different height
+static void _satlas_release_top_shelves(_satlas_atlas_t* atlas, int slice) {
+    bool released = true;
+    while (released) {
+        released = false;
+        for (int si = 0; si < atlas->num_shelves; si++) {
+            _satlas_shelf_t* shelf = &atlas->shelves[si];
+            if ((shelf->slice == slice) && (shelf->first_region == 0) && ((shelf->y + shelf->height) == atlas->slice_tops[slice])) {
+                atlas->slice_tops[slice] = shelf->y;
+                // move the last shelf into the free position and patch its regions
+                const int last = --atlas->num_shelves;
+                if (si != last) {
+                    atlas->shelves[si] = atlas->shelves[last];
+                    for (int ri = atlas->shelves[si].first_region; ri != 0; ri = _satlas.regions[ri].next_region) {
+                        _satlas.regions[ri].shelf_index = si;
+                    }
+                }
+                released = true;
+                break;
+            }
+        }
+    }
+}
+
+// find a shelf and x position for a new region, creates a new shelf if needed
+static bool _satlas_pack(_satlas_atlas_t* atlas, int width, int height, int* out_shelf_index, int* out_x) {
+    const int pad = atlas->desc.padding;
+    const int alloc_width = width + pad;
+    const int alloc_height = height + pad;
+    // best fit on existing shelves (smallest shelf that fits), but avoid
+    // shelves which are much higher than the region if a new shelf can be created
+    int best_shelf = -1;
+    int best_x = 0;
+    int best_height = 0;
+    for (int si = 0; si < atlas->num_shelves; si++) {
+        const _satlas_shelf_t* shelf = &atlas->shelves[si];
+        // shelves at the bottom of a slice may be clipped, the padding isn't needed there
+        const bool at_bottom = (shelf->y + shelf->height) == atlas->desc.height;
+        const bool fits_height = (shelf->height >= alloc_height) || (at_bottom && (shelf->height >= height));
+        if (!fits_height) {
+            continue;
+        }
+        if ((best_shelf != -1) && (shelf->height >= best_height)) {
+            continue;
+        }
+        const int x = _satlas_shelf_find_gap(atlas, shelf, width, alloc_width);
+        if (x >= 0) {
+            best_shelf = si;
+            best_x = x;
+            best_height = shelf->height;
+        }
+    }
+    const bool good_fit = (best_shelf != -1) && (best_height <= (2 * alloc_height));
+    if (!good_fit && (atlas->num_shelves < atlas->desc.max_shelves)) {
+        // open a new shelf in the first slice with enough space left
+        for (int slice = 0; slice < atlas->desc.num_slices; slice++) {
+            const int y = atlas->slice_tops[slice];
+            if ((y + height) <= atlas->desc.height) {
+                const int si = atlas->num_shelves++;
+                _satlas_shelf_t* shelf = &atlas->shelves[si];
+                shelf->slice = slice;
+                shelf->y = y;
+                shelf->height = _satlas_min(alloc_height, atlas->desc.height - y);
+                shelf->first_region = 0;
+                atlas->slice_tops[slice] = y + shelf->height;
+                *out_shelf_index = si;
+                *out_x = 0;
+                return true;
+            }
+        }
+    }
+    if (best_shelf != -1) {
+        *out_shelf_index = best_shelf;
+        *out_x = best_x;
+        return true;
+    }
+    return false;
+}
+
+static void _satlas_release_region(_satlas_region_t* reg) {
+    _satlas_atlas_t* atlas = &_satlas.atlases[reg->atlas_index];
+    _satlas_shelf_t* shelf = &atlas->shelves[reg->shelf_index];
+    const int region_index = _satlas_slot_index(reg->slot.id);
+    const int slice = shelf->slice;
+    _satlas_shelf_remove(shelf, region_index);
+    atlas->num_regions -= 1;
+    atlas->num_used_pixels -= reg->alloc_width * shelf->height;
+    _satlas_clear(reg, sizeof(_satlas_region_t));
+    _satlas_pool_free_index(&_satlas.region_pool, region_index);
+    _satlas_release_top_shelves(atlas, slice);
+}
+
+static void _satlas_retire_regions(void) {
+    if (0 == _satlas.num_retired) {
+        return;
+    }
+    for (int i = 1; i < _satlas.region_pool.size; i++) {
+        _satlas_region_t* reg = &_satlas.regions[i];
+        if (reg->retired && ((int32_t)(_satlas.frame_count - reg->retire_frame) >= 0)) {
+            _satlas_release_region(reg);
+            _satlas.num_retired -= 1;
+            _satlas.stats.num_retired += 1;
+        }
+    }
+}
+
+// >>public
+SOKOL_API_IMPL void satlas_setup(const satlas_desc* desc) {
+    SOKOL_ASSERT(desc);
+    SOKOL_ASSERT(0 == _satlas.init_tag);
+    _satlas_clear(&_satlas, sizeof(_satlas));
+    _satlas.init_tag = _SATLAS_INIT_TAG;
+    _satlas.desc = _satlas_desc_defaults(desc);
+    _satlas_init_pool(&_satlas.atlas_pool, _satlas.desc.max_atlases);
+    _satlas.atlases = (_satlas_atlas_t*) _satlas_malloc_clear(sizeof(_satlas_atlas_t) * (size_t)_satlas.atlas_pool.size);
+    _satlas_init_pool(&_satlas.region_pool, _satlas.desc.max_regions);
+    _satlas.regions = (_satlas_region_t*) _satlas_malloc_clear(sizeof(_satlas_region_t) * (size_t)_satlas.region_pool.size);
+}
+
+SOKOL_API_IMPL void satlas_shutdown(void) {
+    SOKOL_ASSERT(_SATLAS_INIT_TAG == _satlas.init_tag);
+    for (int i = 1; i < _satlas.atlas_pool.size; i++) {
+        if (_satlas.atlases[i].slot.state == SG_RESOURCESTATE_VALID) {
+            satlas_atlas atlas = { _satlas.atlases[i].slot.id };
+            satlas_destroy_atlas(atlas);
+        }
+    }
+    _satlas_free(_satlas.regions);
+    _satlas_discard_pool(&_satlas.region_pool);
+    _satlas_free(_satlas.atlases);
+    _satlas_discard_pool(&_satlas.atlas_pool);
+    _satlas.init_tag = 0;
+}
+
+SOKOL_API_IMPL satlas_atlas satlas_make_atlas(const satlas_atlas_desc* desc) {
+    SOKOL_ASSERT(_SATLAS_INIT_TAG == _satlas.init_tag);
+    SOKOL_ASSERT(desc);
+    satlas_atlas res = { SATLAS_INVALID_ID };
+    const satlas_atlas_desc desc_def = _satlas_atlas_desc_defaults(desc);
+    SOKOL_ASSERT((desc_def.width > 0) && (desc_def.height > 0) && (desc_def.num_slices > 0));
+    SOKOL_ASSERT((desc_def.padding >= 0) && (desc_def.max_shelves > 0));
+    const sg_pixelformat_info fmt_info = sg_query_pixelformat(desc_def.pixel_format);
+    if (!fmt_info.sample || fmt_info.compressed || fmt_info.depth || (fmt_info.bytes_per_pixel == 0)) {
+        _SATLAS_ERROR(INVALID_PIXEL_FORMAT);
+        return res;
+    }
+    const int slot_index = _satlas_pool_alloc_index(&_satlas.atlas_pool);
+    if (_SATLAS_INVALID_SLOT_INDEX == slot_index) {
+        _SATLAS_ERROR(ATLAS_POOL_EXHAUSTED);
+        return res;
+    }
+    _satlas_atlas_t* atlas = &_satlas.atlases[slot_index];
+    res.id = _satlas_slot_alloc(&_satlas.atlas_pool, &atlas->slot, slot_index);
+    atlas->desc = desc_def;
+    sg_image_desc img_desc;
+    _satlas_clear(&img_desc, sizeof(img_desc));
+    img_desc.type = (desc_def.num_slices > 1) ? SG_IMAGETYPE_ARRAY : SG_IMAGETYPE_2D;
+    img_desc.usage.region_update = true;
+    img_desc.width = desc_def.width;
+    img_desc.height = desc_def.height;
+    img_desc.num_slices = desc_def.num_slices;
+    img_desc.pixel_format = desc_def.pixel_format;
+    img_desc.label = desc_def.label;
+    atlas->img = sg_make_image(&img_desc);
+    if (sg_query_image_state(atlas->img) != SG_RESOURCESTATE_VALID) {
+        _SATLAS_ERROR(MAKE_IMAGE_FAILED);
+        sg_destroy_image(atlas->img);
+        _satlas_clear(atlas, sizeof(_satlas_atlas_t));
+        _satlas_pool_free_index(&_satlas.atlas_pool, slot_index);
+        res.id = SATLAS_INVALID_ID;
+        return res;
+    }
+    sg_view_desc view_desc;
+    _satlas_clear(&view_desc, sizeof(view_desc));
+    view_desc.texture.image = atlas->img;
+    view_desc.label = desc_def.label;
+    atlas->view = sg_make_view(&view_desc);
+    if (sg_query_view_state(atlas->view) != SG_RESOURCESTATE_VALID) {
+        _SATLAS_ERROR(MAKE_VIEW_FAILED);
+    }
+    atlas->bytes_per_pixel = fmt_info.bytes_per_pixel;
+    atlas->row_pitch = desc_def.width * fmt_info.bytes_per_pixel;
+    atlas->slice_pitch = (size_t)atlas->row_pitch * (size_t)desc_def.height;
+    atlas->pixels_size = atlas->slice_pitch * (size_t)desc_def.num_slices + (size_t)atlas->row_pitch;
+    atlas->pixels = (uint8_t*) _satlas_malloc_clear(atlas->pixels_size);
+    atlas->shelves = (_satlas_shelf_t*) _satlas_malloc_clear(sizeof(_satlas_shelf_t) * (size_t)desc_def.max_shelves);
+    atlas->slice_tops = (int*) _satlas_malloc_clear(sizeof(int) * (size_t)desc_def.num_slices);
+    atlas->slot.state = SG_RESOURCESTATE_VALID;
+    return res;
+}
+
+SOKOL_API_IMPL void satlas_destroy_atlas(satlas_atlas atlas_id) {
+    SOKOL_ASSERT(_SATLAS_INIT_TAG == _satlas.init_tag);
+    _satlas_atlas_t* atlas = _satlas_lookup_atlas(atlas_id.id);
+    if (0 == atlas) {
+        return;
+    }
+    const int atlas_index = _satlas_slot_index(atlas_id.id);
+    for (int i = 1; i < _satlas.region_pool.size; i++) {
+        _satlas_region_t* reg = &_satlas.regions[i];
+        if ((reg->slot.state == SG_RESOURCESTATE_VALID) && (reg->atlas_index == atlas_index)) {
+            if (reg->retired) {
+                _satlas.num_retired -= 1;
+            }
+            _satlas_clear(reg, sizeof(_satlas_region_t));
+            _satlas_pool_free_index(&_satlas.region_pool, i);
+        }
+    }
+    sg_destroy_view(atlas->view);
+    sg_destroy_image(atlas->img);
+    _satlas_free(atlas->slice_tops);
+    _satlas_free(atlas->shelves);
+    _satlas_free(atlas->pixels);
+    _satlas_clear(atlas, sizeof(_satlas_atlas_t));
+    _satlas_pool_free_index(&_satlas.atlas_pool, atlas_index);
+}
+
+SOKOL_API_IMPL satlas_region satlas_alloc(satlas_atlas atlas_id, int width, int height) {
+    SOKOL_ASSERT(_SATLAS_INIT_TAG == _satlas.init_tag);
+    satlas_region res = { SATLAS_INVALID_ID };
+    _satlas_atlas_t* atlas = _satlas_lookup_atlas(atlas_id.id);
+    if (0 == atlas) {
+        _SATLAS_ERROR(ALLOC_INVALID_ATLAS);
+        return res;
+    }
+    if ((width <= 0) || (height <= 0) || (width > atlas->desc.width) || (height > atlas->desc.height)) {
+        _SATLAS_ERROR(ALLOC_INVALID_SIZE);
+        return res;
+    }
+    int shelf_index = 0;
+    int x = 0;
+    if (!_satlas_pack(atlas, width, height, &shelf_index, &x)) {
+        _SATLAS_WARN(ATLAS_FULL);
+        return res;
+    }
+    const int slot_index = _satlas_pool_alloc_index(&_satlas.region_pool);
+    if (_SATLAS_INVALID_SLOT_INDEX == slot_index) {
+        _SATLAS_ERROR(REGION_POOL_EXHAUSTED);
+        // a newly opened shelf might be empty now
+        _satlas_release_top_shelves(atlas, atlas->shelves[shelf_index].slice);
+        return res;
+    }
+    _satlas_region_t* reg = &_satlas.regions[slot_index];
+    res.id = _satlas_slot_alloc(&_satlas.region_pool, &reg->slot, slot_index);
+    reg->atlas_index = _satlas_slot_index(atlas_id.id);
+    reg->shelf_index = shelf_index;
+    reg->x = x;
+    reg->width = width;
+    reg->height = height;
+    reg->alloc_width = width + atlas->desc.padding;
+    reg->slot.state = SG_RESOURCESTATE_VALID;
+    _satlas_shelf_insert(&atlas->shelves[shelf_index], slot_index);
+    atlas->num_regions += 1;
+    atlas->num_used_pixels += reg->alloc_width * atlas->shelves[shelf_index].height;
+    return res;
+}
+
+SOKOL_API_IMPL void satlas_free(satlas_region region_id) {
+    SOKOL_ASSERT(_SATLAS_INIT_TAG == _satlas.init_tag);
+    _satlas_region_t* reg = _satlas_lookup_region(region_id.id);
+    if (reg) {
+        // in-flight frames may still sample the old content, so the space
+        // can only be reused a couple of flushes later
+        reg->retired = true;
+        reg->retire_frame = _satlas.frame_count + SG_NUM_INFLIGHT_FRAMES + 1;
+        _satlas.num_retired += 1;
+    }
+}
+
+SOKOL_API_IMPL void satlas_write(satlas_region region_id, const sg_range* data) {
+    SOKOL_ASSERT(_SATLAS_INIT_TAG == _satlas.init_tag);
+    SOKOL_ASSERT(data);
+    const _satlas_region_t* reg = _satlas_lookup_region(region_id.id);
+    if (0 == reg) {
+        _SATLAS_ERROR(WRITE_INVALID_REGION);
+        return;
+    }
+    _satlas_atlas_t* atlas = &_satlas.atlases[reg->atlas_index];
+    const _satlas_shelf_t* shelf = &atlas->shelves[reg->shelf_index];
+    const int bpp = atlas->bytes_per_pixel;
+    const size_t src_pitch = (size_t)(reg->width * bpp);
+    if ((0 == data->ptr) || (data->size != (src_pitch * (size_t)reg->height))) {
+        _SATLAS_ERROR(WRITE_INVALID_DATA_SIZE);
+        return;
+    }
+    // the dirty rect includes the padding which is cleared, since it may
+    // contain leftovers of a freed region
+    _satlas_rect_t rect;
+    rect.x = reg->x;
+    rect.y = shelf->y;
+    rect.width = _satlas_min(reg->alloc_width, atlas->desc.width - reg->x);
+    rect.height = _satlas_min(reg->height + atlas->desc.padding, atlas->desc.height - shelf->y);
+    rect.slice = shelf->slice;
+    uint8_t* dst = atlas->pixels
+        + (size_t)rect.slice * atlas->slice_pitch
+        + (size_t)rect.y * (size_t)atlas->row_pitch
+        + (size_t)(rect.x * bpp);
+    const uint8_t* src = (const uint8_t*)data->ptr;
+    const size_t dst_pitch = (size_t)(rect.width * bpp);
+    for (int y = 0; y < rect.height; y++) {
+        if (y < reg->height) {
+            memcpy(dst, src, src_pitch);
+            if (dst_pitch > src_pitch) {
+                memset(dst + src_pitch, 0, dst_pitch - src_pitch);
+            }
+            src += src_pitch;
+        } else {
+            memset(dst, 0, dst_pitch);
+        }
+        dst += atlas->row_pitch;
+    }
+    _satlas_add_dirty_rect(atlas, &rect);
+}
+
+SOKOL_API_IMPL void satlas_flush(void) {
+    SOKOL_ASSERT(_SATLAS_INIT_TAG == _satlas.init_tag);
+    _satlas_clear(&_satlas.stats, sizeof(_satlas.stats));
+    for (int i = 1; i < _satlas.atlas_pool.size; i++) {
+        _satlas_atlas_t* atlas = &_satlas.atlases[i];
+        if (atlas->slot.state == SG_RESOURCESTATE_VALID) {
+            _satlas_upload_dirty_rects(atlas);
+        }
+    }
+    _satlas.frame_count += 1;
+    _satlas_retire_regions();
+}
+
+SOKOL_API_IMPL satlas_region_info satlas_query_region_info(satlas_region region_id) {
+    SOKOL_ASSERT(_SATLAS_INIT_TAG == _satlas.init_tag);
+    satlas_region_info res;
+    _satlas_clear(&res, sizeof(res));
+    const _satlas_region_t* reg = _satlas_lookup_region(region_id.id);
+    if (reg) {
+        const _satlas_atlas_t* atlas = &_satlas.atlases[reg->atlas_index];
+        const _satlas_shelf_t* shelf = &atlas->shelves[reg->shelf_index];
+        const float w = (float)atlas->desc.width;
+        const float h = (float)atlas->desc.height;
+        res.valid = true;
+        res.x = reg->x;
+        res.y = shelf->y;
+        res.width = reg->width;
+        res.height = reg->height;
+        res.slice = shelf->slice;
+        res.u0 = (float)res.x / w;
+        res.v0 = (float)res.y / h;
+        res.u1 = (float)(res.x + res.width) / w;
+        res.v1 = (float)(res.y + res.height) / h;
+        res.image = atlas->img;
+        res.view = atlas->view;
+    }
+    return res;
+}
+
+SOKOL_API_IMPL satlas_atlas_info satlas_query_atlas_info(satlas_atlas atlas_id) {
+    SOKOL_ASSERT(_SATLAS_INIT_TAG == _satlas.init_tag);
+    satlas_atlas_info res;
+    _satlas_clear(&res, sizeof(res));
+    const _satlas_atlas_t* atlas = _satlas_lookup_atlas(atlas_id.id);
+    if (atlas) {
+        res.valid = true;
+        res.num_regions = atlas->num_regions;
+        res.num_shelves = atlas->num_shelves;
+        res.num_used_pixels = atlas->num_used_pixels;
+        res.num_dirty_rects = atlas->num_dirty_rects;
+    }
+    return res;
+}
+
+SOKOL_API_IMPL sg_image satlas_query_image(satlas_atlas atlas_id) {
+    SOKOL_ASSERT(_SATLAS_INIT_TAG == _satlas.init_tag);
+    const _satlas_atlas_t* atlas = _satlas_lookup_atlas(atlas_id.id);
+    if (atlas) {
+        return atlas->img;
+    }
+    sg_image res = { SG_INVALID_ID };
+    return res;
+}
+
+SOKOL_API_IMPL sg_view satlas_query_view(satlas_atlas atlas_id) {
+    SOKOL_ASSERT(_SATLAS_INIT_TAG == _satlas.init_tag);
+    const _satlas_atlas_t* atlas = _satlas_lookup_atlas(atlas_id.id);
+    if (atlas) {
+        return atlas->view;
+    }
+    sg_view res = { SG_INVALID_ID };
+    return res;
+}
+
+SOKOL_API_IMPL satlas_stats satlas_query_stats(void) {
+    SOKOL_ASSERT(_SATLAS_INIT_TAG == _satlas.init_tag);
+    return _satlas.stats;
+}
+
+#endif // SOKOL_ATLAS_IMPL
@@ -112,8 +112,7 @@
             sgl_push_pipeline();
             sgl_load_pipeline(...);
             sgl_begin_triangles();
-            for each vertex:
-                sgl_v2f_t2f_c1i(...);
+            sgl_vertices(...);
             sgl_end();
             sgl_pop_pipeline();
             sgl_disable_texture();
@@ -1919,9 +1918,13 @@ static void _sfons_render_draw(void* user_ptr, const float* verts, const float*
     sgl_push_pipeline();
     sgl_load_pipeline(sfons->pip);
     sgl_begin_triangles();
-    for (int i = 0; i < nverts; i++) {
-        sgl_v2f_t2f_c1i(verts[2*i+0], verts[2*i+1], tcoords[2*i+0], tcoords[2*i+1], colors[i]);
-    }
+    sgl_vertex_desc_t vtx_desc;
+    _sfons_clear(&vtx_desc, sizeof(vtx_desc));
+    vtx_desc.pos.ptr = verts;
+    vtx_desc.pos_components = 2;
+    vtx_desc.uv.ptr = tcoords;
+    vtx_desc.color.ptr = colors;
+    sgl_vertices(&vtx_desc, nverts);
     sgl_end();
     sgl_pop_pipeline();
     sgl_disable_texture();
@@ -426,6 +426,7 @@ typedef enum {
     _SGIMGUI_CMD_DESTROY_VIEW,
     _SGIMGUI_CMD_UPDATE_BUFFER,
     _SGIMGUI_CMD_UPDATE_IMAGE,
+    _SGIMGUI_CMD_UPDATE_IMAGE_REGION,
     _SGIMGUI_CMD_APPEND_BUFFER,
     _SGIMGUI_CMD_WRITE_BUFFER_UNSEALED,
     _SGIMGUI_CMD_WRITE_IMAGE_UNSEALED,
@@ -555,6 +556,13 @@ typedef struct {
     sg_image_extent write_size;
 } _sgimgui_args_write_image_unsealed_t;
 
+typedef struct {
+    size_t src_data_size;
+    int src_bytes_per_row;
+    sg_image_location dst;
+    sg_image_extent write_size;
+} _sgimgui_args_update_image_region_t;
+
 typedef struct {
     sg_buffer buffer;
 } _sgimgui_args_seal_buffer_t;
@@ -751,6 +759,7 @@ typedef union {
     _sgimgui_args_destroy_view_t destroy_view;
     _sgimgui_args_update_buffer_t update_buffer;
     _sgimgui_args_update_image_t update_image;
+    _sgimgui_args_update_image_region_t update_image_region;
     _sgimgui_args_append_buffer_t append_buffer;
     _sgimgui_args_write_buffer_unsealed_t write_buffer_unsealed;
     _sgimgui_args_write_image_unsealed_t write_image_unsealed;
@@ -2068,6 +2077,20 @@ _SOKOL_PRIVATE _sgimgui_str_t _sgimgui_capture_item_string(_sgimgui_t* ctx, int
             _sgimgui_snprintf(&str, "%d: sg_write_image_unsealed(desc=...)", index);
             break;
 
+        case _SGIMGUI_CMD_UPDATE_IMAGE_REGION:
+            {
+                _sgimgui_str_t res_id = _sgimgui_image_id_string(ctx, item->args.update_image_region.dst.image);
+                _sgimgui_snprintf(&str, "%d: sg_update_image_region(img=%s, mip=%d, x=%d, y=%d, w=%d, h=%d)",
+                    index,
+                    res_id.buf,
+                    item->args.update_image_region.dst.mip_level,
+                    item->args.update_image_region.dst.x,
+                    item->args.update_image_region.dst.y,
+                    item->args.update_image_region.write_size.width,
+                    item->args.update_image_region.write_size.height);
+            }
+            break;
+
         case _SGIMGUI_CMD_SEAL_BUFFER:
             {
                 _sgimgui_str_t res_id = _sgimgui_buffer_id_string(ctx, item->args.seal_buffer.buffer);
@@ -2633,6 +2656,23 @@ _SOKOL_PRIVATE void _sgimgui_update_image(sg_image img, const sg_image_data* dat
     }
 }
 
+_SOKOL_PRIVATE void _sgimgui_update_image_region(const sg_write_image_desc* desc, void* user_data) {
+    _sgimgui_t* ctx = (_sgimgui_t*) user_data;
+    SOKOL_ASSERT(ctx);
+    _sgimgui_capture_item_t* item = _sgimgui_capture_next_write_item(ctx);
+    if (item) {
+        item->cmd = _SGIMGUI_CMD_UPDATE_IMAGE_REGION;
+        item->color = _SGIMGUI_COLOR_RSRC;
+        item->args.update_image_region.src_data_size = desc->src.data.size;
+        item->args.update_image_region.src_bytes_per_row = desc->src.bytes_per_row;
+        item->args.update_image_region.dst = desc->dst;
+        item->args.update_image_region.write_size = desc->size;
+    }
+    if (ctx->hooks.update_image_region) {
+        ctx->hooks.update_image_region(desc, ctx->hooks.user_data);
+    }
+}
+
 _SOKOL_PRIVATE void _sgimgui_append_buffer(sg_buffer buf, const sg_range* data, int result, void* user_data) {
     _sgimgui_t* ctx = (_sgimgui_t*) user_data;
     SOKOL_ASSERT(ctx);
@@ -3723,6 +3763,7 @@ _SOKOL_PRIVATE void _sgimgui_draw_image_panel(_sgimgui_t* ctx, sg_image img) {
             _sgimgui_igtext("  immutable: %s", _sgimgui_bool_string(desc->usage.immutable));
             _sgimgui_igtext("  dynamic_update: %s", _sgimgui_bool_string(desc->usage.dynamic_update));
             _sgimgui_igtext("  stream_update: %s", _sgimgui_bool_string(desc->usage.stream_update));
+            _sgimgui_igtext("  region_update: %s", _sgimgui_bool_string(desc->usage.region_update));
             _sgimgui_igtext("  write_unsealed: %s", _sgimgui_bool_string(desc->usage.write_unsealed));
             _sgimgui_igtext("Width:          %d", desc->width);
             _sgimgui_igtext("Height:         %d", desc->height);
@@ -4560,6 +4601,9 @@ _SOKOL_PRIVATE void _sgimgui_draw_capture_panel(_sgimgui_t* ctx) {
         case _SGIMGUI_CMD_WRITE_IMAGE_UNSEALED:
             _sgimgui_draw_image_panel(ctx, item->args.write_image_unsealed.dst.image);
             break;
+        case _SGIMGUI_CMD_UPDATE_IMAGE_REGION:
+            _sgimgui_draw_image_panel(ctx, item->args.update_image_region.dst.image);
+            break;
         case _SGIMGUI_CMD_SEAL_BUFFER:
             _sgimgui_draw_buffer_panel(ctx, item->args.seal_buffer.buffer);
             break;
@@ -4700,6 +4744,10 @@ _SOKOL_PRIVATE void _sgimgui_draw_caps_panel(void) {
     _sgimgui_igtext("    dual_source_blending: %s", _sgimgui_bool_string(f.dual_source_blending));
     _sgimgui_igtext("    vertexformat_int10_n2: %s", _sgimgui_bool_string(f.vertexformat_int10_n2));
     _sgimgui_igtext("    gl_texture_views: %s", _sgimgui_bool_string(f.gl_texture_views));
+    _sgimgui_igtext("    readback: %s", _sgimgui_bool_string(f.readback));
+    _sgimgui_igtext("    gpu_timers: %s", _sgimgui_bool_string(f.gpu_timers));
+    _sgimgui_igtext("    occlusion_query: %s", _sgimgui_bool_string(f.occlusion_query));
+    _sgimgui_igtext("    occlusion_query_samples: %s", _sgimgui_bool_string(f.occlusion_query_samples));
     sg_limits l = sg_query_limits();
     _sgimgui_igtext("\nLimits:\n");
     _sgimgui_igtext("    max_image_size_2d: %d", l.max_image_size_2d);
@@ -4783,10 +4831,17 @@ _SOKOL_PRIVATE void _sgimgui_draw_frame_stats_panel(_sgimgui_t* ctx) {
         _sgimgui_frame_stats(prev_frame.num_update_buffer);
         _sgimgui_frame_stats(prev_frame.num_append_buffer);
         _sgimgui_frame_stats(prev_frame.num_update_image);
+        _sgimgui_frame_stats(prev_frame.num_read_buffer);
+        _sgimgui_frame_stats(prev_frame.num_read_image);
         _sgimgui_frame_stats(prev_frame.size_apply_uniforms);
         _sgimgui_frame_stats(prev_frame.size_update_buffer);
         _sgimgui_frame_stats(prev_frame.size_append_buffer);
         _sgimgui_frame_stats(prev_frame.size_update_image);
+        _sgimgui_frame_stats(prev_frame.size_read_buffer);
+        _sgimgui_frame_stats(prev_frame.size_read_image);
+        _sgimgui_frame_stats(prev_frame.uniform_buffer_used);
+        _sgimgui_frame_stats(prev_frame.uniform_buffer_peak);
+        _sgimgui_frame_stats(prev_frame.uniform_buffer_size);
         _sgimgui_frame_stats(prev_frame.buffers.allocated);
         _sgimgui_frame_stats(prev_frame.buffers.deallocated);
         _sgimgui_frame_stats(prev_frame.buffers.inited);
@@ -4996,6 +5051,7 @@ SOKOL_API_IMPL void sgimgui_setup(const sgimgui_desc_t* desc) {
     hooks.destroy_view = _sgimgui_destroy_view;
     hooks.update_buffer = _sgimgui_update_buffer;
     hooks.update_image = _sgimgui_update_image;
+    hooks.update_image_region = _sgimgui_update_image_region;
     hooks.append_buffer = _sgimgui_append_buffer;
     hooks.write_buffer_unsealed = _sgimgui_write_buffer_unsealed;
     hooks.write_image_unsealed = _sgimgui_write_image_unsealed;
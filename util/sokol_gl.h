@@ -31,6 +31,8 @@
     SOKOL_API_DECL      - same as SOKOL_GL_API_DECL
     SOKOL_API_IMPL      - public function implementation prefix (default: -)
     SOKOL_UNREACHABLE() - a guard macro for unreachable code (default: assert(false))
+    SOKOL_GL_NO_SIMD    - don't use the SSE2/NEON code paths for CPU-side vertex
+                          transform (see cpu_transform), use the scalar fallback
 
     If sokol_gl.h is compiled as a DLL, define the following before
     including the declaration or implementation:
@@ -135,6 +137,7 @@
 
             .context_pool_size      (default: 4)
             .pipeline_pool_size     (default: 64)
+            .display_list_pool_size (default: 64)
             .max_vertices       (default: 64k)
             .max_commands       (default: 16k)
 
@@ -338,6 +341,10 @@
             sgl_begin_triangle_strip()
             sgl_begin_quads()
 
+        Lines are rendered as native 1-pixel lines, unless a line width or
+        smooth lines have been set before sgl_begin_lines() or
+        sgl_begin_line_strip() (see WIDE AND SMOOTH LINES).
+
         ...after sgl_begin_*() specify vertices:
 
             sgl_v*(...)
@@ -350,6 +357,25 @@
         and/or color is missing, it will be taken from the current texture-coord
         and color 'register'.
 
+        ...or alternatively write an entire array of vertices with a single call:
+
+            sgl_vertices(&(sgl_vertex_desc_t){
+                .pos = { .ptr = positions },
+                .pos_components = 2,
+                .uv = { .ptr = texcoords },
+                .color = { .ptr = colors },
+            }, num_vertices);
+
+        Each vertex component is provided as a separate array of 4-byte aligned
+        elements with an optional byte stride, so that both interleaved and
+        non-interleaved vertex data can be used. Positions are float[2] or
+        float[3], texture coordinates are float[2] and colors are packed
+        uint32_t RGBA values (like in sgl_c1i()). Missing texture coordinates
+        and colors are taken from the current 'registers'. This is much faster
+        than calling sgl_v*() for each vertex when rendering mesh-like data.
+        The vertices are either written completely, or (if the vertex buffer
+        is full) not at all.
+
         ...finally, after specifying vertices, call:
 
             sgl_end()
@@ -405,6 +431,32 @@
         full before the overflow actually happens (in this case you could also
         check the error booleans in the result of sgl_error()).
 
+    --- to size the vertex and command pools, you can get the current capacity
+        and the high-water marks (the max number of vertices, uniform updates
+        and commands recorded in a frame since context creation) via:
+
+            sgl_stats_t sgl_query_stats()
+            sgl_stats_t sgl_context_query_stats(ctx)
+
+    --- alternatively, a context can grow its vertex, uniform and command
+        storage on demand instead of running into a vertices_full,
+        uniforms_full or commands_full error by setting the opt-in flag
+        sgl_desc_t.auto_grow (for the default context) or
+        sgl_context_desc_t.auto_grow:
+
+            sgl_setup(&(sgl_desc_t){
+                .max_vertices = ...,    // the initial capacity
+                .max_commands = ...,
+                .auto_grow = true,
+            });
+
+        When the storage is full, its capacity is doubled (this involves a
+        memory allocation and copy), and the sokol-gfx vertex buffer is
+        recreated with the new capacity in the next sgl_draw() call. The
+        capacity never shrinks, so max_vertices and max_commands can be set
+        to a typical frame's requirements and peak frames will degrade
+        gracefully instead of losing geometry.
+
     RENDER LAYERS
     =============
     Render layers allow to split sokol-gl rendering into separate draw-command
@@ -432,6 +484,24 @@
     (in general you should either use either use sgl_draw() or
     sgl_draw_layer() in an application, but not both).
 
+    Each sgl_draw_layer() call only visits the draw commands of its own
+    layer. When the layers are recorded in ascending order this doesn't
+    require any extra work, otherwise the recorded commands are sorted
+    by layer once per frame in the first sgl_draw_layer() call.
+
+    Optionally, the draw commands of a layer can be sorted by pipeline and
+    texture before rendering to minimize sokol-gfx state changes:
+
+        sgl_draw_layer_sorted(int layer_id)
+
+    (and the context-variant sgl_context_draw_layer_sorted())
+
+    Draw commands are only reordered between viewport and scissor rect
+    changes, but since this changes the order in which draw commands are
+    rendered, it should only be used for layers where the draw order
+    doesn't matter (e.g. no alpha-blending and no overlapping geometry
+    without depth-testing).
+
     WORKING WITH CONTEXTS:
     ======================
     If you want to render to more than one sokol-gfx render pass you need to
@@ -486,6 +556,7 @@
 
         sgl_make_pipeline() vs sgl_context_make_pipeline()
         sgl_error() vs sgl_context_error();
+        sgl_query_stats() vs sgl_context_query_stats();
         sgl_draw() vs sgl_context_draw();
 
     Except for using the currently active context versus a provided context
@@ -507,6 +578,50 @@
     calls which require a currently active context will silently fail,
     and sgl_error() will return SGL_ERROR_NO_CONTEXT.
 
+    RECORDING ON WORKER THREADS
+    ===========================
+    All recording functions also exist as a variant with an explicit context
+    handle as first argument and the prefix 'sgl_context_' instead of 'sgl_',
+    for instance:
+
+        sgl_defaults() vs sgl_context_defaults(ctx)
+        sgl_begin_triangles() vs sgl_context_begin_triangles(ctx)
+        sgl_v2f_c3b(x, y, r, g, b) vs sgl_context_v2f_c3b(ctx, x, y, r, g, b)
+        sgl_end() vs sgl_context_end(ctx)
+
+    ...this covers the state functions (sgl_defaults(), sgl_viewport(),
+    sgl_texture(), sgl_layer(), ...), the pipeline and matrix stack functions,
+    the 'register' functions (sgl_t2f(), sgl_c*(), sgl_point_size()), the
+    sgl_begin_*(), sgl_v*(), sgl_vertices() and sgl_end() functions and
+    sgl_call_display_list().
+
+    The explicit-context variants don't read or write the currently active
+    context, and they only write to the context that's passed in. This means
+    that different contexts can be recorded on different threads in
+    parallel, for instance one context per editor viewport or per debug-draw
+    system:
+
+        // on each worker thread:
+        sgl_context_defaults(ctx);
+        sgl_context_begin_lines(ctx);
+        sgl_context_v3f(ctx, ...);
+        ...
+        sgl_context_end(ctx);
+
+        // ...after joining the workers, on the render thread:
+        sgl_context_draw(ctx);
+
+    The following restrictions apply:
+
+    - a context must only be recorded on one thread at a time, and not while
+      it is rendered via sgl_context_draw()
+    - sgl_setup(), sgl_shutdown(), sgl_make_context(), sgl_destroy_context(),
+      sgl_make_pipeline(), sgl_destroy_pipeline(), the sgl_draw*() functions
+      and the display list functions (except sgl_context_call_display_list())
+      must not be called while worker threads are recording
+    - the logging callback and (with auto_grow) the memory allocation
+      callbacks must be thread-safe
+
     UNDER THE HOOD:
     ===============
     sokol_gl.h works by recording vertex data and rendering commands into
@@ -523,6 +638,8 @@
 
     All other sokol-gl function can be called anywhere in a frame, since
     they just record data into memory buffers owned by sokol-gl.
+    The recording functions which take an explicit context handle may also
+    be called on other threads (see RECORDING ON WORKER THREADS).
 
     What happens in:
 
@@ -530,12 +647,13 @@
             Unique resources shared by all contexts are created:
                 - a shader object (using embedded shader source or byte code)
                 - an 8x8 white default texture
+                - a static index buffer for rendering quads
             The default context is created, which involves:
                 - 3 memory buffers are created, one for vertex data,
                   one for uniform data, and one for commands
                 - a dynamic vertex buffer is created
                 - the default sgl_pipeline object is created, which involves
-                  creating 5 sg_pipeline objects
+                  creating 6 sg_pipeline objects
 
             One vertex is 24 bytes:
                 - float3 position
@@ -555,6 +673,13 @@
 
                 (152 + 24 * num_verts) bytes
 
+            Quads are recorded as 4 vertices per quad and rendered as
+            indexed triangles through the shared static index buffer.
+            If the backend supports sg_features.draw_base_vertex, the
+            first vertex of a quad draw is selected with the base vertex
+            of sg_draw_ex(), otherwise with a vertex buffer offset (which
+            requires an sg_apply_bindings() call per quad draw).
+
         sgl_shutdown():
             - all sokol-gfx resources (buffer, shader, default-texture and
               all pipeline objects) are destroyed
@@ -600,6 +725,179 @@
     to render in the previous draw command will be incremented by the
     number of vertices in the new draw command.
 
+    Code which changes the modelview matrix for each primitive (for instance
+    push/translate/pop for each sprite or text glyph) will thus end up with
+    one draw call per primitive. To prevent this, the vertex positions can
+    be transformed by the modelview matrix on the CPU inside the sgl_v*()
+    functions, in this case only changes to the projection and texture
+    matrix prevent merging draw commands. This is an opt-in per-context
+    setting in sgl_desc_t (for the default context) and
+    sgl_context_desc_t:
+
+        sgl_setup(&(sgl_desc_t){
+            .cpu_transform = true,
+        });
+
+        sgl_context ctx = sgl_make_context(&(sgl_context_desc_t){
+            .cpu_transform = true,
+        });
+
+    NOTE that with CPU-side transform the modelview matrix must be an
+    affine transform, a projective component in the modelview matrix
+    (e.g. a call to sgl_perspective() in modelview matrix mode) is ignored.
+
+    On x86/x64 with SSE2 and on ARM with NEON the CPU-side transform uses
+    a SIMD matrix-vector kernel, define SOKOL_GL_NO_SIMD before including
+    the implementation to use the scalar fallback instead.
+
+    Interleaved rendering of primitives with different state (for instance
+    text, then a shape, then text again) will also prevent merging because
+    only the previous draw command is considered. If the rendering order
+    of a context's draw commands doesn't matter (because the geometry is
+    opaque and depth-tested, or doesn't overlap), an optional 'merge
+    window' allows sgl_end() to look back over the last N recorded
+    commands and merge the new vertices into a compatible earlier draw
+    command:
+
+        sgl_setup(&(sgl_desc_t){
+            .merge_window = 8,
+        });
+
+        sgl_context ctx = sgl_make_context(&(sgl_context_desc_t){
+            .merge_window = 8,
+        });
+
+    The look-back stops at the first sgl_viewport() or sgl_scissor_rect()
+    command in the current layer. Since the merged vertices are no longer
+    adjacent in the vertex buffer, the vertices are gathered into contiguous
+    per-command vertex ranges in the first sgl_draw() call of a frame
+    (which means an additional copy of all vertices in frames where
+    non-adjacent merges happened). The merge window is off by default.
+
+    WIDE AND SMOOTH LINES
+    =====================
+    By default, sgl_begin_lines() and sgl_begin_line_strip() render native
+    lines which are always one pixel wide. To render wide lines, set the
+    line width outside of sgl_begin_*() / sgl_end():
+
+        sgl_line_width(4.0f);
+
+    ...and to render lines with anti-aliased (feathered) edges, call:
+
+        sgl_enable_line_smooth();
+
+    ...which is disabled again with sgl_disable_line_smooth() or sgl_defaults()
+    (which also resets the line width to 1.0).
+
+    If the line width isn't 1.0 or smooth lines are enabled, lines are
+    tessellated into triangles on the CPU while they are recorded. Line strips
+    get mitered joins, separate lines and the ends of line strips get
+    butt caps. Since the resulting draw commands are regular triangle draw
+    commands, they can be merged with other triangles (while native line
+    strips always start a new draw command).
+
+    Smooth lines are surrounded by a one unit wide border which fades out
+    to zero alpha, this requires a pipeline with alpha blending.
+
+    NOTE that the line width and smoothing border are measured in the
+    units of the vertex positions in the xy plane (before any transformation),
+    so this is mainly useful for 2D rendering with a pixel-aligned orthographic
+    projection like sgl_ortho(0.0f, width, height, 0.0f, -1.0f, +1.0f).
+    The z coordinate is carried along but ignored by the tessellation, a
+    segment which only extends along z is dropped, and a warning
+    (LINE_VARYING_Z) is logged once per sgl_begin_*()/sgl_end() pair when
+    z varies along a wide or smooth line.
+
+    VERTEX LAYOUTS
+    ==============
+    By default, each vertex takes 28 bytes in the vertex buffer (a float3
+    position, float2 texture coordinate, packed RGBA8 color and float point
+    size). For 2D rendering (e.g. UIs) which doesn't need a z coordinate,
+    texture coordinates outside the 0..1 range or per-vertex point sizes,
+    a context can use a compact 16-byte vertex layout instead, which
+    reduces the vertex buffer upload size by 43% (a compact vertex is
+    57% of the size of a standard vertex):
+
+        sgl_context ctx = sgl_make_context(&(sgl_context_desc_t){
+            .vertex_layout = SGL_VERTEXLAYOUT_COMPACT_2D,
+        });
+
+    (or sgl_desc_t.vertex_layout for the default context)
+
+    The compact layout stores 2D float positions, texture coordinates as
+    normalized 16-bit unsigned integers and the packed RGBA8 color.
+    Vertices are still recorded in the standard layout and converted to
+    the compact layout before the vertex buffer is updated, so that all
+    sokol-gl functions work the same in both layouts, except:
+
+    - the z coordinate is dropped (it is always 0.0)
+    - texture coordinates are clamped to the range 0..1 (use the texture
+      matrix for repeating textures)
+    - the point size is always 1.0 (sgl_point_size() is ignored)
+
+    Positions are kept as 32-bit floats because 2D rendering typically
+    happens in pixel coordinates, where half-float positions would lose
+    sub-pixel precision above 1024 and whole-pixel precision above 2048.
+
+    Dropping below half the standard vertex size would require compressed
+    positions, so 16 bytes is the smallest layout which keeps full 2D
+    position precision.
+
+    Contexts with the compact layout use a separate built-in shader
+    without a point size vertex input, so there's no additional vertex
+    buffer binding for the compact layout. Custom shaders passed to
+    sgl_make_pipeline() for a compact context must only declare the
+    position, texcoord and color vertex inputs (vertex attributes 0..2).
+
+    DISPLAY LISTS
+    =============
+    Geometry which is identical each frame (like grids, gizmos or static UI
+    frames) can be recorded once into a retained display list, which
+    captures the vertices into an immutable sokol-gfx vertex buffer:
+
+        sgl_begin_display_list();
+        sgl_begin_lines();
+        ...
+        sgl_end();
+        sgl_display_list list = sgl_end_display_list();
+
+    ...and then rendered each frame with the current matrices with:
+
+        sgl_call_display_list(list);
+
+    ...this records a single command into the current context and layer,
+    no vertices are recorded or uploaded per frame.
+
+    When done, destroy the display list with:
+
+        sgl_destroy_display_list(list);
+
+    Display lists are also destroyed when their context is destroyed,
+    and in sgl_shutdown().
+
+    Some things to keep in mind:
+
+    - a display list captures all vertices, draw commands, viewport and
+      scissor rects recorded between sgl_begin_display_list() and
+      sgl_end_display_list(), these won't be rendered in the current frame
+    - the pipeline and texture state is captured, but the matrices are not:
+      all vertices in a display list are rendered with the matrices that
+      are active when sgl_call_display_list() is called (with the
+      cpu_transform option, vertices in a display list aren't transformed
+      on the CPU)
+    - a display list can only be called in the context it has been recorded
+      in (since pipeline objects depend on the context's pixel formats)
+    - display lists can't be nested, and calling a display list inside
+      sgl_begin_display_list() / sgl_end_display_list() isn't allowed
+    - if any error occurs while recording (e.g. the context's vertex or
+      command storage runs full), sgl_end_display_list() returns an invalid
+      display list handle
+    - display lists reference the sgl_pipeline objects and textures
+      which were active during recording, make sure they outlive the
+      display list
+    - the number of display lists is limited by sgl_desc_t.display_list_pool_size
+      (default: 64)
+
     MEMORY ALLOCATION OVERRIDE
     ==========================
     You can override the memory allocation functions at initialization time
@@ -736,6 +1034,9 @@ extern "C" {
     _SGL_LOGITEM_XMACRO(ADD_COMMIT_LISTENER_FAILED, "sg_add_commit_listener() failed") \
     _SGL_LOGITEM_XMACRO(CONTEXT_POOL_EXHAUSTED, "context pool exhausted (use sgl_desc_t.context_pool_size to adjust)") \
     _SGL_LOGITEM_XMACRO(CANNOT_DESTROY_DEFAULT_CONTEXT, "cannot destroy default context") \
+    _SGL_LOGITEM_XMACRO(DISPLAY_LIST_POOL_EXHAUSTED, "display list pool exhausted (use sgl_desc_t.display_list_pool_size to adjust)") \
+    _SGL_LOGITEM_XMACRO(DISPLAY_LIST_WRONG_CONTEXT, "display list was recorded in a different context") \
+    _SGL_LOGITEM_XMACRO(LINE_VARYING_Z, "z varies along a wide or smooth line, lines are tessellated in the xy plane and segments without xy extent are dropped (see WIDE AND SMOOTH LINES)") \
 
 #define _SGL_LOGITEM_XMACRO(item,msg) SGL_LOGITEM_##item,
 typedef enum sgl_log_item_t {
@@ -767,6 +1068,9 @@ typedef struct sgl_pipeline { uint32_t id; } sgl_pipeline;
 /* a context handle (created with sgl_make_context()) */
 typedef struct sgl_context { uint32_t id; } sgl_context;
 
+/* a display list handle (created with sgl_begin_display_list() / sgl_end_display_list()) */
+typedef struct sgl_display_list { uint32_t id; } sgl_display_list;
+
 /*
     sgl_error_t
 
@@ -783,6 +1087,26 @@ typedef struct sgl_error_t {
     bool no_context;
 } sgl_error_t;
 
+/*
+    sgl_vertex_layout_t
+
+    The vertex layout used by a context's vertex buffer:
+
+    SGL_VERTEXLAYOUT_STANDARD (28 bytes per vertex):
+        float3 position, float2 texcoord, ubyte4n color, float point size
+    SGL_VERTEXLAYOUT_COMPACT_2D (16 bytes per vertex):
+        float2 position, ushort2n texcoord, ubyte4n color
+
+    See the section VERTEX LAYOUTS for details.
+*/
+typedef enum sgl_vertex_layout_t {
+    _SGL_VERTEXLAYOUT_DEFAULT,      // value 0 reserved for default-init
+    SGL_VERTEXLAYOUT_STANDARD,
+    SGL_VERTEXLAYOUT_COMPACT_2D,
+    _SGL_VERTEXLAYOUT_NUM,
+    _SGL_VERTEXLAYOUT_FORCE_U32 = 0x7FFFFFFF
+} sgl_vertex_layout_t;
+
 /*
     sgl_context_desc_t
 
@@ -796,8 +1120,56 @@ typedef struct sgl_context_desc_t {
     sg_pixel_format color_format;
     sg_pixel_format depth_format;
     int sample_count;
+    bool cpu_transform;     // transform vertices by the modelview matrix on the CPU (default: false)
+    int merge_window;       // number of previous commands considered for merging (default: 0, only the previous command)
+    bool auto_grow;         // grow vertex, uniform and command storage instead of dropping geometry (default: false)
+    sgl_vertex_layout_t vertex_layout;  // default: SGL_VERTEXLAYOUT_STANDARD
 } sgl_context_desc_t;
 
+/*
+    sgl_stats_t
+
+    Storage capacities and high-water marks of a context, returned
+    by sgl_query_stats() and sgl_context_query_stats().
+*/
+typedef struct sgl_stats_t {
+    int max_vertices;       // current vertex storage capacity
+    int max_uniforms;       // current uniform storage capacity
+    int max_commands;       // current command storage capacity
+    int peak_vertices;      // max number of vertices recorded in a frame since context creation
+    int peak_uniforms;      // max number of uniform updates recorded in a frame since context creation
+    int peak_commands;      // max number of commands recorded in a frame since context creation
+    int num_grows;          // number of times the storage has been grown (only with auto_grow)
+} sgl_stats_t;
+
+/*
+    sgl_vertex_stream_t
+
+    A strided array of vertex components for bulk vertex submission
+    via sgl_vertices(). The data must be aligned to 4 bytes.
+*/
+typedef struct sgl_vertex_stream_t {
+    const void* ptr;        // pointer to the first element, or null if not provided
+    int stride;             // byte distance between elements (default: tightly packed)
+} sgl_vertex_stream_t;
+
+/*
+    sgl_vertex_desc_t
+
+    Describes the vertex component arrays for sgl_vertices(). Missing
+    texture coordinates and colors are taken from the current texture
+    coordinate and color 'registers'. Separate, tightly packed arrays
+    are the fastest input, these are written in a single pass over the
+    vertices (with SSE2 where available), while strided arrays are
+    copied component by component.
+*/
+typedef struct sgl_vertex_desc_t {
+    sgl_vertex_stream_t pos;    // float positions (required)
+    int pos_components;         // 2 or 3 (default: 3)
+    sgl_vertex_stream_t uv;     // float[2] texture coordinates (optional)
+    sgl_vertex_stream_t color;  // uint32_t packed RGBA colors (optional)
+} sgl_vertex_desc_t;
+
 /*
     sgl_allocator_t
 
@@ -817,10 +1189,15 @@ typedef struct sgl_desc_t {
     int max_commands;               // default: 16k
     int context_pool_size;          // max number of contexts (including default context), default: 4
     int pipeline_pool_size;         // size of internal pipeline pool, default: 64
+    int display_list_pool_size;     // max number of display lists, default: 64
     sg_pixel_format color_format;
     sg_pixel_format depth_format;
     int sample_count;
     sg_face_winding face_winding;   // default: SG_FACEWINDING_CCW
+    bool cpu_transform;             // default context: transform vertices by the modelview matrix on the CPU (default: false)
+    int merge_window;               // default context: number of previous commands considered for merging (default: 0)
+    bool auto_grow;                 // default context: grow storage instead of dropping geometry (default: false)
+    sgl_vertex_layout_t vertex_layout;  // default context: vertex layout (default: SGL_VERTEXLAYOUT_STANDARD)
     sgl_allocator_t allocator;      // optional memory allocation overrides (default: malloc/free)
     sgl_logger_t logger;            // optional log function override (default: NO LOGGING)
 } sgl_desc_t;
@@ -846,12 +1223,16 @@ SOKOL_GL_API_DECL sgl_context sgl_default_context(void);
 /* get information about recorded vertices and commands in current context */
 SOKOL_GL_API_DECL int sgl_num_vertices(void);
 SOKOL_GL_API_DECL int sgl_num_commands(void);
+SOKOL_GL_API_DECL sgl_stats_t sgl_query_stats(void);
+SOKOL_GL_API_DECL sgl_stats_t sgl_context_query_stats(sgl_context ctx);
 
 /* draw recorded commands (call inside a sokol-gfx render pass) */
 SOKOL_GL_API_DECL void sgl_draw(void);
 SOKOL_GL_API_DECL void sgl_context_draw(sgl_context ctx);
 SOKOL_GL_API_DECL void sgl_draw_layer(int layer_id);
 SOKOL_GL_API_DECL void sgl_context_draw_layer(sgl_context ctx, int layer_id);
+SOKOL_GL_API_DECL void sgl_draw_layer_sorted(int layer_id);
+SOKOL_GL_API_DECL void sgl_context_draw_layer_sorted(sgl_context ctx, int layer_id);
 
 /* create and destroy pipeline objects */
 SOKOL_GL_API_DECL sgl_pipeline sgl_make_pipeline(const sg_pipeline_desc* desc);
@@ -868,6 +1249,9 @@ SOKOL_GL_API_DECL void sgl_enable_texture(void);
 SOKOL_GL_API_DECL void sgl_disable_texture(void);
 SOKOL_GL_API_DECL void sgl_texture(sg_view tex_view, sg_sampler smp);
 SOKOL_GL_API_DECL void sgl_layer(int layer_id);
+SOKOL_GL_API_DECL void sgl_line_width(float w);
+SOKOL_GL_API_DECL void sgl_enable_line_smooth(void);
+SOKOL_GL_API_DECL void sgl_disable_line_smooth(void);
 
 /* pipeline stack functions */
 SOKOL_GL_API_DECL void sgl_load_default_pipeline(void);
@@ -934,8 +1318,90 @@ SOKOL_GL_API_DECL void sgl_v3f_t2f_c3b(float x, float y, float z, float u, float
 SOKOL_GL_API_DECL void sgl_v3f_t2f_c4f(float x, float y, float z, float u, float v, float r, float g, float b, float a);
 SOKOL_GL_API_DECL void sgl_v3f_t2f_c4b(float x, float y, float z, float u, float v, uint8_t r, uint8_t g, uint8_t b, uint8_t a);
 SOKOL_GL_API_DECL void sgl_v3f_t2f_c1i(float x, float y, float z, float u, float v, uint32_t rgba);
+SOKOL_GL_API_DECL void sgl_vertices(const sgl_vertex_desc_t* desc, int num_vertices);
 SOKOL_GL_API_DECL void sgl_end(void);
 
+/* record, render and destroy retained display lists */
+SOKOL_GL_API_DECL void sgl_begin_display_list(void);
+SOKOL_GL_API_DECL sgl_display_list sgl_end_display_list(void);
+SOKOL_GL_API_DECL void sgl_call_display_list(sgl_display_list list);
+SOKOL_GL_API_DECL void sgl_destroy_display_list(sgl_display_list list);
+
+/* recording functions with an explicit context (see RECORDING ON WORKER THREADS) */
+SOKOL_GL_API_DECL void sgl_context_defaults(sgl_context ctx);
+SOKOL_GL_API_DECL void sgl_context_viewport(sgl_context ctx, int x, int y, int w, int h, bool origin_top_left);
+SOKOL_GL_API_DECL void sgl_context_viewportf(sgl_context ctx, float x, float y, float w, float h, bool origin_top_left);
+SOKOL_GL_API_DECL void sgl_context_scissor_rect(sgl_context ctx, int x, int y, int w, int h, bool origin_top_left);
+SOKOL_GL_API_DECL void sgl_context_scissor_rectf(sgl_context ctx, float x, float y, float w, float h, bool origin_top_left);
+SOKOL_GL_API_DECL void sgl_context_enable_texture(sgl_context ctx);
+SOKOL_GL_API_DECL void sgl_context_disable_texture(sgl_context ctx);
+SOKOL_GL_API_DECL void sgl_context_texture(sgl_context ctx, sg_view tex_view, sg_sampler smp);
+SOKOL_GL_API_DECL void sgl_context_layer(sgl_context ctx, int layer_id);
+SOKOL_GL_API_DECL void sgl_context_line_width(sgl_context ctx, float w);
+SOKOL_GL_API_DECL void sgl_context_enable_line_smooth(sgl_context ctx);
+SOKOL_GL_API_DECL void sgl_context_disable_line_smooth(sgl_context ctx);
+SOKOL_GL_API_DECL void sgl_context_load_default_pipeline(sgl_context ctx);
+SOKOL_GL_API_DECL void sgl_context_load_pipeline(sgl_context ctx, sgl_pipeline pip);
+SOKOL_GL_API_DECL void sgl_context_push_pipeline(sgl_context ctx);
+SOKOL_GL_API_DECL void sgl_context_pop_pipeline(sgl_context ctx);
+SOKOL_GL_API_DECL void sgl_context_matrix_mode_modelview(sgl_context ctx);
+SOKOL_GL_API_DECL void sgl_context_matrix_mode_projection(sgl_context ctx);
+SOKOL_GL_API_DECL void sgl_context_matrix_mode_texture(sgl_context ctx);
+SOKOL_GL_API_DECL void sgl_context_load_identity(sgl_context ctx);
+SOKOL_GL_API_DECL void sgl_context_load_matrix(sgl_context ctx, const float m[16]);
+SOKOL_GL_API_DECL void sgl_context_load_transpose_matrix(sgl_context ctx, const float m[16]);
+SOKOL_GL_API_DECL void sgl_context_mult_matrix(sgl_context ctx, const float m[16]);
+SOKOL_GL_API_DECL void sgl_context_mult_transpose_matrix(sgl_context ctx, const float m[16]);
+SOKOL_GL_API_DECL void sgl_context_rotate(sgl_context ctx, float angle_rad, float x, float y, float z);
+SOKOL_GL_API_DECL void sgl_context_scale(sgl_context ctx, float x, float y, float z);
+SOKOL_GL_API_DECL void sgl_context_translate(sgl_context ctx, float x, float y, float z);
+SOKOL_GL_API_DECL void sgl_context_frustum(sgl_context ctx, float l, float r, float b, float t, float n, float f);
+SOKOL_GL_API_DECL void sgl_context_ortho(sgl_context ctx, float l, float r, float b, float t, float n, float f);
+SOKOL_GL_API_DECL void sgl_context_perspective(sgl_context ctx, float fov_y, float aspect, float z_near, float z_far);
+SOKOL_GL_API_DECL void sgl_context_lookat(sgl_context ctx, float eye_x, float eye_y, float eye_z, float center_x, float center_y, float center_z, float up_x, float up_y, float up_z);
+SOKOL_GL_API_DECL void sgl_context_push_matrix(sgl_context ctx);
+SOKOL_GL_API_DECL void sgl_context_pop_matrix(sgl_context ctx);
+SOKOL_GL_API_DECL void sgl_context_t2f(sgl_context ctx, float u, float v);
+SOKOL_GL_API_DECL void sgl_context_c3f(sgl_context ctx, float r, float g, float b);
+SOKOL_GL_API_DECL void sgl_context_c4f(sgl_context ctx, float r, float g, float b, float a);
+SOKOL_GL_API_DECL void sgl_context_c3b(sgl_context ctx, uint8_t r, uint8_t g, uint8_t b);
+SOKOL_GL_API_DECL void sgl_context_c4b(sgl_context ctx, uint8_t r, uint8_t g, uint8_t b, uint8_t a);
+SOKOL_GL_API_DECL void sgl_context_c1i(sgl_context ctx, uint32_t rgba);
+SOKOL_GL_API_DECL void sgl_context_point_size(sgl_context ctx, float s);
+SOKOL_GL_API_DECL void sgl_context_begin_points(sgl_context ctx);
+SOKOL_GL_API_DECL void sgl_context_begin_lines(sgl_context ctx);
+SOKOL_GL_API_DECL void sgl_context_begin_line_strip(sgl_context ctx);
+SOKOL_GL_API_DECL void sgl_context_begin_triangles(sgl_context ctx);
+SOKOL_GL_API_DECL void sgl_context_begin_triangle_strip(sgl_context ctx);
+SOKOL_GL_API_DECL void sgl_context_begin_quads(sgl_context ctx);
+SOKOL_GL_API_DECL void sgl_context_v2f(sgl_context ctx, float x, float y);
+SOKOL_GL_API_DECL void sgl_context_v3f(sgl_context ctx, float x, float y, float z);
+SOKOL_GL_API_DECL void sgl_context_v2f_t2f(sgl_context ctx, float x, float y, float u, float v);
+SOKOL_GL_API_DECL void sgl_context_v3f_t2f(sgl_context ctx, float x, float y, float z, float u, float v);
+SOKOL_GL_API_DECL void sgl_context_v2f_c3f(sgl_context ctx, float x, float y, float r, float g, float b);
+SOKOL_GL_API_DECL void sgl_context_v2f_c3b(sgl_context ctx, float x, float y, uint8_t r, uint8_t g, uint8_t b);
+SOKOL_GL_API_DECL void sgl_context_v2f_c4f(sgl_context ctx, float x, float y, float r, float g, float b, float a);
+SOKOL_GL_API_DECL void sgl_context_v2f_c4b(sgl_context ctx, float x, float y, uint8_t r, uint8_t g, uint8_t b, uint8_t a);
+SOKOL_GL_API_DECL void sgl_context_v2f_c1i(sgl_context ctx, float x, float y, uint32_t rgba);
+SOKOL_GL_API_DECL void sgl_context_v3f_c3f(sgl_context ctx, float x, float y, float z, float r, float g, float b);
+SOKOL_GL_API_DECL void sgl_context_v3f_c3b(sgl_context ctx, float x, float y, float z, uint8_t r, uint8_t g, uint8_t b);
+SOKOL_GL_API_DECL void sgl_context_v3f_c4f(sgl_context ctx, float x, float y, float z, float r, float g, float b, float a);
+SOKOL_GL_API_DECL void sgl_context_v3f_c4b(sgl_context ctx, float x, float y, float z, uint8_t r, uint8_t g, uint8_t b, uint8_t a);
+SOKOL_GL_API_DECL void sgl_context_v3f_c1i(sgl_context ctx, float x, float y, float z, uint32_t rgba);
+SOKOL_GL_API_DECL void sgl_context_v2f_t2f_c3f(sgl_context ctx, float x, float y, float u, float v, float r, float g, float b);
+SOKOL_GL_API_DECL void sgl_context_v2f_t2f_c3b(sgl_context ctx, float x, float y, float u, float v, uint8_t r, uint8_t g, uint8_t b);
+SOKOL_GL_API_DECL void sgl_context_v2f_t2f_c4f(sgl_context ctx, float x, float y, float u, float v, float r, float g, float b, float a);
+SOKOL_GL_API_DECL void sgl_context_v2f_t2f_c4b(sgl_context ctx, float x, float y, float u, float v, uint8_t r, uint8_t g, uint8_t b, uint8_t a);
+SOKOL_GL_API_DECL void sgl_context_v2f_t2f_c1i(sgl_context ctx, float x, float y, float u, float v, uint32_t rgba);
+SOKOL_GL_API_DECL void sgl_context_v3f_t2f_c3f(sgl_context ctx, float x, float y, float z, float u, float v, float r, float g, float b);
+SOKOL_GL_API_DECL void sgl_context_v3f_t2f_c3b(sgl_context ctx, float x, float y, float z, float u, float v, uint8_t r, uint8_t g, uint8_t b);
+SOKOL_GL_API_DECL void sgl_context_v3f_t2f_c4f(sgl_context ctx, float x, float y, float z, float u, float v, float r, float g, float b, float a);
+SOKOL_GL_API_DECL void sgl_context_v3f_t2f_c4b(sgl_context ctx, float x, float y, float z, float u, float v, uint8_t r, uint8_t g, uint8_t b, uint8_t a);
+SOKOL_GL_API_DECL void sgl_context_v3f_t2f_c1i(sgl_context ctx, float x, float y, float z, float u, float v, uint32_t rgba);
+SOKOL_GL_API_DECL void sgl_context_vertices(sgl_context ctx, const sgl_vertex_desc_t* desc, int num_vertices);
+SOKOL_GL_API_DECL void sgl_context_end(sgl_context ctx);
+SOKOL_GL_API_DECL void sgl_context_call_display_list(sgl_context ctx, sgl_display_list list);
+
 #ifdef __cplusplus
 } /* extern "C" */
 
@@ -944,6 +1410,8 @@ inline void sgl_setup(const sgl_desc_t& desc) { return sgl_setup(&desc); }
 inline sgl_context sgl_make_context(const sgl_context_desc_t& desc) { return sgl_make_context(&desc); }
 inline sgl_pipeline sgl_make_pipeline(const sg_pipeline_desc& desc) { return sgl_make_pipeline(&desc); }
 inline sgl_pipeline sgl_context_make_pipeline(sgl_context ctx, const sg_pipeline_desc& desc) { return sgl_context_make_pipeline(ctx, &desc); }
+inline void sgl_vertices(const sgl_vertex_desc_t& desc, int num_vertices) { return sgl_vertices(&desc, num_vertices); }
+inline void sgl_context_vertices(sgl_context ctx, const sgl_vertex_desc_t& desc, int num_vertices) { return sgl_context_vertices(ctx, &desc, num_vertices); }
 #endif
 #endif /* SOKOL_GL_INCLUDED */
 
@@ -965,6 +1433,16 @@ inline sgl_pipeline sgl_context_make_pipeline(sgl_context ctx, const sg_pipeline
 #include <string.h> // memset
 #include <math.h>   // M_PI, sqrtf, sinf, cosf
 
+#if !defined(SOKOL_GL_NO_SIMD)
+    #if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2))
+        #define _SGL_USE_SSE2 (1)
+        #include <emmintrin.h>
+    #elif defined(__ARM_NEON) || defined(__ARM_NEON__) || defined(_M_ARM64)
+        #define _SGL_USE_NEON (1)
+        #include <arm_neon.h>
+    #endif
+#endif
+
 #ifndef M_PI
 #define M_PI 3.14159265358979323846264338327
 #endif
@@ -2396,194 +2874,1349 @@ static const char* _sgl_shd_fs_source_dummy = "";
 #else
 #error "Please define one of SOKOL_GLCORE, SOKOL_GLES3, SOKOL_D3D11, SOKOL_METAL, SOKOL_WGPU, SOKOL_VULKAN or SOKOL_DUMMY_BACKEND!"
 #endif
-//<#shdgen
-
-// ████████ ██    ██ ██████  ███████ ███████
-//    ██     ██  ██  ██   ██ ██      ██
-//    ██      ████   ██████  █████   ███████
-//    ██       ██    ██      ██           ██
-//    ██       ██    ██      ███████ ███████
-//
-// >>types
-typedef enum {
-    SGL_PRIMITIVETYPE_POINTS = 0,
-    SGL_PRIMITIVETYPE_LINES,
-    SGL_PRIMITIVETYPE_LINE_STRIP,
-    SGL_PRIMITIVETYPE_TRIANGLES,
-    SGL_PRIMITIVETYPE_TRIANGLE_STRIP,
-    SGL_PRIMITIVETYPE_QUADS,
-    SGL_NUM_PRIMITIVE_TYPES,
-} _sgl_primitive_type_t;
-
-typedef struct {
-    uint32_t id;
-    sg_resource_state state;
-} _sgl_slot_t;
-
-typedef struct {
-    int size;
-    int queue_top;
-    uint32_t* gen_ctrs;
-    int* free_queue;
-} _sgl_pool_t;
-
-typedef struct {
-    _sgl_slot_t slot;
-    sg_pipeline pip[SGL_NUM_PRIMITIVE_TYPES];
-} _sgl_pipeline_t;
-
-typedef struct {
-    _sgl_pool_t pool;
-    _sgl_pipeline_t* pips;
-} _sgl_pipeline_pool_t;
-
-typedef enum {
-    SGL_MATRIXMODE_MODELVIEW,
-    SGL_MATRIXMODE_PROJECTION,
-    SGL_MATRIXMODE_TEXTURE,
-    SGL_NUM_MATRIXMODES
-} _sgl_matrix_mode_t;
-
-typedef struct {
-    float pos[3];
-    float uv[2];
-    uint32_t rgba;
-    float psize;
-} _sgl_vertex_t;
-
-typedef struct {
-    float v[4][4];
-} _sgl_matrix_t;
-
-typedef struct {
-    _sgl_matrix_t mvp;  /* model-view-projection matrix */
-    _sgl_matrix_t tm;   /* texture matrix */
-} _sgl_uniform_t;
-
-typedef enum {
-    SGL_COMMAND_DRAW,
-    SGL_COMMAND_VIEWPORT,
-    SGL_COMMAND_SCISSOR_RECT,
-} _sgl_command_type_t;
-
-typedef struct {
-    sg_pipeline pip;
-    sg_view view;
-    sg_sampler smp;
-    int base_vertex;
-    int num_vertices;
-    int uniform_index;
-} _sgl_draw_args_t;
-
-typedef struct {
-    int x, y, w, h;
-    bool origin_top_left;
-} _sgl_viewport_args_t;
-
-typedef struct {
-    int x, y, w, h;
-    bool origin_top_left;
-} _sgl_scissor_rect_args_t;
-
-typedef union {
-    _sgl_draw_args_t draw;
-    _sgl_viewport_args_t viewport;
-    _sgl_scissor_rect_args_t scissor_rect;
-} _sgl_args_t;
-
-typedef struct {
-    _sgl_command_type_t cmd;
-    int layer_id;
-    _sgl_args_t args;
-} _sgl_command_t;
-
-#define _SGL_INVALID_SLOT_INDEX (0)
-#define _SGL_MAX_STACK_DEPTH (64)
-#define _SGL_DEFAULT_CONTEXT_POOL_SIZE (4)
-#define _SGL_DEFAULT_PIPELINE_POOL_SIZE (64)
-#define _SGL_DEFAULT_MAX_VERTICES (1<<16)
-#define _SGL_DEFAULT_MAX_COMMANDS (1<<14)
-#define _SGL_SLOT_SHIFT (16)
-#define _SGL_MAX_POOL_SIZE (1<<_SGL_SLOT_SHIFT)
-#define _SGL_SLOT_MASK (_SGL_MAX_POOL_SIZE-1)
-
-typedef struct {
-    _sgl_slot_t slot;
-    sgl_context_desc_t desc;
-    uint32_t frame_id;
-    uint32_t update_frame_id;
-    struct {
-        int cap;
-        int next;
-        _sgl_vertex_t* ptr;
-    } vertices;
-    struct {
-        int cap;
-        int next;
-        _sgl_uniform_t* ptr;
-    } uniforms;
-    struct {
-        int cap;
-        int next;
-        _sgl_command_t* ptr;
-    } commands;
-
-    /* state tracking */
-    int base_vertex;
-    int quad_vtx_count; /* number of times vtx function has been called, used for non-triangle primitives */
-    sgl_error_t error;
-    bool in_begin;
-    int layer_id;
-    float u, v;
-    uint32_t rgba;
-    float point_size;
-    _sgl_primitive_type_t cur_prim_type;
-    sg_view cur_view;
-    sg_sampler cur_smp;
-    bool texturing_enabled;
-    bool matrix_dirty;      /* reset in sgl_end(), set in any of the matrix stack functions */
-
-    /* sokol-gfx resources */
-    sg_buffer vbuf;
-    sgl_pipeline def_pip;
-    sg_bindings bind;
-
-    /* pipeline stack */
-    int pip_tos;
-    sgl_pipeline pip_stack[_SGL_MAX_STACK_DEPTH];
-
-    /* matrix stacks */
-    _sgl_matrix_mode_t cur_matrix_mode;
-    int matrix_tos[SGL_NUM_MATRIXMODES];
-    _sgl_matrix_t matrix_stack[SGL_NUM_MATRIXMODES][_SGL_MAX_STACK_DEPTH];
-} _sgl_context_t;
-
-typedef struct {
-    _sgl_pool_t pool;
-    _sgl_context_t* contexts;
-} _sgl_context_pool_t;
-
-typedef struct {
-    uint32_t init_cookie;
-    sgl_desc_t desc;
-    sg_image def_img;   // a default white texture
-    sg_view def_view;   // ...and the texture view for the default image
-    sg_sampler def_smp; // a default sampler
-    sg_shader shd;      // same shader for all contexts
-    sgl_context def_ctx_id;
-    sgl_context cur_ctx_id;
-    _sgl_context_t* cur_ctx;   // may be 0!
-    _sgl_pipeline_pool_t pip_pool;
-    _sgl_context_pool_t context_pool;
-} _sgl_t;
-static _sgl_t _sgl;
-
-// ██       ██████   ██████   ██████  ██ ███    ██  ██████
-// ██      ██    ██ ██       ██       ██ ████   ██ ██
-// ██      ██    ██ ██   ███ ██   ███ ██ ██ ██  ██ ██   ███
-// ██      ██    ██ ██    ██ ██    ██ ██ ██  ██ ██ ██    ██
-// ███████  ██████   ██████   ██████  ██ ██   ████  ██████
-//
+#if defined(SOKOL_GLCORE)
+static const uint8_t _sgl_shd_compact_vs_source_glsl410[481] = {
+    0x23,0x76,0x65,0x72,0x73,0x69,0x6f,0x6e,0x20,0x34,0x31,0x30,0x0a,0x0a,0x75,0x6e,
+    0x69,0x66,0x6f,0x72,0x6d,0x20,0x76,0x65,0x63,0x34,0x20,0x76,0x73,0x5f,0x70,0x61,
+    0x72,0x61,0x6d,0x73,0x5b,0x38,0x5d,0x3b,0x0a,0x6c,0x61,0x79,0x6f,0x75,0x74,0x28,
+    0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x30,0x29,0x20,0x69,0x6e,
+    0x20,0x76,0x65,0x63,0x34,0x20,0x70,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x3b,0x0a,
+    0x6c,0x61,0x79,0x6f,0x75,0x74,0x28,0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x20,
+    0x3d,0x20,0x30,0x29,0x20,0x6f,0x75,0x74,0x20,0x76,0x65,0x63,0x34,0x20,0x75,0x76,
+    0x3b,0x0a,0x6c,0x61,0x79,0x6f,0x75,0x74,0x28,0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,
+    0x6e,0x20,0x3d,0x20,0x31,0x29,0x20,0x69,0x6e,0x20,0x76,0x65,0x63,0x32,0x20,0x74,
+    0x65,0x78,0x63,0x6f,0x6f,0x72,0x64,0x30,0x3b,0x0a,0x6c,0x61,0x79,0x6f,0x75,0x74,
+    0x28,0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x31,0x29,0x20,0x6f,
+    0x75,0x74,0x20,0x76,0x65,0x63,0x34,0x20,0x63,0x6f,0x6c,0x6f,0x72,0x3b,0x0a,0x6c,
+    0x61,0x79,0x6f,0x75,0x74,0x28,0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x20,0x3d,
+    0x20,0x32,0x29,0x20,0x69,0x6e,0x20,0x76,0x65,0x63,0x34,0x20,0x63,0x6f,0x6c,0x6f,
+    0x72,0x30,0x3b,0x0a,0x0a,0x76,0x6f,0x69,0x64,0x20,0x6d,0x61,0x69,0x6e,0x28,0x29,
+    0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x67,0x6c,0x5f,0x50,0x6f,0x73,0x69,0x74,0x69,
+    0x6f,0x6e,0x20,0x3d,0x20,0x6d,0x61,0x74,0x34,0x28,0x76,0x73,0x5f,0x70,0x61,0x72,
+    0x61,0x6d,0x73,0x5b,0x30,0x5d,0x2c,0x20,0x76,0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,
+    0x73,0x5b,0x31,0x5d,0x2c,0x20,0x76,0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,
+    0x32,0x5d,0x2c,0x20,0x76,0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x33,0x5d,
+    0x29,0x20,0x2a,0x20,0x70,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x3b,0x0a,0x20,0x20,
+    0x20,0x20,0x67,0x6c,0x5f,0x50,0x6f,0x69,0x6e,0x74,0x53,0x69,0x7a,0x65,0x20,0x3d,
+    0x20,0x31,0x2e,0x30,0x3b,0x0a,0x20,0x20,0x20,0x20,0x75,0x76,0x20,0x3d,0x20,0x6d,
+    0x61,0x74,0x34,0x28,0x76,0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x34,0x5d,
+    0x2c,0x20,0x76,0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x35,0x5d,0x2c,0x20,
+    0x76,0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x36,0x5d,0x2c,0x20,0x76,0x73,
+    0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x37,0x5d,0x29,0x20,0x2a,0x20,0x76,0x65,
+    0x63,0x34,0x28,0x74,0x65,0x78,0x63,0x6f,0x6f,0x72,0x64,0x30,0x2c,0x20,0x30,0x2e,
+    0x30,0x2c,0x20,0x31,0x2e,0x30,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x63,0x6f,0x6c,
+    0x6f,0x72,0x20,0x3d,0x20,0x63,0x6f,0x6c,0x6f,0x72,0x30,0x3b,0x0a,0x7d,0x0a,0x0a,
+    0x00,
+};
+static const uint8_t _sgl_shd_compact_fs_source_glsl410[222] = {
+    0x23,0x76,0x65,0x72,0x73,0x69,0x6f,0x6e,0x20,0x34,0x31,0x30,0x0a,0x0a,0x75,0x6e,
+    0x69,0x66,0x6f,0x72,0x6d,0x20,0x73,0x61,0x6d,0x70,0x6c,0x65,0x72,0x32,0x44,0x20,
+    0x74,0x65,0x78,0x5f,0x73,0x6d,0x70,0x3b,0x0a,0x0a,0x6c,0x61,0x79,0x6f,0x75,0x74,
+    0x28,0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x30,0x29,0x20,0x6f,
+    0x75,0x74,0x20,0x76,0x65,0x63,0x34,0x20,0x66,0x72,0x61,0x67,0x5f,0x63,0x6f,0x6c,
+    0x6f,0x72,0x3b,0x0a,0x6c,0x61,0x79,0x6f,0x75,0x74,0x28,0x6c,0x6f,0x63,0x61,0x74,
+    0x69,0x6f,0x6e,0x20,0x3d,0x20,0x30,0x29,0x20,0x69,0x6e,0x20,0x76,0x65,0x63,0x34,
+    0x20,0x75,0x76,0x3b,0x0a,0x6c,0x61,0x79,0x6f,0x75,0x74,0x28,0x6c,0x6f,0x63,0x61,
+    0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x31,0x29,0x20,0x69,0x6e,0x20,0x76,0x65,0x63,
+    0x34,0x20,0x63,0x6f,0x6c,0x6f,0x72,0x3b,0x0a,0x0a,0x76,0x6f,0x69,0x64,0x20,0x6d,
+    0x61,0x69,0x6e,0x28,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x66,0x72,0x61,0x67,
+    0x5f,0x63,0x6f,0x6c,0x6f,0x72,0x20,0x3d,0x20,0x74,0x65,0x78,0x74,0x75,0x72,0x65,
+    0x28,0x74,0x65,0x78,0x5f,0x73,0x6d,0x70,0x2c,0x20,0x75,0x76,0x2e,0x78,0x79,0x29,
+    0x20,0x2a,0x20,0x63,0x6f,0x6c,0x6f,0x72,0x3b,0x0a,0x7d,0x0a,0x0a,0x00,
+};
+#elif defined(SOKOL_GLES3)
+static const uint8_t _sgl_shd_compact_vs_source_glsl300es[442] = {
+    0x23,0x76,0x65,0x72,0x73,0x69,0x6f,0x6e,0x20,0x33,0x30,0x30,0x20,0x65,0x73,0x0a,
+    0x0a,0x75,0x6e,0x69,0x66,0x6f,0x72,0x6d,0x20,0x76,0x65,0x63,0x34,0x20,0x76,0x73,
+    0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x38,0x5d,0x3b,0x0a,0x6c,0x61,0x79,0x6f,
+    0x75,0x74,0x28,0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x30,0x29,
+    0x20,0x69,0x6e,0x20,0x76,0x65,0x63,0x34,0x20,0x70,0x6f,0x73,0x69,0x74,0x69,0x6f,
+    0x6e,0x3b,0x0a,0x6f,0x75,0x74,0x20,0x76,0x65,0x63,0x34,0x20,0x75,0x76,0x3b,0x0a,
+    0x6c,0x61,0x79,0x6f,0x75,0x74,0x28,0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x20,
+    0x3d,0x20,0x31,0x29,0x20,0x69,0x6e,0x20,0x76,0x65,0x63,0x32,0x20,0x74,0x65,0x78,
+    0x63,0x6f,0x6f,0x72,0x64,0x30,0x3b,0x0a,0x6f,0x75,0x74,0x20,0x76,0x65,0x63,0x34,
+    0x20,0x63,0x6f,0x6c,0x6f,0x72,0x3b,0x0a,0x6c,0x61,0x79,0x6f,0x75,0x74,0x28,0x6c,
+    0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x32,0x29,0x20,0x69,0x6e,0x20,
+    0x76,0x65,0x63,0x34,0x20,0x63,0x6f,0x6c,0x6f,0x72,0x30,0x3b,0x0a,0x0a,0x76,0x6f,
+    0x69,0x64,0x20,0x6d,0x61,0x69,0x6e,0x28,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,
+    0x67,0x6c,0x5f,0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x6d,0x61,
+    0x74,0x34,0x28,0x76,0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x30,0x5d,0x2c,
+    0x20,0x76,0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x31,0x5d,0x2c,0x20,0x76,
+    0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x32,0x5d,0x2c,0x20,0x76,0x73,0x5f,
+    0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x33,0x5d,0x29,0x20,0x2a,0x20,0x70,0x6f,0x73,
+    0x69,0x74,0x69,0x6f,0x6e,0x3b,0x0a,0x20,0x20,0x20,0x20,0x67,0x6c,0x5f,0x50,0x6f,
+    0x69,0x6e,0x74,0x53,0x69,0x7a,0x65,0x20,0x3d,0x20,0x31,0x2e,0x30,0x3b,0x0a,0x20,
+    0x20,0x20,0x20,0x75,0x76,0x20,0x3d,0x20,0x6d,0x61,0x74,0x34,0x28,0x76,0x73,0x5f,
+    0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x34,0x5d,0x2c,0x20,0x76,0x73,0x5f,0x70,0x61,
+    0x72,0x61,0x6d,0x73,0x5b,0x35,0x5d,0x2c,0x20,0x76,0x73,0x5f,0x70,0x61,0x72,0x61,
+    0x6d,0x73,0x5b,0x36,0x5d,0x2c,0x20,0x76,0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,
+    0x5b,0x37,0x5d,0x29,0x20,0x2a,0x20,0x76,0x65,0x63,0x34,0x28,0x74,0x65,0x78,0x63,
+    0x6f,0x6f,0x72,0x64,0x30,0x2c,0x20,0x30,0x2e,0x30,0x2c,0x20,0x31,0x2e,0x30,0x29,
+    0x3b,0x0a,0x20,0x20,0x20,0x20,0x63,0x6f,0x6c,0x6f,0x72,0x20,0x3d,0x20,0x63,0x6f,
+    0x6c,0x6f,0x72,0x30,0x3b,0x0a,0x7d,0x0a,0x0a,0x00,
+};
+static const uint8_t _sgl_shd_compact_fs_source_glsl300es[253] = {
+    0x23,0x76,0x65,0x72,0x73,0x69,0x6f,0x6e,0x20,0x33,0x30,0x30,0x20,0x65,0x73,0x0a,
+    0x70,0x72,0x65,0x63,0x69,0x73,0x69,0x6f,0x6e,0x20,0x6d,0x65,0x64,0x69,0x75,0x6d,
+    0x70,0x20,0x66,0x6c,0x6f,0x61,0x74,0x3b,0x0a,0x70,0x72,0x65,0x63,0x69,0x73,0x69,
+    0x6f,0x6e,0x20,0x68,0x69,0x67,0x68,0x70,0x20,0x69,0x6e,0x74,0x3b,0x0a,0x0a,0x75,
+    0x6e,0x69,0x66,0x6f,0x72,0x6d,0x20,0x68,0x69,0x67,0x68,0x70,0x20,0x73,0x61,0x6d,
+    0x70,0x6c,0x65,0x72,0x32,0x44,0x20,0x74,0x65,0x78,0x5f,0x73,0x6d,0x70,0x3b,0x0a,
+    0x0a,0x6c,0x61,0x79,0x6f,0x75,0x74,0x28,0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,
+    0x20,0x3d,0x20,0x30,0x29,0x20,0x6f,0x75,0x74,0x20,0x68,0x69,0x67,0x68,0x70,0x20,
+    0x76,0x65,0x63,0x34,0x20,0x66,0x72,0x61,0x67,0x5f,0x63,0x6f,0x6c,0x6f,0x72,0x3b,
+    0x0a,0x69,0x6e,0x20,0x68,0x69,0x67,0x68,0x70,0x20,0x76,0x65,0x63,0x34,0x20,0x75,
+    0x76,0x3b,0x0a,0x69,0x6e,0x20,0x68,0x69,0x67,0x68,0x70,0x20,0x76,0x65,0x63,0x34,
+    0x20,0x63,0x6f,0x6c,0x6f,0x72,0x3b,0x0a,0x0a,0x76,0x6f,0x69,0x64,0x20,0x6d,0x61,
+    0x69,0x6e,0x28,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x66,0x72,0x61,0x67,0x5f,
+    0x63,0x6f,0x6c,0x6f,0x72,0x20,0x3d,0x20,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x28,
+    0x74,0x65,0x78,0x5f,0x73,0x6d,0x70,0x2c,0x20,0x75,0x76,0x2e,0x78,0x79,0x29,0x20,
+    0x2a,0x20,0x63,0x6f,0x6c,0x6f,0x72,0x3b,0x0a,0x7d,0x0a,0x0a,0x00,
+};
+#elif defined(SOKOL_METAL)
+static const uint8_t _sgl_shd_compact_vs_source_metal_macos[717] = {
+    0x23,0x69,0x6e,0x63,0x6c,0x75,0x64,0x65,0x20,0x3c,0x6d,0x65,0x74,0x61,0x6c,0x5f,
+    0x73,0x74,0x64,0x6c,0x69,0x62,0x3e,0x0a,0x23,0x69,0x6e,0x63,0x6c,0x75,0x64,0x65,
+    0x20,0x3c,0x73,0x69,0x6d,0x64,0x2f,0x73,0x69,0x6d,0x64,0x2e,0x68,0x3e,0x0a,0x0a,
+    0x75,0x73,0x69,0x6e,0x67,0x20,0x6e,0x61,0x6d,0x65,0x73,0x70,0x61,0x63,0x65,0x20,
+    0x6d,0x65,0x74,0x61,0x6c,0x3b,0x0a,0x0a,0x73,0x74,0x72,0x75,0x63,0x74,0x20,0x76,
+    0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x66,
+    0x6c,0x6f,0x61,0x74,0x34,0x78,0x34,0x20,0x6d,0x76,0x70,0x3b,0x0a,0x20,0x20,0x20,
+    0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x78,0x34,0x20,0x74,0x6d,0x3b,0x0a,0x7d,0x3b,
+    0x0a,0x0a,0x73,0x74,0x72,0x75,0x63,0x74,0x20,0x6d,0x61,0x69,0x6e,0x30,0x5f,0x6f,
+    0x75,0x74,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,
+    0x75,0x76,0x20,0x5b,0x5b,0x75,0x73,0x65,0x72,0x28,0x6c,0x6f,0x63,0x6e,0x30,0x29,
+    0x5d,0x5d,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x63,
+    0x6f,0x6c,0x6f,0x72,0x20,0x5b,0x5b,0x75,0x73,0x65,0x72,0x28,0x6c,0x6f,0x63,0x6e,
+    0x31,0x29,0x5d,0x5d,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,
+    0x20,0x67,0x6c,0x5f,0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x20,0x5b,0x5b,0x70,
+    0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x5d,0x5d,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,
+    0x6c,0x6f,0x61,0x74,0x20,0x67,0x6c,0x5f,0x50,0x6f,0x69,0x6e,0x74,0x53,0x69,0x7a,
+    0x65,0x20,0x5b,0x5b,0x70,0x6f,0x69,0x6e,0x74,0x5f,0x73,0x69,0x7a,0x65,0x5d,0x5d,
+    0x3b,0x0a,0x7d,0x3b,0x0a,0x0a,0x73,0x74,0x72,0x75,0x63,0x74,0x20,0x6d,0x61,0x69,
+    0x6e,0x30,0x5f,0x69,0x6e,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,
+    0x74,0x34,0x20,0x70,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x20,0x5b,0x5b,0x61,0x74,
+    0x74,0x72,0x69,0x62,0x75,0x74,0x65,0x28,0x30,0x29,0x5d,0x5d,0x3b,0x0a,0x20,0x20,
+    0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x74,0x65,0x78,0x63,0x6f,0x6f,0x72,
+    0x64,0x30,0x20,0x5b,0x5b,0x61,0x74,0x74,0x72,0x69,0x62,0x75,0x74,0x65,0x28,0x31,
+    0x29,0x5d,0x5d,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,
+    0x63,0x6f,0x6c,0x6f,0x72,0x30,0x20,0x5b,0x5b,0x61,0x74,0x74,0x72,0x69,0x62,0x75,
+    0x74,0x65,0x28,0x32,0x29,0x5d,0x5d,0x3b,0x0a,0x7d,0x3b,0x0a,0x0a,0x76,0x65,0x72,
+    0x74,0x65,0x78,0x20,0x6d,0x61,0x69,0x6e,0x30,0x5f,0x6f,0x75,0x74,0x20,0x6d,0x61,
+    0x69,0x6e,0x30,0x28,0x6d,0x61,0x69,0x6e,0x30,0x5f,0x69,0x6e,0x20,0x69,0x6e,0x20,
+    0x5b,0x5b,0x73,0x74,0x61,0x67,0x65,0x5f,0x69,0x6e,0x5d,0x5d,0x2c,0x20,0x63,0x6f,
+    0x6e,0x73,0x74,0x61,0x6e,0x74,0x20,0x76,0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,
+    0x26,0x20,0x5f,0x31,0x39,0x20,0x5b,0x5b,0x62,0x75,0x66,0x66,0x65,0x72,0x28,0x30,
+    0x29,0x5d,0x5d,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x6d,0x61,0x69,0x6e,0x30,
+    0x5f,0x6f,0x75,0x74,0x20,0x6f,0x75,0x74,0x20,0x3d,0x20,0x7b,0x7d,0x3b,0x0a,0x20,
+    0x20,0x20,0x20,0x6f,0x75,0x74,0x2e,0x67,0x6c,0x5f,0x50,0x6f,0x73,0x69,0x74,0x69,
+    0x6f,0x6e,0x20,0x3d,0x20,0x5f,0x31,0x39,0x2e,0x6d,0x76,0x70,0x20,0x2a,0x20,0x69,
+    0x6e,0x2e,0x70,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x3b,0x0a,0x20,0x20,0x20,0x20,
+    0x6f,0x75,0x74,0x2e,0x67,0x6c,0x5f,0x50,0x6f,0x69,0x6e,0x74,0x53,0x69,0x7a,0x65,
+    0x20,0x3d,0x20,0x31,0x2e,0x30,0x3b,0x0a,0x20,0x20,0x20,0x20,0x6f,0x75,0x74,0x2e,
+    0x75,0x76,0x20,0x3d,0x20,0x5f,0x31,0x39,0x2e,0x74,0x6d,0x20,0x2a,0x20,0x66,0x6c,
+    0x6f,0x61,0x74,0x34,0x28,0x69,0x6e,0x2e,0x74,0x65,0x78,0x63,0x6f,0x6f,0x72,0x64,
+    0x30,0x2c,0x20,0x30,0x2e,0x30,0x2c,0x20,0x31,0x2e,0x30,0x29,0x3b,0x0a,0x20,0x20,
+    0x20,0x20,0x6f,0x75,0x74,0x2e,0x63,0x6f,0x6c,0x6f,0x72,0x20,0x3d,0x20,0x69,0x6e,
+    0x2e,0x63,0x6f,0x6c,0x6f,0x72,0x30,0x3b,0x0a,0x20,0x20,0x20,0x20,0x72,0x65,0x74,
+    0x75,0x72,0x6e,0x20,0x6f,0x75,0x74,0x3b,0x0a,0x7d,0x0a,0x0a,0x00,
+};
+static const uint8_t _sgl_shd_compact_fs_bytecode_metal_macos[3047] = {
+    0x4d,0x54,0x4c,0x42,0x01,0x80,0x02,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0xe7,0x0b,0x00,0x00,0x00,0x00,0x00,0x00,0x58,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x7b,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xd7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xdf,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xe7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x0b,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x7b,0x00,0x00,0x00,
+    0x4e,0x41,0x4d,0x45,0x06,0x00,0x6d,0x61,0x69,0x6e,0x30,0x00,0x54,0x59,0x50,0x45,
+    0x01,0x00,0x01,0x48,0x41,0x53,0x48,0x20,0x00,0x0a,0x2e,0x15,0x06,0x57,0xa3,0x2b,
+    0xd3,0xce,0xa6,0x79,0x54,0xe7,0x70,0xd2,0x98,0xd6,0xcf,0xf9,0xb9,0xb7,0xb8,0xd7,
+    0xcd,0xf4,0xad,0x92,0x10,0x28,0x7e,0xce,0xa3,0x4d,0x44,0x53,0x5a,0x08,0x00,0x00,
+    0x0b,0x00,0x00,0x00,0x00,0x00,0x00,0x4f,0x46,0x46,0x54,0x18,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x56,0x45,0x52,0x53,0x08,0x00,0x01,0x00,0x0b,0x00,0x01,
+    0x00,0x02,0x00,0x45,0x4e,0x44,0x54,0x04,0x00,0x00,0x00,0x45,0x4e,0x44,0x54,0x04,
+    0x00,0x00,0x00,0x45,0x4e,0x44,0x54,0xde,0xc0,0x17,0x0b,0x00,0x00,0x00,0x00,0x14,
+    0x00,0x00,0x00,0xe4,0x0a,0x00,0x00,0xff,0xff,0xff,0xff,0x42,0x43,0xc0,0xde,0x21,
+    0x0c,0x00,0x00,0xb6,0x02,0x00,0x00,0x0b,0x82,0x20,0x00,0x02,0x00,0x00,0x00,0x12,
+    0x00,0x00,0x00,0x07,0x81,0x23,0x91,0x41,0xc8,0x04,0x49,0x06,0x10,0x32,0x39,0x92,
+    0x01,0x84,0x0c,0x25,0x05,0x08,0x19,0x1e,0x04,0x8b,0x62,0x80,0x14,0x45,0x02,0x42,
+    0x92,0x0b,0x42,0xa4,0x10,0x32,0x14,0x38,0x08,0x18,0x49,0x0a,0x32,0x44,0x24,0x48,
+    0x0a,0x90,0x21,0x23,0xc4,0x52,0x80,0x0c,0x19,0x21,0x72,0x24,0x07,0xc8,0x48,0x11,
+    0x62,0xa8,0xa0,0xa8,0x40,0xc6,0xf0,0x01,0x00,0x00,0x00,0x51,0x18,0x00,0x00,0x74,
+    0x00,0x00,0x00,0x1b,0xc2,0x24,0xf8,0xff,0xff,0xff,0xff,0x01,0x60,0x00,0x09,0xa8,
+    0x88,0x70,0x80,0x07,0x78,0x90,0x87,0x77,0xc0,0x87,0x36,0x30,0x87,0x7a,0x70,0x87,
+    0x71,0x68,0x03,0x73,0x80,0x87,0x36,0x68,0x87,0x70,0xa0,0x07,0x74,0x00,0xe8,0x41,
+    0x1e,0xea,0xa1,0x1c,0x00,0xa2,0x1d,0xd2,0xc1,0x1d,0xda,0x80,0x1d,0xca,0xe1,0x1c,
+    0xc2,0x81,0x1d,0xda,0xc0,0x1e,0xca,0x61,0x1c,0xe8,0xe1,0x1d,0xe4,0xa1,0x0d,0xee,
+    0x21,0x1d,0xc8,0x81,0x1e,0xd0,0x01,0x88,0x03,0x39,0xc0,0x03,0x60,0x70,0x87,0x77,
+    0x68,0x03,0x71,0xa8,0x87,0x74,0x60,0x07,0x7a,0x48,0x07,0x77,0x98,0x07,0x80,0x70,
+    0x87,0x77,0x68,0x03,0x73,0x90,0x87,0x70,0x68,0x87,0x72,0x68,0x03,0x78,0x78,0x87,
+    0x74,0x70,0x07,0x7a,0x28,0x07,0x79,0x68,0x83,0x72,0x60,0x87,0x74,0x68,0x07,0x80,
+    0x1e,0xe4,0xa1,0x1e,0xca,0x01,0x20,0xdc,0xe1,0x1d,0xda,0xc0,0x1c,0xe4,0x21,0x1c,
+    0xda,0xa1,0x1c,0xda,0x00,0x1e,0xde,0x21,0x1d,0xdc,0x81,0x1e,0xca,0x41,0x1e,0xda,
+    0xa0,0x1c,0xd8,0x21,0x1d,0xda,0xa1,0x0d,0xdc,0xe1,0x1d,0xdc,0xa1,0x0d,0xd8,0xa1,
+    0x1c,0xc2,0xc1,0x1c,0x00,0x7a,0x90,0x87,0x7a,0x28,0x07,0x80,0x70,0x87,0x77,0x68,
+    0x83,0x74,0x70,0x07,0x73,0x98,0x87,0x36,0x30,0x07,0x78,0x68,0x83,0x76,0x08,0x07,
+    0x7a,0x40,0x07,0x80,0x1e,0xe4,0xa1,0x1e,0xca,0x01,0x20,0xdc,0xe1,0x1d,0xda,0xc0,
+    0x1d,0xc2,0xc1,0x1d,0xe6,0xa1,0x0d,0xcc,0x01,0x1e,0xda,0xa0,0x1d,0xc2,0x81,0x1e,
+    0xd0,0x01,0xa0,0x07,0x79,0xa8,0x87,0x72,0x00,0x08,0x77,0x78,0x87,0x36,0x98,0x87,
+    0x74,0x38,0x07,0x77,0x28,0x07,0x72,0x68,0x03,0x7d,0x28,0x07,0x79,0x78,0x87,0x79,
+    0x68,0x03,0x73,0x80,0x87,0x36,0x68,0x87,0x70,0xa0,0x07,0x74,0x00,0xe8,0x41,0x1e,
+    0xea,0xa1,0x1c,0x00,0xc2,0x1d,0xde,0xa1,0x0d,0xe8,0x41,0x1e,0xc2,0x01,0x1e,0xe0,
+    0x21,0x1d,0xdc,0xe1,0x1c,0xda,0xa0,0x1d,0xc2,0x81,0x1e,0xd0,0x01,0xa0,0x07,0x79,
+    0xa8,0x87,0x72,0x00,0x88,0x79,0xa0,0x87,0x70,0x18,0x87,0x75,0x68,0x03,0x78,0x90,
+    0x87,0x77,0xa0,0x87,0x72,0x18,0x07,0x7a,0x78,0x07,0x79,0x68,0x03,0x71,0xa8,0x07,
+    0x73,0x30,0x87,0x72,0x90,0x87,0x36,0x98,0x87,0x74,0xd0,0x87,0x72,0x00,0xf0,0x00,
+    0x20,0xea,0xc1,0x1d,0xe6,0x21,0x1c,0xcc,0xa1,0x1c,0xda,0xc0,0x1c,0xe0,0xa1,0x0d,
+    0xda,0x21,0x1c,0xe8,0x01,0x1d,0x00,0x7a,0x90,0x87,0x7a,0x28,0x07,0x60,0x83,0x21,
+    0x0c,0xc0,0x02,0x54,0x1b,0x8c,0x81,0x00,0x16,0xa0,0xda,0x80,0x10,0xff,0xff,0xff,
+    0xff,0x3f,0x00,0x0c,0x20,0x01,0xd5,0x06,0xa3,0x08,0x80,0x05,0xa8,0x36,0x18,0x86,
+    0x00,0x2c,0x40,0xb5,0x01,0x39,0xfe,0xff,0xff,0xff,0x7f,0x00,0x18,0x40,0x02,0x2a,
+    0x00,0x00,0x00,0x49,0x18,0x00,0x00,0x04,0x00,0x00,0x00,0x13,0x86,0x40,0x18,0x26,
+    0x0c,0x44,0x61,0x4c,0x18,0x8e,0xc2,0x00,0x00,0x00,0x00,0x89,0x20,0x00,0x00,0x1d,
+    0x00,0x00,0x00,0x32,0x22,0x48,0x09,0x20,0x64,0x85,0x04,0x93,0x22,0xa4,0x84,0x04,
+    0x93,0x22,0xe3,0x84,0xa1,0x90,0x14,0x12,0x4c,0x8a,0x8c,0x0b,0x84,0xa4,0x4c,0x10,
+    0x48,0x33,0x00,0xc3,0x08,0x04,0x60,0x83,0x70,0x94,0x34,0x45,0x94,0x30,0xf9,0xff,
+    0x44,0x5c,0x13,0x15,0x11,0xbf,0x3d,0xfc,0xd3,0x18,0x01,0x30,0x88,0x30,0x04,0x17,
+    0x49,0x53,0x44,0x09,0x93,0xff,0x4b,0x00,0xf3,0x2c,0x44,0xf4,0x4f,0x63,0x04,0xc0,
+    0x20,0x42,0x21,0x94,0x42,0x84,0x40,0x0c,0x9d,0x61,0x04,0x01,0x98,0x23,0x08,0xe6,
+    0x08,0xc0,0x60,0x18,0x41,0x58,0x0a,0x12,0x88,0x49,0x8a,0x29,0x40,0x6d,0x20,0x20,
+    0x05,0xd6,0x08,0x00,0x00,0x00,0x00,0x13,0xb2,0x70,0x48,0x07,0x79,0xb0,0x03,0x3a,
+    0x68,0x83,0x70,0x80,0x07,0x78,0x60,0x87,0x72,0x68,0x83,0x76,0x08,0x87,0x71,0x78,
+    0x87,0x79,0xc0,0x87,0x38,0x80,0x03,0x37,0x88,0x03,0x39,0x70,0x03,0x38,0xd8,0x70,
+    0x1b,0xe5,0xd0,0x06,0xf0,0xa0,0x07,0x76,0x40,0x07,0x7a,0x60,0x07,0x74,0xa0,0x07,
+    0x76,0x40,0x07,0x6d,0x90,0x0e,0x71,0xa0,0x07,0x78,0xa0,0x07,0x78,0xd0,0x06,0xe9,
+    0x80,0x07,0x7a,0x80,0x07,0x7a,0x80,0x07,0x6d,0x90,0x0e,0x71,0x60,0x07,0x7a,0x10,
+    0x07,0x76,0xa0,0x07,0x71,0x60,0x07,0x6d,0x90,0x0e,0x73,0x20,0x07,0x7a,0x30,0x07,
+    0x72,0xa0,0x07,0x73,0x20,0x07,0x6d,0x90,0x0e,0x76,0x40,0x07,0x7a,0x60,0x07,0x74,
+    0xa0,0x07,0x76,0x40,0x07,0x6d,0x60,0x0e,0x73,0x20,0x07,0x7a,0x30,0x07,0x72,0xa0,
+    0x07,0x73,0x20,0x07,0x6d,0x60,0x0e,0x76,0x40,0x07,0x7a,0x60,0x07,0x74,0xa0,0x07,
+    0x76,0x40,0x07,0x6d,0x60,0x0f,0x71,0x60,0x07,0x7a,0x10,0x07,0x76,0xa0,0x07,0x71,
+    0x60,0x07,0x6d,0x60,0x0f,0x72,0x40,0x07,0x7a,0x30,0x07,0x72,0xa0,0x07,0x73,0x20,
+    0x07,0x6d,0x60,0x0f,0x73,0x20,0x07,0x7a,0x30,0x07,0x72,0xa0,0x07,0x73,0x20,0x07,
+    0x6d,0x60,0x0f,0x74,0x80,0x07,0x7a,0x60,0x07,0x74,0xa0,0x07,0x76,0x40,0x07,0x6d,
+    0x60,0x0f,0x76,0x40,0x07,0x7a,0x60,0x07,0x74,0xa0,0x07,0x76,0x40,0x07,0x6d,0x60,
+    0x0f,0x79,0x60,0x07,0x7a,0x10,0x07,0x72,0x80,0x07,0x7a,0x10,0x07,0x72,0x80,0x07,
+    0x6d,0x60,0x0f,0x71,0x20,0x07,0x78,0xa0,0x07,0x71,0x20,0x07,0x78,0xa0,0x07,0x71,
+    0x20,0x07,0x78,0xd0,0x06,0xf6,0x10,0x07,0x79,0x20,0x07,0x7a,0x20,0x07,0x75,0x60,
+    0x07,0x7a,0x20,0x07,0x75,0x60,0x07,0x6d,0x60,0x0f,0x72,0x50,0x07,0x76,0xa0,0x07,
+    0x72,0x50,0x07,0x76,0xa0,0x07,0x72,0x50,0x07,0x76,0xd0,0x06,0xf6,0x50,0x07,0x71,
+    0x20,0x07,0x7a,0x50,0x07,0x71,0x20,0x07,0x7a,0x50,0x07,0x71,0x20,0x07,0x6d,0x60,
+    0x0f,0x71,0x00,0x07,0x72,0x40,0x07,0x7a,0x10,0x07,0x70,0x20,0x07,0x74,0xa0,0x07,
+    0x71,0x00,0x07,0x72,0x40,0x07,0x6d,0xe0,0x0e,0x78,0xa0,0x07,0x71,0x60,0x07,0x7a,
+    0x30,0x07,0x72,0x30,0x84,0x41,0x00,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x18,0xc2,
+    0x38,0x40,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x64,0x81,0x00,0x00,0x00,0x00,0x08,
+    0x00,0x00,0x00,0x32,0x1e,0x98,0x10,0x19,0x11,0x4c,0x90,0x8c,0x09,0x26,0x47,0xc6,
+    0x04,0x43,0x5a,0x23,0x00,0x25,0x50,0x04,0x85,0x50,0x16,0x65,0x40,0x70,0x2c,0x41,
+    0x23,0x00,0x00,0x79,0x18,0x00,0x00,0xd1,0x00,0x00,0x00,0x1a,0x03,0x4c,0x10,0x97,
+    0x29,0xa2,0x25,0x10,0xab,0x32,0xb9,0xb9,0xb4,0x37,0xb7,0x21,0xc6,0x42,0x3c,0x00,
+    0x84,0x50,0xb9,0x1b,0x43,0x0b,0x93,0xfb,0x9a,0x4b,0xd3,0x2b,0x1b,0x62,0x2c,0xc3,
+    0x23,0x2c,0x05,0xe3,0x20,0x08,0x0e,0x8e,0xad,0x0c,0xa4,0xad,0x8c,0x2e,0x8c,0x0d,
+    0xc4,0xae,0x4c,0x6e,0x2e,0xed,0xcd,0x0d,0x64,0x46,0x06,0x46,0x66,0xc6,0x05,0x07,
+    0x67,0x06,0x04,0xa5,0xad,0x8c,0x2e,0x8c,0xcd,0xac,0xac,0x65,0x46,0x06,0x46,0x66,
+    0xc6,0x05,0x07,0x67,0x26,0x65,0x88,0xf0,0x10,0x43,0x8c,0x65,0x58,0x8c,0x45,0x60,
+    0xd1,0x54,0x46,0x17,0xc6,0x36,0x04,0x79,0x8e,0x65,0x58,0x88,0x45,0xe0,0x16,0x96,
+    0x26,0xe7,0x32,0xf6,0xd6,0x06,0x97,0xc6,0x56,0xe6,0x42,0x56,0xe6,0xf6,0x26,0xd7,
+    0x36,0xf7,0x45,0x96,0x36,0x17,0x26,0xc6,0x56,0x36,0x44,0x78,0x12,0x72,0x61,0x69,
+    0x72,0x2e,0x63,0x6f,0x6d,0x70,0x69,0x6c,0x65,0x2e,0x66,0x61,0x73,0x74,0x5f,0x6d,
+    0x61,0x74,0x68,0x5f,0x65,0x6e,0x61,0x62,0x6c,0x65,0x43,0x84,0x67,0x61,0x19,0x84,
+    0xa5,0xc9,0xb9,0x8c,0xbd,0xb5,0xc1,0xa5,0xb1,0x95,0xb9,0x98,0xc9,0x85,0xb5,0x95,
+    0x89,0xd5,0x99,0x99,0x95,0xc9,0x7d,0x99,0x95,0xd1,0x8d,0xa1,0x7d,0x91,0xa5,0xcd,
+    0x85,0x89,0xb1,0x95,0x0d,0x11,0x9e,0x86,0x51,0x58,0x9a,0x9c,0x8b,0x5c,0x99,0x1b,
+    0x59,0x99,0xdc,0x17,0x5d,0x98,0xdc,0x59,0x19,0x1d,0xa3,0xb0,0x34,0x39,0x97,0x30,
+    0xb9,0xb3,0x2f,0xba,0x3c,0xb8,0xb2,0x2f,0xb7,0xb0,0xb6,0x32,0x1a,0x66,0x6c,0x6f,
+    0x61,0x74,0x34,0x64,0xc2,0xd2,0xe4,0x5c,0xc2,0xe4,0xce,0xbe,0xdc,0xc2,0xda,0xca,
+    0xa8,0x98,0xc9,0x85,0x9d,0x7d,0x8d,0xbd,0xb1,0xbd,0xc9,0x0d,0x71,0x9e,0x67,0x11,
+    0x16,0xe1,0x81,0x9e,0xe8,0x91,0x9e,0x69,0x88,0xf0,0x50,0x94,0xc2,0xd2,0xe4,0x5c,
+    0xcc,0xe4,0xc2,0xce,0xda,0xca,0xdc,0xe8,0xbe,0xd2,0xdc,0xe0,0xea,0xe8,0xb8,0xd4,
+    0xcd,0x95,0xc9,0xa1,0xb0,0xbd,0x8d,0xb9,0xc1,0xa4,0x50,0x09,0x4b,0x93,0x73,0x19,
+    0x2b,0x73,0xa3,0x2b,0x93,0xe3,0x13,0x96,0x26,0xe7,0x02,0x57,0x26,0x37,0x07,0x57,
+    0x36,0x46,0x97,0x66,0x57,0x46,0xa1,0xce,0x6e,0x88,0xb4,0x08,0x8f,0xf5,0x5c,0x0f,
+    0xf6,0x64,0x0f,0xf4,0x44,0x8f,0xf4,0x68,0x5c,0xea,0xe6,0xca,0xe4,0x50,0xd8,0xde,
+    0xc6,0xdc,0x62,0x52,0x58,0x8c,0xbd,0xb1,0xbd,0xc9,0x0d,0x91,0x96,0xe1,0xb1,0x1e,
+    0xee,0xc1,0x9e,0xec,0x81,0x9e,0xe8,0x91,0x9e,0x8e,0x4b,0x58,0x9a,0x9c,0x0b,0x5d,
+    0x19,0x1e,0x5d,0x9d,0x5c,0x19,0xa5,0xb0,0x34,0x39,0x17,0xb6,0xb7,0xb1,0x30,0xba,
+    0xb4,0x37,0xb7,0xaf,0x34,0x37,0xb2,0x32,0x3c,0x2a,0x61,0x69,0x72,0x2e,0x73,0x61,
+    0x6d,0x70,0x6c,0x65,0xc4,0xe8,0xca,0xf0,0xe8,0xea,0xe4,0xca,0x64,0xc8,0x78,0xcc,
+    0xd8,0xde,0xc2,0xe8,0x58,0x40,0xe6,0xc2,0xda,0xe0,0xd8,0xca,0x7c,0x38,0xd0,0x95,
+    0xe1,0x0d,0xa1,0x16,0xe2,0xf9,0x1e,0x30,0x58,0x84,0x65,0x78,0xc2,0xe0,0x81,0x1e,
+    0x31,0x78,0xa4,0x67,0x0c,0xb8,0x84,0xa5,0xc9,0xb9,0xcc,0x85,0xb5,0xc1,0xb1,0x95,
+    0xc9,0xf1,0x98,0x0b,0x6b,0x83,0x63,0x2b,0x93,0xe3,0x30,0xd7,0x06,0x37,0x44,0x5a,
+    0x8e,0xa7,0x0c,0x1e,0x30,0x58,0x84,0x65,0x78,0xa0,0xc7,0x0c,0x1e,0xe9,0x39,0x83,
+    0x21,0xc8,0xb3,0x3d,0xde,0x43,0x06,0x0f,0x1a,0x0c,0x31,0x10,0xe0,0xa9,0x9e,0x34,
+    0xe0,0x15,0x96,0x26,0xd7,0x12,0xc6,0x96,0x16,0x36,0xd7,0x32,0x37,0xf6,0x06,0x57,
+    0x36,0x87,0xd2,0x16,0x96,0xe6,0x06,0x93,0x32,0x84,0x78,0xd8,0xe0,0x59,0x03,0x62,
+    0x61,0x69,0x72,0x2d,0x61,0x6c,0x69,0x61,0x73,0x2d,0x73,0x63,0x6f,0x70,0x65,0x2d,
+    0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x73,0x43,0x8c,0xc7,0x0d,0x1e,0x36,0x78,0xda,
+    0x80,0x58,0x58,0x9a,0x5c,0x4b,0x18,0x5b,0x5a,0xd8,0x5c,0xcb,0xdc,0xd8,0x1b,0x5c,
+    0x59,0xcb,0x5c,0x58,0x1b,0x1c,0x5b,0x99,0xdc,0xdc,0x10,0xe3,0x81,0x83,0x87,0x0d,
+    0x9e,0x37,0x18,0x42,0x3c,0x6e,0xf0,0xc0,0xc1,0x88,0x88,0x1d,0xd8,0xc1,0x1e,0xda,
+    0xc1,0x0d,0xda,0xe1,0x1d,0xc8,0xa1,0x1e,0xd8,0xa1,0x1c,0xdc,0xc0,0x1c,0xd8,0x21,
+    0x1c,0xce,0x61,0x1e,0xa6,0x08,0xc1,0x30,0x42,0x61,0x07,0x76,0xb0,0x87,0x76,0x70,
+    0x83,0x74,0x20,0x87,0x72,0x70,0x07,0x7a,0x98,0x12,0x14,0x23,0x96,0x70,0x48,0x07,
+    0x79,0x70,0x03,0x7b,0x28,0x07,0x79,0x98,0x87,0x74,0x78,0x07,0x77,0x98,0x12,0x18,
+    0x23,0xa8,0x70,0x48,0x07,0x79,0x70,0x03,0x76,0x08,0x07,0x77,0x38,0x87,0x7a,0x08,
+    0x87,0x73,0x28,0x87,0x5f,0xb0,0x87,0x72,0x90,0x87,0x79,0x48,0x87,0x77,0x70,0x87,
+    0x29,0x01,0x32,0x62,0x0a,0x87,0x74,0x90,0x07,0x37,0x18,0x87,0x77,0x68,0x07,0x78,
+    0x48,0x07,0x76,0x28,0x87,0x5f,0x78,0x07,0x78,0xa0,0x87,0x74,0x78,0x07,0x77,0x98,
+    0x87,0x29,0x83,0xc2,0x38,0x23,0x98,0x70,0x48,0x07,0x79,0x70,0x03,0x73,0x90,0x87,
+    0x70,0x38,0x87,0x76,0x28,0x07,0x77,0xa0,0x87,0x29,0x81,0x1a,0x00,0x00,0x00,0x79,
+    0x18,0x00,0x00,0xa5,0x00,0x00,0x00,0x33,0x08,0x80,0x1c,0xc4,0xe1,0x1c,0x66,0x14,
+    0x01,0x3d,0x88,0x43,0x38,0x84,0xc3,0x8c,0x42,0x80,0x07,0x79,0x78,0x07,0x73,0x98,
+    0x71,0x0c,0xe6,0x00,0x0f,0xed,0x10,0x0e,0xf4,0x80,0x0e,0x33,0x0c,0x42,0x1e,0xc2,
+    0xc1,0x1d,0xce,0xa1,0x1c,0x66,0x30,0x05,0x3d,0x88,0x43,0x38,0x84,0x83,0x1b,0xcc,
+    0x03,0x3d,0xc8,0x43,0x3d,0x8c,0x03,0x3d,0xcc,0x78,0x8c,0x74,0x70,0x07,0x7b,0x08,
+    0x07,0x79,0x48,0x87,0x70,0x70,0x07,0x7a,0x70,0x03,0x76,0x78,0x87,0x70,0x20,0x87,
+    0x19,0xcc,0x11,0x0e,0xec,0x90,0x0e,0xe1,0x30,0x0f,0x6e,0x30,0x0f,0xe3,0xf0,0x0e,
+    0xf0,0x50,0x0e,0x33,0x10,0xc4,0x1d,0xde,0x21,0x1c,0xd8,0x21,0x1d,0xc2,0x61,0x1e,
+    0x66,0x30,0x89,0x3b,0xbc,0x83,0x3b,0xd0,0x43,0x39,0xb4,0x03,0x3c,0xbc,0x83,0x3c,
+    0x84,0x03,0x3b,0xcc,0xf0,0x14,0x76,0x60,0x07,0x7b,0x68,0x07,0x37,0x68,0x87,0x72,
+    0x68,0x07,0x37,0x80,0x87,0x70,0x90,0x87,0x70,0x60,0x07,0x76,0x28,0x07,0x76,0xf8,
+    0x05,0x76,0x78,0x87,0x77,0x80,0x87,0x5f,0x08,0x87,0x71,0x18,0x87,0x72,0x98,0x87,
+    0x79,0x98,0x81,0x2c,0xee,0xf0,0x0e,0xee,0xe0,0x0e,0xf5,0xc0,0x0e,0xec,0x30,0x03,
+    0x62,0xc8,0xa1,0x1c,0xe4,0xa1,0x1c,0xcc,0xa1,0x1c,0xe4,0xa1,0x1c,0xdc,0x61,0x1c,
+    0xca,0x21,0x1c,0xc4,0x81,0x1d,0xca,0x61,0x06,0xd6,0x90,0x43,0x39,0xc8,0x43,0x39,
+    0x98,0x43,0x39,0xc8,0x43,0x39,0xb8,0xc3,0x38,0x94,0x43,0x38,0x88,0x03,0x3b,0x94,
+    0xc3,0x2f,0xbc,0x83,0x3c,0xfc,0x82,0x3b,0xd4,0x03,0x3b,0xb0,0xc3,0x0c,0xc7,0x69,
+    0x87,0x70,0x58,0x87,0x72,0x70,0x83,0x74,0x68,0x07,0x78,0x60,0x87,0x74,0x18,0x87,
+    0x74,0xa0,0x87,0x19,0xce,0x53,0x0f,0xee,0x00,0x0f,0xf2,0x50,0x0e,0xe4,0x90,0x0e,
+    0xe3,0x40,0x0f,0xe1,0x20,0x0e,0xec,0x50,0x0e,0x33,0x20,0x28,0x1d,0xdc,0xc1,0x1e,
+    0xc2,0x41,0x1e,0xd2,0x21,0x1c,0xdc,0x81,0x1e,0xdc,0xe0,0x1c,0xe4,0xe1,0x1d,0xea,
+    0x01,0x1e,0x66,0x18,0x51,0x38,0xb0,0x43,0x3a,0x9c,0x83,0x3b,0xcc,0x50,0x24,0x76,
+    0x60,0x07,0x7b,0x68,0x07,0x37,0x60,0x87,0x77,0x78,0x07,0x78,0x98,0x51,0x4c,0xf4,
+    0x90,0x0f,0xf0,0x50,0x0e,0x33,0x1e,0x6a,0x1e,0xca,0x61,0x1c,0xe8,0x21,0x1d,0xde,
+    0xc1,0x1d,0x7e,0x01,0x1e,0xe4,0xa1,0x1c,0xcc,0x21,0x1d,0xf0,0x61,0x06,0x54,0x85,
+    0x83,0x38,0xcc,0xc3,0x3b,0xb0,0x43,0x3d,0xd0,0x43,0x39,0xfc,0xc2,0x3c,0xe4,0x43,
+    0x3b,0x88,0xc3,0x3b,0xb0,0xc3,0x8c,0xc5,0x0a,0x87,0x79,0x98,0x87,0x77,0x18,0x87,
+    0x74,0x08,0x07,0x7a,0x28,0x07,0x72,0x98,0x81,0x5c,0xe3,0x10,0x0e,0xec,0xc0,0x0e,
+    0xe5,0x50,0x0e,0xf3,0x30,0x23,0xc1,0xd2,0x41,0x1e,0xe4,0xe1,0x17,0xd8,0xe1,0x1d,
+    0xde,0x01,0x1e,0x66,0x48,0x19,0x3b,0xb0,0x83,0x3d,0xb4,0x83,0x1b,0x84,0xc3,0x38,
+    0x8c,0x43,0x39,0xcc,0xc3,0x3c,0xb8,0xc1,0x39,0xc8,0xc3,0x3b,0xd4,0x03,0x3c,0xcc,
+    0x48,0xb4,0x71,0x08,0x07,0x76,0x60,0x07,0x71,0x08,0x87,0x71,0x58,0x87,0x19,0xdb,
+    0xc6,0x0e,0xec,0x60,0x0f,0xed,0xe0,0x06,0xf0,0x20,0x0f,0xe5,0x30,0x0f,0xe5,0x20,
+    0x0f,0xf6,0x50,0x0e,0x6e,0x10,0x0e,0xe3,0x30,0x0e,0xe5,0x30,0x0f,0xf3,0xe0,0x06,
+    0xe9,0xe0,0x0e,0xe4,0x50,0x0e,0xf8,0x30,0x23,0xe2,0xec,0x61,0x1c,0xc2,0x81,0x1d,
+    0xd8,0xe1,0x17,0xec,0x21,0x1d,0xe6,0x21,0x1d,0xc4,0x21,0x1d,0xd8,0x21,0x1d,0xe8,
+    0x21,0x1f,0x66,0x20,0x9d,0x3b,0xbc,0x43,0x3d,0xb8,0x03,0x39,0x94,0x83,0x39,0xcc,
+    0x58,0xbc,0x70,0x70,0x07,0x77,0x78,0x07,0x7a,0x08,0x07,0x7a,0x48,0x87,0x77,0x70,
+    0x87,0x19,0xce,0x87,0x0e,0xe5,0x10,0x0e,0xf0,0x10,0x0e,0xec,0xc0,0x0e,0xef,0x30,
+    0x0e,0xf3,0x90,0x0e,0xf4,0x50,0x0e,0x33,0x28,0x30,0x08,0x87,0x74,0x90,0x07,0x37,
+    0x30,0x87,0x7a,0x70,0x87,0x71,0xa0,0x87,0x74,0x78,0x07,0x77,0xf8,0x85,0x73,0x90,
+    0x87,0x77,0xa8,0x07,0x78,0x98,0x07,0x00,0x00,0x00,0x00,0x71,0x20,0x00,0x00,0x08,
+    0x00,0x00,0x00,0x16,0xb0,0x01,0x48,0xe4,0x4b,0x00,0xf3,0x2c,0xc4,0x3f,0x11,0xd7,
+    0x44,0x45,0xc4,0x6f,0x0f,0x7e,0x85,0x17,0xb7,0x6d,0x00,0x05,0x03,0x20,0x0d,0x0d,
+    0x00,0x00,0x00,0x61,0x20,0x00,0x00,0x14,0x00,0x00,0x00,0x13,0x04,0x41,0x2c,0x10,
+    0x00,0x00,0x00,0x06,0x00,0x00,0x00,0xc4,0x46,0x00,0xc6,0x12,0x80,0x80,0xd4,0x08,
+    0x40,0x0d,0x90,0x98,0x01,0xa0,0x30,0x03,0x40,0x60,0x04,0x00,0x00,0x00,0x00,0x83,
+    0x0c,0x8b,0x60,0x8c,0x18,0x28,0x43,0x40,0x29,0x49,0x50,0x20,0x86,0x60,0x01,0x23,
+    0x9f,0xd9,0x06,0x23,0x00,0x32,0x08,0x88,0x01,0x00,0x00,0x02,0x00,0x00,0x00,0x5b,
+    0x86,0xe0,0x88,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+};
+static const uint8_t _sgl_shd_compact_vs_source_metal_ios[717] = {
+    0x23,0x69,0x6e,0x63,0x6c,0x75,0x64,0x65,0x20,0x3c,0x6d,0x65,0x74,0x61,0x6c,0x5f,
+    0x73,0x74,0x64,0x6c,0x69,0x62,0x3e,0x0a,0x23,0x69,0x6e,0x63,0x6c,0x75,0x64,0x65,
+    0x20,0x3c,0x73,0x69,0x6d,0x64,0x2f,0x73,0x69,0x6d,0x64,0x2e,0x68,0x3e,0x0a,0x0a,
+    0x75,0x73,0x69,0x6e,0x67,0x20,0x6e,0x61,0x6d,0x65,0x73,0x70,0x61,0x63,0x65,0x20,
+    0x6d,0x65,0x74,0x61,0x6c,0x3b,0x0a,0x0a,0x73,0x74,0x72,0x75,0x63,0x74,0x20,0x76,
+    0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x66,
+    0x6c,0x6f,0x61,0x74,0x34,0x78,0x34,0x20,0x6d,0x76,0x70,0x3b,0x0a,0x20,0x20,0x20,
+    0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x78,0x34,0x20,0x74,0x6d,0x3b,0x0a,0x7d,0x3b,
+    0x0a,0x0a,0x73,0x74,0x72,0x75,0x63,0x74,0x20,0x6d,0x61,0x69,0x6e,0x30,0x5f,0x6f,
+    0x75,0x74,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,
+    0x75,0x76,0x20,0x5b,0x5b,0x75,0x73,0x65,0x72,0x28,0x6c,0x6f,0x63,0x6e,0x30,0x29,
+    0x5d,0x5d,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x63,
+    0x6f,0x6c,0x6f,0x72,0x20,0x5b,0x5b,0x75,0x73,0x65,0x72,0x28,0x6c,0x6f,0x63,0x6e,
+    0x31,0x29,0x5d,0x5d,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,
+    0x20,0x67,0x6c,0x5f,0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x20,0x5b,0x5b,0x70,
+    0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x5d,0x5d,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,
+    0x6c,0x6f,0x61,0x74,0x20,0x67,0x6c,0x5f,0x50,0x6f,0x69,0x6e,0x74,0x53,0x69,0x7a,
+    0x65,0x20,0x5b,0x5b,0x70,0x6f,0x69,0x6e,0x74,0x5f,0x73,0x69,0x7a,0x65,0x5d,0x5d,
+    0x3b,0x0a,0x7d,0x3b,0x0a,0x0a,0x73,0x74,0x72,0x75,0x63,0x74,0x20,0x6d,0x61,0x69,
+    0x6e,0x30,0x5f,0x69,0x6e,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,
+    0x74,0x34,0x20,0x70,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x20,0x5b,0x5b,0x61,0x74,
+    0x74,0x72,0x69,0x62,0x75,0x74,0x65,0x28,0x30,0x29,0x5d,0x5d,0x3b,0x0a,0x20,0x20,
+    0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x74,0x65,0x78,0x63,0x6f,0x6f,0x72,
+    0x64,0x30,0x20,0x5b,0x5b,0x61,0x74,0x74,0x72,0x69,0x62,0x75,0x74,0x65,0x28,0x31,
+    0x29,0x5d,0x5d,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,
+    0x63,0x6f,0x6c,0x6f,0x72,0x30,0x20,0x5b,0x5b,0x61,0x74,0x74,0x72,0x69,0x62,0x75,
+    0x74,0x65,0x28,0x32,0x29,0x5d,0x5d,0x3b,0x0a,0x7d,0x3b,0x0a,0x0a,0x76,0x65,0x72,
+    0x74,0x65,0x78,0x20,0x6d,0x61,0x69,0x6e,0x30,0x5f,0x6f,0x75,0x74,0x20,0x6d,0x61,
+    0x69,0x6e,0x30,0x28,0x6d,0x61,0x69,0x6e,0x30,0x5f,0x69,0x6e,0x20,0x69,0x6e,0x20,
+    0x5b,0x5b,0x73,0x74,0x61,0x67,0x65,0x5f,0x69,0x6e,0x5d,0x5d,0x2c,0x20,0x63,0x6f,
+    0x6e,0x73,0x74,0x61,0x6e,0x74,0x20,0x76,0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,
+    0x26,0x20,0x5f,0x31,0x39,0x20,0x5b,0x5b,0x62,0x75,0x66,0x66,0x65,0x72,0x28,0x30,
+    0x29,0x5d,0x5d,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x6d,0x61,0x69,0x6e,0x30,
+    0x5f,0x6f,0x75,0x74,0x20,0x6f,0x75,0x74,0x20,0x3d,0x20,0x7b,0x7d,0x3b,0x0a,0x20,
+    0x20,0x20,0x20,0x6f,0x75,0x74,0x2e,0x67,0x6c,0x5f,0x50,0x6f,0x73,0x69,0x74,0x69,
+    0x6f,0x6e,0x20,0x3d,0x20,0x5f,0x31,0x39,0x2e,0x6d,0x76,0x70,0x20,0x2a,0x20,0x69,
+    0x6e,0x2e,0x70,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x3b,0x0a,0x20,0x20,0x20,0x20,
+    0x6f,0x75,0x74,0x2e,0x67,0x6c,0x5f,0x50,0x6f,0x69,0x6e,0x74,0x53,0x69,0x7a,0x65,
+    0x20,0x3d,0x20,0x31,0x2e,0x30,0x3b,0x0a,0x20,0x20,0x20,0x20,0x6f,0x75,0x74,0x2e,
+    0x75,0x76,0x20,0x3d,0x20,0x5f,0x31,0x39,0x2e,0x74,0x6d,0x20,0x2a,0x20,0x66,0x6c,
+    0x6f,0x61,0x74,0x34,0x28,0x69,0x6e,0x2e,0x74,0x65,0x78,0x63,0x6f,0x6f,0x72,0x64,
+    0x30,0x2c,0x20,0x30,0x2e,0x30,0x2c,0x20,0x31,0x2e,0x30,0x29,0x3b,0x0a,0x20,0x20,
+    0x20,0x20,0x6f,0x75,0x74,0x2e,0x63,0x6f,0x6c,0x6f,0x72,0x20,0x3d,0x20,0x69,0x6e,
+    0x2e,0x63,0x6f,0x6c,0x6f,0x72,0x30,0x3b,0x0a,0x20,0x20,0x20,0x20,0x72,0x65,0x74,
+    0x75,0x72,0x6e,0x20,0x6f,0x75,0x74,0x3b,0x0a,0x7d,0x0a,0x0a,0x00,
+};
+static const uint8_t _sgl_shd_compact_fs_bytecode_metal_ios[3223] = {
+    0x4d,0x54,0x4c,0x42,0x01,0x00,0x02,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x97,0x0c,0x00,0x00,0x00,0x00,0x00,0x00,0x58,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x7b,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xd7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xdf,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xe7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0xb0,0x0b,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x7b,0x00,0x00,0x00,
+    0x4e,0x41,0x4d,0x45,0x06,0x00,0x6d,0x61,0x69,0x6e,0x30,0x00,0x54,0x59,0x50,0x45,
+    0x01,0x00,0x01,0x48,0x41,0x53,0x48,0x20,0x00,0x00,0x9a,0x30,0xb9,0xdb,0xa0,0xb2,
+    0x05,0x9e,0xbc,0xfb,0x10,0xd2,0xb9,0x27,0xd1,0x30,0x54,0xda,0x55,0xfd,0x00,0xad,
+    0x60,0xe0,0x4f,0xba,0x21,0x48,0x67,0x6f,0x4a,0x4d,0x44,0x53,0x5a,0x08,0x00,0xb0,
+    0x0b,0x00,0x00,0x00,0x00,0x00,0x00,0x4f,0x46,0x46,0x54,0x18,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x56,0x45,0x52,0x53,0x08,0x00,0x02,0x00,0x00,0x00,0x02,
+    0x00,0x00,0x00,0x45,0x4e,0x44,0x54,0x04,0x00,0x00,0x00,0x45,0x4e,0x44,0x54,0x04,
+    0x00,0x00,0x00,0x45,0x4e,0x44,0x54,0xde,0xc0,0x17,0x0b,0x00,0x00,0x00,0x00,0x14,
+    0x00,0x00,0x00,0x94,0x0b,0x00,0x00,0xff,0xff,0xff,0xff,0x42,0x43,0xc0,0xde,0x35,
+    0x14,0x00,0x00,0x03,0x00,0x00,0x00,0x62,0x0c,0x30,0x24,0x80,0x10,0x05,0xc8,0x14,
+    0x00,0x00,0x00,0x21,0x0c,0x00,0x00,0xdd,0x02,0x00,0x00,0x0b,0x82,0x20,0x00,0x02,
+    0x00,0x00,0x00,0x13,0x00,0x00,0x00,0x07,0x81,0x23,0x91,0x41,0xc8,0x04,0x49,0x06,
+    0x10,0x32,0x39,0x92,0x01,0x84,0x0c,0x25,0x05,0x08,0x19,0x1e,0x04,0x8b,0x62,0x80,
+    0x14,0x45,0x02,0x42,0x92,0x0b,0x42,0xa4,0x10,0x32,0x14,0x38,0x08,0x18,0x4b,0x0a,
+    0x32,0x52,0x88,0x48,0x90,0x14,0x20,0x43,0x46,0x88,0xa5,0x00,0x19,0x32,0x42,0xe4,
+    0x48,0x0e,0x90,0x91,0x22,0xc4,0x50,0x41,0x51,0x81,0x8c,0xe1,0x83,0xe5,0x8a,0x04,
+    0x29,0x46,0x06,0x51,0x18,0x00,0x00,0x76,0x00,0x00,0x00,0x1b,0xc6,0x24,0xf8,0xff,
+    0xff,0xff,0xff,0x01,0x68,0x03,0x60,0x0d,0x00,0x09,0xa8,0x88,0x70,0x80,0x07,0x78,
+    0x90,0x87,0x77,0xc0,0x87,0x36,0x30,0x87,0x7a,0x70,0x87,0x71,0x68,0x03,0x73,0x80,
+    0x87,0x36,0x68,0x87,0x70,0xa0,0x07,0x74,0x00,0xe8,0x41,0x1e,0xea,0xa1,0x1c,0x00,
+    0xa2,0x1d,0xd2,0xc1,0x1d,0xda,0x80,0x1d,0xca,0xe1,0x1c,0xc2,0x81,0x1d,0xda,0xc0,
+    0x1e,0xca,0x61,0x1c,0xe8,0xe1,0x1d,0xe4,0xa1,0x0d,0xee,0x21,0x1d,0xc8,0x81,0x1e,
+    0xd0,0x01,0x88,0x03,0x39,0xc0,0x03,0x60,0x70,0x87,0x77,0x68,0x03,0x71,0xa8,0x87,
+    0x74,0x60,0x07,0x7a,0x48,0x07,0x77,0x98,0x07,0x80,0x70,0x87,0x77,0x68,0x03,0x73,
+    0x90,0x87,0x70,0x68,0x87,0x72,0x68,0x03,0x78,0x78,0x87,0x74,0x70,0x07,0x7a,0x28,
+    0x07,0x79,0x68,0x83,0x72,0x60,0x87,0x74,0x68,0x07,0x80,0x1e,0xe4,0xa1,0x1e,0xca,
+    0x01,0x20,0xdc,0xe1,0x1d,0xda,0xc0,0x1c,0xe4,0x21,0x1c,0xda,0xa1,0x1c,0xda,0x00,
+    0x1e,0xde,0x21,0x1d,0xdc,0x81,0x1e,0xca,0x41,0x1e,0xda,0xa0,0x1c,0xd8,0x21,0x1d,
+    0xda,0xa1,0x0d,0xdc,0xe1,0x1d,0xdc,0xa1,0x0d,0xd8,0xa1,0x1c,0xc2,0xc1,0x1c,0x00,
+    0x7a,0x90,0x87,0x7a,0x28,0x07,0x80,0x70,0x87,0x77,0x68,0x83,0x74,0x70,0x07,0x73,
+    0x98,0x87,0x36,0x30,0x07,0x78,0x68,0x83,0x76,0x08,0x07,0x7a,0x40,0x07,0x80,0x1e,
+    0xe4,0xa1,0x1e,0xca,0x01,0x20,0xdc,0xe1,0x1d,0xda,0xc0,0x1d,0xc2,0xc1,0x1d,0xe6,
+    0xa1,0x0d,0xcc,0x01,0x1e,0xda,0xa0,0x1d,0xc2,0x81,0x1e,0xd0,0x01,0xa0,0x07,0x79,
+    0xa8,0x87,0x72,0x00,0x08,0x77,0x78,0x87,0x36,0x98,0x87,0x74,0x38,0x07,0x77,0x28,
+    0x07,0x72,0x68,0x03,0x7d,0x28,0x07,0x79,0x78,0x87,0x79,0x68,0x03,0x73,0x80,0x87,
+    0x36,0x68,0x87,0x70,0xa0,0x07,0x74,0x00,0xe8,0x41,0x1e,0xea,0xa1,0x1c,0x00,0xc2,
+    0x1d,0xde,0xa1,0x0d,0xe8,0x41,0x1e,0xc2,0x01,0x1e,0xe0,0x21,0x1d,0xdc,0xe1,0x1c,
+    0xda,0xa0,0x1d,0xc2,0x81,0x1e,0xd0,0x01,0xa0,0x07,0x79,0xa8,0x87,0x72,0x00,0x88,
+    0x79,0xa0,0x87,0x70,0x18,0x87,0x75,0x68,0x03,0x78,0x90,0x87,0x77,0xa0,0x87,0x72,
+    0x18,0x07,0x7a,0x78,0x07,0x79,0x68,0x03,0x71,0xa8,0x07,0x73,0x30,0x87,0x72,0x90,
+    0x87,0x36,0x98,0x87,0x74,0xd0,0x87,0x72,0x00,0xf0,0x00,0x20,0xea,0xc1,0x1d,0xe6,
+    0x21,0x1c,0xcc,0xa1,0x1c,0xda,0xc0,0x1c,0xe0,0xa1,0x0d,0xda,0x21,0x1c,0xe8,0x01,
+    0x1d,0x00,0x7a,0x90,0x87,0x7a,0x28,0x07,0x60,0x83,0x21,0x0c,0xc0,0x02,0x54,0x1b,
+    0x8c,0x81,0x00,0x16,0xa0,0xda,0xa0,0x10,0xff,0xff,0xff,0xff,0x3f,0x00,0x6d,0x00,
+    0xac,0x01,0x20,0x01,0xd5,0x06,0xa3,0x08,0x80,0x05,0xa8,0x36,0x18,0x86,0x00,0x2c,
+    0x40,0xb5,0x41,0x39,0xfe,0xff,0xff,0xff,0x7f,0x00,0xda,0x00,0x58,0x03,0x40,0x02,
+    0x2a,0x00,0x00,0x49,0x18,0x00,0x00,0x04,0x00,0x00,0x00,0x13,0x86,0x40,0x18,0x26,
+    0x0c,0x44,0x61,0x4c,0x18,0x8e,0xc2,0x00,0x00,0x00,0x00,0x89,0x20,0x00,0x00,0x1d,
+    0x00,0x00,0x00,0x32,0x22,0x48,0x09,0x20,0x64,0x85,0x04,0x93,0x22,0xa4,0x84,0x04,
+    0x93,0x22,0xe3,0x84,0xa1,0x90,0x14,0x12,0x4c,0x8a,0x8c,0x0b,0x84,0xa4,0x4c,0x10,
+    0x48,0x33,0x00,0xc3,0x08,0x04,0x60,0x83,0x70,0x94,0x34,0x45,0x94,0x30,0xf9,0xff,
+    0x44,0x5c,0x13,0x15,0x11,0xbf,0x3d,0xfc,0xd3,0x18,0x01,0x30,0x88,0x30,0x04,0x17,
+    0x49,0x53,0x44,0x09,0x93,0xff,0x4b,0x00,0xf3,0x2c,0x44,0xf4,0x4f,0x63,0x04,0xc0,
+    0x20,0x42,0x21,0x94,0x42,0x84,0x40,0x0c,0x9d,0x61,0x04,0x01,0x98,0x23,0x08,0xe6,
+    0x08,0xc0,0x60,0x18,0x41,0x58,0x4a,0x12,0x88,0x49,0x8a,0x29,0xb0,0xa8,0x0d,0x04,
+    0xa4,0xc0,0x1a,0x01,0x00,0x00,0x00,0x13,0xaa,0x70,0x48,0x07,0x79,0xb0,0x03,0x3a,
+    0x68,0x83,0x70,0x80,0x07,0x78,0x60,0x87,0x72,0x68,0x83,0x74,0x78,0x87,0x79,0x88,
+    0x83,0x38,0x70,0x03,0x38,0x70,0x03,0x38,0xd8,0x70,0x1b,0xe5,0xd0,0x06,0xf0,0xa0,
+    0x07,0x76,0x40,0x07,0x7a,0x60,0x07,0x74,0xa0,0x07,0x76,0x40,0x07,0x6d,0x90,0x0e,
+    0x71,0xa0,0x07,0x78,0xa0,0x07,0x78,0xd0,0x06,0xe9,0x80,0x07,0x7a,0x80,0x07,0x7a,
+    0x80,0x07,0x6d,0x90,0x0e,0x71,0x60,0x07,0x7a,0x10,0x07,0x76,0xa0,0x07,0x71,0x60,
+    0x07,0x6d,0x90,0x0e,0x73,0x20,0x07,0x7a,0x30,0x07,0x72,0xa0,0x07,0x73,0x20,0x07,
+    0x6d,0x90,0x0e,0x76,0x40,0x07,0x7a,0x60,0x07,0x74,0xa0,0x07,0x76,0x40,0x07,0x6d,
+    0x60,0x0e,0x73,0x20,0x07,0x7a,0x30,0x07,0x72,0xa0,0x07,0x73,0x20,0x07,0x6d,0x60,
+    0x0e,0x76,0x40,0x07,0x7a,0x60,0x07,0x74,0xa0,0x07,0x76,0x40,0x07,0x6d,0x60,0x0f,
+    0x71,0x60,0x07,0x7a,0x10,0x07,0x76,0xa0,0x07,0x71,0x60,0x07,0x6d,0x60,0x0f,0x72,
+    0x40,0x07,0x7a,0x30,0x07,0x72,0xa0,0x07,0x73,0x20,0x07,0x6d,0x60,0x0f,0x73,0x20,
+    0x07,0x7a,0x30,0x07,0x72,0xa0,0x07,0x73,0x20,0x07,0x6d,0x60,0x0f,0x74,0x80,0x07,
+    0x7a,0x60,0x07,0x74,0xa0,0x07,0x76,0x40,0x07,0x6d,0x60,0x0f,0x76,0x40,0x07,0x7a,
+    0x60,0x07,0x74,0xa0,0x07,0x76,0x40,0x07,0x6d,0x60,0x0f,0x79,0x60,0x07,0x7a,0x10,
+    0x07,0x72,0x80,0x07,0x7a,0x10,0x07,0x72,0x80,0x07,0x6d,0x60,0x0f,0x71,0x20,0x07,
+    0x78,0xa0,0x07,0x71,0x20,0x07,0x78,0xa0,0x07,0x71,0x20,0x07,0x78,0xd0,0x06,0xf6,
+    0x10,0x07,0x79,0x20,0x07,0x7a,0x20,0x07,0x75,0x60,0x07,0x7a,0x20,0x07,0x75,0x60,
+    0x07,0x6d,0x60,0x0f,0x72,0x50,0x07,0x76,0xa0,0x07,0x72,0x50,0x07,0x76,0xa0,0x07,
+    0x72,0x50,0x07,0x76,0xd0,0x06,0xf6,0x50,0x07,0x71,0x20,0x07,0x7a,0x50,0x07,0x71,
+    0x20,0x07,0x7a,0x50,0x07,0x71,0x20,0x07,0x6d,0x60,0x0f,0x71,0x00,0x07,0x72,0x40,
+    0x07,0x7a,0x10,0x07,0x70,0x20,0x07,0x74,0xa0,0x07,0x71,0x00,0x07,0x72,0x40,0x07,
+    0x6d,0xe0,0x0e,0x78,0xa0,0x07,0x71,0x60,0x07,0x7a,0x30,0x07,0x72,0x30,0xe4,0x39,
+    0x00,0x00,0x08,0x00,0x00,0x00,0x04,0x00,0x00,0x00,0x60,0xc8,0xd3,0x00,0x01,0x20,
+    0x00,0x00,0x00,0x08,0x00,0x00,0x00,0x80,0x46,0x08,0x43,0x16,0x0c,0x80,0x34,0xb4,
+    0xc4,0x06,0x81,0xa2,0xd5,0x02,0x00,0x00,0x59,0x20,0x00,0x08,0x00,0x00,0x00,0x32,
+    0x1e,0x98,0x10,0x19,0x11,0x4c,0x90,0x8c,0x09,0x26,0x47,0xc6,0x04,0x43,0x5a,0x45,
+    0x50,0x02,0x85,0x30,0x02,0x50,0x06,0x04,0xc7,0x12,0x34,0x02,0x00,0x00,0x00,0xb1,
+    0x18,0x00,0x00,0xa5,0x00,0x00,0x00,0x33,0x08,0x80,0x1c,0xc4,0xe1,0x1c,0x66,0x14,
+    0x01,0x3d,0x88,0x43,0x38,0x84,0xc3,0x8c,0x42,0x80,0x07,0x79,0x78,0x07,0x73,0x98,
+    0x71,0x0c,0xe6,0x00,0x0f,0xed,0x10,0x0e,0xf4,0x80,0x0e,0x33,0x0c,0x42,0x1e,0xc2,
+    0xc1,0x1d,0xce,0xa1,0x1c,0x66,0x30,0x05,0x3d,0x88,0x43,0x38,0x84,0x83,0x1b,0xcc,
+    0x03,0x3d,0xc8,0x43,0x3d,0x8c,0x03,0x3d,0xcc,0x78,0x8c,0x74,0x70,0x07,0x7b,0x08,
+    0x07,0x79,0x48,0x87,0x70,0x70,0x07,0x7a,0x70,0x03,0x76,0x78,0x87,0x70,0x20,0x87,
+    0x19,0xcc,0x11,0x0e,0xec,0x90,0x0e,0xe1,0x30,0x0f,0x6e,0x30,0x0f,0xe3,0xf0,0x0e,
+    0xf0,0x50,0x0e,0x33,0x10,0xc4,0x1d,0xde,0x21,0x1c,0xd8,0x21,0x1d,0xc2,0x61,0x1e,
+    0x66,0x30,0x89,0x3b,0xbc,0x83,0x3b,0xd0,0x43,0x39,0xb4,0x03,0x3c,0xbc,0x83,0x3c,
+    0x84,0x03,0x3b,0xcc,0xf0,0x14,0x76,0x60,0x07,0x7b,0x68,0x07,0x37,0x68,0x87,0x72,
+    0x68,0x07,0x37,0x80,0x87,0x70,0x90,0x87,0x70,0x60,0x07,0x76,0x28,0x07,0x76,0xf8,
+    0x05,0x76,0x78,0x87,0x77,0x80,0x87,0x5f,0x08,0x87,0x71,0x18,0x87,0x72,0x98,0x87,
+    0x79,0x98,0x81,0x2c,0xee,0xf0,0x0e,0xee,0xe0,0x0e,0xf5,0xc0,0x0e,0xec,0x30,0x03,
+    0x62,0xc8,0xa1,0x1c,0xe4,0xa1,0x1c,0xcc,0xa1,0x1c,0xe4,0xa1,0x1c,0xdc,0x61,0x1c,
+    0xca,0x21,0x1c,0xc4,0x81,0x1d,0xca,0x61,0x06,0xd6,0x90,0x43,0x39,0xc8,0x43,0x39,
+    0x98,0x43,0x39,0xc8,0x43,0x39,0xb8,0xc3,0x38,0x94,0x43,0x38,0x88,0x03,0x3b,0x94,
+    0xc3,0x2f,0xbc,0x83,0x3c,0xfc,0x82,0x3b,0xd4,0x03,0x3b,0xb0,0xc3,0x0c,0xc7,0x69,
+    0x87,0x70,0x58,0x87,0x72,0x70,0x83,0x74,0x68,0x07,0x78,0x60,0x87,0x74,0x18,0x87,
+    0x74,0xa0,0x87,0x19,0xce,0x53,0x0f,0xee,0x00,0x0f,0xf2,0x50,0x0e,0xe4,0x90,0x0e,
+    0xe3,0x40,0x0f,0xe1,0x20,0x0e,0xec,0x50,0x0e,0x33,0x20,0x28,0x1d,0xdc,0xc1,0x1e,
+    0xc2,0x41,0x1e,0xd2,0x21,0x1c,0xdc,0x81,0x1e,0xdc,0xe0,0x1c,0xe4,0xe1,0x1d,0xea,
+    0x01,0x1e,0x66,0x18,0x51,0x38,0xb0,0x43,0x3a,0x9c,0x83,0x3b,0xcc,0x50,0x24,0x76,
+    0x60,0x07,0x7b,0x68,0x07,0x37,0x60,0x87,0x77,0x78,0x07,0x78,0x98,0x51,0x4c,0xf4,
+    0x90,0x0f,0xf0,0x50,0x0e,0x33,0x1e,0x6a,0x1e,0xca,0x61,0x1c,0xe8,0x21,0x1d,0xde,
+    0xc1,0x1d,0x7e,0x01,0x1e,0xe4,0xa1,0x1c,0xcc,0x21,0x1d,0xf0,0x61,0x06,0x54,0x85,
+    0x83,0x38,0xcc,0xc3,0x3b,0xb0,0x43,0x3d,0xd0,0x43,0x39,0xfc,0xc2,0x3c,0xe4,0x43,
+    0x3b,0x88,0xc3,0x3b,0xb0,0xc3,0x8c,0xc5,0x0a,0x87,0x79,0x98,0x87,0x77,0x18,0x87,
+    0x74,0x08,0x07,0x7a,0x28,0x07,0x72,0x98,0x81,0x5c,0xe3,0x10,0x0e,0xec,0xc0,0x0e,
+    0xe5,0x50,0x0e,0xf3,0x30,0x23,0xc1,0xd2,0x41,0x1e,0xe4,0xe1,0x17,0xd8,0xe1,0x1d,
+    0xde,0x01,0x1e,0x66,0x48,0x19,0x3b,0xb0,0x83,0x3d,0xb4,0x83,0x1b,0x84,0xc3,0x38,
+    0x8c,0x43,0x39,0xcc,0xc3,0x3c,0xb8,0xc1,0x39,0xc8,0xc3,0x3b,0xd4,0x03,0x3c,0xcc,
+    0x48,0xb4,0x71,0x08,0x07,0x76,0x60,0x07,0x71,0x08,0x87,0x71,0x58,0x87,0x19,0xdb,
+    0xc6,0x0e,0xec,0x60,0x0f,0xed,0xe0,0x06,0xf0,0x20,0x0f,0xe5,0x30,0x0f,0xe5,0x20,
+    0x0f,0xf6,0x50,0x0e,0x6e,0x10,0x0e,0xe3,0x30,0x0e,0xe5,0x30,0x0f,0xf3,0xe0,0x06,
+    0xe9,0xe0,0x0e,0xe4,0x50,0x0e,0xf8,0x30,0x23,0xe2,0xec,0x61,0x1c,0xc2,0x81,0x1d,
+    0xd8,0xe1,0x17,0xec,0x21,0x1d,0xe6,0x21,0x1d,0xc4,0x21,0x1d,0xd8,0x21,0x1d,0xe8,
+    0x21,0x1f,0x66,0x20,0x9d,0x3b,0xbc,0x43,0x3d,0xb8,0x03,0x39,0x94,0x83,0x39,0xcc,
+    0x58,0xbc,0x70,0x70,0x07,0x77,0x78,0x07,0x7a,0x08,0x07,0x7a,0x48,0x87,0x77,0x70,
+    0x87,0x19,0xce,0x87,0x0e,0xe5,0x10,0x0e,0xf0,0x10,0x0e,0xec,0xc0,0x0e,0xef,0x30,
+    0x0e,0xf3,0x90,0x0e,0xf4,0x50,0x0e,0x33,0x28,0x30,0x08,0x87,0x74,0x90,0x07,0x37,
+    0x30,0x87,0x7a,0x70,0x87,0x71,0xa0,0x87,0x74,0x78,0x07,0x77,0xf8,0x85,0x73,0x90,
+    0x87,0x77,0xa8,0x07,0x78,0x98,0x07,0x00,0x00,0x00,0x00,0x79,0x18,0x00,0x00,0xa7,
+    0x00,0x00,0x00,0x22,0x47,0xc8,0x90,0x51,0x6e,0xd8,0xce,0x00,0x00,0x00,0x00,0x8b,
+    0x12,0x07,0xc5,0xc6,0x91,0x41,0x14,0x19,0x8c,0x22,0x2d,0xca,0x23,0x2c,0xc5,0x22,
+    0x29,0xd8,0xb0,0x1c,0x03,0x00,0x00,0x53,0x44,0x4b,0x20,0x56,0x65,0x72,0x73,0x69,
+    0x6f,0x6e,0x77,0x63,0x68,0x61,0x72,0x5f,0x73,0x69,0x7a,0x65,0x41,0x70,0x70,0x6c,
+    0x65,0x20,0x6d,0x65,0x74,0x61,0x6c,0x20,0x76,0x65,0x72,0x73,0x69,0x6f,0x6e,0x20,
+    0x33,0x32,0x30,0x32,0x33,0x2e,0x38,0x38,0x33,0x20,0x28,0x6d,0x65,0x74,0x61,0x6c,
+    0x66,0x65,0x2d,0x33,0x32,0x30,0x32,0x33,0x2e,0x38,0x38,0x33,0x29,0x4d,0x65,0x74,
+    0x61,0x6c,0x61,0x69,0x72,0x2e,0x63,0x6f,0x6d,0x70,0x69,0x6c,0x65,0x2e,0x64,0x65,
+    0x6e,0x6f,0x72,0x6d,0x73,0x5f,0x64,0x69,0x73,0x61,0x62,0x6c,0x65,0x61,0x69,0x72,
+    0x2e,0x63,0x6f,0x6d,0x70,0x69,0x6c,0x65,0x2e,0x66,0x61,0x73,0x74,0x5f,0x6d,0x61,
+    0x74,0x68,0x5f,0x65,0x6e,0x61,0x62,0x6c,0x65,0x61,0x69,0x72,0x2e,0x63,0x6f,0x6d,
+    0x70,0x69,0x6c,0x65,0x2e,0x66,0x72,0x61,0x6d,0x65,0x62,0x75,0x66,0x66,0x65,0x72,
+    0x5f,0x66,0x65,0x74,0x63,0x68,0x5f,0x65,0x6e,0x61,0x62,0x6c,0x65,0x61,0x69,0x72,
+    0x2e,0x72,0x65,0x6e,0x64,0x65,0x72,0x5f,0x74,0x61,0x72,0x67,0x65,0x74,0x61,0x69,
+    0x72,0x2e,0x61,0x72,0x67,0x5f,0x74,0x79,0x70,0x65,0x5f,0x6e,0x61,0x6d,0x65,0x66,
+    0x6c,0x6f,0x61,0x74,0x34,0x61,0x69,0x72,0x2e,0x61,0x72,0x67,0x5f,0x6e,0x61,0x6d,
+    0x65,0x66,0x72,0x61,0x67,0x5f,0x63,0x6f,0x6c,0x6f,0x72,0x61,0x69,0x72,0x2e,0x66,
+    0x72,0x61,0x67,0x6d,0x65,0x6e,0x74,0x5f,0x69,0x6e,0x70,0x75,0x74,0x75,0x73,0x65,
+    0x72,0x28,0x6c,0x6f,0x63,0x6e,0x30,0x29,0x61,0x69,0x72,0x2e,0x63,0x65,0x6e,0x74,
+    0x65,0x72,0x61,0x69,0x72,0x2e,0x70,0x65,0x72,0x73,0x70,0x65,0x63,0x74,0x69,0x76,
+    0x65,0x75,0x76,0x75,0x73,0x65,0x72,0x28,0x6c,0x6f,0x63,0x6e,0x31,0x29,0x63,0x6f,
+    0x6c,0x6f,0x72,0x61,0x69,0x72,0x2e,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x61,0x69,
+    0x72,0x2e,0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x5f,0x69,0x6e,0x64,0x65,0x78,
+    0x61,0x69,0x72,0x2e,0x73,0x61,0x6d,0x70,0x6c,0x65,0x74,0x65,0x78,0x74,0x75,0x72,
+    0x65,0x32,0x64,0x3c,0x66,0x6c,0x6f,0x61,0x74,0x2c,0x20,0x73,0x61,0x6d,0x70,0x6c,
+    0x65,0x3e,0x74,0x65,0x78,0x61,0x69,0x72,0x2e,0x73,0x61,0x6d,0x70,0x6c,0x65,0x72,
+    0x73,0x61,0x6d,0x70,0x6c,0x65,0x72,0x73,0x6d,0x70,0x00,0x13,0x84,0x45,0x98,0x20,
+    0x40,0xc7,0x04,0x61,0x19,0x26,0x08,0x0b,0x31,0x41,0x58,0x8a,0x09,0x02,0x02,0x4c,
+    0x10,0x16,0x63,0xc3,0xc0,0x05,0xdd,0x86,0xc1,0x13,0xbe,0x0d,0xc1,0xb0,0x61,0xe0,
+    0xc0,0x00,0x0c,0x36,0x10,0x04,0x07,0x06,0x60,0xb0,0x21,0x28,0x36,0x04,0xc6,0x86,
+    0xe0,0xd8,0x70,0x20,0x60,0x00,0x06,0x89,0xb2,0x30,0x1b,0x82,0x35,0xd8,0x90,0x80,
+    0x41,0xe3,0x3c,0x50,0xa2,0x2c,0xd1,0x86,0xc4,0x6b,0xa4,0x07,0x4a,0x94,0x65,0xda,
+    0xa0,0x70,0x54,0x05,0x06,0x9e,0x95,0x5c,0x0b,0xb6,0x21,0x11,0x83,0xac,0x02,0x03,
+    0x2f,0xd1,0x96,0x6d,0x03,0xd1,0x06,0x6e,0xf0,0x06,0x70,0xb0,0x61,0x08,0x03,0x36,
+    0x88,0x03,0x8d,0x04,0x26,0xa8,0x11,0x1b,0x9b,0x5d,0x9b,0x4b,0xdb,0x1b,0x59,0x1d,
+    0x5b,0x99,0x8b,0x19,0x5b,0xd8,0xd9,0xdc,0x14,0x41,0x0c,0xc6,0xa0,0x0a,0x1b,0x9b,
+    0x5d,0x9b,0x4b,0x1a,0x59,0x99,0x1b,0xdd,0x94,0x80,0x0c,0xba,0x84,0xa5,0xc9,0xb9,
+    0xd8,0x95,0xc9,0xcd,0xa5,0xbd,0xb9,0x4d,0x09,0xca,0xa0,0x54,0x58,0x9a,0x9c,0x0b,
+    0x5b,0x98,0xdb,0x59,0x5d,0xd8,0x59,0xd9,0x97,0x5d,0x99,0xdc,0x5c,0xda,0x9b,0xdb,
+    0x94,0xc0,0x0c,0x3a,0x85,0xa5,0xc9,0xb9,0x8c,0xbd,0xb5,0xc1,0xa5,0xb1,0x95,0x7d,
+    0xbd,0xc1,0xd1,0xa5,0xbd,0xb9,0xcd,0x4d,0x19,0xce,0x00,0x0d,0xd2,0xa0,0x4c,0x58,
+    0x9a,0x9c,0x8b,0x99,0x5c,0xd8,0x59,0x5b,0x99,0x1b,0xdd,0x94,0x20,0x0e,0x00,0xa9,
+    0x18,0x00,0x00,0x25,0x00,0x00,0x00,0x0b,0x0a,0x72,0x28,0x87,0x77,0x80,0x07,0x7a,
+    0x58,0x70,0x98,0x43,0x3d,0xb8,0xc3,0x38,0xb0,0x43,0x39,0xd0,0xc3,0x82,0xe6,0x1c,
+    0xc6,0xa1,0x0d,0xe8,0x41,0x1e,0xc2,0xc1,0x1d,0xe6,0x21,0x1d,0xe8,0x21,0x1d,0xde,
+    0xc1,0x1d,0x16,0x34,0xe3,0x60,0x0e,0xe7,0x50,0x0f,0xe1,0x20,0x0f,0xe4,0x40,0x0f,
+    0xe1,0x20,0x0f,0xe7,0x50,0x0e,0xf4,0xb0,0x80,0x81,0x07,0x79,0x28,0x87,0x70,0x60,
+    0x07,0x76,0x78,0x87,0x71,0x08,0x07,0x7a,0x28,0x07,0x72,0x58,0x70,0x9c,0xc3,0x38,
+    0xb4,0x01,0x3b,0xa4,0x83,0x3d,0x94,0xc3,0x02,0x6b,0x1c,0xd8,0x21,0x1c,0xdc,0xe1,
+    0x1c,0xdc,0x20,0x1c,0xe4,0x61,0x1c,0xdc,0x20,0x1c,0xe8,0x81,0x1e,0xc2,0x61,0x1c,
+    0xd0,0xa1,0x1c,0xc8,0x61,0x1c,0xc2,0x81,0x1d,0xd8,0x61,0xc1,0x01,0x0f,0xf4,0x20,
+    0x0f,0xe1,0x50,0x0f,0xf4,0x80,0x0e,0x00,0x00,0x00,0x00,0x61,0x20,0x00,0x00,0x33,
+    0x00,0x00,0x00,0x13,0x04,0x41,0x2c,0x10,0x00,0x00,0x00,0x06,0x00,0x00,0x00,0xa4,
+    0x6a,0x60,0x04,0x80,0xd8,0x58,0x02,0x10,0x8c,0x00,0x10,0x18,0x01,0xa0,0x30,0x03,
+    0x40,0x62,0x06,0x00,0x00,0x00,0x00,0xf1,0x30,0x00,0x00,0x1c,0x00,0x00,0x00,0x22,
+    0x47,0xc8,0x90,0x51,0x0e,0xc4,0x2a,0x00,0x00,0x00,0x00,0x17,0x86,0x01,0x00,0x61,
+    0x69,0x72,0x2d,0x61,0x6c,0x69,0x61,0x73,0x2d,0x73,0x63,0x6f,0x70,0x65,0x73,0x28,
+    0x6d,0x61,0x69,0x6e,0x30,0x29,0x61,0x69,0x72,0x2d,0x61,0x6c,0x69,0x61,0x73,0x2d,
+    0x73,0x63,0x6f,0x70,0x65,0x2d,0x73,0x61,0x6d,0x70,0x6c,0x65,0x72,0x73,0x61,0x69,
+    0x72,0x2d,0x61,0x6c,0x69,0x61,0x73,0x2d,0x73,0x63,0x6f,0x70,0x65,0x2d,0x74,0x65,
+    0x78,0x74,0x75,0x72,0x65,0x73,0x00,0x2b,0x04,0x3b,0x98,0x83,0x15,0xc3,0x1d,0xd8,
+    0x01,0x1d,0xac,0x18,0xf0,0xc0,0x0e,0xea,0x60,0x83,0x80,0x07,0x77,0x00,0x00,0x83,
+    0x0c,0x8b,0x50,0x8c,0x18,0x34,0x43,0x08,0x82,0xc5,0xd7,0x4c,0x4a,0x12,0x20,0xc5,
+    0x41,0x3c,0x16,0x30,0xf2,0x99,0x6d,0x20,0x02,0x20,0x83,0x80,0x18,0x00,0x00,0x02,
+    0x00,0x00,0x00,0x5b,0x86,0xe0,0xc0,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x71,
+    0x20,0x00,0x00,0x0d,0x00,0x00,0x00,0x52,0x0e,0x10,0x22,0x64,0x82,0xa4,0x1c,0x20,
+    0x44,0xc8,0xe4,0x48,0x39,0x40,0x88,0x90,0xa1,0x05,0x6c,0x00,0x12,0xf9,0x12,0xc0,
+    0x3c,0x0b,0xf1,0x4f,0xc4,0x35,0x51,0x11,0xf1,0xdb,0x83,0x5f,0xe1,0xc5,0x6d,0x2b,
+    0x00,0x68,0x41,0xc1,0x00,0x48,0x43,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+};
+static const uint8_t _sgl_shd_compact_vs_source_metal_sim[717] = {
+    0x23,0x69,0x6e,0x63,0x6c,0x75,0x64,0x65,0x20,0x3c,0x6d,0x65,0x74,0x61,0x6c,0x5f,
+    0x73,0x74,0x64,0x6c,0x69,0x62,0x3e,0x0a,0x23,0x69,0x6e,0x63,0x6c,0x75,0x64,0x65,
+    0x20,0x3c,0x73,0x69,0x6d,0x64,0x2f,0x73,0x69,0x6d,0x64,0x2e,0x68,0x3e,0x0a,0x0a,
+    0x75,0x73,0x69,0x6e,0x67,0x20,0x6e,0x61,0x6d,0x65,0x73,0x70,0x61,0x63,0x65,0x20,
+    0x6d,0x65,0x74,0x61,0x6c,0x3b,0x0a,0x0a,0x73,0x74,0x72,0x75,0x63,0x74,0x20,0x76,
+    0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x66,
+    0x6c,0x6f,0x61,0x74,0x34,0x78,0x34,0x20,0x6d,0x76,0x70,0x3b,0x0a,0x20,0x20,0x20,
+    0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x78,0x34,0x20,0x74,0x6d,0x3b,0x0a,0x7d,0x3b,
+    0x0a,0x0a,0x73,0x74,0x72,0x75,0x63,0x74,0x20,0x6d,0x61,0x69,0x6e,0x30,0x5f,0x6f,
+    0x75,0x74,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,
+    0x75,0x76,0x20,0x5b,0x5b,0x75,0x73,0x65,0x72,0x28,0x6c,0x6f,0x63,0x6e,0x30,0x29,
+    0x5d,0x5d,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x63,
+    0x6f,0x6c,0x6f,0x72,0x20,0x5b,0x5b,0x75,0x73,0x65,0x72,0x28,0x6c,0x6f,0x63,0x6e,
+    0x31,0x29,0x5d,0x5d,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,
+    0x20,0x67,0x6c,0x5f,0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x20,0x5b,0x5b,0x70,
+    0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x5d,0x5d,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,
+    0x6c,0x6f,0x61,0x74,0x20,0x67,0x6c,0x5f,0x50,0x6f,0x69,0x6e,0x74,0x53,0x69,0x7a,
+    0x65,0x20,0x5b,0x5b,0x70,0x6f,0x69,0x6e,0x74,0x5f,0x73,0x69,0x7a,0x65,0x5d,0x5d,
+    0x3b,0x0a,0x7d,0x3b,0x0a,0x0a,0x73,0x74,0x72,0x75,0x63,0x74,0x20,0x6d,0x61,0x69,
+    0x6e,0x30,0x5f,0x69,0x6e,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,
+    0x74,0x34,0x20,0x70,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x20,0x5b,0x5b,0x61,0x74,
+    0x74,0x72,0x69,0x62,0x75,0x74,0x65,0x28,0x30,0x29,0x5d,0x5d,0x3b,0x0a,0x20,0x20,
+    0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x74,0x65,0x78,0x63,0x6f,0x6f,0x72,
+    0x64,0x30,0x20,0x5b,0x5b,0x61,0x74,0x74,0x72,0x69,0x62,0x75,0x74,0x65,0x28,0x31,
+    0x29,0x5d,0x5d,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,
+    0x63,0x6f,0x6c,0x6f,0x72,0x30,0x20,0x5b,0x5b,0x61,0x74,0x74,0x72,0x69,0x62,0x75,
+    0x74,0x65,0x28,0x32,0x29,0x5d,0x5d,0x3b,0x0a,0x7d,0x3b,0x0a,0x0a,0x76,0x65,0x72,
+    0x74,0x65,0x78,0x20,0x6d,0x61,0x69,0x6e,0x30,0x5f,0x6f,0x75,0x74,0x20,0x6d,0x61,
+    0x69,0x6e,0x30,0x28,0x6d,0x61,0x69,0x6e,0x30,0x5f,0x69,0x6e,0x20,0x69,0x6e,0x20,
+    0x5b,0x5b,0x73,0x74,0x61,0x67,0x65,0x5f,0x69,0x6e,0x5d,0x5d,0x2c,0x20,0x63,0x6f,
+    0x6e,0x73,0x74,0x61,0x6e,0x74,0x20,0x76,0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,
+    0x26,0x20,0x5f,0x31,0x39,0x20,0x5b,0x5b,0x62,0x75,0x66,0x66,0x65,0x72,0x28,0x30,
+    0x29,0x5d,0x5d,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x6d,0x61,0x69,0x6e,0x30,
+    0x5f,0x6f,0x75,0x74,0x20,0x6f,0x75,0x74,0x20,0x3d,0x20,0x7b,0x7d,0x3b,0x0a,0x20,
+    0x20,0x20,0x20,0x6f,0x75,0x74,0x2e,0x67,0x6c,0x5f,0x50,0x6f,0x73,0x69,0x74,0x69,
+    0x6f,0x6e,0x20,0x3d,0x20,0x5f,0x31,0x39,0x2e,0x6d,0x76,0x70,0x20,0x2a,0x20,0x69,
+    0x6e,0x2e,0x70,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x3b,0x0a,0x20,0x20,0x20,0x20,
+    0x6f,0x75,0x74,0x2e,0x67,0x6c,0x5f,0x50,0x6f,0x69,0x6e,0x74,0x53,0x69,0x7a,0x65,
+    0x20,0x3d,0x20,0x31,0x2e,0x30,0x3b,0x0a,0x20,0x20,0x20,0x20,0x6f,0x75,0x74,0x2e,
+    0x75,0x76,0x20,0x3d,0x20,0x5f,0x31,0x39,0x2e,0x74,0x6d,0x20,0x2a,0x20,0x66,0x6c,
+    0x6f,0x61,0x74,0x34,0x28,0x69,0x6e,0x2e,0x74,0x65,0x78,0x63,0x6f,0x6f,0x72,0x64,
+    0x30,0x2c,0x20,0x30,0x2e,0x30,0x2c,0x20,0x31,0x2e,0x30,0x29,0x3b,0x0a,0x20,0x20,
+    0x20,0x20,0x6f,0x75,0x74,0x2e,0x63,0x6f,0x6c,0x6f,0x72,0x20,0x3d,0x20,0x69,0x6e,
+    0x2e,0x63,0x6f,0x6c,0x6f,0x72,0x30,0x3b,0x0a,0x20,0x20,0x20,0x20,0x72,0x65,0x74,
+    0x75,0x72,0x6e,0x20,0x6f,0x75,0x74,0x3b,0x0a,0x7d,0x0a,0x0a,0x00,
+};
+static const uint8_t _sgl_shd_compact_fs_source_metal_sim[439] = {
+    0x23,0x69,0x6e,0x63,0x6c,0x75,0x64,0x65,0x20,0x3c,0x6d,0x65,0x74,0x61,0x6c,0x5f,
+    0x73,0x74,0x64,0x6c,0x69,0x62,0x3e,0x0a,0x23,0x69,0x6e,0x63,0x6c,0x75,0x64,0x65,
+    0x20,0x3c,0x73,0x69,0x6d,0x64,0x2f,0x73,0x69,0x6d,0x64,0x2e,0x68,0x3e,0x0a,0x0a,
+    0x75,0x73,0x69,0x6e,0x67,0x20,0x6e,0x61,0x6d,0x65,0x73,0x70,0x61,0x63,0x65,0x20,
+    0x6d,0x65,0x74,0x61,0x6c,0x3b,0x0a,0x0a,0x73,0x74,0x72,0x75,0x63,0x74,0x20,0x6d,
+    0x61,0x69,0x6e,0x30,0x5f,0x6f,0x75,0x74,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x66,
+    0x6c,0x6f,0x61,0x74,0x34,0x20,0x66,0x72,0x61,0x67,0x5f,0x63,0x6f,0x6c,0x6f,0x72,
+    0x20,0x5b,0x5b,0x63,0x6f,0x6c,0x6f,0x72,0x28,0x30,0x29,0x5d,0x5d,0x3b,0x0a,0x7d,
+    0x3b,0x0a,0x0a,0x73,0x74,0x72,0x75,0x63,0x74,0x20,0x6d,0x61,0x69,0x6e,0x30,0x5f,
+    0x69,0x6e,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,
+    0x75,0x76,0x20,0x5b,0x5b,0x75,0x73,0x65,0x72,0x28,0x6c,0x6f,0x63,0x6e,0x30,0x29,
+    0x5d,0x5d,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x63,
+    0x6f,0x6c,0x6f,0x72,0x20,0x5b,0x5b,0x75,0x73,0x65,0x72,0x28,0x6c,0x6f,0x63,0x6e,
+    0x31,0x29,0x5d,0x5d,0x3b,0x0a,0x7d,0x3b,0x0a,0x0a,0x66,0x72,0x61,0x67,0x6d,0x65,
+    0x6e,0x74,0x20,0x6d,0x61,0x69,0x6e,0x30,0x5f,0x6f,0x75,0x74,0x20,0x6d,0x61,0x69,
+    0x6e,0x30,0x28,0x6d,0x61,0x69,0x6e,0x30,0x5f,0x69,0x6e,0x20,0x69,0x6e,0x20,0x5b,
+    0x5b,0x73,0x74,0x61,0x67,0x65,0x5f,0x69,0x6e,0x5d,0x5d,0x2c,0x20,0x74,0x65,0x78,
+    0x74,0x75,0x72,0x65,0x32,0x64,0x3c,0x66,0x6c,0x6f,0x61,0x74,0x3e,0x20,0x74,0x65,
+    0x78,0x20,0x5b,0x5b,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x28,0x30,0x29,0x5d,0x5d,
+    0x2c,0x20,0x73,0x61,0x6d,0x70,0x6c,0x65,0x72,0x20,0x73,0x6d,0x70,0x20,0x5b,0x5b,
+    0x73,0x61,0x6d,0x70,0x6c,0x65,0x72,0x28,0x30,0x29,0x5d,0x5d,0x29,0x0a,0x7b,0x0a,
+    0x20,0x20,0x20,0x20,0x6d,0x61,0x69,0x6e,0x30,0x5f,0x6f,0x75,0x74,0x20,0x6f,0x75,
+    0x74,0x20,0x3d,0x20,0x7b,0x7d,0x3b,0x0a,0x20,0x20,0x20,0x20,0x6f,0x75,0x74,0x2e,
+    0x66,0x72,0x61,0x67,0x5f,0x63,0x6f,0x6c,0x6f,0x72,0x20,0x3d,0x20,0x74,0x65,0x78,
+    0x2e,0x73,0x61,0x6d,0x70,0x6c,0x65,0x28,0x73,0x6d,0x70,0x2c,0x20,0x69,0x6e,0x2e,
+    0x75,0x76,0x2e,0x78,0x79,0x29,0x20,0x2a,0x20,0x69,0x6e,0x2e,0x63,0x6f,0x6c,0x6f,
+    0x72,0x3b,0x0a,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x6f,0x75,
+    0x74,0x3b,0x0a,0x7d,0x0a,0x0a,0x00,
+};
+#elif defined(SOKOL_D3D11)
+static const uint8_t _sgl_shd_compact_vs_source_hlsl4[1070] = {
+    0x63,0x62,0x75,0x66,0x66,0x65,0x72,0x20,0x76,0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,
+    0x73,0x20,0x3a,0x20,0x72,0x65,0x67,0x69,0x73,0x74,0x65,0x72,0x28,0x62,0x30,0x29,
+    0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x72,0x6f,0x77,0x5f,0x6d,0x61,0x6a,0x6f,0x72,
+    0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x78,0x34,0x20,0x5f,0x31,0x39,0x5f,0x6d,0x76,
+    0x70,0x20,0x3a,0x20,0x70,0x61,0x63,0x6b,0x6f,0x66,0x66,0x73,0x65,0x74,0x28,0x63,
+    0x30,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x72,0x6f,0x77,0x5f,0x6d,0x61,0x6a,0x6f,
+    0x72,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x78,0x34,0x20,0x5f,0x31,0x39,0x5f,0x74,
+    0x6d,0x20,0x3a,0x20,0x70,0x61,0x63,0x6b,0x6f,0x66,0x66,0x73,0x65,0x74,0x28,0x63,
+    0x34,0x29,0x3b,0x0a,0x7d,0x3b,0x0a,0x0a,0x0a,0x73,0x74,0x61,0x74,0x69,0x63,0x20,
+    0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x67,0x6c,0x5f,0x50,0x6f,0x73,0x69,0x74,0x69,
+    0x6f,0x6e,0x3b,0x0a,0x73,0x74,0x61,0x74,0x69,0x63,0x20,0x66,0x6c,0x6f,0x61,0x74,
+    0x20,0x67,0x6c,0x5f,0x50,0x6f,0x69,0x6e,0x74,0x53,0x69,0x7a,0x65,0x3b,0x0a,0x73,
+    0x74,0x61,0x74,0x69,0x63,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x70,0x6f,0x73,
+    0x69,0x74,0x69,0x6f,0x6e,0x3b,0x0a,0x73,0x74,0x61,0x74,0x69,0x63,0x20,0x66,0x6c,
+    0x6f,0x61,0x74,0x34,0x20,0x75,0x76,0x3b,0x0a,0x73,0x74,0x61,0x74,0x69,0x63,0x20,
+    0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x74,0x65,0x78,0x63,0x6f,0x6f,0x72,0x64,0x30,
+    0x3b,0x0a,0x73,0x74,0x61,0x74,0x69,0x63,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,
+    0x63,0x6f,0x6c,0x6f,0x72,0x3b,0x0a,0x73,0x74,0x61,0x74,0x69,0x63,0x20,0x66,0x6c,
+    0x6f,0x61,0x74,0x34,0x20,0x63,0x6f,0x6c,0x6f,0x72,0x30,0x3b,0x0a,0x0a,0x73,0x74,
+    0x72,0x75,0x63,0x74,0x20,0x53,0x50,0x49,0x52,0x56,0x5f,0x43,0x72,0x6f,0x73,0x73,
+    0x5f,0x49,0x6e,0x70,0x75,0x74,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,
+    0x61,0x74,0x34,0x20,0x70,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x20,0x3a,0x20,0x54,
+    0x45,0x58,0x43,0x4f,0x4f,0x52,0x44,0x30,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,
+    0x6f,0x61,0x74,0x32,0x20,0x74,0x65,0x78,0x63,0x6f,0x6f,0x72,0x64,0x30,0x20,0x3a,
+    0x20,0x54,0x45,0x58,0x43,0x4f,0x4f,0x52,0x44,0x31,0x3b,0x0a,0x20,0x20,0x20,0x20,
+    0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x63,0x6f,0x6c,0x6f,0x72,0x30,0x20,0x3a,0x20,
+    0x54,0x45,0x58,0x43,0x4f,0x4f,0x52,0x44,0x32,0x3b,0x0a,0x7d,0x3b,0x0a,0x0a,0x73,
+    0x74,0x72,0x75,0x63,0x74,0x20,0x53,0x50,0x49,0x52,0x56,0x5f,0x43,0x72,0x6f,0x73,
+    0x73,0x5f,0x4f,0x75,0x74,0x70,0x75,0x74,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x66,
+    0x6c,0x6f,0x61,0x74,0x34,0x20,0x75,0x76,0x20,0x3a,0x20,0x54,0x45,0x58,0x43,0x4f,
+    0x4f,0x52,0x44,0x30,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,
+    0x20,0x63,0x6f,0x6c,0x6f,0x72,0x20,0x3a,0x20,0x54,0x45,0x58,0x43,0x4f,0x4f,0x52,
+    0x44,0x31,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x67,
+    0x6c,0x5f,0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x20,0x3a,0x20,0x53,0x56,0x5f,
+    0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x3b,0x0a,0x7d,0x3b,0x0a,0x0a,0x76,0x6f,
+    0x69,0x64,0x20,0x76,0x65,0x72,0x74,0x5f,0x6d,0x61,0x69,0x6e,0x28,0x29,0x0a,0x7b,
+    0x0a,0x20,0x20,0x20,0x20,0x67,0x6c,0x5f,0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,
+    0x20,0x3d,0x20,0x6d,0x75,0x6c,0x28,0x70,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x2c,
+    0x20,0x5f,0x31,0x39,0x5f,0x6d,0x76,0x70,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x67,
+    0x6c,0x5f,0x50,0x6f,0x69,0x6e,0x74,0x53,0x69,0x7a,0x65,0x20,0x3d,0x20,0x31,0x2e,
+    0x30,0x66,0x3b,0x0a,0x20,0x20,0x20,0x20,0x75,0x76,0x20,0x3d,0x20,0x6d,0x75,0x6c,
+    0x28,0x66,0x6c,0x6f,0x61,0x74,0x34,0x28,0x74,0x65,0x78,0x63,0x6f,0x6f,0x72,0x64,
+    0x30,0x2c,0x20,0x30,0x2e,0x30,0x66,0x2c,0x20,0x31,0x2e,0x30,0x66,0x29,0x2c,0x20,
+    0x5f,0x31,0x39,0x5f,0x74,0x6d,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x63,0x6f,0x6c,
+    0x6f,0x72,0x20,0x3d,0x20,0x63,0x6f,0x6c,0x6f,0x72,0x30,0x3b,0x0a,0x7d,0x0a,0x0a,
+    0x53,0x50,0x49,0x52,0x56,0x5f,0x43,0x72,0x6f,0x73,0x73,0x5f,0x4f,0x75,0x74,0x70,
+    0x75,0x74,0x20,0x6d,0x61,0x69,0x6e,0x28,0x53,0x50,0x49,0x52,0x56,0x5f,0x43,0x72,
+    0x6f,0x73,0x73,0x5f,0x49,0x6e,0x70,0x75,0x74,0x20,0x73,0x74,0x61,0x67,0x65,0x5f,
+    0x69,0x6e,0x70,0x75,0x74,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x70,0x6f,0x73,
+    0x69,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x73,0x74,0x61,0x67,0x65,0x5f,0x69,0x6e,
+    0x70,0x75,0x74,0x2e,0x70,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x3b,0x0a,0x20,0x20,
+    0x20,0x20,0x74,0x65,0x78,0x63,0x6f,0x6f,0x72,0x64,0x30,0x20,0x3d,0x20,0x73,0x74,
+    0x61,0x67,0x65,0x5f,0x69,0x6e,0x70,0x75,0x74,0x2e,0x74,0x65,0x78,0x63,0x6f,0x6f,
+    0x72,0x64,0x30,0x3b,0x0a,0x20,0x20,0x20,0x20,0x63,0x6f,0x6c,0x6f,0x72,0x30,0x20,
+    0x3d,0x20,0x73,0x74,0x61,0x67,0x65,0x5f,0x69,0x6e,0x70,0x75,0x74,0x2e,0x63,0x6f,
+    0x6c,0x6f,0x72,0x30,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x65,0x72,0x74,0x5f,0x6d,
+    0x61,0x69,0x6e,0x28,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x53,0x50,0x49,0x52,0x56,
+    0x5f,0x43,0x72,0x6f,0x73,0x73,0x5f,0x4f,0x75,0x74,0x70,0x75,0x74,0x20,0x73,0x74,
+    0x61,0x67,0x65,0x5f,0x6f,0x75,0x74,0x70,0x75,0x74,0x3b,0x0a,0x20,0x20,0x20,0x20,
+    0x73,0x74,0x61,0x67,0x65,0x5f,0x6f,0x75,0x74,0x70,0x75,0x74,0x2e,0x67,0x6c,0x5f,
+    0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x67,0x6c,0x5f,0x50,0x6f,
+    0x73,0x69,0x74,0x69,0x6f,0x6e,0x3b,0x0a,0x20,0x20,0x20,0x20,0x73,0x74,0x61,0x67,
+    0x65,0x5f,0x6f,0x75,0x74,0x70,0x75,0x74,0x2e,0x75,0x76,0x20,0x3d,0x20,0x75,0x76,
+    0x3b,0x0a,0x20,0x20,0x20,0x20,0x73,0x74,0x61,0x67,0x65,0x5f,0x6f,0x75,0x74,0x70,
+    0x75,0x74,0x2e,0x63,0x6f,0x6c,0x6f,0x72,0x20,0x3d,0x20,0x63,0x6f,0x6c,0x6f,0x72,
+    0x3b,0x0a,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x73,0x74,0x61,
+    0x67,0x65,0x5f,0x6f,0x75,0x74,0x70,0x75,0x74,0x3b,0x0a,0x7d,0x0a,0x00,
+};
+static const uint8_t _sgl_shd_compact_fs_bytecode_hlsl4[608] = {
+    0x44,0x58,0x42,0x43,0xc8,0x9b,0x66,0x64,0x80,0x2f,0xbe,0x14,0xd9,0x88,0xa0,0x97,
+    0x64,0x14,0x66,0xff,0x01,0x00,0x00,0x00,0x60,0x02,0x00,0x00,0x05,0x00,0x00,0x00,
+    0x34,0x00,0x00,0x00,0xc8,0x00,0x00,0x00,0x14,0x01,0x00,0x00,0x48,0x01,0x00,0x00,
+    0xe4,0x01,0x00,0x00,0x52,0x44,0x45,0x46,0x8c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x1c,0x00,0x00,0x00,0x00,0x04,0xff,0xff,
+    0x10,0x81,0x00,0x00,0x64,0x00,0x00,0x00,0x5c,0x00,0x00,0x00,0x03,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x01,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x60,0x00,0x00,0x00,0x02,0x00,0x00,0x00,
+    0x05,0x00,0x00,0x00,0x04,0x00,0x00,0x00,0xff,0xff,0xff,0xff,0x00,0x00,0x00,0x00,
+    0x01,0x00,0x00,0x00,0x0d,0x00,0x00,0x00,0x73,0x6d,0x70,0x00,0x74,0x65,0x78,0x00,
+    0x4d,0x69,0x63,0x72,0x6f,0x73,0x6f,0x66,0x74,0x20,0x28,0x52,0x29,0x20,0x48,0x4c,
+    0x53,0x4c,0x20,0x53,0x68,0x61,0x64,0x65,0x72,0x20,0x43,0x6f,0x6d,0x70,0x69,0x6c,
+    0x65,0x72,0x20,0x31,0x30,0x2e,0x31,0x00,0x49,0x53,0x47,0x4e,0x44,0x00,0x00,0x00,
+    0x02,0x00,0x00,0x00,0x08,0x00,0x00,0x00,0x38,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0f,0x03,0x00,0x00,
+    0x38,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x00,0x00,
+    0x01,0x00,0x00,0x00,0x0f,0x0f,0x00,0x00,0x54,0x45,0x58,0x43,0x4f,0x4f,0x52,0x44,
+    0x00,0xab,0xab,0xab,0x4f,0x53,0x47,0x4e,0x2c,0x00,0x00,0x00,0x01,0x00,0x00,0x00,
+    0x08,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0f,0x00,0x00,0x00,0x53,0x56,0x5f,0x54,
+    0x61,0x72,0x67,0x65,0x74,0x00,0xab,0xab,0x53,0x48,0x44,0x52,0x94,0x00,0x00,0x00,
+    0x40,0x00,0x00,0x00,0x25,0x00,0x00,0x00,0x5a,0x00,0x00,0x03,0x00,0x60,0x10,0x00,
+    0x00,0x00,0x00,0x00,0x58,0x18,0x00,0x04,0x00,0x70,0x10,0x00,0x00,0x00,0x00,0x00,
+    0x55,0x55,0x00,0x00,0x62,0x10,0x00,0x03,0x32,0x10,0x10,0x00,0x00,0x00,0x00,0x00,
+    0x62,0x10,0x00,0x03,0xf2,0x10,0x10,0x00,0x01,0x00,0x00,0x00,0x65,0x00,0x00,0x03,
+    0xf2,0x20,0x10,0x00,0x00,0x00,0x00,0x00,0x68,0x00,0x00,0x02,0x01,0x00,0x00,0x00,
+    0x45,0x00,0x00,0x09,0xf2,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x46,0x10,0x10,0x00,
+    0x00,0x00,0x00,0x00,0x46,0x7e,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x60,0x10,0x00,
+    0x00,0x00,0x00,0x00,0x38,0x00,0x00,0x07,0xf2,0x20,0x10,0x00,0x00,0x00,0x00,0x00,
+    0x46,0x0e,0x10,0x00,0x00,0x00,0x00,0x00,0x46,0x1e,0x10,0x00,0x01,0x00,0x00,0x00,
+    0x3e,0x00,0x00,0x01,0x53,0x54,0x41,0x54,0x74,0x00,0x00,0x00,0x03,0x00,0x00,0x00,
+    0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x00,0x00,0x01,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+};
+#elif defined(SOKOL_WGPU)
+static const uint8_t _sgl_shd_compact_vs_source_wgsl[945] = {
+    0x64,0x69,0x61,0x67,0x6e,0x6f,0x73,0x74,0x69,0x63,0x28,0x6f,0x66,0x66,0x2c,0x20,
+    0x64,0x65,0x72,0x69,0x76,0x61,0x74,0x69,0x76,0x65,0x5f,0x75,0x6e,0x69,0x66,0x6f,
+    0x72,0x6d,0x69,0x74,0x79,0x29,0x3b,0x0a,0x0a,0x73,0x74,0x72,0x75,0x63,0x74,0x20,
+    0x76,0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x20,0x7b,0x0a,0x20,0x20,0x2f,0x2a,
+    0x20,0x40,0x6f,0x66,0x66,0x73,0x65,0x74,0x28,0x30,0x29,0x20,0x2a,0x2f,0x0a,0x20,
+    0x20,0x6d,0x76,0x70,0x20,0x3a,0x20,0x6d,0x61,0x74,0x34,0x78,0x34,0x66,0x2c,0x0a,
+    0x20,0x20,0x2f,0x2a,0x20,0x40,0x6f,0x66,0x66,0x73,0x65,0x74,0x28,0x36,0x34,0x29,
+    0x20,0x2a,0x2f,0x0a,0x20,0x20,0x74,0x6d,0x20,0x3a,0x20,0x6d,0x61,0x74,0x34,0x78,
+    0x34,0x66,0x2c,0x0a,0x7d,0x0a,0x0a,0x40,0x62,0x69,0x6e,0x64,0x69,0x6e,0x67,0x28,
+    0x30,0x29,0x20,0x40,0x67,0x72,0x6f,0x75,0x70,0x28,0x30,0x29,0x20,0x76,0x61,0x72,
+    0x3c,0x75,0x6e,0x69,0x66,0x6f,0x72,0x6d,0x3e,0x20,0x78,0x5f,0x31,0x39,0x20,0x3a,
+    0x20,0x76,0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x3b,0x0a,0x0a,0x76,0x61,0x72,
+    0x3c,0x70,0x72,0x69,0x76,0x61,0x74,0x65,0x3e,0x20,0x70,0x6f,0x73,0x69,0x74,0x69,
+    0x6f,0x6e,0x5f,0x31,0x20,0x3a,0x20,0x76,0x65,0x63,0x34,0x66,0x3b,0x0a,0x0a,0x76,
+    0x61,0x72,0x3c,0x70,0x72,0x69,0x76,0x61,0x74,0x65,0x3e,0x20,0x75,0x76,0x20,0x3a,
+    0x20,0x76,0x65,0x63,0x34,0x66,0x3b,0x0a,0x0a,0x76,0x61,0x72,0x3c,0x70,0x72,0x69,
+    0x76,0x61,0x74,0x65,0x3e,0x20,0x74,0x65,0x78,0x63,0x6f,0x6f,0x72,0x64,0x30,0x20,
+    0x3a,0x20,0x76,0x65,0x63,0x32,0x66,0x3b,0x0a,0x0a,0x76,0x61,0x72,0x3c,0x70,0x72,
+    0x69,0x76,0x61,0x74,0x65,0x3e,0x20,0x63,0x6f,0x6c,0x6f,0x72,0x20,0x3a,0x20,0x76,
+    0x65,0x63,0x34,0x66,0x3b,0x0a,0x0a,0x76,0x61,0x72,0x3c,0x70,0x72,0x69,0x76,0x61,
+    0x74,0x65,0x3e,0x20,0x63,0x6f,0x6c,0x6f,0x72,0x30,0x20,0x3a,0x20,0x76,0x65,0x63,
+    0x34,0x66,0x3b,0x0a,0x0a,0x76,0x61,0x72,0x3c,0x70,0x72,0x69,0x76,0x61,0x74,0x65,
+    0x3e,0x20,0x67,0x6c,0x5f,0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x20,0x3a,0x20,
+    0x76,0x65,0x63,0x34,0x66,0x3b,0x0a,0x0a,0x66,0x6e,0x20,0x6d,0x61,0x69,0x6e,0x5f,
+    0x31,0x28,0x29,0x20,0x7b,0x0a,0x20,0x20,0x67,0x6c,0x5f,0x50,0x6f,0x73,0x69,0x74,
+    0x69,0x6f,0x6e,0x20,0x3d,0x20,0x28,0x78,0x5f,0x31,0x39,0x2e,0x6d,0x76,0x70,0x20,
+    0x2a,0x20,0x70,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x5f,0x31,0x29,0x3b,0x0a,0x20,
+    0x20,0x75,0x76,0x20,0x3d,0x20,0x28,0x78,0x5f,0x31,0x39,0x2e,0x74,0x6d,0x20,0x2a,
+    0x20,0x76,0x65,0x63,0x34,0x66,0x28,0x74,0x65,0x78,0x63,0x6f,0x6f,0x72,0x64,0x30,
+    0x2e,0x78,0x2c,0x20,0x74,0x65,0x78,0x63,0x6f,0x6f,0x72,0x64,0x30,0x2e,0x79,0x2c,
+    0x20,0x30,0x2e,0x30,0x66,0x2c,0x20,0x31,0x2e,0x30,0x66,0x29,0x29,0x3b,0x0a,0x20,
+    0x20,0x63,0x6f,0x6c,0x6f,0x72,0x20,0x3d,0x20,0x63,0x6f,0x6c,0x6f,0x72,0x30,0x3b,
+    0x0a,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x3b,0x0a,0x7d,0x0a,0x0a,0x73,0x74,
+    0x72,0x75,0x63,0x74,0x20,0x6d,0x61,0x69,0x6e,0x5f,0x6f,0x75,0x74,0x20,0x7b,0x0a,
+    0x20,0x20,0x40,0x62,0x75,0x69,0x6c,0x74,0x69,0x6e,0x28,0x70,0x6f,0x73,0x69,0x74,
+    0x69,0x6f,0x6e,0x29,0x0a,0x20,0x20,0x67,0x6c,0x5f,0x50,0x6f,0x73,0x69,0x74,0x69,
+    0x6f,0x6e,0x20,0x3a,0x20,0x76,0x65,0x63,0x34,0x66,0x2c,0x0a,0x20,0x20,0x40,0x6c,
+    0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x28,0x30,0x29,0x0a,0x20,0x20,0x75,0x76,0x5f,
+    0x31,0x20,0x3a,0x20,0x76,0x65,0x63,0x34,0x66,0x2c,0x0a,0x20,0x20,0x40,0x6c,0x6f,
+    0x63,0x61,0x74,0x69,0x6f,0x6e,0x28,0x31,0x29,0x0a,0x20,0x20,0x63,0x6f,0x6c,0x6f,
+    0x72,0x5f,0x31,0x20,0x3a,0x20,0x76,0x65,0x63,0x34,0x66,0x2c,0x0a,0x7d,0x0a,0x0a,
+    0x40,0x76,0x65,0x72,0x74,0x65,0x78,0x0a,0x66,0x6e,0x20,0x6d,0x61,0x69,0x6e,0x28,
+    0x40,0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x28,0x30,0x29,0x20,0x70,0x6f,0x73,
+    0x69,0x74,0x69,0x6f,0x6e,0x5f,0x31,0x5f,0x70,0x61,0x72,0x61,0x6d,0x20,0x3a,0x20,
+    0x76,0x65,0x63,0x34,0x66,0x2c,0x20,0x40,0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,
+    0x28,0x31,0x29,0x20,0x74,0x65,0x78,0x63,0x6f,0x6f,0x72,0x64,0x30,0x5f,0x70,0x61,
+    0x72,0x61,0x6d,0x20,0x3a,0x20,0x76,0x65,0x63,0x32,0x66,0x2c,0x20,0x40,0x6c,0x6f,
+    0x63,0x61,0x74,0x69,0x6f,0x6e,0x28,0x32,0x29,0x20,0x63,0x6f,0x6c,0x6f,0x72,0x30,
+    0x5f,0x70,0x61,0x72,0x61,0x6d,0x20,0x3a,0x20,0x76,0x65,0x63,0x34,0x66,0x29,0x20,
+    0x2d,0x3e,0x20,0x6d,0x61,0x69,0x6e,0x5f,0x6f,0x75,0x74,0x20,0x7b,0x0a,0x20,0x20,
+    0x70,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x5f,0x31,0x20,0x3d,0x20,0x70,0x6f,0x73,
+    0x69,0x74,0x69,0x6f,0x6e,0x5f,0x31,0x5f,0x70,0x61,0x72,0x61,0x6d,0x3b,0x0a,0x20,
+    0x20,0x74,0x65,0x78,0x63,0x6f,0x6f,0x72,0x64,0x30,0x20,0x3d,0x20,0x74,0x65,0x78,
+    0x63,0x6f,0x6f,0x72,0x64,0x30,0x5f,0x70,0x61,0x72,0x61,0x6d,0x3b,0x0a,0x20,0x20,
+    0x63,0x6f,0x6c,0x6f,0x72,0x30,0x20,0x3d,0x20,0x63,0x6f,0x6c,0x6f,0x72,0x30,0x5f,
+    0x70,0x61,0x72,0x61,0x6d,0x3b,0x0a,0x20,0x20,0x6d,0x61,0x69,0x6e,0x5f,0x31,0x28,
+    0x29,0x3b,0x0a,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x6d,0x61,0x69,0x6e,
+    0x5f,0x6f,0x75,0x74,0x28,0x67,0x6c,0x5f,0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,
+    0x2c,0x20,0x75,0x76,0x2c,0x20,0x63,0x6f,0x6c,0x6f,0x72,0x29,0x3b,0x0a,0x7d,0x0a,
+    0x00,
+};
+static const uint8_t _sgl_shd_compact_fs_source_wgsl[588] = {
+    0x64,0x69,0x61,0x67,0x6e,0x6f,0x73,0x74,0x69,0x63,0x28,0x6f,0x66,0x66,0x2c,0x20,
+    0x64,0x65,0x72,0x69,0x76,0x61,0x74,0x69,0x76,0x65,0x5f,0x75,0x6e,0x69,0x66,0x6f,
+    0x72,0x6d,0x69,0x74,0x79,0x29,0x3b,0x0a,0x0a,0x76,0x61,0x72,0x3c,0x70,0x72,0x69,
+    0x76,0x61,0x74,0x65,0x3e,0x20,0x66,0x72,0x61,0x67,0x5f,0x63,0x6f,0x6c,0x6f,0x72,
+    0x20,0x3a,0x20,0x76,0x65,0x63,0x34,0x66,0x3b,0x0a,0x0a,0x40,0x62,0x69,0x6e,0x64,
+    0x69,0x6e,0x67,0x28,0x30,0x29,0x20,0x40,0x67,0x72,0x6f,0x75,0x70,0x28,0x31,0x29,
+    0x20,0x76,0x61,0x72,0x20,0x74,0x65,0x78,0x20,0x3a,0x20,0x74,0x65,0x78,0x74,0x75,
+    0x72,0x65,0x5f,0x32,0x64,0x3c,0x66,0x33,0x32,0x3e,0x3b,0x0a,0x0a,0x40,0x62,0x69,
+    0x6e,0x64,0x69,0x6e,0x67,0x28,0x33,0x32,0x29,0x20,0x40,0x67,0x72,0x6f,0x75,0x70,
+    0x28,0x31,0x29,0x20,0x76,0x61,0x72,0x20,0x73,0x6d,0x70,0x20,0x3a,0x20,0x73,0x61,
+    0x6d,0x70,0x6c,0x65,0x72,0x3b,0x0a,0x0a,0x76,0x61,0x72,0x3c,0x70,0x72,0x69,0x76,
+    0x61,0x74,0x65,0x3e,0x20,0x75,0x76,0x20,0x3a,0x20,0x76,0x65,0x63,0x34,0x66,0x3b,
+    0x0a,0x0a,0x76,0x61,0x72,0x3c,0x70,0x72,0x69,0x76,0x61,0x74,0x65,0x3e,0x20,0x63,
+    0x6f,0x6c,0x6f,0x72,0x20,0x3a,0x20,0x76,0x65,0x63,0x34,0x66,0x3b,0x0a,0x0a,0x66,
+    0x6e,0x20,0x6d,0x61,0x69,0x6e,0x5f,0x31,0x28,0x29,0x20,0x7b,0x0a,0x20,0x20,0x6c,
+    0x65,0x74,0x20,0x78,0x5f,0x32,0x33,0x20,0x3d,0x20,0x75,0x76,0x3b,0x0a,0x20,0x20,
+    0x6c,0x65,0x74,0x20,0x78,0x5f,0x32,0x35,0x20,0x3d,0x20,0x74,0x65,0x78,0x74,0x75,
+    0x72,0x65,0x53,0x61,0x6d,0x70,0x6c,0x65,0x28,0x74,0x65,0x78,0x2c,0x20,0x73,0x6d,
+    0x70,0x2c,0x20,0x78,0x5f,0x32,0x33,0x2e,0x78,0x79,0x29,0x3b,0x0a,0x20,0x20,0x66,
+    0x72,0x61,0x67,0x5f,0x63,0x6f,0x6c,0x6f,0x72,0x20,0x3d,0x20,0x28,0x78,0x5f,0x32,
+    0x35,0x20,0x2a,0x20,0x63,0x6f,0x6c,0x6f,0x72,0x29,0x3b,0x0a,0x20,0x20,0x72,0x65,
+    0x74,0x75,0x72,0x6e,0x3b,0x0a,0x7d,0x0a,0x0a,0x73,0x74,0x72,0x75,0x63,0x74,0x20,
+    0x6d,0x61,0x69,0x6e,0x5f,0x6f,0x75,0x74,0x20,0x7b,0x0a,0x20,0x20,0x40,0x6c,0x6f,
+    0x63,0x61,0x74,0x69,0x6f,0x6e,0x28,0x30,0x29,0x0a,0x20,0x20,0x66,0x72,0x61,0x67,
+    0x5f,0x63,0x6f,0x6c,0x6f,0x72,0x5f,0x31,0x20,0x3a,0x20,0x76,0x65,0x63,0x34,0x66,
+    0x2c,0x0a,0x7d,0x0a,0x0a,0x40,0x66,0x72,0x61,0x67,0x6d,0x65,0x6e,0x74,0x0a,0x66,
+    0x6e,0x20,0x6d,0x61,0x69,0x6e,0x28,0x40,0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,
+    0x28,0x30,0x29,0x20,0x75,0x76,0x5f,0x70,0x61,0x72,0x61,0x6d,0x20,0x3a,0x20,0x76,
+    0x65,0x63,0x34,0x66,0x2c,0x20,0x40,0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x28,
+    0x31,0x29,0x20,0x63,0x6f,0x6c,0x6f,0x72,0x5f,0x70,0x61,0x72,0x61,0x6d,0x20,0x3a,
+    0x20,0x76,0x65,0x63,0x34,0x66,0x29,0x20,0x2d,0x3e,0x20,0x6d,0x61,0x69,0x6e,0x5f,
+    0x6f,0x75,0x74,0x20,0x7b,0x0a,0x20,0x20,0x75,0x76,0x20,0x3d,0x20,0x75,0x76,0x5f,
+    0x70,0x61,0x72,0x61,0x6d,0x3b,0x0a,0x20,0x20,0x63,0x6f,0x6c,0x6f,0x72,0x20,0x3d,
+    0x20,0x63,0x6f,0x6c,0x6f,0x72,0x5f,0x70,0x61,0x72,0x61,0x6d,0x3b,0x0a,0x20,0x20,
+    0x6d,0x61,0x69,0x6e,0x5f,0x31,0x28,0x29,0x3b,0x0a,0x20,0x20,0x72,0x65,0x74,0x75,
+    0x72,0x6e,0x20,0x6d,0x61,0x69,0x6e,0x5f,0x6f,0x75,0x74,0x28,0x66,0x72,0x61,0x67,
+    0x5f,0x63,0x6f,0x6c,0x6f,0x72,0x29,0x3b,0x0a,0x7d,0x0a,0x00,
+};
+#elif defined(SOKOL_VULKAN)
+static const uint8_t _sgl_shd_compact_vs_bytecode_spirv_vk[1584] = {
+    0x03,0x02,0x23,0x07,0x00,0x04,0x01,0x00,0x0b,0x00,0x08,0x00,0x33,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x11,0x00,0x02,0x00,0x01,0x00,0x00,0x00,0x0b,0x00,0x06,0x00,
+    0x01,0x00,0x00,0x00,0x47,0x4c,0x53,0x4c,0x2e,0x73,0x74,0x64,0x2e,0x34,0x35,0x30,
+    0x00,0x00,0x00,0x00,0x0e,0x00,0x03,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00,
+    0x0f,0x00,0x0c,0x00,0x00,0x00,0x00,0x00,0x04,0x00,0x00,0x00,0x6d,0x61,0x69,0x6e,
+    0x00,0x00,0x00,0x00,0x0d,0x00,0x00,0x00,0x13,0x00,0x00,0x00,0x18,0x00,0x00,0x00,
+    0x23,0x00,0x00,0x00,0x28,0x00,0x00,0x00,0x30,0x00,0x00,0x00,0x31,0x00,0x00,0x00,
+    0x03,0x00,0x03,0x00,0x02,0x00,0x00,0x00,0xcc,0x01,0x00,0x00,0x05,0x00,0x04,0x00,
+    0x04,0x00,0x00,0x00,0x6d,0x61,0x69,0x6e,0x00,0x00,0x00,0x00,0x05,0x00,0x06,0x00,
+    0x0b,0x00,0x00,0x00,0x67,0x6c,0x5f,0x50,0x65,0x72,0x56,0x65,0x72,0x74,0x65,0x78,
+    0x00,0x00,0x00,0x00,0x06,0x00,0x06,0x00,0x0b,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x67,0x6c,0x5f,0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x00,0x06,0x00,0x07,0x00,
+    0x0b,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x67,0x6c,0x5f,0x50,0x6f,0x69,0x6e,0x74,
+    0x53,0x69,0x7a,0x65,0x00,0x00,0x00,0x00,0x06,0x00,0x07,0x00,0x0b,0x00,0x00,0x00,
+    0x02,0x00,0x00,0x00,0x67,0x6c,0x5f,0x43,0x6c,0x69,0x70,0x44,0x69,0x73,0x74,0x61,
+    0x6e,0x63,0x65,0x00,0x06,0x00,0x07,0x00,0x0b,0x00,0x00,0x00,0x03,0x00,0x00,0x00,
+    0x67,0x6c,0x5f,0x43,0x75,0x6c,0x6c,0x44,0x69,0x73,0x74,0x61,0x6e,0x63,0x65,0x00,
+    0x05,0x00,0x03,0x00,0x0d,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x05,0x00,0x05,0x00,
+    0x11,0x00,0x00,0x00,0x76,0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x00,0x00,0x00,
+    0x06,0x00,0x04,0x00,0x11,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x6d,0x76,0x70,0x00,
+    0x06,0x00,0x04,0x00,0x11,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x74,0x6d,0x00,0x00,
+    0x05,0x00,0x03,0x00,0x13,0x00,0x00,0x00,0x5f,0x31,0x39,0x00,0x05,0x00,0x05,0x00,
+    0x18,0x00,0x00,0x00,0x70,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x00,0x00,0x00,0x00,
+    0x05,0x00,0x03,0x00,0x23,0x00,0x00,0x00,0x75,0x76,0x00,0x00,0x05,0x00,0x05,0x00,
+    0x28,0x00,0x00,0x00,0x74,0x65,0x78,0x63,0x6f,0x6f,0x72,0x64,0x30,0x00,0x00,0x00,
+    0x05,0x00,0x04,0x00,0x30,0x00,0x00,0x00,0x63,0x6f,0x6c,0x6f,0x72,0x00,0x00,0x00,
+    0x05,0x00,0x04,0x00,0x31,0x00,0x00,0x00,0x63,0x6f,0x6c,0x6f,0x72,0x30,0x00,0x00,
+    0x47,0x00,0x03,0x00,0x0b,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x48,0x00,0x05,0x00,
+    0x0b,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0b,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x48,0x00,0x05,0x00,0x0b,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x0b,0x00,0x00,0x00,
+    0x01,0x00,0x00,0x00,0x48,0x00,0x05,0x00,0x0b,0x00,0x00,0x00,0x02,0x00,0x00,0x00,
+    0x0b,0x00,0x00,0x00,0x03,0x00,0x00,0x00,0x48,0x00,0x05,0x00,0x0b,0x00,0x00,0x00,
+    0x03,0x00,0x00,0x00,0x0b,0x00,0x00,0x00,0x04,0x00,0x00,0x00,0x47,0x00,0x03,0x00,
+    0x11,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x48,0x00,0x04,0x00,0x11,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x05,0x00,0x00,0x00,0x48,0x00,0x05,0x00,0x11,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x07,0x00,0x00,0x00,0x10,0x00,0x00,0x00,0x48,0x00,0x05,0x00,
+    0x11,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x23,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x48,0x00,0x04,0x00,0x11,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x05,0x00,0x00,0x00,
+    0x48,0x00,0x05,0x00,0x11,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x07,0x00,0x00,0x00,
+    0x10,0x00,0x00,0x00,0x48,0x00,0x05,0x00,0x11,0x00,0x00,0x00,0x01,0x00,0x00,0x00,
+    0x23,0x00,0x00,0x00,0x40,0x00,0x00,0x00,0x47,0x00,0x04,0x00,0x13,0x00,0x00,0x00,
+    0x21,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x47,0x00,0x04,0x00,0x13,0x00,0x00,0x00,
+    0x22,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x47,0x00,0x04,0x00,0x18,0x00,0x00,0x00,
+    0x1e,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x47,0x00,0x04,0x00,0x23,0x00,0x00,0x00,
+    0x1e,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x47,0x00,0x04,0x00,0x28,0x00,0x00,0x00,
+    0x1e,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x47,0x00,0x04,0x00,0x30,0x00,0x00,0x00,
+    0x1e,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x47,0x00,0x04,0x00,0x31,0x00,0x00,0x00,
+    0x1e,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x13,0x00,0x02,0x00,0x02,0x00,0x00,0x00,
+    0x21,0x00,0x03,0x00,0x03,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x16,0x00,0x03,0x00,
+    0x06,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x17,0x00,0x04,0x00,0x07,0x00,0x00,0x00,
+    0x06,0x00,0x00,0x00,0x04,0x00,0x00,0x00,0x15,0x00,0x04,0x00,0x08,0x00,0x00,0x00,
+    0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x2b,0x00,0x04,0x00,0x08,0x00,0x00,0x00,
+    0x09,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x1c,0x00,0x04,0x00,0x0a,0x00,0x00,0x00,
+    0x06,0x00,0x00,0x00,0x09,0x00,0x00,0x00,0x1e,0x00,0x06,0x00,0x0b,0x00,0x00,0x00,
+    0x07,0x00,0x00,0x00,0x06,0x00,0x00,0x00,0x0a,0x00,0x00,0x00,0x0a,0x00,0x00,0x00,
+    0x20,0x00,0x04,0x00,0x0c,0x00,0x00,0x00,0x03,0x00,0x00,0x00,0x0b,0x00,0x00,0x00,
+    0x3b,0x00,0x04,0x00,0x0c,0x00,0x00,0x00,0x0d,0x00,0x00,0x00,0x03,0x00,0x00,0x00,
+    0x15,0x00,0x04,0x00,0x0e,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x01,0x00,0x00,0x00,
+    0x2b,0x00,0x04,0x00,0x0e,0x00,0x00,0x00,0x0f,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x18,0x00,0x04,0x00,0x10,0x00,0x00,0x00,0x07,0x00,0x00,0x00,0x04,0x00,0x00,0x00,
+    0x1e,0x00,0x04,0x00,0x11,0x00,0x00,0x00,0x10,0x00,0x00,0x00,0x10,0x00,0x00,0x00,
+    0x20,0x00,0x04,0x00,0x12,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x11,0x00,0x00,0x00,
+    0x3b,0x00,0x04,0x00,0x12,0x00,0x00,0x00,0x13,0x00,0x00,0x00,0x02,0x00,0x00,0x00,
+    0x20,0x00,0x04,0x00,0x14,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x10,0x00,0x00,0x00,
+    0x20,0x00,0x04,0x00,0x17,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x07,0x00,0x00,0x00,
+    0x3b,0x00,0x04,0x00,0x17,0x00,0x00,0x00,0x18,0x00,0x00,0x00,0x01,0x00,0x00,0x00,
+    0x20,0x00,0x04,0x00,0x1b,0x00,0x00,0x00,0x03,0x00,0x00,0x00,0x07,0x00,0x00,0x00,
+    0x2b,0x00,0x04,0x00,0x0e,0x00,0x00,0x00,0x1d,0x00,0x00,0x00,0x01,0x00,0x00,0x00,
+    0x20,0x00,0x04,0x00,0x21,0x00,0x00,0x00,0x03,0x00,0x00,0x00,0x06,0x00,0x00,0x00,
+    0x3b,0x00,0x04,0x00,0x1b,0x00,0x00,0x00,0x23,0x00,0x00,0x00,0x03,0x00,0x00,0x00,
+    0x17,0x00,0x04,0x00,0x26,0x00,0x00,0x00,0x06,0x00,0x00,0x00,0x02,0x00,0x00,0x00,
+    0x20,0x00,0x04,0x00,0x27,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x26,0x00,0x00,0x00,
+    0x3b,0x00,0x04,0x00,0x27,0x00,0x00,0x00,0x28,0x00,0x00,0x00,0x01,0x00,0x00,0x00,
+    0x2b,0x00,0x04,0x00,0x06,0x00,0x00,0x00,0x2a,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x2b,0x00,0x04,0x00,0x06,0x00,0x00,0x00,0x2b,0x00,0x00,0x00,0x00,0x00,0x80,0x3f,
+    0x3b,0x00,0x04,0x00,0x1b,0x00,0x00,0x00,0x30,0x00,0x00,0x00,0x03,0x00,0x00,0x00,
+    0x3b,0x00,0x04,0x00,0x17,0x00,0x00,0x00,0x31,0x00,0x00,0x00,0x01,0x00,0x00,0x00,
+    0x36,0x00,0x05,0x00,0x02,0x00,0x00,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x03,0x00,0x00,0x00,0xf8,0x00,0x02,0x00,0x05,0x00,0x00,0x00,0x41,0x00,0x05,0x00,
+    0x14,0x00,0x00,0x00,0x15,0x00,0x00,0x00,0x13,0x00,0x00,0x00,0x0f,0x00,0x00,0x00,
+    0x3d,0x00,0x04,0x00,0x10,0x00,0x00,0x00,0x16,0x00,0x00,0x00,0x15,0x00,0x00,0x00,
+    0x3d,0x00,0x04,0x00,0x07,0x00,0x00,0x00,0x19,0x00,0x00,0x00,0x18,0x00,0x00,0x00,
+    0x91,0x00,0x05,0x00,0x07,0x00,0x00,0x00,0x1a,0x00,0x00,0x00,0x16,0x00,0x00,0x00,
+    0x19,0x00,0x00,0x00,0x41,0x00,0x05,0x00,0x1b,0x00,0x00,0x00,0x1c,0x00,0x00,0x00,
+    0x0d,0x00,0x00,0x00,0x0f,0x00,0x00,0x00,0x3e,0x00,0x03,0x00,0x1c,0x00,0x00,0x00,
+    0x1a,0x00,0x00,0x00,0x41,0x00,0x05,0x00,0x21,0x00,0x00,0x00,0x22,0x00,0x00,0x00,
+    0x0d,0x00,0x00,0x00,0x1d,0x00,0x00,0x00,0x3e,0x00,0x03,0x00,0x22,0x00,0x00,0x00,
+    0x2b,0x00,0x00,0x00,0x41,0x00,0x05,0x00,0x14,0x00,0x00,0x00,0x24,0x00,0x00,0x00,
+    0x13,0x00,0x00,0x00,0x1d,0x00,0x00,0x00,0x3d,0x00,0x04,0x00,0x10,0x00,0x00,0x00,
+    0x25,0x00,0x00,0x00,0x24,0x00,0x00,0x00,0x3d,0x00,0x04,0x00,0x26,0x00,0x00,0x00,
+    0x29,0x00,0x00,0x00,0x28,0x00,0x00,0x00,0x51,0x00,0x05,0x00,0x06,0x00,0x00,0x00,
+    0x2c,0x00,0x00,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x51,0x00,0x05,0x00,
+    0x06,0x00,0x00,0x00,0x2d,0x00,0x00,0x00,0x29,0x00,0x00,0x00,0x01,0x00,0x00,0x00,
+    0x50,0x00,0x07,0x00,0x07,0x00,0x00,0x00,0x2e,0x00,0x00,0x00,0x2c,0x00,0x00,0x00,
+    0x2d,0x00,0x00,0x00,0x2a,0x00,0x00,0x00,0x2b,0x00,0x00,0x00,0x91,0x00,0x05,0x00,
+    0x07,0x00,0x00,0x00,0x2f,0x00,0x00,0x00,0x25,0x00,0x00,0x00,0x2e,0x00,0x00,0x00,
+    0x3e,0x00,0x03,0x00,0x23,0x00,0x00,0x00,0x2f,0x00,0x00,0x00,0x3d,0x00,0x04,0x00,
+    0x07,0x00,0x00,0x00,0x32,0x00,0x00,0x00,0x31,0x00,0x00,0x00,0x3e,0x00,0x03,0x00,
+    0x30,0x00,0x00,0x00,0x32,0x00,0x00,0x00,0xfd,0x00,0x01,0x00,0x38,0x00,0x01,0x00,
+};
+static const uint8_t _sgl_shd_compact_fs_bytecode_spirv_vk[792] = {
+    0x03,0x02,0x23,0x07,0x00,0x04,0x01,0x00,0x0b,0x00,0x08,0x00,0x1d,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x11,0x00,0x02,0x00,0x01,0x00,0x00,0x00,0x0b,0x00,0x06,0x00,
+    0x01,0x00,0x00,0x00,0x47,0x4c,0x53,0x4c,0x2e,0x73,0x74,0x64,0x2e,0x34,0x35,0x30,
+    0x00,0x00,0x00,0x00,0x0e,0x00,0x03,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00,
+    0x0f,0x00,0x0a,0x00,0x04,0x00,0x00,0x00,0x04,0x00,0x00,0x00,0x6d,0x61,0x69,0x6e,
+    0x00,0x00,0x00,0x00,0x09,0x00,0x00,0x00,0x0c,0x00,0x00,0x00,0x10,0x00,0x00,0x00,
+    0x15,0x00,0x00,0x00,0x1a,0x00,0x00,0x00,0x10,0x00,0x03,0x00,0x04,0x00,0x00,0x00,
+    0x07,0x00,0x00,0x00,0x03,0x00,0x03,0x00,0x02,0x00,0x00,0x00,0xcc,0x01,0x00,0x00,
+    0x05,0x00,0x04,0x00,0x04,0x00,0x00,0x00,0x6d,0x61,0x69,0x6e,0x00,0x00,0x00,0x00,
+    0x05,0x00,0x05,0x00,0x09,0x00,0x00,0x00,0x66,0x72,0x61,0x67,0x5f,0x63,0x6f,0x6c,
+    0x6f,0x72,0x00,0x00,0x05,0x00,0x03,0x00,0x0c,0x00,0x00,0x00,0x74,0x65,0x78,0x00,
+    0x05,0x00,0x03,0x00,0x10,0x00,0x00,0x00,0x73,0x6d,0x70,0x00,0x05,0x00,0x03,0x00,
+    0x15,0x00,0x00,0x00,0x75,0x76,0x00,0x00,0x05,0x00,0x04,0x00,0x1a,0x00,0x00,0x00,
+    0x63,0x6f,0x6c,0x6f,0x72,0x00,0x00,0x00,0x47,0x00,0x04,0x00,0x09,0x00,0x00,0x00,
+    0x1e,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x47,0x00,0x04,0x00,0x0c,0x00,0x00,0x00,
+    0x21,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x47,0x00,0x04,0x00,0x0c,0x00,0x00,0x00,
+    0x22,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x47,0x00,0x04,0x00,0x10,0x00,0x00,0x00,
+    0x21,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x47,0x00,0x04,0x00,0x10,0x00,0x00,0x00,
+    0x22,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x47,0x00,0x04,0x00,0x15,0x00,0x00,0x00,
+    0x1e,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x47,0x00,0x04,0x00,0x1a,0x00,0x00,0x00,
+    0x1e,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x13,0x00,0x02,0x00,0x02,0x00,0x00,0x00,
+    0x21,0x00,0x03,0x00,0x03,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x16,0x00,0x03,0x00,
+    0x06,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x17,0x00,0x04,0x00,0x07,0x00,0x00,0x00,
+    0x06,0x00,0x00,0x00,0x04,0x00,0x00,0x00,0x20,0x00,0x04,0x00,0x08,0x00,0x00,0x00,
+    0x03,0x00,0x00,0x00,0x07,0x00,0x00,0x00,0x3b,0x00,0x04,0x00,0x08,0x00,0x00,0x00,
+    0x09,0x00,0x00,0x00,0x03,0x00,0x00,0x00,0x19,0x00,0x09,0x00,0x0a,0x00,0x00,0x00,
+    0x06,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x04,0x00,
+    0x0b,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0a,0x00,0x00,0x00,0x3b,0x00,0x04,0x00,
+    0x0b,0x00,0x00,0x00,0x0c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1a,0x00,0x02,0x00,
+    0x0e,0x00,0x00,0x00,0x20,0x00,0x04,0x00,0x0f,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x0e,0x00,0x00,0x00,0x3b,0x00,0x04,0x00,0x0f,0x00,0x00,0x00,0x10,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x1b,0x00,0x03,0x00,0x12,0x00,0x00,0x00,0x0a,0x00,0x00,0x00,
+    0x20,0x00,0x04,0x00,0x14,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x07,0x00,0x00,0x00,
+    0x3b,0x00,0x04,0x00,0x14,0x00,0x00,0x00,0x15,0x00,0x00,0x00,0x01,0x00,0x00,0x00,
+    0x17,0x00,0x04,0x00,0x16,0x00,0x00,0x00,0x06,0x00,0x00,0x00,0x02,0x00,0x00,0x00,
+    0x3b,0x00,0x04,0x00,0x14,0x00,0x00,0x00,0x1a,0x00,0x00,0x00,0x01,0x00,0x00,0x00,
+    0x36,0x00,0x05,0x00,0x02,0x00,0x00,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x03,0x00,0x00,0x00,0xf8,0x00,0x02,0x00,0x05,0x00,0x00,0x00,0x3d,0x00,0x04,0x00,
+    0x0a,0x00,0x00,0x00,0x0d,0x00,0x00,0x00,0x0c,0x00,0x00,0x00,0x3d,0x00,0x04,0x00,
+    0x0e,0x00,0x00,0x00,0x11,0x00,0x00,0x00,0x10,0x00,0x00,0x00,0x56,0x00,0x05,0x00,
+    0x12,0x00,0x00,0x00,0x13,0x00,0x00,0x00,0x0d,0x00,0x00,0x00,0x11,0x00,0x00,0x00,
+    0x3d,0x00,0x04,0x00,0x07,0x00,0x00,0x00,0x17,0x00,0x00,0x00,0x15,0x00,0x00,0x00,
+    0x4f,0x00,0x07,0x00,0x16,0x00,0x00,0x00,0x18,0x00,0x00,0x00,0x17,0x00,0x00,0x00,
+    0x17,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x57,0x00,0x05,0x00,
+    0x07,0x00,0x00,0x00,0x19,0x00,0x00,0x00,0x13,0x00,0x00,0x00,0x18,0x00,0x00,0x00,
+    0x3d,0x00,0x04,0x00,0x07,0x00,0x00,0x00,0x1b,0x00,0x00,0x00,0x1a,0x00,0x00,0x00,
+    0x85,0x00,0x05,0x00,0x07,0x00,0x00,0x00,0x1c,0x00,0x00,0x00,0x19,0x00,0x00,0x00,
+    0x1b,0x00,0x00,0x00,0x3e,0x00,0x03,0x00,0x09,0x00,0x00,0x00,0x1c,0x00,0x00,0x00,
+    0xfd,0x00,0x01,0x00,0x38,0x00,0x01,0x00,
+};
+#elif defined(SOKOL_DUMMY_BACKEND)
+static const char* _sgl_shd_compact_vs_source_dummy = "";
+static const char* _sgl_shd_compact_fs_source_dummy = "";
+#else
+#error "Please define one of SOKOL_GLCORE, SOKOL_GLES3, SOKOL_D3D11, SOKOL_METAL, SOKOL_WGPU, SOKOL_VULKAN or SOKOL_DUMMY_BACKEND!"
+#endif
+//<#shdgen
+
+// ████████ ██    ██ ██████  ███████ ███████
+//    ██     ██  ██  ██   ██ ██      ██
+//    ██      ████   ██████  █████   ███████
+//    ██       ██    ██      ██           ██
+//    ██       ██    ██      ███████ ███████
+//
+// >>types
+typedef enum {
+    SGL_PRIMITIVETYPE_POINTS = 0,
+    SGL_PRIMITIVETYPE_LINES,
+    SGL_PRIMITIVETYPE_LINE_STRIP,
+    SGL_PRIMITIVETYPE_TRIANGLES,
+    SGL_PRIMITIVETYPE_TRIANGLE_STRIP,
+    SGL_PRIMITIVETYPE_QUADS,
+    SGL_NUM_PRIMITIVE_TYPES,
+} _sgl_primitive_type_t;
+
+typedef struct {
+    uint32_t id;
+    sg_resource_state state;
+} _sgl_slot_t;
+
+typedef struct {
+    int size;
+    int queue_top;
+    uint32_t* gen_ctrs;
+    int* free_queue;
+} _sgl_pool_t;
+
+typedef struct {
+    _sgl_slot_t slot;
+    sg_pipeline pip[SGL_NUM_PRIMITIVE_TYPES];
+} _sgl_pipeline_t;
+
+typedef struct {
+    _sgl_pool_t pool;
+    _sgl_pipeline_t* pips;
+} _sgl_pipeline_pool_t;
+
+typedef enum {
+    SGL_MATRIXMODE_MODELVIEW,
+    SGL_MATRIXMODE_PROJECTION,
+    SGL_MATRIXMODE_TEXTURE,
+    SGL_NUM_MATRIXMODES
+} _sgl_matrix_mode_t;
+
+typedef struct {
+    float pos[3];
+    float uv[2];
+    uint32_t rgba;
+    float psize;
+} _sgl_vertex_t;
+
+/* a line point waiting to be tessellated into triangles */
+typedef struct {
+    float x, y, z;
+    float u, v;
+    uint32_t rgba;
+} _sgl_line_point_t;
+
+/* a cross section through a tessellated line, the rail vertices are
+   placed along the offset vector 'off' (a scaled line normal)
+*/
+typedef struct {
+    _sgl_line_point_t pt;
+    float off[2];
+    bool fade;      /* all rails are fully transparent (end caps of smooth lines) */
+} _sgl_line_section_t;
+
+/* vertex buffer layout for SGL_VERTEXLAYOUT_COMPACT_2D */
+typedef struct {
+    float pos[2];
+    uint16_t uv[2];
+    uint32_t rgba;
+} _sgl_compact_vertex_t;
+
+typedef struct {
+    float v[4][4];
+} _sgl_matrix_t;
+
+typedef struct {
+    _sgl_matrix_t mvp;  /* model-view-projection matrix */
+    _sgl_matrix_t tm;   /* texture matrix */
+} _sgl_uniform_t;
+
+typedef enum {
+    SGL_COMMAND_DRAW,
+    SGL_COMMAND_VIEWPORT,
+    SGL_COMMAND_SCISSOR_RECT,
+    SGL_COMMAND_DISPLAY_LIST,
+} _sgl_command_type_t;
+
+typedef struct {
+    sg_pipeline pip;
+    sg_view view;
+    sg_sampler smp;
+    int base_vertex;
+    int num_vertices;
+    int uniform_index;
+    bool quads;     /* true if rendered with the quad index buffer */
+    int first_range;    /* non-adjacently merged vertex ranges, -1 if vertices are contiguous */
+    int last_range;
+} _sgl_draw_args_t;
+
+typedef struct {
+    int x, y, w, h;
+    bool origin_top_left;
+} _sgl_viewport_args_t;
+
+typedef struct {
+    int x, y, w, h;
+    bool origin_top_left;
+} _sgl_scissor_rect_args_t;
+
+typedef struct {
+    uint32_t list_id;
+    int uniform_index;
+} _sgl_display_list_args_t;
+
+typedef union {
+    _sgl_draw_args_t draw;
+    _sgl_viewport_args_t viewport;
+    _sgl_scissor_rect_args_t scissor_rect;
+    _sgl_display_list_args_t display_list;
+} _sgl_args_t;
+
+typedef struct {
+    _sgl_command_type_t cmd;
+    int layer_id;
+    _sgl_args_t args;
+} _sgl_command_t;
+
+typedef struct {
+    int base_vertex;
+    int num_vertices;
+    int next;           /* index of next range of the same draw command, or -1 */
+} _sgl_vertex_range_t;
+
+typedef struct {
+    _sgl_slot_t slot;
+    uint32_t ctx_id;            /* the context the display list has been recorded in */
+    sg_buffer vbuf;             /* immutable vertex buffer, invalid if no vertices */
+    int num_vertices;
+    int num_commands;
+    _sgl_command_t* commands;   /* draw commands with base_vertex relative to vbuf */
+} _sgl_display_list_t;
+
+typedef struct {
+    _sgl_pool_t pool;
+    _sgl_display_list_t* lists;
+} _sgl_display_list_pool_t;
+
+typedef struct {
+    int layer_id;
+    int segment;        /* for sorting by state, incremented at viewport and scissor rect commands */
+    uint32_t pip_id;
+    uint32_t view_id;
+    uint32_t smp_id;
+    int cmd_index;
+} _sgl_sort_item_t;
+
+#define _SGL_INVALID_SLOT_INDEX (0)
+#define _SGL_MAX_STACK_DEPTH (64)
+#define _SGL_DEFAULT_CONTEXT_POOL_SIZE (4)
+#define _SGL_DEFAULT_PIPELINE_POOL_SIZE (64)
+#define _SGL_DEFAULT_DISPLAY_LIST_POOL_SIZE (64)
+#define _SGL_DEFAULT_MAX_VERTICES (1<<16)
+#define _SGL_DEFAULT_MAX_COMMANDS (1<<14)
+#define _SGL_MAX_QUADS_PER_DRAW (1<<14)  /* 4 vertices per quad must fit into 16-bit indices */
+#define _SGL_LINE_MITER_LIMIT (4.0f)        /* max miter length at line strip joins, in line widths */
+#define _SGL_SLOT_SHIFT (16)
+#define _SGL_MAX_POOL_SIZE (1<<_SGL_SLOT_SHIFT)
+#define _SGL_SLOT_MASK (_SGL_MAX_POOL_SIZE-1)
+
+typedef struct {
+    _sgl_slot_t slot;
+    sgl_context_desc_t desc;
+    uint32_t frame_id;
+    uint32_t update_frame_id;
+    struct {
+        int cap;
+        int next;
+        _sgl_vertex_t* ptr;
+    } vertices;
+    struct {
+        int cap;
+        int next;
+        _sgl_uniform_t* ptr;
+    } uniforms;
+    struct {
+        int cap;
+        int next;
+        _sgl_command_t* ptr;
+    } commands;
+    struct {
+        bool in_order;  /* true if commands have been recorded in ascending layer order */
+        bool valid;     /* true if the layer-sorted command index is uptodate */
+        _sgl_sort_item_t* items;    /* commands sorted by layer (only if !in_order), lazily allocated */
+        _sgl_sort_item_t* scratch;  /* scratch space for sorting by state, lazily allocated */
+    } layers;
+    struct {
+        bool active;            /* true between sgl_begin_display_list() and sgl_end_display_list() */
+        bool cpu_transform;     /* cpu_transform is disabled while recording a display list */
+        int base_vertex;        /* vertices, uniforms, commands and merge ranges recorded into the display list */
+        int base_uniform;
+        int base_command;
+        int base_range;
+    } dl;
+    struct {
+        int cap;        /* zero if merge window is disabled */
+        int next;
+        _sgl_vertex_range_t* ranges;    /* vertex ranges of non-adjacently merged draw commands */
+        _sgl_vertex_t* vertices;        /* vertices gathered into contiguous per-command ranges */
+    } merge;
+
+    /* state tracking */
+    int base_vertex;
+    sgl_error_t error;
+    bool in_begin;
+    int layer_id;
+    float u, v;
+    uint32_t rgba;
+    float point_size;
+    float line_width;
+    bool line_smooth;
+    _sgl_primitive_type_t cur_prim_type;
+    sg_view cur_view;
+    sg_sampler cur_smp;
+    bool texturing_enabled;
+    bool matrix_dirty;      /* reset in sgl_end(), set in any of the matrix stack functions */
+    bool cpu_transform;     /* if true, vertices are transformed by the modelview matrix in _sgl_write_vtx() */
+
+    /* wide and smooth line tessellation */
+    struct {
+        bool active;                    /* lines are tessellated into triangles in the current sgl_begin/end pair */
+        bool strip;
+        int num_rails;                  /* 2 rails for solid lines, 4 rails for smooth lines */
+        float rail_offset[4];           /* rail offsets from the line center */
+        float rail_alpha[4];
+        int num_points;                 /* number of points in the current line or line strip */
+        _sgl_line_point_t last;         /* last point */
+        float dir[2];                   /* normalized direction of the last segment */
+        _sgl_line_section_t section;    /* last emitted cross section of a line strip */
+        bool varying_z_logged;          /* LINE_VARYING_Z is only logged once per sgl_begin/end pair */
+    } line;
+
+    /* high-water marks and auto-grow tracking */
+    int peak_vertices;
+    int peak_uniforms;
+    int peak_commands;
+    int num_grows;
+
+    /* vertex buffer layout */
+    int vertex_size;                            /* size of a vertex in the vertex buffer */
+    _sgl_compact_vertex_t* compact_vertices;    /* conversion space for SGL_VERTEXLAYOUT_COMPACT_2D */
+
+    /* sokol-gfx resources */
+    sg_buffer vbuf;
+    int vbuf_cap;           /* number of vertices in vbuf, may lag behind vertices.cap with auto_grow */
+    sgl_pipeline def_pip;
+    sg_bindings bind;
+
+    /* pipeline stack */
+    int pip_tos;
+    sgl_pipeline pip_stack[_SGL_MAX_STACK_DEPTH];
+
+    /* matrix stacks */
+    _sgl_matrix_mode_t cur_matrix_mode;
+    int matrix_tos[SGL_NUM_MATRIXMODES];
+    _sgl_matrix_t matrix_stack[SGL_NUM_MATRIXMODES][_SGL_MAX_STACK_DEPTH];
+} _sgl_context_t;
+
+typedef struct {
+    _sgl_pool_t pool;
+    _sgl_context_t* contexts;
+} _sgl_context_pool_t;
+
+typedef struct {
+    uint32_t init_cookie;
+    sgl_desc_t desc;
+    sg_image def_img;   // a default white texture
+    sg_view def_view;   // ...and the texture view for the default image
+    sg_sampler def_smp; // a default sampler
+    sg_shader shd;      // shader for all contexts with the standard vertex layout
+    sg_shader shd_compact; // shader for contexts with the compact vertex layout
+    sg_buffer quad_ibuf; // static index buffer for rendering quads as indexed triangles
+    sgl_context def_ctx_id;
+    sgl_context cur_ctx_id;
+    _sgl_context_t* cur_ctx;   // may be 0!
+    _sgl_pipeline_pool_t pip_pool;
+    _sgl_context_pool_t context_pool;
+    _sgl_display_list_pool_t dl_pool;
+} _sgl_t;
+static _sgl_t _sgl;
+
+// ██       ██████   ██████   ██████  ██ ███    ██  ██████
+// ██      ██    ██ ██       ██       ██ ████   ██ ██
+// ██      ██    ██ ██   ███ ██   ███ ██ ██ ██  ██ ██   ███
+// ██      ██    ██ ██    ██ ██    ██ ██ ██  ██ ██ ██    ██
+// ███████  ██████   ██████   ██████  ██ ██   ████  ██████
+//
 // >>logging
 #if defined(SOKOL_DEBUG)
 #define _SGL_LOGITEM_XMACRO(item,msg) #item ": " msg,
@@ -2815,29 +4448,45 @@ static void _sgl_init_pipeline(sgl_pipeline pip_id, const sg_pipeline_desc* in_d
 
     /* create a new desc with 'patched' shader and pixel format state */
     sg_pipeline_desc desc = *in_desc;
-    desc.layout.buffers[0].stride = sizeof(_sgl_vertex_t);
-    {
-        sg_vertex_attr_state* pos = &desc.layout.attrs[0];
-        pos->offset = offsetof(_sgl_vertex_t, pos);
-        pos->format = SG_VERTEXFORMAT_FLOAT3;
-    }
-    {
-        sg_vertex_attr_state* uv = &desc.layout.attrs[1];
-        uv->offset = offsetof(_sgl_vertex_t, uv);
-        uv->format = SG_VERTEXFORMAT_FLOAT2;
-    }
-    {
-        sg_vertex_attr_state* rgba = &desc.layout.attrs[2];
-        rgba->offset = offsetof(_sgl_vertex_t, rgba);
-        rgba->format = SG_VERTEXFORMAT_UBYTE4N;
-    }
-    {
-        sg_vertex_attr_state* psize = &desc.layout.attrs[3];
-        psize->offset = offsetof(_sgl_vertex_t, psize);
-        psize->format = SG_VERTEXFORMAT_FLOAT;
+    if (ctx_desc->vertex_layout == SGL_VERTEXLAYOUT_COMPACT_2D) {
+        // NOTE: missing position components are filled in by the vertex fetch,
+        // the compact shader has no point size input
+        desc.layout.buffers[0].stride = sizeof(_sgl_compact_vertex_t);
+        desc.layout.attrs[0].offset = offsetof(_sgl_compact_vertex_t, pos);
+        desc.layout.attrs[0].format = SG_VERTEXFORMAT_FLOAT2;
+        desc.layout.attrs[1].offset = offsetof(_sgl_compact_vertex_t, uv);
+        desc.layout.attrs[1].format = SG_VERTEXFORMAT_USHORT2N;
+        desc.layout.attrs[2].offset = offsetof(_sgl_compact_vertex_t, rgba);
+        desc.layout.attrs[2].format = SG_VERTEXFORMAT_UBYTE4N;
+    } else {
+        desc.layout.buffers[0].stride = sizeof(_sgl_vertex_t);
+        {
+            sg_vertex_attr_state* pos = &desc.layout.attrs[0];
+            pos->offset = offsetof(_sgl_vertex_t, pos);
+            pos->format = SG_VERTEXFORMAT_FLOAT3;
+        }
+        {
+            sg_vertex_attr_state* uv = &desc.layout.attrs[1];
+            uv->offset = offsetof(_sgl_vertex_t, uv);
+            uv->format = SG_VERTEXFORMAT_FLOAT2;
+        }
+        {
+            sg_vertex_attr_state* rgba = &desc.layout.attrs[2];
+            rgba->offset = offsetof(_sgl_vertex_t, rgba);
+            rgba->format = SG_VERTEXFORMAT_UBYTE4N;
+        }
+        {
+            sg_vertex_attr_state* psize = &desc.layout.attrs[3];
+            psize->offset = offsetof(_sgl_vertex_t, psize);
+            psize->format = SG_VERTEXFORMAT_FLOAT;
+        }
     }
     if (in_desc->shader.id == SG_INVALID_ID) {
-        desc.shader = _sgl.shd;
+        if (ctx_desc->vertex_layout == SGL_VERTEXLAYOUT_COMPACT_2D) {
+            desc.shader = _sgl.shd_compact;
+        } else {
+            desc.shader = _sgl.shd;
+        }
     }
     desc.index_type = SG_INDEXTYPE_NONE;
     desc.sample_count = ctx_desc->sample_count;
@@ -2871,19 +4520,18 @@ static void _sgl_init_pipeline(sgl_pipeline pip_id, const sg_pipeline_desc* in_d
                 desc.primitive_type = SG_PRIMITIVETYPE_TRIANGLES;
                 break;
             case SGL_PRIMITIVETYPE_TRIANGLE_STRIP:
-            case SGL_PRIMITIVETYPE_QUADS:
                 desc.primitive_type = SG_PRIMITIVETYPE_TRIANGLE_STRIP;
                 break;
+            case SGL_PRIMITIVETYPE_QUADS:
+                /* quads are rendered as indexed triangles via the shared quad index buffer */
+                desc.primitive_type = SG_PRIMITIVETYPE_TRIANGLES;
+                desc.index_type = SG_INDEXTYPE_UINT16;
+                break;
         }
-        if (SGL_PRIMITIVETYPE_QUADS == i) {
-            /* quads are emulated via triangles, use the same pipeline object */
-            pip->pip[i] = pip->pip[SGL_PRIMITIVETYPE_TRIANGLES];
-        } else {
-            pip->pip[i] = sg_make_pipeline(&desc);
-            if (pip->pip[i].id == SG_INVALID_ID) {
-                _SGL_ERROR(MAKE_PIPELINE_FAILED);
-                pip->slot.state = SG_RESOURCESTATE_FAILED;
-            }
+        pip->pip[i] = sg_make_pipeline(&desc);
+        if (pip->pip[i].id == SG_INVALID_ID) {
+            _SGL_ERROR(MAKE_PIPELINE_FAILED);
+            pip->slot.state = SG_RESOURCESTATE_FAILED;
         }
     }
 }
@@ -2904,9 +4552,7 @@ static void _sgl_destroy_pipeline(sgl_pipeline pip_id) {
     if (pip) {
         sg_push_debug_group("sokol-gl");
         for (int i = 0; i < SGL_NUM_PRIMITIVE_TYPES; i++) {
-            if (i != SGL_PRIMITIVETYPE_QUADS) {
-                sg_destroy_pipeline(pip->pip[i]);
-            }
+            sg_destroy_pipeline(pip->pip[i]);
         }
         sg_pop_debug_group();
         _sgl_reset_pipeline(pip);
@@ -2924,6 +4570,64 @@ static sg_pipeline _sgl_get_pipeline(sgl_pipeline pip_id, _sgl_primitive_type_t
     }
 }
 
+static void _sgl_setup_display_list_pool(int pool_size) {
+    /* note: the pools here will have an additional item, since slot 0 is reserved */
+    SOKOL_ASSERT((pool_size > 0) && (pool_size < _SGL_MAX_POOL_SIZE));
+    _sgl_init_pool(&_sgl.dl_pool.pool, pool_size);
+    size_t pool_byte_size = sizeof(_sgl_display_list_t) * (size_t)_sgl.dl_pool.pool.size;
+    _sgl.dl_pool.lists = (_sgl_display_list_t*) _sgl_malloc_clear(pool_byte_size);
+}
+
+static void _sgl_discard_display_list_pool(void) {
+    SOKOL_ASSERT(0 != _sgl.dl_pool.lists);
+    _sgl_free(_sgl.dl_pool.lists); _sgl.dl_pool.lists = 0;
+    _sgl_discard_pool(&_sgl.dl_pool.pool);
+}
+
+/* get display list pointer with id-check, returns 0 if no match */
+static _sgl_display_list_t* _sgl_lookup_display_list(uint32_t list_id) {
+    if (SG_INVALID_ID != list_id) {
+        int slot_index = _sgl_slot_index(list_id);
+        SOKOL_ASSERT((slot_index > _SGL_INVALID_SLOT_INDEX) && (slot_index < _sgl.dl_pool.pool.size));
+        _sgl_display_list_t* list = &_sgl.dl_pool.lists[slot_index];
+        if (list->slot.id == list_id) {
+            return list;
+        }
+    }
+    return 0;
+}
+
+static sgl_display_list _sgl_make_display_list_id(uint32_t list_id) {
+    sgl_display_list list = { list_id };
+    return list;
+}
+
+static void _sgl_destroy_display_list(sgl_display_list list_id) {
+    _sgl_display_list_t* list = _sgl_lookup_display_list(list_id.id);
+    if (list) {
+        if (list->vbuf.id != SG_INVALID_ID) {
+            sg_push_debug_group("sokol-gl");
+            sg_destroy_buffer(list->vbuf);
+            sg_pop_debug_group();
+        }
+        if (list->commands) {
+            _sgl_free(list->commands);
+        }
+        _sgl_clear(list, sizeof(_sgl_display_list_t));
+        _sgl_pool_free_index(&_sgl.dl_pool.pool, _sgl_slot_index(list_id.id));
+    }
+}
+
+// destroy all display lists recorded in a context
+static void _sgl_destroy_context_display_lists(uint32_t ctx_id) {
+    for (int i = 0; i < _sgl.dl_pool.pool.size; i++) {
+        _sgl_display_list_t* list = &_sgl.dl_pool.lists[i];
+        if ((list->slot.id != SG_INVALID_ID) && (list->ctx_id == ctx_id)) {
+            _sgl_destroy_display_list(_sgl_make_display_list_id(list->slot.id));
+        }
+    }
+}
+
 //  ██████  ██████  ███    ██ ████████ ███████ ██   ██ ████████ ███████
 // ██      ██    ██ ████   ██    ██    ██       ██ ██     ██    ██
 // ██      ██    ██ ██ ██  ██    ██    █████     ███      ██    ███████
@@ -2995,9 +4699,23 @@ static sgl_context_desc_t _sgl_context_desc_defaults(const sgl_context_desc_t* d
     sgl_context_desc_t res = *desc;
     res.max_vertices = _sgl_def(desc->max_vertices, _SGL_DEFAULT_MAX_VERTICES);
     res.max_commands = _sgl_def(desc->max_commands, _SGL_DEFAULT_MAX_COMMANDS);
+    res.vertex_layout = _sgl_def(desc->vertex_layout, SGL_VERTEXLAYOUT_STANDARD);
     return res;
 }
 
+static void _sgl_make_vertex_buffer(_sgl_context_t* ctx) {
+    sg_buffer_desc vbuf_desc;
+    _sgl_clear(&vbuf_desc, sizeof(vbuf_desc));
+    vbuf_desc.size = (size_t)ctx->vertices.cap * (size_t)ctx->vertex_size;
+    vbuf_desc.usage.vertex_buffer = true;
+    vbuf_desc.usage.stream_update = true;
+    vbuf_desc.label = "sgl-vertex-buffer";
+    ctx->vbuf = sg_make_buffer(&vbuf_desc);
+    SOKOL_ASSERT(SG_INVALID_ID != ctx->vbuf.id);
+    ctx->vbuf_cap = ctx->vertices.cap;
+    ctx->bind.vertex_buffers[0] = ctx->vbuf;
+}
+
 static void _sgl_identity(_sgl_matrix_t*);
 static sg_commit_listener _sgl_make_commit_listener(_sgl_context_t* ctx);
 static void _sgl_init_context(sgl_context ctx_id, const sgl_context_desc_t* in_desc) {
@@ -3016,19 +4734,22 @@ static void _sgl_init_context(sgl_context ctx_id, const sgl_context_desc_t* in_d
     ctx->vertices.ptr = (_sgl_vertex_t*) _sgl_malloc((size_t)ctx->vertices.cap * sizeof(_sgl_vertex_t));
     ctx->uniforms.ptr = (_sgl_uniform_t*) _sgl_malloc((size_t)ctx->uniforms.cap * sizeof(_sgl_uniform_t));
     ctx->commands.ptr = (_sgl_command_t*) _sgl_malloc((size_t)ctx->commands.cap * sizeof(_sgl_command_t));
+    if (ctx->desc.vertex_layout == SGL_VERTEXLAYOUT_COMPACT_2D) {
+        ctx->vertex_size = (int)sizeof(_sgl_compact_vertex_t);
+        ctx->compact_vertices = (_sgl_compact_vertex_t*) _sgl_malloc((size_t)ctx->vertices.cap * sizeof(_sgl_compact_vertex_t));
+    } else {
+        ctx->vertex_size = (int)sizeof(_sgl_vertex_t);
+    }
+    if (ctx->desc.merge_window > 0) {
+        ctx->merge.cap = ctx->commands.cap;
+        ctx->merge.ranges = (_sgl_vertex_range_t*) _sgl_malloc((size_t)ctx->merge.cap * sizeof(_sgl_vertex_range_t));
+        ctx->merge.vertices = (_sgl_vertex_t*) _sgl_malloc((size_t)ctx->vertices.cap * sizeof(_sgl_vertex_t));
+    }
 
     // create sokol-gfx resource objects
     sg_push_debug_group("sokol-gl");
 
-    sg_buffer_desc vbuf_desc;
-    _sgl_clear(&vbuf_desc, sizeof(vbuf_desc));
-    vbuf_desc.size = (size_t)ctx->vertices.cap * sizeof(_sgl_vertex_t);
-    vbuf_desc.usage.vertex_buffer = true;
-    vbuf_desc.usage.stream_update = true;
-    vbuf_desc.label = "sgl-vertex-buffer";
-    ctx->vbuf = sg_make_buffer(&vbuf_desc);
-    SOKOL_ASSERT(SG_INVALID_ID != ctx->vbuf.id);
-    ctx->bind.vertex_buffers[0] = ctx->vbuf;
+    _sgl_make_vertex_buffer(ctx);
 
     sg_pipeline_desc def_pip_desc;
     _sgl_clear(&def_pip_desc, sizeof(def_pip_desc));
@@ -3042,11 +4763,14 @@ static void _sgl_init_context(sgl_context ctx_id, const sgl_context_desc_t* in_d
     // default state
     ctx->rgba = 0xFFFFFFFF;
     ctx->point_size = 1.0f;
+    ctx->line_width = 1.0f;
     for (int i = 0; i < SGL_NUM_MATRIXMODES; i++) {
         _sgl_identity(&ctx->matrix_stack[i][0]);
     }
     ctx->pip_stack[0] = ctx->def_pip;
     ctx->matrix_dirty = true;
+    ctx->cpu_transform = ctx->desc.cpu_transform;
+    ctx->layers.in_order = true;
 }
 
 static sgl_context _sgl_make_context(const sgl_context_desc_t* desc) {
@@ -3073,6 +4797,26 @@ static void _sgl_destroy_context(sgl_context ctx_id) {
         ctx->vertices.ptr = 0;
         ctx->uniforms.ptr = 0;
         ctx->commands.ptr = 0;
+        if (ctx->layers.items) {
+            _sgl_free(ctx->layers.items);
+            ctx->layers.items = 0;
+        }
+        if (ctx->layers.scratch) {
+            _sgl_free(ctx->layers.scratch);
+            ctx->layers.scratch = 0;
+        }
+        if (ctx->compact_vertices) {
+            _sgl_free(ctx->compact_vertices);
+            ctx->compact_vertices = 0;
+        }
+        if (ctx->merge.ranges) {
+            _sgl_free(ctx->merge.ranges);
+            _sgl_free(ctx->merge.vertices);
+            ctx->merge.ranges = 0;
+            ctx->merge.vertices = 0;
+        }
+
+        _sgl_destroy_context_display_lists(ctx_id.id);
 
         sg_push_debug_group("sokol-gl");
         sg_destroy_buffer(ctx->vbuf);
@@ -3099,6 +4843,18 @@ static sgl_error_t _sgl_error_defaults(void) {
     return defaults;
 }
 
+static void _sgl_update_peaks(_sgl_context_t* ctx) {
+    if (ctx->vertices.next > ctx->peak_vertices) {
+        ctx->peak_vertices = ctx->vertices.next;
+    }
+    if (ctx->uniforms.next > ctx->peak_uniforms) {
+        ctx->peak_uniforms = ctx->uniforms.next;
+    }
+    if (ctx->commands.next > ctx->peak_commands) {
+        ctx->peak_commands = ctx->commands.next;
+    }
+}
+
 static int _sgl_num_vertices(_sgl_context_t* ctx) {
     return ctx->vertices.next;
 }
@@ -3107,14 +4863,117 @@ static int _sgl_num_commands(_sgl_context_t* ctx) {
     return ctx->commands.next;
 }
 
+static sgl_stats_t _sgl_query_stats(_sgl_context_t* ctx) {
+    _sgl_update_peaks(ctx);
+    sgl_stats_t stats;
+    _sgl_clear(&stats, sizeof(stats));
+    stats.max_vertices = ctx->vertices.cap;
+    stats.max_uniforms = ctx->uniforms.cap;
+    stats.max_commands = ctx->commands.cap;
+    stats.peak_vertices = ctx->peak_vertices;
+    stats.peak_uniforms = ctx->peak_uniforms;
+    stats.peak_commands = ctx->peak_commands;
+    stats.num_grows = ctx->num_grows;
+    return stats;
+}
+
+static void _sgl_begin_line_tessellation(_sgl_context_t* ctx, bool strip) {
+    _sgl_clear(&ctx->line, sizeof(ctx->line));
+    ctx->line.active = true;
+    ctx->line.strip = strip;
+    const float hw = 0.5f * ctx->line_width;
+    if (ctx->line_smooth) {
+        // a solid core and a 1 unit wide feathered edge centered on each line border,
+        // lines thinner than 1 unit fade out instead of getting thinner
+        const float hi = (hw > 0.5f) ? (hw - 0.5f) : 0.0f;
+        const float ho = hw + 0.5f;
+        const float alpha = (ctx->line_width < 1.0f) ? ctx->line_width : 1.0f;
+        ctx->line.num_rails = 4;
+        ctx->line.rail_offset[0] = ho;  ctx->line.rail_alpha[0] = 0.0f;
+        ctx->line.rail_offset[1] = hi;  ctx->line.rail_alpha[1] = alpha;
+        ctx->line.rail_offset[2] = -hi; ctx->line.rail_alpha[2] = alpha;
+        ctx->line.rail_offset[3] = -ho; ctx->line.rail_alpha[3] = 0.0f;
+    } else {
+        ctx->line.num_rails = 2;
+        ctx->line.rail_offset[0] = hw;  ctx->line.rail_alpha[0] = 1.0f;
+        ctx->line.rail_offset[1] = -hw; ctx->line.rail_alpha[1] = 1.0f;
+    }
+}
+
 static void _sgl_begin(_sgl_context_t* ctx, _sgl_primitive_type_t mode) {
     ctx->in_begin = true;
     ctx->base_vertex = ctx->vertices.next;
-    ctx->quad_vtx_count = 0;
+    ctx->line.active = false;
+    if (((mode == SGL_PRIMITIVETYPE_LINES) || (mode == SGL_PRIMITIVETYPE_LINE_STRIP)) &&
+        ((ctx->line_width != 1.0f) || ctx->line_smooth))
+    {
+        // wide and smooth lines are tessellated into triangles, so that they
+        // can be merged with other triangle draw commands
+        _sgl_begin_line_tessellation(ctx, mode == SGL_PRIMITIVETYPE_LINE_STRIP);
+        mode = SGL_PRIMITIVETYPE_TRIANGLES;
+    }
     ctx->cur_prim_type = mode;
 }
 
+// merge the vertices of the current sgl_begin/end pair into a draw command,
+// if the vertices don't directly follow the command's vertices, a chain of
+// vertex ranges is recorded which is gathered at draw time
+static bool _sgl_merge_vertices(_sgl_context_t* ctx, _sgl_command_t* cmd) {
+    SOKOL_ASSERT(cmd->cmd == SGL_COMMAND_DRAW);
+    _sgl_draw_args_t* args = &cmd->args.draw;
+    const int num_vertices = ctx->vertices.next - ctx->base_vertex;
+    if ((args->first_range < 0) && ((args->base_vertex + args->num_vertices) == ctx->base_vertex)) {
+        args->num_vertices += num_vertices;
+        return true;
+    }
+    const int num_ranges = (args->first_range < 0) ? 2 : 1;
+    if ((ctx->merge.next + num_ranges) > ctx->merge.cap) {
+        return false;
+    }
+    if (args->first_range < 0) {
+        _sgl_vertex_range_t* r = &ctx->merge.ranges[ctx->merge.next];
+        r->base_vertex = args->base_vertex;
+        r->num_vertices = args->num_vertices;
+        r->next = -1;
+        args->first_range = args->last_range = ctx->merge.next++;
+    }
+    _sgl_vertex_range_t* r = &ctx->merge.ranges[ctx->merge.next];
+    r->base_vertex = ctx->base_vertex;
+    r->num_vertices = num_vertices;
+    r->next = -1;
+    ctx->merge.ranges[args->last_range].next = ctx->merge.next;
+    args->last_range = ctx->merge.next++;
+    args->num_vertices += num_vertices;
+    return true;
+}
+
+// look back over the merge window for a draw command in the current layer
+// with matching state, stops at viewport and scissor rect commands
+static _sgl_command_t* _sgl_find_merge_command(_sgl_context_t* ctx, sg_pipeline pip, sg_view view, sg_sampler smp) {
+    const int uniform_index = ctx->uniforms.next - 1;
+    const int end = ctx->commands.next - ctx->desc.merge_window;
+    const int first_cmd = ctx->dl.active ? ctx->dl.base_command : 0;
+    for (int i = ctx->commands.next - 1; (i >= first_cmd) && (i >= end); i--) {
+        _sgl_command_t* cmd = &ctx->commands.ptr[i];
+        if (cmd->layer_id != ctx->layer_id) {
+            continue;
+        }
+        if (cmd->cmd != SGL_COMMAND_DRAW) {
+            break;
+        }
+        if ((cmd->args.draw.pip.id == pip.id) &&
+            (cmd->args.draw.view.id == view.id) &&
+            (cmd->args.draw.smp.id == smp.id) &&
+            (cmd->args.draw.uniform_index == uniform_index))
+        {
+            return cmd;
+        }
+    }
+    return 0;
+}
+
 static void _sgl_rewind(_sgl_context_t* ctx) {
+    _sgl_update_peaks(ctx);
     ctx->frame_id++;
     ctx->vertices.next = 0;
     ctx->uniforms.next = 0;
@@ -3122,6 +4981,9 @@ static void _sgl_rewind(_sgl_context_t* ctx) {
     ctx->base_vertex = 0;
     ctx->error = _sgl_error_defaults();
     ctx->layer_id = 0;
+    ctx->layers.in_order = true;
+    ctx->layers.valid = false;
+    ctx->merge.next = 0;
     ctx->matrix_dirty = true;
 }
 
@@ -3138,8 +5000,83 @@ static sg_commit_listener _sgl_make_commit_listener(_sgl_context_t* ctx) {
     return listener;
 }
 
+// reallocate an array with a new capacity, keeping the first 'num' items
+static void* _sgl_grow_array(void* ptr, int num, int new_cap, size_t item_size) {
+    void* new_ptr = _sgl_malloc((size_t)new_cap * item_size);
+    if (num > 0) {
+        memcpy(new_ptr, ptr, (size_t)num * item_size);
+    }
+    _sgl_free(ptr);
+    return new_ptr;
+}
+
+static int _sgl_grow_cap(int cap, int min_cap) {
+    int new_cap = (cap > 0) ? cap : 1;
+    while (new_cap < min_cap) {
+        new_cap *= 2;
+    }
+    return new_cap;
+}
+
+// grow the vertex storage with auto_grow (the vertex buffer is recreated in _sgl_draw())
+static bool _sgl_grow_vertices(_sgl_context_t* ctx, int min_cap) {
+    if (!ctx->desc.auto_grow) {
+        return false;
+    }
+    const int new_cap = _sgl_grow_cap(ctx->vertices.cap, min_cap);
+    ctx->vertices.ptr = (_sgl_vertex_t*) _sgl_grow_array(ctx->vertices.ptr, ctx->vertices.next, new_cap, sizeof(_sgl_vertex_t));
+    ctx->vertices.cap = new_cap;
+    if (ctx->merge.vertices) {
+        // gather space doesn't contain any persistent data
+        _sgl_free(ctx->merge.vertices);
+        ctx->merge.vertices = (_sgl_vertex_t*) _sgl_malloc((size_t)new_cap * sizeof(_sgl_vertex_t));
+    }
+    if (ctx->compact_vertices) {
+        _sgl_free(ctx->compact_vertices);
+        ctx->compact_vertices = (_sgl_compact_vertex_t*) _sgl_malloc((size_t)new_cap * sizeof(_sgl_compact_vertex_t));
+    }
+    ctx->num_grows++;
+    return true;
+}
+
+static bool _sgl_grow_uniforms(_sgl_context_t* ctx) {
+    if (!ctx->desc.auto_grow) {
+        return false;
+    }
+    const int new_cap = _sgl_grow_cap(ctx->uniforms.cap, ctx->uniforms.cap + 1);
+    ctx->uniforms.ptr = (_sgl_uniform_t*) _sgl_grow_array(ctx->uniforms.ptr, ctx->uniforms.next, new_cap, sizeof(_sgl_uniform_t));
+    ctx->uniforms.cap = new_cap;
+    ctx->num_grows++;
+    return true;
+}
+
+static bool _sgl_grow_commands(_sgl_context_t* ctx) {
+    if (!ctx->desc.auto_grow) {
+        return false;
+    }
+    const int new_cap = _sgl_grow_cap(ctx->commands.cap, ctx->commands.cap + 1);
+    ctx->commands.ptr = (_sgl_command_t*) _sgl_grow_array(ctx->commands.ptr, ctx->commands.next, new_cap, sizeof(_sgl_command_t));
+    ctx->commands.cap = new_cap;
+    if (ctx->merge.ranges) {
+        ctx->merge.ranges = (_sgl_vertex_range_t*) _sgl_grow_array(ctx->merge.ranges, ctx->merge.next, new_cap, sizeof(_sgl_vertex_range_t));
+        ctx->merge.cap = new_cap;
+    }
+    // layer sorting arrays are lazily reallocated with the new capacity
+    if (ctx->layers.items) {
+        _sgl_free(ctx->layers.items);
+        ctx->layers.items = 0;
+    }
+    if (ctx->layers.scratch) {
+        _sgl_free(ctx->layers.scratch);
+        ctx->layers.scratch = 0;
+    }
+    ctx->layers.valid = false;
+    ctx->num_grows++;
+    return true;
+}
+
 static _sgl_vertex_t* _sgl_next_vertex(_sgl_context_t* ctx) {
-    if (ctx->vertices.next < ctx->vertices.cap) {
+    if ((ctx->vertices.next < ctx->vertices.cap) || _sgl_grow_vertices(ctx, ctx->vertices.cap + 1)) {
         return &ctx->vertices.ptr[ctx->vertices.next++];
     } else {
         ctx->error.vertices_full = true;
@@ -3149,7 +5086,7 @@ static _sgl_vertex_t* _sgl_next_vertex(_sgl_context_t* ctx) {
 }
 
 static _sgl_uniform_t* _sgl_next_uniform(_sgl_context_t* ctx) {
-    if (ctx->uniforms.next < ctx->uniforms.cap) {
+    if ((ctx->uniforms.next < ctx->uniforms.cap) || _sgl_grow_uniforms(ctx)) {
         return &ctx->uniforms.ptr[ctx->uniforms.next++];
     } else {
         ctx->error.uniforms_full = true;
@@ -3159,7 +5096,10 @@ static _sgl_uniform_t* _sgl_next_uniform(_sgl_context_t* ctx) {
 }
 
 static _sgl_command_t* _sgl_cur_command(_sgl_context_t* ctx) {
-    if (ctx->commands.next > 0) {
+    // NOTE: while recording a display list, commands recorded before the
+    // display list are invisible so that they can't be merged into
+    const int first_cmd = ctx->dl.active ? ctx->dl.base_command : 0;
+    if (ctx->commands.next > first_cmd) {
         return &ctx->commands.ptr[ctx->commands.next - 1];
     } else {
         return 0;
@@ -3167,7 +5107,12 @@ static _sgl_command_t* _sgl_cur_command(_sgl_context_t* ctx) {
 }
 
 static _sgl_command_t* _sgl_next_command(_sgl_context_t* ctx) {
-    if (ctx->commands.next < ctx->commands.cap) {
+    if ((ctx->commands.next < ctx->commands.cap) || _sgl_grow_commands(ctx)) {
+        // NOTE: all new commands are recorded into the current layer
+        ctx->layers.valid = false;
+        if ((ctx->commands.next > 0) && (ctx->commands.ptr[ctx->commands.next - 1].layer_id > ctx->layer_id)) {
+            ctx->layers.in_order = false;
+        }
         return &ctx->commands.ptr[ctx->commands.next++];
     } else {
         ctx->error.commands_full = true;
@@ -3194,27 +5139,391 @@ static uint32_t _sgl_pack_rgbaf(float r, float g, float b, float a) {
     return _sgl_pack_rgbab(r_u8, g_u8, b_u8, a_u8);
 }
 
-static void _sgl_vtx(_sgl_context_t* ctx, float x, float y, float z, float u, float v, uint32_t rgba) {
+static _sgl_matrix_t* _sgl_matrix_modelview(_sgl_context_t* ctx);
+
+/* CPU-side transform of positions by the affine part of the modelview
+   matrix. The matrix is column-major, so the SIMD kernels keep the four
+   columns in registers and accumulate col0*x + col1*y + col2*z + col3,
+   in the same order as the scalar fallback to get identical results.
+   Bulk submission initializes the kernel once and reuses it for all
+   vertices.
+*/
+typedef struct {
+    #if defined(_SGL_USE_SSE2)
+    __m128 col[4];
+    #elif defined(_SGL_USE_NEON)
+    float32x4_t col[4];
+    #else
+    const _sgl_matrix_t* m;
+    #endif
+} _sgl_xform_t;
+
+static void _sgl_xform_init(_sgl_xform_t* xf, const _sgl_matrix_t* m) {
+    #if defined(_SGL_USE_SSE2)
+        for (int i = 0; i < 4; i++) {
+            xf->col[i] = _mm_loadu_ps(m->v[i]);
+        }
+    #elif defined(_SGL_USE_NEON)
+        for (int i = 0; i < 4; i++) {
+            xf->col[i] = vld1q_f32(m->v[i]);
+        }
+    #else
+        xf->m = m;
+    #endif
+}
+
+static void _sgl_xform_pos(const _sgl_xform_t* xf, float dst[3], float x, float y, float z) {
+    #if defined(_SGL_USE_SSE2)
+        __m128 r = _mm_mul_ps(xf->col[0], _mm_set1_ps(x));
+        r = _mm_add_ps(r, _mm_mul_ps(xf->col[1], _mm_set1_ps(y)));
+        r = _mm_add_ps(r, _mm_mul_ps(xf->col[2], _mm_set1_ps(z)));
+        r = _mm_add_ps(r, xf->col[3]);
+        float res[4];
+        _mm_storeu_ps(res, r);
+        dst[0] = res[0]; dst[1] = res[1]; dst[2] = res[2];
+    #elif defined(_SGL_USE_NEON)
+        float32x4_t r = vmulq_n_f32(xf->col[0], x);
+        r = vaddq_f32(r, vmulq_n_f32(xf->col[1], y));
+        r = vaddq_f32(r, vmulq_n_f32(xf->col[2], z));
+        r = vaddq_f32(r, xf->col[3]);
+        dst[0] = vgetq_lane_f32(r, 0);
+        dst[1] = vgetq_lane_f32(r, 1);
+        dst[2] = vgetq_lane_f32(r, 2);
+    #else
+        const _sgl_matrix_t* m = xf->m;
+        for (int r = 0; r < 3; r++) {
+            dst[r] = m->v[0][r]*x + m->v[1][r]*y + m->v[2][r]*z + m->v[3][r];
+        }
+    #endif
+}
+
+static void _sgl_write_vtx(_sgl_context_t* ctx, float x, float y, float z, float u, float v, uint32_t rgba) {
     SOKOL_ASSERT(ctx->in_begin);
-    _sgl_vertex_t* vtx;
-    /* handle non-native primitive types */
-    if ((ctx->cur_prim_type == SGL_PRIMITIVETYPE_QUADS) && ((ctx->quad_vtx_count & 3) == 3)) {
-        /* for quads, before writing the last quad vertex, reuse
-           the first and third vertex to start the second triangle in the quad
-        */
-        vtx = _sgl_next_vertex(ctx);
-        if (vtx) { *vtx = *(vtx - 3); }
-        vtx = _sgl_next_vertex(ctx);
-        if (vtx) { *vtx = *(vtx - 2); }
-    }
-    vtx = _sgl_next_vertex(ctx);
+    _sgl_vertex_t* vtx = _sgl_next_vertex(ctx);
     if (vtx) {
-        vtx->pos[0] = x; vtx->pos[1] = y; vtx->pos[2] = z;
+        if (ctx->cpu_transform) {
+            _sgl_xform_t xf;
+            _sgl_xform_init(&xf, _sgl_matrix_modelview(ctx));
+            _sgl_xform_pos(&xf, vtx->pos, x, y, z);
+        } else {
+            vtx->pos[0] = x; vtx->pos[1] = y; vtx->pos[2] = z;
+        }
         vtx->uv[0] = u; vtx->uv[1] = v;
         vtx->rgba = rgba;
         vtx->psize = ctx->point_size;
     }
-    ctx->quad_vtx_count++;
+}
+
+static uint32_t _sgl_line_fade(uint32_t rgba, float alpha) {
+    if (alpha >= 1.0f) {
+        return rgba;
+    }
+    const uint32_t a = (uint32_t)((float)(rgba >> 24) * alpha + 0.5f);
+    return (rgba & 0x00FFFFFF) | (a << 24);
+}
+
+static _sgl_line_section_t _sgl_line_section(const _sgl_line_point_t* pt, float off_x, float off_y, bool fade) {
+    _sgl_line_section_t sec;
+    sec.pt = *pt;
+    sec.off[0] = off_x;
+    sec.off[1] = off_y;
+    sec.fade = fade;
+    return sec;
+}
+
+static void _sgl_line_rail_vtx(_sgl_context_t* ctx, const _sgl_line_section_t* sec, int rail) {
+    const float d = ctx->line.rail_offset[rail];
+    const float alpha = sec->fade ? 0.0f : ctx->line.rail_alpha[rail];
+    _sgl_write_vtx(ctx,
+        sec->pt.x + sec->off[0] * d,
+        sec->pt.y + sec->off[1] * d,
+        sec->pt.z,
+        sec->pt.u, sec->pt.v,
+        _sgl_line_fade(sec->pt.rgba, alpha));
+}
+
+// emit two triangles between each pair of neighbouring rails of two cross sections
+static void _sgl_line_emit(_sgl_context_t* ctx, const _sgl_line_section_t* s0, const _sgl_line_section_t* s1) {
+    for (int r = 0; r < (ctx->line.num_rails - 1); r++) {
+        _sgl_line_rail_vtx(ctx, s0, r);
+        _sgl_line_rail_vtx(ctx, s0, r + 1);
+        _sgl_line_rail_vtx(ctx, s1, r + 1);
+        _sgl_line_rail_vtx(ctx, s0, r);
+        _sgl_line_rail_vtx(ctx, s1, r + 1);
+        _sgl_line_rail_vtx(ctx, s1, r);
+    }
+}
+
+// smooth lines get a feathered end cap, 'dir' points away from the line
+static void _sgl_line_cap(_sgl_context_t* ctx, const _sgl_line_section_t* end, float dir_x, float dir_y, bool start) {
+    if (!ctx->line_smooth) {
+        return;
+    }
+    _sgl_line_point_t pt = end->pt;
+    pt.x += dir_x * 0.5f;
+    pt.y += dir_y * 0.5f;
+    const _sgl_line_section_t cap = _sgl_line_section(&pt, end->off[0], end->off[1], true);
+    if (start) {
+        _sgl_line_emit(ctx, &cap, end);
+    } else {
+        _sgl_line_emit(ctx, end, &cap);
+    }
+}
+
+// the offset vector of a miter join between two normalized line directions
+static void _sgl_line_miter(float off[2], const float d0[2], const float d1[2]) {
+    const float n0x = -d0[1], n0y = d0[0];
+    const float n1x = -d1[1], n1y = d1[0];
+    float mx = n0x + n1x;
+    float my = n0y + n1y;
+    const float len = sqrtf(mx*mx + my*my);
+    if (len < 1.0e-6f) {
+        // the line strip reverses its direction
+        off[0] = n0x; off[1] = n0y;
+        return;
+    }
+    mx /= len; my /= len;
+    float cos_half = mx*n0x + my*n0y;
+    if (cos_half < (1.0f / _SGL_LINE_MITER_LIMIT)) {
+        cos_half = 1.0f / _SGL_LINE_MITER_LIMIT;
+    }
+    off[0] = mx / cos_half;
+    off[1] = my / cos_half;
+}
+
+// tessellate lines into triangles on the fly, separate lines are emitted
+// when their second point arrives, line strip segments are emitted as soon as
+// the join at their end point is known (the cost is dominated by the 18
+// vertex writes per smooth segment, not by the per-point math, see the
+// line strip measurement in sokol-gl-bench)
+static void _sgl_line_vtx(_sgl_context_t* ctx, float x, float y, float z, float u, float v, uint32_t rgba) {
+    _sgl_line_point_t pt;
+    pt.x = x; pt.y = y; pt.z = z; pt.u = u; pt.v = v; pt.rgba = rgba;
+    if (ctx->line.num_points == 0) {
+        ctx->line.last = pt;
+        ctx->line.num_points = 1;
+        return;
+    }
+    if ((z != ctx->line.last.z) && !ctx->line.varying_z_logged) {
+        ctx->line.varying_z_logged = true;
+        _SGL_WARN(LINE_VARYING_Z);
+    }
+    float dir[2] = { x - ctx->line.last.x, y - ctx->line.last.y };
+    const float len = sqrtf(dir[0]*dir[0] + dir[1]*dir[1]);
+    if (len <= 0.0f) {
+        // skip zero-length segments
+        if (!ctx->line.strip) {
+            ctx->line.num_points = 0;
+        }
+        return;
+    }
+    dir[0] /= len; dir[1] /= len;
+    if (!ctx->line.strip) {
+        const _sgl_line_section_t s0 = _sgl_line_section(&ctx->line.last, -dir[1], dir[0], false);
+        const _sgl_line_section_t s1 = _sgl_line_section(&pt, -dir[1], dir[0], false);
+        _sgl_line_cap(ctx, &s0, -dir[0], -dir[1], true);
+        _sgl_line_emit(ctx, &s0, &s1);
+        _sgl_line_cap(ctx, &s1, dir[0], dir[1], false);
+        ctx->line.num_points = 0;
+        return;
+    }
+    if (ctx->line.num_points == 1) {
+        ctx->line.section = _sgl_line_section(&ctx->line.last, -dir[1], dir[0], false);
+        _sgl_line_cap(ctx, &ctx->line.section, -dir[0], -dir[1], true);
+    } else {
+        float off[2];
+        _sgl_line_miter(off, ctx->line.dir, dir);
+        const _sgl_line_section_t join = _sgl_line_section(&ctx->line.last, off[0], off[1], false);
+        _sgl_line_emit(ctx, &ctx->line.section, &join);
+        ctx->line.section = join;
+    }
+    ctx->line.last = pt;
+    ctx->line.dir[0] = dir[0];
+    ctx->line.dir[1] = dir[1];
+    ctx->line.num_points++;
+}
+
+// emit the last segment of a tessellated line strip
+static void _sgl_end_line_tessellation(_sgl_context_t* ctx) {
+    SOKOL_ASSERT(ctx->line.active);
+    if (ctx->line.strip && (ctx->line.num_points >= 2)) {
+        const float* dir = ctx->line.dir;
+        const _sgl_line_section_t end = _sgl_line_section(&ctx->line.last, -dir[1], dir[0], false);
+        _sgl_line_emit(ctx, &ctx->line.section, &end);
+        _sgl_line_cap(ctx, &end, dir[0], dir[1], false);
+    }
+    ctx->line.active = false;
+}
+
+static void _sgl_vtx(_sgl_context_t* ctx, float x, float y, float z, float u, float v, uint32_t rgba) {
+    if (ctx->line.active) {
+        _sgl_line_vtx(ctx, x, y, z, u, v, rgba);
+    } else {
+        _sgl_write_vtx(ctx, x, y, z, u, v, rgba);
+    }
+}
+
+// fast path for sgl_vertices() with tightly packed (or absent) vertex
+// streams, writes whole vertices in a single pass with plain array
+// indexing, absent uv and color streams are read from the context
+// with a step of 0
+static void _sgl_vertices_packed(_sgl_context_t* ctx, _sgl_vertex_t* dst, const sgl_vertex_desc_t* desc, int pos_components, int num_vertices) {
+    const float* pos = (const float*) desc->pos.ptr;
+    const float ctx_uv[2] = { ctx->u, ctx->v };
+    const float* uv = desc->uv.ptr ? (const float*) desc->uv.ptr : ctx_uv;
+    const size_t uv_step = desc->uv.ptr ? 2 : 0;
+    const uint32_t* color = desc->color.ptr ? (const uint32_t*) desc->color.ptr : &ctx->rgba;
+    const size_t color_step = desc->color.ptr ? 1 : 0;
+    const float psize = ctx->point_size;
+    int i = 0;
+    if (ctx->cpu_transform) {
+        _sgl_xform_t xf;
+        _sgl_xform_init(&xf, _sgl_matrix_modelview(ctx));
+        for (; i < num_vertices; i++) {
+            const float* p = &pos[(size_t)i * (size_t)pos_components];
+            _sgl_xform_pos(&xf, dst[i].pos, p[0], p[1], (pos_components == 3) ? p[2] : 0.0f);
+            dst[i].uv[0] = uv[(size_t)i * uv_step]; dst[i].uv[1] = uv[(size_t)i * uv_step + 1];
+            dst[i].rgba = color[(size_t)i * color_step];
+            dst[i].psize = psize;
+        }
+        return;
+    }
+    if (pos_components == 3) {
+        #if defined(_SGL_USE_SSE2)
+        // each vertex is written with two unaligned 16-byte stores (x,y,z,u)
+        // and (v,rgba,psize,-), the last lane of the second store spills into
+        // the next vertex and is overwritten in the next iteration, so the
+        // last vertex is written by the scalar loop below (this also keeps
+        // the 16-byte position load from reading past the end of the input)
+        const __m128 psize4 = _mm_set1_ps(psize);
+        for (; i < (num_vertices - 1); i++) {
+            const __m128 xyzx = _mm_loadu_ps(&pos[(size_t)i * 3]);
+            const __m128 uv00 = _mm_castpd_ps(_mm_load_sd((const double*)&uv[(size_t)i * uv_step]));
+            const __m128 zzuv = _mm_shuffle_ps(xyzx, uv00, _MM_SHUFFLE(1,0,2,2));
+            const __m128 xyzu = _mm_shuffle_ps(xyzx, zzuv, _MM_SHUFFLE(2,0,1,0));
+            const __m128 c000 = _mm_castsi128_ps(_mm_cvtsi32_si128((int)color[(size_t)i * color_step]));
+            const __m128 vcv0 = _mm_unpacklo_ps(_mm_shuffle_ps(zzuv, zzuv, _MM_SHUFFLE(3,3,3,3)), c000);
+            const __m128 vcpp = _mm_shuffle_ps(vcv0, psize4, _MM_SHUFFLE(0,0,1,0));
+            _mm_storeu_ps(&dst[i].pos[0], xyzu);
+            _mm_storeu_ps(&dst[i].uv[1], vcpp);
+        }
+        #endif
+        for (; i < num_vertices; i++) {
+            const float* p = &pos[(size_t)i * 3];
+            dst[i].pos[0] = p[0]; dst[i].pos[1] = p[1]; dst[i].pos[2] = p[2];
+            dst[i].uv[0] = uv[(size_t)i * uv_step]; dst[i].uv[1] = uv[(size_t)i * uv_step + 1];
+            dst[i].rgba = color[(size_t)i * color_step];
+            dst[i].psize = psize;
+        }
+    } else {
+        for (; i < num_vertices; i++) {
+            const float* p = &pos[(size_t)i * 2];
+            dst[i].pos[0] = p[0]; dst[i].pos[1] = p[1]; dst[i].pos[2] = 0.0f;
+            dst[i].uv[0] = uv[(size_t)i * uv_step]; dst[i].uv[1] = uv[(size_t)i * uv_step + 1];
+            dst[i].rgba = color[(size_t)i * color_step];
+            dst[i].psize = psize;
+        }
+    }
+}
+
+// bulk vertex submission, tightly packed streams go through
+// _sgl_vertices_packed(), strided streams are copied component by
+// component with a separate loop per vertex attribute
+static void _sgl_vertices(_sgl_context_t* ctx, const sgl_vertex_desc_t* desc, int num_vertices) {
+    SOKOL_ASSERT(ctx->in_begin);
+    SOKOL_ASSERT(desc->pos.ptr);
+    SOKOL_ASSERT((desc->pos_components == 0) || (desc->pos_components == 2) || (desc->pos_components == 3));
+    if (num_vertices <= 0) {
+        return;
+    }
+    if (ctx->line.active) {
+        // tessellated lines are fed point by point
+        const int pos_components = (desc->pos_components == 0) ? 3 : desc->pos_components;
+        const size_t pos_stride = (desc->pos.stride > 0) ? (size_t)desc->pos.stride : (size_t)pos_components * sizeof(float);
+        const size_t uv_stride = (desc->uv.stride > 0) ? (size_t)desc->uv.stride : 2 * sizeof(float);
+        const size_t color_stride = (desc->color.stride > 0) ? (size_t)desc->color.stride : sizeof(uint32_t);
+        for (int i = 0; i < num_vertices; i++) {
+            const float* p = (const float*) ((const uint8_t*)desc->pos.ptr + (size_t)i * pos_stride);
+            const float* uv = desc->uv.ptr ? (const float*) ((const uint8_t*)desc->uv.ptr + (size_t)i * uv_stride) : 0;
+            const uint32_t* c = desc->color.ptr ? (const uint32_t*) ((const uint8_t*)desc->color.ptr + (size_t)i * color_stride) : 0;
+            _sgl_line_vtx(ctx, p[0], p[1], (pos_components == 3) ? p[2] : 0.0f,
+                uv ? uv[0] : ctx->u, uv ? uv[1] : ctx->v,
+                c ? *c : ctx->rgba);
+        }
+        return;
+    }
+    if (((ctx->vertices.next + num_vertices) > ctx->vertices.cap) && !_sgl_grow_vertices(ctx, ctx->vertices.next + num_vertices)) {
+        ctx->error.vertices_full = true;
+        ctx->error.any = true;
+        return;
+    }
+    _sgl_vertex_t* dst = &ctx->vertices.ptr[ctx->vertices.next];
+    ctx->vertices.next += num_vertices;
+
+    const int pos_components = (desc->pos_components == 0) ? 3 : desc->pos_components;
+    const size_t pos_stride = (desc->pos.stride > 0) ? (size_t)desc->pos.stride : (size_t)pos_components * sizeof(float);
+    const bool packed = (pos_stride == ((size_t)pos_components * sizeof(float)))
+        && (!desc->uv.ptr || (desc->uv.stride <= 0) || ((size_t)desc->uv.stride == (2 * sizeof(float))))
+        && (!desc->color.ptr || (desc->color.stride <= 0) || ((size_t)desc->color.stride == sizeof(uint32_t)));
+    if (packed) {
+        _sgl_vertices_packed(ctx, dst, desc, pos_components, num_vertices);
+        return;
+    }
+
+    // positions
+    const uint8_t* pos_ptr = (const uint8_t*) desc->pos.ptr;
+    if (ctx->cpu_transform) {
+        _sgl_xform_t xf;
+        _sgl_xform_init(&xf, _sgl_matrix_modelview(ctx));
+        for (int i = 0; i < num_vertices; i++) {
+            const float* p = (const float*) (pos_ptr + (size_t)i * pos_stride);
+            _sgl_xform_pos(&xf, dst[i].pos, p[0], p[1], (pos_components == 3) ? p[2] : 0.0f);
+        }
+    } else if (pos_components == 3) {
+        for (int i = 0; i < num_vertices; i++) {
+            const float* p = (const float*) (pos_ptr + (size_t)i * pos_stride);
+            dst[i].pos[0] = p[0]; dst[i].pos[1] = p[1]; dst[i].pos[2] = p[2];
+        }
+    } else {
+        for (int i = 0; i < num_vertices; i++) {
+            const float* p = (const float*) (pos_ptr + (size_t)i * pos_stride);
+            dst[i].pos[0] = p[0]; dst[i].pos[1] = p[1]; dst[i].pos[2] = 0.0f;
+        }
+    }
+
+    // texture coordinates
+    if (desc->uv.ptr) {
+        const size_t uv_stride = (desc->uv.stride > 0) ? (size_t)desc->uv.stride : 2 * sizeof(float);
+        const uint8_t* uv_ptr = (const uint8_t*) desc->uv.ptr;
+        for (int i = 0; i < num_vertices; i++) {
+            const float* uv = (const float*) (uv_ptr + (size_t)i * uv_stride);
+            dst[i].uv[0] = uv[0]; dst[i].uv[1] = uv[1];
+        }
+    } else {
+        const float u = ctx->u;
+        const float v = ctx->v;
+        for (int i = 0; i < num_vertices; i++) {
+            dst[i].uv[0] = u; dst[i].uv[1] = v;
+        }
+    }
+
+    // colors and point size
+    if (desc->color.ptr) {
+        const size_t color_stride = (desc->color.stride > 0) ? (size_t)desc->color.stride : sizeof(uint32_t);
+        const uint8_t* color_ptr = (const uint8_t*) desc->color.ptr;
+        for (int i = 0; i < num_vertices; i++) {
+            dst[i].rgba = *(const uint32_t*) (color_ptr + (size_t)i * color_stride);
+        }
+    } else {
+        const uint32_t rgba = ctx->rgba;
+        for (int i = 0; i < num_vertices; i++) {
+            dst[i].rgba = rgba;
+        }
+    }
+    const float psize = ctx->point_size;
+    for (int i = 0; i < num_vertices; i++) {
+        dst[i].psize = psize;
+    }
 }
 
 static void _sgl_identity(_sgl_matrix_t* m) {
@@ -3417,9 +5726,178 @@ static _sgl_matrix_t* _sgl_matrix_modelview(_sgl_context_t* ctx) {
     return &ctx->matrix_stack[SGL_MATRIXMODE_MODELVIEW][ctx->matrix_tos[SGL_MATRIXMODE_MODELVIEW]];
 }
 
-/* get top-of-stack texture matrix */
-static _sgl_matrix_t* _sgl_matrix_texture(_sgl_context_t* ctx) {
-    return &ctx->matrix_stack[SGL_MATRIXMODE_TEXTURE][ctx->matrix_tos[SGL_MATRIXMODE_TEXTURE]];
+/* get top-of-stack texture matrix */
+static _sgl_matrix_t* _sgl_matrix_texture(_sgl_context_t* ctx) {
+    return &ctx->matrix_stack[SGL_MATRIXMODE_TEXTURE][ctx->matrix_tos[SGL_MATRIXMODE_TEXTURE]];
+}
+
+// record the current matrices into a new uniform block
+static void _sgl_push_uniform(_sgl_context_t* ctx, bool with_modelview) {
+    _sgl_uniform_t* uni = _sgl_next_uniform(ctx);
+    if (uni) {
+        if (with_modelview) {
+            _sgl_matmul4(&uni->mvp, _sgl_matrix_projection(ctx), _sgl_matrix_modelview(ctx));
+        } else {
+            uni->mvp = *_sgl_matrix_projection(ctx);
+        }
+        uni->tm = *_sgl_matrix_texture(ctx);
+    }
+}
+
+static void _sgl_begin_display_list(_sgl_context_t* ctx) {
+    SOKOL_ASSERT(!ctx->in_begin && !ctx->dl.active);
+    ctx->dl.active = true;
+    ctx->dl.base_vertex = ctx->vertices.next;
+    ctx->dl.base_uniform = ctx->uniforms.next;
+    ctx->dl.base_command = ctx->commands.next;
+    ctx->dl.base_range = ctx->merge.next;
+    // vertices in display lists are transformed by the matrices active at call time
+    ctx->dl.cpu_transform = ctx->cpu_transform;
+    ctx->cpu_transform = false;
+    ctx->matrix_dirty = true;
+}
+
+// copy the vertices and commands recorded since sgl_begin_display_list()
+// into a new display list
+static uint16_t _sgl_pack_unorm16(float f) {
+    if (f <= 0.0f) {
+        return 0;
+    } else if (f >= 1.0f) {
+        return 0xFFFF;
+    } else {
+        return (uint16_t)(f * 65535.0f + 0.5f);
+    }
+}
+
+// convert vertices into the compact 2D vertex layout
+static void _sgl_pack_compact_vertices(_sgl_compact_vertex_t* dst, const _sgl_vertex_t* src, int num) {
+    for (int i = 0; i < num; i++) {
+        dst[i].pos[0] = src[i].pos[0];
+        dst[i].pos[1] = src[i].pos[1];
+        dst[i].uv[0] = _sgl_pack_unorm16(src[i].uv[0]);
+        dst[i].uv[1] = _sgl_pack_unorm16(src[i].uv[1]);
+        dst[i].rgba = src[i].rgba;
+    }
+}
+
+static sgl_display_list _sgl_make_display_list(_sgl_context_t* ctx) {
+    sgl_display_list list_id = _sgl_make_display_list_id(SG_INVALID_ID);
+    int slot_index = _sgl_pool_alloc_index(&_sgl.dl_pool.pool);
+    if (_SGL_INVALID_SLOT_INDEX == slot_index) {
+        _SGL_ERROR(DISPLAY_LIST_POOL_EXHAUSTED);
+        return list_id;
+    }
+    list_id = _sgl_make_display_list_id(_sgl_slot_alloc(&_sgl.dl_pool.pool, &_sgl.dl_pool.lists[slot_index].slot, slot_index));
+    _sgl_display_list_t* list = _sgl_lookup_display_list(list_id.id);
+    SOKOL_ASSERT(list);
+    list->slot.state = SG_RESOURCESTATE_VALID;
+    list->ctx_id = ctx->slot.id;
+    list->num_commands = ctx->commands.next - ctx->dl.base_command;
+    if (list->num_commands == 0) {
+        return list_id;
+    }
+    list->commands = (_sgl_command_t*) _sgl_malloc((size_t)list->num_commands * sizeof(_sgl_command_t));
+    memcpy(list->commands, &ctx->commands.ptr[ctx->dl.base_command], (size_t)list->num_commands * sizeof(_sgl_command_t));
+    for (int i = 0; i < list->num_commands; i++) {
+        if (list->commands[i].cmd == SGL_COMMAND_DRAW) {
+            list->num_vertices += list->commands[i].args.draw.num_vertices;
+        }
+    }
+    if (list->num_vertices == 0) {
+        return list_id;
+    }
+    // gather the vertices into contiguous per-command ranges (with a merge window,
+    // draw commands may consist of several vertex ranges)
+    _sgl_vertex_t* vertices = (_sgl_vertex_t*) _sgl_malloc((size_t)list->num_vertices * sizeof(_sgl_vertex_t));
+    int dst = 0;
+    for (int i = 0; i < list->num_commands; i++) {
+        _sgl_command_t* cmd = &list->commands[i];
+        if (cmd->cmd != SGL_COMMAND_DRAW) {
+            continue;
+        }
+        _sgl_draw_args_t* args = &cmd->args.draw;
+        if (args->first_range < 0) {
+            memcpy(&vertices[dst], &ctx->vertices.ptr[args->base_vertex], (size_t)args->num_vertices * sizeof(_sgl_vertex_t));
+        } else {
+            int pos = dst;
+            for (int ri = args->first_range; ri >= 0; ri = ctx->merge.ranges[ri].next) {
+                const _sgl_vertex_range_t* r = &ctx->merge.ranges[ri];
+                memcpy(&vertices[pos], &ctx->vertices.ptr[r->base_vertex], (size_t)r->num_vertices * sizeof(_sgl_vertex_t));
+                pos += r->num_vertices;
+            }
+            args->first_range = args->last_range = -1;
+        }
+        args->base_vertex = dst;
+        dst += args->num_vertices;
+    }
+    SOKOL_ASSERT(dst == list->num_vertices);
+    sg_buffer_desc vbuf_desc;
+    _sgl_clear(&vbuf_desc, sizeof(vbuf_desc));
+    vbuf_desc.usage.vertex_buffer = true;
+    if (ctx->compact_vertices) {
+        // a display list never has more vertices than the context vertex buffer
+        SOKOL_ASSERT(list->num_vertices <= ctx->vertices.cap);
+        _sgl_pack_compact_vertices(ctx->compact_vertices, vertices, list->num_vertices);
+        vbuf_desc.data.ptr = ctx->compact_vertices;
+    } else {
+        vbuf_desc.data.ptr = vertices;
+    }
+    vbuf_desc.data.size = (size_t)list->num_vertices * (size_t)ctx->vertex_size;
+    vbuf_desc.label = "sgl-display-list-vertex-buffer";
+    sg_push_debug_group("sokol-gl");
+    list->vbuf = sg_make_buffer(&vbuf_desc);
+    sg_pop_debug_group();
+    _sgl_free(vertices);
+    return list_id;
+}
+
+static sgl_display_list _sgl_end_display_list(_sgl_context_t* ctx) {
+    SOKOL_ASSERT(!ctx->in_begin && ctx->dl.active);
+    sgl_display_list list_id = _sgl_make_display_list_id(SG_INVALID_ID);
+    if (!ctx->error.any) {
+        list_id = _sgl_make_display_list(ctx);
+    }
+    // remove the recorded display list content from the current frame
+    ctx->vertices.next = ctx->dl.base_vertex;
+    ctx->uniforms.next = ctx->dl.base_uniform;
+    ctx->commands.next = ctx->dl.base_command;
+    ctx->merge.next = ctx->dl.base_range;
+    ctx->layers.valid = false;
+    ctx->cpu_transform = ctx->dl.cpu_transform;
+    ctx->matrix_dirty = true;
+    ctx->dl.active = false;
+    return list_id;
+}
+
+static void _sgl_call_display_list(_sgl_context_t* ctx, sgl_display_list list_id) {
+    SOKOL_ASSERT(!ctx->in_begin && !ctx->dl.active);
+    const _sgl_display_list_t* list = _sgl_lookup_display_list(list_id.id);
+    if (!list) {
+        return;
+    }
+    if (list->ctx_id != ctx->slot.id) {
+        _SGL_ERROR(DISPLAY_LIST_WRONG_CONTEXT);
+        return;
+    }
+    if (ctx->cpu_transform) {
+        // the regular uniforms don't contain the modelview matrix, so
+        // display lists need their own uniform block
+        _sgl_push_uniform(ctx, true);
+        ctx->matrix_dirty = true;
+    } else if (ctx->matrix_dirty || (ctx->uniforms.next == 0)) {
+        _sgl_push_uniform(ctx, true);
+        ctx->matrix_dirty = false;
+    }
+    if (ctx->error.any) {
+        return;
+    }
+    _sgl_command_t* cmd = _sgl_next_command(ctx);
+    if (cmd) {
+        cmd->cmd = SGL_COMMAND_DISPLAY_LIST;
+        cmd->layer_id = ctx->layer_id;
+        cmd->args.display_list.list_id = list_id.id;
+        cmd->args.display_list.uniform_index = ctx->uniforms.next - 1;
+    }
 }
 
 /* get pointer to current top-of-stack of current matrix mode */
@@ -3427,6 +5905,15 @@ static _sgl_matrix_t* _sgl_matrix(_sgl_context_t* ctx) {
     return &ctx->matrix_stack[ctx->cur_matrix_mode][ctx->matrix_tos[ctx->cur_matrix_mode]];
 }
 
+/* called when the current matrix has changed, with CPU-side vertex transform
+   a modelview matrix change doesn't require a new uniform block
+*/
+static void _sgl_matrix_changed(_sgl_context_t* ctx) {
+    if (!(ctx->cpu_transform && (ctx->cur_matrix_mode == SGL_MATRIXMODE_MODELVIEW))) {
+        ctx->matrix_dirty = true;
+    }
+}
+
 static sgl_desc_t _sgl_desc_defaults(const sgl_desc_t* desc) {
     SOKOL_ASSERT((desc->allocator.alloc_fn && desc->allocator.free_fn) || (!desc->allocator.alloc_fn && !desc->allocator.free_fn));
     sgl_desc_t res = *desc;
@@ -3434,6 +5921,7 @@ static sgl_desc_t _sgl_desc_defaults(const sgl_desc_t* desc) {
     res.max_commands = _sgl_def(desc->max_commands, _SGL_DEFAULT_MAX_COMMANDS);
     res.context_pool_size = _sgl_def(desc->context_pool_size, _SGL_DEFAULT_CONTEXT_POOL_SIZE);
     res.pipeline_pool_size = _sgl_def(desc->pipeline_pool_size, _SGL_DEFAULT_PIPELINE_POOL_SIZE);
+    res.display_list_pool_size = _sgl_def(desc->display_list_pool_size, _SGL_DEFAULT_DISPLAY_LIST_POOL_SIZE);
     res.face_winding = _sgl_def(desc->face_winding, SG_FACEWINDING_CCW);
     return res;
 }
@@ -3473,7 +5961,26 @@ static void _sgl_setup_common(void) {
     _sgl.def_smp = sg_make_sampler(&smp_desc);
     SOKOL_ASSERT(SG_INVALID_ID != _sgl.def_smp.id);
 
-    // one shader for all contexts
+    // a static index buffer for rendering quads, shared by all contexts
+    const size_t num_quad_indices = _SGL_MAX_QUADS_PER_DRAW * 6;
+    uint16_t* quad_indices = (uint16_t*) _sgl_malloc(num_quad_indices * sizeof(uint16_t));
+    for (int i = 0; i < _SGL_MAX_QUADS_PER_DRAW; i++) {
+        const uint16_t base = (uint16_t)(i * 4);
+        uint16_t* dst = &quad_indices[i * 6];
+        dst[0] = base; dst[1] = (uint16_t)(base + 1); dst[2] = (uint16_t)(base + 2);
+        dst[3] = base; dst[4] = (uint16_t)(base + 2); dst[5] = (uint16_t)(base + 3);
+    }
+    sg_buffer_desc ibuf_desc;
+    _sgl_clear(&ibuf_desc, sizeof(ibuf_desc));
+    ibuf_desc.usage.index_buffer = true;
+    ibuf_desc.data.ptr = quad_indices;
+    ibuf_desc.data.size = num_quad_indices * sizeof(uint16_t);
+    ibuf_desc.label = "sgl-quad-index-buffer";
+    _sgl.quad_ibuf = sg_make_buffer(&ibuf_desc);
+    SOKOL_ASSERT(SG_INVALID_ID != _sgl.quad_ibuf.id);
+    _sgl_free(quad_indices);
+
+    // one shader for all contexts with the standard vertex layout
     sg_shader_desc shd_desc;
     _sgl_clear(&shd_desc, sizeof(shd_desc));
     shd_desc.attrs[0].glsl_name = "position";
@@ -3559,6 +6066,52 @@ static void _sgl_setup_common(void) {
     #endif
     _sgl.shd = sg_make_shader(&shd_desc);
     SOKOL_ASSERT(SG_INVALID_ID != _sgl.shd.id);
+
+    // ...and a shader without point size input for the compact vertex layout,
+    // NOTE: the compact vertex shader for Metal and D3D11 is embedded as source
+    // code, all other shader state is shared with the standard shader
+    _sgl_clear(&shd_desc.attrs[3], sizeof(shd_desc.attrs[3]));
+    shd_desc.label = "sgl-compact-shader";
+    #if defined(SOKOL_GLCORE)
+        shd_desc.vertex_func.source = (const char*)_sgl_shd_compact_vs_source_glsl410;
+        shd_desc.fragment_func.source = (const char*)_sgl_shd_compact_fs_source_glsl410;
+    #elif defined(SOKOL_GLES3)
+        shd_desc.vertex_func.source = (const char*)_sgl_shd_compact_vs_source_glsl300es;
+        shd_desc.fragment_func.source = (const char*)_sgl_shd_compact_fs_source_glsl300es;
+    #elif defined(SOKOL_METAL)
+        shd_desc.vertex_func.bytecode.ptr = 0;
+        shd_desc.vertex_func.bytecode.size = 0;
+        switch (sg_query_backend()) {
+            case SG_BACKEND_METAL_MACOS:
+                shd_desc.vertex_func.source = (const char*)_sgl_shd_compact_vs_source_metal_macos;
+                shd_desc.fragment_func.bytecode = SG_RANGE(_sgl_shd_compact_fs_bytecode_metal_macos);
+                break;
+            case SG_BACKEND_METAL_IOS:
+                shd_desc.vertex_func.source = (const char*)_sgl_shd_compact_vs_source_metal_ios;
+                shd_desc.fragment_func.bytecode = SG_RANGE(_sgl_shd_compact_fs_bytecode_metal_ios);
+                break;
+            default:
+                shd_desc.vertex_func.source = (const char*)_sgl_shd_compact_vs_source_metal_sim;
+                shd_desc.fragment_func.source = (const char*)_sgl_shd_compact_fs_source_metal_sim;
+                break;
+        }
+    #elif defined(SOKOL_D3D11)
+        shd_desc.vertex_func.bytecode.ptr = 0;
+        shd_desc.vertex_func.bytecode.size = 0;
+        shd_desc.vertex_func.source = (const char*)_sgl_shd_compact_vs_source_hlsl4;
+        shd_desc.fragment_func.bytecode = SG_RANGE(_sgl_shd_compact_fs_bytecode_hlsl4);
+    #elif defined(SOKOL_WGPU)
+        shd_desc.vertex_func.source = (const char*)_sgl_shd_compact_vs_source_wgsl;
+        shd_desc.fragment_func.source = (const char*)_sgl_shd_compact_fs_source_wgsl;
+    #elif defined(SOKOL_VULKAN)
+        shd_desc.vertex_func.bytecode = SG_RANGE(_sgl_shd_compact_vs_bytecode_spirv_vk);
+        shd_desc.fragment_func.bytecode = SG_RANGE(_sgl_shd_compact_fs_bytecode_spirv_vk);
+    #else
+        shd_desc.vertex_func.source = _sgl_shd_compact_vs_source_dummy;
+        shd_desc.fragment_func.source = _sgl_shd_compact_fs_source_dummy;
+    #endif
+    _sgl.shd_compact = sg_make_shader(&shd_desc);
+    SOKOL_ASSERT(SG_INVALID_ID != _sgl.shd_compact.id);
     sg_pop_debug_group();
 }
 
@@ -3568,7 +6121,9 @@ static void _sgl_discard_common(void) {
     sg_destroy_view(_sgl.def_view);
     sg_destroy_image(_sgl.def_img);
     sg_destroy_sampler(_sgl.def_smp);
+    sg_destroy_shader(_sgl.shd_compact);
     sg_destroy_shader(_sgl.shd);
+    sg_destroy_buffer(_sgl.quad_ibuf);
     sg_pop_debug_group();
 }
 
@@ -3576,74 +6131,527 @@ static bool _sgl_is_default_context(sgl_context ctx_id) {
     return ctx_id.id == SGL_DEFAULT_CONTEXT.id;
 }
 
-static void _sgl_draw(_sgl_context_t* ctx, int layer_id) {
+typedef struct {
+    uint32_t pip_id;
+    uint32_t tex_id;
+    uint32_t smp_id;
+    uint32_t vbuf_id;       // the context's vertex buffer, or a display list's vertex buffer
+    int uniform_index;
+    int quad_base_vertex;   // -1 if bound without quad index buffer
+    bool base_vertex;       // true if sg_draw_ex() with base_vertex is supported
+} _sgl_draw_state_t;
+
+static void _sgl_draw_vertices(_sgl_context_t* ctx, const _sgl_draw_args_t* args, sg_buffer vbuf, int uniform_index, _sgl_draw_state_t* state) {
+    if (args->pip.id != state->pip_id) {
+        sg_apply_pipeline(args->pip);
+        state->pip_id = args->pip.id;
+        // when pipeline changes, also need to re-apply uniforms and bindings
+        state->tex_id = SG_INVALID_ID;
+        state->smp_id = SG_INVALID_ID;
+        state->uniform_index = -1;
+    }
+    if (state->uniform_index != uniform_index) {
+        const sg_range ub_range = { &ctx->uniforms.ptr[uniform_index], sizeof(_sgl_uniform_t) };
+        sg_apply_uniforms(0, &ub_range);
+        state->uniform_index = uniform_index;
+    }
+    if (args->quads && state->base_vertex) {
+        // quads are rendered as indexed triangles in chunks which fit into
+        // the 16-bit quad index buffer, the chunk's first vertex is selected
+        // with the draw call's base vertex, so that the bindings only need
+        // to be applied once for all quad draws into the same vertex buffer
+        if ((state->tex_id != args->view.id) || (state->smp_id != args->smp.id) || (state->vbuf_id != vbuf.id) || (state->quad_base_vertex != 0)) {
+            ctx->bind.views[0] = args->view;
+            ctx->bind.samplers[0] = args->smp;
+            ctx->bind.vertex_buffers[0] = vbuf;
+            ctx->bind.vertex_buffer_offsets[0] = 0;
+            ctx->bind.index_buffer = _sgl.quad_ibuf;
+            sg_apply_bindings(&ctx->bind);
+            state->tex_id = args->view.id;
+            state->smp_id = args->smp.id;
+            state->vbuf_id = vbuf.id;
+            state->quad_base_vertex = 0;
+        }
+        int num_quads = args->num_vertices / 4;
+        int base_vertex = args->base_vertex;
+        while (num_quads > 0) {
+            const int n = (num_quads < _SGL_MAX_QUADS_PER_DRAW) ? num_quads : _SGL_MAX_QUADS_PER_DRAW;
+            sg_draw_ex(0, n * 6, 1, base_vertex, 0);
+            num_quads -= n;
+            base_vertex += n * 4;
+        }
+    } else if (args->quads) {
+        // fallback if base vertex isn't supported: the vertex buffer offset
+        // selects the chunk's first vertex, which requires applying the
+        // bindings for each quad draw
+        int num_quads = args->num_vertices / 4;
+        int base_vertex = args->base_vertex;
+        while (num_quads > 0) {
+            const int n = (num_quads < _SGL_MAX_QUADS_PER_DRAW) ? num_quads : _SGL_MAX_QUADS_PER_DRAW;
+            if ((state->tex_id != args->view.id) || (state->smp_id != args->smp.id) || (state->vbuf_id != vbuf.id) || (state->quad_base_vertex != base_vertex)) {
+                ctx->bind.views[0] = args->view;
+                ctx->bind.samplers[0] = args->smp;
+                ctx->bind.vertex_buffers[0] = vbuf;
+                ctx->bind.vertex_buffer_offsets[0] = base_vertex * ctx->vertex_size;
+                ctx->bind.index_buffer = _sgl.quad_ibuf;
+                sg_apply_bindings(&ctx->bind);
+                state->tex_id = args->view.id;
+                state->smp_id = args->smp.id;
+                state->vbuf_id = vbuf.id;
+                state->quad_base_vertex = base_vertex;
+            }
+            sg_draw(0, n * 6, 1);
+            num_quads -= n;
+            base_vertex += n * 4;
+        }
+    } else {
+        if ((state->tex_id != args->view.id) || (state->smp_id != args->smp.id) || (state->vbuf_id != vbuf.id) || (state->quad_base_vertex != -1)) {
+            ctx->bind.views[0] = args->view;
+            ctx->bind.samplers[0] = args->smp;
+            ctx->bind.vertex_buffers[0] = vbuf;
+            ctx->bind.vertex_buffer_offsets[0] = 0;
+            ctx->bind.index_buffer.id = SG_INVALID_ID;
+            sg_apply_bindings(&ctx->bind);
+            state->tex_id = args->view.id;
+            state->smp_id = args->smp.id;
+            state->vbuf_id = vbuf.id;
+            state->quad_base_vertex = -1;
+        }
+        // FIXME: what if number of vertices doesn't match the primitive type?
+        if (args->num_vertices > 0) {
+            sg_draw(args->base_vertex, args->num_vertices, 1);
+        }
+    }
+}
+
+static void _sgl_draw_command(_sgl_context_t* ctx, const _sgl_command_t* cmd, _sgl_draw_state_t* state) {
+    switch (cmd->cmd) {
+        case SGL_COMMAND_VIEWPORT:
+            {
+                const _sgl_viewport_args_t* args = &cmd->args.viewport;
+                sg_apply_viewport(args->x, args->y, args->w, args->h, args->origin_top_left);
+            }
+            break;
+        case SGL_COMMAND_SCISSOR_RECT:
+            {
+                const _sgl_scissor_rect_args_t* args = &cmd->args.scissor_rect;
+                sg_apply_scissor_rect(args->x, args->y, args->w, args->h, args->origin_top_left);
+            }
+            break;
+        case SGL_COMMAND_DRAW:
+            _sgl_draw_vertices(ctx, &cmd->args.draw, ctx->vbuf, cmd->args.draw.uniform_index, state);
+            break;
+        case SGL_COMMAND_DISPLAY_LIST:
+            {
+                // a display list which has been destroyed in the meantime is silently skipped
+                const _sgl_display_list_args_t* args = &cmd->args.display_list;
+                const _sgl_display_list_t* list = _sgl_lookup_display_list(args->list_id);
+                if (list) {
+                    for (int i = 0; i < list->num_commands; i++) {
+                        const _sgl_command_t* list_cmd = &list->commands[i];
+                        if (list_cmd->cmd == SGL_COMMAND_DRAW) {
+                            _sgl_draw_vertices(ctx, &list_cmd->args.draw, list->vbuf, args->uniform_index, state);
+                        } else {
+                            SOKOL_ASSERT(list_cmd->cmd != SGL_COMMAND_DISPLAY_LIST);
+                            _sgl_draw_command(ctx, list_cmd, state);
+                        }
+                    }
+                }
+            }
+            break;
+    }
+}
+
+// if draw commands have been merged with non-adjacent vertex ranges, gather
+// the vertices into contiguous per-command ranges and return the vertex data
+// to upload into the vertex buffer
+static sg_range _sgl_gather_vertices(_sgl_context_t* ctx) {
+    sg_range range;
+    if (0 == ctx->merge.next) {
+        range.ptr = ctx->vertices.ptr;
+        range.size = (size_t)ctx->vertices.next * sizeof(_sgl_vertex_t);
+        return range;
+    }
+    int dst = 0;
+    for (int i = 0; i < ctx->commands.next; i++) {
+        _sgl_command_t* cmd = &ctx->commands.ptr[i];
+        if (cmd->cmd != SGL_COMMAND_DRAW) {
+            continue;
+        }
+        _sgl_draw_args_t* args = &cmd->args.draw;
+        if (args->first_range < 0) {
+            memcpy(&ctx->merge.vertices[dst], &ctx->vertices.ptr[args->base_vertex], (size_t)args->num_vertices * sizeof(_sgl_vertex_t));
+        } else {
+            int pos = dst;
+            for (int ri = args->first_range; ri >= 0; ri = ctx->merge.ranges[ri].next) {
+                const _sgl_vertex_range_t* r = &ctx->merge.ranges[ri];
+                memcpy(&ctx->merge.vertices[pos], &ctx->vertices.ptr[r->base_vertex], (size_t)r->num_vertices * sizeof(_sgl_vertex_t));
+                pos += r->num_vertices;
+            }
+            SOKOL_ASSERT((pos - dst) == args->num_vertices);
+            args->first_range = args->last_range = -1;
+        }
+        args->base_vertex = dst;
+        dst += args->num_vertices;
+    }
+    SOKOL_ASSERT(dst <= ctx->vertices.next);
+    ctx->merge.next = 0;
+    range.ptr = ctx->merge.vertices;
+    range.size = (size_t)dst * sizeof(_sgl_vertex_t);
+    return range;
+}
+
+static int _sgl_cmp_layer_items(const void* a, const void* b) {
+    const _sgl_sort_item_t* i0 = (const _sgl_sort_item_t*) a;
+    const _sgl_sort_item_t* i1 = (const _sgl_sort_item_t*) b;
+    if (i0->layer_id != i1->layer_id) {
+        return (i0->layer_id < i1->layer_id) ? -1 : 1;
+    }
+    // keep recording order within a layer
+    return i0->cmd_index - i1->cmd_index;
+}
+
+static int _sgl_cmp_state_items(const void* a, const void* b) {
+    const _sgl_sort_item_t* i0 = (const _sgl_sort_item_t*) a;
+    const _sgl_sort_item_t* i1 = (const _sgl_sort_item_t*) b;
+    if (i0->segment != i1->segment) {
+        return (i0->segment < i1->segment) ? -1 : 1;
+    }
+    if (i0->pip_id != i1->pip_id) {
+        return (i0->pip_id < i1->pip_id) ? -1 : 1;
+    }
+    if (i0->view_id != i1->view_id) {
+        return (i0->view_id < i1->view_id) ? -1 : 1;
+    }
+    if (i0->smp_id != i1->smp_id) {
+        return (i0->smp_id < i1->smp_id) ? -1 : 1;
+    }
+    return i0->cmd_index - i1->cmd_index;
+}
+
+// returns the layer-id of the n-th command in layer order
+static int _sgl_layer_id_at(const _sgl_context_t* ctx, int n) {
+    if (ctx->layers.in_order) {
+        return ctx->commands.ptr[n].layer_id;
+    } else {
+        return ctx->layers.items[n].layer_id;
+    }
+}
+
+// returns the command index of the n-th command in layer order
+static int _sgl_cmd_index_at(const _sgl_context_t* ctx, int n) {
+    if (ctx->layers.in_order) {
+        return n;
+    } else {
+        return ctx->layers.items[n].cmd_index;
+    }
+}
+
+// binary-search the first command in layer order with a layer-id
+// greater-equal (or greater if 'upper' is true) than the provided layer-id
+static int _sgl_bound_layer(const _sgl_context_t* ctx, int layer_id, bool upper) {
+    int lo = 0;
+    int hi = ctx->commands.next;
+    while (lo < hi) {
+        const int mid = lo + (hi - lo) / 2;
+        const int mid_layer_id = _sgl_layer_id_at(ctx, mid);
+        if ((mid_layer_id < layer_id) || (upper && (mid_layer_id == layer_id))) {
+            lo = mid + 1;
+        } else {
+            hi = mid;
+        }
+    }
+    return lo;
+}
+
+// if commands haven't been recorded in ascending layer order, sort them
+// by layer once per recording, so that each layer draw only visits its
+// own commands
+static void _sgl_update_layers(_sgl_context_t* ctx) {
+    if (ctx->layers.in_order || ctx->layers.valid) {
+        return;
+    }
+    if (0 == ctx->layers.items) {
+        ctx->layers.items = (_sgl_sort_item_t*) _sgl_malloc((size_t)ctx->commands.cap * sizeof(_sgl_sort_item_t));
+    }
+    for (int i = 0; i < ctx->commands.next; i++) {
+        _sgl_sort_item_t* item = &ctx->layers.items[i];
+        _sgl_clear(item, sizeof(_sgl_sort_item_t));
+        item->layer_id = ctx->commands.ptr[i].layer_id;
+        item->cmd_index = i;
+    }
+    qsort(ctx->layers.items, (size_t)ctx->commands.next, sizeof(_sgl_sort_item_t), _sgl_cmp_layer_items);
+    ctx->layers.valid = true;
+}
+
+static void _sgl_draw(_sgl_context_t* ctx, int layer_id, bool sort_by_state) {
     SOKOL_ASSERT(ctx);
-    if ((ctx->vertices.next > 0) && (ctx->commands.next > 0)) {
+    // NOTE: display list calls don't record any vertices
+    if (ctx->commands.next > 0) {
+        _sgl_update_layers(ctx);
+        // the range of commands in this layer (in layer order)
+        const int first = _sgl_bound_layer(ctx, layer_id, false);
+        const int end = _sgl_bound_layer(ctx, layer_id, true);
+        if (first == end) {
+            return;
+        }
         sg_push_debug_group("sokol-gl");
 
-        uint32_t cur_pip_id = SG_INVALID_ID;
-        uint32_t cur_tex_id = SG_INVALID_ID;
-        uint32_t cur_smp_id = SG_INVALID_ID;
-        int cur_uniform_index = -1;
+        _sgl_draw_state_t state;
+        state.pip_id = SG_INVALID_ID;
+        state.tex_id = SG_INVALID_ID;
+        state.smp_id = SG_INVALID_ID;
+        state.vbuf_id = SG_INVALID_ID;
+        state.uniform_index = -1;
+        state.quad_base_vertex = -1;
+        state.base_vertex = sg_query_features().draw_base_vertex;
 
         if (ctx->update_frame_id != ctx->frame_id) {
             ctx->update_frame_id = ctx->frame_id;
-            const sg_range range = { ctx->vertices.ptr, (size_t)ctx->vertices.next * sizeof(_sgl_vertex_t) };
-            sg_update_buffer(ctx->vbuf, &range);
+            if (ctx->vbuf_cap < ctx->vertices.cap) {
+                // vertex storage has grown, recreate the vertex buffer
+                sg_destroy_buffer(ctx->vbuf);
+                _sgl_make_vertex_buffer(ctx);
+            }
+            sg_range range = _sgl_gather_vertices(ctx);
+            if (ctx->compact_vertices) {
+                const int num = (int)(range.size / sizeof(_sgl_vertex_t));
+                _sgl_pack_compact_vertices(ctx->compact_vertices, (const _sgl_vertex_t*)range.ptr, num);
+                range.ptr = ctx->compact_vertices;
+                range.size = (size_t)num * sizeof(_sgl_compact_vertex_t);
+            }
+            if (range.size > 0) {
+                sg_update_buffer(ctx->vbuf, &range);
+            }
         }
 
         // render all successfully recorded commands (this may be less than the
         // issued commands if we're in an error state)
-        for (int i = 0; i < ctx->commands.next; i++) {
-            const _sgl_command_t* cmd = &ctx->commands.ptr[i];
-            if (cmd->layer_id != layer_id) {
-                continue;
+        if (sort_by_state) {
+            // sort the layer's draw commands by pipeline and texture to minimize
+            // state changes, viewport and scissor rects start a new segment
+            // and draw commands are never moved across segments
+            if (0 == ctx->layers.scratch) {
+                ctx->layers.scratch = (_sgl_sort_item_t*) _sgl_malloc((size_t)ctx->commands.cap * sizeof(_sgl_sort_item_t));
             }
-            switch (cmd->cmd) {
-                case SGL_COMMAND_VIEWPORT:
-                    {
-                        const _sgl_viewport_args_t* args = &cmd->args.viewport;
-                        sg_apply_viewport(args->x, args->y, args->w, args->h, args->origin_top_left);
-                    }
-                    break;
-                case SGL_COMMAND_SCISSOR_RECT:
-                    {
-                        const _sgl_scissor_rect_args_t* args = &cmd->args.scissor_rect;
-                        sg_apply_scissor_rect(args->x, args->y, args->w, args->h, args->origin_top_left);
-                    }
-                    break;
-                case SGL_COMMAND_DRAW:
-                    {
-                        const _sgl_draw_args_t* args = &cmd->args.draw;
-                        if (args->pip.id != cur_pip_id) {
-                            sg_apply_pipeline(args->pip);
-                            cur_pip_id = args->pip.id;
-                            // when pipeline changes, also need to re-apply uniforms and bindings
-                            cur_tex_id = SG_INVALID_ID;
-                            cur_smp_id = SG_INVALID_ID;
-                            cur_uniform_index = -1;
-                        }
-                        if ((cur_tex_id != args->view.id) || (cur_smp_id != args->smp.id)) {
-                            ctx->bind.views[0] = args->view;
-                            ctx->bind.samplers[0] = args->smp;
-                            sg_apply_bindings(&ctx->bind);
-                            cur_tex_id = args->view.id;
-                            cur_smp_id = args->smp.id;
-                        }
-                        if (cur_uniform_index != args->uniform_index) {
-                            const sg_range ub_range = { &ctx->uniforms.ptr[args->uniform_index], sizeof(_sgl_uniform_t) };
-                            sg_apply_uniforms(0, &ub_range);
-                            cur_uniform_index = args->uniform_index;
-                        }
-                        // FIXME: what if number of vertices doesn't match the primitive type?
-                        if (args->num_vertices > 0) {
-                            sg_draw(args->base_vertex, args->num_vertices, 1);
-                        }
-                    }
-                    break;
+            int segment = 0;
+            for (int i = first; i < end; i++) {
+                const int cmd_index = _sgl_cmd_index_at(ctx, i);
+                const _sgl_command_t* cmd = &ctx->commands.ptr[cmd_index];
+                _sgl_sort_item_t* item = &ctx->layers.scratch[i - first];
+                _sgl_clear(item, sizeof(_sgl_sort_item_t));
+                item->layer_id = layer_id;
+                item->cmd_index = cmd_index;
+                if (cmd->cmd == SGL_COMMAND_DRAW) {
+                    item->pip_id = cmd->args.draw.pip.id;
+                    item->view_id = cmd->args.draw.view.id;
+                    item->smp_id = cmd->args.draw.smp.id;
+                } else {
+                    // viewport, scissor rect and display list commands sort first in their segment
+                    segment++;
+                }
+                item->segment = segment;
+            }
+            qsort(ctx->layers.scratch, (size_t)(end - first), sizeof(_sgl_sort_item_t), _sgl_cmp_state_items);
+            for (int i = 0; i < (end - first); i++) {
+                _sgl_draw_command(ctx, &ctx->commands.ptr[ctx->layers.scratch[i].cmd_index], &state);
+            }
+        } else {
+            for (int i = first; i < end; i++) {
+                _sgl_draw_command(ctx, &ctx->commands.ptr[_sgl_cmd_index_at(ctx, i)], &state);
             }
         }
-        sg_pop_debug_group();
+        sg_pop_debug_group();
+    }
+}
+
+static void _sgl_defaults(_sgl_context_t* ctx) {
+    SOKOL_ASSERT(ctx);
+    SOKOL_ASSERT(!ctx->in_begin);
+    ctx->u = 0.0f; ctx->v = 0.0f;
+    ctx->rgba = 0xFFFFFFFF;
+    ctx->point_size = 1.0f;
+    ctx->line_width = 1.0f;
+    ctx->line_smooth = false;
+    ctx->texturing_enabled = false;
+    ctx->cur_view = _sgl.def_view;
+    ctx->cur_smp = _sgl.def_smp;
+    ctx->pip_stack[ctx->pip_tos] = ctx->def_pip;
+    _sgl_identity(_sgl_matrix_texture(ctx));
+    _sgl_identity(_sgl_matrix_modelview(ctx));
+    _sgl_identity(_sgl_matrix_projection(ctx));
+    ctx->cur_matrix_mode = SGL_MATRIXMODE_MODELVIEW;
+    ctx->matrix_dirty = true;
+}
+
+static void _sgl_viewport(_sgl_context_t* ctx, int x, int y, int w, int h, bool origin_top_left) {
+    SOKOL_ASSERT(ctx);
+    SOKOL_ASSERT(!ctx->in_begin);
+    _sgl_command_t* cmd = _sgl_next_command(ctx);
+    if (cmd) {
+        cmd->cmd = SGL_COMMAND_VIEWPORT;
+        cmd->layer_id = ctx->layer_id;
+        cmd->args.viewport.x = x;
+        cmd->args.viewport.y = y;
+        cmd->args.viewport.w = w;
+        cmd->args.viewport.h = h;
+        cmd->args.viewport.origin_top_left = origin_top_left;
+    }
+}
+
+static void _sgl_scissor_rect(_sgl_context_t* ctx, int x, int y, int w, int h, bool origin_top_left) {
+    SOKOL_ASSERT(ctx);
+    SOKOL_ASSERT(!ctx->in_begin);
+    _sgl_command_t* cmd = _sgl_next_command(ctx);
+    if (cmd) {
+        cmd->cmd = SGL_COMMAND_SCISSOR_RECT;
+        cmd->layer_id = ctx->layer_id;
+        cmd->args.scissor_rect.x = x;
+        cmd->args.scissor_rect.y = y;
+        cmd->args.scissor_rect.w = w;
+        cmd->args.scissor_rect.h = h;
+        cmd->args.scissor_rect.origin_top_left = origin_top_left;
+    }
+}
+
+static void _sgl_texture(_sgl_context_t* ctx, sg_view tex_view, sg_sampler smp) {
+    SOKOL_ASSERT(ctx);
+    SOKOL_ASSERT(!ctx->in_begin);
+    if (SG_INVALID_ID != tex_view.id) {
+        ctx->cur_view = tex_view;
+    } else {
+        ctx->cur_view = _sgl.def_view;
+    }
+    if (SG_INVALID_ID != smp.id) {
+        ctx->cur_smp = smp;
+    } else {
+        ctx->cur_smp = _sgl.def_smp;
+    }
+}
+
+static void _sgl_push_pipeline(_sgl_context_t* ctx) {
+    SOKOL_ASSERT(ctx);
+    if (ctx->pip_tos < (_SGL_MAX_STACK_DEPTH - 1)) {
+        ctx->pip_tos++;
+        ctx->pip_stack[ctx->pip_tos] = ctx->pip_stack[ctx->pip_tos-1];
+    } else {
+        ctx->error.stack_overflow = true;
+        ctx->error.any = true;
+    }
+}
+
+static void _sgl_pop_pipeline(_sgl_context_t* ctx) {
+    SOKOL_ASSERT(ctx);
+    if (ctx->pip_tos > 0) {
+        ctx->pip_tos--;
+    } else {
+        ctx->error.stack_underflow = true;
+        ctx->error.any = true;
+    }
+}
+
+static void _sgl_push_matrix(_sgl_context_t* ctx) {
+    SOKOL_ASSERT(ctx);
+    SOKOL_ASSERT((ctx->cur_matrix_mode >= 0) && (ctx->cur_matrix_mode < SGL_NUM_MATRIXMODES));
+    _sgl_matrix_changed(ctx);
+    if (ctx->matrix_tos[ctx->cur_matrix_mode] < (_SGL_MAX_STACK_DEPTH - 1)) {
+        const _sgl_matrix_t* src = _sgl_matrix(ctx);
+        ctx->matrix_tos[ctx->cur_matrix_mode]++;
+        _sgl_matrix_t* dst = _sgl_matrix(ctx);
+        *dst = *src;
+    } else {
+        ctx->error.stack_overflow = true;
+        ctx->error.any = true;
+    }
+}
+
+static void _sgl_pop_matrix(_sgl_context_t* ctx) {
+    SOKOL_ASSERT(ctx);
+    SOKOL_ASSERT((ctx->cur_matrix_mode >= 0) && (ctx->cur_matrix_mode < SGL_NUM_MATRIXMODES));
+    _sgl_matrix_changed(ctx);
+    if (ctx->matrix_tos[ctx->cur_matrix_mode] > 0) {
+        ctx->matrix_tos[ctx->cur_matrix_mode]--;
+    } else {
+        ctx->error.stack_underflow = true;
+        ctx->error.any = true;
+    }
+}
+
+static void _sgl_end(_sgl_context_t* ctx) {
+    SOKOL_ASSERT(ctx);
+    SOKOL_ASSERT(ctx->in_begin);
+    if (ctx->line.active) {
+        _sgl_end_line_tessellation(ctx);
+    }
+    SOKOL_ASSERT(ctx->vertices.next >= ctx->base_vertex);
+    ctx->in_begin = false;
+    if (ctx->cur_prim_type == SGL_PRIMITIVETYPE_QUADS) {
+        // drop the vertices of an incomplete trailing quad, so that merged
+        // quad draw commands always start at a quad boundary
+        ctx->vertices.next = ctx->base_vertex + ((ctx->vertices.next - ctx->base_vertex) & ~3);
+    }
+
+    bool matrix_dirty = ctx->matrix_dirty;
+    if (matrix_dirty) {
+        ctx->matrix_dirty = false;
+        // with cpu_transform, vertices have already been transformed by the modelview matrix
+        _sgl_push_uniform(ctx, !ctx->cpu_transform);
+    }
+
+    // don't record any new commands when we're in an error state
+    if (ctx->error.any) {
+        return;
+    }
+
+    // check if command can be merged with current command
+    sg_pipeline pip = _sgl_get_pipeline(ctx->pip_stack[ctx->pip_tos], ctx->cur_prim_type);
+    sg_view view = ctx->texturing_enabled ? ctx->cur_view : _sgl.def_view;
+    sg_sampler smp = ctx->texturing_enabled ? ctx->cur_smp : _sgl.def_smp;
+    _sgl_command_t* cur_cmd = _sgl_cur_command(ctx);
+    bool merge_cmd = false;
+    if (cur_cmd) {
+        if ((cur_cmd->cmd == SGL_COMMAND_DRAW) &&
+            (cur_cmd->layer_id == ctx->layer_id) &&
+            (ctx->cur_prim_type != SGL_PRIMITIVETYPE_LINE_STRIP) &&
+            (ctx->cur_prim_type != SGL_PRIMITIVETYPE_TRIANGLE_STRIP) &&
+            !matrix_dirty &&
+            (cur_cmd->args.draw.view.id == view.id) &&
+            (cur_cmd->args.draw.smp.id == smp.id) &&
+            (cur_cmd->args.draw.pip.id == pip.id))
+        {
+            merge_cmd = true;
+        }
+    }
+    if (merge_cmd) {
+        // draw command can be merged with the previous command
+        merge_cmd = _sgl_merge_vertices(ctx, cur_cmd);
+    } else if ((ctx->desc.merge_window > 0) &&
+               (ctx->cur_prim_type != SGL_PRIMITIVETYPE_LINE_STRIP) &&
+               (ctx->cur_prim_type != SGL_PRIMITIVETYPE_TRIANGLE_STRIP))
+    {
+        // optionally look back for a compatible earlier draw command
+        _sgl_command_t* prev_cmd = _sgl_find_merge_command(ctx, pip, view, smp);
+        if (prev_cmd) {
+            merge_cmd = _sgl_merge_vertices(ctx, prev_cmd);
+        }
+    }
+    if (!merge_cmd) {
+        // append a new draw command
+        _sgl_command_t* cmd = _sgl_next_command(ctx);
+        if (cmd) {
+            SOKOL_ASSERT(ctx->uniforms.next > 0);
+            cmd->cmd = SGL_COMMAND_DRAW;
+            cmd->layer_id = ctx->layer_id;
+            cmd->args.draw.view = view;
+            cmd->args.draw.smp = smp;
+            cmd->args.draw.pip = _sgl_get_pipeline(ctx->pip_stack[ctx->pip_tos], ctx->cur_prim_type);
+            cmd->args.draw.base_vertex = ctx->base_vertex;
+            cmd->args.draw.num_vertices = ctx->vertices.next - ctx->base_vertex;
+            cmd->args.draw.uniform_index = ctx->uniforms.next - 1;
+            cmd->args.draw.quads = ctx->cur_prim_type == SGL_PRIMITIVETYPE_QUADS;
+            cmd->args.draw.first_range = -1;
+            cmd->args.draw.last_range = -1;
+        }
     }
 }
 
@@ -3655,6 +6663,10 @@ static sgl_context_desc_t _sgl_as_context_desc(const sgl_desc_t* desc) {
     ctx_desc.color_format = desc->color_format;
     ctx_desc.depth_format = desc->depth_format;
     ctx_desc.sample_count = desc->sample_count;
+    ctx_desc.cpu_transform = desc->cpu_transform;
+    ctx_desc.merge_window = desc->merge_window;
+    ctx_desc.auto_grow = desc->auto_grow;
+    ctx_desc.vertex_layout = desc->vertex_layout;
     return ctx_desc;
 }
 
@@ -3672,6 +6684,7 @@ SOKOL_API_IMPL void sgl_setup(const sgl_desc_t* desc) {
     _sgl.desc = _sgl_desc_defaults(desc);
     _sgl_setup_pipeline_pool(_sgl.desc.pipeline_pool_size);
     _sgl_setup_context_pool(_sgl.desc.context_pool_size);
+    _sgl_setup_display_list_pool(_sgl.desc.display_list_pool_size);
     _sgl_setup_common();
     const sgl_context_desc_t ctx_desc = _sgl_as_context_desc(&_sgl.desc);
     _sgl.def_ctx_id = sgl_make_context(&ctx_desc);
@@ -3692,6 +6705,7 @@ SOKOL_API_IMPL void sgl_shutdown(void) {
     }
     _sgl_discard_context_pool();
     _sgl_discard_pipeline_pool();
+    _sgl_discard_display_list_pool();
     _sgl_discard_common();
     _sgl.init_cookie = 0;
 }
@@ -3785,6 +6799,30 @@ SOKOL_API_IMPL int sgl_num_commands(void) {
     }
 }
 
+SOKOL_API_IMPL sgl_stats_t sgl_query_stats(void) {
+    SOKOL_ASSERT(_SGL_INIT_COOKIE == _sgl.init_cookie);
+    _sgl_context_t* ctx = _sgl.cur_ctx;
+    if (ctx) {
+        return _sgl_query_stats(ctx);
+    } else {
+        sgl_stats_t stats;
+        _sgl_clear(&stats, sizeof(stats));
+        return stats;
+    }
+}
+
+SOKOL_API_IMPL sgl_stats_t sgl_context_query_stats(sgl_context ctx_id) {
+    SOKOL_ASSERT(_SGL_INIT_COOKIE == _sgl.init_cookie);
+    _sgl_context_t* ctx = _sgl_lookup_context(ctx_id.id);
+    if (ctx) {
+        return _sgl_query_stats(ctx);
+    } else {
+        sgl_stats_t stats;
+        _sgl_clear(&stats, sizeof(stats));
+        return stats;
+    }
+}
+
 SOKOL_API_IMPL sgl_pipeline sgl_make_pipeline(const sg_pipeline_desc* desc) {
     SOKOL_ASSERT(_SGL_INIT_COOKIE == _sgl.init_cookie);
     _sgl_context_t* ctx = _sgl.cur_ctx;
@@ -3820,6 +6858,16 @@ SOKOL_API_IMPL void sgl_load_pipeline(sgl_pipeline pip_id) {
     ctx->pip_stack[ctx->pip_tos] = pip_id;
 }
 
+SOKOL_API_IMPL void sgl_context_load_pipeline(sgl_context ctx_id, sgl_pipeline pip_id) {
+    SOKOL_ASSERT(_SGL_INIT_COOKIE == _sgl.init_cookie);
+    _sgl_context_t* ctx = _sgl_lookup_context(ctx_id.id);
+    if (!ctx) {
+        return;
+    }
+    SOKOL_ASSERT((ctx->pip_tos >= 0) && (ctx->pip_tos < _SGL_MAX_STACK_DEPTH));
+    ctx->pip_stack[ctx->pip_tos] = pip_id;
+}
+
 SOKOL_API_IMPL void sgl_load_default_pipeline(void) {
     SOKOL_ASSERT(_SGL_INIT_COOKIE == _sgl.init_cookie);
     _sgl_context_t* ctx = _sgl.cur_ctx;
@@ -3830,82 +6878,157 @@ SOKOL_API_IMPL void sgl_load_default_pipeline(void) {
     ctx->pip_stack[ctx->pip_tos] = ctx->def_pip;
 }
 
-SOKOL_API_IMPL void sgl_push_pipeline(void) {
+SOKOL_API_IMPL void sgl_context_load_default_pipeline(sgl_context ctx_id) {
     SOKOL_ASSERT(_SGL_INIT_COOKIE == _sgl.init_cookie);
-    _sgl_context_t* ctx = _sgl.cur_ctx;
+    _sgl_context_t* ctx = _sgl_lookup_context(ctx_id.id);
     if (!ctx) {
         return;
     }
-    if (ctx->pip_tos < (_SGL_MAX_STACK_DEPTH - 1)) {
-        ctx->pip_tos++;
-        ctx->pip_stack[ctx->pip_tos] = ctx->pip_stack[ctx->pip_tos-1];
-    } else {
-        ctx->error.stack_overflow = true;
-        ctx->error.any = true;
+    SOKOL_ASSERT((ctx->pip_tos >= 0) && (ctx->pip_tos < _SGL_MAX_STACK_DEPTH));
+    ctx->pip_stack[ctx->pip_tos] = ctx->def_pip;
+}
+
+SOKOL_API_IMPL void sgl_push_pipeline(void) {
+    SOKOL_ASSERT(_SGL_INIT_COOKIE == _sgl.init_cookie);
+    _sgl_context_t* ctx = _sgl.cur_ctx;
+    if (ctx) {
+        _sgl_push_pipeline(ctx);
+    }
+}
+
+SOKOL_API_IMPL void sgl_context_push_pipeline(sgl_context ctx_id) {
+    SOKOL_ASSERT(_SGL_INIT_COOKIE == _sgl.init_cookie);
+    _sgl_context_t* ctx = _sgl_lookup_context(ctx_id.id);
+    if (ctx) {
+        _sgl_push_pipeline(ctx);
     }
 }
 
 SOKOL_API_IMPL void sgl_pop_pipeline(void) {
+    SOKOL_ASSERT(_SGL_INIT_COOKIE == _sgl.init_cookie);
+    _sgl_context_t* ctx = _sgl.cur_ctx;
+    if (ctx) {
+        _sgl_pop_pipeline(ctx);
+    }
+}
+
+SOKOL_API_IMPL void sgl_context_pop_pipeline(sgl_context ctx_id) {
+    SOKOL_ASSERT(_SGL_INIT_COOKIE == _sgl.init_cookie);
+    _sgl_context_t* ctx = _sgl_lookup_context(ctx_id.id);
+    if (ctx) {
+        _sgl_pop_pipeline(ctx);
+    }
+}
+
+SOKOL_API_IMPL void sgl_defaults(void) {
+    SOKOL_ASSERT(_SGL_INIT_COOKIE == _sgl.init_cookie);
+    _sgl_context_t* ctx = _sgl.cur_ctx;
+    if (ctx) {
+        _sgl_defaults(ctx);
+    }
+}
+
+SOKOL_API_IMPL void sgl_context_defaults(sgl_context ctx_id) {
+    SOKOL_ASSERT(_SGL_INIT_COOKIE == _sgl.init_cookie);
+    _sgl_context_t* ctx = _sgl_lookup_context(ctx_id.id);
+    if (ctx) {
+        _sgl_defaults(ctx);
+    }
+}
+
+SOKOL_API_IMPL void sgl_layer(int layer_id) {
     SOKOL_ASSERT(_SGL_INIT_COOKIE == _sgl.init_cookie);
     _sgl_context_t* ctx = _sgl.cur_ctx;
     if (!ctx) {
         return;
     }
-    if (ctx->pip_tos > 0) {
-        ctx->pip_tos--;
-    } else {
-        ctx->error.stack_underflow = true;
-        ctx->error.any = true;
+    SOKOL_ASSERT(!ctx->in_begin);
+    ctx->layer_id = layer_id;
+}
+
+SOKOL_API_IMPL void sgl_context_layer(sgl_context ctx_id, int layer_id) {
+    SOKOL_ASSERT(_SGL_INIT_COOKIE == _sgl.init_cookie);
+    _sgl_context_t* ctx = _sgl_lookup_context(ctx_id.id);
+    if (!ctx) {
+        return;
     }
+    SOKOL_ASSERT(!ctx->in_begin);
+    ctx->layer_id = layer_id;
 }
 
-SOKOL_API_IMPL void sgl_defaults(void) {
+SOKOL_API_IMPL void sgl_line_width(float w) {
     SOKOL_ASSERT(_SGL_INIT_COOKIE == _sgl.init_cookie);
     _sgl_context_t* ctx = _sgl.cur_ctx;
     if (!ctx) {
         return;
     }
     SOKOL_ASSERT(!ctx->in_begin);
-    ctx->u = 0.0f; ctx->v = 0.0f;
-    ctx->rgba = 0xFFFFFFFF;
-    ctx->point_size = 1.0f;
-    ctx->texturing_enabled = false;
-    ctx->cur_view = _sgl.def_view;
-    ctx->cur_smp = _sgl.def_smp;
-    sgl_load_default_pipeline();
-    _sgl_identity(_sgl_matrix_texture(ctx));
-    _sgl_identity(_sgl_matrix_modelview(ctx));
-    _sgl_identity(_sgl_matrix_projection(ctx));
-    ctx->cur_matrix_mode = SGL_MATRIXMODE_MODELVIEW;
-    ctx->matrix_dirty = true;
+    ctx->line_width = w;
 }
 
-SOKOL_API_IMPL void sgl_layer(int layer_id) {
+SOKOL_API_IMPL void sgl_context_line_width(sgl_context ctx_id, float w) {
+    SOKOL_ASSERT(_SGL_INIT_COOKIE == _sgl.init_cookie);
+    _sgl_context_t* ctx = _sgl_lookup_context(ctx_id.id);
+    if (!ctx) {
+        return;
+    }
+    SOKOL_ASSERT(!ctx->in_begin);
+    ctx->line_width = w;
+}
+
+SOKOL_API_IMPL void sgl_enable_line_smooth(void) {
     SOKOL_ASSERT(_SGL_INIT_COOKIE == _sgl.init_cookie);
     _sgl_context_t* ctx = _sgl.cur_ctx;
     if (!ctx) {
         return;
     }
     SOKOL_ASSERT(!ctx->in_begin);
-    ctx->layer_id = layer_id;
+    ctx->line_smooth = true;
 }
 
-SOKOL_API_IMPL void sgl_viewport(int x, int y, int w, int h, bool origin_top_left) {
+SOKOL_API_IMPL void sgl_context_enable_line_smooth(sgl_context ctx_id) {
+    SOKOL_ASSERT(_SGL_INIT_COOKIE == _sgl.init_cookie);
+    _sgl_context_t* ctx = _sgl_lookup_context(ctx_id.id);
+    if (!ctx) {
+        return;
+    }
+    SOKOL_ASSERT(!ctx->in_begin);
+    ctx->line_smooth = true;
+}
+
+SOKOL_API_IMPL void sgl_disable_line_smooth(void) {
     SOKOL_ASSERT(_SGL_INIT_COOKIE == _sgl.init_cookie);
     _sgl_context_t* ctx = _sgl.cur_ctx;
     if (!ctx) {
         return;
     }
     SOKOL_ASSERT(!ctx->in_begin);
-    _sgl_command_t* cmd = _sgl_next_command(ctx);
-    if (cmd) {
-        cmd->cmd = SGL_COMMAND_VIEWPORT;
-        cmd->layer_id = ctx->layer_id;
-        cmd->args.viewport.x = x;
-        cmd->args.viewport.y = y;
-        cmd->args.viewport.w = w;
-        cmd->args.viewport.h = h;
-        cmd->args.viewport.origin_top_left = origin_top_left;
+    ctx->line_smooth = false;
+}
+
+SOKOL_API_IMPL void sgl_context_disable_line_smooth(sgl_context ctx_id) {
+    SOKOL_ASSERT(_SGL_INIT_COOKIE == _sgl.init_cookie);
+    _sgl_context_t* ctx = _sgl_lookup_context(ctx_id.id);
+    if (!ctx) {
+        return;
+    }
+    SOKOL_ASSERT(!ctx->in_begin);
+    ctx->line_smooth = false;
+}
+
+SOKOL_API_IMPL void sgl_viewport(int x, int y, int w, int h, bool origin_top_left) {
+    SOKOL_ASSERT(_SGL_INIT_COOKIE == _sgl.init_cookie);
+    _sgl_context_t* ctx = _sgl.cur_ctx;
+    if (ctx) {
+        _sgl_viewport(ctx, x, y, w, h, origin_top_left);
+    }
+}
+
+SOKOL_API_IMPL void sgl_context_viewport(sgl_context ctx_id, int x, int y, int w, int h, bool origin_top_left) {
+    SOKOL_ASSERT(_SGL_INIT_COOKIE == _sgl.init_cookie);
+    _sgl_context_t* ctx = _sgl_lookup_context(ctx_id.id);
+    if (ctx) {
+        _sgl_viewport(ctx, x, y, w, h, origin_top_left);
     }
 }
 
@@ -3913,111 +7036,183 @@ SOKOL_API_IMPL void sgl_viewportf(float x, float y, float w, float h, bool origi
     sgl_viewport((int)x, (int)y, (int)w, (int)h, origin_top_left);
 }
 
+SOKOL_API_IMPL void sgl_context_viewportf(sgl_context ctx_id, float x, float y, float w, float h, bool origin_top_left) {
+    sgl_context_viewport(ctx_id, (int)x, (int)y, (int)w, (int)h, origin_top_left);
+}
+
 SOKOL_API_IMPL void sgl_scissor_rect(int x, int y, int w, int h, bool origin_top_left) {
+    SOKOL_ASSERT(_SGL_INIT_COOKIE == _sgl.init_cookie);
+    _sgl_context_t* ctx = _sgl.cur_ctx;
+    if (ctx) {
+        _sgl_scissor_rect(ctx, x, y, w, h, origin_top_left);
+    }
+}
+
+SOKOL_API_IMPL void sgl_context_scissor_rect(sgl_context ctx_id, int x, int y, int w, int h, bool origin_top_left) {
+    SOKOL_ASSERT(_SGL_INIT_COOKIE == _sgl.init_cookie);
+    _sgl_context_t* ctx = _sgl_lookup_context(ctx_id.id);
+    if (ctx) {
+        _sgl_scissor_rect(ctx, x, y, w, h, origin_top_left);
+    }
+}
+
+SOKOL_API_IMPL void sgl_scissor_rectf(float x, float y, float w, float h, bool origin_top_left) {
+    sgl_scissor_rect((int)x, (int)y, (int)w, (int)h, origin_top_left);
+}
+
+SOKOL_API_IMPL void sgl_context_scissor_rectf(sgl_context ctx_id, float x, float y, float w, float h, bool origin_top_left) {
+    sgl_context_scissor_rect(ctx_id, (int)x, (int)y, (int)w, (int)h, origin_top_left);
+}
+
+SOKOL_API_IMPL void sgl_enable_texture(void) {
     SOKOL_ASSERT(_SGL_INIT_COOKIE == _sgl.init_cookie);
     _sgl_context_t* ctx = _sgl.cur_ctx;
     if (!ctx) {
         return;
     }
     SOKOL_ASSERT(!ctx->in_begin);
-    _sgl_command_t* cmd = _sgl_next_command(ctx);
-    if (cmd) {
-        cmd->cmd = SGL_COMMAND_SCISSOR_RECT;
-        cmd->layer_id = ctx->layer_id;
-        cmd->args.scissor_rect.x = x;
-        cmd->args.scissor_rect.y = y;
-        cmd->args.scissor_rect.w = w;
-        cmd->args.scissor_rect.h = h;
-        cmd->args.scissor_rect.origin_top_left = origin_top_left;
+    ctx->texturing_enabled = true;
+}
+
+SOKOL_API_IMPL void sgl_context_enable_texture(sgl_context ctx_id) {
+    SOKOL_ASSERT(_SGL_INIT_COOKIE == _sgl.init_cookie);
+    _sgl_context_t* ctx = _sgl_lookup_context(ctx_id.id);
+    if (!ctx) {
+        return;
     }
+    SOKOL_ASSERT(!ctx->in_begin);
+    ctx->texturing_enabled = true;
 }
 
-SOKOL_API_IMPL void sgl_scissor_rectf(float x, float y, float w, float h, bool origin_top_left) {
-    sgl_scissor_rect((int)x, (int)y, (int)w, (int)h, origin_top_left);
+SOKOL_API_IMPL void sgl_disable_texture(void) {
+    SOKOL_ASSERT(_SGL_INIT_COOKIE == _sgl.init_cookie);
+    _sgl_context_t* ctx = _sgl.cur_ctx;
+    if (!ctx) {
+        return;
+    }
+    SOKOL_ASSERT(!ctx->in_begin);
+    ctx->texturing_enabled = false;
+}
+
+SOKOL_API_IMPL void sgl_context_disable_texture(sgl_context ctx_id) {
+    SOKOL_ASSERT(_SGL_INIT_COOKIE == _sgl.init_cookie);
+    _sgl_context_t* ctx = _sgl_lookup_context(ctx_id.id);
+    if (!ctx) {
+        return;
+    }
+    SOKOL_ASSERT(!ctx->in_begin);
+    ctx->texturing_enabled = false;
+}
+
+SOKOL_API_IMPL void sgl_texture(sg_view tex_view, sg_sampler smp) {
+    SOKOL_ASSERT(_SGL_INIT_COOKIE == _sgl.init_cookie);
+    _sgl_context_t* ctx = _sgl.cur_ctx;
+    if (ctx) {
+        _sgl_texture(ctx, tex_view, smp);
+    }
+}
+
+SOKOL_API_IMPL void sgl_context_texture(sgl_context ctx_id, sg_view tex_view, sg_sampler smp) {
+    SOKOL_ASSERT(_SGL_INIT_COOKIE == _sgl.init_cookie);
+    _sgl_context_t* ctx = _sgl_lookup_context(ctx_id.id);
+    if (ctx) {
+        _sgl_texture(ctx, tex_view, smp);
+    }
+}
+
+SOKOL_API_IMPL void sgl_begin_points(void) {
+    SOKOL_ASSERT(_SGL_INIT_COOKIE == _sgl.init_cookie);
+    _sgl_context_t* ctx = _sgl.cur_ctx;
+    if (!ctx) {
+        return;
+    }
+    SOKOL_ASSERT(!ctx->in_begin);
+    _sgl_begin(ctx, SGL_PRIMITIVETYPE_POINTS);
+}
+
+SOKOL_API_IMPL void sgl_context_begin_points(sgl_context ctx_id) {
+    SOKOL_ASSERT(_SGL_INIT_COOKIE == _sgl.init_cookie);
+    _sgl_context_t* ctx = _sgl_lookup_context(ctx_id.id);
+    if (!ctx) {
+        return;
+    }
+    SOKOL_ASSERT(!ctx->in_begin);
+    _sgl_begin(ctx, SGL_PRIMITIVETYPE_POINTS);
 }
 
-SOKOL_API_IMPL void sgl_enable_texture(void) {
+SOKOL_API_IMPL void sgl_begin_lines(void) {
     SOKOL_ASSERT(_SGL_INIT_COOKIE == _sgl.init_cookie);
     _sgl_context_t* ctx = _sgl.cur_ctx;
     if (!ctx) {
         return;
     }
     SOKOL_ASSERT(!ctx->in_begin);
-    ctx->texturing_enabled = true;
+    _sgl_begin(ctx, SGL_PRIMITIVETYPE_LINES);
 }
 
-SOKOL_API_IMPL void sgl_disable_texture(void) {
+SOKOL_API_IMPL void sgl_context_begin_lines(sgl_context ctx_id) {
     SOKOL_ASSERT(_SGL_INIT_COOKIE == _sgl.init_cookie);
-    _sgl_context_t* ctx = _sgl.cur_ctx;
+    _sgl_context_t* ctx = _sgl_lookup_context(ctx_id.id);
     if (!ctx) {
         return;
     }
     SOKOL_ASSERT(!ctx->in_begin);
-    ctx->texturing_enabled = false;
+    _sgl_begin(ctx, SGL_PRIMITIVETYPE_LINES);
 }
 
-SOKOL_API_IMPL void sgl_texture(sg_view tex_view, sg_sampler smp) {
+SOKOL_API_IMPL void sgl_begin_line_strip(void) {
     SOKOL_ASSERT(_SGL_INIT_COOKIE == _sgl.init_cookie);
     _sgl_context_t* ctx = _sgl.cur_ctx;
     if (!ctx) {
         return;
     }
     SOKOL_ASSERT(!ctx->in_begin);
-    if (SG_INVALID_ID != tex_view.id) {
-        ctx->cur_view = tex_view;
-    } else {
-        ctx->cur_view = _sgl.def_view;
-    }
-    if (SG_INVALID_ID != smp.id) {
-        ctx->cur_smp = smp;
-    } else {
-        ctx->cur_smp = _sgl.def_smp;
-    }
+    _sgl_begin(ctx, SGL_PRIMITIVETYPE_LINE_STRIP);
 }
 
-SOKOL_API_IMPL void sgl_begin_points(void) {
+SOKOL_API_IMPL void sgl_context_begin_line_strip(sgl_context ctx_id) {
     SOKOL_ASSERT(_SGL_INIT_COOKIE == _sgl.init_cookie);
-    _sgl_context_t* ctx = _sgl.cur_ctx;
+    _sgl_context_t* ctx = _sgl_lookup_context(ctx_id.id);
     if (!ctx) {
         return;
     }
     SOKOL_ASSERT(!ctx->in_begin);
-    _sgl_begin(ctx, SGL_PRIMITIVETYPE_POINTS);
+    _sgl_begin(ctx, SGL_PRIMITIVETYPE_LINE_STRIP);
 }
 
-SOKOL_API_IMPL void sgl_begin_lines(void) {
+SOKOL_API_IMPL void sgl_begin_triangles(void) {
     SOKOL_ASSERT(_SGL_INIT_COOKIE == _sgl.init_cookie);
     _sgl_context_t* ctx = _sgl.cur_ctx;
     if (!ctx) {
         return;
     }
     SOKOL_ASSERT(!ctx->in_begin);
-    _sgl_begin(ctx, SGL_PRIMITIVETYPE_LINES);
+    _sgl_begin(ctx, SGL_PRIMITIVETYPE_TRIANGLES);
 }
 
-SOKOL_API_IMPL void sgl_begin_line_strip(void) {
+SOKOL_API_IMPL void sgl_context_begin_triangles(sgl_context ctx_id) {
     SOKOL_ASSERT(_SGL_INIT_COOKIE == _sgl.init_cookie);
-    _sgl_context_t* ctx = _sgl.cur_ctx;
+    _sgl_context_t* ctx = _sgl_lookup_context(ctx_id.id);
     if (!ctx) {
         return;
     }
     SOKOL_ASSERT(!ctx->in_begin);
-    _sgl_begin(ctx, SGL_PRIMITIVETYPE_LINE_STRIP);
+    _sgl_begin(ctx, SGL_PRIMITIVETYPE_TRIANGLES);
 }
 
-SOKOL_API_IMPL void sgl_begin_triangles(void) {
+SOKOL_API_IMPL void sgl_begin_triangle_strip(void) {
     SOKOL_ASSERT(_SGL_INIT_COOKIE == _sgl.init_cookie);
     _sgl_context_t* ctx = _sgl.cur_ctx;
     if (!ctx) {
         return;
     }
     SOKOL_ASSERT(!ctx->in_begin);
-    _sgl_begin(ctx, SGL_PRIMITIVETYPE_TRIANGLES);
+    _sgl_begin(ctx, SGL_PRIMITIVETYPE_TRIANGLE_STRIP);
 }
 
-SOKOL_API_IMPL void sgl_begin_triangle_strip(void) {
+SOKOL_API_IMPL void sgl_context_begin_triangle_strip(sgl_context ctx_id) {
     SOKOL_ASSERT(_SGL_INIT_COOKIE == _sgl.init_cookie);
-    _sgl_context_t* ctx = _sgl.cur_ctx;
+    _sgl_context_t* ctx = _sgl_lookup_context(ctx_id.id);
     if (!ctx) {
         return;
     }
@@ -4035,67 +7230,86 @@ SOKOL_API_IMPL void sgl_begin_quads(void) {
     _sgl_begin(ctx, SGL_PRIMITIVETYPE_QUADS);
 }
 
-SOKOL_API_IMPL void sgl_end(void) {
+SOKOL_API_IMPL void sgl_context_begin_quads(sgl_context ctx_id) {
     SOKOL_ASSERT(_SGL_INIT_COOKIE == _sgl.init_cookie);
-    _sgl_context_t* ctx = _sgl.cur_ctx;
+    _sgl_context_t* ctx = _sgl_lookup_context(ctx_id.id);
     if (!ctx) {
         return;
     }
-    SOKOL_ASSERT(ctx->in_begin);
-    SOKOL_ASSERT(ctx->vertices.next >= ctx->base_vertex);
-    ctx->in_begin = false;
+    SOKOL_ASSERT(!ctx->in_begin);
+    _sgl_begin(ctx, SGL_PRIMITIVETYPE_QUADS);
+}
 
-    bool matrix_dirty = ctx->matrix_dirty;
-    if (matrix_dirty) {
-        ctx->matrix_dirty = false;
-        _sgl_uniform_t* uni = _sgl_next_uniform(ctx);
-        if (uni) {
-            _sgl_matmul4(&uni->mvp, _sgl_matrix_projection(ctx), _sgl_matrix_modelview(ctx));
-            uni->tm = *_sgl_matrix_texture(ctx);
-        }
+SOKOL_API_IMPL void sgl_vertices(const sgl_vertex_desc_t* desc, int num_vertices) {
+    SOKOL_ASSERT(_SGL_INIT_COOKIE == _sgl.init_cookie);
+    SOKOL_ASSERT(desc);
+    _sgl_context_t* ctx = _sgl.cur_ctx;
+    if (ctx) {
+        _sgl_vertices(ctx, desc, num_vertices);
     }
+}
 
-    // don't record any new commands when we're in an error state
-    if (ctx->error.any) {
-        return;
+SOKOL_API_IMPL void sgl_context_vertices(sgl_context ctx_id, const sgl_vertex_desc_t* desc, int num_vertices) {
+    SOKOL_ASSERT(_SGL_INIT_COOKIE == _sgl.init_cookie);
+    SOKOL_ASSERT(desc);
+    _sgl_context_t* ctx = _sgl_lookup_context(ctx_id.id);
+    if (ctx) {
+        _sgl_vertices(ctx, desc, num_vertices);
     }
+}
 
-    // check if command can be merged with current command
-    sg_pipeline pip = _sgl_get_pipeline(ctx->pip_stack[ctx->pip_tos], ctx->cur_prim_type);
-    sg_view view = ctx->texturing_enabled ? ctx->cur_view : _sgl.def_view;
-    sg_sampler smp = ctx->texturing_enabled ? ctx->cur_smp : _sgl.def_smp;
-    _sgl_command_t* cur_cmd = _sgl_cur_command(ctx);
-    bool merge_cmd = false;
-    if (cur_cmd) {
-        if ((cur_cmd->cmd == SGL_COMMAND_DRAW) &&
-            (cur_cmd->layer_id == ctx->layer_id) &&
-            (ctx->cur_prim_type != SGL_PRIMITIVETYPE_LINE_STRIP) &&
-            (ctx->cur_prim_type != SGL_PRIMITIVETYPE_TRIANGLE_STRIP) &&
-            !matrix_dirty &&
-            (cur_cmd->args.draw.view.id == view.id) &&
-            (cur_cmd->args.draw.smp.id == smp.id) &&
-            (cur_cmd->args.draw.pip.id == pip.id))
-        {
-            merge_cmd = true;
-        }
+SOKOL_API_IMPL void sgl_begin_display_list(void) {
+    SOKOL_ASSERT(_SGL_INIT_COOKIE == _sgl.init_cookie);
+    _sgl_context_t* ctx = _sgl.cur_ctx;
+    if (ctx) {
+        _sgl_begin_display_list(ctx);
     }
-    if (merge_cmd) {
-        // draw command can be merged with the previous command
-        cur_cmd->args.draw.num_vertices += ctx->vertices.next - ctx->base_vertex;
+}
+
+SOKOL_API_IMPL sgl_display_list sgl_end_display_list(void) {
+    SOKOL_ASSERT(_SGL_INIT_COOKIE == _sgl.init_cookie);
+    _sgl_context_t* ctx = _sgl.cur_ctx;
+    if (ctx) {
+        return _sgl_end_display_list(ctx);
     } else {
-        // append a new draw command
-        _sgl_command_t* cmd = _sgl_next_command(ctx);
-        if (cmd) {
-            SOKOL_ASSERT(ctx->uniforms.next > 0);
-            cmd->cmd = SGL_COMMAND_DRAW;
-            cmd->layer_id = ctx->layer_id;
-            cmd->args.draw.view = view;
-            cmd->args.draw.smp = smp;
-            cmd->args.draw.pip = _sgl_get_pipeline(ctx->pip_stack[ctx->pip_tos], ctx->cur_prim_type);
-            cmd->args.draw.base_vertex = ctx->base_vertex;
-            cmd->args.draw.num_vertices = ctx->vertices.next - ctx->base_vertex;
-            cmd->args.draw.uniform_index = ctx->uniforms.next - 1;
-        }
+        return _sgl_make_display_list_id(SG_INVALID_ID);
+    }
+}
+
+SOKOL_API_IMPL void sgl_call_display_list(sgl_display_list list_id) {
+    SOKOL_ASSERT(_SGL_INIT_COOKIE == _sgl.init_cookie);
+    _sgl_context_t* ctx = _sgl.cur_ctx;
+    if (ctx) {
+        _sgl_call_display_list(ctx, list_id);
+    }
+}
+
+SOKOL_API_IMPL void sgl_context_call_display_list(sgl_context ctx_id, sgl_display_list list_id) {
+    SOKOL_ASSERT(_SGL_INIT_COOKIE == _sgl.init_cookie);
+    _sgl_context_t* ctx = _sgl_lookup_context(ctx_id.id);
+    if (ctx) {
+        _sgl_call_display_list(ctx, list_id);
+    }
+}
+
+SOKOL_API_IMPL void sgl_destroy_display_list(sgl_display_list list_id) {
+    SOKOL_ASSERT(_SGL_INIT_COOKIE == _sgl.init_cookie);
+    _sgl_destroy_display_list(list_id);
+}
+
+SOKOL_API_IMPL void sgl_end(void) {
+    SOKOL_ASSERT(_SGL_INIT_COOKIE == _sgl.init_cookie);
+    _sgl_context_t* ctx = _sgl.cur_ctx;
+    if (ctx) {
+        _sgl_end(ctx);
+    }
+}
+
+SOKOL_API_IMPL void sgl_context_end(sgl_context ctx_id) {
+    SOKOL_ASSERT(_SGL_INIT_COOKIE == _sgl.init_cookie);
+    _sgl_context_t* ctx = _sgl_lookup_context(ctx_id.id);
+    if (ctx) {
+        _sgl_end(ctx);
     }
 }
 
@@ -4106,6 +7320,13 @@ SOKOL_API_IMPL void sgl_point_size(float s) {
     }
 }
 
+SOKOL_API_IMPL void sgl_context_point_size(sgl_context ctx_id, float s) {
+    _sgl_context_t* ctx = _sgl_lookup_context(ctx_id.id);
+    if (ctx) {
+        ctx->point_size = s;
+    }
+}
+
 SOKOL_API_IMPL void sgl_t2f(float u, float v) {
     _sgl_context_t* ctx = _sgl.cur_ctx;
     if (ctx) {
@@ -4114,6 +7335,14 @@ SOKOL_API_IMPL void sgl_t2f(float u, float v) {
     }
 }
 
+SOKOL_API_IMPL void sgl_context_t2f(sgl_context ctx_id, float u, float v) {
+    _sgl_context_t* ctx = _sgl_lookup_context(ctx_id.id);
+    if (ctx) {
+        ctx->u = u;
+        ctx->v = v;
+    }
+}
+
 SOKOL_API_IMPL void sgl_c3f(float r, float g, float b) {
     _sgl_context_t* ctx = _sgl.cur_ctx;
     if (ctx) {
@@ -4121,6 +7350,13 @@ SOKOL_API_IMPL void sgl_c3f(float r, float g, float b) {
     }
 }
 
+SOKOL_API_IMPL void sgl_context_c3f(sgl_context ctx_id, float r, float g, float b) {
+    _sgl_context_t* ctx = _sgl_lookup_context(ctx_id.id);
+    if (ctx) {
+        ctx->rgba = _sgl_pack_rgbaf(r, g, b, 1.0f);
+    }
+}
+
 SOKOL_API_IMPL void sgl_c4f(float r, float g, float b, float a) {
     _sgl_context_t* ctx = _sgl.cur_ctx;
     if (ctx) {
@@ -4128,6 +7364,13 @@ SOKOL_API_IMPL void sgl_c4f(float r, float g, float b, float a) {
     }
 }
 
+SOKOL_API_IMPL void sgl_context_c4f(sgl_context ctx_id, float r, float g, float b, float a) {
+    _sgl_context_t* ctx = _sgl_lookup_context(ctx_id.id);
+    if (ctx) {
+        ctx->rgba = _sgl_pack_rgbaf(r, g, b, a);
+    }
+}
+
 SOKOL_API_IMPL void sgl_c3b(uint8_t r, uint8_t g, uint8_t b) {
     _sgl_context_t* ctx = _sgl.cur_ctx;
     if (ctx) {
@@ -4135,6 +7378,13 @@ SOKOL_API_IMPL void sgl_c3b(uint8_t r, uint8_t g, uint8_t b) {
     }
 }
 
+SOKOL_API_IMPL void sgl_context_c3b(sgl_context ctx_id, uint8_t r, uint8_t g, uint8_t b) {
+    _sgl_context_t* ctx = _sgl_lookup_context(ctx_id.id);
+    if (ctx) {
+        ctx->rgba = _sgl_pack_rgbab(r, g, b, 255);
+    }
+}
+
 SOKOL_API_IMPL void sgl_c4b(uint8_t r, uint8_t g, uint8_t b, uint8_t a) {
     _sgl_context_t* ctx = _sgl.cur_ctx;
     if (ctx) {
@@ -4142,6 +7392,13 @@ SOKOL_API_IMPL void sgl_c4b(uint8_t r, uint8_t g, uint8_t b, uint8_t a) {
     }
 }
 
+SOKOL_API_IMPL void sgl_context_c4b(sgl_context ctx_id, uint8_t r, uint8_t g, uint8_t b, uint8_t a) {
+    _sgl_context_t* ctx = _sgl_lookup_context(ctx_id.id);
+    if (ctx) {
+        ctx->rgba = _sgl_pack_rgbab(r, g, b, a);
+    }
+}
+
 SOKOL_API_IMPL void sgl_c1i(uint32_t rgba) {
     _sgl_context_t* ctx = _sgl.cur_ctx;
     if (ctx) {
@@ -4149,6 +7406,13 @@ SOKOL_API_IMPL void sgl_c1i(uint32_t rgba) {
     }
 }
 
+SOKOL_API_IMPL void sgl_context_c1i(sgl_context ctx_id, uint32_t rgba) {
+    _sgl_context_t* ctx = _sgl_lookup_context(ctx_id.id);
+    if (ctx) {
+        ctx->rgba = rgba;
+    }
+}
+
 SOKOL_API_IMPL void sgl_v2f(float x, float y) {
     _sgl_context_t* ctx = _sgl.cur_ctx;
     if (ctx) {
@@ -4156,6 +7420,13 @@ SOKOL_API_IMPL void sgl_v2f(float x, float y) {
     }
 }
 
+SOKOL_API_IMPL void sgl_context_v2f(sgl_context ctx_id, float x, float y) {
+    _sgl_context_t* ctx = _sgl_lookup_context(ctx_id.id);
+    if (ctx) {
+        _sgl_vtx(ctx, x, y, 0.0f, ctx->u, ctx->v, ctx->rgba);
+    }
+}
+
 SOKOL_API_IMPL void sgl_v3f(float x, float y, float z) {
     _sgl_context_t* ctx = _sgl.cur_ctx;
     if (ctx) {
@@ -4163,6 +7434,13 @@ SOKOL_API_IMPL void sgl_v3f(float x, float y, float z) {
     }
 }
 
+SOKOL_API_IMPL void sgl_context_v3f(sgl_context ctx_id, float x, float y, float z) {
+    _sgl_context_t* ctx = _sgl_lookup_context(ctx_id.id);
+    if (ctx) {
+        _sgl_vtx(ctx, x, y, z, ctx->u, ctx->v, ctx->rgba);
+    }
+}
+
 SOKOL_API_IMPL void sgl_v2f_t2f(float x, float y, float u, float v) {
     _sgl_context_t* ctx = _sgl.cur_ctx;
     if (ctx) {
@@ -4170,6 +7448,13 @@ SOKOL_API_IMPL void sgl_v2f_t2f(float x, float y, float u, float v) {
     }
 }
 
+SOKOL_API_IMPL void sgl_context_v2f_t2f(sgl_context ctx_id, float x, float y, float u, float v) {
+    _sgl_context_t* ctx = _sgl_lookup_context(ctx_id.id);
+    if (ctx) {
+        _sgl_vtx(ctx, x, y, 0.0f, u, v, ctx->rgba);
+    }
+}
+
 SOKOL_API_IMPL void sgl_v3f_t2f(float x, float y, float z, float u, float v) {
     _sgl_context_t* ctx = _sgl.cur_ctx;
     if (ctx) {
@@ -4177,6 +7462,13 @@ SOKOL_API_IMPL void sgl_v3f_t2f(float x, float y, float z, float u, float v) {
     }
 }
 
+SOKOL_API_IMPL void sgl_context_v3f_t2f(sgl_context ctx_id, float x, float y, float z, float u, float v) {
+    _sgl_context_t* ctx = _sgl_lookup_context(ctx_id.id);
+    if (ctx) {
+        _sgl_vtx(ctx, x, y, z, u, v, ctx->rgba);
+    }
+}
+
 SOKOL_API_IMPL void sgl_v2f_c3f(float x, float y, float r, float g, float b) {
     _sgl_context_t* ctx = _sgl.cur_ctx;
     if (ctx) {
@@ -4184,6 +7476,13 @@ SOKOL_API_IMPL void sgl_v2f_c3f(float x, float y, float r, float g, float b) {
     }
 }
 
+SOKOL_API_IMPL void sgl_context_v2f_c3f(sgl_context ctx_id, float x, float y, float r, float g, float b) {
+    _sgl_context_t* ctx = _sgl_lookup_context(ctx_id.id);
+    if (ctx) {
+        _sgl_vtx(ctx, x, y, 0.0f, ctx->u, ctx->v, _sgl_pack_rgbaf(r, g, b, 1.0f));
+    }
+}
+
 SOKOL_API_IMPL void sgl_v2f_c3b(float x, float y, uint8_t r, uint8_t g, uint8_t b) {
     _sgl_context_t* ctx = _sgl.cur_ctx;
     if (ctx) {
@@ -4191,6 +7490,13 @@ SOKOL_API_IMPL void sgl_v2f_c3b(float x, float y, uint8_t r, uint8_t g, uint8_t
     }
 }
 
+SOKOL_API_IMPL void sgl_context_v2f_c3b(sgl_context ctx_id, float x, float y, uint8_t r, uint8_t g, uint8_t b) {
+    _sgl_context_t* ctx = _sgl_lookup_context(ctx_id.id);
+    if (ctx) {
+        _sgl_vtx(ctx, x, y, 0.0f, ctx->u, ctx->v, _sgl_pack_rgbab(r, g, b, 255));
+    }
+}
+
 SOKOL_API_IMPL void sgl_v2f_c4f(float x, float y, float r, float g, float b, float a) {
     _sgl_context_t* ctx = _sgl.cur_ctx;
     if (ctx) {
@@ -4198,6 +7504,13 @@ SOKOL_API_IMPL void sgl_v2f_c4f(float x, float y, float r, float g, float b, flo
     }
 }
 
+SOKOL_API_IMPL void sgl_context_v2f_c4f(sgl_context ctx_id, float x, float y, float r, float g, float b, float a) {
+    _sgl_context_t* ctx = _sgl_lookup_context(ctx_id.id);
+    if (ctx) {
+        _sgl_vtx(ctx, x, y, 0.0f, ctx->u, ctx->v, _sgl_pack_rgbaf(r, g, b, a));
+    }
+}
+
 SOKOL_API_IMPL void sgl_v2f_c4b(float x, float y, uint8_t r, uint8_t g, uint8_t b, uint8_t a) {
     _sgl_context_t* ctx = _sgl.cur_ctx;
     if (ctx) {
@@ -4205,6 +7518,13 @@ SOKOL_API_IMPL void sgl_v2f_c4b(float x, float y, uint8_t r, uint8_t g, uint8_t
     }
 }
 
+SOKOL_API_IMPL void sgl_context_v2f_c4b(sgl_context ctx_id, float x, float y, uint8_t r, uint8_t g, uint8_t b, uint8_t a) {
+    _sgl_context_t* ctx = _sgl_lookup_context(ctx_id.id);
+    if (ctx) {
+        _sgl_vtx(ctx, x, y, 0.0f, ctx->u, ctx->v, _sgl_pack_rgbab(r, g, b, a));
+    }
+}
+
 SOKOL_API_IMPL void sgl_v2f_c1i(float x, float y, uint32_t rgba) {
     _sgl_context_t* ctx = _sgl.cur_ctx;
     if (ctx) {
@@ -4212,6 +7532,13 @@ SOKOL_API_IMPL void sgl_v2f_c1i(float x, float y, uint32_t rgba) {
     }
 }
 
+SOKOL_API_IMPL void sgl_context_v2f_c1i(sgl_context ctx_id, float x, float y, uint32_t rgba) {
+    _sgl_context_t* ctx = _sgl_lookup_context(ctx_id.id);
+    if (ctx) {
+        _sgl_vtx(ctx, x, y, 0.0f, ctx->u, ctx->v, rgba);
+    }
+}
+
 SOKOL_API_IMPL void sgl_v3f_c3f(float x, float y, float z, float r, float g, float b) {
     _sgl_context_t* ctx = _sgl.cur_ctx;
     if (ctx) {
@@ -4219,15 +7546,36 @@ SOKOL_API_IMPL void sgl_v3f_c3f(float x, float y, float z, float r, float g, flo
     }
 }
 
-SOKOL_API_IMPL void sgl_v3f_c3b(float x, float y, float z, uint8_t r, uint8_t g, uint8_t b) {
+SOKOL_API_IMPL void sgl_context_v3f_c3f(sgl_context ctx_id, float x, float y, float z, float r, float g, float b) {
+    _sgl_context_t* ctx = _sgl_lookup_context(ctx_id.id);
+    if (ctx) {
+        _sgl_vtx(ctx, x, y, z, ctx->u, ctx->v, _sgl_pack_rgbaf(r, g, b, 1.0f));
+    }
+}
+
+SOKOL_API_IMPL void sgl_v3f_c3b(float x, float y, float z, uint8_t r, uint8_t g, uint8_t b) {
+    _sgl_context_t* ctx = _sgl.cur_ctx;
+    if (ctx) {
+        _sgl_vtx(ctx, x, y, z, ctx->u, ctx->v, _sgl_pack_rgbab(r, g, b, 255));
+    }
+}
+
+SOKOL_API_IMPL void sgl_context_v3f_c3b(sgl_context ctx_id, float x, float y, float z, uint8_t r, uint8_t g, uint8_t b) {
+    _sgl_context_t* ctx = _sgl_lookup_context(ctx_id.id);
+    if (ctx) {
+        _sgl_vtx(ctx, x, y, z, ctx->u, ctx->v, _sgl_pack_rgbab(r, g, b, 255));
+    }
+}
+
+SOKOL_API_IMPL void sgl_v3f_c4f(float x, float y, float z, float r, float g, float b, float a) {
     _sgl_context_t* ctx = _sgl.cur_ctx;
     if (ctx) {
-        _sgl_vtx(ctx, x, y, z, ctx->u, ctx->v, _sgl_pack_rgbab(r, g, b, 255));
+        _sgl_vtx(ctx, x, y, z, ctx->u, ctx->v, _sgl_pack_rgbaf(r, g, b, a));
     }
 }
 
-SOKOL_API_IMPL void sgl_v3f_c4f(float x, float y, float z, float r, float g, float b, float a) {
-    _sgl_context_t* ctx = _sgl.cur_ctx;
+SOKOL_API_IMPL void sgl_context_v3f_c4f(sgl_context ctx_id, float x, float y, float z, float r, float g, float b, float a) {
+    _sgl_context_t* ctx = _sgl_lookup_context(ctx_id.id);
     if (ctx) {
         _sgl_vtx(ctx, x, y, z, ctx->u, ctx->v, _sgl_pack_rgbaf(r, g, b, a));
     }
@@ -4240,6 +7588,13 @@ SOKOL_API_IMPL void sgl_v3f_c4b(float x, float y, float z, uint8_t r, uint8_t g,
     }
 }
 
+SOKOL_API_IMPL void sgl_context_v3f_c4b(sgl_context ctx_id, float x, float y, float z, uint8_t r, uint8_t g, uint8_t b, uint8_t a) {
+    _sgl_context_t* ctx = _sgl_lookup_context(ctx_id.id);
+    if (ctx) {
+        _sgl_vtx(ctx, x, y, z, ctx->u, ctx->v, _sgl_pack_rgbab(r, g, b, a));
+    }
+}
+
 SOKOL_API_IMPL void sgl_v3f_c1i(float x, float y, float z, uint32_t rgba) {
     _sgl_context_t* ctx = _sgl.cur_ctx;
     if (ctx) {
@@ -4247,6 +7602,13 @@ SOKOL_API_IMPL void sgl_v3f_c1i(float x, float y, float z, uint32_t rgba) {
     }
 }
 
+SOKOL_API_IMPL void sgl_context_v3f_c1i(sgl_context ctx_id, float x, float y, float z, uint32_t rgba) {
+    _sgl_context_t* ctx = _sgl_lookup_context(ctx_id.id);
+    if (ctx) {
+        _sgl_vtx(ctx, x, y, z, ctx->u, ctx->v, rgba);
+    }
+}
+
 SOKOL_API_IMPL void sgl_v2f_t2f_c3f(float x, float y, float u, float v, float r, float g, float b) {
     _sgl_context_t* ctx = _sgl.cur_ctx;
     if (ctx) {
@@ -4254,6 +7616,13 @@ SOKOL_API_IMPL void sgl_v2f_t2f_c3f(float x, float y, float u, float v, float r,
     }
 }
 
+SOKOL_API_IMPL void sgl_context_v2f_t2f_c3f(sgl_context ctx_id, float x, float y, float u, float v, float r, float g, float b) {
+    _sgl_context_t* ctx = _sgl_lookup_context(ctx_id.id);
+    if (ctx) {
+        _sgl_vtx(ctx, x, y, 0.0f, u, v, _sgl_pack_rgbaf(r, g, b, 1.0f));
+    }
+}
+
 SOKOL_API_IMPL void sgl_v2f_t2f_c3b(float x, float y, float u, float v, uint8_t r, uint8_t g, uint8_t b) {
     _sgl_context_t* ctx = _sgl.cur_ctx;
     if (ctx) {
@@ -4261,6 +7630,13 @@ SOKOL_API_IMPL void sgl_v2f_t2f_c3b(float x, float y, float u, float v, uint8_t
     }
 }
 
+SOKOL_API_IMPL void sgl_context_v2f_t2f_c3b(sgl_context ctx_id, float x, float y, float u, float v, uint8_t r, uint8_t g, uint8_t b) {
+    _sgl_context_t* ctx = _sgl_lookup_context(ctx_id.id);
+    if (ctx) {
+        _sgl_vtx(ctx, x, y, 0.0f, u, v, _sgl_pack_rgbab(r, g, b, 255));
+    }
+}
+
 SOKOL_API_IMPL void sgl_v2f_t2f_c4f(float x, float y, float u, float v, float r, float g, float b, float a) {
     _sgl_context_t* ctx = _sgl.cur_ctx;
     if (ctx) {
@@ -4268,6 +7644,13 @@ SOKOL_API_IMPL void sgl_v2f_t2f_c4f(float x, float y, float u, float v, float r,
     }
 }
 
+SOKOL_API_IMPL void sgl_context_v2f_t2f_c4f(sgl_context ctx_id, float x, float y, float u, float v, float r, float g, float b, float a) {
+    _sgl_context_t* ctx = _sgl_lookup_context(ctx_id.id);
+    if (ctx) {
+        _sgl_vtx(ctx, x, y, 0.0f, u, v, _sgl_pack_rgbaf(r, g, b, a));
+    }
+}
+
 SOKOL_API_IMPL void sgl_v2f_t2f_c4b(float x, float y, float u, float v, uint8_t r, uint8_t g, uint8_t b, uint8_t a) {
     _sgl_context_t* ctx = _sgl.cur_ctx;
     if (ctx) {
@@ -4275,6 +7658,13 @@ SOKOL_API_IMPL void sgl_v2f_t2f_c4b(float x, float y, float u, float v, uint8_t
     }
 }
 
+SOKOL_API_IMPL void sgl_context_v2f_t2f_c4b(sgl_context ctx_id, float x, float y, float u, float v, uint8_t r, uint8_t g, uint8_t b, uint8_t a) {
+    _sgl_context_t* ctx = _sgl_lookup_context(ctx_id.id);
+    if (ctx) {
+        _sgl_vtx(ctx, x, y, 0.0f, u, v, _sgl_pack_rgbab(r, g, b, a));
+    }
+}
+
 SOKOL_API_IMPL void sgl_v2f_t2f_c1i(float x, float y, float u, float v, uint32_t rgba) {
     _sgl_context_t* ctx = _sgl.cur_ctx;
     if (ctx) {
@@ -4282,6 +7672,13 @@ SOKOL_API_IMPL void sgl_v2f_t2f_c1i(float x, float y, float u, float v, uint32_t
     }
 }
 
+SOKOL_API_IMPL void sgl_context_v2f_t2f_c1i(sgl_context ctx_id, float x, float y, float u, float v, uint32_t rgba) {
+    _sgl_context_t* ctx = _sgl_lookup_context(ctx_id.id);
+    if (ctx) {
+        _sgl_vtx(ctx, x, y, 0.0f, u, v, rgba);
+    }
+}
+
 SOKOL_API_IMPL void sgl_v3f_t2f_c3f(float x, float y, float z, float u, float v, float r, float g, float b) {
     _sgl_context_t* ctx = _sgl.cur_ctx;
     if (ctx) {
@@ -4289,6 +7686,13 @@ SOKOL_API_IMPL void sgl_v3f_t2f_c3f(float x, float y, float z, float u, float v,
     }
 }
 
+SOKOL_API_IMPL void sgl_context_v3f_t2f_c3f(sgl_context ctx_id, float x, float y, float z, float u, float v, float r, float g, float b) {
+    _sgl_context_t* ctx = _sgl_lookup_context(ctx_id.id);
+    if (ctx) {
+        _sgl_vtx(ctx, x, y, z, u, v, _sgl_pack_rgbaf(r, g, b, 1.0f));
+    }
+}
+
 SOKOL_API_IMPL void sgl_v3f_t2f_c3b(float x, float y, float z, float u, float v, uint8_t r, uint8_t g, uint8_t b) {
     _sgl_context_t* ctx = _sgl.cur_ctx;
     if (ctx) {
@@ -4296,6 +7700,13 @@ SOKOL_API_IMPL void sgl_v3f_t2f_c3b(float x, float y, float z, float u, float v,
     }
 }
 
+SOKOL_API_IMPL void sgl_context_v3f_t2f_c3b(sgl_context ctx_id, float x, float y, float z, float u, float v, uint8_t r, uint8_t g, uint8_t b) {
+    _sgl_context_t* ctx = _sgl_lookup_context(ctx_id.id);
+    if (ctx) {
+        _sgl_vtx(ctx, x, y, z, u, v, _sgl_pack_rgbab(r, g, b, 255));
+    }
+}
+
 SOKOL_API_IMPL void sgl_v3f_t2f_c4f(float x, float y, float z, float u, float v, float r, float g, float b, float a) {
     _sgl_context_t* ctx = _sgl.cur_ctx;
     if (ctx) {
@@ -4303,6 +7714,13 @@ SOKOL_API_IMPL void sgl_v3f_t2f_c4f(float x, float y, float z, float u, float v,
     }
 }
 
+SOKOL_API_IMPL void sgl_context_v3f_t2f_c4f(sgl_context ctx_id, float x, float y, float z, float u, float v, float r, float g, float b, float a) {
+    _sgl_context_t* ctx = _sgl_lookup_context(ctx_id.id);
+    if (ctx) {
+        _sgl_vtx(ctx, x, y, z, u, v, _sgl_pack_rgbaf(r, g, b, a));
+    }
+}
+
 SOKOL_API_IMPL void sgl_v3f_t2f_c4b(float x, float y, float z, float u, float v, uint8_t r, uint8_t g, uint8_t b, uint8_t a) {
     _sgl_context_t* ctx = _sgl.cur_ctx;
     if (ctx) {
@@ -4310,6 +7728,13 @@ SOKOL_API_IMPL void sgl_v3f_t2f_c4b(float x, float y, float z, float u, float v,
     }
 }
 
+SOKOL_API_IMPL void sgl_context_v3f_t2f_c4b(sgl_context ctx_id, float x, float y, float z, float u, float v, uint8_t r, uint8_t g, uint8_t b, uint8_t a) {
+    _sgl_context_t* ctx = _sgl_lookup_context(ctx_id.id);
+    if (ctx) {
+        _sgl_vtx(ctx, x, y, z, u, v, _sgl_pack_rgbab(r, g, b, a));
+    }
+}
+
 SOKOL_API_IMPL void sgl_v3f_t2f_c1i(float x, float y, float z, float u, float v, uint32_t rgba) {
     _sgl_context_t* ctx = _sgl.cur_ctx;
     if (ctx) {
@@ -4317,6 +7742,13 @@ SOKOL_API_IMPL void sgl_v3f_t2f_c1i(float x, float y, float z, float u, float v,
     }
 }
 
+SOKOL_API_IMPL void sgl_context_v3f_t2f_c1i(sgl_context ctx_id, float x, float y, float z, float u, float v, uint32_t rgba) {
+    _sgl_context_t* ctx = _sgl_lookup_context(ctx_id.id);
+    if (ctx) {
+        _sgl_vtx(ctx,x, y, z, u, v, rgba);
+    }
+}
+
 SOKOL_API_IMPL void sgl_matrix_mode_modelview(void) {
     SOKOL_ASSERT(_SGL_INIT_COOKIE == _sgl.init_cookie);
     _sgl_context_t* ctx = _sgl.cur_ctx;
@@ -4325,6 +7757,14 @@ SOKOL_API_IMPL void sgl_matrix_mode_modelview(void) {
     }
 }
 
+SOKOL_API_IMPL void sgl_context_matrix_mode_modelview(sgl_context ctx_id) {
+    SOKOL_ASSERT(_SGL_INIT_COOKIE == _sgl.init_cookie);
+    _sgl_context_t* ctx = _sgl_lookup_context(ctx_id.id);
+    if (ctx) {
+        ctx->cur_matrix_mode = SGL_MATRIXMODE_MODELVIEW;
+    }
+}
+
 SOKOL_API_IMPL void sgl_matrix_mode_projection(void) {
     SOKOL_ASSERT(_SGL_INIT_COOKIE == _sgl.init_cookie);
     _sgl_context_t* ctx = _sgl.cur_ctx;
@@ -4333,6 +7773,14 @@ SOKOL_API_IMPL void sgl_matrix_mode_projection(void) {
     }
 }
 
+SOKOL_API_IMPL void sgl_context_matrix_mode_projection(sgl_context ctx_id) {
+    SOKOL_ASSERT(_SGL_INIT_COOKIE == _sgl.init_cookie);
+    _sgl_context_t* ctx = _sgl_lookup_context(ctx_id.id);
+    if (ctx) {
+        ctx->cur_matrix_mode = SGL_MATRIXMODE_PROJECTION;
+    }
+}
+
 SOKOL_API_IMPL void sgl_matrix_mode_texture(void) {
     SOKOL_ASSERT(_SGL_INIT_COOKIE == _sgl.init_cookie);
     _sgl_context_t* ctx = _sgl.cur_ctx;
@@ -4341,13 +7789,31 @@ SOKOL_API_IMPL void sgl_matrix_mode_texture(void) {
     }
 }
 
+SOKOL_API_IMPL void sgl_context_matrix_mode_texture(sgl_context ctx_id) {
+    SOKOL_ASSERT(_SGL_INIT_COOKIE == _sgl.init_cookie);
+    _sgl_context_t* ctx = _sgl_lookup_context(ctx_id.id);
+    if (ctx) {
+        ctx->cur_matrix_mode = SGL_MATRIXMODE_TEXTURE;
+    }
+}
+
 SOKOL_API_IMPL void sgl_load_identity(void) {
     SOKOL_ASSERT(_SGL_INIT_COOKIE == _sgl.init_cookie);
     _sgl_context_t* ctx = _sgl.cur_ctx;
     if (!ctx) {
         return;
     }
-    ctx->matrix_dirty = true;
+    _sgl_matrix_changed(ctx);
+    _sgl_identity(_sgl_matrix(ctx));
+}
+
+SOKOL_API_IMPL void sgl_context_load_identity(sgl_context ctx_id) {
+    SOKOL_ASSERT(_SGL_INIT_COOKIE == _sgl.init_cookie);
+    _sgl_context_t* ctx = _sgl_lookup_context(ctx_id.id);
+    if (!ctx) {
+        return;
+    }
+    _sgl_matrix_changed(ctx);
     _sgl_identity(_sgl_matrix(ctx));
 }
 
@@ -4357,7 +7823,17 @@ SOKOL_API_IMPL void sgl_load_matrix(const float m[16]) {
     if (!ctx) {
         return;
     }
-    ctx->matrix_dirty = true;
+    _sgl_matrix_changed(ctx);
+    memcpy(&_sgl_matrix(ctx)->v[0][0], &m[0], 64);
+}
+
+SOKOL_API_IMPL void sgl_context_load_matrix(sgl_context ctx_id, const float m[16]) {
+    SOKOL_ASSERT(_SGL_INIT_COOKIE == _sgl.init_cookie);
+    _sgl_context_t* ctx = _sgl_lookup_context(ctx_id.id);
+    if (!ctx) {
+        return;
+    }
+    _sgl_matrix_changed(ctx);
     memcpy(&_sgl_matrix(ctx)->v[0][0], &m[0], 64);
 }
 
@@ -4367,7 +7843,17 @@ SOKOL_API_IMPL void sgl_load_transpose_matrix(const float m[16]) {
     if (!ctx) {
         return;
     }
-    ctx->matrix_dirty = true;
+    _sgl_matrix_changed(ctx);
+    _sgl_transpose(_sgl_matrix(ctx), (const _sgl_matrix_t*) &m[0]);
+}
+
+SOKOL_API_IMPL void sgl_context_load_transpose_matrix(sgl_context ctx_id, const float m[16]) {
+    SOKOL_ASSERT(_SGL_INIT_COOKIE == _sgl.init_cookie);
+    _sgl_context_t* ctx = _sgl_lookup_context(ctx_id.id);
+    if (!ctx) {
+        return;
+    }
+    _sgl_matrix_changed(ctx);
     _sgl_transpose(_sgl_matrix(ctx), (const _sgl_matrix_t*) &m[0]);
 }
 
@@ -4377,7 +7863,18 @@ SOKOL_API_IMPL void sgl_mult_matrix(const float m[16]) {
     if (!ctx) {
         return;
     }
-    ctx->matrix_dirty = true;
+    _sgl_matrix_changed(ctx);
+    const _sgl_matrix_t* m0  = (const _sgl_matrix_t*) &m[0];
+    _sgl_mul(_sgl_matrix(ctx), m0);
+}
+
+SOKOL_API_IMPL void sgl_context_mult_matrix(sgl_context ctx_id, const float m[16]) {
+    SOKOL_ASSERT(_SGL_INIT_COOKIE == _sgl.init_cookie);
+    _sgl_context_t* ctx = _sgl_lookup_context(ctx_id.id);
+    if (!ctx) {
+        return;
+    }
+    _sgl_matrix_changed(ctx);
     const _sgl_matrix_t* m0  = (const _sgl_matrix_t*) &m[0];
     _sgl_mul(_sgl_matrix(ctx), m0);
 }
@@ -4388,7 +7885,19 @@ SOKOL_API_IMPL void sgl_mult_transpose_matrix(const float m[16]) {
     if (!ctx) {
         return;
     }
-    ctx->matrix_dirty = true;
+    _sgl_matrix_changed(ctx);
+    _sgl_matrix_t m0;
+    _sgl_transpose(&m0, (const _sgl_matrix_t*) &m[0]);
+    _sgl_mul(_sgl_matrix(ctx), &m0);
+}
+
+SOKOL_API_IMPL void sgl_context_mult_transpose_matrix(sgl_context ctx_id, const float m[16]) {
+    SOKOL_ASSERT(_SGL_INIT_COOKIE == _sgl.init_cookie);
+    _sgl_context_t* ctx = _sgl_lookup_context(ctx_id.id);
+    if (!ctx) {
+        return;
+    }
+    _sgl_matrix_changed(ctx);
     _sgl_matrix_t m0;
     _sgl_transpose(&m0, (const _sgl_matrix_t*) &m[0]);
     _sgl_mul(_sgl_matrix(ctx), &m0);
@@ -4400,7 +7909,17 @@ SOKOL_API_IMPL void sgl_rotate(float angle_rad, float x, float y, float z) {
     if (!ctx) {
         return;
     }
-    ctx->matrix_dirty = true;
+    _sgl_matrix_changed(ctx);
+    _sgl_rotate(_sgl_matrix(ctx), angle_rad, x, y, z);
+}
+
+SOKOL_API_IMPL void sgl_context_rotate(sgl_context ctx_id, float angle_rad, float x, float y, float z) {
+    SOKOL_ASSERT(_SGL_INIT_COOKIE == _sgl.init_cookie);
+    _sgl_context_t* ctx = _sgl_lookup_context(ctx_id.id);
+    if (!ctx) {
+        return;
+    }
+    _sgl_matrix_changed(ctx);
     _sgl_rotate(_sgl_matrix(ctx), angle_rad, x, y, z);
 }
 
@@ -4410,7 +7929,17 @@ SOKOL_API_IMPL void sgl_scale(float x, float y, float z) {
     if (!ctx) {
         return;
     }
-    ctx->matrix_dirty = true;
+    _sgl_matrix_changed(ctx);
+    _sgl_scale(_sgl_matrix(ctx), x, y, z);
+}
+
+SOKOL_API_IMPL void sgl_context_scale(sgl_context ctx_id, float x, float y, float z) {
+    SOKOL_ASSERT(_SGL_INIT_COOKIE == _sgl.init_cookie);
+    _sgl_context_t* ctx = _sgl_lookup_context(ctx_id.id);
+    if (!ctx) {
+        return;
+    }
+    _sgl_matrix_changed(ctx);
     _sgl_scale(_sgl_matrix(ctx), x, y, z);
 }
 
@@ -4420,7 +7949,17 @@ SOKOL_API_IMPL void sgl_translate(float x, float y, float z) {
     if (!ctx) {
         return;
     }
-    ctx->matrix_dirty = true;
+    _sgl_matrix_changed(ctx);
+    _sgl_translate(_sgl_matrix(ctx), x, y, z);
+}
+
+SOKOL_API_IMPL void sgl_context_translate(sgl_context ctx_id, float x, float y, float z) {
+    SOKOL_ASSERT(_SGL_INIT_COOKIE == _sgl.init_cookie);
+    _sgl_context_t* ctx = _sgl_lookup_context(ctx_id.id);
+    if (!ctx) {
+        return;
+    }
+    _sgl_matrix_changed(ctx);
     _sgl_translate(_sgl_matrix(ctx), x, y, z);
 }
 
@@ -4430,7 +7969,17 @@ SOKOL_API_IMPL void sgl_frustum(float l, float r, float b, float t, float n, flo
     if (!ctx) {
         return;
     }
-    ctx->matrix_dirty = true;
+    _sgl_matrix_changed(ctx);
+    _sgl_frustum(_sgl_matrix(ctx), l, r, b, t, n, f);
+}
+
+SOKOL_API_IMPL void sgl_context_frustum(sgl_context ctx_id, float l, float r, float b, float t, float n, float f) {
+    SOKOL_ASSERT(_SGL_INIT_COOKIE == _sgl.init_cookie);
+    _sgl_context_t* ctx = _sgl_lookup_context(ctx_id.id);
+    if (!ctx) {
+        return;
+    }
+    _sgl_matrix_changed(ctx);
     _sgl_frustum(_sgl_matrix(ctx), l, r, b, t, n, f);
 }
 
@@ -4440,7 +7989,17 @@ SOKOL_API_IMPL void sgl_ortho(float l, float r, float b, float t, float n, float
     if (!ctx) {
         return;
     }
-    ctx->matrix_dirty = true;
+    _sgl_matrix_changed(ctx);
+    _sgl_ortho(_sgl_matrix(ctx), l, r, b, t, n, f);
+}
+
+SOKOL_API_IMPL void sgl_context_ortho(sgl_context ctx_id, float l, float r, float b, float t, float n, float f) {
+    SOKOL_ASSERT(_SGL_INIT_COOKIE == _sgl.init_cookie);
+    _sgl_context_t* ctx = _sgl_lookup_context(ctx_id.id);
+    if (!ctx) {
+        return;
+    }
+    _sgl_matrix_changed(ctx);
     _sgl_ortho(_sgl_matrix(ctx), l, r, b, t, n, f);
 }
 
@@ -4450,7 +8009,17 @@ SOKOL_API_IMPL void sgl_perspective(float fov_y, float aspect, float z_near, flo
     if (!ctx) {
         return;
     }
-    ctx->matrix_dirty = true;
+    _sgl_matrix_changed(ctx);
+    _sgl_perspective(_sgl_matrix(ctx), fov_y, aspect, z_near, z_far);
+}
+
+SOKOL_API_IMPL void sgl_context_perspective(sgl_context ctx_id, float fov_y, float aspect, float z_near, float z_far) {
+    SOKOL_ASSERT(_SGL_INIT_COOKIE == _sgl.init_cookie);
+    _sgl_context_t* ctx = _sgl_lookup_context(ctx_id.id);
+    if (!ctx) {
+        return;
+    }
+    _sgl_matrix_changed(ctx);
     _sgl_perspective(_sgl_matrix(ctx), fov_y, aspect, z_near, z_far);
 }
 
@@ -4460,42 +8029,49 @@ SOKOL_API_IMPL void sgl_lookat(float eye_x, float eye_y, float eye_z, float cent
     if (!ctx) {
         return;
     }
-    ctx->matrix_dirty = true;
+    _sgl_matrix_changed(ctx);
     _sgl_lookat(_sgl_matrix(ctx), eye_x, eye_y, eye_z, center_x, center_y, center_z, up_x, up_y, up_z);
 }
 
-SOKOL_API_IMPL void sgl_push_matrix(void) {
+SOKOL_API_IMPL void sgl_context_lookat(sgl_context ctx_id, float eye_x, float eye_y, float eye_z, float center_x, float center_y, float center_z, float up_x, float up_y, float up_z) {
     SOKOL_ASSERT(_SGL_INIT_COOKIE == _sgl.init_cookie);
-    _sgl_context_t* ctx = _sgl.cur_ctx;
+    _sgl_context_t* ctx = _sgl_lookup_context(ctx_id.id);
     if (!ctx) {
         return;
     }
-    SOKOL_ASSERT((ctx->cur_matrix_mode >= 0) && (ctx->cur_matrix_mode < SGL_NUM_MATRIXMODES));
-    ctx->matrix_dirty = true;
-    if (ctx->matrix_tos[ctx->cur_matrix_mode] < (_SGL_MAX_STACK_DEPTH - 1)) {
-        const _sgl_matrix_t* src = _sgl_matrix(ctx);
-        ctx->matrix_tos[ctx->cur_matrix_mode]++;
-        _sgl_matrix_t* dst = _sgl_matrix(ctx);
-        *dst = *src;
-    } else {
-        ctx->error.stack_overflow = true;
-        ctx->error.any = true;
+    _sgl_matrix_changed(ctx);
+    _sgl_lookat(_sgl_matrix(ctx), eye_x, eye_y, eye_z, center_x, center_y, center_z, up_x, up_y, up_z);
+}
+
+SOKOL_API_IMPL void sgl_push_matrix(void) {
+    SOKOL_ASSERT(_SGL_INIT_COOKIE == _sgl.init_cookie);
+    _sgl_context_t* ctx = _sgl.cur_ctx;
+    if (ctx) {
+        _sgl_push_matrix(ctx);
+    }
+}
+
+SOKOL_API_IMPL void sgl_context_push_matrix(sgl_context ctx_id) {
+    SOKOL_ASSERT(_SGL_INIT_COOKIE == _sgl.init_cookie);
+    _sgl_context_t* ctx = _sgl_lookup_context(ctx_id.id);
+    if (ctx) {
+        _sgl_push_matrix(ctx);
     }
 }
 
 SOKOL_API_IMPL void sgl_pop_matrix(void) {
     SOKOL_ASSERT(_SGL_INIT_COOKIE == _sgl.init_cookie);
     _sgl_context_t* ctx = _sgl.cur_ctx;
-    if (!ctx) {
-        return;
+    if (ctx) {
+        _sgl_pop_matrix(ctx);
     }
-    SOKOL_ASSERT((ctx->cur_matrix_mode >= 0) && (ctx->cur_matrix_mode < SGL_NUM_MATRIXMODES));
-    ctx->matrix_dirty = true;
-    if (ctx->matrix_tos[ctx->cur_matrix_mode] > 0) {
-        ctx->matrix_tos[ctx->cur_matrix_mode]--;
-    } else {
-        ctx->error.stack_underflow = true;
-        ctx->error.any = true;
+}
+
+SOKOL_API_IMPL void sgl_context_pop_matrix(sgl_context ctx_id) {
+    SOKOL_ASSERT(_SGL_INIT_COOKIE == _sgl.init_cookie);
+    _sgl_context_t* ctx = _sgl_lookup_context(ctx_id.id);
+    if (ctx) {
+        _sgl_pop_matrix(ctx);
     }
 }
 
@@ -4503,7 +8079,7 @@ SOKOL_API_IMPL void sgl_draw(void) {
     SOKOL_ASSERT(_SGL_INIT_COOKIE == _sgl.init_cookie);
     _sgl_context_t* ctx = _sgl.cur_ctx;
     if (ctx) {
-        _sgl_draw(ctx, 0);
+        _sgl_draw(ctx, 0, false);
     }
 }
 
@@ -4511,7 +8087,7 @@ SOKOL_API_IMPL void sgl_draw_layer(int layer_id) {
     SOKOL_ASSERT(_SGL_INIT_COOKIE == _sgl.init_cookie);
     _sgl_context_t* ctx = _sgl.cur_ctx;
     if (ctx) {
-        _sgl_draw(ctx, layer_id);
+        _sgl_draw(ctx, layer_id, false);
     }
 }
 
@@ -4519,7 +8095,7 @@ SOKOL_API_IMPL void sgl_context_draw(sgl_context ctx_id) {
     SOKOL_ASSERT(_SGL_INIT_COOKIE == _sgl.init_cookie);
     _sgl_context_t* ctx = _sgl_lookup_context(ctx_id.id);
     if (ctx) {
-        _sgl_draw(ctx, 0);
+        _sgl_draw(ctx, 0, false);
     }
 }
 
@@ -4527,7 +8103,23 @@ SOKOL_API_IMPL void sgl_context_draw_layer(sgl_context ctx_id, int layer_id) {
     SOKOL_ASSERT(_SGL_INIT_COOKIE == _sgl.init_cookie);
     _sgl_context_t* ctx = _sgl_lookup_context(ctx_id.id);
     if (ctx) {
-        _sgl_draw(ctx, layer_id);
+        _sgl_draw(ctx, layer_id, false);
+    }
+}
+
+SOKOL_API_IMPL void sgl_draw_layer_sorted(int layer_id) {
+    SOKOL_ASSERT(_SGL_INIT_COOKIE == _sgl.init_cookie);
+    _sgl_context_t* ctx = _sgl.cur_ctx;
+    if (ctx) {
+        _sgl_draw(ctx, layer_id, true);
+    }
+}
+
+SOKOL_API_IMPL void sgl_context_draw_layer_sorted(sgl_context ctx_id, int layer_id) {
+    SOKOL_ASSERT(_SGL_INIT_COOKIE == _sgl.init_cookie);
+    _sgl_context_t* ctx = _sgl_lookup_context(ctx_id.id);
+    if (ctx) {
+        _sgl_draw(ctx, layer_id, true);
     }
 }
 
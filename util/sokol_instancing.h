@@ -0,0 +1,701 @@
+#if defined(SOKOL_IMPL) && !defined(SOKOL_INSTANCING_IMPL)
+#define SOKOL_INSTANCING_IMPL
+#endif
+#ifndef SOKOL_INSTANCING_INCLUDED
+/*
+    sokol_instancing.h -- automatic instancing of repeated mesh draws
+
+    Project URL: https://github.com/floooh/sokol
+
+    Do this:
+        #define SOKOL_IMPL or
+        #define SOKOL_INSTANCING_IMPL
+    before you include this file in *one* C or C++ file to create the
+    implementation.
+
+    Optionally provide the following defines with your own implementations:
+
+    SOKOL_ASSERT(c)     - your own assert macro (default: assert(c))
+    SOKOL_INSTANCING_API_DECL - public function declaration prefix (default: extern)
+    SOKOL_API_DECL      - same as SOKOL_INSTANCING_API_DECL
+    SOKOL_API_IMPL      - public function implementation prefix (default: -)
+
+    If sokol_instancing.h is compiled as a DLL, define the following before
+    including the declaration or implementation:
+
+    SOKOL_DLL
+
+    Include the following headers before including sokol_instancing.h:
+
+        sokol_gfx.h
+
+    WHAT
+    ====
+    sokol_instancing.h collects many draws of the same mesh with the same
+    pipeline (for instance foliage, props or debug geometry), each with
+    its own per-instance data (like a transform matrix and color), and
+    renders them with one instanced sg_draw() per mesh/pipeline combination
+    instead of one sg_apply_bindings() + sg_apply_uniforms() + sg_draw()
+    per object.
+
+    The per-instance data of all draws is copied into a CPU-side staging
+    buffer, and when the collected draws are flushed, the staging data is
+    sorted by mesh/pipeline combination ('batches') and written into a
+    single sokol-gfx stream buffer with one sg_append_buffer() call.
+
+    HOW
+    ===
+    First initialize sokol_instancing.h after sokol_gfx.h:
+
+        sinst_setup(&(sinst_desc){
+            .logger.func = slog_func,
+        });
+
+    The default limits are 16384 instances and 256 batches between two
+    flushes, and 1 MByte of per-instance data per frame. Those can be tweaked
+    in sinst_desc:
+
+        sinst_setup(&(sinst_desc){
+            .max_instances = 65536,
+            .max_batches = 1024,
+            .buffer_size = 4 * 1024 * 1024,
+            .logger.func = slog_func,
+        });
+
+    The pipeline objects used with sokol_instancing.h must have a vertex
+    buffer bind slot with per-instance step function which receives the
+    per-instance data:
+
+        sg_pipeline pip = sg_make_pipeline(&(sg_pipeline_desc){
+            .shader = shd,
+            .layout = {
+                .buffers[1].step_func = SG_VERTEXSTEP_PER_INSTANCE,
+                .attrs = {
+                    [ATTR_instancing_pos] = { .format = SG_VERTEXFORMAT_FLOAT3, .buffer_index = 0 },
+                    [ATTR_instancing_inst_pos] = { .format = SG_VERTEXFORMAT_FLOAT3, .buffer_index = 1 },
+                },
+            },
+            ...
+        });
+
+    Next, instead of sg_apply_pipeline(), sg_apply_bindings() and sg_draw()
+    call sinst_draw() for each object with the pipeline, the mesh bindings
+    (leaving the per-instance vertex buffer bind slot empty), the bind slot
+    index for per-instance data, the element range and the per-instance data:
+
+        sinst_draw(&(sinst_draw_desc){
+            .pipeline = pip,
+            .bindings = {
+                .vertex_buffers[0] = mesh_vbuf,
+                .index_buffer = mesh_ibuf,
+            },
+            .instance_slot = 1,
+            .num_elements = mesh_num_indices,
+            .data = SG_RANGE(inst_pos),
+        });
+
+    All draws with the same pipeline, bindings, element range, instance slot
+    and per-instance data size are merged into the same batch. The size of
+    the per-instance data must be a multiple of 4.
+
+    Finally call sinst_flush() inside a sokol-gfx render pass to render all
+    collected draws:
+
+        sg_begin_pass(...);
+        sinst_flush();
+        sg_end_pass();
+
+    sinst_flush() can be called several times per frame (for instance in
+    different passes).
+
+    Since all draws of one batch are merged into one instanced draw call,
+    per-object uniforms are not supported, all per-object data must go into
+    the per-instance data. Uniforms which are shared by all objects (like
+    a view-projection matrix) can be applied from a callback which is
+    invoked after each sg_apply_pipeline() call:
+
+        static void apply_uniforms(sg_pipeline pip, void* user_data) {
+            const vs_params_t* vs_params = (const vs_params_t*)user_data;
+            sg_apply_uniforms(UB_vs_params, &SG_RANGE(*vs_params));
+        }
+
+        sinst_flush_ex(&(sinst_flush_desc){
+            .apply_uniforms = apply_uniforms,
+            .user_data = &vs_params,
+        });
+
+    Note that the draw order of objects is not preserved: batches are sorted
+    by pipeline to minimize sg_apply_pipeline() calls, and all instances
+    of a batch are rendered in the same draw call. This makes sokol_instancing.h
+    unsuitable for objects which need to be rendered back-to-front (e.g.
+    blended transparent objects).
+
+    To get statistics about the last flush:
+
+        sinst_stats stats = sinst_query_stats();
+
+    At the end of the program call:
+
+        sinst_shutdown();
+
+    ...before sg_shutdown().
+
+
+    LICENSE
+    =======
+
+    zlib/libpng license
+
+    Copyright (c) 2026 Andre Weissflog
+
+    This software is provided 'as-is', without any express or implied warranty.
+    In no event will the authors be held liable for any damages arising from the
+    use of this software.
+
+    Permission is granted to anyone to use this software for any purpose,
+    including commercial applications, and to alter it and redistribute it
+    freely, subject to the following restrictions:
+
+        1. The origin of this software must not be misrepresented; you must not
+        claim that you wrote the original software. If you use this software in a
+        product, an acknowledgment in the product documentation would be
+        appreciated but is not required.
+
+        2. Altered source versions must be plainly marked as such, and must not
+        be misrepresented as being the original software.
+
+        3. This notice may not be removed or altered from any source
+        distribution.
+*/
+#define SOKOL_INSTANCING_INCLUDED (1)
+#include <stddef.h>
+#include <stdint.h>
+#include <stdbool.h>
+
+#if !defined(SOKOL_GFX_INCLUDED)
+#error "Please include sokol_gfx.h before sokol_instancing.h"
+#endif
+
+#if defined(SOKOL_API_DECL) && !defined(SOKOL_INSTANCING_API_DECL)
+#define SOKOL_INSTANCING_API_DECL SOKOL_API_DECL
+#endif
+#ifndef SOKOL_INSTANCING_API_DECL
+#if defined(_WIN32) && defined(SOKOL_DLL) && defined(SOKOL_INSTANCING_IMPL)
+#define SOKOL_INSTANCING_API_DECL __declspec(dllexport)
+#elif defined(_WIN32) && defined(SOKOL_DLL)
+#define SOKOL_INSTANCING_API_DECL __declspec(dllimport)
+#else
+#define SOKOL_INSTANCING_API_DECL extern
+#endif
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+    sinst_log_item
+
+    Log items are defined via X-Macros and expanded to an enum
+    'sinst_log_item', and in debug mode to corresponding
+    human readable error messages.
+*/
+#define _SINST_LOG_ITEMS \
+    _SINST_LOGITEM_XMACRO(OK, "Ok") \
+    _SINST_LOGITEM_XMACRO(MALLOC_FAILED, "memory allocation failed") \
+    _SINST_LOGITEM_XMACRO(MAKE_BUFFER_FAILED, "sg_make_buffer() failed") \
+    _SINST_LOGITEM_XMACRO(DRAW_INVALID_INSTANCE_SLOT, "sinst_draw_desc.instance_slot out of range (must be >= 0 and < SG_MAX_VERTEXBUFFER_BINDSLOTS)") \
+    _SINST_LOGITEM_XMACRO(DRAW_INSTANCE_SLOT_OCCUPIED, "sinst_draw_desc.bindings.vertex_buffers[instance_slot] must be empty") \
+    _SINST_LOGITEM_XMACRO(DRAW_INVALID_DATA_SIZE, "sinst_draw_desc.data.size must be > 0 and a multiple of 4") \
+    _SINST_LOGITEM_XMACRO(INSTANCE_POOL_EXHAUSTED, "too many instances between flushes (sinst_desc.max_instances)") \
+    _SINST_LOGITEM_XMACRO(BATCH_POOL_EXHAUSTED, "too many batches between flushes (sinst_desc.max_batches)") \
+    _SINST_LOGITEM_XMACRO(STAGING_BUFFER_FULL, "per-instance data doesn't fit into staging buffer (sinst_desc.buffer_size)") \
+    _SINST_LOGITEM_XMACRO(STREAM_BUFFER_FULL, "per-instance data doesn't fit into stream buffer in this frame, draws dropped (sinst_desc.buffer_size)") \
+
+#define _SINST_LOGITEM_XMACRO(item,msg) SINST_LOGITEM_##item,
+typedef enum sinst_log_item {
+    _SINST_LOG_ITEMS
+} sinst_log_item;
+#undef _SINST_LOGITEM_XMACRO
+
+/*
+    sinst_draw_desc
+
+    Describes a single object draw, passed into sinst_draw(). The
+    vertex buffer bind slot 'instance_slot' in 'bindings' must be empty,
+    it will be populated with the instance data stream buffer.
+*/
+typedef struct sinst_draw_desc {
+    sg_pipeline pipeline;
+    sg_bindings bindings;
+    int instance_slot;      // vertex buffer bind slot for per-instance data
+    int base_element;
+    int num_elements;
+    sg_range data;          // per-instance data (size must be a multiple of 4)
+} sinst_draw_desc;
+
+/*
+    sinst_flush_desc
+
+    Optional parameters for sinst_flush_ex(). The apply_uniforms callback
+    is called after each sg_apply_pipeline() to apply uniforms which are
+    shared by all instances.
+*/
+typedef struct sinst_flush_desc {
+    void (*apply_uniforms)(sg_pipeline pip, void* user_data);
+    void* user_data;
+} sinst_flush_desc;
+
+/*
+    sinst_stats
+
+    Statistics about the last flush, returned by sinst_query_stats().
+*/
+typedef struct sinst_stats {
+    int num_instances;      // number of sinst_draw() calls rendered
+    int num_batches;        // number of instanced sg_draw() calls
+    int num_pipelines;      // number of sg_apply_pipeline() calls
+    int num_bytes;          // number of per-instance data bytes written to the stream buffer
+} sinst_stats;
+
+/*
+    sinst_allocator
+
+    Used in sinst_desc to provide custom memory-alloc and -free functions
+    to sokol_instancing.h. If memory management should be overridden, both
+    the alloc and free function must be provided (e.g. it's not valid to
+    override one function but not the other).
+*/
+typedef struct sinst_allocator {
+    void* (*alloc_fn)(size_t size, void* user_data);
+    void (*free_fn)(void* ptr, void* user_data);
+    void* user_data;
+} sinst_allocator;
+
+/*
+    sinst_logger
+
+    Used in sinst_desc to provide a custom logging and error reporting
+    callback to sokol_instancing.h.
+*/
+typedef struct sinst_logger {
+    void (*func)(
+        const char* tag,                // always "sinst"
+        uint32_t log_level,             // 0=panic, 1=error, 2=warning, 3=info
+        uint32_t log_item_id,           // SINST_LOGITEM_*
+        const char* message_or_null,    // a message string, may be nullptr in release mode
+        uint32_t line_nr,               // line number in sokol_instancing.h
+        const char* filename_or_null,   // source filename, may be nullptr in release mode
+        void* user_data);
+    void* user_data;
+} sinst_logger;
+
+/*
+    Initialization parameters passed into sinst_setup(). You should at least
+    provide a logging function, otherwise you won't see any error logging.
+*/
+typedef struct sinst_desc {
+    int max_instances;      // max number of sinst_draw() calls between flushes, default: 16384
+    int max_batches;        // max number of distinct batches between flushes, default: 256
+    int buffer_size;        // size of per-instance data staging and stream buffer in bytes, default: 1 MB
+    sinst_allocator allocator;
+    sinst_logger logger;
+} sinst_desc;
+
+// setup sokol-instancing (call after sg_setup())
+SOKOL_INSTANCING_API_DECL void sinst_setup(const sinst_desc* desc);
+// shutdown sokol-instancing (call before sg_shutdown())
+SOKOL_INSTANCING_API_DECL void sinst_shutdown(void);
+// record a draw of a single object
+SOKOL_INSTANCING_API_DECL void sinst_draw(const sinst_draw_desc* desc);
+// render all recorded draws (must be called inside a sokol-gfx render pass)
+SOKOL_INSTANCING_API_DECL void sinst_flush(void);
+// same as sinst_flush() with a callback to apply shared uniforms
+SOKOL_INSTANCING_API_DECL void sinst_flush_ex(const sinst_flush_desc* desc);
+// get statistics about the last flush
+SOKOL_INSTANCING_API_DECL sinst_stats sinst_query_stats(void);
+
+#ifdef __cplusplus
+} // extern "C"
+inline void sinst_setup(const sinst_desc& desc) { return sinst_setup(&desc); }
+inline void sinst_draw(const sinst_draw_desc& desc) { return sinst_draw(&desc); }
+inline void sinst_flush_ex(const sinst_flush_desc& desc) { return sinst_flush_ex(&desc); }
+#endif
+#endif // SOKOL_INSTANCING_INCLUDED
+
+/*=== IMPLEMENTATION =========================================================*/
+#ifdef SOKOL_INSTANCING_IMPL
+#define SOKOL_INSTANCING_IMPL_INCLUDED (1)
+
+#include <stdlib.h> // malloc, free, abort, qsort
+#include <string.h> // memset, memcpy, memcmp
+
+#ifndef SOKOL_API_IMPL
+    #define SOKOL_API_IMPL
+#endif
+#ifndef SOKOL_DEBUG
+    #ifndef NDEBUG
+        #define SOKOL_DEBUG
+    #endif
+#endif
+#ifndef SOKOL_ASSERT
+    #include <assert.h>
+    #define SOKOL_ASSERT(c) assert(c)
+#endif
+
+#define _sinst_def(val, def) (((val) == 0) ? (def) : (val))
+#define _SINST_INIT_TAG (0xBEEFBEEF)
+
+// >>structs
+enum {
+    _SINST_DEFAULT_MAX_INSTANCES = 16384,
+    _SINST_DEFAULT_MAX_BATCHES = 256,
+    _SINST_DEFAULT_BUFFER_SIZE = 1024 * 1024,
+};
+
+// everything which must be identical for draws to be merged into one batch,
+// only consists of 32-bit items, so there's no padding and memcmp() works
+typedef struct {
+    sg_pipeline pipeline;
+    sg_bindings bindings;
+    int instance_slot;
+    int base_element;
+    int num_elements;
+    uint32_t stride;
+} _sinst_key_t;
+
+typedef struct {
+    _sinst_key_t key;
+    uint32_t hash;
+    int num_instances;
+    uint32_t offset;        // byte offset into sorted data, computed in flush
+    uint32_t cursor;        // write cursor into sorted data, used in flush
+} _sinst_batch_t;
+
+typedef struct {
+    int batch_index;
+    uint32_t offset;        // byte offset into staging data
+} _sinst_instance_t;
+
+typedef struct {
+    uint32_t init_tag;
+    sinst_desc desc;
+    sg_buffer buf;
+    int num_instances;
+    int num_batches;
+    uint32_t num_bytes;
+    _sinst_instance_t* instances;
+    _sinst_batch_t* batches;
+    int* batch_order;       // batch indices sorted by pipeline
+    int* hash_table;        // open addressing, batch index + 1, or 0 for empty
+    uint32_t hash_mask;
+    uint8_t* staging;       // per-instance data in sinst_draw() order
+    uint8_t* sorted;        // per-instance data sorted by batch
+    sinst_stats stats;
+} _sinst_state_t;
+static _sinst_state_t _sinst;
+
+// >>logging
+#if defined(SOKOL_DEBUG)
+#define _SINST_LOGITEM_XMACRO(item,msg) #item ": " msg,
+static const char* _sinst_log_messages[] = {
+    _SINST_LOG_ITEMS
+};
+#undef _SINST_LOGITEM_XMACRO
+#endif // SOKOL_DEBUG
+
+#define _SINST_PANIC(code) _sinst_log(SINST_LOGITEM_ ##code, 0, __LINE__)
+#define _SINST_ERROR(code) _sinst_log(SINST_LOGITEM_ ##code, 1, __LINE__)
+#define _SINST_WARN(code) _sinst_log(SINST_LOGITEM_ ##code, 2, __LINE__)
+#define _SINST_INFO(code) _sinst_log(SINST_LOGITEM_ ##code, 3, __LINE__)
+
+static void _sinst_log(sinst_log_item log_item, uint32_t log_level, uint32_t line_nr) {
+    if (_sinst.desc.logger.func) {
+        const char* filename = 0;
+        const char* msg = 0;
+        #if defined(SOKOL_DEBUG)
+            filename = __FILE__;
+            msg = _sinst_log_messages[log_item];
+        #endif
+        _sinst.desc.logger.func("sinst", log_level, (uint32_t)log_item, msg, line_nr, filename, _sinst.desc.logger.user_data);
+    } else {
+        // for log level PANIC it would be 'undefined behaviour' to continue
+        if (log_level == 0) {
+            abort();
+        }
+    }
+}
+
+// >>memory
+static void _sinst_clear(void* ptr, size_t size) {
+    SOKOL_ASSERT(ptr && (size > 0));
+    memset(ptr, 0, size);
+}
+
+static void* _sinst_malloc(size_t size) {
+    SOKOL_ASSERT(size > 0);
+    void* ptr;
+    if (_sinst.desc.allocator.alloc_fn) {
+        ptr = _sinst.desc.allocator.alloc_fn(size, _sinst.desc.allocator.user_data);
+    } else {
+        ptr = malloc(size);
+    }
+    if (0 == ptr) {
+        _SINST_PANIC(MALLOC_FAILED);
+    }
+    return ptr;
+}
+
+static void* _sinst_malloc_clear(size_t size) {
+    void* ptr = _sinst_malloc(size);
+    _sinst_clear(ptr, size);
+    return ptr;
+}
+
+static void _sinst_free(void* ptr) {
+    if (_sinst.desc.allocator.free_fn) {
+        _sinst.desc.allocator.free_fn(ptr, _sinst.desc.allocator.user_data);
+    } else {
+        free(ptr);
+    }
+}
+
+static sinst_desc _sinst_desc_defaults(const sinst_desc* desc) {
+    SOKOL_ASSERT(desc);
+    sinst_desc res = *desc;
+    res.max_instances = _sinst_def(res.max_instances, _SINST_DEFAULT_MAX_INSTANCES);
+    res.max_batches = _sinst_def(res.max_batches, _SINST_DEFAULT_MAX_BATCHES);
+    res.buffer_size = _sinst_def(res.buffer_size, _SINST_DEFAULT_BUFFER_SIZE);
+    return res;
+}
+
+// >>batches
+// FNV-1a
+static uint32_t _sinst_hash(const void* ptr, size_t num_bytes) {
+    const uint8_t* bytes = (const uint8_t*)ptr;
+    uint32_t hash = 2166136261u;
+    for (size_t i = 0; i < num_bytes; i++) {
+        hash = (hash ^ bytes[i]) * 16777619u;
+    }
+    return hash;
+}
+
+// find or create the batch for a key, returns -1 if the batch pool is exhausted
+static int _sinst_find_or_create_batch(const _sinst_key_t* key) {
+    const uint32_t hash = _sinst_hash(key, sizeof(_sinst_key_t));
+    uint32_t slot = hash & _sinst.hash_mask;
+    while (_sinst.hash_table[slot] != 0) {
+        const int batch_index = _sinst.hash_table[slot] - 1;
+        const _sinst_batch_t* batch = &_sinst.batches[batch_index];
+        if ((batch->hash == hash) && (0 == memcmp(&batch->key, key, sizeof(_sinst_key_t)))) {
+            return batch_index;
+        }
+        slot = (slot + 1) & _sinst.hash_mask;
+    }
+    if (_sinst.num_batches >= _sinst.desc.max_batches) {
+        _SINST_ERROR(BATCH_POOL_EXHAUSTED);
+        return -1;
+    }
+    const int batch_index = _sinst.num_batches++;
+    _sinst_batch_t* batch = &_sinst.batches[batch_index];
+    _sinst_clear(batch, sizeof(_sinst_batch_t));
+    batch->key = *key;
+    batch->hash = hash;
+    _sinst.hash_table[slot] = batch_index + 1;
+    return batch_index;
+}
+
+static void _sinst_reset(void) {
+    _sinst.num_instances = 0;
+    _sinst.num_batches = 0;
+    _sinst.num_bytes = 0;
+    _sinst_clear(_sinst.hash_table, sizeof(int) * (_sinst.hash_mask + 1));
+}
+
+// sort batches by pipeline, and by creation order for identical pipelines
+static int _sinst_cmp_batch_order(const void* a, const void* b) {
+    const int ia = *(const int*)a;
+    const int ib = *(const int*)b;
+    const uint32_t pa = _sinst.batches[ia].key.pipeline.id;
+    const uint32_t pb = _sinst.batches[ib].key.pipeline.id;
+    if (pa != pb) {
+        return (pa < pb) ? -1 : 1;
+    }
+    return ia - ib;
+}
+
+static bool _sinst_validate_draw_desc(const sinst_draw_desc* desc) {
+    if ((desc->instance_slot < 0) || (desc->instance_slot >= SG_MAX_VERTEXBUFFER_BINDSLOTS)) {
+        _SINST_ERROR(DRAW_INVALID_INSTANCE_SLOT);
+        return false;
+    }
+    if (desc->bindings.vertex_buffers[desc->instance_slot].id != SG_INVALID_ID) {
+        _SINST_ERROR(DRAW_INSTANCE_SLOT_OCCUPIED);
+        return false;
+    }
+    if ((0 == desc->data.ptr) || (0 == desc->data.size) || ((desc->data.size & 3) != 0)) {
+        _SINST_ERROR(DRAW_INVALID_DATA_SIZE);
+        return false;
+    }
+    return true;
+}
+
+// >>public
+SOKOL_API_IMPL void sinst_setup(const sinst_desc* desc) {
+    SOKOL_ASSERT(desc);
+    SOKOL_ASSERT((desc->allocator.alloc_fn && desc->allocator.free_fn) || (!desc->allocator.alloc_fn && !desc->allocator.free_fn));
+    _sinst_clear(&_sinst, sizeof(_sinst));
+    _sinst.init_tag = _SINST_INIT_TAG;
+    _sinst.desc = _sinst_desc_defaults(desc);
+    SOKOL_ASSERT(_sinst.desc.max_instances > 0);
+    SOKOL_ASSERT(_sinst.desc.max_batches > 0);
+    SOKOL_ASSERT(_sinst.desc.buffer_size > 0);
+
+    // hash table size is the next power of two >= 2 * max_batches
+    uint32_t hash_size = 1;
+    while (hash_size < (uint32_t)(2 * _sinst.desc.max_batches)) {
+        hash_size <<= 1;
+    }
+    _sinst.hash_mask = hash_size - 1;
+    _sinst.hash_table = (int*) _sinst_malloc_clear(sizeof(int) * hash_size);
+    _sinst.instances = (_sinst_instance_t*) _sinst_malloc_clear(sizeof(_sinst_instance_t) * (size_t)_sinst.desc.max_instances);
+    _sinst.batches = (_sinst_batch_t*) _sinst_malloc_clear(sizeof(_sinst_batch_t) * (size_t)_sinst.desc.max_batches);
+    _sinst.batch_order = (int*) _sinst_malloc_clear(sizeof(int) * (size_t)_sinst.desc.max_batches);
+    _sinst.staging = (uint8_t*) _sinst_malloc_clear((size_t)_sinst.desc.buffer_size);
+    _sinst.sorted = (uint8_t*) _sinst_malloc_clear((size_t)_sinst.desc.buffer_size);
+
+    sg_buffer_desc buf_desc;
+    _sinst_clear(&buf_desc, sizeof(buf_desc));
+    buf_desc.size = (size_t)_sinst.desc.buffer_size;
+    buf_desc.usage.vertex_buffer = true;
+    buf_desc.usage.stream_update = true;
+    buf_desc.label = "sinst-instance-buffer";
+    _sinst.buf = sg_make_buffer(&buf_desc);
+    if (sg_query_buffer_state(_sinst.buf) != SG_RESOURCESTATE_VALID) {
+        _SINST_ERROR(MAKE_BUFFER_FAILED);
+    }
+}
+
+SOKOL_API_IMPL void sinst_shutdown(void) {
+    SOKOL_ASSERT(_SINST_INIT_TAG == _sinst.init_tag);
+    sg_destroy_buffer(_sinst.buf);
+    _sinst_free(_sinst.sorted);
+    _sinst_free(_sinst.staging);
+    _sinst_free(_sinst.batch_order);
+    _sinst_free(_sinst.batches);
+    _sinst_free(_sinst.instances);
+    _sinst_free(_sinst.hash_table);
+    _sinst_clear(&_sinst, sizeof(_sinst));
+}
+
+SOKOL_API_IMPL void sinst_draw(const sinst_draw_desc* desc) {
+    SOKOL_ASSERT(_SINST_INIT_TAG == _sinst.init_tag);
+    SOKOL_ASSERT(desc);
+    if (!_sinst_validate_draw_desc(desc)) {
+        return;
+    }
+    if (_sinst.num_instances >= _sinst.desc.max_instances) {
+        _SINST_ERROR(INSTANCE_POOL_EXHAUSTED);
+        return;
+    }
+    const uint32_t stride = (uint32_t)desc->data.size;
+    if ((_sinst.num_bytes + stride) > (uint32_t)_sinst.desc.buffer_size) {
+        _SINST_ERROR(STAGING_BUFFER_FULL);
+        return;
+    }
+    _sinst_key_t key;
+    _sinst_clear(&key, sizeof(key));
+    key.pipeline = desc->pipeline;
+    key.bindings = desc->bindings;
+    key.instance_slot = desc->instance_slot;
+    key.base_element = desc->base_element;
+    key.num_elements = desc->num_elements;
+    key.stride = stride;
+    const int batch_index = _sinst_find_or_create_batch(&key);
+    if (batch_index < 0) {
+        return;
+    }
+    _sinst.batches[batch_index].num_instances++;
+    _sinst_instance_t* inst = &_sinst.instances[_sinst.num_instances++];
+    inst->batch_index = batch_index;
+    inst->offset = _sinst.num_bytes;
+    memcpy(_sinst.staging + _sinst.num_bytes, desc->data.ptr, stride);
+    _sinst.num_bytes += stride;
+}
+
+SOKOL_API_IMPL void sinst_flush_ex(const sinst_flush_desc* desc) {
+    SOKOL_ASSERT(_SINST_INIT_TAG == _sinst.init_tag);
+    SOKOL_ASSERT(desc);
+    _sinst_clear(&_sinst.stats, sizeof(_sinst.stats));
+    if (0 == _sinst.num_instances) {
+        _sinst_reset();
+        return;
+    }
+    if (sg_query_buffer_will_overflow(_sinst.buf, _sinst.num_bytes)) {
+        _SINST_ERROR(STREAM_BUFFER_FULL);
+        _sinst_reset();
+        return;
+    }
+
+    // sort the batches by pipeline (qsort over the few batches), then compute
+    // each batch's start offset from its instance count and scatter the
+    // per-instance data into its batch's range (stable within a batch)
+    for (int i = 0; i < _sinst.num_batches; i++) {
+        _sinst.batch_order[i] = i;
+    }
+    qsort(_sinst.batch_order, (size_t)_sinst.num_batches, sizeof(int), _sinst_cmp_batch_order);
+    uint32_t offset = 0;
+    for (int i = 0; i < _sinst.num_batches; i++) {
+        _sinst_batch_t* batch = &_sinst.batches[_sinst.batch_order[i]];
+        batch->offset = offset;
+        batch->cursor = offset;
+        offset += (uint32_t)batch->num_instances * batch->key.stride;
+    }
+    SOKOL_ASSERT(offset == _sinst.num_bytes);
+    for (int i = 0; i < _sinst.num_instances; i++) {
+        const _sinst_instance_t* inst = &_sinst.instances[i];
+        _sinst_batch_t* batch = &_sinst.batches[inst->batch_index];
+        memcpy(_sinst.sorted + batch->cursor, _sinst.staging + inst->offset, batch->key.stride);
+        batch->cursor += batch->key.stride;
+    }
+    sg_range range;
+    range.ptr = _sinst.sorted;
+    range.size = _sinst.num_bytes;
+    const int base_offset = sg_append_buffer(_sinst.buf, &range);
+
+    // one instanced draw call per batch
+    uint32_t cur_pip_id = SG_INVALID_ID;
+    for (int i = 0; i < _sinst.num_batches; i++) {
+        const _sinst_batch_t* batch = &_sinst.batches[_sinst.batch_order[i]];
+        if (batch->key.pipeline.id != cur_pip_id) {
+            cur_pip_id = batch->key.pipeline.id;
+            sg_apply_pipeline(batch->key.pipeline);
+            if (desc->apply_uniforms) {
+                desc->apply_uniforms(batch->key.pipeline, desc->user_data);
+            }
+            _sinst.stats.num_pipelines++;
+        }
+        sg_bindings bindings = batch->key.bindings;
+        bindings.vertex_buffers[batch->key.instance_slot] = _sinst.buf;
+        bindings.vertex_buffer_offsets[batch->key.instance_slot] = base_offset + (int)batch->offset;
+        sg_apply_bindings(&bindings);
+        sg_draw(batch->key.base_element, batch->key.num_elements, batch->num_instances);
+    }
+    _sinst.stats.num_instances = _sinst.num_instances;
+    _sinst.stats.num_batches = _sinst.num_batches;
+    _sinst.stats.num_bytes = (int)_sinst.num_bytes;
+    _sinst_reset();
+}
+
+SOKOL_API_IMPL void sinst_flush(void) {
+    sinst_flush_desc desc;
+    _sinst_clear(&desc, sizeof(desc));
+    sinst_flush_ex(&desc);
+}
+
+SOKOL_API_IMPL sinst_stats sinst_query_stats(void) {
+    SOKOL_ASSERT(_SINST_INIT_TAG == _sinst.init_tag);
+    return _sinst.stats;
+}
+
+#endif // SOKOL_INSTANCING_IMPL
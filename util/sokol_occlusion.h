@@ -0,0 +1,1070 @@
+#if defined(SOKOL_IMPL) && !defined(SOKOL_OCCLUSION_IMPL)
+#define SOKOL_OCCLUSION_IMPL
+#endif
+#ifndef SOKOL_OCCLUSION_INCLUDED
+/*
+    sokol_occlusion.h -- CPU occlusion culling with a software depth buffer
+
+    Project URL: https://github.com/floooh/sokol
+
+    Do this:
+        #define SOKOL_IMPL or
+        #define SOKOL_OCCLUSION_IMPL
+    before you include this file in *one* C or C++ file to create the
+    implementation.
+
+    Optionally provide the following defines with your own implementations:
+
+    SOKOL_ASSERT(c)     - your own assert macro (default: assert(c))
+    SOKOL_OCCLUSION_API_DECL - public function declaration prefix (default: extern)
+    SOKOL_API_DECL      - same as SOKOL_OCCLUSION_API_DECL
+    SOKOL_API_IMPL      - public function implementation prefix (default: -)
+
+    If sokol_occlusion.h is compiled as a DLL, define the following before
+    including the declaration or implementation:
+
+    SOKOL_DLL
+
+    Include the following headers before including sokol_occlusion.h:
+
+        sokol_gfx.h
+
+    WHAT
+    ====
+    sokol_occlusion.h rasterizes a small number of occluder meshes (e.g.
+    simplified building hulls, terrain or large walls) into a low-resolution
+    depth buffer on the CPU, and then tests the bounding boxes of scene objects
+    against this depth buffer before any sokol-gfx draw calls are issued.
+    Objects which are completely hidden behind occluders (or outside the view
+    frustum) can be skipped entirely.
+
+    Since everything happens on the CPU in the same frame there's no feedback
+    latency like with GPU occlusion queries, and the results don't depend on
+    the GPU or the sokol-gfx backend.
+
+    A hierarchical depth buffer with the farthest depth of each 8x8 pixel tile
+    is built after rasterization, so that most bounding box tests can be
+    answered from a few tiles without looking at individual pixels.
+
+    The depth buffer is divided into horizontal bands of 32 pixel rows which
+    can be rasterized in parallel on different threads (see MULTITHREADING
+    below), sokol_occlusion.h doesn't create any threads itself.
+
+    HOW
+    ===
+    First initialize sokol_occlusion.h after sokol_gfx.h:
+
+        socc_setup(&(socc_desc){
+            .logger.func = slog_func,
+        });
+
+    The default depth buffer resolution is 256x128 pixels, and the max number
+    of occluder triangles per frame is 16384. Those can be tweaked in the
+    socc_desc struct (width and height must be multiples of 8):
+
+        socc_setup(&(socc_desc){
+            .width = 320,
+            .height = 192,
+            .max_triangles = 32768,
+            .logger.func = slog_func,
+        });
+
+    At the start of a frame, call socc_begin() with the same view-projection
+    matrix used for rendering:
+
+        socc_begin(&(socc_begin_desc){
+            .view_proj = socc_mat4(view_proj),
+        });
+
+    Matrices are column-major (same memory layout as in sokol_shape.h, HandmadeMath
+    or GLM). The projection must map depth so that z/w increases with distance
+    (e.g. the usual OpenGL or D3D projection matrices, but not 'reverse-z').
+
+    Add the occluders visible in this frame. The vertex and index data is
+    the same data which is used to create vertex- and index-buffers with
+    sg_make_buffer(), only the xyz position at the start of each vertex is
+    used:
+
+        socc_add_occluder(&(socc_occluder_desc){
+            .vertices = SG_RANGE(hull_vertices),
+            .vertex_stride = sizeof(vertex_t),      // default: 12
+            .indices = SG_RANGE(hull_indices),      // optional
+            .index_type = SG_INDEXTYPE_UINT16,      // or SG_INDEXTYPE_UINT32
+            .model = socc_mat4(model),              // default: identity
+        });
+
+    Triangles are rendered double-sided, and the occluder meshes should be
+    completely inside the objects they represent (otherwise objects which
+    are actually visible might be culled).
+
+    After all occluders have been added, rasterize the depth buffer:
+
+        socc_end();
+
+    Now test the world-space bounding boxes of scene objects:
+
+        if (socc_test_box(obj->aabb_min, obj->aabb_max)) {
+            // object is potentially visible
+            sg_apply_pipeline(...);
+            ...
+            sg_draw(...);
+        }
+
+    socc_test_box() returns false if the box is entirely outside the view
+    frustum, or if it is entirely hidden by the rasterized occluders.
+
+    NOTE that the occlusion test is not strictly conservative: occluders are
+    rasterized like on the GPU by sampling coverage and depth at pixel
+    centers, while a box is tested against all depth buffer pixels its
+    screen-space rectangle touches, with the nearest depth of its corners.
+    Since the depth buffer has a low resolution, a box can be reported as
+    hidden when it would only be visible through a gap in the occluders
+    which is narrower than a depth buffer pixel (e.g. next to a thin occluder
+    edge, or between two occluders which don't quite touch). Keep occluders
+    well inside the objects they represent to compensate for this.
+
+    To get statistics about the current frame:
+
+        socc_stats stats = socc_query_stats();
+
+    At the end of the program call:
+
+        socc_shutdown();
+
+    ...before sg_shutdown().
+
+    MULTITHREADING
+    ==============
+    Instead of rasterizing all bands in socc_end(), the bands can be
+    rasterized on multiple threads between socc_add_occluder() and
+    socc_end() by calling:
+
+        socc_rasterize_band(int band_index);
+
+    ...with band indices from 0 to socc_num_bands()-1. Each band is only
+    written by its own call, so that different bands can be rasterized
+    concurrently. socc_end() then only rasterizes the bands which haven't
+    been rasterized yet (make sure that all threads are finished before
+    calling socc_end()). No other sokol_occlusion.h functions may be called
+    while bands are rasterized on other threads.
+
+    After socc_end(), socc_test_box() only reads data and may be called from
+    multiple threads at the same time (the per-frame test statistics are not
+    thread-safe though).
+
+    DEBUG VISUALIZATION
+    ===================
+    When socc_desc.debug_image is true, sokol_occlusion.h creates an R32F
+    sokol-gfx image of the depth buffer size which is updated in socc_end().
+    The image and a texture view on it can be queried with socc_query_debug_image()
+    and socc_query_debug_view() (e.g. to display the depth buffer in a
+    Dear ImGui window).
+
+    LICENSE
+    =======
+
+    zlib/libpng license
+
+    Copyright (c) 2026 Andre Weissflog
+
+    This software is provided 'as-is', without any express or implied warranty.
+    In no event will the authors be held liable for any damages arising from the
+    use of this software.
+
+    Permission is granted to anyone to use this software for any purpose,
+    including commercial applications, and to alter it and redistribute it
+    freely, subject to the following restrictions:
+
+        1. The origin of this software must not be misrepresented; you must not
+        claim that you wrote the original software. If you use this software in a
+        product, an acknowledgment in the product documentation would be
+        appreciated but is not required.
+
+        2. Altered source versions must be plainly marked as such, and must not
+        be misrepresented as being the original software.
+
+        3. This notice may not be removed or altered from any source
+        distribution.
+*/
+#define SOKOL_OCCLUSION_INCLUDED (1)
+#include <stddef.h>
+#include <stdint.h>
+#include <stdbool.h>
+
+#if !defined(SOKOL_GFX_INCLUDED)
+#error "Please include sokol_gfx.h before sokol_occlusion.h"
+#endif
+
+#if defined(SOKOL_API_DECL) && !defined(SOKOL_OCCLUSION_API_DECL)
+#define SOKOL_OCCLUSION_API_DECL SOKOL_API_DECL
+#endif
+#ifndef SOKOL_OCCLUSION_API_DECL
+#if defined(_WIN32) && defined(SOKOL_DLL) && defined(SOKOL_OCCLUSION_IMPL)
+#define SOKOL_OCCLUSION_API_DECL __declspec(dllexport)
+#elif defined(_WIN32) && defined(SOKOL_DLL)
+#define SOKOL_OCCLUSION_API_DECL __declspec(dllimport)
+#else
+#define SOKOL_OCCLUSION_API_DECL extern
+#endif
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+    socc_log_item
+
+    Log items are defined via X-Macros and expanded to an enum
+    'socc_log_item', and in debug mode to corresponding
+    human readable error messages.
+*/
+#define _SOCC_LOG_ITEMS \
+    _SOCC_LOGITEM_XMACRO(OK, "Ok") \
+    _SOCC_LOGITEM_XMACRO(MALLOC_FAILED, "memory allocation failed") \
+    _SOCC_LOGITEM_XMACRO(MAKE_DEBUG_IMAGE_FAILED, "failed to create debug image (SG_PIXELFORMAT_R32F not supported?)") \
+    _SOCC_LOGITEM_XMACRO(ADD_OCCLUDER_OUTSIDE_BEGIN_END, "socc_add_occluder() must be called between socc_begin() and socc_end()") \
+    _SOCC_LOGITEM_XMACRO(ADD_OCCLUDER_INVALID_VERTICES, "socc_occluder_desc.vertices: data pointer missing or size not a multiple of vertex stride") \
+    _SOCC_LOGITEM_XMACRO(ADD_OCCLUDER_INVALID_INDICES, "socc_occluder_desc.indices: size must be a multiple of the index size") \
+    _SOCC_LOGITEM_XMACRO(ADD_OCCLUDER_INDEX_OUT_OF_RANGE, "socc_add_occluder(): vertex index out of range") \
+    _SOCC_LOGITEM_XMACRO(TRIANGLE_BUFFER_FULL, "too many occluder triangles in frame (socc_desc.max_triangles)") \
+    _SOCC_LOGITEM_XMACRO(TEST_BOX_BEFORE_END, "socc_test_box() called before socc_end()") \
+
+#define _SOCC_LOGITEM_XMACRO(item,msg) SOCC_LOGITEM_##item,
+typedef enum socc_log_item {
+    _SOCC_LOG_ITEMS
+} socc_log_item;
+#undef _SOCC_LOGITEM_XMACRO
+
+// a 4x4 column-major matrix wrapper struct
+typedef struct socc_mat4_t { float m[4][4]; } socc_mat4_t;
+
+/*
+    socc_begin_desc
+
+    Per-frame parameters for socc_begin().
+*/
+typedef struct socc_begin_desc {
+    socc_mat4_t view_proj;
+} socc_begin_desc;
+
+/*
+    socc_occluder_desc
+
+    Describes an occluder mesh for socc_add_occluder(). Without index
+    data the vertices are a triangle list.
+*/
+typedef struct socc_occluder_desc {
+    sg_range vertices;          // float3 positions at the start of each vertex
+    int vertex_stride;          // default: 12
+    sg_range indices;           // optional index data for an indexed triangle list
+    sg_index_type index_type;   // SG_INDEXTYPE_UINT16 (default) or SG_INDEXTYPE_UINT32
+    socc_mat4_t model;          // model-to-world matrix, default: identity
+} socc_occluder_desc;
+
+/*
+    socc_stats
+
+    Statistics about the current frame, returned by socc_query_stats().
+*/
+typedef struct socc_stats {
+    int num_occluders;          // number of socc_add_occluder() calls
+    int num_triangles;          // number of triangles which reached the rasterizer
+    int num_tests;              // number of socc_test_box() calls
+    int num_frustum_culled;     // number of boxes outside the view frustum
+    int num_occlusion_culled;   // number of boxes hidden by occluders
+} socc_stats;
+
+/*
+    socc_allocator
+
+    Used in socc_desc to provide custom memory-alloc and -free functions
+    to sokol_occlusion.h. If memory management should be overridden, both
+    the alloc and free function must be provided (e.g. it's not valid to
+    override one function but not the other).
+*/
+typedef struct socc_allocator {
+    void* (*alloc_fn)(size_t size, void* user_data);
+    void (*free_fn)(void* ptr, void* user_data);
+    void* user_data;
+} socc_allocator;
+
+/*
+    socc_logger
+
+    Used in socc_desc to provide a custom logging and error reporting
+    callback to sokol_occlusion.h.
+*/
+typedef struct socc_logger {
+    void (*func)(
+        const char* tag,                // always "socc"
+        uint32_t log_level,             // 0=panic, 1=error, 2=warning, 3=info
+        uint32_t log_item_id,           // SOCC_LOGITEM_*
+        const char* message_or_null,    // a message string, may be nullptr in release mode
+        uint32_t line_nr,               // line number in sokol_occlusion.h
+        const char* filename_or_null,   // source filename, may be nullptr in release mode
+        void* user_data);
+    void* user_data;
+} socc_logger;
+
+/*
+    Initialization parameters passed into socc_setup(). You should at least
+    provide a logging function, otherwise you won't see any error logging.
+*/
+typedef struct socc_desc {
+    int width;                  // depth buffer width, multiple of 8, default: 256
+    int height;                 // depth buffer height, multiple of 8, default: 128
+    int max_triangles;          // max number of occluder triangles per frame, default: 16384
+    bool debug_image;           // create an R32F image with the depth buffer content
+    socc_allocator allocator;
+    socc_logger logger;
+} socc_desc;
+
+// setup sokol-occlusion
+SOKOL_OCCLUSION_API_DECL void socc_setup(const socc_desc* desc);
+// shutdown sokol-occlusion
+SOKOL_OCCLUSION_API_DECL void socc_shutdown(void);
+// start a new frame
+SOKOL_OCCLUSION_API_DECL void socc_begin(const socc_begin_desc* desc);
+// add an occluder mesh
+SOKOL_OCCLUSION_API_DECL void socc_add_occluder(const socc_occluder_desc* desc);
+// get the number of rasterizer bands
+SOKOL_OCCLUSION_API_DECL int socc_num_bands(void);
+// optionally rasterize a band (may be called on different threads for different bands)
+SOKOL_OCCLUSION_API_DECL void socc_rasterize_band(int band_index);
+// rasterize remaining bands and finish the depth buffer
+SOKOL_OCCLUSION_API_DECL void socc_end(void);
+// test a world-space bounding box, returns false if the box is hidden or outside the frustum
+SOKOL_OCCLUSION_API_DECL bool socc_test_box(const float box_min[3], const float box_max[3]);
+// get the depth value of a depth buffer pixel (mainly for testing)
+SOKOL_OCCLUSION_API_DECL float socc_query_depth(int x, int y);
+// get statistics about the current frame
+SOKOL_OCCLUSION_API_DECL socc_stats socc_query_stats(void);
+// get the debug visualization image (only with socc_desc.debug_image)
+SOKOL_OCCLUSION_API_DECL sg_image socc_query_debug_image(void);
+// get a texture view on the debug visualization image
+SOKOL_OCCLUSION_API_DECL sg_view socc_query_debug_view(void);
+// matrix helpers
+SOKOL_OCCLUSION_API_DECL socc_mat4_t socc_mat4(const float m[16]);
+SOKOL_OCCLUSION_API_DECL socc_mat4_t socc_mat4_transpose(const float m[16]);
+
+#ifdef __cplusplus
+} // extern "C"
+inline void socc_setup(const socc_desc& desc) { return socc_setup(&desc); }
+inline void socc_begin(const socc_begin_desc& desc) { return socc_begin(&desc); }
+inline void socc_add_occluder(const socc_occluder_desc& desc) { return socc_add_occluder(&desc); }
+#endif
+#endif // SOKOL_OCCLUSION_INCLUDED
+
+/*=== IMPLEMENTATION =========================================================*/
+#ifdef SOKOL_OCCLUSION_IMPL
+#define SOKOL_OCCLUSION_IMPL_INCLUDED (1)
+
+#include <stdlib.h> // malloc, free, abort
+#include <string.h> // memset, memcpy
+#include <math.h>   // floorf, ceilf
+
+#ifndef SOKOL_API_IMPL
+    #define SOKOL_API_IMPL
+#endif
+#ifndef SOKOL_DEBUG
+    #ifndef NDEBUG
+        #define SOKOL_DEBUG
+    #endif
+#endif
+#ifndef SOKOL_ASSERT
+    #include <assert.h>
+    #define SOKOL_ASSERT(c) assert(c)
+#endif
+
+#define _socc_def(val, def) (((val) == 0) ? (def) : (val))
+#define _SOCC_INIT_TAG (0xABCDABCD)
+
+// >>structs
+enum {
+    _SOCC_DEFAULT_WIDTH = 256,
+    _SOCC_DEFAULT_HEIGHT = 128,
+    _SOCC_DEFAULT_MAX_TRIANGLES = 16384,
+    _SOCC_TILE_SIZE = 8,
+    _SOCC_BAND_HEIGHT = 32,
+};
+
+// vertices with a smaller clip-space w are clipped away (near plane)
+#define _SOCC_MIN_W (1.0e-5f)
+// triangles are clipped against a guard band of -3..+3 in NDC (which is
+// one screen width/height left, right, above and below the screen) to keep
+// the edge functions in a sane range
+#define _SOCC_GUARD_BAND (3.0f)
+// max number of vertices after clipping a triangle against the near plane
+// and the 4 guard band planes (each plane adds at most one vertex)
+#define _SOCC_MAX_CLIP_VERTICES (8)
+#define _SOCC_MAX_DEPTH (1.0f)
+
+typedef struct {
+    float x, y, z, w;
+} _socc_vec4_t;
+
+// a screen-space triangle
+typedef struct {
+    float x[3], y[3], z[3];
+    int min_y, max_y;
+} _socc_tri_t;
+
+typedef struct {
+    uint32_t init_tag;
+    socc_desc desc;
+    bool in_frame;
+    bool finished;
+    socc_mat4_t view_proj;
+    int num_tiles_x;
+    int num_tiles_y;
+    int num_bands;
+    float* depth;           // width * height, z/w of nearest occluder
+    float* tile_depth;      // farthest depth per tile
+    bool* band_done;
+    int num_tris;
+    _socc_tri_t* tris;
+    sg_image dbg_img;
+    sg_view dbg_view;
+    socc_stats stats;
+} _socc_state_t;
+static _socc_state_t _socc;
+
+// >>logging
+#if defined(SOKOL_DEBUG)
+#define _SOCC_LOGITEM_XMACRO(item,msg) #item ": " msg,
+static const char* _socc_log_messages[] = {
+    _SOCC_LOG_ITEMS
+};
+#undef _SOCC_LOGITEM_XMACRO
+#endif // SOKOL_DEBUG
+
+#define _SOCC_PANIC(code) _socc_log(SOCC_LOGITEM_ ##code, 0, __LINE__)
+#define _SOCC_ERROR(code) _socc_log(SOCC_LOGITEM_ ##code, 1, __LINE__)
+#define _SOCC_WARN(code) _socc_log(SOCC_LOGITEM_ ##code, 2, __LINE__)
+#define _SOCC_INFO(code) _socc_log(SOCC_LOGITEM_ ##code, 3, __LINE__)
+
+static void _socc_log(socc_log_item log_item, uint32_t log_level, uint32_t line_nr) {
+    if (_socc.desc.logger.func) {
+        const char* filename = 0;
+        const char* msg = 0;
+        #if defined(SOKOL_DEBUG)
+            filename = __FILE__;
+            msg = _socc_log_messages[log_item];
+        #endif
+        _socc.desc.logger.func("socc", log_level, (uint32_t)log_item, msg, line_nr, filename, _socc.desc.logger.user_data);
+    } else {
+        // for log level PANIC it would be 'undefined behaviour' to continue
+        if (log_level == 0) {
+            abort();
+        }
+    }
+}
+
+// >>memory
+static void _socc_clear(void* ptr, size_t size) {
+    SOKOL_ASSERT(ptr && (size > 0));
+    memset(ptr, 0, size);
+}
+
+static void* _socc_malloc(size_t size) {
+    SOKOL_ASSERT(size > 0);
+    void* ptr;
+    if (_socc.desc.allocator.alloc_fn) {
+        ptr = _socc.desc.allocator.alloc_fn(size, _socc.desc.allocator.user_data);
+    } else {
+        ptr = malloc(size);
+    }
+    if (0 == ptr) {
+        _SOCC_PANIC(MALLOC_FAILED);
+    }
+    return ptr;
+}
+
+static void* _socc_malloc_clear(size_t size) {
+    void* ptr = _socc_malloc(size);
+    _socc_clear(ptr, size);
+    return ptr;
+}
+
+static void _socc_free(void* ptr) {
+    if (_socc.desc.allocator.free_fn) {
+        _socc.desc.allocator.free_fn(ptr, _socc.desc.allocator.user_data);
+    } else {
+        free(ptr);
+    }
+}
+
+// >>math
+static bool _socc_mat4_isnull(const socc_mat4_t* m) {
+    for (int y = 0; y < 4; y++) {
+        for (int x = 0; x < 4; x++) {
+            if (0.0f != m->m[y][x]) {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+static socc_mat4_t _socc_mat4_identity(void) {
+    socc_mat4_t m = {
+        {
+            { 1.0f, 0.0f, 0.0f, 0.0f },
+            { 0.0f, 1.0f, 0.0f, 0.0f },
+            { 0.0f, 0.0f, 1.0f, 0.0f },
+            { 0.0f, 0.0f, 0.0f, 1.0f }
+        }
+    };
+    return m;
+}
+
+static socc_mat4_t _socc_mat4_mul(const socc_mat4_t* l, const socc_mat4_t* r) {
+    socc_mat4_t res;
+    for (int c = 0; c < 4; c++) {
+        for (int row = 0; row < 4; row++) {
+            res.m[c][row] = l->m[0][row] * r->m[c][0] +
+                            l->m[1][row] * r->m[c][1] +
+                            l->m[2][row] * r->m[c][2] +
+                            l->m[3][row] * r->m[c][3];
+        }
+    }
+    return res;
+}
+
+static _socc_vec4_t _socc_transform(const socc_mat4_t* m, float x, float y, float z) {
+    _socc_vec4_t res = {
+        m->m[0][0]*x + m->m[1][0]*y + m->m[2][0]*z + m->m[3][0],
+        m->m[0][1]*x + m->m[1][1]*y + m->m[2][1]*z + m->m[3][1],
+        m->m[0][2]*x + m->m[1][2]*y + m->m[2][2]*z + m->m[3][2],
+        m->m[0][3]*x + m->m[1][3]*y + m->m[2][3]*z + m->m[3][3],
+    };
+    return res;
+}
+
+static _socc_vec4_t _socc_lerp(_socc_vec4_t a, _socc_vec4_t b, float t) {
+    _socc_vec4_t res = {
+        a.x + (b.x - a.x) * t,
+        a.y + (b.y - a.y) * t,
+        a.z + (b.z - a.z) * t,
+        a.w + (b.w - a.w) * t,
+    };
+    return res;
+}
+
+static float _socc_minf(float a, float b) {
+    return (a < b) ? a : b;
+}
+
+static float _socc_maxf(float a, float b) {
+    return (a > b) ? a : b;
+}
+
+static float _socc_clampf(float v, float lo, float hi) {
+    return (v < lo) ? lo : ((v > hi) ? hi : v);
+}
+
+// >>misc
+static socc_desc _socc_desc_defaults(const socc_desc* desc) {
+    SOKOL_ASSERT(desc);
+    socc_desc res = *desc;
+    res.width = _socc_def(res.width, _SOCC_DEFAULT_WIDTH);
+    res.height = _socc_def(res.height, _SOCC_DEFAULT_HEIGHT);
+    res.max_triangles = _socc_def(res.max_triangles, _SOCC_DEFAULT_MAX_TRIANGLES);
+    return res;
+}
+
+static socc_occluder_desc _socc_occluder_desc_defaults(const socc_occluder_desc* desc) {
+    SOKOL_ASSERT(desc);
+    socc_occluder_desc res = *desc;
+    res.vertex_stride = _socc_def(res.vertex_stride, 3 * (int)sizeof(float));
+    res.index_type = _socc_def(res.index_type, SG_INDEXTYPE_UINT16);
+    res.model = _socc_mat4_isnull(&res.model) ? _socc_mat4_identity() : res.model;
+    return res;
+}
+
+// >>triangle setup
+static void _socc_setup_triangle(const _socc_vec4_t* v0, const _socc_vec4_t* v1, const _socc_vec4_t* v2) {
+    if (_socc.num_tris >= _socc.desc.max_triangles) {
+        return;
+    }
+    const float w = (float)_socc.desc.width;
+    const float h = (float)_socc.desc.height;
+    const _socc_vec4_t* v[3] = { v0, v1, v2 };
+    _socc_tri_t* tri = &_socc.tris[_socc.num_tris];
+    for (int i = 0; i < 3; i++) {
+        // NOTE: the triangle has been clipped against the guard band, so the
+        // clamp only catches rounding errors and doesn't change its shape
+        const float inv_w = 1.0f / v[i]->w;
+        tri->x[i] = _socc_clampf((v[i]->x * inv_w * 0.5f + 0.5f) * w, -w, 2.0f * w);
+        tri->y[i] = _socc_clampf((0.5f - v[i]->y * inv_w * 0.5f) * h, -h, 2.0f * h);
+        tri->z[i] = v[i]->z * inv_w;
+    }
+    // reject degenerate triangles and triangles outside the screen
+    const float area = (tri->x[1] - tri->x[0]) * (tri->y[2] - tri->y[0]) - (tri->y[1] - tri->y[0]) * (tri->x[2] - tri->x[0]);
+    if ((area > -1.0e-6f) && (area < 1.0e-6f)) {
+        return;
+    }
+    const float min_x = _socc_minf(tri->x[0], _socc_minf(tri->x[1], tri->x[2]));
+    const float max_x = _socc_maxf(tri->x[0], _socc_maxf(tri->x[1], tri->x[2]));
+    const float min_y = _socc_minf(tri->y[0], _socc_minf(tri->y[1], tri->y[2]));
+    const float max_y = _socc_maxf(tri->y[0], _socc_maxf(tri->y[1], tri->y[2]));
+    if ((max_x < 0.0f) || (min_x >= w) || (max_y < 0.0f) || (min_y >= h)) {
+        return;
+    }
+    // triangles are rendered double-sided, make the winding order consistent
+    if (area < 0.0f) {
+        float t;
+        t = tri->x[1]; tri->x[1] = tri->x[2]; tri->x[2] = t;
+        t = tri->y[1]; tri->y[1] = tri->y[2]; tri->y[2] = t;
+        t = tri->z[1]; tri->z[1] = tri->z[2]; tri->z[2] = t;
+    }
+    tri->min_y = (int)_socc_maxf(floorf(min_y), 0.0f);
+    tri->max_y = (int)_socc_minf(ceilf(max_y), h - 1.0f);
+    _socc.num_tris += 1;
+}
+
+// signed distance of a clip-space vertex to a clip plane, >= 0 is inside
+static float _socc_clip_dist(const _socc_vec4_t* v, int plane) {
+    switch (plane) {
+        case 0:  return v->w - _SOCC_MIN_W;
+        case 1:  return _SOCC_GUARD_BAND * v->w + v->x;
+        case 2:  return _SOCC_GUARD_BAND * v->w - v->x;
+        case 3:  return _SOCC_GUARD_BAND * v->w + v->y;
+        default: return _SOCC_GUARD_BAND * v->w - v->y;
+    }
+}
+
+// clip a clip-space triangle against the near plane and the guard band
+// (instead of clamping vertices, which would change the triangle's shape
+// and might cover pixels which the original triangle doesn't cover)
+static void _socc_clip_triangle(const _socc_vec4_t* v0, const _socc_vec4_t* v1, const _socc_vec4_t* v2) {
+    // quick check for the common case of a triangle which doesn't need clipping
+    const _socc_vec4_t* in[3] = { v0, v1, v2 };
+    uint32_t outside_mask = 0;
+    for (int i = 0; i < 3; i++) {
+        for (int plane = 0; plane < 5; plane++) {
+            if (_socc_clip_dist(in[i], plane) < 0.0f) {
+                outside_mask |= 1u << plane;
+            }
+        }
+    }
+    if (0 == outside_mask) {
+        _socc_setup_triangle(v0, v1, v2);
+        return;
+    }
+    // Sutherland-Hodgman clipping against the planes which are crossed
+    _socc_vec4_t poly[2][_SOCC_MAX_CLIP_VERTICES];
+    int num = 3;
+    poly[0][0] = *v0; poly[0][1] = *v1; poly[0][2] = *v2;
+    int cur = 0;
+    for (int plane = 0; plane < 5; plane++) {
+        if (0 == (outside_mask & (1u << plane))) {
+            continue;
+        }
+        const _socc_vec4_t* src = poly[cur];
+        _socc_vec4_t* dst = poly[cur ^ 1];
+        int num_out = 0;
+        for (int i = 0; i < num; i++) {
+            const _socc_vec4_t* a = &src[i];
+            const _socc_vec4_t* b = &src[(i + 1) % num];
+            const float da = _socc_clip_dist(a, plane);
+            const float db = _socc_clip_dist(b, plane);
+            if (da >= 0.0f) {
+                dst[num_out++] = *a;
+            }
+            if ((da >= 0.0f) != (db >= 0.0f)) {
+                dst[num_out++] = _socc_lerp(*a, *b, da / (da - db));
+            }
+        }
+        SOKOL_ASSERT(num_out <= _SOCC_MAX_CLIP_VERTICES);
+        num = num_out;
+        cur ^= 1;
+        if (num < 3) {
+            return;
+        }
+    }
+    for (int i = 1; (i + 1) < num; i++) {
+        _socc_setup_triangle(&poly[cur][0], &poly[cur][i], &poly[cur][i + 1]);
+    }
+}
+
+// >>rasterizer
+static void _socc_rasterize_triangle(const _socc_tri_t* tri, int band_y0, int band_y1) {
+    const int width = _socc.desc.width;
+    const int y0 = (tri->min_y > band_y0) ? tri->min_y : band_y0;
+    const int y1 = (tri->max_y < (band_y1 - 1)) ? tri->max_y : (band_y1 - 1);
+    if (y0 > y1) {
+        return;
+    }
+    const float min_x = _socc_minf(tri->x[0], _socc_minf(tri->x[1], tri->x[2]));
+    const float max_x = _socc_maxf(tri->x[0], _socc_maxf(tri->x[1], tri->x[2]));
+    const int x0 = (int)_socc_maxf(floorf(min_x), 0.0f);
+    const int x1 = (int)_socc_minf(ceilf(max_x), (float)(width - 1));
+    if (x0 > x1) {
+        return;
+    }
+    // edge functions: e_i(x,y) = a_i * x + b_i * y + c_i, positive inside
+    float a[3], b[3], c[3];
+    for (int i = 0; i < 3; i++) {
+        const int j = (i + 1) % 3;
+        a[i] = tri->y[i] - tri->y[j];
+        b[i] = tri->x[j] - tri->x[i];
+        c[i] = tri->x[i] * tri->y[j] - tri->x[j] * tri->y[i];
+    }
+    // e_0 is opposite to vertex 2, e_1 to vertex 0, e_2 to vertex 1
+    const float area = c[0] + c[1] + c[2];
+    SOKOL_ASSERT(area > 0.0f);
+    const float inv_area = 1.0f / area;
+    // depth as plane equation z(x,y) = za * x + zb * y + zc
+    const float za = (a[1] * tri->z[0] + a[2] * tri->z[1] + a[0] * tri->z[2]) * inv_area;
+    const float zb = (b[1] * tri->z[0] + b[2] * tri->z[1] + b[0] * tri->z[2]) * inv_area;
+    const float zc = (c[1] * tri->z[0] + c[2] * tri->z[1] + c[0] * tri->z[2]) * inv_area;
+    for (int y = y0; y <= y1; y++) {
+        const float py = (float)y + 0.5f;
+        const float px = (float)x0 + 0.5f;
+        float e0 = a[0] * px + b[0] * py + c[0];
+        float e1 = a[1] * px + b[1] * py + c[1];
+        float e2 = a[2] * px + b[2] * py + c[2];
+        float z = za * px + zb * py + zc;
+        float* dst = _socc.depth + y * width;
+        for (int x = x0; x <= x1; x++) {
+            if ((e0 >= 0.0f) && (e1 >= 0.0f) && (e2 >= 0.0f)) {
+                if (z < dst[x]) {
+                    dst[x] = z;
+                }
+            }
+            e0 += a[0];
+            e1 += a[1];
+            e2 += a[2];
+            z += za;
+        }
+    }
+}
+
+// update the farthest depth of all tiles in a band
+static void _socc_update_tiles(int band_y0, int band_y1) {
+    const int width = _socc.desc.width;
+    for (int ty = band_y0 / _SOCC_TILE_SIZE; ty < (band_y1 / _SOCC_TILE_SIZE); ty++) {
+        for (int tx = 0; tx < _socc.num_tiles_x; tx++) {
+            float max_z = 0.0f;
+            bool first = true;
+            for (int y = ty * _SOCC_TILE_SIZE; y < (ty + 1) * _SOCC_TILE_SIZE; y++) {
+                const float* src = _socc.depth + y * width + tx * _SOCC_TILE_SIZE;
+                for (int x = 0; x < _SOCC_TILE_SIZE; x++) {
+                    if (first || (src[x] > max_z)) {
+                        max_z = src[x];
+                        first = false;
+                    }
+                }
+            }
+            _socc.tile_depth[ty * _socc.num_tiles_x + tx] = max_z;
+        }
+    }
+}
+
+static void _socc_update_debug_image(void) {
+    sg_image_data data;
+    _socc_clear(&data, sizeof(data));
+    data.mip_levels[0].ptr = _socc.depth;
+    data.mip_levels[0].size = (size_t)(_socc.desc.width * _socc.desc.height) * sizeof(float);
+    sg_update_image(_socc.dbg_img, &data);
+}
+
+// >>public
+SOKOL_API_IMPL void socc_setup(const socc_desc* desc) {
+    SOKOL_ASSERT(desc);
+    SOKOL_ASSERT(0 == _socc.init_tag);
+    _socc_clear(&_socc, sizeof(_socc));
+    _socc.init_tag = _SOCC_INIT_TAG;
+    _socc.desc = _socc_desc_defaults(desc);
+    SOKOL_ASSERT((_socc.desc.width > 0) && ((_socc.desc.width % _SOCC_TILE_SIZE) == 0));
+    SOKOL_ASSERT((_socc.desc.height > 0) && ((_socc.desc.height % _SOCC_TILE_SIZE) == 0));
+    SOKOL_ASSERT(_socc.desc.max_triangles > 0);
+    _socc.num_tiles_x = _socc.desc.width / _SOCC_TILE_SIZE;
+    _socc.num_tiles_y = _socc.desc.height / _SOCC_TILE_SIZE;
+    _socc.num_bands = (_socc.desc.height + _SOCC_BAND_HEIGHT - 1) / _SOCC_BAND_HEIGHT;
+    _socc.depth = (float*) _socc_malloc(sizeof(float) * (size_t)(_socc.desc.width * _socc.desc.height));
+    _socc.tile_depth = (float*) _socc_malloc(sizeof(float) * (size_t)(_socc.num_tiles_x * _socc.num_tiles_y));
+    _socc.band_done = (bool*) _socc_malloc_clear(sizeof(bool) * (size_t)_socc.num_bands);
+    _socc.tris = (_socc_tri_t*) _socc_malloc(sizeof(_socc_tri_t) * (size_t)_socc.desc.max_triangles);
+    for (int i = 0; i < (_socc.desc.width * _socc.desc.height); i++) {
+        _socc.depth[i] = _SOCC_MAX_DEPTH;
+    }
+    for (int i = 0; i < (_socc.num_tiles_x * _socc.num_tiles_y); i++) {
+        _socc.tile_depth[i] = _SOCC_MAX_DEPTH;
+    }
+    if (_socc.desc.debug_image) {
+        sg_image_desc img_desc;
+        _socc_clear(&img_desc, sizeof(img_desc));
+        img_desc.usage.stream_update = true;
+        img_desc.width = _socc.desc.width;
+        img_desc.height = _socc.desc.height;
+        img_desc.pixel_format = SG_PIXELFORMAT_R32F;
+        img_desc.label = "socc-debug-image";
+        _socc.dbg_img = sg_make_image(&img_desc);
+        if (sg_query_image_state(_socc.dbg_img) == SG_RESOURCESTATE_VALID) {
+            sg_view_desc view_desc;
+            _socc_clear(&view_desc, sizeof(view_desc));
+            view_desc.texture.image = _socc.dbg_img;
+            view_desc.label = "socc-debug-view";
+            _socc.dbg_view = sg_make_view(&view_desc);
+        } else {
+            _SOCC_ERROR(MAKE_DEBUG_IMAGE_FAILED);
+        }
+    }
+}
+
+SOKOL_API_IMPL void socc_shutdown(void) {
+    SOKOL_ASSERT(_SOCC_INIT_TAG == _socc.init_tag);
+    if (_socc.desc.debug_image) {
+        sg_destroy_view(_socc.dbg_view);
+        sg_destroy_image(_socc.dbg_img);
+    }
+    _socc_free(_socc.tris);
+    _socc_free(_socc.band_done);
+    _socc_free(_socc.tile_depth);
+    _socc_free(_socc.depth);
+    _socc.init_tag = 0;
+}
+
+SOKOL_API_IMPL void socc_begin(const socc_begin_desc* desc) {
+    SOKOL_ASSERT(_SOCC_INIT_TAG == _socc.init_tag);
+    SOKOL_ASSERT(desc);
+    _socc.in_frame = true;
+    _socc.finished = false;
+    _socc.view_proj = desc->view_proj;
+    _socc.num_tris = 0;
+    _socc_clear(&_socc.stats, sizeof(_socc.stats));
+    _socc_clear(_socc.band_done, sizeof(bool) * (size_t)_socc.num_bands);
+}
+
+SOKOL_API_IMPL void socc_add_occluder(const socc_occluder_desc* desc) {
+    SOKOL_ASSERT(_SOCC_INIT_TAG == _socc.init_tag);
+    SOKOL_ASSERT(desc);
+    if (!_socc.in_frame) {
+        _SOCC_ERROR(ADD_OCCLUDER_OUTSIDE_BEGIN_END);
+        return;
+    }
+    const socc_occluder_desc desc_def = _socc_occluder_desc_defaults(desc);
+    SOKOL_ASSERT(desc_def.vertex_stride >= (int)(3 * sizeof(float)));
+    const size_t stride = (size_t)desc_def.vertex_stride;
+    if ((0 == desc_def.vertices.ptr) || (0 == desc_def.vertices.size) || ((desc_def.vertices.size % stride) != 0)) {
+        _SOCC_ERROR(ADD_OCCLUDER_INVALID_VERTICES);
+        return;
+    }
+    const size_t index_size = (desc_def.index_type == SG_INDEXTYPE_UINT32) ? 4 : 2;
+    const bool indexed = 0 != desc_def.indices.ptr;
+    if (indexed && ((desc_def.indices.size % index_size) != 0)) {
+        _SOCC_ERROR(ADD_OCCLUDER_INVALID_INDICES);
+        return;
+    }
+    const uint32_t num_vertices = (uint32_t)(desc_def.vertices.size / stride);
+    const uint32_t num_indices = indexed ? (uint32_t)(desc_def.indices.size / index_size) : num_vertices;
+    _socc.stats.num_occluders += 1;
+    const socc_mat4_t mvp = _socc_mat4_mul(&_socc.view_proj, &desc_def.model);
+    const uint8_t* vertices = (const uint8_t*)desc_def.vertices.ptr;
+    for (uint32_t i = 0; (i + 2) < num_indices; i += 3) {
+        _socc_vec4_t clip[3];
+        for (uint32_t k = 0; k < 3; k++) {
+            uint32_t vi = i + k;
+            if (indexed) {
+                if (index_size == 2) {
+                    vi = ((const uint16_t*)desc_def.indices.ptr)[vi];
+                } else {
+                    vi = ((const uint32_t*)desc_def.indices.ptr)[vi];
+                }
+                if (vi >= num_vertices) {
+                    _SOCC_ERROR(ADD_OCCLUDER_INDEX_OUT_OF_RANGE);
+                    return;
+                }
+            }
+            float pos[3];
+            memcpy(pos, vertices + vi * stride, sizeof(pos));
+            clip[k] = _socc_transform(&mvp, pos[0], pos[1], pos[2]);
+        }
+        // trivially reject triangles entirely outside one of the frustum side planes
+        if (((clip[0].x < -clip[0].w) && (clip[1].x < -clip[1].w) && (clip[2].x < -clip[2].w)) ||
+            ((clip[0].x >  clip[0].w) && (clip[1].x >  clip[1].w) && (clip[2].x >  clip[2].w)) ||
+            ((clip[0].y < -clip[0].w) && (clip[1].y < -clip[1].w) && (clip[2].y < -clip[2].w)) ||
+            ((clip[0].y >  clip[0].w) && (clip[1].y >  clip[1].w) && (clip[2].y >  clip[2].w)))
+        {
+            continue;
+        }
+        if (_socc.num_tris >= _socc.desc.max_triangles) {
+            _SOCC_WARN(TRIANGLE_BUFFER_FULL);
+            return;
+        }
+        _socc_clip_triangle(&clip[0], &clip[1], &clip[2]);
+    }
+}
+
+SOKOL_API_IMPL int socc_num_bands(void) {
+    SOKOL_ASSERT(_SOCC_INIT_TAG == _socc.init_tag);
+    return _socc.num_bands;
+}
+
+SOKOL_API_IMPL void socc_rasterize_band(int band_index) {
+    SOKOL_ASSERT(_SOCC_INIT_TAG == _socc.init_tag);
+    SOKOL_ASSERT((band_index >= 0) && (band_index < _socc.num_bands));
+    SOKOL_ASSERT(_socc.in_frame);
+    if (_socc.band_done[band_index]) {
+        return;
+    }
+    const int y0 = band_index * _SOCC_BAND_HEIGHT;
+    const int y1 = (y0 + _SOCC_BAND_HEIGHT < _socc.desc.height) ? (y0 + _SOCC_BAND_HEIGHT) : _socc.desc.height;
+    const int width = _socc.desc.width;
+    for (int i = y0 * width; i < y1 * width; i++) {
+        _socc.depth[i] = _SOCC_MAX_DEPTH;
+    }
+    for (int i = 0; i < _socc.num_tris; i++) {
+        _socc_rasterize_triangle(&_socc.tris[i], y0, y1);
+    }
+    _socc_update_tiles(y0, y1);
+    _socc.band_done[band_index] = true;
+}
+
+SOKOL_API_IMPL void socc_end(void) {
+    SOKOL_ASSERT(_SOCC_INIT_TAG == _socc.init_tag);
+    SOKOL_ASSERT(_socc.in_frame);
+    for (int i = 0; i < _socc.num_bands; i++) {
+        socc_rasterize_band(i);
+    }
+    _socc.stats.num_triangles = _socc.num_tris;
+    _socc.in_frame = false;
+    _socc.finished = true;
+    if (_socc.desc.debug_image && (sg_query_image_state(_socc.dbg_img) == SG_RESOURCESTATE_VALID)) {
+        _socc_update_debug_image();
+    }
+}
+
+SOKOL_API_IMPL bool socc_test_box(const float box_min[3], const float box_max[3]) {
+    SOKOL_ASSERT(_SOCC_INIT_TAG == _socc.init_tag);
+    SOKOL_ASSERT(box_min && box_max);
+    if (!_socc.finished) {
+        _SOCC_ERROR(TEST_BOX_BEFORE_END);
+        return true;
+    }
+    _socc.stats.num_tests += 1;
+    // project the 8 box corners, boxes crossing the near plane can only be frustum-culled
+    float min_x = 0.0f, max_x = 0.0f, min_y = 0.0f, max_y = 0.0f, min_z = 0.0f;
+    bool crosses_near = false;
+    bool first = true;
+    bool outside[6] = { true, true, true, true, true, true };
+    for (int i = 0; i < 8; i++) {
+        const float x = (i & 1) ? box_max[0] : box_min[0];
+        const float y = (i & 2) ? box_max[1] : box_min[1];
+        const float z = (i & 4) ? box_max[2] : box_min[2];
+        const _socc_vec4_t c = _socc_transform(&_socc.view_proj, x, y, z);
+        outside[0] &= c.x < -c.w;
+        outside[1] &= c.x > c.w;
+        outside[2] &= c.y < -c.w;
+        outside[3] &= c.y > c.w;
+        outside[4] &= c.w < _SOCC_MIN_W;
+        outside[5] &= c.z > c.w;
+        if (c.w < _SOCC_MIN_W) {
+            crosses_near = true;
+            continue;
+        }
+        const float inv_w = 1.0f / c.w;
+        const float nx = c.x * inv_w;
+        const float ny = c.y * inv_w;
+        const float nz = c.z * inv_w;
+        if (first) {
+            min_x = max_x = nx;
+            min_y = max_y = ny;
+            min_z = nz;
+            first = false;
+        } else {
+            min_x = _socc_minf(min_x, nx);
+            max_x = _socc_maxf(max_x, nx);
+            min_y = _socc_minf(min_y, ny);
+            max_y = _socc_maxf(max_y, ny);
+            min_z = _socc_minf(min_z, nz);
+        }
+    }
+    for (int i = 0; i < 6; i++) {
+        if (outside[i]) {
+            _socc.stats.num_frustum_culled += 1;
+            return false;
+        }
+    }
+    if (crosses_near) {
+        return true;
+    }
+    // screen-space rectangle covered by the box
+    const int width = _socc.desc.width;
+    const int height = _socc.desc.height;
+    const int x0 = (int)_socc_clampf(floorf((min_x * 0.5f + 0.5f) * (float)width), 0.0f, (float)(width - 1));
+    const int x1 = (int)_socc_clampf(ceilf((max_x * 0.5f + 0.5f) * (float)width), 0.0f, (float)width) - 1;
+    const int y0 = (int)_socc_clampf(floorf((0.5f - max_y * 0.5f) * (float)height), 0.0f, (float)(height - 1));
+    const int y1 = (int)_socc_clampf(ceilf((0.5f - min_y * 0.5f) * (float)height), 0.0f, (float)height) - 1;
+    if ((x1 < x0) || (y1 < y0)) {
+        return true;
+    }
+    // the box is hidden if all covered pixels have a nearer occluder,
+    // first check the per-tile farthest depth and only look at pixels
+    // in tiles which are not entirely in front of the box
+    for (int ty = y0 / _SOCC_TILE_SIZE; ty <= y1 / _SOCC_TILE_SIZE; ty++) {
+        for (int tx = x0 / _SOCC_TILE_SIZE; tx <= x1 / _SOCC_TILE_SIZE; tx++) {
+            if (_socc.tile_depth[ty * _socc.num_tiles_x + tx] < min_z) {
+                continue;
+            }
+            const int px0 = (tx * _SOCC_TILE_SIZE > x0) ? tx * _SOCC_TILE_SIZE : x0;
+            const int px1 = ((tx + 1) * _SOCC_TILE_SIZE - 1 < x1) ? (tx + 1) * _SOCC_TILE_SIZE - 1 : x1;
+            const int py0 = (ty * _SOCC_TILE_SIZE > y0) ? ty * _SOCC_TILE_SIZE : y0;
+            const int py1 = ((ty + 1) * _SOCC_TILE_SIZE - 1 < y1) ? (ty + 1) * _SOCC_TILE_SIZE - 1 : y1;
+            for (int y = py0; y <= py1; y++) {
+                const float* src = _socc.depth + y * width;
+                for (int x = px0; x <= px1; x++) {
+                    if (src[x] >= min_z) {
+                        return true;
+                    }
+                }
+            }
+        }
+    }
+    _socc.stats.num_occlusion_culled += 1;
+    return false;
+}
+
+SOKOL_API_IMPL float socc_query_depth(int x, int y) {
+    SOKOL_ASSERT(_SOCC_INIT_TAG == _socc.init_tag);
+    if ((x < 0) || (x >= _socc.desc.width) || (y < 0) || (y >= _socc.desc.height)) {
+        return _SOCC_MAX_DEPTH;
+    }
+    return _socc.depth[y * _socc.desc.width + x];
+}
+
+SOKOL_API_IMPL socc_stats socc_query_stats(void) {
+    SOKOL_ASSERT(_SOCC_INIT_TAG == _socc.init_tag);
+    return _socc.stats;
+}
+
+SOKOL_API_IMPL sg_image socc_query_debug_image(void) {
+    SOKOL_ASSERT(_SOCC_INIT_TAG == _socc.init_tag);
+    return _socc.dbg_img;
+}
+
+SOKOL_API_IMPL sg_view socc_query_debug_view(void) {
+    SOKOL_ASSERT(_SOCC_INIT_TAG == _socc.init_tag);
+    return _socc.dbg_view;
+}
+
+SOKOL_API_IMPL socc_mat4_t socc_mat4(const float m[16]) {
+    socc_mat4_t res;
+    memcpy(&res.m[0][0], &m[0], 64);
+    return res;
+}
+
+SOKOL_API_IMPL socc_mat4_t socc_mat4_transpose(const float m[16]) {
+    socc_mat4_t res;
+    for (int c = 0; c < 4; c++) {
+        for (int r = 0; r < 4; r++) {
+            res.m[r][c] = m[c*4 + r];
+        }
+    }
+    return res;
+}
+
+#endif // SOKOL_OCCLUSION_IMPL
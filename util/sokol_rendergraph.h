@@ -0,0 +1,1108 @@
+#if defined(SOKOL_IMPL) && !defined(SOKOL_RENDERGRAPH_IMPL)
+#define SOKOL_RENDERGRAPH_IMPL
+#endif
+#ifndef SOKOL_RENDERGRAPH_INCLUDED
+/*
+    sokol_rendergraph.h -- a simple render graph on top of sokol_gfx.h
+
+    Project URL: https://github.com/floooh/sokol
+
+    Do this:
+        #define SOKOL_IMPL or
+        #define SOKOL_RENDERGRAPH_IMPL
+    before you include this file in *one* C or C++ file to create the
+    implementation.
+
+    Optionally provide the following defines with your own implementations:
+
+    SOKOL_ASSERT(c)     - your own assert macro (default: assert(c))
+    SOKOL_RENDERGRAPH_API_DECL - public function declaration prefix (default: extern)
+    SOKOL_API_DECL      - same as SOKOL_RENDERGRAPH_API_DECL
+    SOKOL_API_IMPL      - public function implementation prefix (default: -)
+
+    If sokol_rendergraph.h is compiled as a DLL, define the following before
+    including the declaration or implementation:
+
+    SOKOL_DLL
+
+    Include the following headers before including sokol_rendergraph.h:
+
+        sokol_gfx.h
+
+    WHAT
+    ====
+    sokol_rendergraph.h sits on top of sg_begin_pass() / sg_end_pass() and
+    manages the render-target images of a chain of offscreen render passes
+    (for instance a post-processing chain).
+
+    Instead of creating render-target images upfront and keeping them alive
+    forever, each frame you declare a number of *virtual attachments*
+    and a number of passes which write to and read from those attachments.
+    When the graph is executed, sokol_rendergraph.h will:
+
+    - cull all passes which don't contribute to a 'root pass' (a pass
+      which renders to the swapchain, or which has been explicitly marked
+      as 'keep')
+    - compute the lifetime of each virtual attachment in the remaining passes
+    - assign a physical sokol-gfx image (plus attachment- and texture-views)
+      to each virtual attachment, and have virtual attachments with
+      non-overlapping lifetimes and compatible properties (size, pixel format
+      and sample count) share the same physical image
+    - run the remaining passes in declaration order, each wrapped in
+      sg_begin_pass() / sg_end_pass()
+
+    Physical images are cached across frames and are only destroyed when they
+    haven't been used for a number of frames (for instance after a window
+    resize), so in the common case no sokol-gfx resources are created or
+    destroyed per frame.
+
+    Since sokol-gfx has no concept of explicit memory heaps, 'aliasing' means
+    that several virtual attachments share the same sg_image object. For a
+    post-processing chain where each pass reads the previous pass' result
+    this typically means that only two full-size images are needed instead
+    of one per pass.
+
+    HOW
+    ===
+    First initialize sokol_rendergraph.h after sokol_gfx.h:
+
+        srg_setup(&(srg_desc){
+            .logger.func = slog_func,
+        });
+
+    The default limits are 64 passes and 64 virtual attachments per frame,
+    and 64 cached physical images. Those can be tweaked in srg_desc:
+
+        srg_setup(&(srg_desc){
+            .max_passes = 128,
+            .max_attachments = 128,
+            .max_images = 32,
+            .max_idle_frames = 4,   // destroy cached images after 4 unused frames (default: 8)
+            .logger.func = slog_func,
+        });
+
+    Each frame, start a new graph with the 'frame size', this is the default
+    size for all virtual attachments:
+
+        srg_begin(sapp_width(), sapp_height());
+
+    Next declare the virtual attachments. By default an attachment has the
+    frame size and the default color pixel format and sample count
+    from sg_desc.environment:
+
+        srg_attachment scene_color = srg_create_attachment(&(srg_attachment_desc){
+            .label = "scene-color",
+        });
+        srg_attachment scene_depth = srg_create_attachment(&(srg_attachment_desc){
+            .pixel_format = SG_PIXELFORMAT_DEPTH,
+            .label = "scene-depth",
+        });
+
+    ...or with explicit size or a size relative to the frame size:
+
+        srg_attachment half_res = srg_create_attachment(&(srg_attachment_desc){
+            .scale = 0.5f,
+            .pixel_format = SG_PIXELFORMAT_RGBA16F,
+        });
+
+    Next declare the passes. Each pass describes the virtual attachments it
+    renders to (colors, resolves and depth_stencil) and the attachments it
+    will read from as textures (reads), plus a callback function which is
+    called between sg_begin_pass() and sg_end_pass():
+
+        srg_add_pass(&(srg_pass_desc){
+            .label = "scene",
+            .action = { ... },
+            .colors[0] = scene_color,
+            .depth_stencil = scene_depth,
+            .func = draw_scene,
+        });
+        srg_add_pass(&(srg_pass_desc){
+            .label = "bloom-downsample",
+            .colors[0] = half_res,
+            .reads[0] = scene_color,
+            .func = bloom_downsample,
+        });
+        srg_add_pass(&(srg_pass_desc){
+            .label = "display",
+            .swapchain = sglue_swapchain(),
+            .to_swapchain = true,
+            .reads = { scene_color, half_res },
+            .func = draw_display,
+        });
+
+    A pass which doesn't render to the swapchain is culled unless its output
+    is read by another (non-culled) pass. To prevent a pass from being culled
+    (for instance because its result is read back to the CPU), set the 'keep'
+    flag:
+
+        srg_add_pass(&(srg_pass_desc){
+            .keep = true,
+            ...
+        });
+
+    Finally execute the graph (outside of any sokol-gfx pass):
+
+        srg_execute();
+
+    Inside the pass callbacks, get the sokol-gfx image or texture view
+    object for a virtual attachment to bind it as texture:
+
+        static void draw_display(void* user_data) {
+            sg_apply_pipeline(...);
+            sg_apply_bindings(&(sg_bindings){
+                .views[0] = srg_texture_view(scene_color),
+                .samplers[0] = smp,
+            });
+            sg_draw(0, 3, 1);
+        }
+
+    Attachment handles are only valid between srg_begin() and the next
+    srg_begin(), the functions srg_image() and srg_texture_view() return
+    valid handles only from srg_execute() until the next srg_begin() and
+    only for attachments which are used by a non-culled pass.
+
+    Some important points to consider:
+
+    - passes run in the order they have been declared in, and a pass
+      depends on the most recent previous pass which writes an attachment
+      it reads (or which writes an attachment it renders to with
+      SG_LOADACTION_LOAD)
+    - since physical images are shared, the first pass writing a virtual
+      attachment must not use SG_LOADACTION_LOAD on it, the initial content
+      of a virtual attachment is undefined
+    - likewise the content of a physical image is undefined after the last
+      pass which uses a virtual attachment, so don't access the image
+      returned by srg_image() after srg_execute()
+    - a pass must not read and write the same attachment
+    - texture views are only available for multisampled attachments when
+      sg_features.msaa_texture_bindings is true, to sample the content of
+      a multisampled attachment, resolve it into a non-multisampled attachment
+      via srg_pass_desc.resolves[]
+    - compute passes are not supported
+
+    To get statistics about the last executed graph:
+
+        srg_stats stats = srg_query_stats();
+
+    At the end of the program call:
+
+        srg_shutdown();
+
+    ...this will destroy all cached sokol-gfx resources. Call srg_shutdown()
+    before sg_shutdown().
+
+
+    LICENSE
+    =======
+
+    zlib/libpng license
+
+    Copyright (c) 2026 Andre Weissflog
+
+    This software is provided 'as-is', without any express or implied warranty.
+    In no event will the authors be held liable for any damages arising from the
+    use of this software.
+
+    Permission is granted to anyone to use this software for any purpose,
+    including commercial applications, and to alter it and redistribute it
+    freely, subject to the following restrictions:
+
+        1. The origin of this software must not be misrepresented; you must not
+        claim that you wrote the original software. If you use this software in a
+        product, an acknowledgment in the product documentation would be
+        appreciated but is not required.
+
+        2. Altered source versions must be plainly marked as such, and must not
+        be misrepresented as being the original software.
+
+        3. This notice may not be removed or altered from any source
+        distribution.
+*/
+#define SOKOL_RENDERGRAPH_INCLUDED (1)
+#include <stddef.h>
+#include <stdint.h>
+#include <stdbool.h>
+
+#if !defined(SOKOL_GFX_INCLUDED)
+#error "Please include sokol_gfx.h before sokol_rendergraph.h"
+#endif
+
+#if defined(SOKOL_API_DECL) && !defined(SOKOL_RENDERGRAPH_API_DECL)
+#define SOKOL_RENDERGRAPH_API_DECL SOKOL_API_DECL
+#endif
+#ifndef SOKOL_RENDERGRAPH_API_DECL
+#if defined(_WIN32) && defined(SOKOL_DLL) && defined(SOKOL_RENDERGRAPH_IMPL)
+#define SOKOL_RENDERGRAPH_API_DECL __declspec(dllexport)
+#elif defined(_WIN32) && defined(SOKOL_DLL)
+#define SOKOL_RENDERGRAPH_API_DECL __declspec(dllimport)
+#else
+#define SOKOL_RENDERGRAPH_API_DECL extern
+#endif
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+    Public constants.
+*/
+enum {
+    // the value of an invalid attachment handle
+    SRG_INVALID_ID = 0,
+    // max number of attachments a pass can read from
+    SRG_MAX_PASS_READS = 8,
+};
+
+/*
+    srg_attachment
+
+    A virtual attachment handle, created with srg_create_attachment().
+    Attachment handles are only valid until the next call to srg_begin().
+*/
+typedef struct srg_attachment { uint32_t id; } srg_attachment;
+
+/*
+    srg_log_item
+
+    Log items are defined via X-Macros and expanded to an enum
+    'srg_log_item', and in debug mode to corresponding
+    human readable error messages.
+*/
+#define _SRG_LOG_ITEMS \
+    _SRG_LOGITEM_XMACRO(OK, "Ok") \
+    _SRG_LOGITEM_XMACRO(MALLOC_FAILED, "memory allocation failed") \
+    _SRG_LOGITEM_XMACRO(BEGIN_NOT_CALLED, "srg_begin() must be called first") \
+    _SRG_LOGITEM_XMACRO(EXECUTE_NOT_CALLED, "srg_begin() called without srg_execute() for the previous graph") \
+    _SRG_LOGITEM_XMACRO(ATTACHMENT_POOL_EXHAUSTED, "too many attachments in graph (srg_desc.max_attachments)") \
+    _SRG_LOGITEM_XMACRO(ATTACHMENT_INVALID_SIZE, "srg_attachment_desc: resulting attachment width and height must be > 0") \
+    _SRG_LOGITEM_XMACRO(PASS_POOL_EXHAUSTED, "too many passes in graph (srg_desc.max_passes)") \
+    _SRG_LOGITEM_XMACRO(PASS_INVALID_ATTACHMENT, "srg_pass_desc: invalid or outdated attachment handle, pass dropped") \
+    _SRG_LOGITEM_XMACRO(PASS_NO_ATTACHMENTS, "srg_pass_desc: an offscreen pass must have at least one color or depth-stencil attachment, pass dropped") \
+    _SRG_LOGITEM_XMACRO(PASS_SWAPCHAIN_ATTACHMENTS, "srg_pass_desc: a swapchain pass must not have color, resolve or depth-stencil attachments, pass dropped") \
+    _SRG_LOGITEM_XMACRO(PASS_COLOR_IS_DEPTH, "srg_pass_desc: color or resolve attachment has a depth pixel format, pass dropped") \
+    _SRG_LOGITEM_XMACRO(PASS_DEPTH_IS_COLOR, "srg_pass_desc: depth-stencil attachment doesn't have a depth pixel format, pass dropped") \
+    _SRG_LOGITEM_XMACRO(PASS_RESOLVE_IS_MSAA, "srg_pass_desc: resolve attachment must have a sample count of 1, pass dropped") \
+    _SRG_LOGITEM_XMACRO(PASS_READ_WRITE_SAME_ATTACHMENT, "srg_pass_desc: a pass must not read and write the same attachment, pass dropped") \
+    _SRG_LOGITEM_XMACRO(PASS_READ_UNWRITTEN_ATTACHMENT, "srg_pass_desc: pass reads an attachment which hasn't been written by a previous pass") \
+    _SRG_LOGITEM_XMACRO(IMAGE_POOL_EXHAUSTED, "too many physical images (srg_desc.max_images), passes skipped") \
+
+#define _SRG_LOGITEM_XMACRO(item,msg) SRG_LOGITEM_##item,
+typedef enum srg_log_item {
+    _SRG_LOG_ITEMS
+} srg_log_item;
+#undef _SRG_LOGITEM_XMACRO
+
+/*
+    srg_attachment_desc
+
+    Describes a virtual attachment, passed into srg_create_attachment().
+    All items are optional.
+*/
+typedef struct srg_attachment_desc {
+    int width;                      // width in pixels, default: scale * frame width
+    int height;                     // height in pixels, default: scale * frame height
+    float scale;                    // size relative to the frame size, default: 1.0
+    sg_pixel_format pixel_format;   // default: sg_desc.environment.defaults.color_format
+    int sample_count;               // default: 1
+    const char* label;
+} srg_attachment_desc;
+
+/*
+    srg_pass_desc
+
+    Describes a pass, passed into srg_add_pass(). A pass either renders
+    into virtual attachments (colors, resolves, depth_stencil), or into
+    the swapchain (to_swapchain = true). The attachments in reads[]
+    are only used to compute pass dependencies, use srg_texture_view()
+    in the pass callback to get the texture views to bind.
+*/
+typedef struct srg_pass_desc {
+    sg_pass_action action;
+    srg_attachment colors[SG_MAX_COLOR_ATTACHMENTS];
+    srg_attachment resolves[SG_MAX_COLOR_ATTACHMENTS];
+    srg_attachment depth_stencil;
+    srg_attachment reads[SRG_MAX_PASS_READS];
+    bool to_swapchain;              // if true, render into 'swapchain', the pass is never culled
+    sg_swapchain swapchain;
+    bool keep;                      // if true, the pass is never culled
+    void (*func)(void* user_data);  // called between sg_begin_pass() and sg_end_pass()
+    void* user_data;
+    const char* label;
+} srg_pass_desc;
+
+/*
+    srg_stats
+
+    Statistics about the last graph executed with srg_execute(),
+    returned by srg_query_stats().
+*/
+typedef struct srg_stats {
+    int num_passes;                 // number of passes declared
+    int num_culled_passes;          // number of passes which have been culled
+    int num_attachments;            // number of virtual attachments declared
+    int num_used_attachments;       // number of virtual attachments used by non-culled passes
+    int num_images;                 // number of physical images used by the graph
+    int num_cached_images;          // number of physical images alive (including unused)
+} srg_stats;
+
+/*
+    srg_allocator
+
+    Used in srg_desc to provide custom memory-alloc and -free functions
+    to sokol_rendergraph.h. If memory management should be overridden, both
+    the alloc and free function must be provided (e.g. it's not valid to
+    override one function but not the other).
+*/
+typedef struct srg_allocator {
+    void* (*alloc_fn)(size_t size, void* user_data);
+    void (*free_fn)(void* ptr, void* user_data);
+    void* user_data;
+} srg_allocator;
+
+/*
+    srg_logger
+
+    Used in srg_desc to provide a custom logging and error reporting
+    callback to sokol_rendergraph.h.
+*/
+typedef struct srg_logger {
+    void (*func)(
+        const char* tag,                // always "srg"
+        uint32_t log_level,             // 0=panic, 1=error, 2=warning, 3=info
+        uint32_t log_item_id,           // SRG_LOGITEM_*
+        const char* message_or_null,    // a message string, may be nullptr in release mode
+        uint32_t line_nr,               // line number in sokol_rendergraph.h
+        const char* filename_or_null,   // source filename, may be nullptr in release mode
+        void* user_data);
+    void* user_data;
+} srg_logger;
+
+/*
+    Initialization parameters passed into srg_setup(). You should at least
+    provide a logging function, otherwise you won't see any error logging.
+*/
+typedef struct srg_desc {
+    int max_passes;                 // max number of passes per graph, default: 64
+    int max_attachments;            // max number of virtual attachments per graph, default: 64
+    int max_images;                 // max number of cached physical images, default: 64
+    int max_idle_frames;            // destroy cached images after this many unused frames, default: 8
+    srg_allocator allocator;
+    srg_logger logger;
+} srg_desc;
+
+// setup sokol-rendergraph (call after sg_setup())
+SOKOL_RENDERGRAPH_API_DECL void srg_setup(const srg_desc* desc);
+// shutdown sokol-rendergraph (call before sg_shutdown())
+SOKOL_RENDERGRAPH_API_DECL void srg_shutdown(void);
+
+// start a new graph with the default attachment size
+SOKOL_RENDERGRAPH_API_DECL void srg_begin(int width, int height);
+// declare a virtual attachment
+SOKOL_RENDERGRAPH_API_DECL srg_attachment srg_create_attachment(const srg_attachment_desc* desc);
+// declare a pass
+SOKOL_RENDERGRAPH_API_DECL void srg_add_pass(const srg_pass_desc* desc);
+// cull passes, assign physical images and run the remaining passes (must be called outside a sokol-gfx pass)
+SOKOL_RENDERGRAPH_API_DECL void srg_execute(void);
+
+// get the physical image of a virtual attachment (valid from srg_execute() until the next srg_begin())
+SOKOL_RENDERGRAPH_API_DECL sg_image srg_image(srg_attachment att);
+// get a texture view on the physical image of a virtual attachment (valid from srg_execute() until the next srg_begin())
+SOKOL_RENDERGRAPH_API_DECL sg_view srg_texture_view(srg_attachment att);
+// get statistics about the last executed graph
+SOKOL_RENDERGRAPH_API_DECL srg_stats srg_query_stats(void);
+
+#ifdef __cplusplus
+} // extern "C"
+inline void srg_setup(const srg_desc& desc) { return srg_setup(&desc); }
+inline srg_attachment srg_create_attachment(const srg_attachment_desc& desc) { return srg_create_attachment(&desc); }
+inline void srg_add_pass(const srg_pass_desc& desc) { return srg_add_pass(&desc); }
+#endif
+#endif // SOKOL_RENDERGRAPH_INCLUDED
+
+/*=== IMPLEMENTATION =========================================================*/
+#ifdef SOKOL_RENDERGRAPH_IMPL
+#define SOKOL_RENDERGRAPH_IMPL_INCLUDED (1)
+
+#include <stdlib.h> // malloc, free, abort
+#include <string.h> // memset
+
+#ifndef SOKOL_API_IMPL
+    #define SOKOL_API_IMPL
+#endif
+#ifndef SOKOL_DEBUG
+    #ifndef NDEBUG
+        #define SOKOL_DEBUG
+    #endif
+#endif
+#ifndef SOKOL_ASSERT
+    #include <assert.h>
+    #define SOKOL_ASSERT(c) assert(c)
+#endif
+
+#define _srg_def(val, def) (((val) == 0) ? (def) : (val))
+#define _srg_def_flt(val, def) (((val) == 0.0f) ? (def) : (val))
+#define _SRG_INIT_TAG (0xABCDABCD)
+
+// >>structs
+enum {
+    _SRG_DEFAULT_MAX_PASSES = 64,
+    _SRG_DEFAULT_MAX_ATTACHMENTS = 64,
+    _SRG_DEFAULT_MAX_IMAGES = 64,
+    _SRG_DEFAULT_MAX_IDLE_FRAMES = 8,
+    _SRG_FRAME_SHIFT = 16,
+    _SRG_INDEX_MASK = (1<<_SRG_FRAME_SHIFT)-1,
+    _SRG_MAX_POOL_SIZE = (1<<_SRG_FRAME_SHIFT)-1,
+};
+
+// a physical image cached across frames
+typedef struct {
+    bool alive;
+    int width;
+    int height;
+    sg_pixel_format pixel_format;
+    int sample_count;
+    sg_image img;
+    sg_view att_view;       // color- or depth-stencil-attachment view
+    sg_view resolve_view;   // only for non-MSAA color images
+    sg_view tex_view;       // only if the image can be bound as texture
+    uint32_t last_used_frame;
+    int busy_until;         // index of last pass in current frame which uses the image, or -1
+} _srg_image_t;
+
+// a virtual attachment, only valid for one frame
+typedef struct {
+    int width;
+    int height;
+    sg_pixel_format pixel_format;
+    int sample_count;
+    bool is_depth;
+    int first_use;          // index of first pass in execution order which uses the attachment, or -1
+    int last_use;           // index of last pass in execution order which uses the attachment, or -1
+    int image_index;        // index of physical image, or -1
+} _srg_attachment_t;
+
+typedef struct {
+    srg_pass_desc desc;
+    bool needed;
+} _srg_pass_t;
+
+typedef struct {
+    uint32_t init_tag;
+    srg_desc desc;
+    bool in_graph;
+    bool executed;
+    uint32_t frame_id;
+    int width;
+    int height;
+    int num_passes;
+    int num_attachments;
+    _srg_pass_t* passes;
+    _srg_attachment_t* attachments;
+    _srg_image_t* images;
+    int* exec_order;        // indices of non-culled passes in execution order
+    int num_exec;
+    srg_stats stats;
+} _srg_state_t;
+static _srg_state_t _srg;
+
+// >>logging
+#if defined(SOKOL_DEBUG)
+#define _SRG_LOGITEM_XMACRO(item,msg) #item ": " msg,
+static const char* _srg_log_messages[] = {
+    _SRG_LOG_ITEMS
+};
+#undef _SRG_LOGITEM_XMACRO
+#endif // SOKOL_DEBUG
+
+#define _SRG_PANIC(code) _srg_log(SRG_LOGITEM_ ##code, 0, __LINE__)
+#define _SRG_ERROR(code) _srg_log(SRG_LOGITEM_ ##code, 1, __LINE__)
+#define _SRG_WARN(code) _srg_log(SRG_LOGITEM_ ##code, 2, __LINE__)
+#define _SRG_INFO(code) _srg_log(SRG_LOGITEM_ ##code, 3, __LINE__)
+
+static void _srg_log(srg_log_item log_item, uint32_t log_level, uint32_t line_nr) {
+    if (_srg.desc.logger.func) {
+        const char* filename = 0;
+        const char* msg = 0;
+        #if defined(SOKOL_DEBUG)
+            filename = __FILE__;
+            msg = _srg_log_messages[log_item];
+        #endif
+        _srg.desc.logger.func("srg", log_level, (uint32_t)log_item, msg, line_nr, filename, _srg.desc.logger.user_data);
+    } else {
+        // for log level PANIC it would be 'undefined behaviour' to continue
+        if (log_level == 0) {
+            abort();
+        }
+    }
+}
+
+// >>memory
+static void _srg_clear(void* ptr, size_t size) {
+    SOKOL_ASSERT(ptr && (size > 0));
+    memset(ptr, 0, size);
+}
+
+static void* _srg_malloc(size_t size) {
+    SOKOL_ASSERT(size > 0);
+    void* ptr;
+    if (_srg.desc.allocator.alloc_fn) {
+        ptr = _srg.desc.allocator.alloc_fn(size, _srg.desc.allocator.user_data);
+    } else {
+        ptr = malloc(size);
+    }
+    if (0 == ptr) {
+        _SRG_PANIC(MALLOC_FAILED);
+    }
+    return ptr;
+}
+
+static void* _srg_malloc_clear(size_t size) {
+    void* ptr = _srg_malloc(size);
+    _srg_clear(ptr, size);
+    return ptr;
+}
+
+static void _srg_free(void* ptr) {
+    if (_srg.desc.allocator.free_fn) {
+        _srg.desc.allocator.free_fn(ptr, _srg.desc.allocator.user_data);
+    } else {
+        free(ptr);
+    }
+}
+
+static srg_desc _srg_desc_defaults(const srg_desc* desc) {
+    SOKOL_ASSERT(desc);
+    srg_desc res = *desc;
+    res.max_passes = _srg_def(res.max_passes, _SRG_DEFAULT_MAX_PASSES);
+    res.max_attachments = _srg_def(res.max_attachments, _SRG_DEFAULT_MAX_ATTACHMENTS);
+    res.max_images = _srg_def(res.max_images, _SRG_DEFAULT_MAX_IMAGES);
+    res.max_idle_frames = _srg_def(res.max_idle_frames, _SRG_DEFAULT_MAX_IDLE_FRAMES);
+    return res;
+}
+
+// >>attachments
+static uint32_t _srg_make_id(int index) {
+    return ((_srg.frame_id & _SRG_INDEX_MASK) << _SRG_FRAME_SHIFT) | ((uint32_t)index + 1);
+}
+
+// returns attachment index, or -1 if the handle is invalid or outdated
+static int _srg_attachment_index(srg_attachment att) {
+    if (SRG_INVALID_ID == att.id) {
+        return -1;
+    }
+    if ((att.id >> _SRG_FRAME_SHIFT) != (_srg.frame_id & _SRG_INDEX_MASK)) {
+        return -1;
+    }
+    const int index = (int)(att.id & _SRG_INDEX_MASK) - 1;
+    if ((index < 0) || (index >= _srg.num_attachments)) {
+        return -1;
+    }
+    return index;
+}
+
+static bool _srg_is_depth_format(sg_pixel_format fmt) {
+    return (SG_PIXELFORMAT_DEPTH == fmt) || (SG_PIXELFORMAT_DEPTH_STENCIL == fmt);
+}
+
+// >>images
+static void _srg_destroy_image(_srg_image_t* img) {
+    SOKOL_ASSERT(img && img->alive);
+    // it's ok to call the destroy funcs with invalid ids
+    sg_destroy_view(img->tex_view);
+    sg_destroy_view(img->resolve_view);
+    sg_destroy_view(img->att_view);
+    sg_destroy_image(img->img);
+    _srg_clear(img, sizeof(_srg_image_t));
+}
+
+static void _srg_create_image(_srg_image_t* img, const _srg_attachment_t* att) {
+    SOKOL_ASSERT(img && !img->alive);
+    SOKOL_ASSERT(att);
+    img->alive = true;
+    img->width = att->width;
+    img->height = att->height;
+    img->pixel_format = att->pixel_format;
+    img->sample_count = att->sample_count;
+    img->busy_until = -1;
+
+    sg_image_desc img_desc;
+    _srg_clear(&img_desc, sizeof(img_desc));
+    img_desc.width = att->width;
+    img_desc.height = att->height;
+    img_desc.pixel_format = att->pixel_format;
+    img_desc.sample_count = att->sample_count;
+    if (att->is_depth) {
+        img_desc.usage.depth_stencil_attachment = true;
+    } else {
+        img_desc.usage.color_attachment = true;
+        // non-MSAA color images may also be used as resolve target
+        img_desc.usage.resolve_attachment = (att->sample_count == 1);
+    }
+    img_desc.label = "srg-image";
+    img->img = sg_make_image(&img_desc);
+
+    sg_view_desc view_desc;
+    _srg_clear(&view_desc, sizeof(view_desc));
+    if (att->is_depth) {
+        view_desc.depth_stencil_attachment.image = img->img;
+    } else {
+        view_desc.color_attachment.image = img->img;
+    }
+    view_desc.label = "srg-attachment-view";
+    img->att_view = sg_make_view(&view_desc);
+    if (!att->is_depth && (att->sample_count == 1)) {
+        _srg_clear(&view_desc, sizeof(view_desc));
+        view_desc.resolve_attachment.image = img->img;
+        view_desc.label = "srg-resolve-view";
+        img->resolve_view = sg_make_view(&view_desc);
+    }
+    if ((att->sample_count == 1) || sg_query_features().msaa_texture_bindings) {
+        _srg_clear(&view_desc, sizeof(view_desc));
+        view_desc.texture.image = img->img;
+        view_desc.label = "srg-texture-view";
+        img->tex_view = sg_make_view(&view_desc);
+    }
+}
+
+static bool _srg_image_matches(const _srg_image_t* img, const _srg_attachment_t* att) {
+    return img->alive
+        && (img->width == att->width)
+        && (img->height == att->height)
+        && (img->pixel_format == att->pixel_format)
+        && (img->sample_count == att->sample_count);
+}
+
+// find a free physical image for an attachment, or create a new one, returns -1 if image pool is exhausted
+static int _srg_acquire_image(const _srg_attachment_t* att) {
+    int free_slot = -1;
+    for (int i = 0; i < _srg.desc.max_images; i++) {
+        _srg_image_t* img = &_srg.images[i];
+        if (_srg_image_matches(img, att) && (img->busy_until < att->first_use)) {
+            return i;
+        }
+        if (!img->alive && (free_slot == -1)) {
+            free_slot = i;
+        }
+    }
+    if (free_slot != -1) {
+        _srg_create_image(&_srg.images[free_slot], att);
+    }
+    return free_slot;
+}
+
+// >>graph
+// returns true if the pass renders into an attachment, and whether the previous content is loaded
+static bool _srg_pass_writes(const srg_pass_desc* pass, srg_attachment att, bool* out_load) {
+    SOKOL_ASSERT(pass && out_load);
+    *out_load = false;
+    bool writes = false;
+    for (int i = 0; i < SG_MAX_COLOR_ATTACHMENTS; i++) {
+        if (pass->colors[i].id == att.id) {
+            writes = true;
+            *out_load |= pass->action.colors[i].load_action == SG_LOADACTION_LOAD;
+        }
+        if (pass->resolves[i].id == att.id) {
+            writes = true;
+        }
+    }
+    if (pass->depth_stencil.id == att.id) {
+        writes = true;
+        *out_load |= pass->action.depth.load_action == SG_LOADACTION_LOAD;
+        *out_load |= pass->action.stencil.load_action == SG_LOADACTION_LOAD;
+    }
+    return writes;
+}
+
+// returns index of the most recent pass before 'pass_index' which writes an attachment, or -1
+static int _srg_find_writer(int pass_index, srg_attachment att) {
+    for (int i = pass_index - 1; i >= 0; i--) {
+        bool load;
+        if (_srg_pass_writes(&_srg.passes[i].desc, att, &load)) {
+            return i;
+        }
+    }
+    return -1;
+}
+
+static void _srg_mark_writer_needed(int pass_index, srg_attachment att, bool is_read) {
+    const int writer = _srg_find_writer(pass_index, att);
+    if (writer >= 0) {
+        _srg.passes[writer].needed = true;
+    } else if (is_read) {
+        _SRG_WARN(PASS_READ_UNWRITTEN_ATTACHMENT);
+    }
+}
+
+static void _srg_cull_passes(void) {
+    // walk backward from the root passes, since dependencies only ever point
+    // to previously declared passes, a single backward iteration is enough
+    for (int pi = _srg.num_passes - 1; pi >= 0; pi--) {
+        _srg_pass_t* pass = &_srg.passes[pi];
+        if (pass->desc.to_swapchain || pass->desc.keep) {
+            pass->needed = true;
+        }
+        if (!pass->needed) {
+            continue;
+        }
+        for (int i = 0; i < SRG_MAX_PASS_READS; i++) {
+            if (pass->desc.reads[i].id != SRG_INVALID_ID) {
+                _srg_mark_writer_needed(pi, pass->desc.reads[i], true);
+            }
+        }
+        for (int i = 0; i < SG_MAX_COLOR_ATTACHMENTS; i++) {
+            if ((pass->desc.colors[i].id != SRG_INVALID_ID) && (pass->desc.action.colors[i].load_action == SG_LOADACTION_LOAD)) {
+                _srg_mark_writer_needed(pi, pass->desc.colors[i], false);
+            }
+        }
+        if (pass->desc.depth_stencil.id != SRG_INVALID_ID) {
+            const sg_pass_action* action = &pass->desc.action;
+            if ((action->depth.load_action == SG_LOADACTION_LOAD) || (action->stencil.load_action == SG_LOADACTION_LOAD)) {
+                _srg_mark_writer_needed(pi, pass->desc.depth_stencil, false);
+            }
+        }
+    }
+    _srg.num_exec = 0;
+    for (int pi = 0; pi < _srg.num_passes; pi++) {
+        if (_srg.passes[pi].needed) {
+            _srg.exec_order[_srg.num_exec++] = pi;
+        }
+    }
+}
+
+static void _srg_use_attachment(srg_attachment att, int exec_index) {
+    const int att_index = _srg_attachment_index(att);
+    if (att_index >= 0) {
+        _srg_attachment_t* a = &_srg.attachments[att_index];
+        if (a->first_use < 0) {
+            a->first_use = exec_index;
+        }
+        a->last_use = exec_index;
+    }
+}
+
+static void _srg_compute_lifetimes(void) {
+    for (int ei = 0; ei < _srg.num_exec; ei++) {
+        const srg_pass_desc* pass = &_srg.passes[_srg.exec_order[ei]].desc;
+        for (int i = 0; i < SG_MAX_COLOR_ATTACHMENTS; i++) {
+            _srg_use_attachment(pass->colors[i], ei);
+            _srg_use_attachment(pass->resolves[i], ei);
+        }
+        _srg_use_attachment(pass->depth_stencil, ei);
+        for (int i = 0; i < SRG_MAX_PASS_READS; i++) {
+            _srg_use_attachment(pass->reads[i], ei);
+        }
+    }
+}
+
+static void _srg_assign_images(void) {
+    for (int i = 0; i < _srg.desc.max_images; i++) {
+        _srg.images[i].busy_until = -1;
+    }
+    bool exhausted = false;
+    // assign images in order of first use, so that images freed by earlier
+    // attachments can be picked up by later attachments
+    for (int ei = 0; ei < _srg.num_exec; ei++) {
+        for (int ai = 0; ai < _srg.num_attachments; ai++) {
+            _srg_attachment_t* att = &_srg.attachments[ai];
+            if (att->first_use != ei) {
+                continue;
+            }
+            att->image_index = _srg_acquire_image(att);
+            if (att->image_index >= 0) {
+                _srg_image_t* img = &_srg.images[att->image_index];
+                img->busy_until = att->last_use;
+                img->last_used_frame = _srg.frame_id;
+            } else {
+                exhausted = true;
+            }
+        }
+    }
+    if (exhausted) {
+        _SRG_ERROR(IMAGE_POOL_EXHAUSTED);
+    }
+}
+
+static void _srg_garbage_collect_images(void) {
+    for (int i = 0; i < _srg.desc.max_images; i++) {
+        _srg_image_t* img = &_srg.images[i];
+        if (img->alive && ((_srg.frame_id - img->last_used_frame) >= (uint32_t)_srg.desc.max_idle_frames)) {
+            _srg_destroy_image(img);
+        }
+    }
+}
+
+// returns false if any attachment of the pass has no physical image
+static bool _srg_lookup_view(srg_attachment att, bool resolve, sg_view* out_view) {
+    SOKOL_ASSERT(out_view);
+    if (att.id == SRG_INVALID_ID) {
+        return true;
+    }
+    const int att_index = _srg_attachment_index(att);
+    SOKOL_ASSERT(att_index >= 0);
+    const int img_index = _srg.attachments[att_index].image_index;
+    if (img_index < 0) {
+        return false;
+    }
+    const _srg_image_t* img = &_srg.images[img_index];
+    *out_view = resolve ? img->resolve_view : img->att_view;
+    return true;
+}
+
+static void _srg_run_pass(const srg_pass_desc* desc) {
+    sg_pass pass;
+    _srg_clear(&pass, sizeof(pass));
+    pass.action = desc->action;
+    pass.label = desc->label;
+    if (desc->to_swapchain) {
+        pass.swapchain = desc->swapchain;
+    } else {
+        bool valid = true;
+        for (int i = 0; i < SG_MAX_COLOR_ATTACHMENTS; i++) {
+            valid &= _srg_lookup_view(desc->colors[i], false, &pass.attachments.colors[i]);
+            valid &= _srg_lookup_view(desc->resolves[i], true, &pass.attachments.resolves[i]);
+        }
+        valid &= _srg_lookup_view(desc->depth_stencil, false, &pass.attachments.depth_stencil);
+        if (!valid) {
+            // the image pool was exhausted, this has already been logged
+            return;
+        }
+    }
+    sg_begin_pass(&pass);
+    if (desc->func) {
+        desc->func(desc->user_data);
+    }
+    sg_end_pass();
+}
+
+static bool _srg_validate_attachment_handle(srg_attachment att) {
+    if ((att.id != SRG_INVALID_ID) && (_srg_attachment_index(att) < 0)) {
+        _SRG_ERROR(PASS_INVALID_ATTACHMENT);
+        return false;
+    }
+    return true;
+}
+
+static const _srg_attachment_t* _srg_attachment_or_null(srg_attachment att) {
+    const int att_index = _srg_attachment_index(att);
+    return (att_index >= 0) ? &_srg.attachments[att_index] : 0;
+}
+
+static bool _srg_validate_pass_desc(const srg_pass_desc* desc) {
+    SOKOL_ASSERT(desc);
+    bool any_attachment = false;
+    for (int i = 0; i < SG_MAX_COLOR_ATTACHMENTS; i++) {
+        if (!_srg_validate_attachment_handle(desc->colors[i]) || !_srg_validate_attachment_handle(desc->resolves[i])) {
+            return false;
+        }
+        const _srg_attachment_t* color = _srg_attachment_or_null(desc->colors[i]);
+        const _srg_attachment_t* resolve = _srg_attachment_or_null(desc->resolves[i]);
+        if ((color && color->is_depth) || (resolve && resolve->is_depth)) {
+            _SRG_ERROR(PASS_COLOR_IS_DEPTH);
+            return false;
+        }
+        if (resolve && (resolve->sample_count != 1)) {
+            _SRG_ERROR(PASS_RESOLVE_IS_MSAA);
+            return false;
+        }
+        any_attachment |= (0 != color) || (0 != resolve);
+    }
+    if (!_srg_validate_attachment_handle(desc->depth_stencil)) {
+        return false;
+    }
+    const _srg_attachment_t* depth_stencil = _srg_attachment_or_null(desc->depth_stencil);
+    if (depth_stencil && !depth_stencil->is_depth) {
+        _SRG_ERROR(PASS_DEPTH_IS_COLOR);
+        return false;
+    }
+    any_attachment |= (0 != depth_stencil);
+    if (desc->to_swapchain && any_attachment) {
+        _SRG_ERROR(PASS_SWAPCHAIN_ATTACHMENTS);
+        return false;
+    }
+    if (!desc->to_swapchain && !any_attachment) {
+        _SRG_ERROR(PASS_NO_ATTACHMENTS);
+        return false;
+    }
+    for (int i = 0; i < SRG_MAX_PASS_READS; i++) {
+        if (!_srg_validate_attachment_handle(desc->reads[i])) {
+            return false;
+        }
+        bool load;
+        if ((desc->reads[i].id != SRG_INVALID_ID) && _srg_pass_writes(desc, desc->reads[i], &load)) {
+            _SRG_ERROR(PASS_READ_WRITE_SAME_ATTACHMENT);
+            return false;
+        }
+    }
+    return true;
+}
+
+// >>public
+SOKOL_API_IMPL void srg_setup(const srg_desc* desc) {
+    SOKOL_ASSERT(desc);
+    SOKOL_ASSERT((desc->allocator.alloc_fn && desc->allocator.free_fn) || (!desc->allocator.alloc_fn && !desc->allocator.free_fn));
+    _srg_clear(&_srg, sizeof(_srg));
+    _srg.init_tag = _SRG_INIT_TAG;
+    _srg.desc = _srg_desc_defaults(desc);
+    SOKOL_ASSERT((_srg.desc.max_passes > 0) && (_srg.desc.max_passes <= _SRG_MAX_POOL_SIZE));
+    SOKOL_ASSERT((_srg.desc.max_attachments > 0) && (_srg.desc.max_attachments <= _SRG_MAX_POOL_SIZE));
+    SOKOL_ASSERT(_srg.desc.max_images > 0);
+    _srg.passes = (_srg_pass_t*) _srg_malloc_clear(sizeof(_srg_pass_t) * (size_t)_srg.desc.max_passes);
+    _srg.exec_order = (int*) _srg_malloc_clear(sizeof(int) * (size_t)_srg.desc.max_passes);
+    _srg.attachments = (_srg_attachment_t*) _srg_malloc_clear(sizeof(_srg_attachment_t) * (size_t)_srg.desc.max_attachments);
+    _srg.images = (_srg_image_t*) _srg_malloc_clear(sizeof(_srg_image_t) * (size_t)_srg.desc.max_images);
+    _srg.executed = true;
+}
+
+SOKOL_API_IMPL void srg_shutdown(void) {
+    SOKOL_ASSERT(_SRG_INIT_TAG == _srg.init_tag);
+    for (int i = 0; i < _srg.desc.max_images; i++) {
+        if (_srg.images[i].alive) {
+            _srg_destroy_image(&_srg.images[i]);
+        }
+    }
+    _srg_free(_srg.images);
+    _srg_free(_srg.attachments);
+    _srg_free(_srg.exec_order);
+    _srg_free(_srg.passes);
+    _srg_clear(&_srg, sizeof(_srg));
+}
+
+SOKOL_API_IMPL void srg_begin(int width, int height) {
+    SOKOL_ASSERT(_SRG_INIT_TAG == _srg.init_tag);
+    SOKOL_ASSERT((width > 0) && (height > 0));
+    if (!_srg.executed) {
+        _SRG_WARN(EXECUTE_NOT_CALLED);
+    }
+    _srg.frame_id++;
+    _srg.in_graph = true;
+    _srg.executed = false;
+    _srg.width = width;
+    _srg.height = height;
+    _srg.num_passes = 0;
+    _srg.num_attachments = 0;
+    _srg.num_exec = 0;
+}
+
+SOKOL_API_IMPL srg_attachment srg_create_attachment(const srg_attachment_desc* desc) {
+    SOKOL_ASSERT(_SRG_INIT_TAG == _srg.init_tag);
+    SOKOL_ASSERT(desc);
+    srg_attachment res = { SRG_INVALID_ID };
+    if (!_srg.in_graph) {
+        _SRG_ERROR(BEGIN_NOT_CALLED);
+        return res;
+    }
+    if (_srg.num_attachments >= _srg.desc.max_attachments) {
+        _SRG_ERROR(ATTACHMENT_POOL_EXHAUSTED);
+        return res;
+    }
+    const float scale = _srg_def_flt(desc->scale, 1.0f);
+    const int width = _srg_def(desc->width, (int)((float)_srg.width * scale));
+    const int height = _srg_def(desc->height, (int)((float)_srg.height * scale));
+    if ((width <= 0) || (height <= 0)) {
+        _SRG_ERROR(ATTACHMENT_INVALID_SIZE);
+        return res;
+    }
+    const int index = _srg.num_attachments++;
+    _srg_attachment_t* att = &_srg.attachments[index];
+    _srg_clear(att, sizeof(_srg_attachment_t));
+    att->width = width;
+    att->height = height;
+    att->pixel_format = _srg_def(desc->pixel_format, sg_query_desc().environment.defaults.color_format);
+    att->sample_count = _srg_def(desc->sample_count, 1);
+    att->is_depth = _srg_is_depth_format(att->pixel_format);
+    att->first_use = -1;
+    att->last_use = -1;
+    att->image_index = -1;
+    res.id = _srg_make_id(index);
+    return res;
+}
+
+SOKOL_API_IMPL void srg_add_pass(const srg_pass_desc* desc) {
+    SOKOL_ASSERT(_SRG_INIT_TAG == _srg.init_tag);
+    SOKOL_ASSERT(desc);
+    if (!_srg.in_graph) {
+        _SRG_ERROR(BEGIN_NOT_CALLED);
+        return;
+    }
+    if (_srg.num_passes >= _srg.desc.max_passes) {
+        _SRG_ERROR(PASS_POOL_EXHAUSTED);
+        return;
+    }
+    if (!_srg_validate_pass_desc(desc)) {
+        return;
+    }
+    _srg_pass_t* pass = &_srg.passes[_srg.num_passes++];
+    pass->desc = *desc;
+    pass->needed = false;
+}
+
+SOKOL_API_IMPL void srg_execute(void) {
+    SOKOL_ASSERT(_SRG_INIT_TAG == _srg.init_tag);
+    if (!_srg.in_graph) {
+        _SRG_ERROR(BEGIN_NOT_CALLED);
+        return;
+    }
+    _srg.in_graph = false;
+    _srg.executed = true;
+    _srg_cull_passes();
+    _srg_compute_lifetimes();
+    _srg_assign_images();
+    _srg_garbage_collect_images();
+    for (int ei = 0; ei < _srg.num_exec; ei++) {
+        _srg_run_pass(&_srg.passes[_srg.exec_order[ei]].desc);
+    }
+
+    // update stats
+    _srg_clear(&_srg.stats, sizeof(_srg.stats));
+    _srg.stats.num_passes = _srg.num_passes;
+    _srg.stats.num_culled_passes = _srg.num_passes - _srg.num_exec;
+    _srg.stats.num_attachments = _srg.num_attachments;
+    for (int ai = 0; ai < _srg.num_attachments; ai++) {
+        if (_srg.attachments[ai].first_use >= 0) {
+            _srg.stats.num_used_attachments++;
+        }
+    }
+    for (int i = 0; i < _srg.desc.max_images; i++) {
+        if (_srg.images[i].alive) {
+            _srg.stats.num_cached_images++;
+            if (_srg.images[i].last_used_frame == _srg.frame_id) {
+                _srg.stats.num_images++;
+            }
+        }
+    }
+}
+
+SOKOL_API_IMPL sg_image srg_image(srg_attachment att) {
+    SOKOL_ASSERT(_SRG_INIT_TAG == _srg.init_tag);
+    sg_image res = { SG_INVALID_ID };
+    const int att_index = _srg_attachment_index(att);
+    if ((att_index >= 0) && _srg.executed) {
+        const int img_index = _srg.attachments[att_index].image_index;
+        if (img_index >= 0) {
+            res = _srg.images[img_index].img;
+        }
+    }
+    return res;
+}
+
+SOKOL_API_IMPL sg_view srg_texture_view(srg_attachment att) {
+    SOKOL_ASSERT(_SRG_INIT_TAG == _srg.init_tag);
+    sg_view res = { SG_INVALID_ID };
+    const int att_index = _srg_attachment_index(att);
+    if ((att_index >= 0) && _srg.executed) {
+        const int img_index = _srg.attachments[att_index].image_index;
+        if (img_index >= 0) {
+            res = _srg.images[img_index].tex_view;
+        }
+    }
+    return res;
+}
+
+SOKOL_API_IMPL srg_stats srg_query_stats(void) {
+    SOKOL_ASSERT(_SRG_INIT_TAG == _srg.init_tag);
+    return _srg.stats;
+}
+
+#endif // SOKOL_RENDERGRAPH_IMPL
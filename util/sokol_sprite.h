@@ -0,0 +1,2327 @@
+#if defined(SOKOL_IMPL) && !defined(SOKOL_SPRITE_IMPL)
+#define SOKOL_SPRITE_IMPL
+#endif
+#ifndef SOKOL_SPRITE_INCLUDED
+/*
+    sokol_sprite.h -- render large numbers of sprites and particles via
+                      storage buffers and vertex pulling
+
+    Project URL: https://github.com/floooh/sokol
+
+    Do this:
+        #define SOKOL_IMPL or
+        #define SOKOL_SPRITE_IMPL
+    before you include this file in *one* C or C++ file to create the
+    implementation.
+
+    The following defines are used by the implementation to select the
+    platform-specific embedded shader code (these are the same defines as
+    used by sokol_gfx.h and sokol_app.h):
+
+    SOKOL_GLCORE
+    SOKOL_GLES3
+    SOKOL_D3D11
+    SOKOL_METAL
+    SOKOL_WGPU
+    SOKOL_VULKAN
+    SOKOL_DUMMY_BACKEND
+
+    Optionally provide the following defines with your own implementations:
+
+    SOKOL_ASSERT(c)     - your own assert macro (default: assert(c))
+    SOKOL_SPRITE_API_DECL - public function declaration prefix (default: extern)
+    SOKOL_API_DECL      - same as SOKOL_SPRITE_API_DECL
+    SOKOL_API_IMPL      - public function implementation prefix (default: -)
+
+    If sokol_sprite.h is compiled as a DLL, define the following before
+    including the declaration or implementation:
+
+    SOKOL_DLL
+
+    Include the following headers before including sokol_sprite.h:
+
+        sokol_gfx.h
+
+    WHAT
+    ====
+    sokol_sprite.h renders textured, colored and rotated quads ('sprites')
+    by writing one compact 36-byte record per sprite into a storage buffer
+    and rendering all sprites of a batch with a single instanced draw call
+    without vertex buffers. The vertex shader 'pulls' the sprite record for
+    the current instance from the storage buffer and computes the 6 corner
+    vertices of the sprite quad. Compared to rendering sprites with sokol_gl.h
+    or custom vertex buffers this reduces the per-sprite CPU work and upload
+    size to a fraction.
+
+    Optionally, an additional GPU-resident sprite buffer can be created which
+    is updated by an application-provided compute shader (e.g. for particle
+    simulation) and rendered without any CPU involvement.
+
+    Storage buffers require sg_query_features().compute, e.g. they are not
+    supported on macOS with the GL backend, or on WebGL2. If storage buffers
+    are not supported, sokol_sprite.h logs an error in sprite_setup() and
+    renders nothing.
+
+    The embedded shaders are generated from shdgen/sokol_sprite.glsl and
+    cover all sokol-gfx backends.
+
+    HOW
+    ===
+    First initialize sokol_sprite.h after sokol_gfx.h:
+
+        ssprite_setup(&(ssprite_desc){
+            .logger.func = slog_func,
+        });
+
+    By default, up to 65536 sprites can be rendered per frame in up to 256
+    batches, this can be tweaked in the ssprite_desc struct:
+
+        ssprite_setup(&(ssprite_desc){
+            .max_sprites = 1024 * 1024,
+            .max_batches = 1024,
+            .logger.func = slog_func,
+        });
+
+    When rendering into an offscreen pass, provide the pixel formats and
+    sample count of the pass attachments:
+
+        ssprite_setup(&(ssprite_desc){
+            .color_format = SG_PIXELFORMAT_RGBA8,
+            .depth_format = SG_PIXELFORMAT_DEPTH,
+            .sample_count = 1,
+            ...
+        });
+
+    Each frame, start a batch with a texture, sampler and transform:
+
+        ssprite_batch(&(ssprite_batch_desc){
+            .texture = atlas_view,          // default: white texture
+            .sampler = smp,                 // default: nearest-filtering sampler
+            .mvp = ssprite_mat4(view_proj), // default: identity
+            .blend_mode = SSPRITE_BLENDMODE_ADDITIVE, // default: alpha blending
+        });
+
+    Sprites are positioned in the plane spanned by the batch's .right and .up
+    vectors (default: (1,0,0) and (0,1,0), which is the xy plane). For camera
+    facing 3D particles, pass the camera's world-space right and up vectors.
+
+    Then add sprites:
+
+        ssprite_add(&(ssprite_sprite){
+            .x = 10.0f, .y = 20.0f,
+            .width = 16.0f, .height = 16.0f,
+            .rotation = 0.5f,
+            .uv0 = ssprite_pack_uv(0.0f, 0.0f),
+            .uv1 = ssprite_pack_uv(0.25f, 0.25f),
+            .color = ssprite_pack_color(1.0f, 1.0f, 1.0f, 1.0f),
+        });
+
+    ...or many sprites at once from an array:
+
+        ssprite_add_many(sprites, num_sprites);
+
+    The texture coordinate uv0 maps to the sprite corner in -right/+up
+    direction, and uv1 to the corner in +right/-up direction.
+
+    A batch with the same parameters as the current batch doesn't start a new
+    draw call. Finally inside a render pass, render all sprites added since
+    the last call with:
+
+        ssprite_draw();
+
+    ssprite_draw() copies all sprites into a stream-update storage buffer with
+    a single sg_append_buffer() call and issues one instanced draw call per
+    batch. It can be called several times per frame.
+
+    GPU SPRITES AND COMPUTE SIMULATION
+    ==================================
+    To create the optional GPU-resident sprite buffer, provide the max number
+    of GPU sprites and optionally initial content in ssprite_desc:
+
+        ssprite_setup(&(ssprite_desc){
+            .max_gpu_sprites = 1000000,
+            .gpu_sprites = SG_RANGE(initial_particles),    // optional
+            ...
+        });
+
+    To update the GPU sprites, create a compute pipeline with a shader that
+    declares the sprite array as read/write storage buffer in view slot 0 and
+    optional parameters in uniform block 0 (e.g. via sokol-shdc):
+
+        struct sprite {
+            float x; float y; float z; float rot;
+            float w; float h;
+            uint uv0; uint uv1; uint color;
+        };
+        layout(binding=0) buffer ssprite_sbuf { sprite sprites[]; };
+
+    ...and call outside of render passes (this runs a compute pass with
+    (num_sprites + group_size - 1) / group_size workgroups):
+
+        ssprite_simulate(&(ssprite_simulate_desc){
+            .pipeline = particle_update_pip,
+            .uniforms = SG_RANGE(params),      // optional
+            .num_sprites = num_particles,      // default: max_gpu_sprites
+            .group_size = 64,                  // default: 64
+        });
+
+    Render a range of GPU sprites inside a render pass with:
+
+        ssprite_draw_gpu(&(ssprite_gpu_draw_desc){
+            .batch = { .texture = particle_view, .mvp = ssprite_mat4(view_proj) },
+            .first = 0,
+            .num = num_particles,  // default: max_gpu_sprites
+        });
+
+    The GPU sprite buffer can be queried with ssprite_query_gpu_buffer().
+
+    CUSTOM SHADERS
+    ==============
+    A custom shader can be provided via ssprite_desc.shader. The shader
+    must use the following bindings:
+
+        - uniform block 0 (vertex stage): 112 bytes
+            mat4 mvp; vec4 right; vec4 up; vec4 misc;
+          where misc.x is the index of the first sprite of the draw call (as float)
+        - view slot 0 (fragment stage): 2D float texture
+        - view slot 1 (vertex stage): readonly storage buffer with sprite records
+        - sampler slot 0 (fragment stage): filtering sampler
+
+    ...and render 6 vertices per instance (two triangles). See
+    shdgen/sokol_sprite.glsl for the embedded shader source.
+
+    STATISTICS
+    ==========
+    To get statistics about the last call to ssprite_draw():
+
+        ssprite_stats stats = ssprite_query_stats();
+
+    At the end of the program call:
+
+        ssprite_shutdown();
+
+    ...before sg_shutdown().
+
+    LICENSE
+    =======
+
+    zlib/libpng license
+
+    Copyright (c) 2026 Andre Weissflog
+
+    This software is provided 'as-is', without any express or implied warranty.
+    In no event will the authors be held liable for any damages arising from the
+    use of this software.
+
+    Permission is granted to anyone to use this software for any purpose,
+    including commercial applications, and to alter it and redistribute it
+    freely, subject to the following restrictions:
+
+        1. The origin of this software must not be misrepresented; you must not
+        claim that you wrote the original software. If you use this software in a
+        product, an acknowledgment in the product documentation would be
+        appreciated but is not required.
+
+        2. Altered source versions must be plainly marked as such, and must not
+        be misrepresented as being the original software.
+
+        3. This notice may not be removed or altered from any source
+        distribution.
+*/
+#define SOKOL_SPRITE_INCLUDED (1)
+#include <stddef.h>
+#include <stdint.h>
+#include <stdbool.h>
+
+#if !defined(SOKOL_GFX_INCLUDED)
+#error "Please include sokol_gfx.h before sokol_sprite.h"
+#endif
+
+#if defined(SOKOL_API_DECL) && !defined(SOKOL_SPRITE_API_DECL)
+#define SOKOL_SPRITE_API_DECL SOKOL_API_DECL
+#endif
+#ifndef SOKOL_SPRITE_API_DECL
+#if defined(_WIN32) && defined(SOKOL_DLL) && defined(SOKOL_SPRITE_IMPL)
+#define SOKOL_SPRITE_API_DECL __declspec(dllexport)
+#elif defined(_WIN32) && defined(SOKOL_DLL)
+#define SOKOL_SPRITE_API_DECL __declspec(dllimport)
+#else
+#define SOKOL_SPRITE_API_DECL extern
+#endif
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+    ssprite_log_item
+
+    Log items are defined via X-Macros and expanded to an enum
+    'ssprite_log_item', and in debug mode to corresponding
+    human readable error messages.
+*/
+#define _SSPRITE_LOG_ITEMS \
+    _SSPRITE_LOGITEM_XMACRO(OK, "Ok") \
+    _SSPRITE_LOGITEM_XMACRO(MALLOC_FAILED, "memory allocation failed") \
+    _SSPRITE_LOGITEM_XMACRO(STORAGE_BUFFERS_NOT_SUPPORTED, "storage buffers not supported (sg_features.compute), sprites will not be rendered") \
+    _SSPRITE_LOGITEM_XMACRO(SPRITE_BUFFER_FULL, "too many sprites between calls to ssprite_draw() (ssprite_desc.max_sprites)") \
+    _SSPRITE_LOGITEM_XMACRO(BATCH_POOL_EXHAUSTED, "too many batches between calls to ssprite_draw() (ssprite_desc.max_batches)") \
+    _SSPRITE_LOGITEM_XMACRO(STREAM_BUFFER_FULL, "sprites don't fit into stream buffer in this frame, sprites dropped (ssprite_desc.max_sprites)") \
+    _SSPRITE_LOGITEM_XMACRO(NO_GPU_SPRITES, "no GPU sprite buffer (ssprite_desc.max_gpu_sprites is 0)") \
+    _SSPRITE_LOGITEM_XMACRO(GPU_SPRITES_OUT_OF_RANGE, "GPU sprite range out of bounds (ssprite_desc.max_gpu_sprites)") \
+
+#define _SSPRITE_LOGITEM_XMACRO(item,msg) SSPRITE_LOGITEM_##item,
+typedef enum ssprite_log_item {
+    _SSPRITE_LOG_ITEMS
+} ssprite_log_item;
+#undef _SSPRITE_LOGITEM_XMACRO
+
+/*
+    ssprite_sprite
+
+    The per-sprite record written into the storage buffer (36 bytes).
+    uv0 and uv1 are two 16-bit normalized texture coordinates each
+    (see ssprite_pack_uv()), color is an RGBA8 color (see ssprite_pack_color()).
+*/
+typedef struct ssprite_sprite {
+    float x, y, z;      // center position
+    float rotation;     // rotation in radians
+    float width, height;
+    uint32_t uv0;       // texture coordinate of the -right/+up corner
+    uint32_t uv1;       // texture coordinate of the +right/-up corner
+    uint32_t color;     // RGBA8 color (0xAABBGGRR)
+} ssprite_sprite;
+
+// a 4x4 column-major matrix wrapper struct
+typedef struct ssprite_mat4_t { float m[4][4]; } ssprite_mat4_t;
+
+typedef enum ssprite_blend_mode {
+    _SSPRITE_BLENDMODE_DEFAULT,     // value 0 reserved for default-init
+    SSPRITE_BLENDMODE_ALPHA,
+    SSPRITE_BLENDMODE_ADDITIVE,
+    SSPRITE_BLENDMODE_NONE,
+    _SSPRITE_BLENDMODE_NUM,
+} ssprite_blend_mode;
+
+/*
+    ssprite_batch_desc
+
+    Rendering parameters for a batch of sprites, used in ssprite_batch()
+    and ssprite_draw_gpu().
+*/
+typedef struct ssprite_batch_desc {
+    sg_view texture;                // default: white texture
+    sg_sampler sampler;             // default: nearest-filtering sampler
+    ssprite_mat4_t mvp;             // default: identity
+    float right[3];                 // default: (1, 0, 0)
+    float up[3];                    // default: (0, 1, 0)
+    ssprite_blend_mode blend_mode;  // default: SSPRITE_BLENDMODE_ALPHA
+} ssprite_batch_desc;
+
+/*
+    ssprite_simulate_desc
+
+    Parameters for ssprite_simulate() to update the GPU sprites with a
+    compute shader.
+*/
+typedef struct ssprite_simulate_desc {
+    sg_pipeline pipeline;   // a compute pipeline
+    sg_range uniforms;      // optional content of uniform block 0
+    int num_sprites;        // default: ssprite_desc.max_gpu_sprites
+    int group_size;         // number of threads per workgroup, default: 64
+} ssprite_simulate_desc;
+
+/*
+    ssprite_gpu_draw_desc
+
+    Parameters for ssprite_draw_gpu().
+*/
+typedef struct ssprite_gpu_draw_desc {
+    ssprite_batch_desc batch;
+    int first;              // index of the first GPU sprite
+    int num;                // default: ssprite_desc.max_gpu_sprites - first
+} ssprite_gpu_draw_desc;
+
+/*
+    ssprite_stats
+
+    Statistics about the last call to ssprite_draw(), returned by ssprite_query_stats().
+*/
+typedef struct ssprite_stats {
+    int num_sprites;        // number of rendered sprites
+    int num_batches;        // number of batches (== number of draw calls)
+    int num_bytes;          // number of bytes written into the stream buffer
+} ssprite_stats;
+
+/*
+    ssprite_allocator
+
+    Used in ssprite_desc to provide custom memory-alloc and -free functions
+    to sokol_sprite.h. If memory management should be overridden, both
+    the alloc and free function must be provided (e.g. it's not valid to
+    override one function but not the other).
+*/
+typedef struct ssprite_allocator {
+    void* (*alloc_fn)(size_t size, void* user_data);
+    void (*free_fn)(void* ptr, void* user_data);
+    void* user_data;
+} ssprite_allocator;
+
+/*
+    ssprite_logger
+
+    Used in ssprite_desc to provide a custom logging and error reporting
+    callback to sokol_sprite.h.
+*/
+typedef struct ssprite_logger {
+    void (*func)(
+        const char* tag,                // always "ssprite"
+        uint32_t log_level,             // 0=panic, 1=error, 2=warning, 3=info
+        uint32_t log_item_id,           // SSPRITE_LOGITEM_*
+        const char* message_or_null,    // a message string, may be nullptr in release mode
+        uint32_t line_nr,               // line number in sokol_sprite.h
+        const char* filename_or_null,   // source filename, may be nullptr in release mode
+        void* user_data);
+    void* user_data;
+} ssprite_logger;
+
+/*
+    Initialization parameters passed into ssprite_setup(). You should at least
+    provide a logging function, otherwise you won't see any error logging.
+*/
+typedef struct ssprite_desc {
+    int max_sprites;                // max number of sprites per frame, default: 65536
+    int max_batches;                // max number of batches between ssprite_draw(), default: 256
+    int max_gpu_sprites;            // size of the GPU sprite buffer, default: 0 (no GPU sprites)
+    sg_range gpu_sprites;           // optional initial content of the GPU sprite buffer
+    sg_pixel_format color_format;   // color pixel format of target render pass
+    sg_pixel_format depth_format;   // depth pixel format of target render pass
+    int sample_count;               // MSAA sample count of target render pass
+    sg_shader shader;               // optional custom shader
+    ssprite_allocator allocator;
+    ssprite_logger logger;
+} ssprite_desc;
+
+// setup sokol-sprite (call after sg_setup())
+SOKOL_SPRITE_API_DECL void ssprite_setup(const ssprite_desc* desc);
+// shutdown sokol-sprite (call before sg_shutdown())
+SOKOL_SPRITE_API_DECL void ssprite_shutdown(void);
+// start a new batch of sprites
+SOKOL_SPRITE_API_DECL void ssprite_batch(const ssprite_batch_desc* desc);
+// add a sprite to the current batch
+SOKOL_SPRITE_API_DECL void ssprite_add(const ssprite_sprite* sprite);
+// add many sprites to the current batch
+SOKOL_SPRITE_API_DECL void ssprite_add_many(const ssprite_sprite* sprites, int num);
+// render all sprites added since the last call (inside a render pass)
+SOKOL_SPRITE_API_DECL void ssprite_draw(void);
+// update the GPU sprites with a compute shader (outside of render passes)
+SOKOL_SPRITE_API_DECL void ssprite_simulate(const ssprite_simulate_desc* desc);
+// render a range of GPU sprites (inside a render pass)
+SOKOL_SPRITE_API_DECL void ssprite_draw_gpu(const ssprite_gpu_draw_desc* desc);
+// get the GPU sprite buffer
+SOKOL_SPRITE_API_DECL sg_buffer ssprite_query_gpu_buffer(void);
+// get statistics about the last ssprite_draw()
+SOKOL_SPRITE_API_DECL ssprite_stats ssprite_query_stats(void);
+// helper functions
+SOKOL_SPRITE_API_DECL uint32_t ssprite_pack_uv(float u, float v);
+SOKOL_SPRITE_API_DECL uint32_t ssprite_pack_color(float r, float g, float b, float a);
+SOKOL_SPRITE_API_DECL ssprite_mat4_t ssprite_mat4(const float m[16]);
+SOKOL_SPRITE_API_DECL ssprite_mat4_t ssprite_mat4_transpose(const float m[16]);
+
+#ifdef __cplusplus
+} // extern "C"
+inline void ssprite_setup(const ssprite_desc& desc) { return ssprite_setup(&desc); }
+inline void ssprite_batch(const ssprite_batch_desc& desc) { return ssprite_batch(&desc); }
+inline void ssprite_add(const ssprite_sprite& sprite) { return ssprite_add(&sprite); }
+inline void ssprite_simulate(const ssprite_simulate_desc& desc) { return ssprite_simulate(&desc); }
+inline void ssprite_draw_gpu(const ssprite_gpu_draw_desc& desc) { return ssprite_draw_gpu(&desc); }
+#endif
+#endif // SOKOL_SPRITE_INCLUDED
+
+/*=== IMPLEMENTATION =========================================================*/
+#ifdef SOKOL_SPRITE_IMPL
+#define SOKOL_SPRITE_IMPL_INCLUDED (1)
+
+#include <stdlib.h> // malloc, free, abort
+#include <string.h> // memset, memcpy
+
+#ifndef SOKOL_API_IMPL
+    #define SOKOL_API_IMPL
+#endif
+#ifndef SOKOL_DEBUG
+    #ifndef NDEBUG
+        #define SOKOL_DEBUG
+    #endif
+#endif
+#ifndef SOKOL_ASSERT
+    #include <assert.h>
+    #define SOKOL_ASSERT(c) assert(c)
+#endif
+
+#define _ssprite_def(val, def) (((val) == 0) ? (def) : (val))
+#define _SSPRITE_INIT_TAG (0xABCDABCD)
+
+// >>shaders
+//>#shdgen
+#if defined(SOKOL_GLCORE)
+static const uint8_t _ssprite_shd_vs_source_glsl430[1228] = {
+    0x23,0x76,0x65,0x72,0x73,0x69,0x6f,0x6e,0x20,0x34,0x33,0x30,0x0a,0x0a,0x73,0x74,
+    0x72,0x75,0x63,0x74,0x20,0x73,0x70,0x72,0x69,0x74,0x65,0x0a,0x7b,0x0a,0x20,0x20,
+    0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x78,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,
+    0x6c,0x6f,0x61,0x74,0x20,0x79,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,
+    0x74,0x20,0x7a,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x72,
+    0x6f,0x74,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x77,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x68,0x3b,0x0a,0x20,0x20,
+    0x20,0x20,0x75,0x69,0x6e,0x74,0x20,0x75,0x76,0x30,0x3b,0x0a,0x20,0x20,0x20,0x20,
+    0x75,0x69,0x6e,0x74,0x20,0x75,0x76,0x31,0x3b,0x0a,0x20,0x20,0x20,0x20,0x75,0x69,
+    0x6e,0x74,0x20,0x63,0x6f,0x6c,0x6f,0x72,0x3b,0x0a,0x7d,0x3b,0x0a,0x0a,0x63,0x6f,
+    0x6e,0x73,0x74,0x20,0x76,0x65,0x63,0x32,0x20,0x5f,0x35,0x37,0x5b,0x36,0x5d,0x20,
+    0x3d,0x20,0x76,0x65,0x63,0x32,0x5b,0x5d,0x28,0x76,0x65,0x63,0x32,0x28,0x2d,0x30,
+    0x2e,0x35,0x2c,0x20,0x30,0x2e,0x35,0x29,0x2c,0x20,0x76,0x65,0x63,0x32,0x28,0x30,
+    0x2e,0x35,0x29,0x2c,0x20,0x76,0x65,0x63,0x32,0x28,0x30,0x2e,0x35,0x2c,0x20,0x2d,
+    0x30,0x2e,0x35,0x29,0x2c,0x20,0x76,0x65,0x63,0x32,0x28,0x2d,0x30,0x2e,0x35,0x2c,
+    0x20,0x30,0x2e,0x35,0x29,0x2c,0x20,0x76,0x65,0x63,0x32,0x28,0x30,0x2e,0x35,0x2c,
+    0x20,0x2d,0x30,0x2e,0x35,0x29,0x2c,0x20,0x76,0x65,0x63,0x32,0x28,0x2d,0x30,0x2e,
+    0x35,0x29,0x29,0x3b,0x0a,0x0a,0x75,0x6e,0x69,0x66,0x6f,0x72,0x6d,0x20,0x76,0x65,
+    0x63,0x34,0x20,0x76,0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x37,0x5d,0x3b,
+    0x0a,0x6c,0x61,0x79,0x6f,0x75,0x74,0x28,0x62,0x69,0x6e,0x64,0x69,0x6e,0x67,0x20,
+    0x3d,0x20,0x30,0x2c,0x20,0x73,0x74,0x64,0x34,0x33,0x30,0x29,0x20,0x72,0x65,0x61,
+    0x64,0x6f,0x6e,0x6c,0x79,0x20,0x62,0x75,0x66,0x66,0x65,0x72,0x20,0x73,0x73,0x70,
+    0x72,0x69,0x74,0x65,0x5f,0x73,0x62,0x75,0x66,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,
+    0x73,0x70,0x72,0x69,0x74,0x65,0x20,0x73,0x70,0x72,0x69,0x74,0x65,0x73,0x5b,0x5d,
+    0x3b,0x0a,0x7d,0x20,0x5f,0x35,0x3b,0x0a,0x0a,0x6c,0x61,0x79,0x6f,0x75,0x74,0x28,
+    0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x30,0x29,0x20,0x6f,0x75,
+    0x74,0x20,0x76,0x65,0x63,0x32,0x20,0x75,0x76,0x3b,0x0a,0x6c,0x61,0x79,0x6f,0x75,
+    0x74,0x28,0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x31,0x29,0x20,
+    0x6f,0x75,0x74,0x20,0x76,0x65,0x63,0x34,0x20,0x63,0x6f,0x6c,0x6f,0x72,0x3b,0x0a,
+    0x0a,0x76,0x6f,0x69,0x64,0x20,0x6d,0x61,0x69,0x6e,0x28,0x29,0x0a,0x7b,0x0a,0x20,
+    0x20,0x20,0x20,0x69,0x6e,0x74,0x20,0x69,0x64,0x78,0x20,0x3d,0x20,0x67,0x6c,0x5f,
+    0x49,0x6e,0x73,0x74,0x61,0x6e,0x63,0x65,0x49,0x44,0x20,0x2b,0x20,0x69,0x6e,0x74,
+    0x28,0x76,0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x36,0x5d,0x2e,0x78,0x29,
+    0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x65,0x63,0x32,0x20,0x63,0x20,0x3d,0x20,0x5f,
+    0x35,0x37,0x5b,0x67,0x6c,0x5f,0x56,0x65,0x72,0x74,0x65,0x78,0x49,0x44,0x5d,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x76,0x65,0x63,0x32,0x20,0x6f,0x66,0x73,0x20,0x3d,0x20,
+    0x63,0x20,0x2a,0x20,0x76,0x65,0x63,0x32,0x28,0x5f,0x35,0x2e,0x73,0x70,0x72,0x69,
+    0x74,0x65,0x73,0x5b,0x69,0x64,0x78,0x5d,0x2e,0x77,0x2c,0x20,0x5f,0x35,0x2e,0x73,
+    0x70,0x72,0x69,0x74,0x65,0x73,0x5b,0x69,0x64,0x78,0x5d,0x2e,0x68,0x29,0x3b,0x0a,
+    0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x73,0x6e,0x20,0x3d,0x20,0x73,
+    0x69,0x6e,0x28,0x5f,0x35,0x2e,0x73,0x70,0x72,0x69,0x74,0x65,0x73,0x5b,0x69,0x64,
+    0x78,0x5d,0x2e,0x72,0x6f,0x74,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,
+    0x61,0x74,0x20,0x63,0x73,0x20,0x3d,0x20,0x63,0x6f,0x73,0x28,0x5f,0x35,0x2e,0x73,
+    0x70,0x72,0x69,0x74,0x65,0x73,0x5b,0x69,0x64,0x78,0x5d,0x2e,0x72,0x6f,0x74,0x29,
+    0x3b,0x0a,0x20,0x20,0x20,0x20,0x6f,0x66,0x73,0x20,0x3d,0x20,0x76,0x65,0x63,0x32,
+    0x28,0x28,0x6f,0x66,0x73,0x2e,0x78,0x20,0x2a,0x20,0x63,0x73,0x29,0x20,0x2d,0x20,
+    0x28,0x6f,0x66,0x73,0x2e,0x79,0x20,0x2a,0x20,0x73,0x6e,0x29,0x2c,0x20,0x28,0x6f,
+    0x66,0x73,0x2e,0x78,0x20,0x2a,0x20,0x73,0x6e,0x29,0x20,0x2b,0x20,0x28,0x6f,0x66,
+    0x73,0x2e,0x79,0x20,0x2a,0x20,0x63,0x73,0x29,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,
+    0x76,0x65,0x63,0x33,0x20,0x70,0x6f,0x73,0x20,0x3d,0x20,0x28,0x76,0x65,0x63,0x33,
+    0x28,0x5f,0x35,0x2e,0x73,0x70,0x72,0x69,0x74,0x65,0x73,0x5b,0x69,0x64,0x78,0x5d,
+    0x2e,0x78,0x2c,0x20,0x5f,0x35,0x2e,0x73,0x70,0x72,0x69,0x74,0x65,0x73,0x5b,0x69,
+    0x64,0x78,0x5d,0x2e,0x79,0x2c,0x20,0x5f,0x35,0x2e,0x73,0x70,0x72,0x69,0x74,0x65,
+    0x73,0x5b,0x69,0x64,0x78,0x5d,0x2e,0x7a,0x29,0x20,0x2b,0x20,0x28,0x76,0x73,0x5f,
+    0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x34,0x5d,0x2e,0x78,0x79,0x7a,0x20,0x2a,0x20,
+    0x6f,0x66,0x73,0x2e,0x78,0x29,0x29,0x20,0x2b,0x20,0x28,0x76,0x73,0x5f,0x70,0x61,
+    0x72,0x61,0x6d,0x73,0x5b,0x35,0x5d,0x2e,0x78,0x79,0x7a,0x20,0x2a,0x20,0x6f,0x66,
+    0x73,0x2e,0x79,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x67,0x6c,0x5f,0x50,0x6f,0x73,
+    0x69,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x6d,0x61,0x74,0x34,0x28,0x76,0x73,0x5f,
+    0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x30,0x5d,0x2c,0x20,0x76,0x73,0x5f,0x70,0x61,
+    0x72,0x61,0x6d,0x73,0x5b,0x31,0x5d,0x2c,0x20,0x76,0x73,0x5f,0x70,0x61,0x72,0x61,
+    0x6d,0x73,0x5b,0x32,0x5d,0x2c,0x20,0x76,0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,
+    0x5b,0x33,0x5d,0x29,0x20,0x2a,0x20,0x76,0x65,0x63,0x34,0x28,0x70,0x6f,0x73,0x2c,
+    0x20,0x31,0x2e,0x30,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x65,0x63,0x32,0x20,
+    0x75,0x76,0x30,0x20,0x3d,0x20,0x75,0x6e,0x70,0x61,0x63,0x6b,0x55,0x6e,0x6f,0x72,
+    0x6d,0x32,0x78,0x31,0x36,0x28,0x5f,0x35,0x2e,0x73,0x70,0x72,0x69,0x74,0x65,0x73,
+    0x5b,0x69,0x64,0x78,0x5d,0x2e,0x75,0x76,0x30,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,
+    0x76,0x65,0x63,0x32,0x20,0x75,0x76,0x31,0x20,0x3d,0x20,0x75,0x6e,0x70,0x61,0x63,
+    0x6b,0x55,0x6e,0x6f,0x72,0x6d,0x32,0x78,0x31,0x36,0x28,0x5f,0x35,0x2e,0x73,0x70,
+    0x72,0x69,0x74,0x65,0x73,0x5b,0x69,0x64,0x78,0x5d,0x2e,0x75,0x76,0x31,0x29,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x75,0x76,0x20,0x3d,0x20,0x6d,0x69,0x78,0x28,0x75,0x76,
+    0x30,0x2c,0x20,0x75,0x76,0x31,0x2c,0x20,0x76,0x65,0x63,0x32,0x28,0x63,0x2e,0x78,
+    0x20,0x2b,0x20,0x30,0x2e,0x35,0x2c,0x20,0x30,0x2e,0x35,0x20,0x2d,0x20,0x63,0x2e,
+    0x79,0x29,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x63,0x6f,0x6c,0x6f,0x72,0x20,0x3d,
+    0x20,0x75,0x6e,0x70,0x61,0x63,0x6b,0x55,0x6e,0x6f,0x72,0x6d,0x34,0x78,0x38,0x28,
+    0x5f,0x35,0x2e,0x73,0x70,0x72,0x69,0x74,0x65,0x73,0x5b,0x69,0x64,0x78,0x5d,0x2e,
+    0x63,0x6f,0x6c,0x6f,0x72,0x29,0x3b,0x0a,0x7d,0x0a,0x0a,0x00,
+};
+static const uint8_t _ssprite_shd_fs_source_glsl430[219] = {
+    0x23,0x76,0x65,0x72,0x73,0x69,0x6f,0x6e,0x20,0x34,0x33,0x30,0x0a,0x0a,0x75,0x6e,
+    0x69,0x66,0x6f,0x72,0x6d,0x20,0x73,0x61,0x6d,0x70,0x6c,0x65,0x72,0x32,0x44,0x20,
+    0x74,0x65,0x78,0x5f,0x73,0x6d,0x70,0x3b,0x0a,0x0a,0x6c,0x61,0x79,0x6f,0x75,0x74,
+    0x28,0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x30,0x29,0x20,0x6f,
+    0x75,0x74,0x20,0x76,0x65,0x63,0x34,0x20,0x66,0x72,0x61,0x67,0x5f,0x63,0x6f,0x6c,
+    0x6f,0x72,0x3b,0x0a,0x6c,0x61,0x79,0x6f,0x75,0x74,0x28,0x6c,0x6f,0x63,0x61,0x74,
+    0x69,0x6f,0x6e,0x20,0x3d,0x20,0x30,0x29,0x20,0x69,0x6e,0x20,0x76,0x65,0x63,0x32,
+    0x20,0x75,0x76,0x3b,0x0a,0x6c,0x61,0x79,0x6f,0x75,0x74,0x28,0x6c,0x6f,0x63,0x61,
+    0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x31,0x29,0x20,0x69,0x6e,0x20,0x76,0x65,0x63,
+    0x34,0x20,0x63,0x6f,0x6c,0x6f,0x72,0x3b,0x0a,0x0a,0x76,0x6f,0x69,0x64,0x20,0x6d,
+    0x61,0x69,0x6e,0x28,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x66,0x72,0x61,0x67,
+    0x5f,0x63,0x6f,0x6c,0x6f,0x72,0x20,0x3d,0x20,0x74,0x65,0x78,0x74,0x75,0x72,0x65,
+    0x28,0x74,0x65,0x78,0x5f,0x73,0x6d,0x70,0x2c,0x20,0x75,0x76,0x29,0x20,0x2a,0x20,
+    0x63,0x6f,0x6c,0x6f,0x72,0x3b,0x0a,0x7d,0x0a,0x0a,0x00,
+};
+#elif defined(SOKOL_GLES3)
+static const uint8_t _ssprite_shd_vs_source_glsl310es[1231] = {
+    0x23,0x76,0x65,0x72,0x73,0x69,0x6f,0x6e,0x20,0x33,0x31,0x30,0x20,0x65,0x73,0x0a,
+    0x0a,0x73,0x74,0x72,0x75,0x63,0x74,0x20,0x73,0x70,0x72,0x69,0x74,0x65,0x0a,0x7b,
+    0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x78,0x3b,0x0a,0x20,0x20,
+    0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x79,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,
+    0x6c,0x6f,0x61,0x74,0x20,0x7a,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,
+    0x74,0x20,0x72,0x6f,0x74,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,
+    0x20,0x77,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x68,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x75,0x69,0x6e,0x74,0x20,0x75,0x76,0x30,0x3b,0x0a,0x20,
+    0x20,0x20,0x20,0x75,0x69,0x6e,0x74,0x20,0x75,0x76,0x31,0x3b,0x0a,0x20,0x20,0x20,
+    0x20,0x75,0x69,0x6e,0x74,0x20,0x63,0x6f,0x6c,0x6f,0x72,0x3b,0x0a,0x7d,0x3b,0x0a,
+    0x0a,0x63,0x6f,0x6e,0x73,0x74,0x20,0x76,0x65,0x63,0x32,0x20,0x5f,0x35,0x37,0x5b,
+    0x36,0x5d,0x20,0x3d,0x20,0x76,0x65,0x63,0x32,0x5b,0x5d,0x28,0x76,0x65,0x63,0x32,
+    0x28,0x2d,0x30,0x2e,0x35,0x2c,0x20,0x30,0x2e,0x35,0x29,0x2c,0x20,0x76,0x65,0x63,
+    0x32,0x28,0x30,0x2e,0x35,0x29,0x2c,0x20,0x76,0x65,0x63,0x32,0x28,0x30,0x2e,0x35,
+    0x2c,0x20,0x2d,0x30,0x2e,0x35,0x29,0x2c,0x20,0x76,0x65,0x63,0x32,0x28,0x2d,0x30,
+    0x2e,0x35,0x2c,0x20,0x30,0x2e,0x35,0x29,0x2c,0x20,0x76,0x65,0x63,0x32,0x28,0x30,
+    0x2e,0x35,0x2c,0x20,0x2d,0x30,0x2e,0x35,0x29,0x2c,0x20,0x76,0x65,0x63,0x32,0x28,
+    0x2d,0x30,0x2e,0x35,0x29,0x29,0x3b,0x0a,0x0a,0x75,0x6e,0x69,0x66,0x6f,0x72,0x6d,
+    0x20,0x76,0x65,0x63,0x34,0x20,0x76,0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,
+    0x37,0x5d,0x3b,0x0a,0x6c,0x61,0x79,0x6f,0x75,0x74,0x28,0x62,0x69,0x6e,0x64,0x69,
+    0x6e,0x67,0x20,0x3d,0x20,0x30,0x2c,0x20,0x73,0x74,0x64,0x34,0x33,0x30,0x29,0x20,
+    0x72,0x65,0x61,0x64,0x6f,0x6e,0x6c,0x79,0x20,0x62,0x75,0x66,0x66,0x65,0x72,0x20,
+    0x73,0x73,0x70,0x72,0x69,0x74,0x65,0x5f,0x73,0x62,0x75,0x66,0x0a,0x7b,0x0a,0x20,
+    0x20,0x20,0x20,0x73,0x70,0x72,0x69,0x74,0x65,0x20,0x73,0x70,0x72,0x69,0x74,0x65,
+    0x73,0x5b,0x5d,0x3b,0x0a,0x7d,0x20,0x5f,0x35,0x3b,0x0a,0x0a,0x6c,0x61,0x79,0x6f,
+    0x75,0x74,0x28,0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x30,0x29,
+    0x20,0x6f,0x75,0x74,0x20,0x76,0x65,0x63,0x32,0x20,0x75,0x76,0x3b,0x0a,0x6c,0x61,
+    0x79,0x6f,0x75,0x74,0x28,0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,
+    0x31,0x29,0x20,0x6f,0x75,0x74,0x20,0x76,0x65,0x63,0x34,0x20,0x63,0x6f,0x6c,0x6f,
+    0x72,0x3b,0x0a,0x0a,0x76,0x6f,0x69,0x64,0x20,0x6d,0x61,0x69,0x6e,0x28,0x29,0x0a,
+    0x7b,0x0a,0x20,0x20,0x20,0x20,0x69,0x6e,0x74,0x20,0x69,0x64,0x78,0x20,0x3d,0x20,
+    0x67,0x6c,0x5f,0x49,0x6e,0x73,0x74,0x61,0x6e,0x63,0x65,0x49,0x44,0x20,0x2b,0x20,
+    0x69,0x6e,0x74,0x28,0x76,0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x36,0x5d,
+    0x2e,0x78,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x65,0x63,0x32,0x20,0x63,0x20,
+    0x3d,0x20,0x5f,0x35,0x37,0x5b,0x67,0x6c,0x5f,0x56,0x65,0x72,0x74,0x65,0x78,0x49,
+    0x44,0x5d,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x65,0x63,0x32,0x20,0x6f,0x66,0x73,
+    0x20,0x3d,0x20,0x63,0x20,0x2a,0x20,0x76,0x65,0x63,0x32,0x28,0x5f,0x35,0x2e,0x73,
+    0x70,0x72,0x69,0x74,0x65,0x73,0x5b,0x69,0x64,0x78,0x5d,0x2e,0x77,0x2c,0x20,0x5f,
+    0x35,0x2e,0x73,0x70,0x72,0x69,0x74,0x65,0x73,0x5b,0x69,0x64,0x78,0x5d,0x2e,0x68,
+    0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x73,0x6e,0x20,
+    0x3d,0x20,0x73,0x69,0x6e,0x28,0x5f,0x35,0x2e,0x73,0x70,0x72,0x69,0x74,0x65,0x73,
+    0x5b,0x69,0x64,0x78,0x5d,0x2e,0x72,0x6f,0x74,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,
+    0x66,0x6c,0x6f,0x61,0x74,0x20,0x63,0x73,0x20,0x3d,0x20,0x63,0x6f,0x73,0x28,0x5f,
+    0x35,0x2e,0x73,0x70,0x72,0x69,0x74,0x65,0x73,0x5b,0x69,0x64,0x78,0x5d,0x2e,0x72,
+    0x6f,0x74,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x6f,0x66,0x73,0x20,0x3d,0x20,0x76,
+    0x65,0x63,0x32,0x28,0x28,0x6f,0x66,0x73,0x2e,0x78,0x20,0x2a,0x20,0x63,0x73,0x29,
+    0x20,0x2d,0x20,0x28,0x6f,0x66,0x73,0x2e,0x79,0x20,0x2a,0x20,0x73,0x6e,0x29,0x2c,
+    0x20,0x28,0x6f,0x66,0x73,0x2e,0x78,0x20,0x2a,0x20,0x73,0x6e,0x29,0x20,0x2b,0x20,
+    0x28,0x6f,0x66,0x73,0x2e,0x79,0x20,0x2a,0x20,0x63,0x73,0x29,0x29,0x3b,0x0a,0x20,
+    0x20,0x20,0x20,0x76,0x65,0x63,0x33,0x20,0x70,0x6f,0x73,0x20,0x3d,0x20,0x28,0x76,
+    0x65,0x63,0x33,0x28,0x5f,0x35,0x2e,0x73,0x70,0x72,0x69,0x74,0x65,0x73,0x5b,0x69,
+    0x64,0x78,0x5d,0x2e,0x78,0x2c,0x20,0x5f,0x35,0x2e,0x73,0x70,0x72,0x69,0x74,0x65,
+    0x73,0x5b,0x69,0x64,0x78,0x5d,0x2e,0x79,0x2c,0x20,0x5f,0x35,0x2e,0x73,0x70,0x72,
+    0x69,0x74,0x65,0x73,0x5b,0x69,0x64,0x78,0x5d,0x2e,0x7a,0x29,0x20,0x2b,0x20,0x28,
+    0x76,0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x34,0x5d,0x2e,0x78,0x79,0x7a,
+    0x20,0x2a,0x20,0x6f,0x66,0x73,0x2e,0x78,0x29,0x29,0x20,0x2b,0x20,0x28,0x76,0x73,
+    0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x35,0x5d,0x2e,0x78,0x79,0x7a,0x20,0x2a,
+    0x20,0x6f,0x66,0x73,0x2e,0x79,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x67,0x6c,0x5f,
+    0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x6d,0x61,0x74,0x34,0x28,
+    0x76,0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x30,0x5d,0x2c,0x20,0x76,0x73,
+    0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x31,0x5d,0x2c,0x20,0x76,0x73,0x5f,0x70,
+    0x61,0x72,0x61,0x6d,0x73,0x5b,0x32,0x5d,0x2c,0x20,0x76,0x73,0x5f,0x70,0x61,0x72,
+    0x61,0x6d,0x73,0x5b,0x33,0x5d,0x29,0x20,0x2a,0x20,0x76,0x65,0x63,0x34,0x28,0x70,
+    0x6f,0x73,0x2c,0x20,0x31,0x2e,0x30,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x65,
+    0x63,0x32,0x20,0x75,0x76,0x30,0x20,0x3d,0x20,0x75,0x6e,0x70,0x61,0x63,0x6b,0x55,
+    0x6e,0x6f,0x72,0x6d,0x32,0x78,0x31,0x36,0x28,0x5f,0x35,0x2e,0x73,0x70,0x72,0x69,
+    0x74,0x65,0x73,0x5b,0x69,0x64,0x78,0x5d,0x2e,0x75,0x76,0x30,0x29,0x3b,0x0a,0x20,
+    0x20,0x20,0x20,0x76,0x65,0x63,0x32,0x20,0x75,0x76,0x31,0x20,0x3d,0x20,0x75,0x6e,
+    0x70,0x61,0x63,0x6b,0x55,0x6e,0x6f,0x72,0x6d,0x32,0x78,0x31,0x36,0x28,0x5f,0x35,
+    0x2e,0x73,0x70,0x72,0x69,0x74,0x65,0x73,0x5b,0x69,0x64,0x78,0x5d,0x2e,0x75,0x76,
+    0x31,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x75,0x76,0x20,0x3d,0x20,0x6d,0x69,0x78,
+    0x28,0x75,0x76,0x30,0x2c,0x20,0x75,0x76,0x31,0x2c,0x20,0x76,0x65,0x63,0x32,0x28,
+    0x63,0x2e,0x78,0x20,0x2b,0x20,0x30,0x2e,0x35,0x2c,0x20,0x30,0x2e,0x35,0x20,0x2d,
+    0x20,0x63,0x2e,0x79,0x29,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x63,0x6f,0x6c,0x6f,
+    0x72,0x20,0x3d,0x20,0x75,0x6e,0x70,0x61,0x63,0x6b,0x55,0x6e,0x6f,0x72,0x6d,0x34,
+    0x78,0x38,0x28,0x5f,0x35,0x2e,0x73,0x70,0x72,0x69,0x74,0x65,0x73,0x5b,0x69,0x64,
+    0x78,0x5d,0x2e,0x63,0x6f,0x6c,0x6f,0x72,0x29,0x3b,0x0a,0x7d,0x0a,0x0a,0x00,
+};
+static const uint8_t _ssprite_shd_fs_source_glsl310es[292] = {
+    0x23,0x76,0x65,0x72,0x73,0x69,0x6f,0x6e,0x20,0x33,0x31,0x30,0x20,0x65,0x73,0x0a,
+    0x70,0x72,0x65,0x63,0x69,0x73,0x69,0x6f,0x6e,0x20,0x6d,0x65,0x64,0x69,0x75,0x6d,
+    0x70,0x20,0x66,0x6c,0x6f,0x61,0x74,0x3b,0x0a,0x70,0x72,0x65,0x63,0x69,0x73,0x69,
+    0x6f,0x6e,0x20,0x68,0x69,0x67,0x68,0x70,0x20,0x69,0x6e,0x74,0x3b,0x0a,0x0a,0x75,
+    0x6e,0x69,0x66,0x6f,0x72,0x6d,0x20,0x68,0x69,0x67,0x68,0x70,0x20,0x73,0x61,0x6d,
+    0x70,0x6c,0x65,0x72,0x32,0x44,0x20,0x74,0x65,0x78,0x5f,0x73,0x6d,0x70,0x3b,0x0a,
+    0x0a,0x6c,0x61,0x79,0x6f,0x75,0x74,0x28,0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,
+    0x20,0x3d,0x20,0x30,0x29,0x20,0x6f,0x75,0x74,0x20,0x68,0x69,0x67,0x68,0x70,0x20,
+    0x76,0x65,0x63,0x34,0x20,0x66,0x72,0x61,0x67,0x5f,0x63,0x6f,0x6c,0x6f,0x72,0x3b,
+    0x0a,0x6c,0x61,0x79,0x6f,0x75,0x74,0x28,0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,
+    0x20,0x3d,0x20,0x30,0x29,0x20,0x69,0x6e,0x20,0x68,0x69,0x67,0x68,0x70,0x20,0x76,
+    0x65,0x63,0x32,0x20,0x75,0x76,0x3b,0x0a,0x6c,0x61,0x79,0x6f,0x75,0x74,0x28,0x6c,
+    0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x31,0x29,0x20,0x69,0x6e,0x20,
+    0x68,0x69,0x67,0x68,0x70,0x20,0x76,0x65,0x63,0x34,0x20,0x63,0x6f,0x6c,0x6f,0x72,
+    0x3b,0x0a,0x0a,0x76,0x6f,0x69,0x64,0x20,0x6d,0x61,0x69,0x6e,0x28,0x29,0x0a,0x7b,
+    0x0a,0x20,0x20,0x20,0x20,0x66,0x72,0x61,0x67,0x5f,0x63,0x6f,0x6c,0x6f,0x72,0x20,
+    0x3d,0x20,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x28,0x74,0x65,0x78,0x5f,0x73,0x6d,
+    0x70,0x2c,0x20,0x75,0x76,0x29,0x20,0x2a,0x20,0x63,0x6f,0x6c,0x6f,0x72,0x3b,0x0a,
+    0x7d,0x0a,0x0a,0x00,
+};
+#elif defined(SOKOL_METAL)
+static const uint8_t _ssprite_shd_vs_source_metal_macos[1593] = {
+    0x23,0x69,0x6e,0x63,0x6c,0x75,0x64,0x65,0x20,0x3c,0x6d,0x65,0x74,0x61,0x6c,0x5f,
+    0x73,0x74,0x64,0x6c,0x69,0x62,0x3e,0x0a,0x23,0x69,0x6e,0x63,0x6c,0x75,0x64,0x65,
+    0x20,0x3c,0x73,0x69,0x6d,0x64,0x2f,0x73,0x69,0x6d,0x64,0x2e,0x68,0x3e,0x0a,0x0a,
+    0x75,0x73,0x69,0x6e,0x67,0x20,0x6e,0x61,0x6d,0x65,0x73,0x70,0x61,0x63,0x65,0x20,
+    0x6d,0x65,0x74,0x61,0x6c,0x3b,0x0a,0x0a,0x73,0x74,0x72,0x75,0x63,0x74,0x20,0x76,
+    0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x66,
+    0x6c,0x6f,0x61,0x74,0x34,0x78,0x34,0x20,0x6d,0x76,0x70,0x3b,0x0a,0x20,0x20,0x20,
+    0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x72,0x69,0x67,0x68,0x74,0x3b,0x0a,0x20,
+    0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x75,0x70,0x3b,0x0a,0x20,0x20,
+    0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x6d,0x69,0x73,0x63,0x3b,0x0a,0x7d,
+    0x3b,0x0a,0x0a,0x73,0x74,0x72,0x75,0x63,0x74,0x20,0x73,0x70,0x72,0x69,0x74,0x65,
+    0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x78,0x3b,0x0a,
+    0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x79,0x3b,0x0a,0x20,0x20,0x20,
+    0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x7a,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,
+    0x6f,0x61,0x74,0x20,0x72,0x6f,0x74,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,
+    0x61,0x74,0x20,0x77,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,
+    0x68,0x3b,0x0a,0x20,0x20,0x20,0x20,0x75,0x69,0x6e,0x74,0x20,0x75,0x76,0x30,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x75,0x69,0x6e,0x74,0x20,0x75,0x76,0x31,0x3b,0x0a,0x20,
+    0x20,0x20,0x20,0x75,0x69,0x6e,0x74,0x20,0x63,0x6f,0x6c,0x6f,0x72,0x3b,0x0a,0x7d,
+    0x3b,0x0a,0x0a,0x73,0x74,0x72,0x75,0x63,0x74,0x20,0x73,0x73,0x70,0x72,0x69,0x74,
+    0x65,0x5f,0x73,0x62,0x75,0x66,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x73,0x70,0x72,
+    0x69,0x74,0x65,0x20,0x73,0x70,0x72,0x69,0x74,0x65,0x73,0x5b,0x31,0x5d,0x3b,0x0a,
+    0x7d,0x3b,0x0a,0x0a,0x63,0x6f,0x6e,0x73,0x74,0x61,0x6e,0x74,0x20,0x66,0x6c,0x6f,
+    0x61,0x74,0x32,0x20,0x5f,0x35,0x37,0x5b,0x36,0x5d,0x20,0x3d,0x20,0x7b,0x20,0x66,
+    0x6c,0x6f,0x61,0x74,0x32,0x28,0x2d,0x30,0x2e,0x35,0x2c,0x20,0x30,0x2e,0x35,0x29,
+    0x2c,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x28,0x30,0x2e,0x35,0x29,0x2c,0x20,0x66,
+    0x6c,0x6f,0x61,0x74,0x32,0x28,0x30,0x2e,0x35,0x2c,0x20,0x2d,0x30,0x2e,0x35,0x29,
+    0x2c,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x28,0x2d,0x30,0x2e,0x35,0x2c,0x20,0x30,
+    0x2e,0x35,0x29,0x2c,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x28,0x30,0x2e,0x35,0x2c,
+    0x20,0x2d,0x30,0x2e,0x35,0x29,0x2c,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x28,0x2d,
+    0x30,0x2e,0x35,0x29,0x20,0x7d,0x3b,0x0a,0x0a,0x73,0x74,0x72,0x75,0x63,0x74,0x20,
+    0x6d,0x61,0x69,0x6e,0x30,0x5f,0x6f,0x75,0x74,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,
+    0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x75,0x76,0x20,0x5b,0x5b,0x75,0x73,0x65,0x72,
+    0x28,0x6c,0x6f,0x63,0x6e,0x30,0x29,0x5d,0x5d,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,
+    0x6c,0x6f,0x61,0x74,0x34,0x20,0x63,0x6f,0x6c,0x6f,0x72,0x20,0x5b,0x5b,0x75,0x73,
+    0x65,0x72,0x28,0x6c,0x6f,0x63,0x6e,0x31,0x29,0x5d,0x5d,0x3b,0x0a,0x20,0x20,0x20,
+    0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x67,0x6c,0x5f,0x50,0x6f,0x73,0x69,0x74,
+    0x69,0x6f,0x6e,0x20,0x5b,0x5b,0x70,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x5d,0x5d,
+    0x3b,0x0a,0x7d,0x3b,0x0a,0x0a,0x76,0x65,0x72,0x74,0x65,0x78,0x20,0x6d,0x61,0x69,
+    0x6e,0x30,0x5f,0x6f,0x75,0x74,0x20,0x6d,0x61,0x69,0x6e,0x30,0x28,0x63,0x6f,0x6e,
+    0x73,0x74,0x61,0x6e,0x74,0x20,0x76,0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x26,
+    0x20,0x5f,0x34,0x20,0x5b,0x5b,0x62,0x75,0x66,0x66,0x65,0x72,0x28,0x30,0x29,0x5d,
+    0x5d,0x2c,0x20,0x63,0x6f,0x6e,0x73,0x74,0x20,0x64,0x65,0x76,0x69,0x63,0x65,0x20,
+    0x73,0x73,0x70,0x72,0x69,0x74,0x65,0x5f,0x73,0x62,0x75,0x66,0x26,0x20,0x5f,0x35,
+    0x20,0x5b,0x5b,0x62,0x75,0x66,0x66,0x65,0x72,0x28,0x38,0x29,0x5d,0x5d,0x2c,0x20,
+    0x75,0x69,0x6e,0x74,0x20,0x67,0x6c,0x5f,0x56,0x65,0x72,0x74,0x65,0x78,0x49,0x6e,
+    0x64,0x65,0x78,0x20,0x5b,0x5b,0x76,0x65,0x72,0x74,0x65,0x78,0x5f,0x69,0x64,0x5d,
+    0x5d,0x2c,0x20,0x75,0x69,0x6e,0x74,0x20,0x67,0x6c,0x5f,0x49,0x6e,0x73,0x74,0x61,
+    0x6e,0x63,0x65,0x49,0x6e,0x64,0x65,0x78,0x20,0x5b,0x5b,0x69,0x6e,0x73,0x74,0x61,
+    0x6e,0x63,0x65,0x5f,0x69,0x64,0x5d,0x5d,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,
+    0x6d,0x61,0x69,0x6e,0x30,0x5f,0x6f,0x75,0x74,0x20,0x6f,0x75,0x74,0x20,0x3d,0x20,
+    0x7b,0x7d,0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,0x6e,0x74,0x20,0x69,0x64,0x78,0x20,
+    0x3d,0x20,0x69,0x6e,0x74,0x28,0x67,0x6c,0x5f,0x49,0x6e,0x73,0x74,0x61,0x6e,0x63,
+    0x65,0x49,0x6e,0x64,0x65,0x78,0x29,0x20,0x2b,0x20,0x69,0x6e,0x74,0x28,0x5f,0x34,
+    0x2e,0x6d,0x69,0x73,0x63,0x2e,0x78,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,
+    0x6f,0x61,0x74,0x32,0x20,0x63,0x20,0x3d,0x20,0x5f,0x35,0x37,0x5b,0x69,0x6e,0x74,
+    0x28,0x67,0x6c,0x5f,0x56,0x65,0x72,0x74,0x65,0x78,0x49,0x6e,0x64,0x65,0x78,0x29,
+    0x5d,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x6f,0x66,
+    0x73,0x20,0x3d,0x20,0x63,0x20,0x2a,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x28,0x5f,
+    0x35,0x2e,0x73,0x70,0x72,0x69,0x74,0x65,0x73,0x5b,0x69,0x64,0x78,0x5d,0x2e,0x77,
+    0x2c,0x20,0x5f,0x35,0x2e,0x73,0x70,0x72,0x69,0x74,0x65,0x73,0x5b,0x69,0x64,0x78,
+    0x5d,0x2e,0x68,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,
+    0x73,0x6e,0x20,0x3d,0x20,0x73,0x69,0x6e,0x28,0x5f,0x35,0x2e,0x73,0x70,0x72,0x69,
+    0x74,0x65,0x73,0x5b,0x69,0x64,0x78,0x5d,0x2e,0x72,0x6f,0x74,0x29,0x3b,0x0a,0x20,
+    0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x63,0x73,0x20,0x3d,0x20,0x63,0x6f,
+    0x73,0x28,0x5f,0x35,0x2e,0x73,0x70,0x72,0x69,0x74,0x65,0x73,0x5b,0x69,0x64,0x78,
+    0x5d,0x2e,0x72,0x6f,0x74,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x6f,0x66,0x73,0x20,
+    0x3d,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x28,0x28,0x6f,0x66,0x73,0x2e,0x78,0x20,
+    0x2a,0x20,0x63,0x73,0x29,0x20,0x2d,0x20,0x28,0x6f,0x66,0x73,0x2e,0x79,0x20,0x2a,
+    0x20,0x73,0x6e,0x29,0x2c,0x20,0x28,0x6f,0x66,0x73,0x2e,0x78,0x20,0x2a,0x20,0x73,
+    0x6e,0x29,0x20,0x2b,0x20,0x28,0x6f,0x66,0x73,0x2e,0x79,0x20,0x2a,0x20,0x63,0x73,
+    0x29,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,0x70,
+    0x6f,0x73,0x20,0x3d,0x20,0x28,0x66,0x6c,0x6f,0x61,0x74,0x33,0x28,0x5f,0x35,0x2e,
+    0x73,0x70,0x72,0x69,0x74,0x65,0x73,0x5b,0x69,0x64,0x78,0x5d,0x2e,0x78,0x2c,0x20,
+    0x5f,0x35,0x2e,0x73,0x70,0x72,0x69,0x74,0x65,0x73,0x5b,0x69,0x64,0x78,0x5d,0x2e,
+    0x79,0x2c,0x20,0x5f,0x35,0x2e,0x73,0x70,0x72,0x69,0x74,0x65,0x73,0x5b,0x69,0x64,
+    0x78,0x5d,0x2e,0x7a,0x29,0x20,0x2b,0x20,0x28,0x5f,0x34,0x2e,0x72,0x69,0x67,0x68,
+    0x74,0x2e,0x78,0x79,0x7a,0x20,0x2a,0x20,0x6f,0x66,0x73,0x2e,0x78,0x29,0x29,0x20,
+    0x2b,0x20,0x28,0x5f,0x34,0x2e,0x75,0x70,0x2e,0x78,0x79,0x7a,0x20,0x2a,0x20,0x6f,
+    0x66,0x73,0x2e,0x79,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x6f,0x75,0x74,0x2e,0x67,
+    0x6c,0x5f,0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x5f,0x34,0x2e,
+    0x6d,0x76,0x70,0x20,0x2a,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x28,0x70,0x6f,0x73,
+    0x2c,0x20,0x31,0x2e,0x30,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,
+    0x74,0x32,0x20,0x75,0x76,0x30,0x20,0x3d,0x20,0x75,0x6e,0x70,0x61,0x63,0x6b,0x5f,
+    0x75,0x6e,0x6f,0x72,0x6d,0x32,0x78,0x31,0x36,0x5f,0x74,0x6f,0x5f,0x66,0x6c,0x6f,
+    0x61,0x74,0x28,0x5f,0x35,0x2e,0x73,0x70,0x72,0x69,0x74,0x65,0x73,0x5b,0x69,0x64,
+    0x78,0x5d,0x2e,0x75,0x76,0x30,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,
+    0x61,0x74,0x32,0x20,0x75,0x76,0x31,0x20,0x3d,0x20,0x75,0x6e,0x70,0x61,0x63,0x6b,
+    0x5f,0x75,0x6e,0x6f,0x72,0x6d,0x32,0x78,0x31,0x36,0x5f,0x74,0x6f,0x5f,0x66,0x6c,
+    0x6f,0x61,0x74,0x28,0x5f,0x35,0x2e,0x73,0x70,0x72,0x69,0x74,0x65,0x73,0x5b,0x69,
+    0x64,0x78,0x5d,0x2e,0x75,0x76,0x31,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x6f,0x75,
+    0x74,0x2e,0x75,0x76,0x20,0x3d,0x20,0x6d,0x69,0x78,0x28,0x75,0x76,0x30,0x2c,0x20,
+    0x75,0x76,0x31,0x2c,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x28,0x63,0x2e,0x78,0x20,
+    0x2b,0x20,0x30,0x2e,0x35,0x2c,0x20,0x30,0x2e,0x35,0x20,0x2d,0x20,0x63,0x2e,0x79,
+    0x29,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x6f,0x75,0x74,0x2e,0x63,0x6f,0x6c,0x6f,
+    0x72,0x20,0x3d,0x20,0x75,0x6e,0x70,0x61,0x63,0x6b,0x5f,0x75,0x6e,0x6f,0x72,0x6d,
+    0x34,0x78,0x38,0x5f,0x74,0x6f,0x5f,0x66,0x6c,0x6f,0x61,0x74,0x28,0x5f,0x35,0x2e,
+    0x73,0x70,0x72,0x69,0x74,0x65,0x73,0x5b,0x69,0x64,0x78,0x5d,0x2e,0x63,0x6f,0x6c,
+    0x6f,0x72,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,
+    0x6f,0x75,0x74,0x3b,0x0a,0x7d,0x0a,0x0a,0x00,
+};
+static const uint8_t _ssprite_shd_fs_source_metal_macos[436] = {
+    0x23,0x69,0x6e,0x63,0x6c,0x75,0x64,0x65,0x20,0x3c,0x6d,0x65,0x74,0x61,0x6c,0x5f,
+    0x73,0x74,0x64,0x6c,0x69,0x62,0x3e,0x0a,0x23,0x69,0x6e,0x63,0x6c,0x75,0x64,0x65,
+    0x20,0x3c,0x73,0x69,0x6d,0x64,0x2f,0x73,0x69,0x6d,0x64,0x2e,0x68,0x3e,0x0a,0x0a,
+    0x75,0x73,0x69,0x6e,0x67,0x20,0x6e,0x61,0x6d,0x65,0x73,0x70,0x61,0x63,0x65,0x20,
+    0x6d,0x65,0x74,0x61,0x6c,0x3b,0x0a,0x0a,0x73,0x74,0x72,0x75,0x63,0x74,0x20,0x6d,
+    0x61,0x69,0x6e,0x30,0x5f,0x6f,0x75,0x74,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x66,
+    0x6c,0x6f,0x61,0x74,0x34,0x20,0x66,0x72,0x61,0x67,0x5f,0x63,0x6f,0x6c,0x6f,0x72,
+    0x20,0x5b,0x5b,0x63,0x6f,0x6c,0x6f,0x72,0x28,0x30,0x29,0x5d,0x5d,0x3b,0x0a,0x7d,
+    0x3b,0x0a,0x0a,0x73,0x74,0x72,0x75,0x63,0x74,0x20,0x6d,0x61,0x69,0x6e,0x30,0x5f,
+    0x69,0x6e,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,
+    0x75,0x76,0x20,0x5b,0x5b,0x75,0x73,0x65,0x72,0x28,0x6c,0x6f,0x63,0x6e,0x30,0x29,
+    0x5d,0x5d,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x63,
+    0x6f,0x6c,0x6f,0x72,0x20,0x5b,0x5b,0x75,0x73,0x65,0x72,0x28,0x6c,0x6f,0x63,0x6e,
+    0x31,0x29,0x5d,0x5d,0x3b,0x0a,0x7d,0x3b,0x0a,0x0a,0x66,0x72,0x61,0x67,0x6d,0x65,
+    0x6e,0x74,0x20,0x6d,0x61,0x69,0x6e,0x30,0x5f,0x6f,0x75,0x74,0x20,0x6d,0x61,0x69,
+    0x6e,0x30,0x28,0x6d,0x61,0x69,0x6e,0x30,0x5f,0x69,0x6e,0x20,0x69,0x6e,0x20,0x5b,
+    0x5b,0x73,0x74,0x61,0x67,0x65,0x5f,0x69,0x6e,0x5d,0x5d,0x2c,0x20,0x74,0x65,0x78,
+    0x74,0x75,0x72,0x65,0x32,0x64,0x3c,0x66,0x6c,0x6f,0x61,0x74,0x3e,0x20,0x74,0x65,
+    0x78,0x20,0x5b,0x5b,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x28,0x30,0x29,0x5d,0x5d,
+    0x2c,0x20,0x73,0x61,0x6d,0x70,0x6c,0x65,0x72,0x20,0x73,0x6d,0x70,0x20,0x5b,0x5b,
+    0x73,0x61,0x6d,0x70,0x6c,0x65,0x72,0x28,0x30,0x29,0x5d,0x5d,0x29,0x0a,0x7b,0x0a,
+    0x20,0x20,0x20,0x20,0x6d,0x61,0x69,0x6e,0x30,0x5f,0x6f,0x75,0x74,0x20,0x6f,0x75,
+    0x74,0x20,0x3d,0x20,0x7b,0x7d,0x3b,0x0a,0x20,0x20,0x20,0x20,0x6f,0x75,0x74,0x2e,
+    0x66,0x72,0x61,0x67,0x5f,0x63,0x6f,0x6c,0x6f,0x72,0x20,0x3d,0x20,0x74,0x65,0x78,
+    0x2e,0x73,0x61,0x6d,0x70,0x6c,0x65,0x28,0x73,0x6d,0x70,0x2c,0x20,0x69,0x6e,0x2e,
+    0x75,0x76,0x29,0x20,0x2a,0x20,0x69,0x6e,0x2e,0x63,0x6f,0x6c,0x6f,0x72,0x3b,0x0a,
+    0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x6f,0x75,0x74,0x3b,0x0a,
+    0x7d,0x0a,0x0a,0x00,
+};
+static const uint8_t _ssprite_shd_vs_source_metal_ios[1593] = {
+    0x23,0x69,0x6e,0x63,0x6c,0x75,0x64,0x65,0x20,0x3c,0x6d,0x65,0x74,0x61,0x6c,0x5f,
+    0x73,0x74,0x64,0x6c,0x69,0x62,0x3e,0x0a,0x23,0x69,0x6e,0x63,0x6c,0x75,0x64,0x65,
+    0x20,0x3c,0x73,0x69,0x6d,0x64,0x2f,0x73,0x69,0x6d,0x64,0x2e,0x68,0x3e,0x0a,0x0a,
+    0x75,0x73,0x69,0x6e,0x67,0x20,0x6e,0x61,0x6d,0x65,0x73,0x70,0x61,0x63,0x65,0x20,
+    0x6d,0x65,0x74,0x61,0x6c,0x3b,0x0a,0x0a,0x73,0x74,0x72,0x75,0x63,0x74,0x20,0x76,
+    0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x66,
+    0x6c,0x6f,0x61,0x74,0x34,0x78,0x34,0x20,0x6d,0x76,0x70,0x3b,0x0a,0x20,0x20,0x20,
+    0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x72,0x69,0x67,0x68,0x74,0x3b,0x0a,0x20,
+    0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x75,0x70,0x3b,0x0a,0x20,0x20,
+    0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x6d,0x69,0x73,0x63,0x3b,0x0a,0x7d,
+    0x3b,0x0a,0x0a,0x73,0x74,0x72,0x75,0x63,0x74,0x20,0x73,0x70,0x72,0x69,0x74,0x65,
+    0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x78,0x3b,0x0a,
+    0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x79,0x3b,0x0a,0x20,0x20,0x20,
+    0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x7a,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,
+    0x6f,0x61,0x74,0x20,0x72,0x6f,0x74,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,
+    0x61,0x74,0x20,0x77,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,
+    0x68,0x3b,0x0a,0x20,0x20,0x20,0x20,0x75,0x69,0x6e,0x74,0x20,0x75,0x76,0x30,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x75,0x69,0x6e,0x74,0x20,0x75,0x76,0x31,0x3b,0x0a,0x20,
+    0x20,0x20,0x20,0x75,0x69,0x6e,0x74,0x20,0x63,0x6f,0x6c,0x6f,0x72,0x3b,0x0a,0x7d,
+    0x3b,0x0a,0x0a,0x73,0x74,0x72,0x75,0x63,0x74,0x20,0x73,0x73,0x70,0x72,0x69,0x74,
+    0x65,0x5f,0x73,0x62,0x75,0x66,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x73,0x70,0x72,
+    0x69,0x74,0x65,0x20,0x73,0x70,0x72,0x69,0x74,0x65,0x73,0x5b,0x31,0x5d,0x3b,0x0a,
+    0x7d,0x3b,0x0a,0x0a,0x63,0x6f,0x6e,0x73,0x74,0x61,0x6e,0x74,0x20,0x66,0x6c,0x6f,
+    0x61,0x74,0x32,0x20,0x5f,0x35,0x37,0x5b,0x36,0x5d,0x20,0x3d,0x20,0x7b,0x20,0x66,
+    0x6c,0x6f,0x61,0x74,0x32,0x28,0x2d,0x30,0x2e,0x35,0x2c,0x20,0x30,0x2e,0x35,0x29,
+    0x2c,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x28,0x30,0x2e,0x35,0x29,0x2c,0x20,0x66,
+    0x6c,0x6f,0x61,0x74,0x32,0x28,0x30,0x2e,0x35,0x2c,0x20,0x2d,0x30,0x2e,0x35,0x29,
+    0x2c,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x28,0x2d,0x30,0x2e,0x35,0x2c,0x20,0x30,
+    0x2e,0x35,0x29,0x2c,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x28,0x30,0x2e,0x35,0x2c,
+    0x20,0x2d,0x30,0x2e,0x35,0x29,0x2c,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x28,0x2d,
+    0x30,0x2e,0x35,0x29,0x20,0x7d,0x3b,0x0a,0x0a,0x73,0x74,0x72,0x75,0x63,0x74,0x20,
+    0x6d,0x61,0x69,0x6e,0x30,0x5f,0x6f,0x75,0x74,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,
+    0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x75,0x76,0x20,0x5b,0x5b,0x75,0x73,0x65,0x72,
+    0x28,0x6c,0x6f,0x63,0x6e,0x30,0x29,0x5d,0x5d,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,
+    0x6c,0x6f,0x61,0x74,0x34,0x20,0x63,0x6f,0x6c,0x6f,0x72,0x20,0x5b,0x5b,0x75,0x73,
+    0x65,0x72,0x28,0x6c,0x6f,0x63,0x6e,0x31,0x29,0x5d,0x5d,0x3b,0x0a,0x20,0x20,0x20,
+    0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x67,0x6c,0x5f,0x50,0x6f,0x73,0x69,0x74,
+    0x69,0x6f,0x6e,0x20,0x5b,0x5b,0x70,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x5d,0x5d,
+    0x3b,0x0a,0x7d,0x3b,0x0a,0x0a,0x76,0x65,0x72,0x74,0x65,0x78,0x20,0x6d,0x61,0x69,
+    0x6e,0x30,0x5f,0x6f,0x75,0x74,0x20,0x6d,0x61,0x69,0x6e,0x30,0x28,0x63,0x6f,0x6e,
+    0x73,0x74,0x61,0x6e,0x74,0x20,0x76,0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x26,
+    0x20,0x5f,0x34,0x20,0x5b,0x5b,0x62,0x75,0x66,0x66,0x65,0x72,0x28,0x30,0x29,0x5d,
+    0x5d,0x2c,0x20,0x63,0x6f,0x6e,0x73,0x74,0x20,0x64,0x65,0x76,0x69,0x63,0x65,0x20,
+    0x73,0x73,0x70,0x72,0x69,0x74,0x65,0x5f,0x73,0x62,0x75,0x66,0x26,0x20,0x5f,0x35,
+    0x20,0x5b,0x5b,0x62,0x75,0x66,0x66,0x65,0x72,0x28,0x38,0x29,0x5d,0x5d,0x2c,0x20,
+    0x75,0x69,0x6e,0x74,0x20,0x67,0x6c,0x5f,0x56,0x65,0x72,0x74,0x65,0x78,0x49,0x6e,
+    0x64,0x65,0x78,0x20,0x5b,0x5b,0x76,0x65,0x72,0x74,0x65,0x78,0x5f,0x69,0x64,0x5d,
+    0x5d,0x2c,0x20,0x75,0x69,0x6e,0x74,0x20,0x67,0x6c,0x5f,0x49,0x6e,0x73,0x74,0x61,
+    0x6e,0x63,0x65,0x49,0x6e,0x64,0x65,0x78,0x20,0x5b,0x5b,0x69,0x6e,0x73,0x74,0x61,
+    0x6e,0x63,0x65,0x5f,0x69,0x64,0x5d,0x5d,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,
+    0x6d,0x61,0x69,0x6e,0x30,0x5f,0x6f,0x75,0x74,0x20,0x6f,0x75,0x74,0x20,0x3d,0x20,
+    0x7b,0x7d,0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,0x6e,0x74,0x20,0x69,0x64,0x78,0x20,
+    0x3d,0x20,0x69,0x6e,0x74,0x28,0x67,0x6c,0x5f,0x49,0x6e,0x73,0x74,0x61,0x6e,0x63,
+    0x65,0x49,0x6e,0x64,0x65,0x78,0x29,0x20,0x2b,0x20,0x69,0x6e,0x74,0x28,0x5f,0x34,
+    0x2e,0x6d,0x69,0x73,0x63,0x2e,0x78,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,
+    0x6f,0x61,0x74,0x32,0x20,0x63,0x20,0x3d,0x20,0x5f,0x35,0x37,0x5b,0x69,0x6e,0x74,
+    0x28,0x67,0x6c,0x5f,0x56,0x65,0x72,0x74,0x65,0x78,0x49,0x6e,0x64,0x65,0x78,0x29,
+    0x5d,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x6f,0x66,
+    0x73,0x20,0x3d,0x20,0x63,0x20,0x2a,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x28,0x5f,
+    0x35,0x2e,0x73,0x70,0x72,0x69,0x74,0x65,0x73,0x5b,0x69,0x64,0x78,0x5d,0x2e,0x77,
+    0x2c,0x20,0x5f,0x35,0x2e,0x73,0x70,0x72,0x69,0x74,0x65,0x73,0x5b,0x69,0x64,0x78,
+    0x5d,0x2e,0x68,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,
+    0x73,0x6e,0x20,0x3d,0x20,0x73,0x69,0x6e,0x28,0x5f,0x35,0x2e,0x73,0x70,0x72,0x69,
+    0x74,0x65,0x73,0x5b,0x69,0x64,0x78,0x5d,0x2e,0x72,0x6f,0x74,0x29,0x3b,0x0a,0x20,
+    0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x63,0x73,0x20,0x3d,0x20,0x63,0x6f,
+    0x73,0x28,0x5f,0x35,0x2e,0x73,0x70,0x72,0x69,0x74,0x65,0x73,0x5b,0x69,0x64,0x78,
+    0x5d,0x2e,0x72,0x6f,0x74,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x6f,0x66,0x73,0x20,
+    0x3d,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x28,0x28,0x6f,0x66,0x73,0x2e,0x78,0x20,
+    0x2a,0x20,0x63,0x73,0x29,0x20,0x2d,0x20,0x28,0x6f,0x66,0x73,0x2e,0x79,0x20,0x2a,
+    0x20,0x73,0x6e,0x29,0x2c,0x20,0x28,0x6f,0x66,0x73,0x2e,0x78,0x20,0x2a,0x20,0x73,
+    0x6e,0x29,0x20,0x2b,0x20,0x28,0x6f,0x66,0x73,0x2e,0x79,0x20,0x2a,0x20,0x63,0x73,
+    0x29,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,0x70,
+    0x6f,0x73,0x20,0x3d,0x20,0x28,0x66,0x6c,0x6f,0x61,0x74,0x33,0x28,0x5f,0x35,0x2e,
+    0x73,0x70,0x72,0x69,0x74,0x65,0x73,0x5b,0x69,0x64,0x78,0x5d,0x2e,0x78,0x2c,0x20,
+    0x5f,0x35,0x2e,0x73,0x70,0x72,0x69,0x74,0x65,0x73,0x5b,0x69,0x64,0x78,0x5d,0x2e,
+    0x79,0x2c,0x20,0x5f,0x35,0x2e,0x73,0x70,0x72,0x69,0x74,0x65,0x73,0x5b,0x69,0x64,
+    0x78,0x5d,0x2e,0x7a,0x29,0x20,0x2b,0x20,0x28,0x5f,0x34,0x2e,0x72,0x69,0x67,0x68,
+    0x74,0x2e,0x78,0x79,0x7a,0x20,0x2a,0x20,0x6f,0x66,0x73,0x2e,0x78,0x29,0x29,0x20,
+    0x2b,0x20,0x28,0x5f,0x34,0x2e,0x75,0x70,0x2e,0x78,0x79,0x7a,0x20,0x2a,0x20,0x6f,
+    0x66,0x73,0x2e,0x79,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x6f,0x75,0x74,0x2e,0x67,
+    0x6c,0x5f,0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x5f,0x34,0x2e,
+    0x6d,0x76,0x70,0x20,0x2a,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x28,0x70,0x6f,0x73,
+    0x2c,0x20,0x31,0x2e,0x30,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,
+    0x74,0x32,0x20,0x75,0x76,0x30,0x20,0x3d,0x20,0x75,0x6e,0x70,0x61,0x63,0x6b,0x5f,
+    0x75,0x6e,0x6f,0x72,0x6d,0x32,0x78,0x31,0x36,0x5f,0x74,0x6f,0x5f,0x66,0x6c,0x6f,
+    0x61,0x74,0x28,0x5f,0x35,0x2e,0x73,0x70,0x72,0x69,0x74,0x65,0x73,0x5b,0x69,0x64,
+    0x78,0x5d,0x2e,0x75,0x76,0x30,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,
+    0x61,0x74,0x32,0x20,0x75,0x76,0x31,0x20,0x3d,0x20,0x75,0x6e,0x70,0x61,0x63,0x6b,
+    0x5f,0x75,0x6e,0x6f,0x72,0x6d,0x32,0x78,0x31,0x36,0x5f,0x74,0x6f,0x5f,0x66,0x6c,
+    0x6f,0x61,0x74,0x28,0x5f,0x35,0x2e,0x73,0x70,0x72,0x69,0x74,0x65,0x73,0x5b,0x69,
+    0x64,0x78,0x5d,0x2e,0x75,0x76,0x31,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x6f,0x75,
+    0x74,0x2e,0x75,0x76,0x20,0x3d,0x20,0x6d,0x69,0x78,0x28,0x75,0x76,0x30,0x2c,0x20,
+    0x75,0x76,0x31,0x2c,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x28,0x63,0x2e,0x78,0x20,
+    0x2b,0x20,0x30,0x2e,0x35,0x2c,0x20,0x30,0x2e,0x35,0x20,0x2d,0x20,0x63,0x2e,0x79,
+    0x29,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x6f,0x75,0x74,0x2e,0x63,0x6f,0x6c,0x6f,
+    0x72,0x20,0x3d,0x20,0x75,0x6e,0x70,0x61,0x63,0x6b,0x5f,0x75,0x6e,0x6f,0x72,0x6d,
+    0x34,0x78,0x38,0x5f,0x74,0x6f,0x5f,0x66,0x6c,0x6f,0x61,0x74,0x28,0x5f,0x35,0x2e,
+    0x73,0x70,0x72,0x69,0x74,0x65,0x73,0x5b,0x69,0x64,0x78,0x5d,0x2e,0x63,0x6f,0x6c,
+    0x6f,0x72,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,
+    0x6f,0x75,0x74,0x3b,0x0a,0x7d,0x0a,0x0a,0x00,
+};
+static const uint8_t _ssprite_shd_fs_source_metal_ios[436] = {
+    0x23,0x69,0x6e,0x63,0x6c,0x75,0x64,0x65,0x20,0x3c,0x6d,0x65,0x74,0x61,0x6c,0x5f,
+    0x73,0x74,0x64,0x6c,0x69,0x62,0x3e,0x0a,0x23,0x69,0x6e,0x63,0x6c,0x75,0x64,0x65,
+    0x20,0x3c,0x73,0x69,0x6d,0x64,0x2f,0x73,0x69,0x6d,0x64,0x2e,0x68,0x3e,0x0a,0x0a,
+    0x75,0x73,0x69,0x6e,0x67,0x20,0x6e,0x61,0x6d,0x65,0x73,0x70,0x61,0x63,0x65,0x20,
+    0x6d,0x65,0x74,0x61,0x6c,0x3b,0x0a,0x0a,0x73,0x74,0x72,0x75,0x63,0x74,0x20,0x6d,
+    0x61,0x69,0x6e,0x30,0x5f,0x6f,0x75,0x74,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x66,
+    0x6c,0x6f,0x61,0x74,0x34,0x20,0x66,0x72,0x61,0x67,0x5f,0x63,0x6f,0x6c,0x6f,0x72,
+    0x20,0x5b,0x5b,0x63,0x6f,0x6c,0x6f,0x72,0x28,0x30,0x29,0x5d,0x5d,0x3b,0x0a,0x7d,
+    0x3b,0x0a,0x0a,0x73,0x74,0x72,0x75,0x63,0x74,0x20,0x6d,0x61,0x69,0x6e,0x30,0x5f,
+    0x69,0x6e,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,
+    0x75,0x76,0x20,0x5b,0x5b,0x75,0x73,0x65,0x72,0x28,0x6c,0x6f,0x63,0x6e,0x30,0x29,
+    0x5d,0x5d,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x63,
+    0x6f,0x6c,0x6f,0x72,0x20,0x5b,0x5b,0x75,0x73,0x65,0x72,0x28,0x6c,0x6f,0x63,0x6e,
+    0x31,0x29,0x5d,0x5d,0x3b,0x0a,0x7d,0x3b,0x0a,0x0a,0x66,0x72,0x61,0x67,0x6d,0x65,
+    0x6e,0x74,0x20,0x6d,0x61,0x69,0x6e,0x30,0x5f,0x6f,0x75,0x74,0x20,0x6d,0x61,0x69,
+    0x6e,0x30,0x28,0x6d,0x61,0x69,0x6e,0x30,0x5f,0x69,0x6e,0x20,0x69,0x6e,0x20,0x5b,
+    0x5b,0x73,0x74,0x61,0x67,0x65,0x5f,0x69,0x6e,0x5d,0x5d,0x2c,0x20,0x74,0x65,0x78,
+    0x74,0x75,0x72,0x65,0x32,0x64,0x3c,0x66,0x6c,0x6f,0x61,0x74,0x3e,0x20,0x74,0x65,
+    0x78,0x20,0x5b,0x5b,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x28,0x30,0x29,0x5d,0x5d,
+    0x2c,0x20,0x73,0x61,0x6d,0x70,0x6c,0x65,0x72,0x20,0x73,0x6d,0x70,0x20,0x5b,0x5b,
+    0x73,0x61,0x6d,0x70,0x6c,0x65,0x72,0x28,0x30,0x29,0x5d,0x5d,0x29,0x0a,0x7b,0x0a,
+    0x20,0x20,0x20,0x20,0x6d,0x61,0x69,0x6e,0x30,0x5f,0x6f,0x75,0x74,0x20,0x6f,0x75,
+    0x74,0x20,0x3d,0x20,0x7b,0x7d,0x3b,0x0a,0x20,0x20,0x20,0x20,0x6f,0x75,0x74,0x2e,
+    0x66,0x72,0x61,0x67,0x5f,0x63,0x6f,0x6c,0x6f,0x72,0x20,0x3d,0x20,0x74,0x65,0x78,
+    0x2e,0x73,0x61,0x6d,0x70,0x6c,0x65,0x28,0x73,0x6d,0x70,0x2c,0x20,0x69,0x6e,0x2e,
+    0x75,0x76,0x29,0x20,0x2a,0x20,0x69,0x6e,0x2e,0x63,0x6f,0x6c,0x6f,0x72,0x3b,0x0a,
+    0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x6f,0x75,0x74,0x3b,0x0a,
+    0x7d,0x0a,0x0a,0x00,
+};
+static const uint8_t _ssprite_shd_vs_source_metal_sim[1593] = {
+    0x23,0x69,0x6e,0x63,0x6c,0x75,0x64,0x65,0x20,0x3c,0x6d,0x65,0x74,0x61,0x6c,0x5f,
+    0x73,0x74,0x64,0x6c,0x69,0x62,0x3e,0x0a,0x23,0x69,0x6e,0x63,0x6c,0x75,0x64,0x65,
+    0x20,0x3c,0x73,0x69,0x6d,0x64,0x2f,0x73,0x69,0x6d,0x64,0x2e,0x68,0x3e,0x0a,0x0a,
+    0x75,0x73,0x69,0x6e,0x67,0x20,0x6e,0x61,0x6d,0x65,0x73,0x70,0x61,0x63,0x65,0x20,
+    0x6d,0x65,0x74,0x61,0x6c,0x3b,0x0a,0x0a,0x73,0x74,0x72,0x75,0x63,0x74,0x20,0x76,
+    0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x66,
+    0x6c,0x6f,0x61,0x74,0x34,0x78,0x34,0x20,0x6d,0x76,0x70,0x3b,0x0a,0x20,0x20,0x20,
+    0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x72,0x69,0x67,0x68,0x74,0x3b,0x0a,0x20,
+    0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x75,0x70,0x3b,0x0a,0x20,0x20,
+    0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x6d,0x69,0x73,0x63,0x3b,0x0a,0x7d,
+    0x3b,0x0a,0x0a,0x73,0x74,0x72,0x75,0x63,0x74,0x20,0x73,0x70,0x72,0x69,0x74,0x65,
+    0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x78,0x3b,0x0a,
+    0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x79,0x3b,0x0a,0x20,0x20,0x20,
+    0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x7a,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,
+    0x6f,0x61,0x74,0x20,0x72,0x6f,0x74,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,
+    0x61,0x74,0x20,0x77,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,
+    0x68,0x3b,0x0a,0x20,0x20,0x20,0x20,0x75,0x69,0x6e,0x74,0x20,0x75,0x76,0x30,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x75,0x69,0x6e,0x74,0x20,0x75,0x76,0x31,0x3b,0x0a,0x20,
+    0x20,0x20,0x20,0x75,0x69,0x6e,0x74,0x20,0x63,0x6f,0x6c,0x6f,0x72,0x3b,0x0a,0x7d,
+    0x3b,0x0a,0x0a,0x73,0x74,0x72,0x75,0x63,0x74,0x20,0x73,0x73,0x70,0x72,0x69,0x74,
+    0x65,0x5f,0x73,0x62,0x75,0x66,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x73,0x70,0x72,
+    0x69,0x74,0x65,0x20,0x73,0x70,0x72,0x69,0x74,0x65,0x73,0x5b,0x31,0x5d,0x3b,0x0a,
+    0x7d,0x3b,0x0a,0x0a,0x63,0x6f,0x6e,0x73,0x74,0x61,0x6e,0x74,0x20,0x66,0x6c,0x6f,
+    0x61,0x74,0x32,0x20,0x5f,0x35,0x37,0x5b,0x36,0x5d,0x20,0x3d,0x20,0x7b,0x20,0x66,
+    0x6c,0x6f,0x61,0x74,0x32,0x28,0x2d,0x30,0x2e,0x35,0x2c,0x20,0x30,0x2e,0x35,0x29,
+    0x2c,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x28,0x30,0x2e,0x35,0x29,0x2c,0x20,0x66,
+    0x6c,0x6f,0x61,0x74,0x32,0x28,0x30,0x2e,0x35,0x2c,0x20,0x2d,0x30,0x2e,0x35,0x29,
+    0x2c,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x28,0x2d,0x30,0x2e,0x35,0x2c,0x20,0x30,
+    0x2e,0x35,0x29,0x2c,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x28,0x30,0x2e,0x35,0x2c,
+    0x20,0x2d,0x30,0x2e,0x35,0x29,0x2c,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x28,0x2d,
+    0x30,0x2e,0x35,0x29,0x20,0x7d,0x3b,0x0a,0x0a,0x73,0x74,0x72,0x75,0x63,0x74,0x20,
+    0x6d,0x61,0x69,0x6e,0x30,0x5f,0x6f,0x75,0x74,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,
+    0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x75,0x76,0x20,0x5b,0x5b,0x75,0x73,0x65,0x72,
+    0x28,0x6c,0x6f,0x63,0x6e,0x30,0x29,0x5d,0x5d,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,
+    0x6c,0x6f,0x61,0x74,0x34,0x20,0x63,0x6f,0x6c,0x6f,0x72,0x20,0x5b,0x5b,0x75,0x73,
+    0x65,0x72,0x28,0x6c,0x6f,0x63,0x6e,0x31,0x29,0x5d,0x5d,0x3b,0x0a,0x20,0x20,0x20,
+    0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x67,0x6c,0x5f,0x50,0x6f,0x73,0x69,0x74,
+    0x69,0x6f,0x6e,0x20,0x5b,0x5b,0x70,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x5d,0x5d,
+    0x3b,0x0a,0x7d,0x3b,0x0a,0x0a,0x76,0x65,0x72,0x74,0x65,0x78,0x20,0x6d,0x61,0x69,
+    0x6e,0x30,0x5f,0x6f,0x75,0x74,0x20,0x6d,0x61,0x69,0x6e,0x30,0x28,0x63,0x6f,0x6e,
+    0x73,0x74,0x61,0x6e,0x74,0x20,0x76,0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x26,
+    0x20,0x5f,0x34,0x20,0x5b,0x5b,0x62,0x75,0x66,0x66,0x65,0x72,0x28,0x30,0x29,0x5d,
+    0x5d,0x2c,0x20,0x63,0x6f,0x6e,0x73,0x74,0x20,0x64,0x65,0x76,0x69,0x63,0x65,0x20,
+    0x73,0x73,0x70,0x72,0x69,0x74,0x65,0x5f,0x73,0x62,0x75,0x66,0x26,0x20,0x5f,0x35,
+    0x20,0x5b,0x5b,0x62,0x75,0x66,0x66,0x65,0x72,0x28,0x38,0x29,0x5d,0x5d,0x2c,0x20,
+    0x75,0x69,0x6e,0x74,0x20,0x67,0x6c,0x5f,0x56,0x65,0x72,0x74,0x65,0x78,0x49,0x6e,
+    0x64,0x65,0x78,0x20,0x5b,0x5b,0x76,0x65,0x72,0x74,0x65,0x78,0x5f,0x69,0x64,0x5d,
+    0x5d,0x2c,0x20,0x75,0x69,0x6e,0x74,0x20,0x67,0x6c,0x5f,0x49,0x6e,0x73,0x74,0x61,
+    0x6e,0x63,0x65,0x49,0x6e,0x64,0x65,0x78,0x20,0x5b,0x5b,0x69,0x6e,0x73,0x74,0x61,
+    0x6e,0x63,0x65,0x5f,0x69,0x64,0x5d,0x5d,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,
+    0x6d,0x61,0x69,0x6e,0x30,0x5f,0x6f,0x75,0x74,0x20,0x6f,0x75,0x74,0x20,0x3d,0x20,
+    0x7b,0x7d,0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,0x6e,0x74,0x20,0x69,0x64,0x78,0x20,
+    0x3d,0x20,0x69,0x6e,0x74,0x28,0x67,0x6c,0x5f,0x49,0x6e,0x73,0x74,0x61,0x6e,0x63,
+    0x65,0x49,0x6e,0x64,0x65,0x78,0x29,0x20,0x2b,0x20,0x69,0x6e,0x74,0x28,0x5f,0x34,
+    0x2e,0x6d,0x69,0x73,0x63,0x2e,0x78,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,
+    0x6f,0x61,0x74,0x32,0x20,0x63,0x20,0x3d,0x20,0x5f,0x35,0x37,0x5b,0x69,0x6e,0x74,
+    0x28,0x67,0x6c,0x5f,0x56,0x65,0x72,0x74,0x65,0x78,0x49,0x6e,0x64,0x65,0x78,0x29,
+    0x5d,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x6f,0x66,
+    0x73,0x20,0x3d,0x20,0x63,0x20,0x2a,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x28,0x5f,
+    0x35,0x2e,0x73,0x70,0x72,0x69,0x74,0x65,0x73,0x5b,0x69,0x64,0x78,0x5d,0x2e,0x77,
+    0x2c,0x20,0x5f,0x35,0x2e,0x73,0x70,0x72,0x69,0x74,0x65,0x73,0x5b,0x69,0x64,0x78,
+    0x5d,0x2e,0x68,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,
+    0x73,0x6e,0x20,0x3d,0x20,0x73,0x69,0x6e,0x28,0x5f,0x35,0x2e,0x73,0x70,0x72,0x69,
+    0x74,0x65,0x73,0x5b,0x69,0x64,0x78,0x5d,0x2e,0x72,0x6f,0x74,0x29,0x3b,0x0a,0x20,
+    0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x63,0x73,0x20,0x3d,0x20,0x63,0x6f,
+    0x73,0x28,0x5f,0x35,0x2e,0x73,0x70,0x72,0x69,0x74,0x65,0x73,0x5b,0x69,0x64,0x78,
+    0x5d,0x2e,0x72,0x6f,0x74,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x6f,0x66,0x73,0x20,
+    0x3d,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x28,0x28,0x6f,0x66,0x73,0x2e,0x78,0x20,
+    0x2a,0x20,0x63,0x73,0x29,0x20,0x2d,0x20,0x28,0x6f,0x66,0x73,0x2e,0x79,0x20,0x2a,
+    0x20,0x73,0x6e,0x29,0x2c,0x20,0x28,0x6f,0x66,0x73,0x2e,0x78,0x20,0x2a,0x20,0x73,
+    0x6e,0x29,0x20,0x2b,0x20,0x28,0x6f,0x66,0x73,0x2e,0x79,0x20,0x2a,0x20,0x63,0x73,
+    0x29,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,0x70,
+    0x6f,0x73,0x20,0x3d,0x20,0x28,0x66,0x6c,0x6f,0x61,0x74,0x33,0x28,0x5f,0x35,0x2e,
+    0x73,0x70,0x72,0x69,0x74,0x65,0x73,0x5b,0x69,0x64,0x78,0x5d,0x2e,0x78,0x2c,0x20,
+    0x5f,0x35,0x2e,0x73,0x70,0x72,0x69,0x74,0x65,0x73,0x5b,0x69,0x64,0x78,0x5d,0x2e,
+    0x79,0x2c,0x20,0x5f,0x35,0x2e,0x73,0x70,0x72,0x69,0x74,0x65,0x73,0x5b,0x69,0x64,
+    0x78,0x5d,0x2e,0x7a,0x29,0x20,0x2b,0x20,0x28,0x5f,0x34,0x2e,0x72,0x69,0x67,0x68,
+    0x74,0x2e,0x78,0x79,0x7a,0x20,0x2a,0x20,0x6f,0x66,0x73,0x2e,0x78,0x29,0x29,0x20,
+    0x2b,0x20,0x28,0x5f,0x34,0x2e,0x75,0x70,0x2e,0x78,0x79,0x7a,0x20,0x2a,0x20,0x6f,
+    0x66,0x73,0x2e,0x79,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x6f,0x75,0x74,0x2e,0x67,
+    0x6c,0x5f,0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x5f,0x34,0x2e,
+    0x6d,0x76,0x70,0x20,0x2a,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x28,0x70,0x6f,0x73,
+    0x2c,0x20,0x31,0x2e,0x30,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,
+    0x74,0x32,0x20,0x75,0x76,0x30,0x20,0x3d,0x20,0x75,0x6e,0x70,0x61,0x63,0x6b,0x5f,
+    0x75,0x6e,0x6f,0x72,0x6d,0x32,0x78,0x31,0x36,0x5f,0x74,0x6f,0x5f,0x66,0x6c,0x6f,
+    0x61,0x74,0x28,0x5f,0x35,0x2e,0x73,0x70,0x72,0x69,0x74,0x65,0x73,0x5b,0x69,0x64,
+    0x78,0x5d,0x2e,0x75,0x76,0x30,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,
+    0x61,0x74,0x32,0x20,0x75,0x76,0x31,0x20,0x3d,0x20,0x75,0x6e,0x70,0x61,0x63,0x6b,
+    0x5f,0x75,0x6e,0x6f,0x72,0x6d,0x32,0x78,0x31,0x36,0x5f,0x74,0x6f,0x5f,0x66,0x6c,
+    0x6f,0x61,0x74,0x28,0x5f,0x35,0x2e,0x73,0x70,0x72,0x69,0x74,0x65,0x73,0x5b,0x69,
+    0x64,0x78,0x5d,0x2e,0x75,0x76,0x31,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x6f,0x75,
+    0x74,0x2e,0x75,0x76,0x20,0x3d,0x20,0x6d,0x69,0x78,0x28,0x75,0x76,0x30,0x2c,0x20,
+    0x75,0x76,0x31,0x2c,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x28,0x63,0x2e,0x78,0x20,
+    0x2b,0x20,0x30,0x2e,0x35,0x2c,0x20,0x30,0x2e,0x35,0x20,0x2d,0x20,0x63,0x2e,0x79,
+    0x29,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x6f,0x75,0x74,0x2e,0x63,0x6f,0x6c,0x6f,
+    0x72,0x20,0x3d,0x20,0x75,0x6e,0x70,0x61,0x63,0x6b,0x5f,0x75,0x6e,0x6f,0x72,0x6d,
+    0x34,0x78,0x38,0x5f,0x74,0x6f,0x5f,0x66,0x6c,0x6f,0x61,0x74,0x28,0x5f,0x35,0x2e,
+    0x73,0x70,0x72,0x69,0x74,0x65,0x73,0x5b,0x69,0x64,0x78,0x5d,0x2e,0x63,0x6f,0x6c,
+    0x6f,0x72,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,
+    0x6f,0x75,0x74,0x3b,0x0a,0x7d,0x0a,0x0a,0x00,
+};
+static const uint8_t _ssprite_shd_fs_source_metal_sim[436] = {
+    0x23,0x69,0x6e,0x63,0x6c,0x75,0x64,0x65,0x20,0x3c,0x6d,0x65,0x74,0x61,0x6c,0x5f,
+    0x73,0x74,0x64,0x6c,0x69,0x62,0x3e,0x0a,0x23,0x69,0x6e,0x63,0x6c,0x75,0x64,0x65,
+    0x20,0x3c,0x73,0x69,0x6d,0x64,0x2f,0x73,0x69,0x6d,0x64,0x2e,0x68,0x3e,0x0a,0x0a,
+    0x75,0x73,0x69,0x6e,0x67,0x20,0x6e,0x61,0x6d,0x65,0x73,0x70,0x61,0x63,0x65,0x20,
+    0x6d,0x65,0x74,0x61,0x6c,0x3b,0x0a,0x0a,0x73,0x74,0x72,0x75,0x63,0x74,0x20,0x6d,
+    0x61,0x69,0x6e,0x30,0x5f,0x6f,0x75,0x74,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x66,
+    0x6c,0x6f,0x61,0x74,0x34,0x20,0x66,0x72,0x61,0x67,0x5f,0x63,0x6f,0x6c,0x6f,0x72,
+    0x20,0x5b,0x5b,0x63,0x6f,0x6c,0x6f,0x72,0x28,0x30,0x29,0x5d,0x5d,0x3b,0x0a,0x7d,
+    0x3b,0x0a,0x0a,0x73,0x74,0x72,0x75,0x63,0x74,0x20,0x6d,0x61,0x69,0x6e,0x30,0x5f,
+    0x69,0x6e,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,
+    0x75,0x76,0x20,0x5b,0x5b,0x75,0x73,0x65,0x72,0x28,0x6c,0x6f,0x63,0x6e,0x30,0x29,
+    0x5d,0x5d,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x63,
+    0x6f,0x6c,0x6f,0x72,0x20,0x5b,0x5b,0x75,0x73,0x65,0x72,0x28,0x6c,0x6f,0x63,0x6e,
+    0x31,0x29,0x5d,0x5d,0x3b,0x0a,0x7d,0x3b,0x0a,0x0a,0x66,0x72,0x61,0x67,0x6d,0x65,
+    0x6e,0x74,0x20,0x6d,0x61,0x69,0x6e,0x30,0x5f,0x6f,0x75,0x74,0x20,0x6d,0x61,0x69,
+    0x6e,0x30,0x28,0x6d,0x61,0x69,0x6e,0x30,0x5f,0x69,0x6e,0x20,0x69,0x6e,0x20,0x5b,
+    0x5b,0x73,0x74,0x61,0x67,0x65,0x5f,0x69,0x6e,0x5d,0x5d,0x2c,0x20,0x74,0x65,0x78,
+    0x74,0x75,0x72,0x65,0x32,0x64,0x3c,0x66,0x6c,0x6f,0x61,0x74,0x3e,0x20,0x74,0x65,
+    0x78,0x20,0x5b,0x5b,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x28,0x30,0x29,0x5d,0x5d,
+    0x2c,0x20,0x73,0x61,0x6d,0x70,0x6c,0x65,0x72,0x20,0x73,0x6d,0x70,0x20,0x5b,0x5b,
+    0x73,0x61,0x6d,0x70,0x6c,0x65,0x72,0x28,0x30,0x29,0x5d,0x5d,0x29,0x0a,0x7b,0x0a,
+    0x20,0x20,0x20,0x20,0x6d,0x61,0x69,0x6e,0x30,0x5f,0x6f,0x75,0x74,0x20,0x6f,0x75,
+    0x74,0x20,0x3d,0x20,0x7b,0x7d,0x3b,0x0a,0x20,0x20,0x20,0x20,0x6f,0x75,0x74,0x2e,
+    0x66,0x72,0x61,0x67,0x5f,0x63,0x6f,0x6c,0x6f,0x72,0x20,0x3d,0x20,0x74,0x65,0x78,
+    0x2e,0x73,0x61,0x6d,0x70,0x6c,0x65,0x28,0x73,0x6d,0x70,0x2c,0x20,0x69,0x6e,0x2e,
+    0x75,0x76,0x29,0x20,0x2a,0x20,0x69,0x6e,0x2e,0x63,0x6f,0x6c,0x6f,0x72,0x3b,0x0a,
+    0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x6f,0x75,0x74,0x3b,0x0a,
+    0x7d,0x0a,0x0a,0x00,
+};
+#elif defined(SOKOL_D3D11)
+static const uint8_t _ssprite_shd_vs_source_hlsl5[2236] = {
+    0x73,0x74,0x61,0x74,0x69,0x63,0x20,0x63,0x6f,0x6e,0x73,0x74,0x20,0x66,0x6c,0x6f,
+    0x61,0x74,0x32,0x20,0x5f,0x35,0x37,0x5b,0x36,0x5d,0x20,0x3d,0x20,0x7b,0x20,0x66,
+    0x6c,0x6f,0x61,0x74,0x32,0x28,0x2d,0x30,0x2e,0x35,0x66,0x2c,0x20,0x30,0x2e,0x35,
+    0x66,0x29,0x2c,0x20,0x30,0x2e,0x35,0x66,0x2e,0x78,0x78,0x2c,0x20,0x66,0x6c,0x6f,
+    0x61,0x74,0x32,0x28,0x30,0x2e,0x35,0x66,0x2c,0x20,0x2d,0x30,0x2e,0x35,0x66,0x29,
+    0x2c,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x28,0x2d,0x30,0x2e,0x35,0x66,0x2c,0x20,
+    0x30,0x2e,0x35,0x66,0x29,0x2c,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x28,0x30,0x2e,
+    0x35,0x66,0x2c,0x20,0x2d,0x30,0x2e,0x35,0x66,0x29,0x2c,0x20,0x28,0x2d,0x30,0x2e,
+    0x35,0x66,0x29,0x2e,0x78,0x78,0x20,0x7d,0x3b,0x0a,0x0a,0x63,0x62,0x75,0x66,0x66,
+    0x65,0x72,0x20,0x76,0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x20,0x3a,0x20,0x72,
+    0x65,0x67,0x69,0x73,0x74,0x65,0x72,0x28,0x62,0x30,0x29,0x0a,0x7b,0x0a,0x20,0x20,
+    0x20,0x20,0x72,0x6f,0x77,0x5f,0x6d,0x61,0x6a,0x6f,0x72,0x20,0x66,0x6c,0x6f,0x61,
+    0x74,0x34,0x78,0x34,0x20,0x5f,0x34,0x5f,0x6d,0x76,0x70,0x20,0x3a,0x20,0x70,0x61,
+    0x63,0x6b,0x6f,0x66,0x66,0x73,0x65,0x74,0x28,0x63,0x30,0x29,0x3b,0x0a,0x20,0x20,
+    0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x5f,0x34,0x5f,0x72,0x69,0x67,0x68,
+    0x74,0x20,0x3a,0x20,0x70,0x61,0x63,0x6b,0x6f,0x66,0x66,0x73,0x65,0x74,0x28,0x63,
+    0x34,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x5f,
+    0x34,0x5f,0x75,0x70,0x20,0x3a,0x20,0x70,0x61,0x63,0x6b,0x6f,0x66,0x66,0x73,0x65,
+    0x74,0x28,0x63,0x35,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,
+    0x34,0x20,0x5f,0x34,0x5f,0x6d,0x69,0x73,0x63,0x20,0x3a,0x20,0x70,0x61,0x63,0x6b,
+    0x6f,0x66,0x66,0x73,0x65,0x74,0x28,0x63,0x36,0x29,0x3b,0x0a,0x7d,0x3b,0x0a,0x0a,
+    0x42,0x79,0x74,0x65,0x41,0x64,0x64,0x72,0x65,0x73,0x73,0x42,0x75,0x66,0x66,0x65,
+    0x72,0x20,0x5f,0x35,0x20,0x3a,0x20,0x72,0x65,0x67,0x69,0x73,0x74,0x65,0x72,0x28,
+    0x74,0x30,0x29,0x3b,0x0a,0x0a,0x73,0x74,0x61,0x74,0x69,0x63,0x20,0x66,0x6c,0x6f,
+    0x61,0x74,0x34,0x20,0x67,0x6c,0x5f,0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x3b,
+    0x0a,0x73,0x74,0x61,0x74,0x69,0x63,0x20,0x69,0x6e,0x74,0x20,0x67,0x6c,0x5f,0x56,
+    0x65,0x72,0x74,0x65,0x78,0x49,0x6e,0x64,0x65,0x78,0x3b,0x0a,0x73,0x74,0x61,0x74,
+    0x69,0x63,0x20,0x69,0x6e,0x74,0x20,0x67,0x6c,0x5f,0x49,0x6e,0x73,0x74,0x61,0x6e,
+    0x63,0x65,0x49,0x6e,0x64,0x65,0x78,0x3b,0x0a,0x73,0x74,0x61,0x74,0x69,0x63,0x20,
+    0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x75,0x76,0x3b,0x0a,0x73,0x74,0x61,0x74,0x69,
+    0x63,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x63,0x6f,0x6c,0x6f,0x72,0x3b,0x0a,
+    0x0a,0x73,0x74,0x72,0x75,0x63,0x74,0x20,0x53,0x50,0x49,0x52,0x56,0x5f,0x43,0x72,
+    0x6f,0x73,0x73,0x5f,0x49,0x6e,0x70,0x75,0x74,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,
+    0x75,0x69,0x6e,0x74,0x20,0x67,0x6c,0x5f,0x56,0x65,0x72,0x74,0x65,0x78,0x49,0x6e,
+    0x64,0x65,0x78,0x20,0x3a,0x20,0x53,0x56,0x5f,0x56,0x65,0x72,0x74,0x65,0x78,0x49,
+    0x44,0x3b,0x0a,0x20,0x20,0x20,0x20,0x75,0x69,0x6e,0x74,0x20,0x67,0x6c,0x5f,0x49,
+    0x6e,0x73,0x74,0x61,0x6e,0x63,0x65,0x49,0x6e,0x64,0x65,0x78,0x20,0x3a,0x20,0x53,
+    0x56,0x5f,0x49,0x6e,0x73,0x74,0x61,0x6e,0x63,0x65,0x49,0x44,0x3b,0x0a,0x7d,0x3b,
+    0x0a,0x0a,0x73,0x74,0x72,0x75,0x63,0x74,0x20,0x53,0x50,0x49,0x52,0x56,0x5f,0x43,
+    0x72,0x6f,0x73,0x73,0x5f,0x4f,0x75,0x74,0x70,0x75,0x74,0x0a,0x7b,0x0a,0x20,0x20,
+    0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x75,0x76,0x20,0x3a,0x20,0x54,0x45,
+    0x58,0x43,0x4f,0x4f,0x52,0x44,0x30,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,
+    0x61,0x74,0x34,0x20,0x63,0x6f,0x6c,0x6f,0x72,0x20,0x3a,0x20,0x54,0x45,0x58,0x43,
+    0x4f,0x4f,0x52,0x44,0x31,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,
+    0x34,0x20,0x67,0x6c,0x5f,0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x20,0x3a,0x20,
+    0x53,0x56,0x5f,0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x3b,0x0a,0x7d,0x3b,0x0a,
+    0x0a,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x73,0x70,0x76,0x55,0x6e,0x70,0x61,0x63,
+    0x6b,0x55,0x6e,0x6f,0x72,0x6d,0x32,0x78,0x31,0x36,0x28,0x75,0x69,0x6e,0x74,0x20,
+    0x76,0x61,0x6c,0x75,0x65,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x75,0x69,0x6e,
+    0x74,0x32,0x20,0x50,0x61,0x63,0x6b,0x65,0x64,0x20,0x3d,0x20,0x75,0x69,0x6e,0x74,
+    0x32,0x28,0x76,0x61,0x6c,0x75,0x65,0x20,0x26,0x20,0x30,0x78,0x66,0x66,0x66,0x66,
+    0x2c,0x20,0x76,0x61,0x6c,0x75,0x65,0x20,0x3e,0x3e,0x20,0x31,0x36,0x29,0x3b,0x0a,
+    0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x66,0x6c,0x6f,0x61,0x74,
+    0x32,0x28,0x50,0x61,0x63,0x6b,0x65,0x64,0x29,0x20,0x2f,0x20,0x36,0x35,0x35,0x33,
+    0x35,0x2e,0x30,0x3b,0x0a,0x7d,0x0a,0x0a,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x73,
+    0x70,0x76,0x55,0x6e,0x70,0x61,0x63,0x6b,0x55,0x6e,0x6f,0x72,0x6d,0x34,0x78,0x38,
+    0x28,0x75,0x69,0x6e,0x74,0x20,0x76,0x61,0x6c,0x75,0x65,0x29,0x0a,0x7b,0x0a,0x20,
+    0x20,0x20,0x20,0x75,0x69,0x6e,0x74,0x34,0x20,0x50,0x61,0x63,0x6b,0x65,0x64,0x20,
+    0x3d,0x20,0x75,0x69,0x6e,0x74,0x34,0x28,0x76,0x61,0x6c,0x75,0x65,0x20,0x26,0x20,
+    0x30,0x78,0x66,0x66,0x2c,0x20,0x28,0x76,0x61,0x6c,0x75,0x65,0x20,0x3e,0x3e,0x20,
+    0x38,0x29,0x20,0x26,0x20,0x30,0x78,0x66,0x66,0x2c,0x20,0x28,0x76,0x61,0x6c,0x75,
+    0x65,0x20,0x3e,0x3e,0x20,0x31,0x36,0x29,0x20,0x26,0x20,0x30,0x78,0x66,0x66,0x2c,
+    0x20,0x76,0x61,0x6c,0x75,0x65,0x20,0x3e,0x3e,0x20,0x32,0x34,0x29,0x3b,0x0a,0x20,
+    0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,
+    0x28,0x50,0x61,0x63,0x6b,0x65,0x64,0x29,0x20,0x2f,0x20,0x32,0x35,0x35,0x2e,0x30,
+    0x3b,0x0a,0x7d,0x0a,0x0a,0x76,0x6f,0x69,0x64,0x20,0x76,0x65,0x72,0x74,0x5f,0x6d,
+    0x61,0x69,0x6e,0x28,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x69,0x6e,0x74,0x20,
+    0x69,0x64,0x78,0x20,0x3d,0x20,0x67,0x6c,0x5f,0x49,0x6e,0x73,0x74,0x61,0x6e,0x63,
+    0x65,0x49,0x6e,0x64,0x65,0x78,0x20,0x2b,0x20,0x69,0x6e,0x74,0x28,0x5f,0x34,0x5f,
+    0x6d,0x69,0x73,0x63,0x2e,0x78,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,
+    0x61,0x74,0x32,0x20,0x63,0x20,0x3d,0x20,0x5f,0x35,0x37,0x5b,0x67,0x6c,0x5f,0x56,
+    0x65,0x72,0x74,0x65,0x78,0x49,0x6e,0x64,0x65,0x78,0x5d,0x3b,0x0a,0x20,0x20,0x20,
+    0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x6f,0x66,0x73,0x20,0x3d,0x20,0x63,0x20,
+    0x2a,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x28,0x61,0x73,0x66,0x6c,0x6f,0x61,0x74,
+    0x28,0x5f,0x35,0x2e,0x4c,0x6f,0x61,0x64,0x28,0x69,0x64,0x78,0x20,0x2a,0x20,0x33,
+    0x36,0x20,0x2b,0x20,0x31,0x36,0x29,0x29,0x2c,0x20,0x61,0x73,0x66,0x6c,0x6f,0x61,
+    0x74,0x28,0x5f,0x35,0x2e,0x4c,0x6f,0x61,0x64,0x28,0x69,0x64,0x78,0x20,0x2a,0x20,
+    0x33,0x36,0x20,0x2b,0x20,0x32,0x30,0x29,0x29,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,
+    0x66,0x6c,0x6f,0x61,0x74,0x20,0x73,0x6e,0x20,0x3d,0x20,0x73,0x69,0x6e,0x28,0x61,
+    0x73,0x66,0x6c,0x6f,0x61,0x74,0x28,0x5f,0x35,0x2e,0x4c,0x6f,0x61,0x64,0x28,0x69,
+    0x64,0x78,0x20,0x2a,0x20,0x33,0x36,0x20,0x2b,0x20,0x31,0x32,0x29,0x29,0x29,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x63,0x73,0x20,0x3d,0x20,
+    0x63,0x6f,0x73,0x28,0x61,0x73,0x66,0x6c,0x6f,0x61,0x74,0x28,0x5f,0x35,0x2e,0x4c,
+    0x6f,0x61,0x64,0x28,0x69,0x64,0x78,0x20,0x2a,0x20,0x33,0x36,0x20,0x2b,0x20,0x31,
+    0x32,0x29,0x29,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x6f,0x66,0x73,0x20,0x3d,0x20,
+    0x66,0x6c,0x6f,0x61,0x74,0x32,0x28,0x28,0x6f,0x66,0x73,0x2e,0x78,0x20,0x2a,0x20,
+    0x63,0x73,0x29,0x20,0x2d,0x20,0x28,0x6f,0x66,0x73,0x2e,0x79,0x20,0x2a,0x20,0x73,
+    0x6e,0x29,0x2c,0x20,0x28,0x6f,0x66,0x73,0x2e,0x78,0x20,0x2a,0x20,0x73,0x6e,0x29,
+    0x20,0x2b,0x20,0x28,0x6f,0x66,0x73,0x2e,0x79,0x20,0x2a,0x20,0x63,0x73,0x29,0x29,
+    0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,0x70,0x6f,0x73,
+    0x20,0x3d,0x20,0x28,0x66,0x6c,0x6f,0x61,0x74,0x33,0x28,0x61,0x73,0x66,0x6c,0x6f,
+    0x61,0x74,0x28,0x5f,0x35,0x2e,0x4c,0x6f,0x61,0x64,0x28,0x69,0x64,0x78,0x20,0x2a,
+    0x20,0x33,0x36,0x20,0x2b,0x20,0x30,0x29,0x29,0x2c,0x20,0x61,0x73,0x66,0x6c,0x6f,
+    0x61,0x74,0x28,0x5f,0x35,0x2e,0x4c,0x6f,0x61,0x64,0x28,0x69,0x64,0x78,0x20,0x2a,
+    0x20,0x33,0x36,0x20,0x2b,0x20,0x34,0x29,0x29,0x2c,0x20,0x61,0x73,0x66,0x6c,0x6f,
+    0x61,0x74,0x28,0x5f,0x35,0x2e,0x4c,0x6f,0x61,0x64,0x28,0x69,0x64,0x78,0x20,0x2a,
+    0x20,0x33,0x36,0x20,0x2b,0x20,0x38,0x29,0x29,0x29,0x20,0x2b,0x20,0x28,0x5f,0x34,
+    0x5f,0x72,0x69,0x67,0x68,0x74,0x2e,0x78,0x79,0x7a,0x20,0x2a,0x20,0x6f,0x66,0x73,
+    0x2e,0x78,0x29,0x29,0x20,0x2b,0x20,0x28,0x5f,0x34,0x5f,0x75,0x70,0x2e,0x78,0x79,
+    0x7a,0x20,0x2a,0x20,0x6f,0x66,0x73,0x2e,0x79,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,
+    0x67,0x6c,0x5f,0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x6d,0x75,
+    0x6c,0x28,0x66,0x6c,0x6f,0x61,0x74,0x34,0x28,0x70,0x6f,0x73,0x2c,0x20,0x31,0x2e,
+    0x30,0x66,0x29,0x2c,0x20,0x5f,0x34,0x5f,0x6d,0x76,0x70,0x29,0x3b,0x0a,0x20,0x20,
+    0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x75,0x76,0x30,0x20,0x3d,0x20,0x73,
+    0x70,0x76,0x55,0x6e,0x70,0x61,0x63,0x6b,0x55,0x6e,0x6f,0x72,0x6d,0x32,0x78,0x31,
+    0x36,0x28,0x5f,0x35,0x2e,0x4c,0x6f,0x61,0x64,0x28,0x69,0x64,0x78,0x20,0x2a,0x20,
+    0x33,0x36,0x20,0x2b,0x20,0x32,0x34,0x29,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,
+    0x6c,0x6f,0x61,0x74,0x32,0x20,0x75,0x76,0x31,0x20,0x3d,0x20,0x73,0x70,0x76,0x55,
+    0x6e,0x70,0x61,0x63,0x6b,0x55,0x6e,0x6f,0x72,0x6d,0x32,0x78,0x31,0x36,0x28,0x5f,
+    0x35,0x2e,0x4c,0x6f,0x61,0x64,0x28,0x69,0x64,0x78,0x20,0x2a,0x20,0x33,0x36,0x20,
+    0x2b,0x20,0x32,0x38,0x29,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x75,0x76,0x20,0x3d,
+    0x20,0x6c,0x65,0x72,0x70,0x28,0x75,0x76,0x30,0x2c,0x20,0x75,0x76,0x31,0x2c,0x20,
+    0x66,0x6c,0x6f,0x61,0x74,0x32,0x28,0x63,0x2e,0x78,0x20,0x2b,0x20,0x30,0x2e,0x35,
+    0x66,0x2c,0x20,0x30,0x2e,0x35,0x66,0x20,0x2d,0x20,0x63,0x2e,0x79,0x29,0x29,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x63,0x6f,0x6c,0x6f,0x72,0x20,0x3d,0x20,0x73,0x70,0x76,
+    0x55,0x6e,0x70,0x61,0x63,0x6b,0x55,0x6e,0x6f,0x72,0x6d,0x34,0x78,0x38,0x28,0x5f,
+    0x35,0x2e,0x4c,0x6f,0x61,0x64,0x28,0x69,0x64,0x78,0x20,0x2a,0x20,0x33,0x36,0x20,
+    0x2b,0x20,0x33,0x32,0x29,0x29,0x3b,0x0a,0x7d,0x0a,0x0a,0x53,0x50,0x49,0x52,0x56,
+    0x5f,0x43,0x72,0x6f,0x73,0x73,0x5f,0x4f,0x75,0x74,0x70,0x75,0x74,0x20,0x6d,0x61,
+    0x69,0x6e,0x28,0x53,0x50,0x49,0x52,0x56,0x5f,0x43,0x72,0x6f,0x73,0x73,0x5f,0x49,
+    0x6e,0x70,0x75,0x74,0x20,0x73,0x74,0x61,0x67,0x65,0x5f,0x69,0x6e,0x70,0x75,0x74,
+    0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x67,0x6c,0x5f,0x56,0x65,0x72,0x74,0x65,
+    0x78,0x49,0x6e,0x64,0x65,0x78,0x20,0x3d,0x20,0x69,0x6e,0x74,0x28,0x73,0x74,0x61,
+    0x67,0x65,0x5f,0x69,0x6e,0x70,0x75,0x74,0x2e,0x67,0x6c,0x5f,0x56,0x65,0x72,0x74,
+    0x65,0x78,0x49,0x6e,0x64,0x65,0x78,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x67,0x6c,
+    0x5f,0x49,0x6e,0x73,0x74,0x61,0x6e,0x63,0x65,0x49,0x6e,0x64,0x65,0x78,0x20,0x3d,
+    0x20,0x69,0x6e,0x74,0x28,0x73,0x74,0x61,0x67,0x65,0x5f,0x69,0x6e,0x70,0x75,0x74,
+    0x2e,0x67,0x6c,0x5f,0x49,0x6e,0x73,0x74,0x61,0x6e,0x63,0x65,0x49,0x6e,0x64,0x65,
+    0x78,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x65,0x72,0x74,0x5f,0x6d,0x61,0x69,
+    0x6e,0x28,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x53,0x50,0x49,0x52,0x56,0x5f,0x43,
+    0x72,0x6f,0x73,0x73,0x5f,0x4f,0x75,0x74,0x70,0x75,0x74,0x20,0x73,0x74,0x61,0x67,
+    0x65,0x5f,0x6f,0x75,0x74,0x70,0x75,0x74,0x3b,0x0a,0x20,0x20,0x20,0x20,0x73,0x74,
+    0x61,0x67,0x65,0x5f,0x6f,0x75,0x74,0x70,0x75,0x74,0x2e,0x67,0x6c,0x5f,0x50,0x6f,
+    0x73,0x69,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x67,0x6c,0x5f,0x50,0x6f,0x73,0x69,
+    0x74,0x69,0x6f,0x6e,0x3b,0x0a,0x20,0x20,0x20,0x20,0x73,0x74,0x61,0x67,0x65,0x5f,
+    0x6f,0x75,0x74,0x70,0x75,0x74,0x2e,0x75,0x76,0x20,0x3d,0x20,0x75,0x76,0x3b,0x0a,
+    0x20,0x20,0x20,0x20,0x73,0x74,0x61,0x67,0x65,0x5f,0x6f,0x75,0x74,0x70,0x75,0x74,
+    0x2e,0x63,0x6f,0x6c,0x6f,0x72,0x20,0x3d,0x20,0x63,0x6f,0x6c,0x6f,0x72,0x3b,0x0a,
+    0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x73,0x74,0x61,0x67,0x65,
+    0x5f,0x6f,0x75,0x74,0x70,0x75,0x74,0x3b,0x0a,0x7d,0x0a,0x00,
+};
+static const uint8_t _ssprite_shd_fs_source_hlsl5[599] = {
+    0x54,0x65,0x78,0x74,0x75,0x72,0x65,0x32,0x44,0x3c,0x66,0x6c,0x6f,0x61,0x74,0x34,
+    0x3e,0x20,0x74,0x65,0x78,0x20,0x3a,0x20,0x72,0x65,0x67,0x69,0x73,0x74,0x65,0x72,
+    0x28,0x74,0x30,0x29,0x3b,0x0a,0x53,0x61,0x6d,0x70,0x6c,0x65,0x72,0x53,0x74,0x61,
+    0x74,0x65,0x20,0x73,0x6d,0x70,0x20,0x3a,0x20,0x72,0x65,0x67,0x69,0x73,0x74,0x65,
+    0x72,0x28,0x73,0x30,0x29,0x3b,0x0a,0x0a,0x73,0x74,0x61,0x74,0x69,0x63,0x20,0x66,
+    0x6c,0x6f,0x61,0x74,0x34,0x20,0x66,0x72,0x61,0x67,0x5f,0x63,0x6f,0x6c,0x6f,0x72,
+    0x3b,0x0a,0x73,0x74,0x61,0x74,0x69,0x63,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,
+    0x75,0x76,0x3b,0x0a,0x73,0x74,0x61,0x74,0x69,0x63,0x20,0x66,0x6c,0x6f,0x61,0x74,
+    0x34,0x20,0x63,0x6f,0x6c,0x6f,0x72,0x3b,0x0a,0x0a,0x73,0x74,0x72,0x75,0x63,0x74,
+    0x20,0x53,0x50,0x49,0x52,0x56,0x5f,0x43,0x72,0x6f,0x73,0x73,0x5f,0x49,0x6e,0x70,
+    0x75,0x74,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,
+    0x75,0x76,0x20,0x3a,0x20,0x54,0x45,0x58,0x43,0x4f,0x4f,0x52,0x44,0x30,0x3b,0x0a,
+    0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x63,0x6f,0x6c,0x6f,0x72,
+    0x20,0x3a,0x20,0x54,0x45,0x58,0x43,0x4f,0x4f,0x52,0x44,0x31,0x3b,0x0a,0x7d,0x3b,
+    0x0a,0x0a,0x73,0x74,0x72,0x75,0x63,0x74,0x20,0x53,0x50,0x49,0x52,0x56,0x5f,0x43,
+    0x72,0x6f,0x73,0x73,0x5f,0x4f,0x75,0x74,0x70,0x75,0x74,0x0a,0x7b,0x0a,0x20,0x20,
+    0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x66,0x72,0x61,0x67,0x5f,0x63,0x6f,
+    0x6c,0x6f,0x72,0x20,0x3a,0x20,0x53,0x56,0x5f,0x54,0x61,0x72,0x67,0x65,0x74,0x30,
+    0x3b,0x0a,0x7d,0x3b,0x0a,0x0a,0x76,0x6f,0x69,0x64,0x20,0x66,0x72,0x61,0x67,0x5f,
+    0x6d,0x61,0x69,0x6e,0x28,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x66,0x72,0x61,
+    0x67,0x5f,0x63,0x6f,0x6c,0x6f,0x72,0x20,0x3d,0x20,0x74,0x65,0x78,0x2e,0x53,0x61,
+    0x6d,0x70,0x6c,0x65,0x28,0x73,0x6d,0x70,0x2c,0x20,0x75,0x76,0x29,0x20,0x2a,0x20,
+    0x63,0x6f,0x6c,0x6f,0x72,0x3b,0x0a,0x7d,0x0a,0x0a,0x53,0x50,0x49,0x52,0x56,0x5f,
+    0x43,0x72,0x6f,0x73,0x73,0x5f,0x4f,0x75,0x74,0x70,0x75,0x74,0x20,0x6d,0x61,0x69,
+    0x6e,0x28,0x53,0x50,0x49,0x52,0x56,0x5f,0x43,0x72,0x6f,0x73,0x73,0x5f,0x49,0x6e,
+    0x70,0x75,0x74,0x20,0x73,0x74,0x61,0x67,0x65,0x5f,0x69,0x6e,0x70,0x75,0x74,0x29,
+    0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x75,0x76,0x20,0x3d,0x20,0x73,0x74,0x61,0x67,
+    0x65,0x5f,0x69,0x6e,0x70,0x75,0x74,0x2e,0x75,0x76,0x3b,0x0a,0x20,0x20,0x20,0x20,
+    0x63,0x6f,0x6c,0x6f,0x72,0x20,0x3d,0x20,0x73,0x74,0x61,0x67,0x65,0x5f,0x69,0x6e,
+    0x70,0x75,0x74,0x2e,0x63,0x6f,0x6c,0x6f,0x72,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,
+    0x72,0x61,0x67,0x5f,0x6d,0x61,0x69,0x6e,0x28,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,
+    0x53,0x50,0x49,0x52,0x56,0x5f,0x43,0x72,0x6f,0x73,0x73,0x5f,0x4f,0x75,0x74,0x70,
+    0x75,0x74,0x20,0x73,0x74,0x61,0x67,0x65,0x5f,0x6f,0x75,0x74,0x70,0x75,0x74,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x73,0x74,0x61,0x67,0x65,0x5f,0x6f,0x75,0x74,0x70,0x75,
+    0x74,0x2e,0x66,0x72,0x61,0x67,0x5f,0x63,0x6f,0x6c,0x6f,0x72,0x20,0x3d,0x20,0x66,
+    0x72,0x61,0x67,0x5f,0x63,0x6f,0x6c,0x6f,0x72,0x3b,0x0a,0x20,0x20,0x20,0x20,0x72,
+    0x65,0x74,0x75,0x72,0x6e,0x20,0x73,0x74,0x61,0x67,0x65,0x5f,0x6f,0x75,0x74,0x70,
+    0x75,0x74,0x3b,0x0a,0x7d,0x0a,0x00,
+};
+#elif defined(SOKOL_WGPU)
+static const uint8_t _ssprite_shd_vs_source_wgsl[2251] = {
+    0x64,0x69,0x61,0x67,0x6e,0x6f,0x73,0x74,0x69,0x63,0x28,0x6f,0x66,0x66,0x2c,0x20,
+    0x64,0x65,0x72,0x69,0x76,0x61,0x74,0x69,0x76,0x65,0x5f,0x75,0x6e,0x69,0x66,0x6f,
+    0x72,0x6d,0x69,0x74,0x79,0x29,0x3b,0x0a,0x0a,0x73,0x74,0x72,0x75,0x63,0x74,0x20,
+    0x76,0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x20,0x7b,0x0a,0x20,0x20,0x2f,0x2a,
+    0x20,0x40,0x6f,0x66,0x66,0x73,0x65,0x74,0x28,0x30,0x29,0x20,0x2a,0x2f,0x0a,0x20,
+    0x20,0x6d,0x76,0x70,0x20,0x3a,0x20,0x6d,0x61,0x74,0x34,0x78,0x34,0x66,0x2c,0x0a,
+    0x20,0x20,0x2f,0x2a,0x20,0x40,0x6f,0x66,0x66,0x73,0x65,0x74,0x28,0x36,0x34,0x29,
+    0x20,0x2a,0x2f,0x0a,0x20,0x20,0x72,0x69,0x67,0x68,0x74,0x20,0x3a,0x20,0x76,0x65,
+    0x63,0x34,0x66,0x2c,0x0a,0x20,0x20,0x2f,0x2a,0x20,0x40,0x6f,0x66,0x66,0x73,0x65,
+    0x74,0x28,0x38,0x30,0x29,0x20,0x2a,0x2f,0x0a,0x20,0x20,0x75,0x70,0x20,0x3a,0x20,
+    0x76,0x65,0x63,0x34,0x66,0x2c,0x0a,0x20,0x20,0x2f,0x2a,0x20,0x40,0x6f,0x66,0x66,
+    0x73,0x65,0x74,0x28,0x39,0x36,0x29,0x20,0x2a,0x2f,0x0a,0x20,0x20,0x6d,0x69,0x73,
+    0x63,0x20,0x3a,0x20,0x76,0x65,0x63,0x34,0x66,0x2c,0x0a,0x7d,0x0a,0x0a,0x73,0x74,
+    0x72,0x75,0x63,0x74,0x20,0x73,0x70,0x72,0x69,0x74,0x65,0x20,0x7b,0x0a,0x20,0x20,
+    0x2f,0x2a,0x20,0x40,0x6f,0x66,0x66,0x73,0x65,0x74,0x28,0x30,0x29,0x20,0x2a,0x2f,
+    0x0a,0x20,0x20,0x78,0x20,0x3a,0x20,0x66,0x33,0x32,0x2c,0x0a,0x20,0x20,0x2f,0x2a,
+    0x20,0x40,0x6f,0x66,0x66,0x73,0x65,0x74,0x28,0x34,0x29,0x20,0x2a,0x2f,0x0a,0x20,
+    0x20,0x79,0x20,0x3a,0x20,0x66,0x33,0x32,0x2c,0x0a,0x20,0x20,0x2f,0x2a,0x20,0x40,
+    0x6f,0x66,0x66,0x73,0x65,0x74,0x28,0x38,0x29,0x20,0x2a,0x2f,0x0a,0x20,0x20,0x7a,
+    0x20,0x3a,0x20,0x66,0x33,0x32,0x2c,0x0a,0x20,0x20,0x2f,0x2a,0x20,0x40,0x6f,0x66,
+    0x66,0x73,0x65,0x74,0x28,0x31,0x32,0x29,0x20,0x2a,0x2f,0x0a,0x20,0x20,0x72,0x6f,
+    0x74,0x20,0x3a,0x20,0x66,0x33,0x32,0x2c,0x0a,0x20,0x20,0x2f,0x2a,0x20,0x40,0x6f,
+    0x66,0x66,0x73,0x65,0x74,0x28,0x31,0x36,0x29,0x20,0x2a,0x2f,0x0a,0x20,0x20,0x77,
+    0x20,0x3a,0x20,0x66,0x33,0x32,0x2c,0x0a,0x20,0x20,0x2f,0x2a,0x20,0x40,0x6f,0x66,
+    0x66,0x73,0x65,0x74,0x28,0x32,0x30,0x29,0x20,0x2a,0x2f,0x0a,0x20,0x20,0x68,0x20,
+    0x3a,0x20,0x66,0x33,0x32,0x2c,0x0a,0x20,0x20,0x2f,0x2a,0x20,0x40,0x6f,0x66,0x66,
+    0x73,0x65,0x74,0x28,0x32,0x34,0x29,0x20,0x2a,0x2f,0x0a,0x20,0x20,0x75,0x76,0x30,
+    0x20,0x3a,0x20,0x75,0x33,0x32,0x2c,0x0a,0x20,0x20,0x2f,0x2a,0x20,0x40,0x6f,0x66,
+    0x66,0x73,0x65,0x74,0x28,0x32,0x38,0x29,0x20,0x2a,0x2f,0x0a,0x20,0x20,0x75,0x76,
+    0x31,0x20,0x3a,0x20,0x75,0x33,0x32,0x2c,0x0a,0x20,0x20,0x2f,0x2a,0x20,0x40,0x6f,
+    0x66,0x66,0x73,0x65,0x74,0x28,0x33,0x32,0x29,0x20,0x2a,0x2f,0x0a,0x20,0x20,0x63,
+    0x6f,0x6c,0x6f,0x72,0x20,0x3a,0x20,0x75,0x33,0x32,0x2c,0x0a,0x7d,0x0a,0x0a,0x61,
+    0x6c,0x69,0x61,0x73,0x20,0x52,0x54,0x41,0x72,0x72,0x20,0x3d,0x20,0x61,0x72,0x72,
+    0x61,0x79,0x3c,0x73,0x70,0x72,0x69,0x74,0x65,0x3e,0x3b,0x0a,0x0a,0x73,0x74,0x72,
+    0x75,0x63,0x74,0x20,0x73,0x73,0x70,0x72,0x69,0x74,0x65,0x5f,0x73,0x62,0x75,0x66,
+    0x20,0x7b,0x0a,0x20,0x20,0x2f,0x2a,0x20,0x40,0x6f,0x66,0x66,0x73,0x65,0x74,0x28,
+    0x30,0x29,0x20,0x2a,0x2f,0x0a,0x20,0x20,0x73,0x70,0x72,0x69,0x74,0x65,0x73,0x20,
+    0x3a,0x20,0x52,0x54,0x41,0x72,0x72,0x2c,0x0a,0x7d,0x0a,0x0a,0x40,0x62,0x69,0x6e,
+    0x64,0x69,0x6e,0x67,0x28,0x30,0x29,0x20,0x40,0x67,0x72,0x6f,0x75,0x70,0x28,0x30,
+    0x29,0x20,0x76,0x61,0x72,0x3c,0x75,0x6e,0x69,0x66,0x6f,0x72,0x6d,0x3e,0x20,0x78,
+    0x5f,0x34,0x20,0x3a,0x20,0x76,0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x3b,0x0a,
+    0x0a,0x40,0x62,0x69,0x6e,0x64,0x69,0x6e,0x67,0x28,0x31,0x29,0x20,0x40,0x67,0x72,
+    0x6f,0x75,0x70,0x28,0x31,0x29,0x20,0x76,0x61,0x72,0x3c,0x73,0x74,0x6f,0x72,0x61,
+    0x67,0x65,0x2c,0x20,0x72,0x65,0x61,0x64,0x3e,0x20,0x78,0x5f,0x35,0x20,0x3a,0x20,
+    0x73,0x73,0x70,0x72,0x69,0x74,0x65,0x5f,0x73,0x62,0x75,0x66,0x3b,0x0a,0x0a,0x76,
+    0x61,0x72,0x3c,0x70,0x72,0x69,0x76,0x61,0x74,0x65,0x3e,0x20,0x67,0x6c,0x5f,0x49,
+    0x6e,0x73,0x74,0x61,0x6e,0x63,0x65,0x49,0x6e,0x64,0x65,0x78,0x20,0x3a,0x20,0x69,
+    0x33,0x32,0x3b,0x0a,0x0a,0x76,0x61,0x72,0x3c,0x70,0x72,0x69,0x76,0x61,0x74,0x65,
+    0x3e,0x20,0x67,0x6c,0x5f,0x56,0x65,0x72,0x74,0x65,0x78,0x49,0x6e,0x64,0x65,0x78,
+    0x20,0x3a,0x20,0x69,0x33,0x32,0x3b,0x0a,0x0a,0x76,0x61,0x72,0x3c,0x70,0x72,0x69,
+    0x76,0x61,0x74,0x65,0x3e,0x20,0x67,0x6c,0x5f,0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,
+    0x6e,0x20,0x3a,0x20,0x76,0x65,0x63,0x34,0x66,0x3b,0x0a,0x0a,0x76,0x61,0x72,0x3c,
+    0x70,0x72,0x69,0x76,0x61,0x74,0x65,0x3e,0x20,0x75,0x76,0x20,0x3a,0x20,0x76,0x65,
+    0x63,0x32,0x66,0x3b,0x0a,0x0a,0x76,0x61,0x72,0x3c,0x70,0x72,0x69,0x76,0x61,0x74,
+    0x65,0x3e,0x20,0x63,0x6f,0x6c,0x6f,0x72,0x20,0x3a,0x20,0x76,0x65,0x63,0x34,0x66,
+    0x3b,0x0a,0x0a,0x63,0x6f,0x6e,0x73,0x74,0x20,0x78,0x5f,0x35,0x37,0x20,0x3d,0x20,
+    0x61,0x72,0x72,0x61,0x79,0x3c,0x76,0x65,0x63,0x32,0x66,0x2c,0x20,0x36,0x75,0x3e,
+    0x28,0x76,0x65,0x63,0x32,0x66,0x28,0x2d,0x30,0x2e,0x35,0x66,0x2c,0x20,0x30,0x2e,
+    0x35,0x66,0x29,0x2c,0x20,0x76,0x65,0x63,0x32,0x66,0x28,0x30,0x2e,0x35,0x66,0x29,
+    0x2c,0x20,0x76,0x65,0x63,0x32,0x66,0x28,0x30,0x2e,0x35,0x66,0x2c,0x20,0x2d,0x30,
+    0x2e,0x35,0x66,0x29,0x2c,0x20,0x76,0x65,0x63,0x32,0x66,0x28,0x2d,0x30,0x2e,0x35,
+    0x66,0x2c,0x20,0x30,0x2e,0x35,0x66,0x29,0x2c,0x20,0x76,0x65,0x63,0x32,0x66,0x28,
+    0x30,0x2e,0x35,0x66,0x2c,0x20,0x2d,0x30,0x2e,0x35,0x66,0x29,0x2c,0x20,0x76,0x65,
+    0x63,0x32,0x66,0x28,0x2d,0x30,0x2e,0x35,0x66,0x29,0x29,0x3b,0x0a,0x0a,0x66,0x6e,
+    0x20,0x6d,0x61,0x69,0x6e,0x5f,0x31,0x28,0x29,0x20,0x7b,0x0a,0x20,0x20,0x76,0x61,
+    0x72,0x20,0x69,0x6e,0x64,0x65,0x78,0x61,0x62,0x6c,0x65,0x20,0x3a,0x20,0x61,0x72,
+    0x72,0x61,0x79,0x3c,0x76,0x65,0x63,0x32,0x66,0x2c,0x20,0x36,0x75,0x3e,0x3b,0x0a,
+    0x20,0x20,0x6c,0x65,0x74,0x20,0x69,0x64,0x78,0x20,0x3d,0x20,0x28,0x67,0x6c,0x5f,
+    0x49,0x6e,0x73,0x74,0x61,0x6e,0x63,0x65,0x49,0x6e,0x64,0x65,0x78,0x20,0x2b,0x20,
+    0x69,0x33,0x32,0x28,0x78,0x5f,0x34,0x2e,0x6d,0x69,0x73,0x63,0x2e,0x78,0x29,0x29,
+    0x3b,0x0a,0x20,0x20,0x69,0x6e,0x64,0x65,0x78,0x61,0x62,0x6c,0x65,0x20,0x3d,0x20,
+    0x78,0x5f,0x35,0x37,0x3b,0x0a,0x20,0x20,0x6c,0x65,0x74,0x20,0x63,0x20,0x3d,0x20,
+    0x69,0x6e,0x64,0x65,0x78,0x61,0x62,0x6c,0x65,0x5b,0x67,0x6c,0x5f,0x56,0x65,0x72,
+    0x74,0x65,0x78,0x49,0x6e,0x64,0x65,0x78,0x5d,0x3b,0x0a,0x20,0x20,0x76,0x61,0x72,
+    0x20,0x6f,0x66,0x73,0x20,0x3d,0x20,0x28,0x63,0x20,0x2a,0x20,0x76,0x65,0x63,0x32,
+    0x66,0x28,0x78,0x5f,0x35,0x2e,0x73,0x70,0x72,0x69,0x74,0x65,0x73,0x5b,0x69,0x64,
+    0x78,0x5d,0x2e,0x77,0x2c,0x20,0x78,0x5f,0x35,0x2e,0x73,0x70,0x72,0x69,0x74,0x65,
+    0x73,0x5b,0x69,0x64,0x78,0x5d,0x2e,0x68,0x29,0x29,0x3b,0x0a,0x20,0x20,0x6c,0x65,
+    0x74,0x20,0x73,0x6e,0x20,0x3d,0x20,0x73,0x69,0x6e,0x28,0x78,0x5f,0x35,0x2e,0x73,
+    0x70,0x72,0x69,0x74,0x65,0x73,0x5b,0x69,0x64,0x78,0x5d,0x2e,0x72,0x6f,0x74,0x29,
+    0x3b,0x0a,0x20,0x20,0x6c,0x65,0x74,0x20,0x63,0x73,0x20,0x3d,0x20,0x63,0x6f,0x73,
+    0x28,0x78,0x5f,0x35,0x2e,0x73,0x70,0x72,0x69,0x74,0x65,0x73,0x5b,0x69,0x64,0x78,
+    0x5d,0x2e,0x72,0x6f,0x74,0x29,0x3b,0x0a,0x20,0x20,0x6f,0x66,0x73,0x20,0x3d,0x20,
+    0x76,0x65,0x63,0x32,0x66,0x28,0x28,0x28,0x6f,0x66,0x73,0x2e,0x78,0x20,0x2a,0x20,
+    0x63,0x73,0x29,0x20,0x2d,0x20,0x28,0x6f,0x66,0x73,0x2e,0x79,0x20,0x2a,0x20,0x73,
+    0x6e,0x29,0x29,0x2c,0x20,0x28,0x28,0x6f,0x66,0x73,0x2e,0x78,0x20,0x2a,0x20,0x73,
+    0x6e,0x29,0x20,0x2b,0x20,0x28,0x6f,0x66,0x73,0x2e,0x79,0x20,0x2a,0x20,0x63,0x73,
+    0x29,0x29,0x29,0x3b,0x0a,0x20,0x20,0x6c,0x65,0x74,0x20,0x70,0x6f,0x73,0x20,0x3d,
+    0x20,0x28,0x28,0x76,0x65,0x63,0x33,0x66,0x28,0x78,0x5f,0x35,0x2e,0x73,0x70,0x72,
+    0x69,0x74,0x65,0x73,0x5b,0x69,0x64,0x78,0x5d,0x2e,0x78,0x2c,0x20,0x78,0x5f,0x35,
+    0x2e,0x73,0x70,0x72,0x69,0x74,0x65,0x73,0x5b,0x69,0x64,0x78,0x5d,0x2e,0x79,0x2c,
+    0x20,0x78,0x5f,0x35,0x2e,0x73,0x70,0x72,0x69,0x74,0x65,0x73,0x5b,0x69,0x64,0x78,
+    0x5d,0x2e,0x7a,0x29,0x20,0x2b,0x20,0x28,0x78,0x5f,0x34,0x2e,0x72,0x69,0x67,0x68,
+    0x74,0x2e,0x78,0x79,0x7a,0x20,0x2a,0x20,0x6f,0x66,0x73,0x2e,0x78,0x29,0x29,0x20,
+    0x2b,0x20,0x28,0x78,0x5f,0x34,0x2e,0x75,0x70,0x2e,0x78,0x79,0x7a,0x20,0x2a,0x20,
+    0x6f,0x66,0x73,0x2e,0x79,0x29,0x29,0x3b,0x0a,0x20,0x20,0x67,0x6c,0x5f,0x50,0x6f,
+    0x73,0x69,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x28,0x78,0x5f,0x34,0x2e,0x6d,0x76,
+    0x70,0x20,0x2a,0x20,0x76,0x65,0x63,0x34,0x66,0x28,0x70,0x6f,0x73,0x2e,0x78,0x2c,
+    0x20,0x70,0x6f,0x73,0x2e,0x79,0x2c,0x20,0x70,0x6f,0x73,0x2e,0x7a,0x2c,0x20,0x31,
+    0x2e,0x30,0x66,0x29,0x29,0x3b,0x0a,0x20,0x20,0x6c,0x65,0x74,0x20,0x75,0x76,0x30,
+    0x20,0x3d,0x20,0x75,0x6e,0x70,0x61,0x63,0x6b,0x32,0x78,0x31,0x36,0x75,0x6e,0x6f,
+    0x72,0x6d,0x28,0x78,0x5f,0x35,0x2e,0x73,0x70,0x72,0x69,0x74,0x65,0x73,0x5b,0x69,
+    0x64,0x78,0x5d,0x2e,0x75,0x76,0x30,0x29,0x3b,0x0a,0x20,0x20,0x6c,0x65,0x74,0x20,
+    0x75,0x76,0x31,0x20,0x3d,0x20,0x75,0x6e,0x70,0x61,0x63,0x6b,0x32,0x78,0x31,0x36,
+    0x75,0x6e,0x6f,0x72,0x6d,0x28,0x78,0x5f,0x35,0x2e,0x73,0x70,0x72,0x69,0x74,0x65,
+    0x73,0x5b,0x69,0x64,0x78,0x5d,0x2e,0x75,0x76,0x31,0x29,0x3b,0x0a,0x20,0x20,0x75,
+    0x76,0x20,0x3d,0x20,0x6d,0x69,0x78,0x28,0x75,0x76,0x30,0x2c,0x20,0x75,0x76,0x31,
+    0x2c,0x20,0x76,0x65,0x63,0x32,0x66,0x28,0x28,0x63,0x2e,0x78,0x20,0x2b,0x20,0x30,
+    0x2e,0x35,0x66,0x29,0x2c,0x20,0x28,0x30,0x2e,0x35,0x66,0x20,0x2d,0x20,0x63,0x2e,
+    0x79,0x29,0x29,0x29,0x3b,0x0a,0x20,0x20,0x63,0x6f,0x6c,0x6f,0x72,0x20,0x3d,0x20,
+    0x75,0x6e,0x70,0x61,0x63,0x6b,0x34,0x78,0x38,0x75,0x6e,0x6f,0x72,0x6d,0x28,0x78,
+    0x5f,0x35,0x2e,0x73,0x70,0x72,0x69,0x74,0x65,0x73,0x5b,0x69,0x64,0x78,0x5d,0x2e,
+    0x63,0x6f,0x6c,0x6f,0x72,0x29,0x3b,0x0a,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,
+    0x3b,0x0a,0x7d,0x0a,0x0a,0x73,0x74,0x72,0x75,0x63,0x74,0x20,0x6d,0x61,0x69,0x6e,
+    0x5f,0x6f,0x75,0x74,0x20,0x7b,0x0a,0x20,0x20,0x40,0x62,0x75,0x69,0x6c,0x74,0x69,
+    0x6e,0x28,0x70,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x29,0x0a,0x20,0x20,0x67,0x6c,
+    0x5f,0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x20,0x3a,0x20,0x76,0x65,0x63,0x34,
+    0x66,0x2c,0x0a,0x20,0x20,0x40,0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x28,0x30,
+    0x29,0x0a,0x20,0x20,0x75,0x76,0x5f,0x31,0x20,0x3a,0x20,0x76,0x65,0x63,0x32,0x66,
+    0x2c,0x0a,0x20,0x20,0x40,0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x28,0x31,0x29,
+    0x0a,0x20,0x20,0x63,0x6f,0x6c,0x6f,0x72,0x5f,0x31,0x20,0x3a,0x20,0x76,0x65,0x63,
+    0x34,0x66,0x2c,0x0a,0x7d,0x0a,0x0a,0x40,0x76,0x65,0x72,0x74,0x65,0x78,0x0a,0x66,
+    0x6e,0x20,0x6d,0x61,0x69,0x6e,0x28,0x40,0x62,0x75,0x69,0x6c,0x74,0x69,0x6e,0x28,
+    0x69,0x6e,0x73,0x74,0x61,0x6e,0x63,0x65,0x5f,0x69,0x6e,0x64,0x65,0x78,0x29,0x20,
+    0x67,0x6c,0x5f,0x49,0x6e,0x73,0x74,0x61,0x6e,0x63,0x65,0x49,0x6e,0x64,0x65,0x78,
+    0x5f,0x70,0x61,0x72,0x61,0x6d,0x20,0x3a,0x20,0x75,0x33,0x32,0x2c,0x20,0x40,0x62,
+    0x75,0x69,0x6c,0x74,0x69,0x6e,0x28,0x76,0x65,0x72,0x74,0x65,0x78,0x5f,0x69,0x6e,
+    0x64,0x65,0x78,0x29,0x20,0x67,0x6c,0x5f,0x56,0x65,0x72,0x74,0x65,0x78,0x49,0x6e,
+    0x64,0x65,0x78,0x5f,0x70,0x61,0x72,0x61,0x6d,0x20,0x3a,0x20,0x75,0x33,0x32,0x29,
+    0x20,0x2d,0x3e,0x20,0x6d,0x61,0x69,0x6e,0x5f,0x6f,0x75,0x74,0x20,0x7b,0x0a,0x20,
+    0x20,0x67,0x6c,0x5f,0x49,0x6e,0x73,0x74,0x61,0x6e,0x63,0x65,0x49,0x6e,0x64,0x65,
+    0x78,0x20,0x3d,0x20,0x62,0x69,0x74,0x63,0x61,0x73,0x74,0x3c,0x69,0x33,0x32,0x3e,
+    0x28,0x67,0x6c,0x5f,0x49,0x6e,0x73,0x74,0x61,0x6e,0x63,0x65,0x49,0x6e,0x64,0x65,
+    0x78,0x5f,0x70,0x61,0x72,0x61,0x6d,0x29,0x3b,0x0a,0x20,0x20,0x67,0x6c,0x5f,0x56,
+    0x65,0x72,0x74,0x65,0x78,0x49,0x6e,0x64,0x65,0x78,0x20,0x3d,0x20,0x62,0x69,0x74,
+    0x63,0x61,0x73,0x74,0x3c,0x69,0x33,0x32,0x3e,0x28,0x67,0x6c,0x5f,0x56,0x65,0x72,
+    0x74,0x65,0x78,0x49,0x6e,0x64,0x65,0x78,0x5f,0x70,0x61,0x72,0x61,0x6d,0x29,0x3b,
+    0x0a,0x20,0x20,0x6d,0x61,0x69,0x6e,0x5f,0x31,0x28,0x29,0x3b,0x0a,0x20,0x20,0x72,
+    0x65,0x74,0x75,0x72,0x6e,0x20,0x6d,0x61,0x69,0x6e,0x5f,0x6f,0x75,0x74,0x28,0x67,
+    0x6c,0x5f,0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x2c,0x20,0x75,0x76,0x2c,0x20,
+    0x63,0x6f,0x6c,0x6f,0x72,0x29,0x3b,0x0a,0x7d,0x0a,0x00,
+};
+static const uint8_t _ssprite_shd_fs_source_wgsl[585] = {
+    0x64,0x69,0x61,0x67,0x6e,0x6f,0x73,0x74,0x69,0x63,0x28,0x6f,0x66,0x66,0x2c,0x20,
+    0x64,0x65,0x72,0x69,0x76,0x61,0x74,0x69,0x76,0x65,0x5f,0x75,0x6e,0x69,0x66,0x6f,
+    0x72,0x6d,0x69,0x74,0x79,0x29,0x3b,0x0a,0x0a,0x76,0x61,0x72,0x3c,0x70,0x72,0x69,
+    0x76,0x61,0x74,0x65,0x3e,0x20,0x66,0x72,0x61,0x67,0x5f,0x63,0x6f,0x6c,0x6f,0x72,
+    0x20,0x3a,0x20,0x76,0x65,0x63,0x34,0x66,0x3b,0x0a,0x0a,0x40,0x62,0x69,0x6e,0x64,
+    0x69,0x6e,0x67,0x28,0x30,0x29,0x20,0x40,0x67,0x72,0x6f,0x75,0x70,0x28,0x31,0x29,
+    0x20,0x76,0x61,0x72,0x20,0x74,0x65,0x78,0x20,0x3a,0x20,0x74,0x65,0x78,0x74,0x75,
+    0x72,0x65,0x5f,0x32,0x64,0x3c,0x66,0x33,0x32,0x3e,0x3b,0x0a,0x0a,0x40,0x62,0x69,
+    0x6e,0x64,0x69,0x6e,0x67,0x28,0x33,0x32,0x29,0x20,0x40,0x67,0x72,0x6f,0x75,0x70,
+    0x28,0x31,0x29,0x20,0x76,0x61,0x72,0x20,0x73,0x6d,0x70,0x20,0x3a,0x20,0x73,0x61,
+    0x6d,0x70,0x6c,0x65,0x72,0x3b,0x0a,0x0a,0x76,0x61,0x72,0x3c,0x70,0x72,0x69,0x76,
+    0x61,0x74,0x65,0x3e,0x20,0x75,0x76,0x20,0x3a,0x20,0x76,0x65,0x63,0x32,0x66,0x3b,
+    0x0a,0x0a,0x76,0x61,0x72,0x3c,0x70,0x72,0x69,0x76,0x61,0x74,0x65,0x3e,0x20,0x63,
+    0x6f,0x6c,0x6f,0x72,0x20,0x3a,0x20,0x76,0x65,0x63,0x34,0x66,0x3b,0x0a,0x0a,0x66,
+    0x6e,0x20,0x6d,0x61,0x69,0x6e,0x5f,0x31,0x28,0x29,0x20,0x7b,0x0a,0x20,0x20,0x6c,
+    0x65,0x74,0x20,0x78,0x5f,0x32,0x33,0x20,0x3d,0x20,0x75,0x76,0x3b,0x0a,0x20,0x20,
+    0x6c,0x65,0x74,0x20,0x78,0x5f,0x32,0x35,0x20,0x3d,0x20,0x74,0x65,0x78,0x74,0x75,
+    0x72,0x65,0x53,0x61,0x6d,0x70,0x6c,0x65,0x28,0x74,0x65,0x78,0x2c,0x20,0x73,0x6d,
+    0x70,0x2c,0x20,0x78,0x5f,0x32,0x33,0x29,0x3b,0x0a,0x20,0x20,0x66,0x72,0x61,0x67,
+    0x5f,0x63,0x6f,0x6c,0x6f,0x72,0x20,0x3d,0x20,0x28,0x78,0x5f,0x32,0x35,0x20,0x2a,
+    0x20,0x63,0x6f,0x6c,0x6f,0x72,0x29,0x3b,0x0a,0x20,0x20,0x72,0x65,0x74,0x75,0x72,
+    0x6e,0x3b,0x0a,0x7d,0x0a,0x0a,0x73,0x74,0x72,0x75,0x63,0x74,0x20,0x6d,0x61,0x69,
+    0x6e,0x5f,0x6f,0x75,0x74,0x20,0x7b,0x0a,0x20,0x20,0x40,0x6c,0x6f,0x63,0x61,0x74,
+    0x69,0x6f,0x6e,0x28,0x30,0x29,0x0a,0x20,0x20,0x66,0x72,0x61,0x67,0x5f,0x63,0x6f,
+    0x6c,0x6f,0x72,0x5f,0x31,0x20,0x3a,0x20,0x76,0x65,0x63,0x34,0x66,0x2c,0x0a,0x7d,
+    0x0a,0x0a,0x40,0x66,0x72,0x61,0x67,0x6d,0x65,0x6e,0x74,0x0a,0x66,0x6e,0x20,0x6d,
+    0x61,0x69,0x6e,0x28,0x40,0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x28,0x30,0x29,
+    0x20,0x75,0x76,0x5f,0x70,0x61,0x72,0x61,0x6d,0x20,0x3a,0x20,0x76,0x65,0x63,0x32,
+    0x66,0x2c,0x20,0x40,0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x28,0x31,0x29,0x20,
+    0x63,0x6f,0x6c,0x6f,0x72,0x5f,0x70,0x61,0x72,0x61,0x6d,0x20,0x3a,0x20,0x76,0x65,
+    0x63,0x34,0x66,0x29,0x20,0x2d,0x3e,0x20,0x6d,0x61,0x69,0x6e,0x5f,0x6f,0x75,0x74,
+    0x20,0x7b,0x0a,0x20,0x20,0x75,0x76,0x20,0x3d,0x20,0x75,0x76,0x5f,0x70,0x61,0x72,
+    0x61,0x6d,0x3b,0x0a,0x20,0x20,0x63,0x6f,0x6c,0x6f,0x72,0x20,0x3d,0x20,0x63,0x6f,
+    0x6c,0x6f,0x72,0x5f,0x70,0x61,0x72,0x61,0x6d,0x3b,0x0a,0x20,0x20,0x6d,0x61,0x69,
+    0x6e,0x5f,0x31,0x28,0x29,0x3b,0x0a,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,
+    0x6d,0x61,0x69,0x6e,0x5f,0x6f,0x75,0x74,0x28,0x66,0x72,0x61,0x67,0x5f,0x63,0x6f,
+    0x6c,0x6f,0x72,0x29,0x3b,0x0a,0x7d,0x0a,0x00,
+};
+#elif defined(SOKOL_VULKAN)
+static const uint8_t _ssprite_shd_vs_bytecode_spirv_vk[3804] = {
+    0x03,0x02,0x23,0x07,0x00,0x04,0x01,0x00,0x0b,0x00,0x08,0x00,0x81,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x11,0x00,0x02,0x00,0x01,0x00,0x00,0x00,0x0b,0x00,0x06,0x00,
+    0x01,0x00,0x00,0x00,0x47,0x4c,0x53,0x4c,0x2e,0x73,0x74,0x64,0x2e,0x34,0x35,0x30,
+    0x00,0x00,0x00,0x00,0x0e,0x00,0x03,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00,
+    0x0f,0x00,0x0c,0x00,0x00,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x6d,0x61,0x69,0x6e,
+    0x00,0x00,0x00,0x00,0x03,0x00,0x00,0x00,0x04,0x00,0x00,0x00,0x05,0x00,0x00,0x00,
+    0x06,0x00,0x00,0x00,0x07,0x00,0x00,0x00,0x08,0x00,0x00,0x00,0x09,0x00,0x00,0x00,
+    0x03,0x00,0x03,0x00,0x02,0x00,0x00,0x00,0xcc,0x01,0x00,0x00,0x05,0x00,0x04,0x00,
+    0x02,0x00,0x00,0x00,0x6d,0x61,0x69,0x6e,0x00,0x00,0x00,0x00,0x05,0x00,0x06,0x00,
+    0x0a,0x00,0x00,0x00,0x67,0x6c,0x5f,0x50,0x65,0x72,0x56,0x65,0x72,0x74,0x65,0x78,
+    0x00,0x00,0x00,0x00,0x06,0x00,0x06,0x00,0x0a,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x67,0x6c,0x5f,0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x00,0x06,0x00,0x07,0x00,
+    0x0a,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x67,0x6c,0x5f,0x50,0x6f,0x69,0x6e,0x74,
+    0x53,0x69,0x7a,0x65,0x00,0x00,0x00,0x00,0x06,0x00,0x07,0x00,0x0a,0x00,0x00,0x00,
+    0x02,0x00,0x00,0x00,0x67,0x6c,0x5f,0x43,0x6c,0x69,0x70,0x44,0x69,0x73,0x74,0x61,
+    0x6e,0x63,0x65,0x00,0x06,0x00,0x07,0x00,0x0a,0x00,0x00,0x00,0x03,0x00,0x00,0x00,
+    0x67,0x6c,0x5f,0x43,0x75,0x6c,0x6c,0x44,0x69,0x73,0x74,0x61,0x6e,0x63,0x65,0x00,
+    0x05,0x00,0x03,0x00,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x05,0x00,0x05,0x00,
+    0x0b,0x00,0x00,0x00,0x76,0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x00,0x00,0x00,
+    0x06,0x00,0x04,0x00,0x0b,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x6d,0x76,0x70,0x00,
+    0x06,0x00,0x05,0x00,0x0b,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x72,0x69,0x67,0x68,
+    0x74,0x00,0x00,0x00,0x06,0x00,0x04,0x00,0x0b,0x00,0x00,0x00,0x02,0x00,0x00,0x00,
+    0x75,0x70,0x00,0x00,0x06,0x00,0x05,0x00,0x0b,0x00,0x00,0x00,0x03,0x00,0x00,0x00,
+    0x6d,0x69,0x73,0x63,0x00,0x00,0x00,0x00,0x05,0x00,0x03,0x00,0x04,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x05,0x00,0x04,0x00,0x0c,0x00,0x00,0x00,0x73,0x70,0x72,0x69,
+    0x74,0x65,0x00,0x00,0x06,0x00,0x04,0x00,0x0c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x78,0x00,0x00,0x00,0x06,0x00,0x04,0x00,0x0c,0x00,0x00,0x00,0x01,0x00,0x00,0x00,
+    0x79,0x00,0x00,0x00,0x06,0x00,0x04,0x00,0x0c,0x00,0x00,0x00,0x02,0x00,0x00,0x00,
+    0x7a,0x00,0x00,0x00,0x06,0x00,0x04,0x00,0x0c,0x00,0x00,0x00,0x03,0x00,0x00,0x00,
+    0x72,0x6f,0x74,0x00,0x06,0x00,0x04,0x00,0x0c,0x00,0x00,0x00,0x04,0x00,0x00,0x00,
+    0x77,0x00,0x00,0x00,0x06,0x00,0x04,0x00,0x0c,0x00,0x00,0x00,0x05,0x00,0x00,0x00,
+    0x68,0x00,0x00,0x00,0x06,0x00,0x04,0x00,0x0c,0x00,0x00,0x00,0x06,0x00,0x00,0x00,
+    0x75,0x76,0x30,0x00,0x06,0x00,0x04,0x00,0x0c,0x00,0x00,0x00,0x07,0x00,0x00,0x00,
+    0x75,0x76,0x31,0x00,0x06,0x00,0x05,0x00,0x0c,0x00,0x00,0x00,0x08,0x00,0x00,0x00,
+    0x63,0x6f,0x6c,0x6f,0x72,0x00,0x00,0x00,0x05,0x00,0x06,0x00,0x0d,0x00,0x00,0x00,
+    0x73,0x73,0x70,0x72,0x69,0x74,0x65,0x5f,0x73,0x62,0x75,0x66,0x00,0x00,0x00,0x00,
+    0x06,0x00,0x05,0x00,0x0d,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x73,0x70,0x72,0x69,
+    0x74,0x65,0x73,0x00,0x05,0x00,0x03,0x00,0x05,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x05,0x00,0x07,0x00,0x06,0x00,0x00,0x00,0x67,0x6c,0x5f,0x49,0x6e,0x73,0x74,0x61,
+    0x6e,0x63,0x65,0x49,0x6e,0x64,0x65,0x78,0x00,0x00,0x00,0x00,0x05,0x00,0x06,0x00,
+    0x07,0x00,0x00,0x00,0x67,0x6c,0x5f,0x56,0x65,0x72,0x74,0x65,0x78,0x49,0x6e,0x64,
+    0x65,0x78,0x00,0x00,0x05,0x00,0x05,0x00,0x0e,0x00,0x00,0x00,0x69,0x6e,0x64,0x65,
+    0x78,0x61,0x62,0x6c,0x65,0x00,0x00,0x00,0x05,0x00,0x03,0x00,0x08,0x00,0x00,0x00,
+    0x75,0x76,0x00,0x00,0x05,0x00,0x04,0x00,0x09,0x00,0x00,0x00,0x63,0x6f,0x6c,0x6f,
+    0x72,0x00,0x00,0x00,0x47,0x00,0x03,0x00,0x0a,0x00,0x00,0x00,0x02,0x00,0x00,0x00,
+    0x48,0x00,0x05,0x00,0x0a,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0b,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x48,0x00,0x05,0x00,0x0a,0x00,0x00,0x00,0x01,0x00,0x00,0x00,
+    0x0b,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x48,0x00,0x05,0x00,0x0a,0x00,0x00,0x00,
+    0x02,0x00,0x00,0x00,0x0b,0x00,0x00,0x00,0x03,0x00,0x00,0x00,0x48,0x00,0x05,0x00,
+    0x0a,0x00,0x00,0x00,0x03,0x00,0x00,0x00,0x0b,0x00,0x00,0x00,0x04,0x00,0x00,0x00,
+    0x47,0x00,0x03,0x00,0x0b,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x48,0x00,0x04,0x00,
+    0x0b,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x05,0x00,0x00,0x00,0x48,0x00,0x05,0x00,
+    0x0b,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x07,0x00,0x00,0x00,0x10,0x00,0x00,0x00,
+    0x48,0x00,0x05,0x00,0x0b,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x23,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x48,0x00,0x05,0x00,0x0b,0x00,0x00,0x00,0x01,0x00,0x00,0x00,
+    0x23,0x00,0x00,0x00,0x40,0x00,0x00,0x00,0x48,0x00,0x05,0x00,0x0b,0x00,0x00,0x00,
+    0x02,0x00,0x00,0x00,0x23,0x00,0x00,0x00,0x50,0x00,0x00,0x00,0x48,0x00,0x05,0x00,
+    0x0b,0x00,0x00,0x00,0x03,0x00,0x00,0x00,0x23,0x00,0x00,0x00,0x60,0x00,0x00,0x00,
+    0x47,0x00,0x04,0x00,0x04,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x47,0x00,0x04,0x00,0x04,0x00,0x00,0x00,0x22,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x48,0x00,0x05,0x00,0x0c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x23,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x48,0x00,0x05,0x00,0x0c,0x00,0x00,0x00,0x01,0x00,0x00,0x00,
+    0x23,0x00,0x00,0x00,0x04,0x00,0x00,0x00,0x48,0x00,0x05,0x00,0x0c,0x00,0x00,0x00,
+    0x02,0x00,0x00,0x00,0x23,0x00,0x00,0x00,0x08,0x00,0x00,0x00,0x48,0x00,0x05,0x00,
+    0x0c,0x00,0x00,0x00,0x03,0x00,0x00,0x00,0x23,0x00,0x00,0x00,0x0c,0x00,0x00,0x00,
+    0x48,0x00,0x05,0x00,0x0c,0x00,0x00,0x00,0x04,0x00,0x00,0x00,0x23,0x00,0x00,0x00,
+    0x10,0x00,0x00,0x00,0x48,0x00,0x05,0x00,0x0c,0x00,0x00,0x00,0x05,0x00,0x00,0x00,
+    0x23,0x00,0x00,0x00,0x14,0x00,0x00,0x00,0x48,0x00,0x05,0x00,0x0c,0x00,0x00,0x00,
+    0x06,0x00,0x00,0x00,0x23,0x00,0x00,0x00,0x18,0x00,0x00,0x00,0x48,0x00,0x05,0x00,
+    0x0c,0x00,0x00,0x00,0x07,0x00,0x00,0x00,0x23,0x00,0x00,0x00,0x1c,0x00,0x00,0x00,
+    0x48,0x00,0x05,0x00,0x0c,0x00,0x00,0x00,0x08,0x00,0x00,0x00,0x23,0x00,0x00,0x00,
+    0x20,0x00,0x00,0x00,0x47,0x00,0x04,0x00,0x0f,0x00,0x00,0x00,0x06,0x00,0x00,0x00,
+    0x24,0x00,0x00,0x00,0x47,0x00,0x03,0x00,0x0d,0x00,0x00,0x00,0x02,0x00,0x00,0x00,
+    0x48,0x00,0x04,0x00,0x0d,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x18,0x00,0x00,0x00,
+    0x48,0x00,0x05,0x00,0x0d,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x23,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x47,0x00,0x03,0x00,0x05,0x00,0x00,0x00,0x18,0x00,0x00,0x00,
+    0x47,0x00,0x04,0x00,0x05,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x01,0x00,0x00,0x00,
+    0x47,0x00,0x04,0x00,0x05,0x00,0x00,0x00,0x22,0x00,0x00,0x00,0x01,0x00,0x00,0x00,
+    0x47,0x00,0x04,0x00,0x06,0x00,0x00,0x00,0x0b,0x00,0x00,0x00,0x2b,0x00,0x00,0x00,
+    0x47,0x00,0x04,0x00,0x07,0x00,0x00,0x00,0x0b,0x00,0x00,0x00,0x2a,0x00,0x00,0x00,
+    0x47,0x00,0x04,0x00,0x08,0x00,0x00,0x00,0x1e,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x47,0x00,0x04,0x00,0x09,0x00,0x00,0x00,0x1e,0x00,0x00,0x00,0x01,0x00,0x00,0x00,
+    0x13,0x00,0x02,0x00,0x10,0x00,0x00,0x00,0x21,0x00,0x03,0x00,0x11,0x00,0x00,0x00,
+    0x10,0x00,0x00,0x00,0x16,0x00,0x03,0x00,0x12,0x00,0x00,0x00,0x20,0x00,0x00,0x00,
+    0x17,0x00,0x04,0x00,0x13,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x04,0x00,0x00,0x00,
+    0x15,0x00,0x04,0x00,0x14,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x2b,0x00,0x04,0x00,0x14,0x00,0x00,0x00,0x15,0x00,0x00,0x00,0x01,0x00,0x00,0x00,
+    0x1c,0x00,0x04,0x00,0x16,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x15,0x00,0x00,0x00,
+    0x1e,0x00,0x06,0x00,0x0a,0x00,0x00,0x00,0x13,0x00,0x00,0x00,0x12,0x00,0x00,0x00,
+    0x16,0x00,0x00,0x00,0x16,0x00,0x00,0x00,0x20,0x00,0x04,0x00,0x17,0x00,0x00,0x00,
+    0x03,0x00,0x00,0x00,0x0a,0x00,0x00,0x00,0x3b,0x00,0x04,0x00,0x17,0x00,0x00,0x00,
+    0x03,0x00,0x00,0x00,0x03,0x00,0x00,0x00,0x15,0x00,0x04,0x00,0x18,0x00,0x00,0x00,
+    0x20,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x2b,0x00,0x04,0x00,0x18,0x00,0x00,0x00,
+    0x19,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x18,0x00,0x04,0x00,0x1a,0x00,0x00,0x00,
+    0x13,0x00,0x00,0x00,0x04,0x00,0x00,0x00,0x1e,0x00,0x06,0x00,0x0b,0x00,0x00,0x00,
+    0x1a,0x00,0x00,0x00,0x13,0x00,0x00,0x00,0x13,0x00,0x00,0x00,0x13,0x00,0x00,0x00,
+    0x20,0x00,0x04,0x00,0x1b,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x0b,0x00,0x00,0x00,
+    0x3b,0x00,0x04,0x00,0x1b,0x00,0x00,0x00,0x04,0x00,0x00,0x00,0x02,0x00,0x00,0x00,
+    0x20,0x00,0x04,0x00,0x1c,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x1a,0x00,0x00,0x00,
+    0x20,0x00,0x04,0x00,0x1d,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x13,0x00,0x00,0x00,
+    0x20,0x00,0x04,0x00,0x1e,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x12,0x00,0x00,0x00,
+    0x1e,0x00,0x0b,0x00,0x0c,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x12,0x00,0x00,0x00,
+    0x12,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x12,0x00,0x00,0x00,
+    0x14,0x00,0x00,0x00,0x14,0x00,0x00,0x00,0x14,0x00,0x00,0x00,0x1d,0x00,0x03,0x00,
+    0x0f,0x00,0x00,0x00,0x0c,0x00,0x00,0x00,0x1e,0x00,0x03,0x00,0x0d,0x00,0x00,0x00,
+    0x0f,0x00,0x00,0x00,0x20,0x00,0x04,0x00,0x1f,0x00,0x00,0x00,0x0c,0x00,0x00,0x00,
+    0x0d,0x00,0x00,0x00,0x3b,0x00,0x04,0x00,0x1f,0x00,0x00,0x00,0x05,0x00,0x00,0x00,
+    0x0c,0x00,0x00,0x00,0x20,0x00,0x04,0x00,0x20,0x00,0x00,0x00,0x0c,0x00,0x00,0x00,
+    0x12,0x00,0x00,0x00,0x20,0x00,0x04,0x00,0x21,0x00,0x00,0x00,0x0c,0x00,0x00,0x00,
+    0x14,0x00,0x00,0x00,0x20,0x00,0x04,0x00,0x22,0x00,0x00,0x00,0x01,0x00,0x00,0x00,
+    0x18,0x00,0x00,0x00,0x3b,0x00,0x04,0x00,0x22,0x00,0x00,0x00,0x06,0x00,0x00,0x00,
+    0x01,0x00,0x00,0x00,0x3b,0x00,0x04,0x00,0x22,0x00,0x00,0x00,0x07,0x00,0x00,0x00,
+    0x01,0x00,0x00,0x00,0x2b,0x00,0x04,0x00,0x18,0x00,0x00,0x00,0x23,0x00,0x00,0x00,
+    0x01,0x00,0x00,0x00,0x2b,0x00,0x04,0x00,0x18,0x00,0x00,0x00,0x24,0x00,0x00,0x00,
+    0x02,0x00,0x00,0x00,0x2b,0x00,0x04,0x00,0x18,0x00,0x00,0x00,0x25,0x00,0x00,0x00,
+    0x03,0x00,0x00,0x00,0x2b,0x00,0x04,0x00,0x18,0x00,0x00,0x00,0x26,0x00,0x00,0x00,
+    0x04,0x00,0x00,0x00,0x2b,0x00,0x04,0x00,0x18,0x00,0x00,0x00,0x27,0x00,0x00,0x00,
+    0x05,0x00,0x00,0x00,0x2b,0x00,0x04,0x00,0x18,0x00,0x00,0x00,0x28,0x00,0x00,0x00,
+    0x06,0x00,0x00,0x00,0x2b,0x00,0x04,0x00,0x18,0x00,0x00,0x00,0x29,0x00,0x00,0x00,
+    0x07,0x00,0x00,0x00,0x2b,0x00,0x04,0x00,0x18,0x00,0x00,0x00,0x2a,0x00,0x00,0x00,
+    0x08,0x00,0x00,0x00,0x2b,0x00,0x04,0x00,0x14,0x00,0x00,0x00,0x2b,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x17,0x00,0x04,0x00,0x2c,0x00,0x00,0x00,0x12,0x00,0x00,0x00,
+    0x02,0x00,0x00,0x00,0x17,0x00,0x04,0x00,0x2d,0x00,0x00,0x00,0x12,0x00,0x00,0x00,
+    0x03,0x00,0x00,0x00,0x2b,0x00,0x04,0x00,0x14,0x00,0x00,0x00,0x2e,0x00,0x00,0x00,
+    0x06,0x00,0x00,0x00,0x1c,0x00,0x04,0x00,0x2f,0x00,0x00,0x00,0x2c,0x00,0x00,0x00,
+    0x2e,0x00,0x00,0x00,0x20,0x00,0x04,0x00,0x30,0x00,0x00,0x00,0x07,0x00,0x00,0x00,
+    0x2f,0x00,0x00,0x00,0x20,0x00,0x04,0x00,0x31,0x00,0x00,0x00,0x07,0x00,0x00,0x00,
+    0x2c,0x00,0x00,0x00,0x2b,0x00,0x04,0x00,0x12,0x00,0x00,0x00,0x32,0x00,0x00,0x00,
+    0x00,0x00,0x00,0xbf,0x2b,0x00,0x04,0x00,0x12,0x00,0x00,0x00,0x33,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x3f,0x2b,0x00,0x04,0x00,0x12,0x00,0x00,0x00,0x34,0x00,0x00,0x00,
+    0x00,0x00,0x80,0x3f,0x2c,0x00,0x05,0x00,0x2c,0x00,0x00,0x00,0x35,0x00,0x00,0x00,
+    0x32,0x00,0x00,0x00,0x33,0x00,0x00,0x00,0x2c,0x00,0x05,0x00,0x2c,0x00,0x00,0x00,
+    0x36,0x00,0x00,0x00,0x33,0x00,0x00,0x00,0x33,0x00,0x00,0x00,0x2c,0x00,0x05,0x00,
+    0x2c,0x00,0x00,0x00,0x37,0x00,0x00,0x00,0x33,0x00,0x00,0x00,0x32,0x00,0x00,0x00,
+    0x2c,0x00,0x05,0x00,0x2c,0x00,0x00,0x00,0x38,0x00,0x00,0x00,0x32,0x00,0x00,0x00,
+    0x32,0x00,0x00,0x00,0x2c,0x00,0x09,0x00,0x2f,0x00,0x00,0x00,0x39,0x00,0x00,0x00,
+    0x35,0x00,0x00,0x00,0x36,0x00,0x00,0x00,0x37,0x00,0x00,0x00,0x35,0x00,0x00,0x00,
+    0x37,0x00,0x00,0x00,0x38,0x00,0x00,0x00,0x20,0x00,0x04,0x00,0x3a,0x00,0x00,0x00,
+    0x03,0x00,0x00,0x00,0x13,0x00,0x00,0x00,0x20,0x00,0x04,0x00,0x3b,0x00,0x00,0x00,
+    0x03,0x00,0x00,0x00,0x2c,0x00,0x00,0x00,0x3b,0x00,0x04,0x00,0x3b,0x00,0x00,0x00,
+    0x08,0x00,0x00,0x00,0x03,0x00,0x00,0x00,0x3b,0x00,0x04,0x00,0x3a,0x00,0x00,0x00,
+    0x09,0x00,0x00,0x00,0x03,0x00,0x00,0x00,0x36,0x00,0x05,0x00,0x10,0x00,0x00,0x00,
+    0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x11,0x00,0x00,0x00,0xf8,0x00,0x02,0x00,
+    0x3c,0x00,0x00,0x00,0x3b,0x00,0x04,0x00,0x30,0x00,0x00,0x00,0x0e,0x00,0x00,0x00,
+    0x07,0x00,0x00,0x00,0x3d,0x00,0x04,0x00,0x18,0x00,0x00,0x00,0x3d,0x00,0x00,0x00,
+    0x06,0x00,0x00,0x00,0x41,0x00,0x06,0x00,0x1e,0x00,0x00,0x00,0x3e,0x00,0x00,0x00,
+    0x04,0x00,0x00,0x00,0x25,0x00,0x00,0x00,0x2b,0x00,0x00,0x00,0x3d,0x00,0x04,0x00,
+    0x12,0x00,0x00,0x00,0x3f,0x00,0x00,0x00,0x3e,0x00,0x00,0x00,0x6e,0x00,0x04,0x00,
+    0x18,0x00,0x00,0x00,0x40,0x00,0x00,0x00,0x3f,0x00,0x00,0x00,0x80,0x00,0x05,0x00,
+    0x18,0x00,0x00,0x00,0x41,0x00,0x00,0x00,0x3d,0x00,0x00,0x00,0x40,0x00,0x00,0x00,
+    0x3d,0x00,0x04,0x00,0x18,0x00,0x00,0x00,0x42,0x00,0x00,0x00,0x07,0x00,0x00,0x00,
+    0x3e,0x00,0x03,0x00,0x0e,0x00,0x00,0x00,0x39,0x00,0x00,0x00,0x41,0x00,0x05,0x00,
+    0x31,0x00,0x00,0x00,0x43,0x00,0x00,0x00,0x0e,0x00,0x00,0x00,0x42,0x00,0x00,0x00,
+    0x3d,0x00,0x04,0x00,0x2c,0x00,0x00,0x00,0x44,0x00,0x00,0x00,0x43,0x00,0x00,0x00,
+    0x41,0x00,0x07,0x00,0x20,0x00,0x00,0x00,0x45,0x00,0x00,0x00,0x05,0x00,0x00,0x00,
+    0x19,0x00,0x00,0x00,0x41,0x00,0x00,0x00,0x26,0x00,0x00,0x00,0x3d,0x00,0x04,0x00,
+    0x12,0x00,0x00,0x00,0x46,0x00,0x00,0x00,0x45,0x00,0x00,0x00,0x41,0x00,0x07,0x00,
+    0x20,0x00,0x00,0x00,0x47,0x00,0x00,0x00,0x05,0x00,0x00,0x00,0x19,0x00,0x00,0x00,
+    0x41,0x00,0x00,0x00,0x27,0x00,0x00,0x00,0x3d,0x00,0x04,0x00,0x12,0x00,0x00,0x00,
+    0x48,0x00,0x00,0x00,0x47,0x00,0x00,0x00,0x50,0x00,0x05,0x00,0x2c,0x00,0x00,0x00,
+    0x49,0x00,0x00,0x00,0x46,0x00,0x00,0x00,0x48,0x00,0x00,0x00,0x85,0x00,0x05,0x00,
+    0x2c,0x00,0x00,0x00,0x4a,0x00,0x00,0x00,0x44,0x00,0x00,0x00,0x49,0x00,0x00,0x00,
+    0x41,0x00,0x07,0x00,0x20,0x00,0x00,0x00,0x4b,0x00,0x00,0x00,0x05,0x00,0x00,0x00,
+    0x19,0x00,0x00,0x00,0x41,0x00,0x00,0x00,0x25,0x00,0x00,0x00,0x3d,0x00,0x04,0x00,
+    0x12,0x00,0x00,0x00,0x4c,0x00,0x00,0x00,0x4b,0x00,0x00,0x00,0x0c,0x00,0x06,0x00,
+    0x12,0x00,0x00,0x00,0x4d,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x0d,0x00,0x00,0x00,
+    0x4c,0x00,0x00,0x00,0x41,0x00,0x07,0x00,0x20,0x00,0x00,0x00,0x4e,0x00,0x00,0x00,
+    0x05,0x00,0x00,0x00,0x19,0x00,0x00,0x00,0x41,0x00,0x00,0x00,0x25,0x00,0x00,0x00,
+    0x3d,0x00,0x04,0x00,0x12,0x00,0x00,0x00,0x4f,0x00,0x00,0x00,0x4e,0x00,0x00,0x00,
+    0x0c,0x00,0x06,0x00,0x12,0x00,0x00,0x00,0x50,0x00,0x00,0x00,0x01,0x00,0x00,0x00,
+    0x0e,0x00,0x00,0x00,0x4f,0x00,0x00,0x00,0x51,0x00,0x05,0x00,0x12,0x00,0x00,0x00,
+    0x51,0x00,0x00,0x00,0x4a,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x51,0x00,0x05,0x00,
+    0x12,0x00,0x00,0x00,0x52,0x00,0x00,0x00,0x4a,0x00,0x00,0x00,0x01,0x00,0x00,0x00,
+    0x85,0x00,0x05,0x00,0x12,0x00,0x00,0x00,0x53,0x00,0x00,0x00,0x51,0x00,0x00,0x00,
+    0x50,0x00,0x00,0x00,0x85,0x00,0x05,0x00,0x12,0x00,0x00,0x00,0x54,0x00,0x00,0x00,
+    0x52,0x00,0x00,0x00,0x4d,0x00,0x00,0x00,0x83,0x00,0x05,0x00,0x12,0x00,0x00,0x00,
+    0x55,0x00,0x00,0x00,0x53,0x00,0x00,0x00,0x54,0x00,0x00,0x00,0x85,0x00,0x05,0x00,
+    0x12,0x00,0x00,0x00,0x56,0x00,0x00,0x00,0x51,0x00,0x00,0x00,0x4d,0x00,0x00,0x00,
+    0x85,0x00,0x05,0x00,0x12,0x00,0x00,0x00,0x57,0x00,0x00,0x00,0x52,0x00,0x00,0x00,
+    0x50,0x00,0x00,0x00,0x81,0x00,0x05,0x00,0x12,0x00,0x00,0x00,0x58,0x00,0x00,0x00,
+    0x56,0x00,0x00,0x00,0x57,0x00,0x00,0x00,0x41,0x00,0x07,0x00,0x20,0x00,0x00,0x00,
+    0x59,0x00,0x00,0x00,0x05,0x00,0x00,0x00,0x19,0x00,0x00,0x00,0x41,0x00,0x00,0x00,
+    0x19,0x00,0x00,0x00,0x3d,0x00,0x04,0x00,0x12,0x00,0x00,0x00,0x5a,0x00,0x00,0x00,
+    0x59,0x00,0x00,0x00,0x41,0x00,0x07,0x00,0x20,0x00,0x00,0x00,0x5b,0x00,0x00,0x00,
+    0x05,0x00,0x00,0x00,0x19,0x00,0x00,0x00,0x41,0x00,0x00,0x00,0x23,0x00,0x00,0x00,
+    0x3d,0x00,0x04,0x00,0x12,0x00,0x00,0x00,0x5c,0x00,0x00,0x00,0x5b,0x00,0x00,0x00,
+    0x41,0x00,0x07,0x00,0x20,0x00,0x00,0x00,0x5d,0x00,0x00,0x00,0x05,0x00,0x00,0x00,
+    0x19,0x00,0x00,0x00,0x41,0x00,0x00,0x00,0x24,0x00,0x00,0x00,0x3d,0x00,0x04,0x00,
+    0x12,0x00,0x00,0x00,0x5e,0x00,0x00,0x00,0x5d,0x00,0x00,0x00,0x50,0x00,0x06,0x00,
+    0x2d,0x00,0x00,0x00,0x5f,0x00,0x00,0x00,0x5a,0x00,0x00,0x00,0x5c,0x00,0x00,0x00,
+    0x5e,0x00,0x00,0x00,0x41,0x00,0x05,0x00,0x1d,0x00,0x00,0x00,0x60,0x00,0x00,0x00,
+    0x04,0x00,0x00,0x00,0x23,0x00,0x00,0x00,0x3d,0x00,0x04,0x00,0x13,0x00,0x00,0x00,
+    0x61,0x00,0x00,0x00,0x60,0x00,0x00,0x00,0x4f,0x00,0x08,0x00,0x2d,0x00,0x00,0x00,
+    0x62,0x00,0x00,0x00,0x61,0x00,0x00,0x00,0x61,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x01,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x8e,0x00,0x05,0x00,0x2d,0x00,0x00,0x00,
+    0x63,0x00,0x00,0x00,0x62,0x00,0x00,0x00,0x55,0x00,0x00,0x00,0x81,0x00,0x05,0x00,
+    0x2d,0x00,0x00,0x00,0x64,0x00,0x00,0x00,0x5f,0x00,0x00,0x00,0x63,0x00,0x00,0x00,
+    0x41,0x00,0x05,0x00,0x1d,0x00,0x00,0x00,0x65,0x00,0x00,0x00,0x04,0x00,0x00,0x00,
+    0x24,0x00,0x00,0x00,0x3d,0x00,0x04,0x00,0x13,0x00,0x00,0x00,0x66,0x00,0x00,0x00,
+    0x65,0x00,0x00,0x00,0x4f,0x00,0x08,0x00,0x2d,0x00,0x00,0x00,0x67,0x00,0x00,0x00,
+    0x66,0x00,0x00,0x00,0x66,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00,
+    0x02,0x00,0x00,0x00,0x8e,0x00,0x05,0x00,0x2d,0x00,0x00,0x00,0x68,0x00,0x00,0x00,
+    0x67,0x00,0x00,0x00,0x58,0x00,0x00,0x00,0x81,0x00,0x05,0x00,0x2d,0x00,0x00,0x00,
+    0x69,0x00,0x00,0x00,0x64,0x00,0x00,0x00,0x68,0x00,0x00,0x00,0x41,0x00,0x05,0x00,
+    0x1c,0x00,0x00,0x00,0x6a,0x00,0x00,0x00,0x04,0x00,0x00,0x00,0x19,0x00,0x00,0x00,
+    0x3d,0x00,0x04,0x00,0x1a,0x00,0x00,0x00,0x6b,0x00,0x00,0x00,0x6a,0x00,0x00,0x00,
+    0x51,0x00,0x05,0x00,0x12,0x00,0x00,0x00,0x6c,0x00,0x00,0x00,0x69,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x51,0x00,0x05,0x00,0x12,0x00,0x00,0x00,0x6d,0x00,0x00,0x00,
+    0x69,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x51,0x00,0x05,0x00,0x12,0x00,0x00,0x00,
+    0x6e,0x00,0x00,0x00,0x69,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x50,0x00,0x07,0x00,
+    0x13,0x00,0x00,0x00,0x6f,0x00,0x00,0x00,0x6c,0x00,0x00,0x00,0x6d,0x00,0x00,0x00,
+    0x6e,0x00,0x00,0x00,0x34,0x00,0x00,0x00,0x91,0x00,0x05,0x00,0x13,0x00,0x00,0x00,
+    0x70,0x00,0x00,0x00,0x6b,0x00,0x00,0x00,0x6f,0x00,0x00,0x00,0x41,0x00,0x05,0x00,
+    0x3a,0x00,0x00,0x00,0x71,0x00,0x00,0x00,0x03,0x00,0x00,0x00,0x19,0x00,0x00,0x00,
+    0x3e,0x00,0x03,0x00,0x71,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x41,0x00,0x07,0x00,
+    0x21,0x00,0x00,0x00,0x72,0x00,0x00,0x00,0x05,0x00,0x00,0x00,0x19,0x00,0x00,0x00,
+    0x41,0x00,0x00,0x00,0x28,0x00,0x00,0x00,0x3d,0x00,0x04,0x00,0x14,0x00,0x00,0x00,
+    0x73,0x00,0x00,0x00,0x72,0x00,0x00,0x00,0x0c,0x00,0x06,0x00,0x2c,0x00,0x00,0x00,
+    0x74,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x3e,0x00,0x00,0x00,0x73,0x00,0x00,0x00,
+    0x41,0x00,0x07,0x00,0x21,0x00,0x00,0x00,0x75,0x00,0x00,0x00,0x05,0x00,0x00,0x00,
+    0x19,0x00,0x00,0x00,0x41,0x00,0x00,0x00,0x29,0x00,0x00,0x00,0x3d,0x00,0x04,0x00,
+    0x14,0x00,0x00,0x00,0x76,0x00,0x00,0x00,0x75,0x00,0x00,0x00,0x0c,0x00,0x06,0x00,
+    0x2c,0x00,0x00,0x00,0x77,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x3e,0x00,0x00,0x00,
+    0x76,0x00,0x00,0x00,0x51,0x00,0x05,0x00,0x12,0x00,0x00,0x00,0x78,0x00,0x00,0x00,
+    0x44,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x81,0x00,0x05,0x00,0x12,0x00,0x00,0x00,
+    0x79,0x00,0x00,0x00,0x78,0x00,0x00,0x00,0x33,0x00,0x00,0x00,0x51,0x00,0x05,0x00,
+    0x12,0x00,0x00,0x00,0x7a,0x00,0x00,0x00,0x44,0x00,0x00,0x00,0x01,0x00,0x00,0x00,
+    0x83,0x00,0x05,0x00,0x12,0x00,0x00,0x00,0x7b,0x00,0x00,0x00,0x33,0x00,0x00,0x00,
+    0x7a,0x00,0x00,0x00,0x50,0x00,0x05,0x00,0x2c,0x00,0x00,0x00,0x7c,0x00,0x00,0x00,
+    0x79,0x00,0x00,0x00,0x7b,0x00,0x00,0x00,0x0c,0x00,0x08,0x00,0x2c,0x00,0x00,0x00,
+    0x7d,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x2e,0x00,0x00,0x00,0x74,0x00,0x00,0x00,
+    0x77,0x00,0x00,0x00,0x7c,0x00,0x00,0x00,0x3e,0x00,0x03,0x00,0x08,0x00,0x00,0x00,
+    0x7d,0x00,0x00,0x00,0x41,0x00,0x07,0x00,0x21,0x00,0x00,0x00,0x7e,0x00,0x00,0x00,
+    0x05,0x00,0x00,0x00,0x19,0x00,0x00,0x00,0x41,0x00,0x00,0x00,0x2a,0x00,0x00,0x00,
+    0x3d,0x00,0x04,0x00,0x14,0x00,0x00,0x00,0x7f,0x00,0x00,0x00,0x7e,0x00,0x00,0x00,
+    0x0c,0x00,0x06,0x00,0x13,0x00,0x00,0x00,0x80,0x00,0x00,0x00,0x01,0x00,0x00,0x00,
+    0x40,0x00,0x00,0x00,0x7f,0x00,0x00,0x00,0x3e,0x00,0x03,0x00,0x09,0x00,0x00,0x00,
+    0x80,0x00,0x00,0x00,0xfd,0x00,0x01,0x00,0x38,0x00,0x01,0x00,
+};
+static const uint8_t _ssprite_shd_fs_bytecode_spirv_vk[780] = {
+    0x03,0x02,0x23,0x07,0x00,0x04,0x01,0x00,0x0b,0x00,0x08,0x00,0x1d,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x11,0x00,0x02,0x00,0x01,0x00,0x00,0x00,0x0b,0x00,0x06,0x00,
+    0x01,0x00,0x00,0x00,0x47,0x4c,0x53,0x4c,0x2e,0x73,0x74,0x64,0x2e,0x34,0x35,0x30,
+    0x00,0x00,0x00,0x00,0x0e,0x00,0x03,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00,
+    0x0f,0x00,0x0a,0x00,0x04,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x6d,0x61,0x69,0x6e,
+    0x00,0x00,0x00,0x00,0x03,0x00,0x00,0x00,0x04,0x00,0x00,0x00,0x05,0x00,0x00,0x00,
+    0x06,0x00,0x00,0x00,0x07,0x00,0x00,0x00,0x10,0x00,0x03,0x00,0x02,0x00,0x00,0x00,
+    0x07,0x00,0x00,0x00,0x03,0x00,0x03,0x00,0x02,0x00,0x00,0x00,0xcc,0x01,0x00,0x00,
+    0x05,0x00,0x04,0x00,0x02,0x00,0x00,0x00,0x6d,0x61,0x69,0x6e,0x00,0x00,0x00,0x00,
+    0x05,0x00,0x05,0x00,0x03,0x00,0x00,0x00,0x66,0x72,0x61,0x67,0x5f,0x63,0x6f,0x6c,
+    0x6f,0x72,0x00,0x00,0x05,0x00,0x03,0x00,0x04,0x00,0x00,0x00,0x74,0x65,0x78,0x00,
+    0x05,0x00,0x03,0x00,0x05,0x00,0x00,0x00,0x73,0x6d,0x70,0x00,0x05,0x00,0x03,0x00,
+    0x06,0x00,0x00,0x00,0x75,0x76,0x00,0x00,0x05,0x00,0x04,0x00,0x07,0x00,0x00,0x00,
+    0x63,0x6f,0x6c,0x6f,0x72,0x00,0x00,0x00,0x47,0x00,0x04,0x00,0x03,0x00,0x00,0x00,
+    0x1e,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x47,0x00,0x04,0x00,0x04,0x00,0x00,0x00,
+    0x21,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x47,0x00,0x04,0x00,0x04,0x00,0x00,0x00,
+    0x22,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x47,0x00,0x04,0x00,0x05,0x00,0x00,0x00,
+    0x21,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x47,0x00,0x04,0x00,0x05,0x00,0x00,0x00,
+    0x22,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x47,0x00,0x04,0x00,0x06,0x00,0x00,0x00,
+    0x1e,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x47,0x00,0x04,0x00,0x07,0x00,0x00,0x00,
+    0x1e,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x13,0x00,0x02,0x00,0x08,0x00,0x00,0x00,
+    0x21,0x00,0x03,0x00,0x09,0x00,0x00,0x00,0x08,0x00,0x00,0x00,0x16,0x00,0x03,0x00,
+    0x0a,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x17,0x00,0x04,0x00,0x0b,0x00,0x00,0x00,
+    0x0a,0x00,0x00,0x00,0x04,0x00,0x00,0x00,0x20,0x00,0x04,0x00,0x0c,0x00,0x00,0x00,
+    0x03,0x00,0x00,0x00,0x0b,0x00,0x00,0x00,0x3b,0x00,0x04,0x00,0x0c,0x00,0x00,0x00,
+    0x03,0x00,0x00,0x00,0x03,0x00,0x00,0x00,0x19,0x00,0x09,0x00,0x0d,0x00,0x00,0x00,
+    0x0a,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x04,0x00,
+    0x0e,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0d,0x00,0x00,0x00,0x3b,0x00,0x04,0x00,
+    0x0e,0x00,0x00,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1a,0x00,0x02,0x00,
+    0x0f,0x00,0x00,0x00,0x20,0x00,0x04,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x0f,0x00,0x00,0x00,0x3b,0x00,0x04,0x00,0x10,0x00,0x00,0x00,0x05,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x1b,0x00,0x03,0x00,0x11,0x00,0x00,0x00,0x0d,0x00,0x00,0x00,
+    0x17,0x00,0x04,0x00,0x12,0x00,0x00,0x00,0x0a,0x00,0x00,0x00,0x02,0x00,0x00,0x00,
+    0x20,0x00,0x04,0x00,0x13,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x12,0x00,0x00,0x00,
+    0x3b,0x00,0x04,0x00,0x13,0x00,0x00,0x00,0x06,0x00,0x00,0x00,0x01,0x00,0x00,0x00,
+    0x20,0x00,0x04,0x00,0x14,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x0b,0x00,0x00,0x00,
+    0x3b,0x00,0x04,0x00,0x14,0x00,0x00,0x00,0x07,0x00,0x00,0x00,0x01,0x00,0x00,0x00,
+    0x36,0x00,0x05,0x00,0x08,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x09,0x00,0x00,0x00,0xf8,0x00,0x02,0x00,0x15,0x00,0x00,0x00,0x3d,0x00,0x04,0x00,
+    0x0d,0x00,0x00,0x00,0x16,0x00,0x00,0x00,0x04,0x00,0x00,0x00,0x3d,0x00,0x04,0x00,
+    0x0f,0x00,0x00,0x00,0x17,0x00,0x00,0x00,0x05,0x00,0x00,0x00,0x56,0x00,0x05,0x00,
+    0x11,0x00,0x00,0x00,0x18,0x00,0x00,0x00,0x16,0x00,0x00,0x00,0x17,0x00,0x00,0x00,
+    0x3d,0x00,0x04,0x00,0x12,0x00,0x00,0x00,0x19,0x00,0x00,0x00,0x06,0x00,0x00,0x00,
+    0x57,0x00,0x05,0x00,0x0b,0x00,0x00,0x00,0x1a,0x00,0x00,0x00,0x18,0x00,0x00,0x00,
+    0x19,0x00,0x00,0x00,0x3d,0x00,0x04,0x00,0x0b,0x00,0x00,0x00,0x1b,0x00,0x00,0x00,
+    0x07,0x00,0x00,0x00,0x85,0x00,0x05,0x00,0x0b,0x00,0x00,0x00,0x1c,0x00,0x00,0x00,
+    0x1a,0x00,0x00,0x00,0x1b,0x00,0x00,0x00,0x3e,0x00,0x03,0x00,0x03,0x00,0x00,0x00,
+    0x1c,0x00,0x00,0x00,0xfd,0x00,0x01,0x00,0x38,0x00,0x01,0x00,
+};
+#elif defined(SOKOL_DUMMY_BACKEND)
+static const char* _ssprite_shd_vs_source_dummy = "";
+static const char* _ssprite_shd_fs_source_dummy = "";
+#else
+#error "Please define one of SOKOL_GLCORE, SOKOL_GLES3, SOKOL_D3D11, SOKOL_METAL, SOKOL_WGPU, SOKOL_VULKAN or SOKOL_DUMMY_BACKEND!"
+#endif
+//<#shdgen
+
+// >>structs
+enum {
+    _SSPRITE_DEFAULT_MAX_SPRITES = 65536,
+    _SSPRITE_DEFAULT_MAX_BATCHES = 256,
+    _SSPRITE_DEFAULT_GROUP_SIZE = 64,
+    _SSPRITE_VIEWSLOT_TEXTURE = 0,
+    _SSPRITE_VIEWSLOT_SPRITES = 1,
+};
+
+// the vertex shader uniform block, misc.x is the first sprite index
+typedef struct {
+    ssprite_mat4_t mvp;
+    float right[4];
+    float up[4];
+    float misc[4];
+} _ssprite_uniforms_t;
+
+typedef struct {
+    ssprite_batch_desc desc;
+    int first;
+    int num;
+} _ssprite_batch_t;
+
+typedef struct {
+    uint32_t init_tag;
+    ssprite_desc desc;
+    bool valid;             // false if storage buffers or a shader are not available
+    int num_sprites;
+    ssprite_sprite* sprites;
+    int num_batches;
+    _ssprite_batch_t* batches;
+    sg_shader shd;
+    bool own_shd;
+    sg_pipeline pip[_SSPRITE_BLENDMODE_NUM];
+    sg_buffer sbuf;
+    sg_view sbuf_view;
+    sg_buffer gpu_sbuf;
+    sg_view gpu_sbuf_view;
+    sg_image white_img;
+    sg_view white_view;
+    sg_sampler def_smp;
+    ssprite_stats stats;
+} _ssprite_state_t;
+static _ssprite_state_t _ssprite;
+
+// >>logging
+#if defined(SOKOL_DEBUG)
+#define _SSPRITE_LOGITEM_XMACRO(item,msg) #item ": " msg,
+static const char* _ssprite_log_messages[] = {
+    _SSPRITE_LOG_ITEMS
+};
+#undef _SSPRITE_LOGITEM_XMACRO
+#endif // SOKOL_DEBUG
+
+#define _SSPRITE_PANIC(code) _ssprite_log(SSPRITE_LOGITEM_ ##code, 0, __LINE__)
+#define _SSPRITE_ERROR(code) _ssprite_log(SSPRITE_LOGITEM_ ##code, 1, __LINE__)
+#define _SSPRITE_WARN(code) _ssprite_log(SSPRITE_LOGITEM_ ##code, 2, __LINE__)
+#define _SSPRITE_INFO(code) _ssprite_log(SSPRITE_LOGITEM_ ##code, 3, __LINE__)
+
+static void _ssprite_log(ssprite_log_item log_item, uint32_t log_level, uint32_t line_nr) {
+    if (_ssprite.desc.logger.func) {
+        const char* filename = 0;
+        const char* msg = 0;
+        #if defined(SOKOL_DEBUG)
+            filename = __FILE__;
+            msg = _ssprite_log_messages[log_item];
+        #endif
+        _ssprite.desc.logger.func("ssprite", log_level, (uint32_t)log_item, msg, line_nr, filename, _ssprite.desc.logger.user_data);
+    } else {
+        // for log level PANIC it would be 'undefined behaviour' to continue
+        if (log_level == 0) {
+            abort();
+        }
+    }
+}
+
+// >>memory
+static void _ssprite_clear(void* ptr, size_t size) {
+    SOKOL_ASSERT(ptr && (size > 0));
+    memset(ptr, 0, size);
+}
+
+static void* _ssprite_malloc(size_t size) {
+    SOKOL_ASSERT(size > 0);
+    void* ptr;
+    if (_ssprite.desc.allocator.alloc_fn) {
+        ptr = _ssprite.desc.allocator.alloc_fn(size, _ssprite.desc.allocator.user_data);
+    } else {
+        ptr = malloc(size);
+    }
+    if (0 == ptr) {
+        _SSPRITE_PANIC(MALLOC_FAILED);
+    }
+    return ptr;
+}
+
+static void* _ssprite_malloc_clear(size_t size) {
+    void* ptr = _ssprite_malloc(size);
+    _ssprite_clear(ptr, size);
+    return ptr;
+}
+
+static void _ssprite_free(void* ptr) {
+    if (_ssprite.desc.allocator.free_fn) {
+        _ssprite.desc.allocator.free_fn(ptr, _ssprite.desc.allocator.user_data);
+    } else {
+        free(ptr);
+    }
+}
+
+// >>misc
+static bool _ssprite_mat4_isnull(const ssprite_mat4_t* m) {
+    for (int y = 0; y < 4; y++) {
+        for (int x = 0; x < 4; x++) {
+            if (0.0f != m->m[y][x]) {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+static ssprite_mat4_t _ssprite_mat4_identity(void) {
+    ssprite_mat4_t m = {
+        {
+            { 1.0f, 0.0f, 0.0f, 0.0f },
+            { 0.0f, 1.0f, 0.0f, 0.0f },
+            { 0.0f, 0.0f, 1.0f, 0.0f },
+            { 0.0f, 0.0f, 0.0f, 1.0f }
+        }
+    };
+    return m;
+}
+
+static bool _ssprite_vec3_isnull(const float v[3]) {
+    return (0.0f == v[0]) && (0.0f == v[1]) && (0.0f == v[2]);
+}
+
+static ssprite_desc _ssprite_desc_defaults(const ssprite_desc* desc) {
+    SOKOL_ASSERT(desc);
+    ssprite_desc res = *desc;
+    res.max_sprites = _ssprite_def(res.max_sprites, _SSPRITE_DEFAULT_MAX_SPRITES);
+    res.max_batches = _ssprite_def(res.max_batches, _SSPRITE_DEFAULT_MAX_BATCHES);
+    return res;
+}
+
+static ssprite_batch_desc _ssprite_batch_desc_defaults(const ssprite_batch_desc* desc) {
+    SOKOL_ASSERT(desc);
+    ssprite_batch_desc res = *desc;
+    res.texture.id = _ssprite_def(res.texture.id, _ssprite.white_view.id);
+    res.sampler.id = _ssprite_def(res.sampler.id, _ssprite.def_smp.id);
+    res.mvp = _ssprite_mat4_isnull(&res.mvp) ? _ssprite_mat4_identity() : res.mvp;
+    if (_ssprite_vec3_isnull(res.right)) {
+        res.right[0] = 1.0f;
+    }
+    if (_ssprite_vec3_isnull(res.up)) {
+        res.up[1] = 1.0f;
+    }
+    res.blend_mode = _ssprite_def(res.blend_mode, SSPRITE_BLENDMODE_ALPHA);
+    return res;
+}
+
+static bool _ssprite_batch_desc_equal(const ssprite_batch_desc* a, const ssprite_batch_desc* b) {
+    return (a->texture.id == b->texture.id)
+        && (a->sampler.id == b->sampler.id)
+        && (a->blend_mode == b->blend_mode)
+        && (0 == memcmp(&a->mvp, &b->mvp, sizeof(a->mvp)))
+        && (0 == memcmp(a->right, b->right, sizeof(a->right)))
+        && (0 == memcmp(a->up, b->up, sizeof(a->up)));
+}
+
+static void _ssprite_reset(void) {
+    _ssprite.num_sprites = 0;
+    _ssprite.num_batches = 0;
+}
+
+// make sure there's a batch to add sprites to
+static _ssprite_batch_t* _ssprite_cur_batch(void) {
+    if (0 == _ssprite.num_batches) {
+        ssprite_batch_desc desc;
+        _ssprite_clear(&desc, sizeof(desc));
+        ssprite_batch(&desc);
+    }
+    if (0 == _ssprite.num_batches) {
+        return 0;
+    }
+    return &_ssprite.batches[_ssprite.num_batches - 1];
+}
+
+static void _ssprite_apply_batch(const ssprite_batch_desc* desc, const sg_view sbuf_view, int first_sprite) {
+    sg_bindings bnd;
+    _ssprite_clear(&bnd, sizeof(bnd));
+    bnd.views[_SSPRITE_VIEWSLOT_TEXTURE] = desc->texture;
+    bnd.views[_SSPRITE_VIEWSLOT_SPRITES] = sbuf_view;
+    bnd.samplers[0] = desc->sampler;
+    sg_apply_bindings(&bnd);
+    _ssprite_uniforms_t ub;
+    _ssprite_clear(&ub, sizeof(ub));
+    ub.mvp = desc->mvp;
+    memcpy(ub.right, desc->right, sizeof(desc->right));
+    memcpy(ub.up, desc->up, sizeof(desc->up));
+    ub.misc[0] = (float)first_sprite;
+    const sg_range range = { &ub, sizeof(ub) };
+    sg_apply_uniforms(0, &range);
+}
+
+static void _ssprite_init_shader(void) {
+    if (_ssprite.desc.shader.id != SG_INVALID_ID) {
+        _ssprite.shd = _ssprite.desc.shader;
+        return;
+    }
+    sg_shader_desc shd_desc;
+    _ssprite_clear(&shd_desc, sizeof(shd_desc));
+    shd_desc.uniform_blocks[0].stage = SG_SHADERSTAGE_VERTEX;
+    shd_desc.uniform_blocks[0].size = sizeof(_ssprite_uniforms_t);
+    shd_desc.uniform_blocks[0].hlsl_register_b_n = 0;
+    shd_desc.uniform_blocks[0].msl_buffer_n = 0;
+    shd_desc.uniform_blocks[0].wgsl_group0_binding_n = 0;
+    shd_desc.uniform_blocks[0].spirv_set0_binding_n = 0;
+    shd_desc.uniform_blocks[0].glsl_uniforms[0].glsl_name = "vs_params";
+    shd_desc.uniform_blocks[0].glsl_uniforms[0].type = SG_UNIFORMTYPE_FLOAT4;
+    shd_desc.uniform_blocks[0].glsl_uniforms[0].array_count = 7;
+    shd_desc.views[_SSPRITE_VIEWSLOT_TEXTURE].texture.stage = SG_SHADERSTAGE_FRAGMENT;
+    shd_desc.views[_SSPRITE_VIEWSLOT_TEXTURE].texture.image_type = SG_IMAGETYPE_2D;
+    shd_desc.views[_SSPRITE_VIEWSLOT_TEXTURE].texture.sample_type = SG_IMAGESAMPLETYPE_FLOAT;
+    shd_desc.views[_SSPRITE_VIEWSLOT_TEXTURE].texture.hlsl_register_t_n = 0;
+    shd_desc.views[_SSPRITE_VIEWSLOT_TEXTURE].texture.msl_texture_n = 0;
+    shd_desc.views[_SSPRITE_VIEWSLOT_TEXTURE].texture.wgsl_group1_binding_n = 0;
+    shd_desc.views[_SSPRITE_VIEWSLOT_TEXTURE].texture.spirv_set1_binding_n = 0;
+    shd_desc.views[_SSPRITE_VIEWSLOT_SPRITES].storage_buffer.stage = SG_SHADERSTAGE_VERTEX;
+    shd_desc.views[_SSPRITE_VIEWSLOT_SPRITES].storage_buffer.readonly = true;
+    shd_desc.views[_SSPRITE_VIEWSLOT_SPRITES].storage_buffer.hlsl_register_t_n = 0;
+    shd_desc.views[_SSPRITE_VIEWSLOT_SPRITES].storage_buffer.msl_buffer_n = 8;
+    shd_desc.views[_SSPRITE_VIEWSLOT_SPRITES].storage_buffer.wgsl_group1_binding_n = 1;
+    shd_desc.views[_SSPRITE_VIEWSLOT_SPRITES].storage_buffer.spirv_set1_binding_n = 1;
+    shd_desc.views[_SSPRITE_VIEWSLOT_SPRITES].storage_buffer.glsl_binding_n = 0;
+    shd_desc.samplers[0].stage = SG_SHADERSTAGE_FRAGMENT;
+    shd_desc.samplers[0].sampler_type = SG_SAMPLERTYPE_FILTERING;
+    shd_desc.samplers[0].hlsl_register_s_n = 0;
+    shd_desc.samplers[0].msl_sampler_n = 0;
+    shd_desc.samplers[0].wgsl_group1_binding_n = 32;
+    shd_desc.samplers[0].spirv_set1_binding_n = 32;
+    shd_desc.texture_sampler_pairs[0].stage = SG_SHADERSTAGE_FRAGMENT;
+    shd_desc.texture_sampler_pairs[0].view_slot = _SSPRITE_VIEWSLOT_TEXTURE;
+    shd_desc.texture_sampler_pairs[0].sampler_slot = 0;
+    shd_desc.texture_sampler_pairs[0].glsl_name = "tex_smp";
+    shd_desc.label = "ssprite-shader";
+    #if defined(SOKOL_GLCORE)
+        shd_desc.vertex_func.source = (const char*)_ssprite_shd_vs_source_glsl430;
+        shd_desc.fragment_func.source = (const char*)_ssprite_shd_fs_source_glsl430;
+    #elif defined(SOKOL_GLES3)
+        shd_desc.vertex_func.source = (const char*)_ssprite_shd_vs_source_glsl310es;
+        shd_desc.fragment_func.source = (const char*)_ssprite_shd_fs_source_glsl310es;
+    #elif defined(SOKOL_METAL)
+        shd_desc.vertex_func.entry = "main0";
+        shd_desc.fragment_func.entry = "main0";
+        switch (sg_query_backend()) {
+            case SG_BACKEND_METAL_MACOS:
+                shd_desc.vertex_func.source = (const char*)_ssprite_shd_vs_source_metal_macos;
+                shd_desc.fragment_func.source = (const char*)_ssprite_shd_fs_source_metal_macos;
+                break;
+            case SG_BACKEND_METAL_IOS:
+                shd_desc.vertex_func.source = (const char*)_ssprite_shd_vs_source_metal_ios;
+                shd_desc.fragment_func.source = (const char*)_ssprite_shd_fs_source_metal_ios;
+                break;
+            default:
+                shd_desc.vertex_func.source = (const char*)_ssprite_shd_vs_source_metal_sim;
+                shd_desc.fragment_func.source = (const char*)_ssprite_shd_fs_source_metal_sim;
+                break;
+        }
+    #elif defined(SOKOL_D3D11)
+        shd_desc.vertex_func.source = (const char*)_ssprite_shd_vs_source_hlsl5;
+        shd_desc.vertex_func.d3d11_target = "vs_5_0";
+        shd_desc.fragment_func.source = (const char*)_ssprite_shd_fs_source_hlsl5;
+        shd_desc.fragment_func.d3d11_target = "ps_5_0";
+    #elif defined(SOKOL_WGPU)
+        shd_desc.vertex_func.source = (const char*)_ssprite_shd_vs_source_wgsl;
+        shd_desc.fragment_func.source = (const char*)_ssprite_shd_fs_source_wgsl;
+    #elif defined(SOKOL_VULKAN)
+        shd_desc.vertex_func.bytecode = SG_RANGE(_ssprite_shd_vs_bytecode_spirv_vk);
+        shd_desc.vertex_func.entry = "main";
+        shd_desc.fragment_func.bytecode = SG_RANGE(_ssprite_shd_fs_bytecode_spirv_vk);
+        shd_desc.fragment_func.entry = "main";
+    #else
+        shd_desc.vertex_func.source = _ssprite_shd_vs_source_dummy;
+        shd_desc.fragment_func.source = _ssprite_shd_fs_source_dummy;
+    #endif
+    _ssprite.shd = sg_make_shader(&shd_desc);
+    _ssprite.own_shd = true;
+}
+
+static void _ssprite_init_resources(void) {
+    sg_push_debug_group("sokol-sprite");
+
+    // the stream buffer for CPU sprites, and the optional GPU sprite buffer
+    sg_buffer_desc sbuf_desc;
+    _ssprite_clear(&sbuf_desc, sizeof(sbuf_desc));
+    sbuf_desc.size = (size_t)_ssprite.desc.max_sprites * sizeof(ssprite_sprite);
+    sbuf_desc.usage.storage_buffer = true;
+    sbuf_desc.usage.stream_update = true;
+    sbuf_desc.label = "ssprite-sbuf";
+    _ssprite.sbuf = sg_make_buffer(&sbuf_desc);
+    sg_view_desc view_desc;
+    _ssprite_clear(&view_desc, sizeof(view_desc));
+    view_desc.storage_buffer.buffer = _ssprite.sbuf;
+    view_desc.label = "ssprite-sbuf-view";
+    _ssprite.sbuf_view = sg_make_view(&view_desc);
+    if (_ssprite.desc.max_gpu_sprites > 0) {
+        _ssprite_clear(&sbuf_desc, sizeof(sbuf_desc));
+        sbuf_desc.size = (size_t)_ssprite.desc.max_gpu_sprites * sizeof(ssprite_sprite);
+        sbuf_desc.usage.storage_buffer = true;
+        sbuf_desc.data = _ssprite.desc.gpu_sprites;
+        sbuf_desc.label = "ssprite-gpu-sbuf";
+        _ssprite.gpu_sbuf = sg_make_buffer(&sbuf_desc);
+        _ssprite_clear(&view_desc, sizeof(view_desc));
+        view_desc.storage_buffer.buffer = _ssprite.gpu_sbuf;
+        view_desc.label = "ssprite-gpu-sbuf-view";
+        _ssprite.gpu_sbuf_view = sg_make_view(&view_desc);
+    }
+
+    // default texture and sampler
+    uint32_t pixels[4 * 4];
+    for (int i = 0; i < (4 * 4); i++) {
+        pixels[i] = 0xFFFFFFFF;
+    }
+    sg_image_desc img_desc;
+    _ssprite_clear(&img_desc, sizeof(img_desc));
+    img_desc.width = 4;
+    img_desc.height = 4;
+    img_desc.pixel_format = SG_PIXELFORMAT_RGBA8;
+    img_desc.data.mip_levels[0].ptr = pixels;
+    img_desc.data.mip_levels[0].size = sizeof(pixels);
+    img_desc.label = "ssprite-white-texture";
+    _ssprite.white_img = sg_make_image(&img_desc);
+    _ssprite_clear(&view_desc, sizeof(view_desc));
+    view_desc.texture.image = _ssprite.white_img;
+    view_desc.label = "ssprite-white-texture-view";
+    _ssprite.white_view = sg_make_view(&view_desc);
+    sg_sampler_desc smp_desc;
+    _ssprite_clear(&smp_desc, sizeof(smp_desc));
+    smp_desc.min_filter = SG_FILTER_NEAREST;
+    smp_desc.mag_filter = SG_FILTER_NEAREST;
+    smp_desc.label = "ssprite-default-sampler";
+    _ssprite.def_smp = sg_make_sampler(&smp_desc);
+
+    // one pipeline per blend mode
+    _ssprite_init_shader();
+    if (_ssprite.shd.id != SG_INVALID_ID) {
+        for (int i = SSPRITE_BLENDMODE_ALPHA; i < _SSPRITE_BLENDMODE_NUM; i++) {
+            sg_pipeline_desc pip_desc;
+            _ssprite_clear(&pip_desc, sizeof(pip_desc));
+            pip_desc.shader = _ssprite.shd;
+            pip_desc.sample_count = _ssprite.desc.sample_count;
+            pip_desc.depth.pixel_format = _ssprite.desc.depth_format;
+            pip_desc.colors[0].pixel_format = _ssprite.desc.color_format;
+            if (i == SSPRITE_BLENDMODE_ALPHA) {
+                pip_desc.colors[0].blend.enabled = true;
+                pip_desc.colors[0].blend.src_factor_rgb = SG_BLENDFACTOR_SRC_ALPHA;
+                pip_desc.colors[0].blend.dst_factor_rgb = SG_BLENDFACTOR_ONE_MINUS_SRC_ALPHA;
+                pip_desc.colors[0].blend.src_factor_alpha = SG_BLENDFACTOR_ONE;
+                pip_desc.colors[0].blend.dst_factor_alpha = SG_BLENDFACTOR_ONE_MINUS_SRC_ALPHA;
+            } else if (i == SSPRITE_BLENDMODE_ADDITIVE) {
+                pip_desc.colors[0].blend.enabled = true;
+                pip_desc.colors[0].blend.src_factor_rgb = SG_BLENDFACTOR_SRC_ALPHA;
+                pip_desc.colors[0].blend.dst_factor_rgb = SG_BLENDFACTOR_ONE;
+                pip_desc.colors[0].blend.src_factor_alpha = SG_BLENDFACTOR_ZERO;
+                pip_desc.colors[0].blend.dst_factor_alpha = SG_BLENDFACTOR_ONE;
+            }
+            pip_desc.label = "ssprite-pipeline";
+            _ssprite.pip[i] = sg_make_pipeline(&pip_desc);
+        }
+    }
+    sg_pop_debug_group();
+}
+
+static void _ssprite_discard_resources(void) {
+    sg_push_debug_group("sokol-sprite");
+    for (int i = 0; i < _SSPRITE_BLENDMODE_NUM; i++) {
+        sg_destroy_pipeline(_ssprite.pip[i]);
+    }
+    if (_ssprite.own_shd) {
+        sg_destroy_shader(_ssprite.shd);
+    }
+    sg_destroy_sampler(_ssprite.def_smp);
+    sg_destroy_view(_ssprite.white_view);
+    sg_destroy_image(_ssprite.white_img);
+    sg_destroy_view(_ssprite.gpu_sbuf_view);
+    sg_destroy_buffer(_ssprite.gpu_sbuf);
+    sg_destroy_view(_ssprite.sbuf_view);
+    sg_destroy_buffer(_ssprite.sbuf);
+    sg_pop_debug_group();
+}
+
+// >>public
+SOKOL_API_IMPL void ssprite_setup(const ssprite_desc* desc) {
+    SOKOL_ASSERT(desc);
+    SOKOL_ASSERT(0 == _ssprite.init_tag);
+    _ssprite_clear(&_ssprite, sizeof(_ssprite));
+    _ssprite.init_tag = _SSPRITE_INIT_TAG;
+    _ssprite.desc = _ssprite_desc_defaults(desc);
+    SOKOL_ASSERT((_ssprite.desc.max_sprites > 0) && (_ssprite.desc.max_batches > 0));
+    SOKOL_ASSERT(_ssprite.desc.max_gpu_sprites >= 0);
+    _ssprite.sprites = (ssprite_sprite*) _ssprite_malloc(sizeof(ssprite_sprite) * (size_t)_ssprite.desc.max_sprites);
+    _ssprite.batches = (_ssprite_batch_t*) _ssprite_malloc_clear(sizeof(_ssprite_batch_t) * (size_t)_ssprite.desc.max_batches);
+    // without storage buffer support, sprites are still recorded but not rendered
+    if (sg_query_features().compute) {
+        _ssprite.valid = true;
+        _ssprite_init_resources();
+    } else {
+        _SSPRITE_ERROR(STORAGE_BUFFERS_NOT_SUPPORTED);
+    }
+}
+
+SOKOL_API_IMPL void ssprite_shutdown(void) {
+    SOKOL_ASSERT(_SSPRITE_INIT_TAG == _ssprite.init_tag);
+    _ssprite_discard_resources();
+    _ssprite_free(_ssprite.batches);
+    _ssprite_free(_ssprite.sprites);
+    _ssprite.init_tag = 0;
+}
+
+SOKOL_API_IMPL void ssprite_batch(const ssprite_batch_desc* desc) {
+    SOKOL_ASSERT(_SSPRITE_INIT_TAG == _ssprite.init_tag);
+    SOKOL_ASSERT(desc);
+    const ssprite_batch_desc desc_def = _ssprite_batch_desc_defaults(desc);
+    if (_ssprite.num_batches > 0) {
+        _ssprite_batch_t* cur = &_ssprite.batches[_ssprite.num_batches - 1];
+        if (_ssprite_batch_desc_equal(&cur->desc, &desc_def)) {
+            return;
+        }
+        // an empty batch is simply replaced
+        if (0 == cur->num) {
+            cur->desc = desc_def;
+            return;
+        }
+    }
+    if (_ssprite.num_batches >= _ssprite.desc.max_batches) {
+        _SSPRITE_ERROR(BATCH_POOL_EXHAUSTED);
+        return;
+    }
+    _ssprite_batch_t* batch = &_ssprite.batches[_ssprite.num_batches++];
+    batch->desc = desc_def;
+    batch->first = _ssprite.num_sprites;
+    batch->num = 0;
+}
+
+SOKOL_API_IMPL void ssprite_add_many(const ssprite_sprite* sprites, int num) {
+    SOKOL_ASSERT(_SSPRITE_INIT_TAG == _ssprite.init_tag);
+    SOKOL_ASSERT(sprites && (num >= 0));
+    _ssprite_batch_t* batch = _ssprite_cur_batch();
+    if (0 == batch) {
+        return;
+    }
+    if ((_ssprite.num_sprites + num) > _ssprite.desc.max_sprites) {
+        _SSPRITE_ERROR(SPRITE_BUFFER_FULL);
+        num = _ssprite.desc.max_sprites - _ssprite.num_sprites;
+    }
+    if (num > 0) {
+        memcpy(&_ssprite.sprites[_ssprite.num_sprites], sprites, (size_t)num * sizeof(ssprite_sprite));
+        _ssprite.num_sprites += num;
+        batch->num += num;
+    }
+}
+
+SOKOL_API_IMPL void ssprite_add(const ssprite_sprite* sprite) {
+    ssprite_add_many(sprite, 1);
+}
+
+SOKOL_API_IMPL void ssprite_draw(void) {
+    SOKOL_ASSERT(_SSPRITE_INIT_TAG == _ssprite.init_tag);
+    _ssprite_clear(&_ssprite.stats, sizeof(_ssprite.stats));
+    if (!_ssprite.valid || (0 == _ssprite.num_sprites)) {
+        _ssprite_reset();
+        return;
+    }
+    const size_t num_bytes = (size_t)_ssprite.num_sprites * sizeof(ssprite_sprite);
+    if (sg_query_buffer_will_overflow(_ssprite.sbuf, num_bytes)) {
+        _SSPRITE_ERROR(STREAM_BUFFER_FULL);
+        _ssprite_reset();
+        return;
+    }
+    const sg_range range = { _ssprite.sprites, num_bytes };
+    const int base_offset = sg_append_buffer(_ssprite.sbuf, &range);
+    // NOTE: the append offset is always a multiple of the sprite size
+    const int base_sprite = base_offset / (int)sizeof(ssprite_sprite);
+    int cur_blend_mode = _SSPRITE_BLENDMODE_DEFAULT;
+    for (int i = 0; i < _ssprite.num_batches; i++) {
+        const _ssprite_batch_t* batch = &_ssprite.batches[i];
+        if (0 == batch->num) {
+            continue;
+        }
+        if (batch->desc.blend_mode != (ssprite_blend_mode)cur_blend_mode) {
+            cur_blend_mode = batch->desc.blend_mode;
+            sg_apply_pipeline(_ssprite.pip[cur_blend_mode]);
+        }
+        _ssprite_apply_batch(&batch->desc, _ssprite.sbuf_view, base_sprite + batch->first);
+        sg_draw(0, 6, batch->num);
+        _ssprite.stats.num_batches += 1;
+    }
+    _ssprite.stats.num_sprites = _ssprite.num_sprites;
+    _ssprite.stats.num_bytes = (int)num_bytes;
+    _ssprite_reset();
+}
+
+SOKOL_API_IMPL void ssprite_simulate(const ssprite_simulate_desc* desc) {
+    SOKOL_ASSERT(_SSPRITE_INIT_TAG == _ssprite.init_tag);
+    SOKOL_ASSERT(desc);
+    if (!_ssprite.valid) {
+        return;
+    }
+    if (0 == _ssprite.desc.max_gpu_sprites) {
+        _SSPRITE_ERROR(NO_GPU_SPRITES);
+        return;
+    }
+    const int num_sprites = _ssprite_def(desc->num_sprites, _ssprite.desc.max_gpu_sprites);
+    const int group_size = _ssprite_def(desc->group_size, _SSPRITE_DEFAULT_GROUP_SIZE);
+    if ((num_sprites < 0) || (num_sprites > _ssprite.desc.max_gpu_sprites)) {
+        _SSPRITE_ERROR(GPU_SPRITES_OUT_OF_RANGE);
+        return;
+    }
+    sg_pass pass;
+    _ssprite_clear(&pass, sizeof(pass));
+    pass.compute = true;
+    pass.label = "ssprite-simulate";
+    sg_begin_pass(&pass);
+    sg_apply_pipeline(desc->pipeline);
+    sg_bindings bnd;
+    _ssprite_clear(&bnd, sizeof(bnd));
+    bnd.views[0] = _ssprite.gpu_sbuf_view;
+    sg_apply_bindings(&bnd);
+    if (desc->uniforms.ptr) {
+        sg_apply_uniforms(0, &desc->uniforms);
+    }
+    sg_dispatch((num_sprites + group_size - 1) / group_size, 1, 1);
+    sg_end_pass();
+}
+
+SOKOL_API_IMPL void ssprite_draw_gpu(const ssprite_gpu_draw_desc* desc) {
+    SOKOL_ASSERT(_SSPRITE_INIT_TAG == _ssprite.init_tag);
+    SOKOL_ASSERT(desc);
+    if (!_ssprite.valid) {
+        return;
+    }
+    if (0 == _ssprite.desc.max_gpu_sprites) {
+        _SSPRITE_ERROR(NO_GPU_SPRITES);
+        return;
+    }
+    const int num = _ssprite_def(desc->num, _ssprite.desc.max_gpu_sprites - desc->first);
+    if ((desc->first < 0) || (num <= 0) || ((desc->first + num) > _ssprite.desc.max_gpu_sprites)) {
+        _SSPRITE_ERROR(GPU_SPRITES_OUT_OF_RANGE);
+        return;
+    }
+    const ssprite_batch_desc batch = _ssprite_batch_desc_defaults(&desc->batch);
+    sg_apply_pipeline(_ssprite.pip[batch.blend_mode]);
+    _ssprite_apply_batch(&batch, _ssprite.gpu_sbuf_view, desc->first);
+    sg_draw(0, 6, num);
+}
+
+SOKOL_API_IMPL sg_buffer ssprite_query_gpu_buffer(void) {
+    SOKOL_ASSERT(_SSPRITE_INIT_TAG == _ssprite.init_tag);
+    return _ssprite.gpu_sbuf;
+}
+
+SOKOL_API_IMPL ssprite_stats ssprite_query_stats(void) {
+    SOKOL_ASSERT(_SSPRITE_INIT_TAG == _ssprite.init_tag);
+    return _ssprite.stats;
+}
+
+SOKOL_API_IMPL uint32_t ssprite_pack_uv(float u, float v) {
+    u = (u < 0.0f) ? 0.0f : ((u > 1.0f) ? 1.0f : u);
+    v = (v < 0.0f) ? 0.0f : ((v > 1.0f) ? 1.0f : v);
+    return ((uint32_t)(v * 65535.0f + 0.5f) << 16) | (uint32_t)(u * 65535.0f + 0.5f);
+}
+
+SOKOL_API_IMPL uint32_t ssprite_pack_color(float r, float g, float b, float a) {
+    const float c[4] = { r, g, b, a };
+    uint32_t res = 0;
+    for (int i = 0; i < 4; i++) {
+        const float f = (c[i] < 0.0f) ? 0.0f : ((c[i] > 1.0f) ? 1.0f : c[i]);
+        res |= (uint32_t)(f * 255.0f + 0.5f) << (i * 8);
+    }
+    return res;
+}
+
+SOKOL_API_IMPL ssprite_mat4_t ssprite_mat4(const float m[16]) {
+    ssprite_mat4_t res;
+    memcpy(&res.m[0][0], &m[0], 64);
+    return res;
+}
+
+SOKOL_API_IMPL ssprite_mat4_t ssprite_mat4_transpose(const float m[16]) {
+    ssprite_mat4_t res;
+    for (int c = 0; c < 4; c++) {
+        for (int r = 0; r < 4; r++) {
+            res.m[r][c] = m[c*4 + r];
+        }
+    }
+    return res;
+}
+
+#endif // SOKOL_SPRITE_IMPL
@@ -0,0 +1,758 @@
+#if defined(SOKOL_IMPL) && !defined(SOKOL_VERTEXPACK_IMPL)
+#define SOKOL_VERTEXPACK_IMPL
+#endif
+#ifndef SOKOL_VERTEXPACK_INCLUDED
+/*
+    sokol_vertexpack.h -- quantize and pack vertex data into compact vertex formats
+
+    Project URL: https://github.com/floooh/sokol
+
+    Do this:
+        #define SOKOL_IMPL or
+        #define SOKOL_VERTEXPACK_IMPL
+    before you include this file in *one* C or C++ file to create the
+    implementation.
+
+    Include the following headers before including sokol_vertexpack.h:
+
+        sokol_gfx.h
+
+    ...optionally provide the following macros to override defaults:
+
+    SOKOL_ASSERT(c)     - your own assert macro (default: assert(c))
+    SOKOL_VERTEXPACK_API_DECL - public function declaration prefix (default: extern)
+    SOKOL_API_DECL      - same as SOKOL_VERTEXPACK_API_DECL
+    SOKOL_API_IMPL      - public function implementation prefix (default: -)
+
+    If sokol_vertexpack.h is compiled as a DLL, define the following before
+    including the declaration or implementation:
+
+    SOKOL_DLL
+
+    On Windows, SOKOL_DLL will define SOKOL_VERTEXPACK_API_DECL as __declspec(dllexport)
+    or __declspec(dllimport) as needed.
+
+    FEATURE OVERVIEW
+    ================
+    sokol_vertexpack.h converts separate float vertex component streams
+    (positions, normals, texture coordinates and colors) into a single
+    interleaved vertex buffer with compact vertex formats, and returns the
+    matching sg_vertex_layout_state for sg_pipeline_desc.layout.
+
+    Supported output formats per vertex component (the first is the default):
+
+    - position:
+        - SVPACK_POSITION_SHORT4N: 8 bytes, quantized relative to the bounding box
+        - SVPACK_POSITION_FLOAT3: 12 bytes, unchanged
+    - normal:
+        - SVPACK_NORMAL_OCT_SHORT2N: 4 bytes, octahedral encoding
+        - SVPACK_NORMAL_UINT10_N2: 4 bytes, xyz remapped to 0..1
+        - SVPACK_NORMAL_BYTE4N: 4 bytes (same as sokol_shape.h)
+        - SVPACK_NORMAL_FLOAT3: 12 bytes, unchanged
+    - texcoord:
+        - SVPACK_TEXCOORD_HALF2: 4 bytes, 16-bit floats (allows wrapped UVs)
+        - SVPACK_TEXCOORD_USHORT2N: 4 bytes, clamped to 0..1
+        - SVPACK_TEXCOORD_FLOAT2: 8 bytes, unchanged
+    - color:
+        - SVPACK_COLOR_UBYTE4N: 4 bytes
+        - SVPACK_COLOR_FLOAT4: 16 bytes, unchanged
+
+    With the default formats, a vertex with float3 position, float3 normal
+    and float2 texcoord shrinks from 32 to 16 bytes.
+
+    STEP-BY-STEP
+    ============
+    Describe the input vertex streams (the stride defaults to the size
+    of the input component, so tightly packed arrays don't need a stride),
+    and optionally override the output formats:
+
+    ```c
+    svpack_desc desc = {
+        .num_vertices = num_vertices,
+        .positions = { .data = SG_RANGE(positions) },   // float3, required
+        .normals = { .data = SG_RANGE(normals) },       // float3, optional
+        .texcoords = { .data = SG_RANGE(uvs) },         // float2, optional
+        .colors = { .data = SG_RANGE(colors) },         // float4, optional
+        .formats = {
+            .normal = SVPACK_NORMAL_BYTE4N,
+        },
+    };
+    ```
+
+    ...or for an interleaved input vertex buffer:
+
+    ```c
+    svpack_desc desc = {
+        .num_vertices = num_vertices,
+        .positions = {
+            .data = { &vertices[0].pos, sizeof(vertices) - offsetof(vertex_t, pos) },
+            .stride = sizeof(vertex_t),
+        },
+        .normals = {
+            .data = { &vertices[0].normal, sizeof(vertices) - offsetof(vertex_t, normal) },
+            .stride = sizeof(vertex_t),
+        },
+    };
+    ```
+
+    Get the required size of the output buffer and provide the output buffer:
+
+    ```c
+    const size_t size = svpack_buffer_size(&desc);
+    desc.buffer = (sg_range){ .ptr = malloc(size), .size = size };
+    ```
+
+    Pack the vertices:
+
+    ```c
+    const svpack_result res = svpack_pack(&desc);
+    if (!res.valid) {
+        // input streams or output buffer too small
+    }
+    ```
+
+    Create a vertex buffer from the output buffer:
+
+    ```c
+    sg_buffer vbuf = sg_make_buffer(&(sg_buffer_desc){
+        .data = { desc.buffer.ptr, res.size },
+    });
+    ```
+
+    ...and use the vertex layout in the pipeline object. The returned layout
+    has the vertex attributes in consecutive attribute slots in the order
+    position, normal, texcoord, color (skipping missing components) using
+    vertex buffer slot desc.buffer_index:
+
+    ```c
+    sg_pipeline pip = sg_make_pipeline(&(sg_pipeline_desc){
+        .layout = res.layout,
+        ...
+    });
+    ```
+
+    If your shader uses different attribute slots, build the layout from the
+    individual attribute states in the result instead:
+
+    ```c
+    sg_pipeline_desc pip_desc = {0};
+    pip_desc.layout.buffers[0].stride = res.stride;
+    pip_desc.layout.attrs[ATTR_position] = res.position;
+    pip_desc.layout.attrs[ATTR_normal] = res.normal;
+    ```
+
+    DECODING IN THE VERTEX SHADER
+    =============================
+    Quantized positions (SVPACK_POSITION_SHORT4N) must be transformed back
+    into the original coordinate space with the dequantization parameters
+    in svpack_result.dequant. The w component is written as 1.0, so that the
+    dequantization can be folded into the model matrix:
+
+    ```c
+    // model = model * dequant
+    mat4 model = mat4_mul(model, res.dequant.matrix);
+    ```
+
+    ...or applied explicitly in the vertex shader (res.dequant.scale
+    and res.dequant.offset are already padded to vec4):
+
+    ```glsl
+    vec3 pos = position.xyz * dequant_scale.xyz + dequant_offset.xyz;
+    ```
+
+    Octahedral normals (SVPACK_NORMAL_OCT_SHORT2N) are decoded with:
+
+    ```glsl
+    vec3 oct_decode(vec2 e) {
+        vec3 n = vec3(e.xy, 1.0 - abs(e.x) - abs(e.y));
+        float t = max(-n.z, 0.0);
+        n.x += (n.x >= 0.0) ? -t : t;
+        n.y += (n.y >= 0.0) ? -t : t;
+        return normalize(n);
+    }
+    ```
+
+    ...and SVPACK_NORMAL_UINT10_N2 normals with:
+
+    ```glsl
+    vec3 n = normal.xyz * 2.0 - 1.0;
+    ```
+
+    All other formats don't need decoding in the vertex shader.
+
+    LICENSE
+    =======
+    zlib/libpng license
+
+    Copyright (c) 2026 Andre Weissflog
+
+    This software is provided 'as-is', without any express or implied warranty.
+    In no event will the authors be held liable for any damages arising from the
+    use of this software.
+
+    Permission is granted to anyone to use this software for any purpose,
+    including commercial applications, and to alter it and redistribute it
+    freely, subject to the following restrictions:
+
+        1. The origin of this software must not be misrepresented; you must not
+        claim that you wrote the original software. If you use this software in a
+        product, an acknowledgment in the product documentation would be
+        appreciated but is not required.
+
+        2. Altered source versions must be plainly marked as such, and must not
+        be misrepresented as being the original software.
+
+        3. This notice may not be removed or altered from any source
+        distribution.
+*/
+#define SOKOL_VERTEXPACK_INCLUDED
+#include <stddef.h>     // size_t
+#include <stdint.h>
+#include <stdbool.h>
+
+#if !defined(SOKOL_GFX_INCLUDED)
+#error "Please include sokol_gfx.h before sokol_vertexpack.h"
+#endif
+
+#if defined(SOKOL_API_DECL) && !defined(SOKOL_VERTEXPACK_API_DECL)
+#define SOKOL_VERTEXPACK_API_DECL SOKOL_API_DECL
+#endif
+#ifndef SOKOL_VERTEXPACK_API_DECL
+#if defined(_WIN32) && defined(SOKOL_DLL) && defined(SOKOL_VERTEXPACK_IMPL)
+#define SOKOL_VERTEXPACK_API_DECL __declspec(dllexport)
+#elif defined(_WIN32) && defined(SOKOL_DLL)
+#define SOKOL_VERTEXPACK_API_DECL __declspec(dllimport)
+#else
+#define SOKOL_VERTEXPACK_API_DECL extern
+#endif
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef enum svpack_position_format {
+    _SVPACK_POSITION_DEFAULT,       // value 0 reserved for default-init
+    SVPACK_POSITION_SHORT4N,
+    SVPACK_POSITION_FLOAT3,
+    _SVPACK_POSITION_NUM,
+} svpack_position_format;
+
+typedef enum svpack_normal_format {
+    _SVPACK_NORMAL_DEFAULT,         // value 0 reserved for default-init
+    SVPACK_NORMAL_OCT_SHORT2N,
+    SVPACK_NORMAL_UINT10_N2,
+    SVPACK_NORMAL_BYTE4N,
+    SVPACK_NORMAL_FLOAT3,
+    _SVPACK_NORMAL_NUM,
+} svpack_normal_format;
+
+typedef enum svpack_texcoord_format {
+    _SVPACK_TEXCOORD_DEFAULT,       // value 0 reserved for default-init
+    SVPACK_TEXCOORD_HALF2,
+    SVPACK_TEXCOORD_USHORT2N,
+    SVPACK_TEXCOORD_FLOAT2,
+    _SVPACK_TEXCOORD_NUM,
+} svpack_texcoord_format;
+
+typedef enum svpack_color_format {
+    _SVPACK_COLOR_DEFAULT,          // value 0 reserved for default-init
+    SVPACK_COLOR_UBYTE4N,
+    SVPACK_COLOR_FLOAT4,
+    _SVPACK_COLOR_NUM,
+} svpack_color_format;
+
+// output formats of the vertex components
+typedef struct svpack_formats {
+    svpack_position_format position;
+    svpack_normal_format normal;
+    svpack_texcoord_format texcoord;
+    svpack_color_format color;
+} svpack_formats;
+
+// an input vertex component stream
+typedef struct svpack_stream {
+    sg_range data;      // pointer to the first component and size of the data
+    int stride;         // default: size of input component (float3: 12, float2: 8, float4: 16)
+} svpack_stream;
+
+typedef struct svpack_desc {
+    int num_vertices;
+    svpack_stream positions;    // float3, required
+    svpack_stream normals;      // float3, optional
+    svpack_stream texcoords;    // float2, optional
+    svpack_stream colors;       // float4, optional
+    svpack_formats formats;
+    float bbox_min[3];          // optional bounding box for position quantization
+    float bbox_max[3];          // (default: computed from positions)
+    int buffer_index;           // vertex buffer bind slot in the returned layout
+    sg_range buffer;            // the output buffer
+} svpack_desc;
+
+/*
+    Dequantization parameters to convert packed positions back into
+    the original coordinate space:
+
+        pos = packed_pos * scale + offset
+
+    ...or with w == 1.0:
+
+        pos = matrix * packed_pos
+
+    The matrix is column-major.
+*/
+typedef struct svpack_dequant {
+    float scale[4];
+    float offset[4];
+    float matrix[16];
+} svpack_dequant;
+
+typedef struct svpack_result {
+    bool valid;
+    int num_vertices;
+    int stride;                 // size of an output vertex in bytes
+    size_t size;                // number of bytes written to the output buffer
+    svpack_formats formats;     // the resolved output formats
+    svpack_dequant dequant;     // position dequantization parameters
+    sg_vertex_attr_state position;
+    sg_vertex_attr_state normal;    // .format == SG_VERTEXFORMAT_INVALID if no normals
+    sg_vertex_attr_state texcoord;  // .format == SG_VERTEXFORMAT_INVALID if no texcoords
+    sg_vertex_attr_state color;     // .format == SG_VERTEXFORMAT_INVALID if no colors
+    sg_vertex_layout_state layout;
+} svpack_result;
+
+// return the output vertex size in bytes
+SOKOL_VERTEXPACK_API_DECL int svpack_vertex_stride(const svpack_desc* desc);
+// return the required output buffer size in bytes
+SOKOL_VERTEXPACK_API_DECL size_t svpack_buffer_size(const svpack_desc* desc);
+// quantize and pack vertices into the output buffer
+SOKOL_VERTEXPACK_API_DECL svpack_result svpack_pack(const svpack_desc* desc);
+
+// helper functions for encoding and decoding
+SOKOL_VERTEXPACK_API_DECL uint16_t svpack_float_to_half(float f);
+SOKOL_VERTEXPACK_API_DECL float svpack_half_to_float(uint16_t h);
+SOKOL_VERTEXPACK_API_DECL void svpack_oct_encode(const float n[3], float out_e[2]);
+SOKOL_VERTEXPACK_API_DECL void svpack_oct_decode(const float e[2], float out_n[3]);
+
+#ifdef __cplusplus
+} // extern "C"
+
+// reference-based equivalents for C++
+inline int svpack_vertex_stride(const svpack_desc& desc) { return svpack_vertex_stride(&desc); }
+inline size_t svpack_buffer_size(const svpack_desc& desc) { return svpack_buffer_size(&desc); }
+inline svpack_result svpack_pack(const svpack_desc& desc) { return svpack_pack(&desc); }
+
+#endif
+#endif // SOKOL_VERTEXPACK_INCLUDED
+
+/*-- IMPLEMENTATION ----------------------------------------------------------*/
+#ifdef SOKOL_VERTEXPACK_IMPL
+#define SOKOL_VERTEXPACK_IMPL_INCLUDED (1)
+
+#include <string.h> // memcpy, memset
+#include <math.h>   // fabsf, sqrtf
+
+#ifndef SOKOL_API_IMPL
+    #define SOKOL_API_IMPL
+#endif
+#ifndef SOKOL_ASSERT
+    #include <assert.h>
+    #define SOKOL_ASSERT(c) assert(c)
+#endif
+
+#define _svpack_def(val, def) (((val) == 0) ? (def) : (val))
+
+static svpack_formats _svpack_formats_defaults(const svpack_formats* fmts) {
+    svpack_formats res = *fmts;
+    res.position = _svpack_def(res.position, SVPACK_POSITION_SHORT4N);
+    res.normal = _svpack_def(res.normal, SVPACK_NORMAL_OCT_SHORT2N);
+    res.texcoord = _svpack_def(res.texcoord, SVPACK_TEXCOORD_HALF2);
+    res.color = _svpack_def(res.color, SVPACK_COLOR_UBYTE4N);
+    return res;
+}
+
+static bool _svpack_has(const svpack_stream* stream) {
+    return 0 != stream->data.ptr;
+}
+
+static int _svpack_position_size(svpack_position_format fmt) {
+    return (fmt == SVPACK_POSITION_FLOAT3) ? 12 : 8;
+}
+
+static int _svpack_normal_size(svpack_normal_format fmt) {
+    return (fmt == SVPACK_NORMAL_FLOAT3) ? 12 : 4;
+}
+
+static int _svpack_texcoord_size(svpack_texcoord_format fmt) {
+    return (fmt == SVPACK_TEXCOORD_FLOAT2) ? 8 : 4;
+}
+
+static int _svpack_color_size(svpack_color_format fmt) {
+    return (fmt == SVPACK_COLOR_FLOAT4) ? 16 : 4;
+}
+
+static sg_vertex_format _svpack_position_vertex_format(svpack_position_format fmt) {
+    return (fmt == SVPACK_POSITION_FLOAT3) ? SG_VERTEXFORMAT_FLOAT3 : SG_VERTEXFORMAT_SHORT4N;
+}
+
+static sg_vertex_format _svpack_normal_vertex_format(svpack_normal_format fmt) {
+    switch (fmt) {
+        case SVPACK_NORMAL_UINT10_N2:   return SG_VERTEXFORMAT_UINT10_N2;
+        case SVPACK_NORMAL_BYTE4N:      return SG_VERTEXFORMAT_BYTE4N;
+        case SVPACK_NORMAL_FLOAT3:      return SG_VERTEXFORMAT_FLOAT3;
+        default:                        return SG_VERTEXFORMAT_SHORT2N;
+    }
+}
+
+static sg_vertex_format _svpack_texcoord_vertex_format(svpack_texcoord_format fmt) {
+    switch (fmt) {
+        case SVPACK_TEXCOORD_USHORT2N:  return SG_VERTEXFORMAT_USHORT2N;
+        case SVPACK_TEXCOORD_FLOAT2:    return SG_VERTEXFORMAT_FLOAT2;
+        default:                        return SG_VERTEXFORMAT_HALF2;
+    }
+}
+
+static sg_vertex_format _svpack_color_vertex_format(svpack_color_format fmt) {
+    return (fmt == SVPACK_COLOR_FLOAT4) ? SG_VERTEXFORMAT_FLOAT4 : SG_VERTEXFORMAT_UBYTE4N;
+}
+
+static float _svpack_clamp(float v, float lo, float hi) {
+    return (v < lo) ? lo : ((v > hi) ? hi : v);
+}
+
+static int16_t _svpack_pack_snorm16(float v) {
+    const float f = _svpack_clamp(v, -1.0f, 1.0f) * 32767.0f;
+    return (int16_t)((f >= 0.0f) ? (f + 0.5f) : (f - 0.5f));
+}
+
+static uint16_t _svpack_pack_unorm16(float v) {
+    return (uint16_t)(_svpack_clamp(v, 0.0f, 1.0f) * 65535.0f + 0.5f);
+}
+
+static int8_t _svpack_pack_snorm8(float v) {
+    const float f = _svpack_clamp(v, -1.0f, 1.0f) * 127.0f;
+    return (int8_t)((f >= 0.0f) ? (f + 0.5f) : (f - 0.5f));
+}
+
+static uint8_t _svpack_pack_unorm8(float v) {
+    return (uint8_t)(_svpack_clamp(v, 0.0f, 1.0f) * 255.0f + 0.5f);
+}
+
+static uint32_t _svpack_pack_unorm10(float v) {
+    return (uint32_t)(_svpack_clamp(v, 0.0f, 1.0f) * 1023.0f + 0.5f);
+}
+
+// check that an input stream covers all vertices
+static bool _svpack_stream_valid(const svpack_stream* stream, int stride, size_t item_size, int num_vertices) {
+    const size_t required = (size_t)(num_vertices - 1) * (size_t)stride + item_size;
+    return stream->data.size >= required;
+}
+
+static svpack_dequant _svpack_dequant(const float bmin[3], const float bmax[3], bool quantized) {
+    svpack_dequant res;
+    memset(&res, 0, sizeof(res));
+    for (int i = 0; i < 3; i++) {
+        if (quantized) {
+            res.scale[i] = (bmax[i] - bmin[i]) * 0.5f;
+            res.offset[i] = (bmax[i] + bmin[i]) * 0.5f;
+        } else {
+            res.scale[i] = 1.0f;
+        }
+    }
+    res.matrix[0] = res.scale[0];
+    res.matrix[5] = res.scale[1];
+    res.matrix[10] = res.scale[2];
+    res.matrix[12] = res.offset[0];
+    res.matrix[13] = res.offset[1];
+    res.matrix[14] = res.offset[2];
+    res.matrix[15] = 1.0f;
+    return res;
+}
+
+static void _svpack_compute_bbox(const svpack_desc* desc, int stride, float bmin[3], float bmax[3]) {
+    const uint8_t* src = (const uint8_t*)desc->positions.data.ptr;
+    for (int vi = 0; vi < desc->num_vertices; vi++, src += stride) {
+        float p[3];
+        memcpy(p, src, sizeof(p));
+        for (int i = 0; i < 3; i++) {
+            if ((0 == vi) || (p[i] < bmin[i])) {
+                bmin[i] = p[i];
+            }
+            if ((0 == vi) || (p[i] > bmax[i])) {
+                bmax[i] = p[i];
+            }
+        }
+    }
+}
+
+SOKOL_API_IMPL uint16_t svpack_float_to_half(float f) {
+    uint32_t x;
+    memcpy(&x, &f, sizeof(x));
+    const uint32_t sign = (x >> 16) & 0x8000;
+    const uint32_t absx = x & 0x7FFFFFFF;
+    if (absx >= 0x7F800000) {
+        // infinity or NaN
+        return (uint16_t)(sign | 0x7C00 | ((absx > 0x7F800000) ? 0x200 : 0));
+    }
+    if (absx >= 0x477FF000) {
+        // rounds to infinity (>= 65520.0)
+        return (uint16_t)(sign | 0x7C00);
+    }
+    if (absx < 0x38800000) {
+        // denormal or zero (< 2^-14)
+        const float a = fabsf(f);
+        return (uint16_t)(sign | (uint32_t)(a * 16777216.0f + 0.5f));
+    }
+    const uint32_t mant = absx & 0x7FFFFF;
+    uint32_t h = ((((absx >> 23) - 112) << 10)) | (mant >> 13);
+    // round to nearest even
+    const uint32_t rem = mant & 0x1FFF;
+    if ((rem > 0x1000) || ((rem == 0x1000) && (h & 1))) {
+        h++;
+    }
+    return (uint16_t)(sign | h);
+}
+
+SOKOL_API_IMPL float svpack_half_to_float(uint16_t h) {
+    const uint32_t sign = ((uint32_t)h & 0x8000) << 16;
+    const uint32_t exp = ((uint32_t)h >> 10) & 0x1F;
+    const uint32_t mant = (uint32_t)h & 0x3FF;
+    uint32_t x;
+    if (0 == exp) {
+        const float f = (float)mant * (1.0f / 16777216.0f);
+        memcpy(&x, &f, sizeof(x));
+        x |= sign;
+    } else if (31 == exp) {
+        x = sign | 0x7F800000 | (mant << 13);
+    } else {
+        x = sign | ((exp + 112) << 23) | (mant << 13);
+    }
+    float res;
+    memcpy(&res, &x, sizeof(res));
+    return res;
+}
+
+SOKOL_API_IMPL void svpack_oct_encode(const float n[3], float out_e[2]) {
+    SOKOL_ASSERT(n && out_e);
+    const float l1 = fabsf(n[0]) + fabsf(n[1]) + fabsf(n[2]);
+    if (l1 == 0.0f) {
+        out_e[0] = 0.0f;
+        out_e[1] = 0.0f;
+        return;
+    }
+    const float x = n[0] / l1;
+    const float y = n[1] / l1;
+    if (n[2] < 0.0f) {
+        // fold the lower hemisphere over the diagonals
+        out_e[0] = (1.0f - fabsf(y)) * ((x >= 0.0f) ? 1.0f : -1.0f);
+        out_e[1] = (1.0f - fabsf(x)) * ((y >= 0.0f) ? 1.0f : -1.0f);
+    } else {
+        out_e[0] = x;
+        out_e[1] = y;
+    }
+}
+
+SOKOL_API_IMPL void svpack_oct_decode(const float e[2], float out_n[3]) {
+    SOKOL_ASSERT(e && out_n);
+    float x = e[0];
+    float y = e[1];
+    const float z = 1.0f - fabsf(x) - fabsf(y);
+    const float t = (z < 0.0f) ? -z : 0.0f;
+    x += (x >= 0.0f) ? -t : t;
+    y += (y >= 0.0f) ? -t : t;
+    const float len = sqrtf(x * x + y * y + z * z);
+    out_n[0] = x / len;
+    out_n[1] = y / len;
+    out_n[2] = z / len;
+}
+
+SOKOL_API_IMPL int svpack_vertex_stride(const svpack_desc* desc) {
+    SOKOL_ASSERT(desc);
+    const svpack_formats fmts = _svpack_formats_defaults(&desc->formats);
+    int stride = _svpack_position_size(fmts.position);
+    if (_svpack_has(&desc->normals)) {
+        stride += _svpack_normal_size(fmts.normal);
+    }
+    if (_svpack_has(&desc->texcoords)) {
+        stride += _svpack_texcoord_size(fmts.texcoord);
+    }
+    if (_svpack_has(&desc->colors)) {
+        stride += _svpack_color_size(fmts.color);
+    }
+    return stride;
+}
+
+SOKOL_API_IMPL size_t svpack_buffer_size(const svpack_desc* desc) {
+    SOKOL_ASSERT(desc && (desc->num_vertices >= 0));
+    return (size_t)desc->num_vertices * (size_t)svpack_vertex_stride(desc);
+}
+
+SOKOL_API_IMPL svpack_result svpack_pack(const svpack_desc* desc) {
+    SOKOL_ASSERT(desc);
+    SOKOL_ASSERT((desc->buffer_index >= 0) && (desc->buffer_index < SG_MAX_VERTEXBUFFER_BINDSLOTS));
+    svpack_result res;
+    memset(&res, 0, sizeof(res));
+    res.formats = _svpack_formats_defaults(&desc->formats);
+    res.num_vertices = desc->num_vertices;
+    res.stride = svpack_vertex_stride(desc);
+    res.size = svpack_buffer_size(desc);
+
+    // validate input and output buffers
+    const int pos_stride = _svpack_def(desc->positions.stride, 12);
+    const int nrm_stride = _svpack_def(desc->normals.stride, 12);
+    const int uv_stride = _svpack_def(desc->texcoords.stride, 8);
+    const int clr_stride = _svpack_def(desc->colors.stride, 16);
+    const bool has_normals = _svpack_has(&desc->normals);
+    const bool has_texcoords = _svpack_has(&desc->texcoords);
+    const bool has_colors = _svpack_has(&desc->colors);
+    if ((desc->num_vertices <= 0) || !_svpack_has(&desc->positions)) {
+        return res;
+    }
+    if ((0 == desc->buffer.ptr) || (desc->buffer.size < res.size)) {
+        return res;
+    }
+    if (!_svpack_stream_valid(&desc->positions, pos_stride, 12, desc->num_vertices)
+        || (has_normals && !_svpack_stream_valid(&desc->normals, nrm_stride, 12, desc->num_vertices))
+        || (has_texcoords && !_svpack_stream_valid(&desc->texcoords, uv_stride, 8, desc->num_vertices))
+        || (has_colors && !_svpack_stream_valid(&desc->colors, clr_stride, 16, desc->num_vertices)))
+    {
+        return res;
+    }
+
+    // vertex layout with consecutive attribute slots
+    int offset = 0;
+    int attr_index = 0;
+    res.position.buffer_index = desc->buffer_index;
+    res.position.offset = offset;
+    res.position.format = _svpack_position_vertex_format(res.formats.position);
+    res.layout.attrs[attr_index++] = res.position;
+    offset += _svpack_position_size(res.formats.position);
+    if (has_normals) {
+        res.normal.buffer_index = desc->buffer_index;
+        res.normal.offset = offset;
+        res.normal.format = _svpack_normal_vertex_format(res.formats.normal);
+        res.layout.attrs[attr_index++] = res.normal;
+        offset += _svpack_normal_size(res.formats.normal);
+    }
+    if (has_texcoords) {
+        res.texcoord.buffer_index = desc->buffer_index;
+        res.texcoord.offset = offset;
+        res.texcoord.format = _svpack_texcoord_vertex_format(res.formats.texcoord);
+        res.layout.attrs[attr_index++] = res.texcoord;
+        offset += _svpack_texcoord_size(res.formats.texcoord);
+    }
+    if (has_colors) {
+        res.color.buffer_index = desc->buffer_index;
+        res.color.offset = offset;
+        res.color.format = _svpack_color_vertex_format(res.formats.color);
+        res.layout.attrs[attr_index++] = res.color;
+        offset += _svpack_color_size(res.formats.color);
+    }
+    SOKOL_ASSERT(offset == res.stride);
+    res.layout.buffers[desc->buffer_index].stride = res.stride;
+
+    // position quantization parameters
+    const bool quantize = res.formats.position == SVPACK_POSITION_SHORT4N;
+    float bmin[3], bmax[3];
+    memcpy(bmin, desc->bbox_min, sizeof(bmin));
+    memcpy(bmax, desc->bbox_max, sizeof(bmax));
+    if ((0 == memcmp(bmin, bmax, sizeof(bmin))) && quantize) {
+        _svpack_compute_bbox(desc, pos_stride, bmin, bmax);
+    }
+    res.dequant = _svpack_dequant(bmin, bmax, quantize);
+    float inv_scale[3];
+    for (int i = 0; i < 3; i++) {
+        inv_scale[i] = (res.dequant.scale[i] != 0.0f) ? (1.0f / res.dequant.scale[i]) : 0.0f;
+    }
+
+    // quantize and pack vertices
+    const uint8_t* pos_src = (const uint8_t*)desc->positions.data.ptr;
+    const uint8_t* nrm_src = (const uint8_t*)desc->normals.data.ptr;
+    const uint8_t* uv_src = (const uint8_t*)desc->texcoords.data.ptr;
+    const uint8_t* clr_src = (const uint8_t*)desc->colors.data.ptr;
+    uint8_t* dst = (uint8_t*)desc->buffer.ptr;
+    for (int vi = 0; vi < desc->num_vertices; vi++, dst += res.stride) {
+        float p[3];
+        memcpy(p, pos_src + vi * pos_stride, sizeof(p));
+        if (quantize) {
+            int16_t q[4];
+            for (int i = 0; i < 3; i++) {
+                q[i] = _svpack_pack_snorm16((p[i] - res.dequant.offset[i]) * inv_scale[i]);
+            }
+            q[3] = 32767;
+            memcpy(dst + res.position.offset, q, sizeof(q));
+        } else {
+            memcpy(dst + res.position.offset, p, sizeof(p));
+        }
+        if (has_normals) {
+            float n[3];
+            memcpy(n, nrm_src + vi * nrm_stride, sizeof(n));
+            uint8_t* nrm_dst = dst + res.normal.offset;
+            switch (res.formats.normal) {
+                case SVPACK_NORMAL_UINT10_N2:
+                    {
+                        const uint32_t v = _svpack_pack_unorm10(n[0] * 0.5f + 0.5f)
+                            | (_svpack_pack_unorm10(n[1] * 0.5f + 0.5f) << 10)
+                            | (_svpack_pack_unorm10(n[2] * 0.5f + 0.5f) << 20)
+                            | (3u << 30);
+                        memcpy(nrm_dst, &v, sizeof(v));
+                    }
+                    break;
+                case SVPACK_NORMAL_BYTE4N:
+                    {
+                        const int8_t v[4] = { _svpack_pack_snorm8(n[0]), _svpack_pack_snorm8(n[1]), _svpack_pack_snorm8(n[2]), 0 };
+                        memcpy(nrm_dst, v, sizeof(v));
+                    }
+                    break;
+                case SVPACK_NORMAL_FLOAT3:
+                    memcpy(nrm_dst, n, sizeof(n));
+                    break;
+                default:
+                    {
+                        float e[2];
+                        svpack_oct_encode(n, e);
+                        const int16_t v[2] = { _svpack_pack_snorm16(e[0]), _svpack_pack_snorm16(e[1]) };
+                        memcpy(nrm_dst, v, sizeof(v));
+                    }
+                    break;
+            }
+        }
+        if (has_texcoords) {
+            float uv[2];
+            memcpy(uv, uv_src + vi * uv_stride, sizeof(uv));
+            uint8_t* uv_dst = dst + res.texcoord.offset;
+            switch (res.formats.texcoord) {
+                case SVPACK_TEXCOORD_USHORT2N:
+                    {
+                        const uint16_t v[2] = { _svpack_pack_unorm16(uv[0]), _svpack_pack_unorm16(uv[1]) };
+                        memcpy(uv_dst, v, sizeof(v));
+                    }
+                    break;
+                case SVPACK_TEXCOORD_FLOAT2:
+                    memcpy(uv_dst, uv, sizeof(uv));
+                    break;
+                default:
+                    {
+                        const uint16_t v[2] = { svpack_float_to_half(uv[0]), svpack_float_to_half(uv[1]) };
+                        memcpy(uv_dst, v, sizeof(v));
+                    }
+                    break;
+            }
+        }
+        if (has_colors) {
+            float c[4];
+            memcpy(c, clr_src + vi * clr_stride, sizeof(c));
+            uint8_t* clr_dst = dst + res.color.offset;
+            if (res.formats.color == SVPACK_COLOR_FLOAT4) {
+                memcpy(clr_dst, c, sizeof(c));
+            } else {
+                const uint8_t v[4] = { _svpack_pack_unorm8(c[0]), _svpack_pack_unorm8(c[1]), _svpack_pack_unorm8(c[2]), _svpack_pack_unorm8(c[3]) };
+                memcpy(clr_dst, v, sizeof(v));
+            }
+        }
+    }
+    res.valid = true;
+    return res;
+}
+
+#endif // SOKOL_VERTEXPACK_IMPL